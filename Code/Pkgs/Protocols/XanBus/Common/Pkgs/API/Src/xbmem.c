@@ -225,7 +225,6 @@ Version 1.03  Date: 06/13/06  By: Hollyz
 tucBOOL XBMEM_fnCtor( void *pvHeapStart,
                       uint16 uiHeapSize )
 {
-    printf("jsdf\n");
     assert( pvHeapStart != NULL );
     assert( uiHeapSize > XBMEM_HEAP_MIN );
 
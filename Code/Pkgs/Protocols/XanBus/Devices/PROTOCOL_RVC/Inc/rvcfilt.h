@@ -0,0 +1,99 @@
+/*=============================================================================
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+FILE NAME:  rvcfilt.h
+
+PURPOSE:
+    CAN acceptance filters for the PGNs received from rvcpgntbl.c.
+    GENERATED by MakeCanFilters.py, do not edit; rerun it after
+    changing the PGN table:
+        python3 MakeCanFilters.py rvc
+
+    128 PGNs in 70 filters, passing 0 unwanted id patterns
+    (priority and source address aside).
+
+=============================================================================*/
+
+#ifndef RVCFILT_H
+#define RVCFILT_H
+
+#define PGN_NUM_ACCEPT_FILTERS  ( 70 )
+
+static const PGN_tzACCEPT_FILTER PGN_katzACCEPT_FILTERS[ PGN_NUM_ACCEPT_FILTERS ] =
+{
+    //  Id,           Mask,         Flags
+    { 0x00E8FF00UL, 0x01FCFF00UL, 0 },
+    { 0x00ECFF00UL, 0x01FFFF00UL, 0 },
+    { 0x00EE0000UL, 0x01FF0000UL, 0 },
+    { 0x00EFFF00UL, 0x01FFFF00UL, 0 },
+    { 0x00FED800UL, 0x01FFFF00UL, 0 },
+    { 0x00FEEB00UL, 0x01FFFF00UL, 0 },
+    { 0x0124FF00UL, 0x01FFFF00UL, 0 },
+    { 0x0131FF00UL, 0x01FFFF00UL, 0 },
+    { 0x0132FF00UL, 0x01FFFF00UL, 0 },
+    { 0x0138FF00UL, 0x01FFFF00UL, 0 },
+    { 0x013BFF00UL, 0x01BFFF00UL, 0 },
+    { 0x017CFF00UL, 0x01FDFF00UL, 0 },
+    { 0x017FFF00UL, 0x017FFF00UL, 0 },
+    { 0x01F01400UL, 0x01FFFF00UL, 0 },
+    { 0x01F80E00UL, 0x01FFFF00UL, 0 },
+    { 0x01FDCA00UL, 0x01FFFA00UL, 0 },
+    { 0x01FDD000UL, 0x01FDFE00UL, 0 },
+    { 0x01FDDE00UL, 0x01FFDF00UL, 0 },
+    { 0x01FDF100UL, 0x01FFF700UL, 0 },
+    { 0x01FDFA00UL, 0x01FDFE00UL, 0 },
+    { 0x01FDFC00UL, 0x01FFFE00UL, 0 },
+    { 0x01FDFF00UL, 0x01FFFF00UL, 0 },
+    { 0x01FE8000UL, 0x01FFFC00UL, 0 },
+    { 0x01FE8400UL, 0x01FFEE00UL, 0 },
+    { 0x01FE8A00UL, 0x01FFFE00UL, 0 },
+    { 0x01FE9000UL, 0x01FFFD00UL, 0 },
+    { 0x01FE9300UL, 0x01FFF700UL, 0 },
+    { 0x01FE9A00UL, 0x01FFFB00UL, 0 },
+    { 0x01FE9F00UL, 0x01FFDF00UL, 0 },
+    { 0x01FEA300UL, 0x01FFEF00UL, 0 },
+    { 0x01FEA400UL, 0x01FFFE00UL, 0 },
+    { 0x01FEAD00UL, 0x01FFFD00UL, 0 },
+    { 0x01FEAE00UL, 0x01FFEF00UL, 0 },
+    { 0x01FEB000UL, 0x01FFFE00UL, 0 },
+    { 0x01FEB200UL, 0x01FFFF00UL, 0 },
+    { 0x01FEBD00UL, 0x01FFFF00UL, 0 },
+    { 0x01FEC700UL, 0x01FEFF00UL, 0 },
+    { 0x01FEC900UL, 0x01FFFD00UL, 0 },
+    { 0x01FECA00UL, 0x01FFFB00UL, 0 },
+    { 0x01FECC00UL, 0x01FFFE00UL, 0 },
+    { 0x01FEE800UL, 0x01FFFF00UL, 0 },
+    { 0x01FF8600UL, 0x01FFFE00UL, 0 },
+    { 0x01FF8800UL, 0x01FFEE00UL, 0 },
+    { 0x01FF8A00UL, 0x01FFFB00UL, 0 },
+    { 0x01FF8C00UL, 0x01FFBF00UL, 0 },
+    { 0x01FF8F00UL, 0x01FFBF00UL, 0 },
+    { 0x01FF9500UL, 0x01FFFD00UL, 0 },
+    { 0x01FF9600UL, 0x01FFDF00UL, 0 },
+    { 0x01FFB400UL, 0x01FFFE00UL, 0 },
+    { 0x01FFB700UL, 0x01FFF700UL, 0 },
+    { 0x01FFC000UL, 0x01FFF400UL, 0 },
+    { 0x01FFC400UL, 0x01FFEE00UL, 0 },
+    { 0x01FFC600UL, 0x01FFF700UL, 0 },
+    { 0x01FFCD00UL, 0x01FFFF00UL, 0 },
+    { 0x01FFD200UL, 0x01FFFA00UL, 0 },
+    { 0x01FFD800UL, 0x01FFFC00UL, 0 },
+    { 0x01FFDC00UL, 0x01FFDF00UL, 0 },
+    { 0x01FFF800UL, 0x01FFFE00UL, 0 },
+    { 0x01FFFD00UL, 0x01FFFF00UL, 0 },
+    { 0x01FFFE00UL, 0x01FFFF00UL, 0 },
+    { 0x00E80000UL, 0x01FCFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x00EC0000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x00EF0000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x01240000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x01310000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x01320000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x01380000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x013B0000UL, 0x01BFFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x017C0000UL, 0x01FDFF00UL, PGN_FILTER_OWN_ADDR },
+    { 0x017F0000UL, 0x01FFFF00UL, PGN_FILTER_OWN_ADDR },
+};
+
+#endif  // RVCFILT_H
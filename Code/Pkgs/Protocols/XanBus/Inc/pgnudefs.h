@@ -141,6 +141,9 @@
 // Xanbus message count field max value
 #define PGN_XB_MSGCOUNT_MAX     63      // (6-bits)
 
+// Acceptance filter flags (PGN_katzACCEPT_FILTERS in rvcfilt.h)
+#define PGN_FILTER_OWN_ADDR     0x01    // Packet Specific must be our address
+
 /*==============================================================================
                             Type Definitions
 ==============================================================================*/
@@ -293,6 +296,14 @@ typedef struct PGN_zPGN_INFO
     PGN_tzPGN_DESC * XT_FAR pktzDesc;       ///< Descriptor for PGN
 } PGN_tzPGN_INFO;
 
+//! CAN acceptance filter generated from the PGN table by MakeCanFilters.py
+typedef struct PGN_zACCEPT_FILTER
+{
+    uint32 ulId;                            ///< CAN id bits 28 to 0 to match
+    uint32 ulMask;                          ///< CAN id bits that must match
+    uchar8 ucFlags;                         ///< Filter flags
+} PGN_tzACCEPT_FILTER;
+
 //! Structure for referencing PGN tables
 struct PGN_zWORK_BLOCK
 {
@@ -0,0 +1,67 @@
+/******************************************************************************
+
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+****************************************************************************//**
+
+  @addtogroup cancap CANCAP
+  @{
+  @brief  Interface to cancap.c: raw CAN frame capture
+
+****************************************************************************//**
+
+  @page cancap_design Raw CAN Frame Capture (CANCAP)
+
+    This file provides the external interface to cancap.c which records
+    every frame passing through a Linux shim driver to a pcap file with
+    the SocketCAN link type, readable by Wireshark, tcpdump and the
+    offline decoder in tools/capture_decode.cpp.
+
+    Capture is off unless the CANCAP_ENV environment variable names the
+    file to write when the driver is initialized.
+
+*******************************************************************************/
+
+#ifndef CANCAP_H
+#define CANCAP_H
+
+/*==============================================================================
+                              Includes
+==============================================================================*/
+
+#include <time.h>
+#include "LIB_stdtype.h"
+#include "cdrive.h"
+
+/*==============================================================================
+                              Defines
+==============================================================================*/
+
+// Environment variable holding the path of the capture file
+#define CANCAP_ENV              "XB_CAN_CAPTURE"
+
+// pcap file format constants
+#define CANCAP_MAGIC_NSEC       0xa1b23c4dUL    // timestamps in nanoseconds
+#define CANCAP_VERSION_MAJOR    2
+#define CANCAP_VERSION_MINOR    4
+#define CANCAP_LINKTYPE_CAN     227             // LINKTYPE_CAN_SOCKETCAN
+#define CANCAP_FRAME_LEN        16              // SocketCAN frame header + 8 data bytes
+
+/*==============================================================================
+                      External/Public Function Protoypes
+==============================================================================*/
+
+tucBOOL CANCAP_fnOpen( void );
+tucBOOL CANCAP_fnIsOpen( void );
+void CANCAP_fnWrite( const CANDATA *ptzData,
+                     const struct timespec *ptzTime );
+void CANCAP_fnClose( void );
+
+#endif  // ifndef CANCAP_H
+
+//*****************************************************************************
+// End of file.
+//! @}
+//*****************************************************************************
@@ -0,0 +1,74 @@
+/******************************************************************************
+
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+****************************************************************************//**
+
+  @addtogroup simcan SIMCAN
+  @{
+  @brief  Interface to simcan.c: in-process virtual CAN
+
+****************************************************************************//**
+
+  @page simcan_design In-Process Virtual CAN Interface (SIMCAN)
+
+    This file provides the external interface to simcan.c which connects
+    the stack to a harness running in the same process, such as the
+    simulation benchmark in Targets/Linux/Test/Src/xbbench.c.
+
+    The harness attaches a transmit callback before the stack is
+    initialized, then injects the frames of its simulated nodes.  The
+    interface is only chosen when a harness has attached, so linking it
+    into the library does not change which interface other programs use.
+
+*******************************************************************************/
+
+#ifndef SIMCAN_H
+#define SIMCAN_H
+
+/*==============================================================================
+                              Includes
+==============================================================================*/
+
+#include "LIB_stdtype.h"
+#include "cdrive.h"
+
+/*==============================================================================
+                              Defines
+==============================================================================*/
+
+// Frames the receive queue holds, must be a power of two
+#define SIMCAN_RX_QUEUE_LEN     1024
+
+/*==============================================================================
+                            Type Definitions
+==============================================================================*/
+
+// Harness callback for each frame the stack transmits
+typedef void ( *SIMCAN_tpfnTX )( const CANDATA *ptzData );
+
+/*==============================================================================
+                      External/Public Function Protoypes
+==============================================================================*/
+
+void SIMCAN_fnAttach( SIMCAN_tpfnTX pfnTx );
+tucBOOL SIMCAN_fnInject( const CANDATA *ptzData );
+unsigned int SIMCAN_fnPending( void );
+
+tucBOOL SIMCAN_fnInit( void );
+void SIMCAN_fnClose( void );
+TFXCAN_RETURNS SIMCAN_fnStatus( void );
+TFXCAN_RETURNS SIMCAN_fnReceiveFrame( CANPORT u8PortNumber,
+                                      CANFRAME *pFrame );
+TFXCAN_RETURNS SIMCAN_fnSendFrame( CANPORT u8PortNumber,
+                                   CANFRAME *pFrame,
+                                   INT16 *pi16MessageID );
+
+#endif  // ifndef SIMCAN_H
+
+//*****************************************************************************
+// End of file.
+//! @}
+//*****************************************************************************
@@ -16,7 +16,9 @@
 
     This file provides an interface to socketcan, Linux's network-like
     interface to its native CAN drivers.  It will also work for 
-    vcan, a local simulated CAN interface.
+    vcan, a local simulated CAN interface.  The interface is can0 unless
+    the SOCKETCAN_DEVICE_ENV environment variable names another, such as
+    vcan0.
 
 *******************************************************************************/
 
@@ -34,6 +36,9 @@
                               Defines
 ==============================================================================*/
 
+// Environment variable naming the CAN interface to use instead of can0
+#define SOCKETCAN_DEVICE_ENV       "XB_CAN_DEVICE"
+
 // Bitmasks for status flags
 #define SOCKETCAN_STS_RXQ_FULL     0x01
 #define SOCKETCAN_STS_TXQ_FULL     0x02
@@ -48,6 +53,7 @@
 ==============================================================================*/
 
 tucBOOL SOCKETCAN_fnInit( uchar8 ucBitRate );
+void SOCKETCAN_fnSetFilterAddr( uchar8 ucAddr );
 void SOCKETCAN_fnClose( void );
 TFXCAN_RETURNS SOCKETCAN_fnStatus( void );
 TFXCAN_RETURNS SOCKETCAN_fnReceiveFrame( CANPORT u8PortNumber,
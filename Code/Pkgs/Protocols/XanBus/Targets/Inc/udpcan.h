@@ -17,6 +17,11 @@
     This file provides the external interface to udpcan.c which provides
     an interface to a virtual CAN network implemented as UDP broadcasts
 
+    Frames are broadcast on the local subnet unless the UDPCAN_DEST_ENV
+    environment variable gives an address[:port] to send them to, such as
+    127.0.0.1:22595 for a peer on the loopback interface.  Frames are
+    always received on UDP port 22594.
+
 *******************************************************************************/
 
 #ifndef UDPCAN_H
@@ -29,6 +34,13 @@
 #include "LIB_stdtype.h"
 #include "cdrive.h"
 
+/*==============================================================================
+                              Defines
+==============================================================================*/
+
+// Environment variable giving the address[:port] frames are sent to
+#define UDPCAN_DEST_ENV         "XB_UDPCAN_DEST"
+
 /*==============================================================================
                       External/Public Function Protoypes
 ==============================================================================*/
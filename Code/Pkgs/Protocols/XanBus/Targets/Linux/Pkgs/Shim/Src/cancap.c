@@ -0,0 +1,212 @@
+/******************************************************************************
+
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+****************************************************************************//**
+
+  @addtogroup cancap CANCAP
+  @{
+  @brief  Raw CAN frame capture to a pcap file
+
+****************************************************************************//**
+
+  @page cancap_design Raw CAN Frame Capture (CANCAP)
+
+    Frames are written as pcap records of link type LINKTYPE_CAN_SOCKETCAN:
+    a 16 byte record header in host byte order followed by a struct
+    can_frame image whose CAN id is in network byte order, as the link
+    type requires.
+
+    Writes go through a stdio buffer which is flushed every
+    CANCAP_FLUSH_FRAMES frames, so the capture costs a memcpy per frame
+    on the receive path and a write system call now and then.
+
+*******************************************************************************/
+
+/*==============================================================================
+                              Includes
+==============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>         // For getenv
+#include <string.h>
+#include <stdint.h>
+#include <arpa/inet.h>      // For htonl
+#include <linux/can.h>
+#include "cancap.h"         // API for this module
+
+/*==============================================================================
+                              Defines
+==============================================================================*/
+
+// Frames written between flushes of the capture file
+#define CANCAP_FLUSH_FRAMES     64
+
+// Size of the stdio buffer of the capture file
+#define CANCAP_BUFFER_SIZE      ( 64 * 1024 )
+
+/*==============================================================================
+                           Local/Private Variables
+==============================================================================*/
+
+// pcap global header
+typedef struct
+{
+    uint32_t ulMagic;
+    uint16_t uiVersionMajor;
+    uint16_t uiVersionMinor;
+    int32_t  lThisZone;
+    uint32_t ulSigFigs;
+    uint32_t ulSnapLen;
+    uint32_t ulLinkType;
+} tzCANCAP_FILE_HDR;
+
+// pcap record header followed by the SocketCAN frame
+typedef struct
+{
+    uint32_t ulSec;
+    uint32_t ulNsec;
+    uint32_t ulInclLen;
+    uint32_t ulOrigLen;
+    uint32_t ulCanId;       // network byte order
+    uint8_t  ucLen;
+    uint8_t  aucPad[ 3 ];
+    uint8_t  aucData[ 8 ];
+} tzCANCAP_RECORD;
+
+// Capture file, NULL when capture is off
+static FILE *pCapFile;
+
+// Frames written since the last flush
+static unsigned int uiUnflushed;
+
+/*==============================================================================
+                           Function Definitions
+==============================================================================*/
+
+
+//! Open the capture file named by CANCAP_ENV, if set
+tucBOOL CANCAP_fnOpen( void )
+{
+    const char *pcPath;
+    tzCANCAP_FILE_HDR tzHdr;
+
+    if ( pCapFile != NULL )
+    {
+        return TRUE;
+    }
+
+    pcPath = getenv( CANCAP_ENV );
+    if (( pcPath == NULL ) || ( pcPath[ 0 ] == '\0' ))
+    {
+        return FALSE;
+    }
+
+    pCapFile = fopen( pcPath, "wb" );
+    if ( pCapFile == NULL )
+    {
+        perror( "CANCAP_fnOpen" );
+        return FALSE;
+    }
+    setvbuf( pCapFile, NULL, _IOFBF, CANCAP_BUFFER_SIZE );
+
+    tzHdr.ulMagic = CANCAP_MAGIC_NSEC;
+    tzHdr.uiVersionMajor = CANCAP_VERSION_MAJOR;
+    tzHdr.uiVersionMinor = CANCAP_VERSION_MINOR;
+    tzHdr.lThisZone = 0;
+    tzHdr.ulSigFigs = 0;
+    tzHdr.ulSnapLen = CANCAP_FRAME_LEN;
+    tzHdr.ulLinkType = CANCAP_LINKTYPE_CAN;
+    if ( fwrite( &tzHdr, sizeof( tzHdr ), 1, pCapFile ) != 1 )
+    {
+        perror( "CANCAP_fnOpen" );
+        fclose( pCapFile );
+        pCapFile = NULL;
+        return FALSE;
+    }
+    fflush( pCapFile );
+    uiUnflushed = 0;
+
+    fprintf( stderr, "Capturing CAN frames to %s\n", pcPath );
+    return TRUE;
+}
+
+//! Is capture on
+tucBOOL CANCAP_fnIsOpen( void )
+{
+    return ( pCapFile != NULL ) ? TRUE : FALSE;
+}
+
+//! Record a frame; ptzTime is the time the frame was seen, NULL for now
+void CANCAP_fnWrite( const CANDATA *ptzData,
+                     const struct timespec *ptzTime )
+{
+    tzCANCAP_RECORD tzRec;
+    struct timespec tzNow;
+    uint32_t ulId;
+    uint8_t ucLen;
+
+    if (( pCapFile == NULL ) || ( ptzData == NULL ))
+    {
+        return;
+    }
+
+    if ( ptzTime == NULL )
+    {
+        clock_gettime( CLOCK_REALTIME, &tzNow );
+        ptzTime = &tzNow;
+    }
+
+    ulId = (uint32_t)( ptzData->m_u8Priority & 0x07 ) << 26;
+    ulId |= (uint32_t)( ptzData->m_u8DataPage & 0x03 ) << 24;
+    ulId |= (uint32_t)ptzData->m_u8PF << 16;
+    ulId |= (uint32_t)ptzData->m_u8PS << 8;
+    ulId |= ptzData->m_u8SA;
+    ulId |= CAN_EFF_FLAG;
+
+    ucLen = ptzData->m_u8DataByteCount;
+    if ( ucLen > 8 )
+    {
+        ucLen = 8;
+    }
+
+    memset( &tzRec, 0, sizeof( tzRec ));
+    tzRec.ulSec = (uint32_t)ptzTime->tv_sec;
+    tzRec.ulNsec = (uint32_t)ptzTime->tv_nsec;
+    tzRec.ulInclLen = CANCAP_FRAME_LEN;
+    tzRec.ulOrigLen = CANCAP_FRAME_LEN;
+    tzRec.ulCanId = htonl( ulId );
+    tzRec.ucLen = ucLen;
+    memcpy( tzRec.aucData, ptzData->m_u8Data, ucLen );
+
+    if ( fwrite( &tzRec, sizeof( tzRec ), 1, pCapFile ) != 1 )
+    {
+        // Disk full or similar; stop capturing rather than fail every frame
+        perror( "CANCAP_fnWrite" );
+        CANCAP_fnClose();
+        return;
+    }
+
+    if ( ++uiUnflushed >= CANCAP_FLUSH_FRAMES )
+    {
+        fflush( pCapFile );
+        uiUnflushed = 0;
+    }
+}
+
+//! Flush and close the capture file
+void CANCAP_fnClose( void )
+{
+    if ( pCapFile != NULL )
+    {
+        fclose( pCapFile );
+        pCapFile = NULL;
+    }
+}
+
+//*****************************************************************************
+// End of file.
+//! @}
+//*****************************************************************************
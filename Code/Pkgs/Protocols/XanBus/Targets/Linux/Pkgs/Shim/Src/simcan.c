@@ -0,0 +1,153 @@
+/******************************************************************************
+
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+****************************************************************************//**
+
+  @addtogroup simcan SIMCAN
+  @{
+  @brief  In-process virtual CAN
+
+****************************************************************************//**
+
+  @page simcan_design In-Process Virtual CAN Interface (SIMCAN)
+
+    Received frames come from a ring of SIMCAN_RX_QUEUE_LEN frames which
+    the harness fills with SIMCAN_fnInject.  Transmitted frames are handed
+    straight to the harness callback, which may inject replies from
+    within the callback; they are read by the next receive tick.
+
+    There are no locks: the harness and the stack tick run on the same
+    thread.
+
+*******************************************************************************/
+
+/*==============================================================================
+                              Includes
+==============================================================================*/
+
+#include <string.h>
+#include "simcan.h"         // API for this module
+#include "cancap.h"         // Raw frame capture
+
+/*==============================================================================
+                              Defines
+==============================================================================*/
+
+#define SIMCAN_RX_QUEUE_MASK    ( SIMCAN_RX_QUEUE_LEN - 1 )
+
+/*==============================================================================
+                           Local/Private Variables
+==============================================================================*/
+
+// Harness transmit callback, NULL when no harness is attached
+static SIMCAN_tpfnTX pfnHarnessTx;
+
+// Receive ring; the indices run freely and are masked on use
+static CANDATA atzRxQueue[ SIMCAN_RX_QUEUE_LEN ];
+static unsigned int uiRxHead;
+static unsigned int uiRxTail;
+
+/*==============================================================================
+                           Function Definitions
+==============================================================================*/
+
+
+//! Attach the harness; must be called before the stack is initialized
+void SIMCAN_fnAttach( SIMCAN_tpfnTX pfnTx )
+{
+    pfnHarnessTx = pfnTx;
+    uiRxHead = 0;
+    uiRxTail = 0;
+}
+
+//! Queue a frame for the stack, FALSE if the queue is full
+tucBOOL SIMCAN_fnInject( const CANDATA *ptzData )
+{
+    if (( uiRxHead - uiRxTail ) >= SIMCAN_RX_QUEUE_LEN )
+    {
+        return FALSE;
+    }
+
+    atzRxQueue[ uiRxHead & SIMCAN_RX_QUEUE_MASK ] = *ptzData;
+    uiRxHead++;
+    return TRUE;
+}
+
+//! Number of injected frames the stack has not read yet
+unsigned int SIMCAN_fnPending( void )
+{
+    return uiRxHead - uiRxTail;
+}
+
+//! Open the interface if a harness has attached
+tucBOOL SIMCAN_fnInit( void )
+{
+    if ( pfnHarnessTx == NULL )
+    {
+        return FALSE;
+    }
+
+    CANCAP_fnOpen();
+    return TRUE;
+}
+
+TFXCAN_RETURNS SIMCAN_fnSendFrame( CANPORT u8PortNumber,
+                                   CANFRAME *pFrame,
+                                   INT16 *pi16MessageID )
+{
+    (void)u8PortNumber;
+    (void)pi16MessageID;
+
+    if (( pfnHarnessTx == NULL ) || ( pFrame == NULL ))
+    {
+        return TFXCR_MSG_NOT_HANDLED;
+    }
+
+    CANCAP_fnWrite( &pFrame->m_CanData, NULL );
+    pfnHarnessTx( &pFrame->m_CanData );
+    return TFXCR_OK;
+}
+
+TFXCAN_RETURNS SIMCAN_fnReceiveFrame( CANPORT u8PortNumber,
+                                      CANFRAME *pFrame )
+{
+    CANDATA *ptzData;
+
+    (void)u8PortNumber;
+
+    if ( uiRxHead == uiRxTail )
+    {
+        return TFXCR_NO_DATA;
+    }
+
+    ptzData = &atzRxQueue[ uiRxTail & SIMCAN_RX_QUEUE_MASK ];
+    uiRxTail++;
+
+    memcpy( &pFrame->m_CanData, ptzData, sizeof( CANDATA ));
+    CANCAP_fnWrite( ptzData, NULL );
+    return TFXCR_NEW_DATA;
+}
+
+//! Detach the harness and drop anything still queued
+void SIMCAN_fnClose( void )
+{
+    pfnHarnessTx = NULL;
+    uiRxHead = 0;
+    uiRxTail = 0;
+
+    CANCAP_fnClose();
+}
+
+//! Status of the virtual bus
+TFXCAN_RETURNS SIMCAN_fnStatus( void )
+{
+    return ( pfnHarnessTx != NULL ) ? TFXCR_OK : TFXCR_BUS_OFF;
+}
+
+//*****************************************************************************
+// End of file.
+//! @}
+//*****************************************************************************
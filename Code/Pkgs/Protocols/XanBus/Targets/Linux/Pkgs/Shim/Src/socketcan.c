@@ -18,7 +18,8 @@
     socketcan interface provided by standard Linux CAN drivers
 
   @note
-    This file connects to can0 by default
+    This file connects to can0 by default, or to the interface named by
+    the SOCKETCAN_DEVICE_ENV environment variable
 
 *******************************************************************************/
 
@@ -29,7 +30,7 @@
 
 #include <stdio.h>          // For printf
 #include <string.h>
-#include <stdlib.h>         // For strtol
+#include <stdlib.h>         // For strtol, getenv
 #include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -39,6 +40,9 @@
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include "socketcan.h"         // API for this module
+#include "cancap.h"            // Frame capture
+#include "pgnudefs.h"
+#include "rvcfilt.h"           // Acceptance filters for the RV-C PGN table
 
 /*==============================================================================
                               Defines
@@ -64,6 +68,12 @@ static int CanSock;
 // Latest received bus status
 static TFXCAN_RETURNS teBusStatus;
 
+// Address the acceptance filters were last loaded, or tried, for
+static uchar8 ucFilterAddr;
+
+// Has loading the acceptance filters been tried
+static tucBOOL tucFilterTried;
+
 /*==============================================================================
                         Local/Private Function Protoypes
 ==============================================================================*/
@@ -79,10 +89,12 @@ tucBOOL SOCKETCAN_fnInit( uchar8 ucBitRate )
     struct sockaddr_can addr;
     struct ifreq ifr;
     struct can_filter filter;
+    const char *pcDevice;
     int result;
     
     // Bus status is OK until proven otherwise
     teBusStatus = TFXCR_OK;
+    tucFilterTried = FALSE;
 
     // Open the socket for the CAN interface
     CanSock = socket( PF_CAN, SOCK_RAW, CAN_RAW );
@@ -105,8 +117,19 @@ tucBOOL SOCKETCAN_fnInit( uchar8 ucBitRate )
     fcntl(CanSock, F_SETFL, O_NONBLOCK);
 
     // Connect to the named CAN interface
-    strcpy( ifr.ifr_name, CAN_DEVICE );
-    ioctl( CanSock, SIOCGIFINDEX, &ifr);
+    pcDevice = getenv( SOCKETCAN_DEVICE_ENV );
+    if (( pcDevice == NULL ) || ( pcDevice[ 0 ] == '\0' ))
+    {
+        pcDevice = CAN_DEVICE;
+    }
+    memset( &ifr, 0, sizeof( ifr ));
+    strncpy( ifr.ifr_name, pcDevice, IFNAMSIZ - 1 );
+    if ( ioctl( CanSock, SIOCGIFINDEX, &ifr ) < 0 )
+    {
+        // Index 0 would bind to every CAN interface, but send on none
+        perror( pcDevice );
+        return FALSE;
+    }
 
     memset( &addr, 0, sizeof(addr) );
     addr.can_family = AF_CAN;
@@ -118,14 +141,73 @@ tucBOOL SOCKETCAN_fnInit( uchar8 ucBitRate )
         return FALSE;
     }
 
+    // Capture frames if asked to, stamped by the kernel on reception
+    if ( CANCAP_fnOpen() != FALSE )
+    {
+        result = 1;
+        if ( setsockopt( CanSock, SOL_SOCKET, SO_TIMESTAMPNS, &result, sizeof( result )) != 0 )
+        {
+            perror( "SOCKETCAN_fnInit - SO_TIMESTAMPNS" );
+        }
+    }
+    else
+    {
+        // Let the kernel drop frames the stack would, until an address
+        // is claimed only frames to the null address are ours
+        SOCKETCAN_fnSetFilterAddr( PGN_ADDR_NULL );
+    }
+
     // Success!
     return TRUE;
 }
 
+//! Load the acceptance filters for frames to ucAddr
+/*!
+    The filters from rvcfilt.h pass what PGNRTick would accept, so the
+    kernel drops the rest before they cost a system call.  Called every
+    tick with our current address; the filters are only reloaded when it
+    changes, so a failure is reported once per address rather than every
+    tick.  Not used while capturing, as a capture wants every frame.
+*/
+void SOCKETCAN_fnSetFilterAddr( uchar8 ucAddr )
+{
+    struct can_filter atzFilter[ PGN_NUM_ACCEPT_FILTERS ];
+    const PGN_tzACCEPT_FILTER *ptzAccept;
+    int i;
+
+    if ((( tucFilterTried != FALSE ) && ( ucAddr == ucFilterAddr ))
+        || ( CANCAP_fnIsOpen() != FALSE ))
+    {
+        return;
+    }
+
+    for ( i = 0; i < PGN_NUM_ACCEPT_FILTERS; i++ )
+    {
+        ptzAccept = &PGN_katzACCEPT_FILTERS[ i ];
+        atzFilter[ i ].can_id = ptzAccept->ulId | CAN_EFF_FLAG;
+        if ( ptzAccept->ucFlags & PGN_FILTER_OWN_ADDR )
+        {
+            atzFilter[ i ].can_id |= (canid_t)ucAddr << 8;
+        }
+        atzFilter[ i ].can_mask = ptzAccept->ulMask | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    }
+
+    ucFilterAddr = ucAddr;
+    tucFilterTried = TRUE;
+
+    if ( setsockopt( CanSock, SOL_CAN_RAW, CAN_RAW_FILTER,
+                     atzFilter, sizeof( atzFilter )) != 0 )
+    {
+        // Keep the extended frame filter set up by SOCKETCAN_fnInit
+        perror( "SOCKETCAN_fnSetFilterAddr - setsockopt" );
+    }
+}
+
 //! Close the CANUSB module
 void SOCKETCAN_fnClose( void )
 {
     close( CanSock );
+    CANCAP_fnClose();
 }
 
 //! Return the status of the CANUSB module
@@ -140,10 +222,29 @@ TFXCAN_RETURNS SOCKETCAN_fnReceiveFrame( CANPORT u8PortNumber,
 {
     ssize_t BytesRead;
     struct can_frame SockFrame;
+    struct iovec tzIov;
+    struct msghdr tzMsg;
+    struct cmsghdr *ptzCmsg;
+    // Control buffer, aligned for struct cmsghdr as in cmsg(3)
+    union
+    {
+        char acBuf[ CMSG_SPACE( sizeof( struct timespec )) ];
+        struct cmsghdr tzAlign;
+    } tzCtrl;
+    struct timespec *ptzStamp = NULL;
     int i;
     TFXCAN_RETURNS RetVal = TFXCR_NO_DATA;
 
-    BytesRead = read( CanSock, &SockFrame, sizeof( SockFrame ) );
+    // recvmsg rather than read to get the reception time when capturing
+    tzIov.iov_base = &SockFrame;
+    tzIov.iov_len = sizeof( SockFrame );
+    memset( &tzMsg, 0, sizeof( tzMsg ));
+    tzMsg.msg_iov = &tzIov;
+    tzMsg.msg_iovlen = 1;
+    tzMsg.msg_control = tzCtrl.acBuf;
+    tzMsg.msg_controllen = sizeof( tzCtrl.acBuf );
+
+    BytesRead = recvmsg( CanSock, &tzMsg, 0 );
     if ( BytesRead < 0 )
     {
         // Read from socket failed - expected reason would be nothing received
@@ -175,6 +276,21 @@ TFXCAN_RETURNS SOCKETCAN_fnReceiveFrame( CANPORT u8PortNumber,
             }
             
             RetVal = TFXCR_NEW_DATA;
+
+            if ( CANCAP_fnIsOpen() != FALSE )
+            {
+                for ( ptzCmsg = CMSG_FIRSTHDR( &tzMsg );
+                      ptzCmsg != NULL;
+                      ptzCmsg = CMSG_NXTHDR( &tzMsg, ptzCmsg ))
+                {
+                    if (( ptzCmsg->cmsg_level == SOL_SOCKET )
+                        && ( ptzCmsg->cmsg_type == SCM_TIMESTAMPNS ))
+                    {
+                        ptzStamp = (struct timespec *)CMSG_DATA( ptzCmsg );
+                    }
+                }
+                CANCAP_fnWrite( &pFrame->m_CanData, ptzStamp );
+            }
         }
     }
     else
@@ -259,6 +375,9 @@ TFXCAN_RETURNS SOCKETCAN_fnSendFrame( CANPORT u8PortNumber,
 	fprintf( stderr, "CAN transmit working again\n" );
 	ucIsXmitWorking = TRUE;
     }
+
+    // Sent frames are not looped back to this socket, so record them here
+    CANCAP_fnWrite( &pFrame->m_CanData, NULL );
     return TFXCR_OK;
 }
 
@@ -29,6 +29,7 @@
 
 #include <stdio.h>          // For printf
 #include <string.h>
+#include <stdlib.h>         // For getenv, strtol
 #include <unistd.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
@@ -37,6 +38,7 @@
 #include "pgnudefs.h"
 #include "udpcan.h"
 #include "candrv.h"
+#include "cancap.h"
 
 /*==============================================================================
                               Defines
@@ -63,11 +65,63 @@ static uint8_t ucMySrcAddr = PGN_ADDR_NULL;
                         Local/Private Function Protoypes
 ==============================================================================*/
 
+static tucBOOL fnSetSendAddr( struct sockaddr_in *ptzAddr );
+
 
 /*==============================================================================
                            Function Definitions
 ==============================================================================*/
 
+//! Fill in the send address from UDPCAN_DEST_ENV, or the subnet broadcast
+static tucBOOL fnSetSendAddr( struct sockaddr_in *ptzAddr )
+{
+    char acHost[ 64 ];
+    const char *pcDest;
+    const char *pcPort;
+    char *pcEnd;
+    long lPort;
+    size_t uiLen;
+
+    ptzAddr->sin_family = AF_INET;
+    ptzAddr->sin_port = htons( CAN_UDP_PORT );
+    ptzAddr->sin_addr.s_addr = inet_addr( CAN_UDP_BCST_ADDR );
+
+    pcDest = getenv( UDPCAN_DEST_ENV );
+    if (( pcDest == NULL ) || ( pcDest[ 0 ] == '\0' ))
+    {
+        return TRUE;
+    }
+
+    pcPort = strchr( pcDest, ':' );
+    uiLen = ( pcPort != NULL ) ? ( size_t )( pcPort - pcDest ) : strlen( pcDest );
+    if ( uiLen >= sizeof( acHost ))
+    {
+        printf( "%s: address too long\n", UDPCAN_DEST_ENV );
+        return FALSE;
+    }
+    memcpy( acHost, pcDest, uiLen );
+    acHost[ uiLen ] = '\0';
+
+    if ( inet_aton( acHost, &ptzAddr->sin_addr ) == 0 )
+    {
+        printf( "%s: bad address %s\n", UDPCAN_DEST_ENV, acHost );
+        return FALSE;
+    }
+
+    if ( pcPort != NULL )
+    {
+        lPort = strtol( pcPort + 1, &pcEnd, 10 );
+        if (( *pcEnd != '\0' ) || ( lPort <= 0 ) || ( lPort > 0xFFFF ))
+        {
+            printf( "%s: bad port %s\n", UDPCAN_DEST_ENV, pcPort + 1 );
+            return FALSE;
+        }
+        ptzAddr->sin_port = htons(( uint16_t )lPort );
+    }
+
+    return TRUE;
+}
+
 
 tucBOOL UDPCAN_fnInit( void )
 {
@@ -154,10 +208,17 @@ tucBOOL UDPCAN_fnInit( void )
             return FALSE;
         }
         
-        gSend_addr.sin_family = AF_INET;
-        gSend_addr.sin_port = htons( CAN_UDP_PORT);
-        gSend_addr.sin_addr.s_addr = inet_addr( CAN_UDP_BCST_ADDR );
+        if ( fnSetSendAddr( &gSend_addr ) == FALSE )
+        {
+            shutdown( gCanSocket, SHUT_WR );
+            shutdown( gCanListenSocket, SHUT_RD );
+            return FALSE;
+        }
         
+        // Capture frames if asked to; UDP has no kernel CAN timestamps,
+        // so frames are stamped with the clock when handled
+        CANCAP_fnOpen();
+
         // Indicate successful initialization
         printf("udpcan init success\n");
         return TRUE;
@@ -234,6 +295,7 @@ TFXCAN_RETURNS UDPCAN_fnSendFrame( CANPORT u8PortNumber,
         }
         
         // CAN frame sent successfully
+        CANCAP_fnWrite( &pFrame->m_CanData, NULL );
         return TFXCR_OK;
     }
     
@@ -265,6 +327,7 @@ TFXCAN_RETURNS UDPCAN_fnReceiveFrame( CANPORT u8PortNumber,
             if ( pCanData->m_u8SA != ucMySrcAddr )
             {
                 memcpy(pFrame, FrameBuf, sizeof(CANDATA));
+                CANCAP_fnWrite( pCanData, NULL );
                 return TFXCR_NEW_DATA;
             }
         }
@@ -290,6 +353,8 @@ void UDPCAN_fnClose( void )
     }
 
     ucMySrcAddr = PGN_ADDR_NULL;
+
+    CANCAP_fnClose();
 }
 
 // Status of CAN connection
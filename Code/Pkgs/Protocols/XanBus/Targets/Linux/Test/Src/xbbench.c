@@ -0,0 +1,809 @@
+/*=============================================================================
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+FILE NAME:  xbbench.c
+
+PURPOSE:
+    Host simulation and throughput benchmark of the XanBus stack. The stack
+    runs on the in-process virtual CAN interface (SIMCAN) against a number
+    of simulated RV-C nodes which claim addresses, broadcast status, send
+    Product Identification to the stack by BAM and by RTS/CTS, request its
+    address claim and receive the Product Identification it broadcasts. Ticks
+    run back to back, so the simulated bus time passes as fast as the
+    stack can process it.
+
+    Reported are frames per second in each direction, latency percentiles,
+    the heap high-water mark and the number of data objects (DOBs) in use.
+
+FUNCTION(S):
+    main                    - Run the benchmark
+
+    local:
+        xbbench_fnPeerTick      - Traffic of the simulated nodes for a tick
+        xbbench_fnStackTx       - SIMCAN callback for frames from the stack
+        xbbench_fnRecvSts       - Stack handler for DC Source Status 1
+        xbbench_fnRecvProdIdent - Stack handler for Product Identification
+        xbbench_fnInject        - Queue a frame from a simulated node
+        xbbench_fnConnMan       - Queue an RTS or BAM from a node
+        xbbench_fnXfer          - Queue data packets from a node
+        xbbench_fnCountDobs     - Count the DOBs in use
+        xbbench_fnSample        - Record a latency sample
+        xbbench_fnReport        - Print percentiles of a sample set
+        xbbench_fnNs            - Monotonic clock in nanoseconds
+
+NOTES:
+    Build from Code/Pkgs/Protocols/XanBus against a Linux librvc that
+    includes Targets/Linux/Pkgs/Shim/Src/simcan.c, using the defines and
+    include paths of CXXFLAGS in big.sh without the ARM options:
+      gcc -O2 <defines and -I paths> Targets/Linux/Test/Src/xbbench.c \
+          -L<librvc dir> -lrvc -o xbbench
+    and run as
+      xbbench [-n nodes] [-t seconds] [-s status ticks] [-m multipacket ticks]
+    Periods are in stack ticks of 10 ms. Latencies are wall clock time
+    with the ticks run back to back, so waits the protocol counts in
+    ticks, such as the 50 ms between BAM packets, add only the time of
+    the ticks in between. Setting XB_CAN_CAPTURE records the simulated
+    bus to a pcap file as the other Linux shims do.
+
+=============================================================================*/
+
+/*==============================================================================
+                              Includes
+==============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>     // For getopt
+
+#include "rvcudefs.h"   // RV-C PGNs
+#include "xbudefs.h"
+#include "xbgdefs.h"    // The XanBus API
+#include "xbwincb.h"    // Platform callback installation
+#include "pgn.h"        // DOB list
+#include "simcan.h"     // In-process virtual CAN
+
+/*==============================================================================
+                           Local/Private Constants
+==============================================================================*/
+
+#define XBBENCH_TICKS_PER_SEC   ( 100 )     // Stack ticks per simulated second
+#define XBBENCH_HEAP_SIZE       ( 32768 )   // XanBus heap, as rvccc uses
+#define XBBENCH_MAX_NODES       ( 64 )      // Nodes the stack tracks
+#define XBBENCH_CAN_BAUD_250K   ( 2 )       // CANDRV bit rate code
+#define XBBENCH_MY_ADDR         ( 0x80 )    // Preferred address of the stack
+#define XBBENCH_PEER_ADDR       ( 0x40 )    // Address of the first node
+#define XBBENCH_MAX_PEERS       ( 64 )
+#define XBBENCH_STS_FIFO        ( 16 )      // Status frames in flight per node
+#define XBBENCH_IDENT_LEN       ( 40 )      // Product Identification length
+#define XBBENCH_IDENT_PACKETS   ( ( XBBENCH_IDENT_LEN + 6 ) / 7 )
+#define XBBENCH_WARMUP_TICKS    ( 100 )     // Limit on reaching on line
+#define XBBENCH_CLAIM_TIMEOUT   ( 500 )     // Node time out, centiseconds
+#define XBBENCH_MAX_SAMPLES     ( 1 << 20 ) // Per sample set
+
+// ISO transport protocol control bytes
+#define XBBENCH_TP_RTS          ( 16 )
+#define XBBENCH_TP_CTS          ( 17 )
+#define XBBENCH_TP_BAM          ( 32 )
+#define XBBENCH_TP_ABORT        ( 255 )
+
+// PDU formats of the frames the simulation handles
+#define XBBENCH_PF_ISO_REQ      ( 0xEA )
+#define XBBENCH_PF_TP_XFER      ( 0xEB )
+#define XBBENCH_PF_TP_CONN      ( 0xEC )
+#define XBBENCH_PF_ADDR_CLAIM   ( 0xEE )
+
+/*==============================================================================
+                            Type Definitions
+==============================================================================*/
+
+// Latency samples in nanoseconds
+typedef struct
+{
+    const char *pcName;
+    double *pdSamples;
+    unsigned long ulCount;
+} tzSAMPLES;
+
+// A simulated node
+typedef struct
+{
+    uchar8 ucAddr;
+    uchar8 aucName[ PGN_NAME_LEN ];
+
+    // Injection times of status broadcasts the stack has not handled
+    double adStsSent[ XBBENCH_STS_FIFO ];
+    unsigned int uiStsHead;
+    unsigned int uiStsTail;
+
+    // Product Identification to the stack, zero times when idle
+    double dIdentSent;      // last packet injected
+    double dRtsSent;        // RTS injected, waiting for CTS
+} tzPEER;
+
+/*==============================================================================
+                           Local/Private Variables
+==============================================================================*/
+
+static tzPEER atzPeers[ XBBENCH_MAX_PEERS ];
+static unsigned int uiNumPeers = 8;
+
+// Injection times of the frames in the SIMCAN queue, oldest first
+static double adInjected[ SIMCAN_RX_QUEUE_LEN ];
+static unsigned int uiInjHead;
+static unsigned int uiInjTail;
+
+// Frame counts
+static unsigned long ulFramesIn;
+static unsigned long ulFramesOut;
+static unsigned long ulInjectFull;
+static unsigned long ulAborts;
+static unsigned long ulStsHandled;
+static unsigned long ulIdentHandled;
+static unsigned long ulIdentSent;
+
+// BAM started by the application, zero time when idle
+static double dStackSendStart;
+static uchar8 ucStackBamPackets;
+
+// Request for address claim outstanding, zero when none
+static double dReqSent;
+
+// Product Identification payload, in both directions
+static uchar8 aucIdent[ XBBENCH_IDENT_LEN ];
+static RVC_tzPGN_EXTRA_PROD_IDENT atzIdentExtra[ XBBENCH_IDENT_LEN ];
+
+static tzSAMPLES tzFrameLat = { "frame in->consumed" };
+static tzSAMPLES tzStsLat = { "status in->handler" };
+static tzSAMPLES tzIdentLat = { "ident last pkt->handler" };
+static tzSAMPLES tzCtsLat = { "RTS in->CTS out" };
+static tzSAMPLES tzReqLat = { "request in->claim out" };
+static tzSAMPLES tzSendLat = { "send call->last BAM pkt" };
+static tzSAMPLES tzTickLat = { "tick" };
+
+// Latency is only sampled once the stack is on line
+static tucBOOL tucMeasuring;
+
+/*==============================================================================
+                           Platform callbacks
+==============================================================================*/
+
+static void xbbench_fnCheckErrors( schar8 *pscTag )
+{
+}
+
+static void xbbench_fnSetNetIndic( XB_teNETWORK_STATE teBusState,
+                                   tucBOOL tucOn )
+{
+}
+
+static tuiSTATUS xbbench_fnLoad( XB_tePARAM_TYPE teType,
+                                 XB_teCFG_TYPE teCfgType,
+                                 void *pData,
+                                 uint16 uiSize )
+{
+    XB_tzPGN_ISO_ADDR_CLAIM tzName;
+    XB_tzSEND_TIMERS *ptzTx;
+    XB_tzRECV_TIMERS *ptzRx;
+    unsigned int i;
+
+    switch( teType )
+    {
+    case XB_ePARAM_TYPE_ADDRESS:
+        if( uiSize == 1 )
+        {
+            *(uchar8 *)pData = XBBENCH_MY_ADDR;
+            return( eSTATUS_OK );
+        }
+        break;
+
+    case XB_ePARAM_TYPE_NAME:
+        if( uiSize == PGN_NAME_LEN )
+        {
+            memset( &tzName, 0, sizeof( tzName ) );
+            tzName.ulUniqueNumber = 0x1FFFFF;
+            tzName.teDeviceFunction = XB_eFUNC_CODE_DIAGNOSTIC_TERMINAL;
+            tzName.ucSelfCfgAddr = 1;
+            XBADDR_fnNAME2ShortNAME( &tzName, (uchar8 *)pData );
+            return( eSTATUS_OK );
+        }
+        break;
+
+    // No periodic transmits of its own
+    case XB_ePARAM_TYPE_TX_TIMEOUTS:
+        if( uiSize == sizeof( XB_tzSEND_TIMERS ) )
+        {
+            ptzTx = (XB_tzSEND_TIMERS *)pData;
+            memset( ptzTx, 0, sizeof( *ptzTx ) );
+            for( i = 0; i < XT_mDIM( ptzTx->atzTimers ); i++ )
+            {
+                ptzTx->atzTimers[ i ].ulParmGrpNum = 0xFFFFFFFF;
+                ptzTx->atzTimers[ i ].ucXmitAddr = 0xFF;
+                ptzTx->atzTimers[ i ].uiXmitPeriod = 0xFFFF;
+            }
+            return( eSTATUS_OK );
+        }
+        break;
+
+    case XB_ePARAM_TYPE_RX_TIMEOUTS:
+        if( uiSize == sizeof( XB_tzRECV_TIMERS ) )
+        {
+            ptzRx = (XB_tzRECV_TIMERS *)pData;
+            memset( ptzRx, 0, sizeof( *ptzRx ) );
+            for( i = 0; i < XT_mDIM( ptzRx->atzTimers ); i++ )
+            {
+                ptzRx->atzTimers[ i ].ulParmGrpNum = 0xFFFFFFFF;
+                ptzRx->atzTimers[ i ].uiTimeout = 0xFFFF;
+            }
+
+            // Nodes time out unless they keep sending the claim PGN
+            ptzRx->atzTimers[ 0 ].ulParmGrpNum = DEVICE_CLAIM_PGN;
+            ptzRx->atzTimers[ 0 ].uiTimeout = XBBENCH_CLAIM_TIMEOUT;
+            return( eSTATUS_OK );
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return( eSTATUS_ERR );
+}
+
+static tuiSTATUS xbbench_fnSave( XB_tePARAM_TYPE teType,
+                                 XB_teCFG_TYPE teCfgType,
+                                 void *pData,
+                                 uint16 uiSize )
+{
+    return( eSTATUS_OK );
+}
+
+static void xbbench_fnNodeChange( XB_teNODE_CHANGE teChange,
+                                  uchar8 ucOldAddr,
+                                  uchar8 ucNewAddr,
+                                  XB_tzPGN_ISO_ADDR_CLAIM *ptzNAME )
+{
+}
+
+static void xbbench_fnRecvXbMsg( PGN_tzRECV_DATA *ptzRecv )
+{
+}
+
+/*==============================================================================
+                           Function Definitions
+==============================================================================*/
+
+// Monotonic clock in nanoseconds
+static double xbbench_fnNs( void )
+{
+    struct timespec tzNow;
+
+    clock_gettime( CLOCK_MONOTONIC, &tzNow );
+    return( (double)tzNow.tv_sec * 1e9 + (double)tzNow.tv_nsec );
+}
+
+// Record a latency sample
+static void xbbench_fnSample( tzSAMPLES *ptzSet, double dStart, double dEnd )
+{
+    if( !tucMeasuring || ( ptzSet->ulCount >= XBBENCH_MAX_SAMPLES ) )
+    {
+        return;
+    }
+    if( ptzSet->pdSamples == NULL )
+    {
+        ptzSet->pdSamples = malloc( XBBENCH_MAX_SAMPLES * sizeof( double ) );
+        if( ptzSet->pdSamples == NULL )
+        {
+            return;
+        }
+    }
+    ptzSet->pdSamples[ ptzSet->ulCount++ ] = dEnd - dStart;
+}
+
+static int xbbench_fnCompare( const void *pvA, const void *pvB )
+{
+    double dA = *(const double *)pvA;
+    double dB = *(const double *)pvB;
+
+    return( ( dA > dB ) - ( dA < dB ) );
+}
+
+// Print percentiles of a sample set in microseconds
+static void xbbench_fnReport( tzSAMPLES *ptzSet )
+{
+    double *pd = ptzSet->pdSamples;
+    unsigned long n = ptzSet->ulCount;
+
+    if( n == 0 )
+    {
+        printf( "  %-26s       no samples\n", ptzSet->pcName );
+        return;
+    }
+    qsort( pd, n, sizeof( double ), xbbench_fnCompare );
+    printf( "  %-26s %8lu %9.1f %9.1f %9.1f %9.1f\n",
+            ptzSet->pcName,
+            n,
+            pd[ n / 2 ] / 1e3,
+            pd[ ( n * 90 ) / 100 ] / 1e3,
+            pd[ ( n * 99 ) / 100 ] / 1e3,
+            pd[ n - 1 ] / 1e3 );
+}
+
+// Queue a frame from a simulated node, FALSE if the queue is full
+static tucBOOL xbbench_fnInject( uchar8 ucPri,
+                                 uint32 ulPgn,
+                                 uchar8 ucDest,
+                                 uchar8 ucSrc,
+                                 const uchar8 *pucData,
+                                 uchar8 ucLen )
+{
+    CANDATA tzFrame;
+
+    memset( &tzFrame, 0, sizeof( tzFrame ) );
+    tzFrame.m_u8Priority = ucPri;
+    tzFrame.m_u8DataPage = (UINT8)( ( ulPgn >> 16 ) & 0x01 );
+    tzFrame.m_u8PF = (UINT8)( ulPgn >> 8 );
+    tzFrame.m_u8PS = ( tzFrame.m_u8PF < 0xF0 ) ? ucDest : (UINT8)ulPgn;
+    tzFrame.m_u8SA = ucSrc;
+    tzFrame.m_u8DataByteCount = ucLen;
+    memcpy( tzFrame.m_u8Data, pucData, ucLen );
+
+    if( !SIMCAN_fnInject( &tzFrame ) )
+    {
+        ulInjectFull++;
+        return( FALSE );
+    }
+    adInjected[ uiInjHead++ & ( SIMCAN_RX_QUEUE_LEN - 1 ) ] = xbbench_fnNs();
+    return( TRUE );
+}
+
+// RTS or BAM for the Product Identification
+static void xbbench_fnConnMan( tzPEER *ptzPeer,
+                               uchar8 ucDest,
+                               uchar8 ucCtrl )
+{
+    uchar8 aucData[ 8 ];
+
+    aucData[ 0 ] = ucCtrl;
+    aucData[ 1 ] = (uchar8)XBBENCH_IDENT_LEN;
+    aucData[ 2 ] = (uchar8)( XBBENCH_IDENT_LEN >> 8 );
+    aucData[ 3 ] = XBBENCH_IDENT_PACKETS;
+    aucData[ 4 ] = 0xFF;        // no limit on packets per CTS, or reserved
+    aucData[ 5 ] = (uchar8)RVC_PGN_PROD_IDENT;
+    aucData[ 6 ] = (uchar8)( RVC_PGN_PROD_IDENT >> 8 );
+    aucData[ 7 ] = (uchar8)( RVC_PGN_PROD_IDENT >> 16 );
+    xbbench_fnInject( 7, RVC_PGN_ISO_TP_CONN_MAN, ucDest, ptzPeer->ucAddr, aucData, 8 );
+}
+
+// TP.DT frames of the Product Identification, from sequence number ucFirst
+static void xbbench_fnXfer( tzPEER *ptzPeer,
+                            uchar8 ucDest,
+                            uchar8 ucFirst,
+                            uchar8 ucCount )
+{
+    uchar8 aucData[ 8 ];
+    uchar8 ucSeq;
+    unsigned int uiOffset;
+    unsigned int i;
+
+    for( ucSeq = ucFirst; ucSeq < ucFirst + ucCount; ucSeq++ )
+    {
+        aucData[ 0 ] = ucSeq;
+        uiOffset = ( ucSeq - 1 ) * 7u;
+        for( i = 0; i < 7; i++ )
+        {
+            aucData[ i + 1 ] = ( uiOffset + i < XBBENCH_IDENT_LEN ) ? aucIdent[ uiOffset + i ] : 0xFF;
+        }
+        xbbench_fnInject( 7, RVC_PGN_ISO_TP_XFER, ucDest, ptzPeer->ucAddr, aucData, 8 );
+    }
+    ptzPeer->dIdentSent = adInjected[ ( uiInjHead - 1 ) & ( SIMCAN_RX_QUEUE_LEN - 1 ) ];
+}
+
+static tzPEER *xbbench_fnFindPeer( uchar8 ucAddr )
+{
+    if( ( ucAddr < XBBENCH_PEER_ADDR ) || ( ucAddr >= XBBENCH_PEER_ADDR + uiNumPeers ) )
+    {
+        return( NULL );
+    }
+    return( &atzPeers[ ucAddr - XBBENCH_PEER_ADDR ] );
+}
+
+// SIMCAN callback for each frame the stack transmits
+static void xbbench_fnStackTx( const CANDATA *ptzData )
+{
+    const UINT8 *pucData = ptzData->m_u8Data;
+    uint32 ulPgn;
+    tzPEER *ptzPeer;
+    double dNow;
+    unsigned int i;
+
+    ulFramesOut++;
+    dNow = xbbench_fnNs();
+    ptzPeer = xbbench_fnFindPeer( ptzData->m_u8PS );
+
+    switch( ptzData->m_u8PF )
+    {
+    case XBBENCH_PF_ADDR_CLAIM:
+        if( dReqSent != 0 )
+        {
+            xbbench_fnSample( &tzReqLat, dReqSent, dNow );
+            dReqSent = 0;
+        }
+        break;
+
+    case XBBENCH_PF_ISO_REQ:
+        ulPgn = pucData[ 0 ] | ( (uint32)pucData[ 1 ] << 8 ) | ( (uint32)pucData[ 2 ] << 16 );
+        if( ulPgn != RVC_PGN_ISO_ADDR_CLAIM )
+        {
+            break;
+        }
+        // Every node, or the one asked, claims its address again
+        for( i = 0; i < uiNumPeers; i++ )
+        {
+            if( ( ptzData->m_u8PS == PGN_ADDR_GLOBAL ) || ( &atzPeers[ i ] == ptzPeer ) )
+            {
+                xbbench_fnInject( 6, RVC_PGN_ISO_ADDR_CLAIM, PGN_ADDR_GLOBAL,
+                                  atzPeers[ i ].ucAddr, atzPeers[ i ].aucName, PGN_NAME_LEN );
+            }
+        }
+        break;
+
+    case XBBENCH_PF_TP_CONN:
+        if( pucData[ 0 ] == XBBENCH_TP_BAM )
+        {
+            ucStackBamPackets = pucData[ 3 ];
+        }
+        else if( ( ptzPeer != NULL ) && ( pucData[ 0 ] == XBBENCH_TP_CTS ) )
+        {
+            if( ptzPeer->dRtsSent != 0 )
+            {
+                xbbench_fnSample( &tzCtsLat, ptzPeer->dRtsSent, dNow );
+                ptzPeer->dRtsSent = 0;
+            }
+            if( pucData[ 1 ] != 0 )
+            {
+                xbbench_fnXfer( ptzPeer, ptzData->m_u8SA, pucData[ 2 ], pucData[ 1 ] );
+            }
+        }
+        else if( ( ptzPeer != NULL ) && ( pucData[ 0 ] == XBBENCH_TP_ABORT ) )
+        {
+            ulAborts++;
+            ptzPeer->dRtsSent = 0;
+            ptzPeer->dIdentSent = 0;
+        }
+        break;
+
+    case XBBENCH_PF_TP_XFER:
+        if( ( pucData[ 0 ] == ucStackBamPackets ) && ( dStackSendStart != 0 ) )
+        {
+            xbbench_fnSample( &tzSendLat, dStackSendStart, dNow );
+            dStackSendStart = 0;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+// Stack handler for DC Source Status 1
+static void xbbench_fnRecvSts( PGN_tzRECV_DATA *ptzRecv )
+{
+    tzPEER *ptzPeer = xbbench_fnFindPeer( ptzRecv->ucSrcAddr );
+
+    ulStsHandled++;
+    if( ( ptzPeer != NULL ) && ( ptzPeer->uiStsTail != ptzPeer->uiStsHead ) )
+    {
+        xbbench_fnSample( &tzStsLat,
+                          ptzPeer->adStsSent[ ptzPeer->uiStsTail++ % XBBENCH_STS_FIFO ],
+                          xbbench_fnNs() );
+    }
+}
+
+// Stack handler for Product Identification
+static void xbbench_fnRecvProdIdent( PGN_tzRECV_DATA *ptzRecv )
+{
+    tzPEER *ptzPeer = xbbench_fnFindPeer( ptzRecv->ucSrcAddr );
+
+    ulIdentHandled++;
+    if( ( ptzPeer != NULL ) && ( ptzPeer->dIdentSent != 0 ) )
+    {
+        xbbench_fnSample( &tzIdentLat, ptzPeer->dIdentSent, xbbench_fnNs() );
+        ptzPeer->dIdentSent = 0;
+    }
+}
+
+// Install a stack receive handler and enable the PGN, as fnListen does
+static void xbbench_fnListen( uint32 ulPgn,
+                              void ( *pfnRecv )( PGN_tzRECV_DATA *ptzRecv ) )
+{
+    const PGN_tzPGN_INFO *ptzInfo;
+
+    ptzInfo = XBPACK_fnGetPgnInfo( ulPgn, ( sint16 )XB_eGRP_FUNC_VALUE_DO_NOT_CARE );
+    if( ( ptzInfo != NULL ) && ( ptzInfo->pktzDesc != NULL ) )
+    {
+        ( (PGN_tzPGN_DESC *)ptzInfo->pktzDesc )->pfnRecv = pfnRecv;
+    }
+    XBMSG_fnControlDynamic( ulPgn, TRUE );
+}
+
+// Traffic of the simulated nodes and the bench application for a tick
+static void xbbench_fnPeerTick( unsigned long ulTick,
+                                unsigned long ulStsPeriod,
+                                unsigned long ulMpPeriod )
+{
+    uchar8 aucData[ 8 ];
+    uchar8 ucMyAddr = XBADDR_fnGetMyAddr();
+    RVC_tzPGN_PROD_IDENT tzIdent;
+    tzPEER *ptzPeer;
+    unsigned long ulPhase;
+    unsigned int i;
+
+    for( i = 0; i < uiNumPeers; i++ )
+    {
+        ptzPeer = &atzPeers[ i ];
+
+        // Diagnostic message once a second keeps the node on line
+        if( ( ulTick + i ) % XBBENCH_TICKS_PER_SEC == 0 )
+        {
+            memset( aucData, 0xFF, sizeof( aucData ) );
+            aucData[ 0 ] = 0x05;                // operating status
+            xbbench_fnInject( 6, DEVICE_CLAIM_PGN, PGN_ADDR_GLOBAL,
+                              ptzPeer->ucAddr, aucData, 8 );
+        }
+
+        ulPhase = ( ulTick + i ) % ulStsPeriod;
+
+        // Status broadcast, dropped from the FIFO if the stack falls behind
+        if( ulPhase == 0 )
+        {
+            aucData[ 0 ] = (uchar8)( i + 1 );   // instance
+            aucData[ 1 ] = 0x64;                // priority
+            aucData[ 2 ] = (uchar8)ulTick;      // voltage
+            aucData[ 3 ] = 0x32;
+            aucData[ 4 ] = (uchar8)( ulTick >> 8 );   // current
+            aucData[ 5 ] = 0x77;
+            aucData[ 6 ] = 0x35;
+            aucData[ 7 ] = 0x94;
+            if( ( ptzPeer->uiStsHead - ptzPeer->uiStsTail < XBBENCH_STS_FIFO )
+             && xbbench_fnInject( 6, RVC_PGN_DC_SRC_STS1, PGN_ADDR_GLOBAL,
+                                  ptzPeer->ucAddr, aucData, 8 ) )
+            {
+                ptzPeer->adStsSent[ ptzPeer->uiStsHead++ % XBBENCH_STS_FIFO ] =
+                    adInjected[ ( uiInjHead - 1 ) & ( SIMCAN_RX_QUEUE_LEN - 1 ) ];
+            }
+        }
+
+        // Product Identification to the stack, alternately BAM and RTS/CTS
+        ulPhase = ( ulTick + i * ( ulMpPeriod / uiNumPeers + 1 ) ) % ulMpPeriod;
+        if( ( ulPhase == 0 ) && ( ptzPeer->dIdentSent == 0 ) && ( ptzPeer->dRtsSent == 0 ) )
+        {
+            if( ( ulTick / ulMpPeriod ) & 1 )
+            {
+                xbbench_fnConnMan( ptzPeer, ucMyAddr, XBBENCH_TP_RTS );
+                ptzPeer->dRtsSent = adInjected[ ( uiInjHead - 1 ) & ( SIMCAN_RX_QUEUE_LEN - 1 ) ];
+            }
+            else
+            {
+                xbbench_fnConnMan( ptzPeer, PGN_ADDR_GLOBAL, XBBENCH_TP_BAM );
+                xbbench_fnXfer( ptzPeer, PGN_ADDR_GLOBAL, 1, XBBENCH_IDENT_PACKETS );
+            }
+        }
+    }
+
+    // One node asks the stack for its address claim
+    if( ( ulTick % ulMpPeriod == ulMpPeriod / 2 ) && ( dReqSent == 0 ) )
+    {
+        ptzPeer = &atzPeers[ ( ulTick / ulMpPeriod ) % uiNumPeers ];
+        aucData[ 0 ] = (uchar8)RVC_PGN_ISO_ADDR_CLAIM;
+        aucData[ 1 ] = (uchar8)( RVC_PGN_ISO_ADDR_CLAIM >> 8 );
+        aucData[ 2 ] = (uchar8)( RVC_PGN_ISO_ADDR_CLAIM >> 16 );
+        if( xbbench_fnInject( 6, RVC_PGN_ISO_REQ, ucMyAddr, ptzPeer->ucAddr, aucData, 3 ) )
+        {
+            dReqSent = adInjected[ ( uiInjHead - 1 ) & ( SIMCAN_RX_QUEUE_LEN - 1 ) ];
+        }
+    }
+
+    // The application broadcasts its Product Identification. The RV-C
+    // stack sends every multipacket message by BAM, whatever the destination.
+    if( ( ulTick % ulMpPeriod == ulMpPeriod / 4 ) && ( dStackSendStart == 0 ) )
+    {
+        tzIdent.uiExtraCount = XBBENCH_IDENT_LEN;
+        tzIdent.ptzExtra = atzIdentExtra;
+        dStackSendStart = xbbench_fnNs();
+        if( XBMSG_fnSend( RVC_PGN_PROD_IDENT, &tzIdent, sizeof( tzIdent ), PGN_ADDR_GLOBAL ) )
+        {
+            ulIdentSent++;
+        }
+        else
+        {
+            dStackSendStart = 0;
+        }
+    }
+}
+
+// Number of DOBs in use
+static unsigned int xbbench_fnCountDobs( void )
+{
+    PGNDOB *pDob;
+    unsigned int uiCount = 0;
+
+    for( pDob = DOBHLDFirst(); pDob != NULL; pDob = DOBHLDNext( pDob ) )
+    {
+        uiCount++;
+    }
+    return( uiCount );
+}
+
+int main( int argc, char *argv[] )
+{
+    static uchar8 aucHeap[ XBBENCH_HEAP_SIZE ];
+    XB_tzPGN_ISO_ADDR_CLAIM tzName;
+    XB_tzXB_COMM_STATS *ptzStats;
+    unsigned long ulSeconds = 10;
+    unsigned long ulStsPeriod = 10;
+    unsigned long ulMpPeriod = 100;
+    unsigned long ulTicks;
+    unsigned long ulTick;
+    unsigned long ulMeasureIn;
+    unsigned long ulMeasureOut;
+    unsigned int uiDobs;
+    unsigned int uiMaxDobs = 0;
+    unsigned int uiConsumed;
+    unsigned int i;
+    double dStart;
+    double dTickStart;
+    double dNow;
+    double dWall;
+    int iOpt;
+
+    while( ( iOpt = getopt( argc, argv, "n:t:s:m:" ) ) != -1 )
+    {
+        switch( iOpt )
+        {
+        case 'n': uiNumPeers = (unsigned int)strtoul( optarg, NULL, 0 ); break;
+        case 't': ulSeconds = strtoul( optarg, NULL, 0 ); break;
+        case 's': ulStsPeriod = strtoul( optarg, NULL, 0 ); break;
+        case 'm': ulMpPeriod = strtoul( optarg, NULL, 0 ); break;
+        default:
+            fprintf( stderr, "usage: %s [-n nodes] [-t seconds] [-s status ticks] [-m multipacket ticks]\n",
+                     argv[ 0 ] );
+            return( 2 );
+        }
+    }
+    if( ( uiNumPeers == 0 ) || ( uiNumPeers > XBBENCH_MAX_PEERS )
+     || ( ulStsPeriod == 0 ) || ( ulMpPeriod < 4 ) )
+    {
+        fprintf( stderr, "nodes must be 1 to %d, status period at least 1, multipacket period at least 4\n",
+                 XBBENCH_MAX_PEERS );
+        return( 2 );
+    }
+    ulTicks = ulSeconds * XBBENCH_TICKS_PER_SEC;
+
+    // Simulated nodes and the payload they exchange with the stack
+    for( i = 0; i < XBBENCH_IDENT_LEN; i++ )
+    {
+        aucIdent[ i ] = (uchar8)( i == XBBENCH_IDENT_LEN - 1 ? '*' : 'A' + i % 26 );
+        atzIdentExtra[ i ].ucData = aucIdent[ i ];
+    }
+    for( i = 0; i < uiNumPeers; i++ )
+    {
+        memset( &tzName, 0, sizeof( tzName ) );
+        tzName.ulUniqueNumber = 0x1000 + i;
+        tzName.ucDeviceInstanceLower = (uchar8)i;
+        tzName.teDeviceFunction = XB_eFUNC_CODE_CHARGER;
+        tzName.ucSelfCfgAddr = 1;
+        atzPeers[ i ].ucAddr = (uchar8)( XBBENCH_PEER_ADDR + i );
+        XBADDR_fnNAME2ShortNAME( &tzName, atzPeers[ i ].aucName );
+    }
+
+    // The stack, on the virtual interface
+    SIMCAN_fnAttach( xbbench_fnStackTx );
+    XBWIN_fnSetCheckErrorsCB( xbbench_fnCheckErrors );
+    XBWIN_fnSetSetNetIndicCB( xbbench_fnSetNetIndic );
+    XBWIN_fnSetLoadCB( xbbench_fnLoad );
+    XBWIN_fnSetSaveCB( xbbench_fnSave );
+    XBWIN_fnSetNodeChangeCB( xbbench_fnNodeChange );
+    XBWIN_fnSetRecvXbMsgCB( xbbench_fnRecvXbMsg );
+    XBMEM_fnCtor( aucHeap, sizeof( aucHeap ) );
+    XBADDR_fnCtor( 1, XBBENCH_MAX_NODES );
+    if( !XBINIT_fnInit( 0, XBBENCH_CAN_BAUD_250K, XBBENCH_TICKS_PER_SEC ) )
+    {
+        fprintf( stderr, "XBINIT_fnInit failed, error %d from source %d\n", XBINIT_fnGetErrorNum(), XBINIT_fnGetErrorSrc() );
+        return( 1 );
+    }
+    xbbench_fnListen( RVC_PGN_DC_SRC_STS1, xbbench_fnRecvSts );
+    xbbench_fnListen( RVC_PGN_PROD_IDENT, xbbench_fnRecvProdIdent );
+    XBINIT_fnNetCtrl( XB_eNET_CTRL_RESUME );
+    if( !XBADDR_fnBeginClaiming() )
+    {
+        fprintf( stderr, "XBADDR_fnBeginClaiming failed\n" );
+        return( 1 );
+    }
+
+    // Every node claims its address, then the stack claims its own
+    for( i = 0; i < uiNumPeers; i++ )
+    {
+        xbbench_fnInject( 6, RVC_PGN_ISO_ADDR_CLAIM, PGN_ADDR_GLOBAL,
+                          atzPeers[ i ].ucAddr, atzPeers[ i ].aucName, PGN_NAME_LEN );
+    }
+    for( ulTick = 0; ( ulTick < XBBENCH_WARMUP_TICKS ) && !XBADDR_fnOnLine(); ulTick++ )
+    {
+        XBINIT_fnTick();
+        uiInjTail = uiInjHead - SIMCAN_fnPending();
+    }
+    if( !XBADDR_fnOnLine() )
+    {
+        fprintf( stderr, "stack did not come on line\n" );
+        return( 1 );
+    }
+
+    // Measured run
+    XBMSG_fnClearCommStats();
+    ulFramesIn = 0;
+    ulFramesOut = 0;
+    tucMeasuring = TRUE;
+    dStart = xbbench_fnNs();
+    for( ulTick = 0; ulTick < ulTicks; ulTick++ )
+    {
+        xbbench_fnPeerTick( ulTick, ulStsPeriod, ulMpPeriod );
+
+        dTickStart = xbbench_fnNs();
+        XBINIT_fnTick();
+        dNow = xbbench_fnNs();
+        xbbench_fnSample( &tzTickLat, dTickStart, dNow );
+
+        // Frames the tick read from the queue
+        uiConsumed = ( uiInjHead - uiInjTail ) - SIMCAN_fnPending();
+        while( uiConsumed-- > 0 )
+        {
+            xbbench_fnSample( &tzFrameLat,
+                              adInjected[ uiInjTail++ & ( SIMCAN_RX_QUEUE_LEN - 1 ) ],
+                              dNow );
+            ulFramesIn++;
+        }
+
+        uiDobs = xbbench_fnCountDobs();
+        if( uiDobs > uiMaxDobs )
+        {
+            uiMaxDobs = uiDobs;
+        }
+    }
+    dWall = ( xbbench_fnNs() - dStart ) / 1e9;
+    tucMeasuring = FALSE;
+    ulMeasureIn = ulFramesIn;
+    ulMeasureOut = ulFramesOut;
+    ptzStats = XBMSG_fnGetCommStats();
+
+    printf( "%u nodes, %lu s simulated in %.3f s\n", uiNumPeers, ulSeconds, dWall );
+    printf( "frames in:          %lu (%.0f/s wall, %.0f/s bus)\n",
+            ulMeasureIn, ulMeasureIn / dWall, (double)ulMeasureIn / ulSeconds );
+    printf( "frames out:         %lu (%.0f/s wall, %.0f/s bus)\n",
+            ulMeasureOut, ulMeasureOut / dWall, (double)ulMeasureOut / ulSeconds );
+    printf( "queue full:         %lu\n", ulInjectFull );
+    printf( "status handled:     %lu\n", ulStsHandled );
+    printf( "ident handled:      %lu\n", ulIdentHandled );
+    printf( "ident sent:         %lu\n", ulIdentSent );
+    printf( "transfer aborts:    %lu\n", ulAborts );
+    printf( "MP timeouts rx/tx:  %u/%u\n", ptzStats->ucMPRxTimeout, ptzStats->ucMPTxTimeout );
+    printf( "heap high-water:    %u of %u bytes\n",
+            (unsigned int)( XBBENCH_HEAP_SIZE - ptzStats->uiHeapFreeMin ),
+            (unsigned int)XBBENCH_HEAP_SIZE );
+    printf( "malloc failures:    %u\n", ptzStats->uiMallocFail );
+    printf( "DOBs in use, max:   %u (stack count %u)\n", uiMaxDobs, ptzStats->ucMaxActiveDobs );
+    printf( "latency, us                   count       p50       p90       p99       max\n" );
+    xbbench_fnReport( &tzFrameLat );
+    xbbench_fnReport( &tzStsLat );
+    xbbench_fnReport( &tzIdentLat );
+    xbbench_fnReport( &tzCtsLat );
+    xbbench_fnReport( &tzReqLat );
+    xbbench_fnReport( &tzSendLat );
+    xbbench_fnReport( &tzTickLat );
+
+    TFXDRV_CloseDriver();
+    XBMEM_fnDtor();
+    return( 0 );
+}
@@ -65,6 +65,9 @@ FUNCTION(S):
 #ifndef NO_UDPCAN
 #include "udpcan.h"         // Simulated CAN over UDP
 #endif
+#ifndef NO_SIMCAN
+#include "simcan.h"         // In-process virtual CAN for test harnesses
+#endif
 #ifndef NO_IFAK
 #include "ifakdrv.h"
 #endif
@@ -113,6 +116,7 @@ FUNCTION(S):
 #define  USING_CANVCP           6
 #define  USING_SOCKETCAN        7
 #define  USING_UDP              8
+#define  USING_SIMCAN           9
 
 
 /*==============================================================================
@@ -199,6 +203,9 @@ Version: 1.00  Date: DEC-18-2003  By: dalem
 Version: 1.10  Date: APR-20-2007  By: Trevor Monk
 	- Added support for a virtual CAN interface over TCP
 
+Version: 1.11  Date: OCT-19-2026  By: Jodh Singh Nahal
+    - Added the in-process virtual CAN interface for test harnesses
+
 *******************************************************************************/
 
 TFXCAN_RETURNS TFXDRV_i16InitController(CANPORT u8PortNumber,
@@ -243,6 +250,17 @@ TFXCAN_RETURNS TFXDRV_i16InitController(CANPORT u8PortNumber,
 
 #endif // ifdef WIN32
 
+#ifndef NO_SIMCAN
+    // A test harness in this process takes precedence over real buses
+    if ( ucUsingInterface == USING_NONE )
+    {
+        if ( SIMCAN_fnInit() )
+        {
+            ucUsingInterface = USING_SIMCAN;
+        }
+    }
+#endif // NO_SIMCAN
+
 #ifndef NO_SOCKETCAN
     // Try the socketcan interface
     if ( ucUsingInterface == USING_NONE )
@@ -340,6 +358,9 @@ Version: 1.00  Date: DEC-18-2003  By: dalem
 Version: 1.10  Date: APR-20-2007  By: Trevor Monk
 	- Added support for a virtual CAN interface over TCP
 
+Version: 1.11  Date: OCT-19-2026  By: Jodh Singh Nahal
+    - Added the in-process virtual CAN interface for test harnesses
+
 *******************************************************************************/
 
 void TFXDRV_CloseDriver( void )
@@ -402,6 +423,14 @@ void TFXDRV_CloseDriver( void )
     }
     break;
 #endif // NO_UDPCAN
+
+#ifndef NO_SIMCAN
+    case USING_SIMCAN:
+    {
+        SIMCAN_fnClose();
+    }
+    break;
+#endif // NO_SIMCAN
     
 #ifndef NO_XANBR
     case USING_TCP:
@@ -443,6 +472,9 @@ Version: 1.00  Date: DEC-18-2003  By: dalem
 Version: 1.10  Date: APR-20-2007  By: Trevor Monk
 	- Added support for a virtual CAN interface over TCP
 
+Version: 1.11  Date: OCT-19-2026  By: Jodh Singh Nahal
+    - Added the in-process virtual CAN interface for test harnesses
+
 *******************************************************************************/
 
 TFXCAN_RETURNS TFXDRV_i16ControllerState(CANPORT u8PortNumber)
@@ -490,6 +522,10 @@ TFXCAN_RETURNS TFXDRV_i16ControllerState(CANPORT u8PortNumber)
     case USING_UDP:
         return UDPCAN_fnStatus();
 #endif
+#ifndef NO_SIMCAN
+    case USING_SIMCAN:
+        return SIMCAN_fnStatus();
+#endif
 #ifndef NO_XANBR
     case USING_TCP:
         return XANBR_fnStatus();
@@ -554,11 +590,20 @@ VERSION HISTORY:
 
 Version: 1.00  Date: 01/10/05  By: dalem
     - Created
+Version: 1.01  Date: 10/19/26  By: Jodh Singh Nahal
+    - Keep socketcan acceptance filters on the current address
 
 *******************************************************************************/
 
 void TFXDRV_fnStatusTick( CANPORT Channel )
 {
+#ifndef NO_SOCKETCAN
+    // Keep the acceptance filters on the address we are using
+    if ( ucUsingInterface == USING_SOCKETCAN )
+    {
+        SOCKETCAN_fnSetFilterAddr( XBADDR_fnGetMyAddr() );
+    }
+#endif // NO_SOCKETCAN
     return;
 }
 
@@ -733,6 +778,9 @@ Version: 1.00  Date: DEC-18-2003  By: dalem
 Version: 1.10  Date: APR-20-2007  By: Trevor Monk
 	- Added support for a virtual CAN interface over TCP
 
+Version: 1.11  Date: OCT-19-2026  By: Jodh Singh Nahal
+    - Added the in-process virtual CAN interface for test harnesses
+
 *******************************************************************************/
 
 TFXCAN_RETURNS TFXDRV_i16ReceiveFrame( CANPORT u8PortNumber, CANFRAME *pFrame )
@@ -794,6 +842,12 @@ TFXCAN_RETURNS TFXDRV_i16ReceiveFrame( CANPORT u8PortNumber, CANFRAME *pFrame )
         return UDPCAN_fnReceiveFrame( u8PortNumber, pFrame );
     }
 #endif
+#ifndef NO_SIMCAN
+    case USING_SIMCAN:
+    {
+        return SIMCAN_fnReceiveFrame( u8PortNumber, pFrame );
+    }
+#endif
 #ifndef NO_XANBR
     case USING_TCP:
     {
@@ -896,6 +950,9 @@ Version: 1.00  Date: DEC-18-2003  By: dalem
 Version: 1.10  Date: APR-20-2007  By: Trevor Monk
 	- Added support for a virtual CAN interface over TCP
 
+Version: 1.11  Date: OCT-19-2026  By: Jodh Singh Nahal
+    - Added the in-process virtual CAN interface for test harnesses
+
 *******************************************************************************/
 
 TFXCAN_RETURNS TFXDRV_i16SendFrame( CANPORT u8PortNumber,
@@ -957,6 +1014,12 @@ TFXCAN_RETURNS TFXDRV_i16SendFrame( CANPORT u8PortNumber,
         return UDPCAN_fnSendFrame( u8PortNumber, pFrame, pi16MessageID );
     }
 #endif
+#ifndef NO_SIMCAN
+    case USING_SIMCAN:
+    {
+        return SIMCAN_fnSendFrame( u8PortNumber, pFrame, pi16MessageID );
+    }
+#endif
 #ifndef NO_XANBR
     case USING_TCP:
     {
@@ -0,0 +1,31 @@
+/*=============================================================================
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+FILE NAME:  xbtfilt.h
+
+PURPOSE:
+    CAN acceptance filters for the PGNs received from xbtmsg.c.
+    GENERATED by MakeCanFilters.py, do not edit; rerun it after
+    changing the PGN table:
+        python3 MakeCanFilters.py xbtiny
+
+    9 PGNs in 2 filters, passing 10230 unwanted id patterns
+    (priority and source address aside).
+
+=============================================================================*/
+
+#ifndef XBTFILT_H
+#define XBTFILT_H
+
+#define XBT_NUM_ACCEPT_FILTERS  ( 2 )
+
+static const XBT_tzACCEPT_FILTER XBT_katzACCEPT_FILTERS[ XBT_NUM_ACCEPT_FILTERS ] =
+{
+    //  Id,           Mask,         Flags
+    { 0x00E80000UL, 0x01F80000UL, 0 },
+    { 0x01200000UL, 0x01E00000UL, 0 },
+};
+
+#endif  // XBTFILT_H
@@ -20,7 +20,7 @@ FUNCTION(S):
 
     local:
         xbtframe_fnFindFreeMsg  - Choose a free message buffer
-        xbtframe_fnFindMsgMatch - Find a message buffer that matches PGN
+        xbtframe_fnFindMsgMatch - Find the message buffer receiving a PGN
         xbtframe_fnMakeFrameID  - Build frame ID from PGN
         xbtframe_fnGetMsgID     - Build message identifier from a frame ID
         xbtframe_fnPutMsgID     - Copy message identifier data to a message buffer
@@ -42,6 +42,7 @@ FUNCTION(S):
 #include "xbudefs.h"
 #include "xbtgdefs.h"
 #include "xbtldefs.h"
+#include "xbtfilt.h"
 #include "candrv.h"
 #include "config.h"
 #include "Device.h"
@@ -203,6 +204,14 @@ static const XBT_tzMSG * const aptzMsgRxList[] =
     &tzFastPacketRx2,
 };
 
+/*
+    Receiving message buffer last started for each entry of the PGN support
+    list, so a continuation frame finds its buffer without scanning. An
+    entry is only a hint: it is used if that buffer is still busy with the
+    same PGN.
+*/
+static XBT_tzMSG *aptzRxMatch[ XBT_NUM_PGNS ];
+
 /*
     List of pointers to all receiving message buffers
     Used for maintaining their time to live timers
@@ -223,6 +232,9 @@ static const XBT_tzMSG * const aptzMsgTtlList[] =
 // Check if received frame is for this device
 static tucBOOL xbtframe_fnFilterRxFrame( CANDRV_tzCAN_ID *pzId );
 
+// Load the acceptance filters into the CAN controller
+static tucBOOL xbtframe_fnLoadFilters( void );
+
 
 /*==============================================================================
                            Function Definitions
@@ -285,17 +297,18 @@ FUNCTION NAME:
     xbtframe_fnFindMsgMatch
 
 PURPOSE:
-    Find a message buffer whose PGN matches the given PGN
+    Find the message buffer receiving the given PGN
 
 INPUTS:
-    'ulPgn' - the received frame PGN to be searched for in the message buffer
+    'ptzPgnList' - the PGN support list entry of the received frame
 
 OUTPUTS:
-    A pointer to a message buffer of the same PGN
+    A pointer to the busy message buffer of the same PGN
     NULL if no message buffer available
 
 NOTES:
     This function is used by the XBTiny stack when receiving a frame.
+    The buffer is the one last started for the PGN, see aptzRxMatch.
 
 VERSION HISTORY:
 
@@ -303,24 +316,25 @@ Version 1.00  Date: 03/24/03  By: dalem
     - First version
 Version 1.01  Date: 08/01/03  By: dalem
     - Changed for loop to terminate when address beyond end of list
+Version 1.02  Date: 10/19/26  By: Jodh Singh Nahal
+    - Indexed by PGN support list entry instead of scanning the buffers
 
 *******************************************************************************/
 
-static XBT_tzMSG *xbtframe_fnFindMsgMatch( uint32 ulPgn )
+static XBT_tzMSG *xbtframe_fnFindMsgMatch( const XBT_tzPGN_LIST *ptzPgnList )
 {
-    XBT_tzMSG **pptzMsg;
+    XBT_tzMSG *ptzMsg;
 
-    // For every entry in message receive list
-    for( pptzMsg = (XBT_tzMSG **)aptzMsgRxList;
-         pptzMsg < (XBT_tzMSG **)&aptzMsgRxList[ DIM( aptzMsgRxList ) ];
-         pptzMsg++ )
+    // Buffer last started for this PGN
+    ptzMsg = aptzRxMatch[ XBTMSG_fnPgnIndex( ptzPgnList ) ];
+
+    // If PGN matches and buffer is still busy
+    if( ( ptzMsg != NULL )
+     && ( ptzMsg->ulPgn == ptzPgnList->ulPgn )
+     && ( ptzMsg->ucBusy ) )
     {
-        // If protocol matches and buffer is busy
-        if( ( (*pptzMsg)->ulPgn == ulPgn ) && ( (*pptzMsg)->ucBusy ) )
-        {
-            // Return the message buffer
-            return( *pptzMsg );
-        }
+        // Return the message buffer
+        return( ptzMsg );
     }
 
     // Failed, no buffer found
@@ -995,6 +1009,7 @@ INPUTS:
     'ptzFrame'  - pointer to the received CAN frame
     'ptzMsgID'  - pointer to the message identifier of the received CAN frame;
                   provides message PGN, priority, destination and source addresss.
+    'ptzPgnList' - PGN support list entry of the message
     'puiReason' - pointer to return how frame was handled
 
 OUTPUTS:
@@ -1013,11 +1028,14 @@ Version 1.02  Date: 03/23/04  By: peterd
     - Added reset of frame count
     - Added call to test and set received frame flag
     - Added message completion test
+Version 1.03  Date: 10/19/26  By: Jodh Singh Nahal
+    - Record the buffer started for the PGN for xbtframe_fnFindMsgMatch
 
 *******************************************************************************/
 
 static XBT_tzMSG *xbtframe_fnRecvFastFrame( CANDRV_tzCAN_FRAME *ptzFrame,
                                             XBT_tzMSG_ID *ptzMsgId,
+                                            const XBT_tzPGN_LIST *ptzPgnList,
                                             uint16 *puiReason )
 {
     XBT_tzMSG *ptzMsg;
@@ -1061,6 +1079,9 @@ static XBT_tzMSG *xbtframe_fnRecvFastFrame( CANDRV_tzCAN_FRAME *ptzFrame,
         // Set PGN, destination address, source address and priority
         xbtframe_fnPutMsgId( ptzMsg, ptzMsgId );
 
+        // Continuation frames of this PGN go to this buffer
+        aptzRxMatch[ XBTMSG_fnPgnIndex( ptzPgnList ) ] = ptzMsg;
+
         // Total message length is second byte of frame
         ptzMsg->uiDataLen = *pucFrameData++;
 
@@ -1073,7 +1094,7 @@ static XBT_tzMSG *xbtframe_fnRecvFastFrame( CANDRV_tzCAN_FRAME *ptzFrame,
     else
     {
         // Look for message with matching PGN
-        ptzMsg = xbtframe_fnFindMsgMatch( ptzMsgId->ulPgn );
+        ptzMsg = xbtframe_fnFindMsgMatch( ptzPgnList );
 
         // If no message available
         if( !ptzMsg )
@@ -1412,6 +1433,7 @@ XBT_tzMSG *XBTFRAME_fnRecvFrame( uint16 *puiReason )
                 // Receive a fastpacket frame
                 ptzMsg = xbtframe_fnRecvFastFrame( ptzFrame,
                                                    &tzMsgId,
+                                                   ptzPgnList,
                                                    puiReason );
             }
             else
@@ -1627,6 +1649,81 @@ uchar8 XBTFRAME_fnBusTxState( void )
 
 /*******************************************************************************
 
+FUNCTION NAME:
+    xbtframe_fnLoadFilters
+
+PURPOSE:
+    Load the acceptance filters generated from the PGN support list into
+    the CAN controller, so that frames xbtframe_fnFilterRxFrame would
+    discard are mostly not received at all.
+
+INPUTS:
+    none
+
+OUTPUTS:
+    tucBOOL TRUE  - all filters loaded
+            FALSE - the controller could not take them
+
+NOTES:
+    Filters can only be loaded while the controller is in init mode, and
+    our address can change after that, so Packet Specific is not matched
+    for filters on our own address. The table is generated by
+    MakeCanFilters.py for the number of filters the controller has.
+
+VERSION HISTORY:
+
+Version 1.00  Date: 10/19/26  By: Jodh Singh Nahal
+    - Creation
+
+*******************************************************************************/
+
+static tucBOOL xbtframe_fnLoadFilters( void )
+{
+    const XBT_tzACCEPT_FILTER *ptzFilter;
+    CANDRV_tzCAN_ID tzId;
+    CANDRV_tzCAN_ID tzMask;
+    uint32 ulMask;
+    uchar8 ucIndex;
+
+    for( ucIndex = 0; ucIndex < XBT_NUM_ACCEPT_FILTERS; ucIndex++ )
+    {
+        ptzFilter = &XBT_katzACCEPT_FILTERS[ ucIndex ];
+
+        // Our address is not known yet, pass any Packet Specific
+        ulMask = ptzFilter->ulMask;
+        if( ptzFilter->ucFlags & XBT_FILTER_OWN_ADDR )
+        {
+            ulMask &= ~0x0000FF00UL;
+        }
+
+        // Extended data frames only
+        tzId.ucId28_24 = XT_mMK_BYTE( ( ptzFilter->ulId >> 24 ) & 0x1F )
+                       | CANDRV_ID_MSK_IDE;
+        tzId.ucId23_16 = XT_mMK_BYTE( ptzFilter->ulId >> 16 );
+        tzId.ucId15_8 = XT_mMK_BYTE( ptzFilter->ulId >> 8 );
+        tzId.ucId07_00 = XT_mMK_BYTE( ptzFilter->ulId );
+
+        // The controller takes a 1 in the mask as don't care
+        tzMask.ucId28_24 = XT_mMK_BYTE( ( ~ulMask >> 24 ) & 0x1F )
+                         | CANDRV_ID_MSK_SRR;
+        tzMask.ucId23_16 = XT_mMK_BYTE( ~ulMask >> 16 );
+        tzMask.ucId15_8 = XT_mMK_BYTE( ~ulMask >> 8 );
+        tzMask.ucId07_00 = XT_mMK_BYTE( ~ulMask );
+
+        if( CANDRV_fnSetFilter( XBT_CHANNEL,
+                                ucIndex,
+                                &tzId,
+                                &tzMask ) != CANDRV_eRET_SUCCESS )
+        {
+            return( FALSE );
+        }
+    }
+
+    return( TRUE );
+}
+
+/*******************************************************************************
+
 FUNCTION NAME:
     XBTFRAME_fnInit
 
@@ -1646,6 +1743,8 @@ VERSION HISTORY:
 
 Version 1.00  Date: 03/24/03  By: dalem
     - First version
+Version 1.01  Date: 10/19/26  By: Jodh Singh Nahal
+    - Load hardware acceptance filters
 
 *******************************************************************************/
 
@@ -1664,10 +1763,18 @@ uint16 XBTFRAME_fnInit( void )
         return( teResult );
     }
 
-    // Initialize CAN
+    // Initialize CAN, passing only what the acceptance filters pass
     teResult = CANDRV_fnInit( XBT_CHANNEL,
                               CANDRV_eBIT_RATE_250KBPS,
-                              CANDRV_eFILTER_PASS_ALL );
+                              CANDRV_eFILTER_PASS_NONE );
+    if( ( teResult == CANDRV_eRET_SUCCESS )
+     && ( xbtframe_fnLoadFilters() == FALSE ) )
+    {
+        // Too many filters for this controller, filter in software only
+        teResult = CANDRV_fnInit( XBT_CHANNEL,
+                                  CANDRV_eBIT_RATE_250KBPS,
+                                  CANDRV_eFILTER_PASS_ALL );
+    }
     if( teResult != CANDRV_eRET_SUCCESS )
     {
         // Return failure code
@@ -31,6 +31,7 @@ FUNCTION(S):
     XBTLOAD_fnReqLoadStatus - Handle request to send a Download Status PGN
     XBTMSG_fnSendConnMan    - Send an ISO Connenction Management message
     XBTMSG_fnLookupPgn      - Lookup PGN in PGN support list
+    XBTMSG_fnPgnIndex       - Position of an entry in the PGN support list
     XBTMSG_fnNewMsg         - Get a free message buffer
     XBTMSG_fnSendAddressed  - Send a PGN with addresses set
 
@@ -97,6 +98,16 @@ $Log: xbtldefs.h $
 #define XBT_NO_BROADCAST    0x40    // Reject message if broadcast
 #define XBT_ACCESS_DENY     0x80    // Reject Tx request with access denied
 
+/*
+    Acceptance filter flags (XBT_katzACCEPT_FILTERS in xbtfilt.h)
+*/
+#define XBT_FILTER_OWN_ADDR 0x01    // Packet Specific must be our address
+
+/*
+    Number of entries in the PGN support list (katzPGN_LIST in xbtmsg.c)
+*/
+#define XBT_NUM_PGNS        ( 9 )
+
 /*
     Macro for converting three contiguous little endian bytes into a PGN
 */
@@ -133,6 +144,18 @@ typedef struct zPGN_LIST
     uchar8 ucSeqNum;                        // Fastpacket sequence number
 } XBT_tzPGN_LIST;
 
+/*
+    CAN acceptance filter generated from the PGN support list by
+    MakeCanFilters.py. Id and mask cover CAN id bits 28 to 0; a mask bit
+    of 1 means the id bit must match.
+*/
+typedef struct zACCEPT_FILTER
+{
+    uint32 ulId;            // CAN id to match
+    uint32 ulMask;          // CAN id bits that must match
+    uchar8 ucFlags;         // Filter flags
+} XBT_tzACCEPT_FILTER;
+
 /*=============================================================================
                                 Function Prototypes
 =============================================================================*/
@@ -174,6 +197,8 @@ extern void XBTLOAD_fnRecvResetCmd( XBT_tzMSG *ptzMsg );    // Received message
 // From xbtmsg.c
 extern const XBT_tzPGN_LIST *XBTMSG_fnLookupPgn( uint32 ulPgn );   // Parameter group number
 
+extern uchar8 XBTMSG_fnPgnIndex( const XBT_tzPGN_LIST *ptzPgnList );   // PGN support list entry
+
 extern void XBTMSG_fnSendConnMan( uchar8 ucConnMan,     // ISO Connection Management message type
                                   XBT_tzMSG *ptzMsg );  // Message pointer
 
@@ -10,6 +10,7 @@ PURPOSE:
 
 FUNCTION(S):
     XBTMSG_fnLookupPgn      - Lookup PGN in PGN support list
+    XBTMSG_fnPgnIndex       - Position of an entry in the PGN support list
     XBTMSG_fnNewMsg         - Get a free message buffer
     XBTMSG_fnReleaseMsg     - Free a busy message buffer
     XBTMSG_fnSendConnMan    - Send an ISO Connenction Management message
@@ -37,6 +38,7 @@ FUNCTION(S):
 #include "xbtgdefs.h"
 #include "xbtldefs.h"
 #include "config.h"
+#include "xassert.h"    // for assert statements
 
 /*==============================================================================
                            Local/Private Constants
@@ -55,8 +57,12 @@ static void xbtmsg_fnRecvIsoReq( XBT_tzMSG *ptzMsg );   // Received message poin
 
 /*
     List of supported PGNs specifying the protocol used for them
+
+    The list must be sorted by ascending PGN: XBTMSG_fnLookupPgn does a
+    binary search of it for every received frame. XBT_NUM_PGNS must match
+    the number of entries; XBTMSG_fnInit checks both in debug builds.
 */
-static const XBT_tzPGN_LIST   katzPGN_LIST[] =
+static const XBT_tzPGN_LIST   katzPGN_LIST[ XBT_NUM_PGNS ] =
 {
     //  PGN,
     //  Flags,
@@ -94,6 +100,12 @@ static const XBT_tzPGN_LIST   katzPGN_LIST[] =
       XBTADDR_fnRecvClaim,
       XBTADDR_fnSendClaim },
 
+    { XB_PGN_RESET_CMD,
+      XBT_SINGLEFRAME | XBT_NO_RELEASE | XBT_DIAG_COMMAND | XBT_ACCESS_DENY | XBT_ALLOW_OFFLINE,
+      XB_DLC_RESET_CMD,
+      XBTLOAD_fnRecvResetCmd,
+      NULL },
+
     { XB_PGN_FILE_DNLD_BLK,
       XBT_MULTIFRAME | XBT_NO_RELEASE | XBT_DIAG_COMMAND | XBT_ACCESS_DENY | XBT_NO_BROADCAST,
       XB_DLC_FILE_DNLD_BLK,
@@ -112,11 +124,6 @@ static const XBT_tzPGN_LIST   katzPGN_LIST[] =
       NULL,
       XBTLOAD_fnReqLoadStatus },
 
-    { XB_PGN_RESET_CMD,
-      XBT_SINGLEFRAME | XBT_NO_RELEASE | XBT_DIAG_COMMAND | XBT_ACCESS_DENY | XBT_ALLOW_OFFLINE,
-      XB_DLC_RESET_CMD,
-      XBTLOAD_fnRecvResetCmd,
-      NULL },
 };
 
 /*
@@ -218,37 +225,52 @@ OUTPUTS:
     NULL is PGN is not found
 
 NOTES:
+    Called for every received frame, from the receive interrupt to filter
+    it and again when the frame is handled. The list is sorted by PGN so
+    this is a binary search.
 
 VERSION HISTORY:
 
 Version 1.00  Date: 03/24/03  By: dalem
     - First version
+Version 1.01  Date: 10/19/26  By: Jodh Singh Nahal
+    - Binary search of the sorted list instead of a linear scan
 
 ******************************************************************************/
 
 const XBT_tzPGN_LIST *XBTMSG_fnLookupPgn( uint32 ulPgn )
 {
     const XBT_tzPGN_LIST *ptzPgnList;
-    const XBT_tzPGN_LIST *ptzEnd;
-
-    // Get pointer to PGN Lookup array
-    ptzPgnList = &katzPGN_LIST[ 0 ];
+    uchar8 ucLow;
+    uchar8 ucHigh;
+    uchar8 ucMid;
 
-    // Get pointer to end of PGN Lookup array
-    ptzEnd = &katzPGN_LIST[ DIM( katzPGN_LIST ) ];
+    // Search the whole list
+    ucLow = 0;
+    ucHigh = DIM( katzPGN_LIST );
 
-    // While not at end of PGN list
-    while( ptzPgnList < ptzEnd )
+    // While there are entries left between low and high
+    while( ucLow < ucHigh )
     {
-        // If PGN matches one entry from the PGN list
+        ucMid = (uchar8)( ( ucLow + ucHigh ) / 2 );
+        ptzPgnList = &katzPGN_LIST[ ucMid ];
+
+        // If PGN matches this entry from the PGN list
         if( ptzPgnList->ulPgn == ulPgn )
         {
             // Success
             return( ptzPgnList );
         }
 
-        // Try next entry
-        ptzPgnList++;
+        // Continue in the half that can hold the PGN
+        if( ptzPgnList->ulPgn < ulPgn )
+        {
+            ucLow = (uchar8)( ucMid + 1 );
+        }
+        else
+        {
+            ucHigh = ucMid;
+        }
     }
 
     // PGN not found in list
@@ -257,6 +279,38 @@ const XBT_tzPGN_LIST *XBTMSG_fnLookupPgn( uint32 ulPgn )
 
 /******************************************************************************
 
+FUNCTION NAME:
+    XBTMSG_fnPgnIndex
+
+PURPOSE:
+    Get the position of an entry in the PGN support list
+
+INPUTS:
+    'ptzPgnList' - entry returned by XBTMSG_fnLookupPgn
+
+OUTPUTS:
+    Index of the entry, below XBT_NUM_PGNS
+
+NOTES:
+    Lets other layers keep per-PGN data in arrays of XBT_NUM_PGNS entries.
+
+VERSION HISTORY:
+
+Version 1.00  Date: 10/19/26  By: Jodh Singh Nahal
+    - First version
+
+******************************************************************************/
+
+uchar8 XBTMSG_fnPgnIndex( const XBT_tzPGN_LIST *ptzPgnList )
+{
+    assert( ( ptzPgnList >= &katzPGN_LIST[ 0 ] )
+         && ( ptzPgnList < &katzPGN_LIST[ DIM( katzPGN_LIST ) ] ) );
+
+    return( (uchar8)( ptzPgnList - &katzPGN_LIST[ 0 ] ) );
+}
+
+/******************************************************************************
+
 FUNCTION NAME:
     XBTMSG_fnNewMsg
 
@@ -1097,6 +1151,8 @@ VERSION HISTORY:
 
 Version 1.00  Date: 03/24/03  By: dalem
     - First version
+Version 1.01  Date: 10/19/26  By: Jodh Singh Nahal
+    - Check that the PGN support list is sorted and fully populated
 
 *******************************************************************************/
 
@@ -1104,6 +1160,15 @@ uint16 XBTMSG_fnInit( void )
 {
     XBT_tzMSG **pptzMsg;
     uint16 uiErr;
+    uchar8 ucIdx;
+
+    // The binary search needs strictly ascending PGNs. An entry missing
+    // from a list declared with XBT_NUM_PGNS entries is left as PGN zero
+    // at the end, which also fails this check
+    for( ucIdx = 1; ucIdx < DIM( katzPGN_LIST ); ucIdx++ )
+    {
+        assert( katzPGN_LIST[ ucIdx - 1 ].ulPgn < katzPGN_LIST[ ucIdx ].ulPgn );
+    }
 
     // Initialize the XBT frames management layer
     uiErr = XBTFRAME_fnInit();
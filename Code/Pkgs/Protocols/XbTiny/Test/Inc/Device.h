@@ -0,0 +1,42 @@
+/*=============================================================================
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+FILE NAME:  Device.h
+
+PURPOSE:
+    Device macros for building XanBus Tiny on a host computer, where there
+    are no interrupts to mask and no watchdog to service.
+
+=============================================================================*/
+
+#ifndef DEVICE_INCL
+#define DEVICE_INCL
+
+/*==============================================================================
+                              Macros
+==============================================================================*/
+
+// enable interrupts
+#define DEVICE_mGLOBAL_INT_EN( )
+
+// disable interrupts
+#define DEVICE_mGLOBAL_INT_DIS( )
+
+#define DEVICE_mWD_EN( Rate )
+
+#define DEVICE_mWD_DIS( )
+
+// reset the watchdog timer
+#define DEVICE_mWD_RST()
+
+#define DEVICE_mSHUTDOWN()
+
+// trigger a Watchdog Reset
+#define DEVICE_mWD_TRIGGER()
+
+// reset the Device
+#define DEVICE_mCPU_RST()
+
+#endif  // DEVICE_INCL
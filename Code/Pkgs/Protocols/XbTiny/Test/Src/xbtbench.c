@@ -0,0 +1,408 @@
+/*=============================================================================
+  (c) 2026 Xantrex Canada ULC. All rights reserved.
+  All trademarks are owned or licensed by Xantrex Canada ULC,
+  its subsidiaries or affiliated companies.
+
+FILE NAME:  xbtbench.c
+
+PURPOSE:
+    Host benchmark of the XanBus Tiny receive path. A synthetic stream of
+    frames, shaped like a loaded RV-C bus as seen by one node, is fed through
+    the acceptance filters loaded by XBTFRAME_fnInit, as an MSCAN applies
+    them, then the receive interrupt handler and XBTFRAME_fnRecvFrame. The
+    cost per frame is reported along with the cost of XBTMSG_fnLookupPgn
+    alone.
+
+FUNCTION(S):
+    main                    - Run the benchmark
+
+    local:
+        xbtbench_fnHwPass       - Apply the acceptance filters to a frame
+        xbtbench_fnMakeStream   - Build the synthetic frame stream
+        xbtbench_fnPutFrame     - Append one frame to the stream
+        xbtbench_fnNs           - Monotonic clock in nanoseconds
+
+NOTES:
+    The CAN driver, platform and abort functions the stack expects from
+    its target are provided here. Build from the repository root with
+      gcc -O2 -D_32BIT_ARCHITECTURE -DXT_FAR= \
+          -ICode/Pkgs/Protocols/XbTiny/Test/Inc \
+          -ICode/Pkgs/Protocols/XbTiny/Inc -ICode/Pkgs/Protocols/XbTiny/Src \
+          -ICode/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Inc \
+          Code/Pkgs/Protocols/XbTiny/Test/Src/xbtbench.c \
+          Code/Pkgs/Protocols/XbTiny/Src/xbt{addr,error,frame,load,msg}.c \
+          -o xbtbench
+
+=============================================================================*/
+
+/*==============================================================================
+                              Includes
+==============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "xbudefs.h"
+#include "xbtgdefs.h"
+#include "xbtldefs.h"
+#include "candrv.h"
+
+/*==============================================================================
+                           Local/Private Constants
+==============================================================================*/
+
+#define XBTBENCH_MY_ADDR    ( 0x80 )    // Address of the node under test
+#define XBTBENCH_DIAG_ADDR  ( 0x90 )    // Address sending to the node
+#define XBTBENCH_FRAMES     ( 4096 )    // Frames in the synthetic stream
+#define XBTBENCH_ROUNDS     ( 500 )     // Times the stream is replayed
+#define XBTBENCH_HW_FILTERS ( 2 )       // Acceptance filters of an MSCAN
+
+/*==============================================================================
+                           Local/Private Variables
+==============================================================================*/
+
+// The synthetic frame stream and the position of the frame being received
+static CANDRV_tzCAN_FRAME atzStream[ XBTBENCH_FRAMES ];
+static uint16 uiStreamLen;
+static uint16 uiStreamPos;
+
+// Receive interrupt handler installed by XBTFRAME_fnInit
+static CANDRV_tpfnCALLBACK pfnRecvCb;
+
+// Acceptance filters as an MSCAN holds them, a mask bit of 1 is don't care
+static CANDRV_tzCAN_ID atzHwId[ XBTBENCH_HW_FILTERS ];
+static CANDRV_tzCAN_ID atzHwMask[ XBTBENCH_HW_FILTERS ];
+
+// PGNs broadcast by the other nodes, none of them handled by XanBus Tiny
+static const uint32 kaulBCAST_PGNS[] =
+{
+    0x1FFFD, 0x1FFFC, 0x1FFF7, 0x1FFEA, 0x1FFD4, 0x1FFCA,
+    0x1FFB7, 0x1FFAE, 0x1FF9C, 0x1FEBD, 0x1FEA5, 0x1FECA
+};
+
+/*==============================================================================
+                           Target functions
+==============================================================================*/
+
+void CANDRV_fnInitCbList( void )
+{
+    pfnRecvCb = NULL;
+}
+
+CANDRV_teRETURN CANDRV_fnInstallCb( uchar8 ucChannel,
+                                    CANDRV_teCB_TYPE teCbType,
+                                    CANDRV_tpfnCALLBACK tpfnFunc )
+{
+    (void)ucChannel;
+
+    if( teCbType == CANDRV_eCB_RECEIVE )
+    {
+        pfnRecvCb = tpfnFunc;
+    }
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teRETURN CANDRV_fnInit( uchar8 ucChannel,
+                               CANDRV_teBIT_RATE teBitRate,
+                               CANDRV_teFILTER_MODE teFilterMode )
+{
+    (void)ucChannel;
+    (void)teBitRate;
+
+    // Zero ids with all or none of the bits don't care
+    memset( atzHwId, 0, sizeof( atzHwId ) );
+    memset( atzHwMask,
+            ( teFilterMode == CANDRV_eFILTER_PASS_ALL ) ? 0xFF : 0x00,
+            sizeof( atzHwMask ) );
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teRETURN CANDRV_fnSetFilter( uchar8 ucChannel,
+                                    uchar8 ucFilterID,
+                                    CANDRV_tzCAN_ID *ptzCanId,
+                                    CANDRV_tzCAN_ID *ptzMask )
+{
+    (void)ucChannel;
+
+    if( ucFilterID >= XBTBENCH_HW_FILTERS )
+    {
+        return( CANDRV_eRET_BAD_FILTER );
+    }
+    atzHwId[ ucFilterID ] = *ptzCanId;
+    atzHwMask[ ucFilterID ] = *ptzMask;
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teRETURN CANDRV_fnEnable( uchar8 ucChannel )
+{
+    (void)ucChannel;
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teRETURN CANDRV_fnReceive( uchar8 ucChannel,
+                                  CANDRV_tzCAN_FRAME *ptzRxFrame )
+{
+    (void)ucChannel;
+    *ptzRxFrame = atzStream[ uiStreamPos ];
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teRETURN CANDRV_fnTransmitOk( uchar8 ucChannel )
+{
+    (void)ucChannel;
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teRETURN CANDRV_fnTransmit( uchar8 ucChannel,
+                                   CANDRV_tzCAN_FRAME *ptzTxFrame,
+                                   uchar8 *pucHandle )
+{
+    (void)ucChannel;
+    (void)ptzTxFrame;
+    *pucHandle = 0;
+    return( CANDRV_eRET_SUCCESS );
+}
+
+CANDRV_teSTATUS CANDRV_fnTxStatus( uchar8 ucChannel,
+                                   uchar8 *pucErrCount )
+{
+    (void)ucChannel;
+    (void)pucErrCount;
+    return( CANDRV_eSTATUS_OK );
+}
+
+void SYS_fnAbort( char *warning )
+{
+    (void)warning;
+    fprintf( stderr, "assertion failed\n" );
+    abort();
+}
+
+uchar8 XBTPLATFORM_fnLoadPrefAddr( void )
+{
+    return( XBTBENCH_MY_ADDR );
+}
+
+void XBTPLATFORM_fnLoadName( uchar8 *pucName )
+{
+    (void)memset( pucName, 0, 8 );
+}
+
+/*==============================================================================
+                           Function Definitions
+==============================================================================*/
+
+// Does the frame get past the acceptance filters, as an extended data frame
+static tucBOOL xbtbench_fnHwPass( const CANDRV_tzCAN_ID *ptzId )
+{
+    const uchar8 *pucId = (const uchar8 *)ptzId;
+    const uchar8 *pucHwId;
+    const uchar8 *pucHwMask;
+    uchar8 ucFilter;
+    uchar8 ucByte;
+    uchar8 ucFrameByte;
+
+    for( ucFilter = 0; ucFilter < XBTBENCH_HW_FILTERS; ucFilter++ )
+    {
+        pucHwId = (const uchar8 *)&atzHwId[ ucFilter ];
+        pucHwMask = (const uchar8 *)&atzHwMask[ ucFilter ];
+        for( ucByte = 0; ucByte < sizeof( CANDRV_tzCAN_ID ); ucByte++ )
+        {
+            ucFrameByte = pucId[ ucByte ];
+            if( ucByte == 0 )
+            {
+                ucFrameByte |= CANDRV_ID_MSK_IDE | CANDRV_ID_MSK_SRR;
+            }
+            if( ( ucFrameByte ^ pucHwId[ ucByte ] ) & ~pucHwMask[ ucByte ] )
+            {
+                break;
+            }
+        }
+        if( ucByte == sizeof( CANDRV_tzCAN_ID ) )
+        {
+            return( TRUE );
+        }
+    }
+    return( FALSE );
+}
+
+// Append one frame to the stream
+static void xbtbench_fnPutFrame( uint32 ulPgn,
+                                 uchar8 ucDest,
+                                 uchar8 ucSrc,
+                                 const uchar8 *pucData,
+                                 uchar8 ucLen )
+{
+    CANDRV_tzCAN_FRAME *ptzFrame;
+    uchar8 ucPF;
+
+    if( uiStreamLen >= XBTBENCH_FRAMES )
+    {
+        return;
+    }
+    ptzFrame = &atzStream[ uiStreamLen++ ];
+    memset( ptzFrame, 0, sizeof( *ptzFrame ) );
+
+    ucPF = (uchar8)( ulPgn >> 8 );
+    ptzFrame->tzCanId.ucId28_24 = (uchar8)( ( 6 << 2 ) | ( ( ulPgn >> 16 ) & 0x01 ) );
+    ptzFrame->tzCanId.ucId23_16 = ucPF;
+    ptzFrame->tzCanId.ucId15_8 = ( ucPF < 0xF0 ) ? ucDest : (uchar8)ulPgn;
+    ptzFrame->tzCanId.ucId07_00 = ucSrc;
+    ptzFrame->ucByteCount = ucLen;
+    memcpy( ptzFrame->aucData, pucData, ucLen );
+}
+
+/*
+    Build the stream: mostly broadcasts the node ignores, some requests
+    and address claims for every node, requests addressed to other nodes,
+    and fast-packet downloads addressed to the node under test
+*/
+static void xbtbench_fnMakeStream( void )
+{
+    uchar8 aucData[ CANDRV_MAX_BYTES ];
+    uint32 ulSeed = 12345;
+    uchar8 ucFpSeq = 0;
+    uchar8 ucFrame;
+    uchar8 ucKind;
+
+    memset( aucData, 0xFF, sizeof( aucData ) );
+    uiStreamLen = 0;
+    while( uiStreamLen < XBTBENCH_FRAMES )
+    {
+        ulSeed = ulSeed * 1103515245 + 12345;
+        ucKind = (uchar8)( ( ulSeed >> 16 ) % 20 );
+
+        if( ucKind < 12 )
+        {
+            // Status broadcast of another node
+            xbtbench_fnPutFrame( kaulBCAST_PGNS[ ( ulSeed >> 8 ) % DIM( kaulBCAST_PGNS ) ],
+                                 XBT_ADDR_GLOBAL, (uchar8)( 0x40 + ucKind ), aucData, 8 );
+        }
+        else if( ucKind < 15 )
+        {
+            // Request addressed to another node
+            aucData[ 0 ] = 0xEB;
+            aucData[ 1 ] = 0xFE;
+            aucData[ 2 ] = 0x00;
+            xbtbench_fnPutFrame( XB_PGN_ISO_REQ, 0x42, 0x41, aucData, 3 );
+        }
+        else if( ucKind < 17 )
+        {
+            // Global request, handled by every node
+            aucData[ 0 ] = 0x00;
+            aucData[ 1 ] = 0xEE;
+            aucData[ 2 ] = 0x00;
+            xbtbench_fnPutFrame( XB_PGN_ISO_REQ, XBT_ADDR_GLOBAL, 0x41, aucData, 3 );
+        }
+        else if( ucKind < 18 )
+        {
+            // Address claim of another node
+            xbtbench_fnPutFrame( XB_PGN_ISO_ADDR_CLAIM, XBT_ADDR_GLOBAL, 0x43, aucData, 8 );
+        }
+        else
+        {
+            // Three frame fast-packet message addressed to this node
+            for( ucFrame = 0; ucFrame < 3; ucFrame++ )
+            {
+                aucData[ 0 ] = (uchar8)( ucFpSeq | ucFrame );
+                aucData[ 1 ] = ( ucFrame == 0 ) ? 20 : 0;
+                xbtbench_fnPutFrame( XB_PGN_FILE_DNLD_INF, XBTBENCH_MY_ADDR,
+                                     XBTBENCH_DIAG_ADDR, aucData, 8 );
+            }
+            ucFpSeq = (uchar8)( ( ucFpSeq + 0x20 ) & 0xE0 );
+        }
+    }
+}
+
+// Monotonic clock in nanoseconds
+static double xbtbench_fnNs( void )
+{
+    struct timespec tzNow;
+
+    clock_gettime( CLOCK_MONOTONIC, &tzNow );
+    return( tzNow.tv_sec * 1e9 + tzNow.tv_nsec );
+}
+
+int main( void )
+{
+    XBT_tzMSG *ptzMsg;
+    uint16 uiReason;
+    uint32 ulRound;
+    uint32 ulAccepted = 0;
+    uint32 ulComplete = 0;
+    uint32 ulFound = 0;
+    uint32 ulHwRejected = 0;
+    uint32 ulPgn;
+    double dStart;
+    double dFrameNs;
+    double dLookupNs;
+
+    if( XBTFRAME_fnInit() != XBT_ERR_NO_ERROR || pfnRecvCb == NULL )
+    {
+        fprintf( stderr, "XBTFRAME_fnInit failed\n" );
+        return( 1 );
+    }
+    XBTADDR_fnBeginClaiming();
+    xbtbench_fnMakeStream();
+
+    // Receive interrupt and frame handling for every frame of the stream
+    dStart = xbtbench_fnNs();
+    for( ulRound = 0; ulRound < XBTBENCH_ROUNDS; ulRound++ )
+    {
+        for( uiStreamPos = 0; uiStreamPos < uiStreamLen; uiStreamPos++ )
+        {
+            // Dropped by the controller, no interrupt
+            if( !xbtbench_fnHwPass( &atzStream[ uiStreamPos ].tzCanId ) )
+            {
+                ulHwRejected++;
+                continue;
+            }
+            pfnRecvCb( 0 );
+            do
+            {
+                ptzMsg = XBTFRAME_fnRecvFrame( &uiReason );
+                if( uiReason != XBT_ERR_NO_DATA )
+                {
+                    ulAccepted++;
+                }
+                if( ptzMsg != NULL )
+                {
+                    ulComplete++;
+                    XBTMSG_fnReleaseMsg( ptzMsg );
+                }
+            } while( uiReason != XBT_ERR_NO_DATA );
+        }
+    }
+    dFrameNs = ( xbtbench_fnNs() - dStart ) / ( (double)XBTBENCH_ROUNDS * uiStreamLen );
+
+    // PGN support list lookup alone, for the PGN of every frame
+    dStart = xbtbench_fnNs();
+    for( ulRound = 0; ulRound < XBTBENCH_ROUNDS; ulRound++ )
+    {
+        for( uiStreamPos = 0; uiStreamPos < uiStreamLen; uiStreamPos++ )
+        {
+            ulPgn = ( (uint32)( atzStream[ uiStreamPos ].tzCanId.ucId28_24 & 0x01 ) << 16 )
+                  | ( (uint32)atzStream[ uiStreamPos ].tzCanId.ucId23_16 << 8 );
+            if( atzStream[ uiStreamPos ].tzCanId.ucId23_16 >= 0xF0 )
+            {
+                ulPgn |= atzStream[ uiStreamPos ].tzCanId.ucId15_8;
+            }
+            if( XBTMSG_fnLookupPgn( ulPgn ) != NULL )
+            {
+                ulFound++;
+            }
+        }
+    }
+    dLookupNs = ( xbtbench_fnNs() - dStart ) / ( (double)XBTBENCH_ROUNDS * uiStreamLen );
+
+    printf( "%u frames x %u rounds\n", uiStreamLen, XBTBENCH_ROUNDS );
+    printf( "hardware rejected: %lu\n", (unsigned long)( ulHwRejected / XBTBENCH_ROUNDS ) );
+    printf( "accepted frames:   %lu\n", (unsigned long)( ulAccepted / XBTBENCH_ROUNDS ) );
+    printf( "complete messages: %lu\n", (unsigned long)( ulComplete / XBTBENCH_ROUNDS ) );
+    printf( "supported PGNs:    %lu\n", (unsigned long)( ulFound / XBTBENCH_ROUNDS ) );
+    printf( "receive path:      %8.1f ns/frame\n", dFrameNs );
+    printf( "PGN lookup:        %8.1f ns/frame\n", dLookupNs );
+    return( 0 );
+}
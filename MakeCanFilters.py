@@ -0,0 +1,433 @@
+###############################################################################
+# (c) 2026 Xantrex Canada ULC. All rights reserved.
+# All trademarks are owned or licensed by Xantrex Canada ULC,
+# its subsidiaries or affiliated companies.
+#
+# FILE NAME:  MakeCanFilters.py
+#
+# PURPOSE:
+#     This is a program to generate the CAN acceptance filter tables loaded
+#     by the drivers under XanBus Tiny and the full XanBus stack.  It reads
+#     the PGN table of the stack and writes a C header holding the fewest
+#     (id, mask) filters that pass every frame the stack's own software
+#     filter (xbtframe_fnFilterRxFrame or PGNRTick) would accept, so the
+#     rest can be dropped by the CAN controller or the kernel instead.
+#
+#     Filters for PDU1 frames addressed to this node carry an OWN_ADDR
+#     flag; the driver fills in the address when it loads the table.  A
+#     node with a fixed address can pass --addr to get plain filters.
+#
+#     Filters are merged greedily: first every merge that accepts no extra
+#     frame, then, while there are more filters than the hardware has, the
+#     merge that lets the fewest unwanted frames through.  The software
+#     filter stays in place and drops whatever those let through.
+#
+#     Usage:  python3 MakeCanFilters.py {xbtiny|rvc} [--max N] [--addr A]
+#                                       [-o FILE]
+#
+###############################################################################
+
+###############################################################################
+#                               Includes
+###############################################################################
+
+import argparse
+import os
+import re
+import sys
+
+###############################################################################
+#                             Constant Data
+###############################################################################
+
+XANBUS_DIR = 'Code/Pkgs/Protocols/XanBus'
+XBTINY_DIR = 'Code/Pkgs/Protocols/XbTiny'
+
+# Per stack: PGN table, its table symbol, the headers defining the PGN
+# names, the generated file, its type prefix and the default filter limit
+STACKS = {
+    'xbtiny': {
+        'table': XBTINY_DIR + '/Src/xbtmsg.c',
+        'symbol': 'katzPGN_LIST',
+        'defines': [XBTINY_DIR + '/Inc/xbudefs.h'],
+        'output': XBTINY_DIR + '/Src/xbtfilt.h',
+        'prefix': 'XBT',
+        'max': 2,               # MSCAN has two acceptance filters
+    },
+    'rvc': {
+        'table': XANBUS_DIR + '/Devices/PROTOCOL_RVC/Src/rvcpgntbl.c',
+        'symbol': 'XB_katzALL_PGN_LIST',
+        'defines': [XANBUS_DIR + '/Inc/pgnudefs.h',
+                    XANBUS_DIR + '/Inc/rvcudefs.h',
+                    XANBUS_DIR + '/Inc/xbudefs.h'],
+        'output': XANBUS_DIR + '/Devices/PROTOCOL_RVC/Inc/rvcfilt.h',
+        'prefix': 'PGN',
+        'max': 512,             # CAN_RAW_FILTER_MAX
+    },
+}
+
+# PGNs the stacks treat specially
+PGN_ISO_TP_XFER = 0x00EB00
+PGN_ISO_ADDR_CLAIM = 0x00EE00
+
+# PGN info flags, see pgnudefs.h
+PGN_FLAG_RX = 0x0001
+PGN_FLAG_RX_IGN = 0x0400
+
+# A filter key is the 17 bits of the CAN id holding Data Page, PDU Format
+# and PDU Specific, which are CAN id bits 24 to 8.  Priority, the extended
+# data page bit and the source address are never matched.
+KEY_BITS = 17
+KEY_MASK = (1 << KEY_BITS) - 1
+KEY_SHIFT = 8
+PS_MASK = 0xFF
+ADDR_GLOBAL = 0xFF
+
+###############################################################################
+#                              Functions
+###############################################################################
+
+class clFilter:
+    """An acceptance filter over the key bits; 'own' means the PS byte must
+       be this node's address, which is not known until load time"""
+
+    def __init__(self, value, mask, own=False):
+        self.mask = mask & KEY_MASK
+        self.value = value & self.mask
+        self.own = own
+
+    def fnFreeBits(self):
+        return KEY_BITS - bin(self.mask).count('1') - (8 if self.own else 0)
+
+    def fnMatches(self, key):
+        return (key & self.mask) == self.value
+
+
+def fnReadDefines(paths):
+    """The numeric #defines of the given headers"""
+    defines = {}
+    pattern = re.compile(r'^\s*#define\s+(\w+)\s+\(?\s*(0[xX][0-9a-fA-F]+|\d+)[uUlL]*\s*\)?')
+
+    for path in paths:
+        with open(path, encoding='latin-1') as fp:
+            for line in fp:
+                match = pattern.match(line)
+                if match:
+                    defines[match.group(1)] = int(match.group(2), 0)
+
+    return defines
+
+
+def fnTableBody(path, symbol):
+    """The text between the braces of the named table, comments removed"""
+    with open(path, encoding='latin-1') as fp:
+        text = fp.read()
+
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+
+    match = re.search(r'\b' + symbol + r'\s*\[[^\]]*\]\s*=\s*\{(.*?)\n\s*\};',
+                      text, re.S)
+    if match is None:
+        sys.exit(f"{symbol} not found in {path}")
+
+    return match.group(1)
+
+
+def fnFlagValue(expr, defines):
+    value = 0
+    for name in expr.split('|'):
+        name = name.strip()
+        value |= defines[name] if name in defines else int(name, 0)
+    return value
+
+
+def fnXbTinyPgns(stack, defines):
+    """PGNs of the XbTiny table; every entry is received"""
+    body = fnTableBody(stack['table'], stack['symbol'])
+    return [defines[name] for name in re.findall(r'\{\s*(\w+)\s*,', body)]
+
+
+def fnRvcPgns(stack, defines):
+    """PGNs of the full stack table that PGNRTick does not ignore"""
+    body = fnTableBody(stack['table'], stack['symbol'])
+    entry = re.compile(r'\{\s*(\w+)\s*,\s*-?\w+\s*,\s*\w+\s*,\s*([\w\s|]+?)\s*,')
+    pgns = []
+
+    for name, flags in entry.findall(body):
+        value = fnFlagValue(flags, defines)
+        if (value & PGN_FLAG_RX) == 0 and (value & PGN_FLAG_RX_IGN) != 0:
+            continue
+        pgns.append(defines[name])
+
+    # Transfer frames are taken before the table is looked at
+    pgns.append(PGN_ISO_TP_XFER)
+    return pgns
+
+
+def fnInitialFilters(stack_name, pgns, addr):
+    """One exact filter per accepted destination of every PGN, and the
+       keys that must pass (concrete keys, and PGN keys for own address)"""
+    filters = []
+    keys = set()
+    own_keys = set()
+
+    def fnAddKey(key):
+        keys.add(key)
+        filters.append(clFilter(key, KEY_MASK))
+
+    def fnAddOwn(pgn):
+        if addr is None:
+            own_keys.add(pgn)
+            filters.append(clFilter(pgn, KEY_MASK & ~PS_MASK, own=True))
+        else:
+            fnAddKey(pgn | addr)
+
+    for pgn in sorted(set(p & KEY_MASK for p in pgns)):
+        pf = (pgn >> 8) & 0xFF
+
+        if pf >= 0xF0:
+            # PDU2: PS is part of the PGN
+            fnAddKey(pgn)
+        elif pgn == PGN_ISO_ADDR_CLAIM and stack_name == 'rvc':
+            # PGNRTick takes address claims to any destination
+            keys.update(pgn | ps for ps in range(256))
+            filters.append(clFilter(pgn, KEY_MASK & ~PS_MASK))
+        else:
+            # PDU1: global or this node, XbTiny also takes claims to zero
+            fnAddKey(pgn | ADDR_GLOBAL)
+            fnAddOwn(pgn)
+            if pgn == PGN_ISO_ADDR_CLAIM:
+                fnAddKey(pgn)
+
+    return filters, keys, own_keys
+
+
+def fnMerge(a, b):
+    """The smallest filter passing everything a and b pass"""
+    if a.own and b.own:
+        mask = a.mask & b.mask & ~(a.value ^ b.value)
+        return clFilter(a.value, mask, own=True)
+
+    # The own address could be any PS value once merged with a plain filter
+    a_mask = a.mask & ~PS_MASK if a.own else a.mask
+    b_mask = b.mask & ~PS_MASK if b.own else b.mask
+    mask = a_mask & b_mask & ~(a.value ^ b.value)
+    return clFilter(a.value, mask)
+
+
+def fnCover(filt):
+    """Bitmap of the keys a filter passes; own filters are over the key
+       bits above PS only, as the PS byte is always the own address"""
+    value, mask, bits = filt.value, filt.mask, KEY_BITS
+    if filt.own:
+        value, mask, bits = value >> 8, mask >> 8, KEY_BITS - 8
+
+    cover = 1 << value
+    for bit in range(bits):
+        if not (mask >> bit) & 1:
+            cover |= cover << (1 << bit)
+    return cover
+
+
+def fnIsWithin(a, b):
+    """Does b pass every frame a passes"""
+    if a.own and not b.own:
+        b_mask = b.mask & ~PS_MASK
+        if b.mask & PS_MASK:
+            return False
+    elif b.own and not a.own:
+        return False
+    else:
+        b_mask = b.mask
+
+    return (a.mask & b_mask) == b_mask and (a.value & b_mask) == b.value
+
+
+def fnIsAdjacent(a, b):
+    """Do a and b differ in just one matched bit, so that merging them
+       passes exactly what the two of them pass"""
+    diff = a.value ^ b.value
+    return (a.own == b.own and a.mask == b.mask
+            and diff != 0 and (diff & (diff - 1)) == 0)
+
+
+class clCoverage:
+    """The keys wanted and passed so far, to price a merge"""
+
+    def __init__(self, keys, own_keys):
+        self.wanted = sum(1 << key for key in keys)
+        self.own_wanted = sum(1 << (key >> 8) for key in own_keys)
+
+    def fnUpdate(self, filters):
+        self.passed = 0
+        self.own_passed = 0
+        for filt in filters:
+            if filt.own:
+                self.own_passed |= fnCover(filt)
+            else:
+                self.passed |= fnCover(filt)
+
+    def fnUnwanted(self):
+        return (bin(self.passed & ~self.wanted).count('1')
+                + bin(self.own_passed & ~self.own_wanted).count('1'))
+
+    def fnCost(self, merged):
+        """Number of unwanted keys the merged filter adds"""
+        if merged.own:
+            return bin(fnCover(merged) & ~self.own_wanted
+                       & ~self.own_passed).count('1')
+        return bin(fnCover(merged) & ~self.wanted & ~self.passed).count('1')
+
+
+def fnMergeExact(filters):
+    """Drop filters within others and join adjacent pairs"""
+    filters = list(filters)
+    merged_any = True
+
+    while merged_any:
+        merged_any = False
+        for i, a in enumerate(filters):
+            for j, b in enumerate(filters):
+                if i == j:
+                    continue
+                if fnIsWithin(a, b):
+                    del filters[i]
+                elif i < j and fnIsAdjacent(a, b):
+                    filters[i] = fnMerge(a, b)
+                    del filters[j]
+                else:
+                    continue
+                merged_any = True
+                break
+            if merged_any:
+                break
+
+    return filters
+
+
+def fnMergeLossy(filters, coverage, max_filters):
+    """Make the merge letting the fewest unwanted keys through until the
+       filters fit in max_filters"""
+    filters = list(filters)
+
+    while len(filters) > max_filters:
+        coverage.fnUpdate(filters)
+        best = None
+        for i in range(len(filters)):
+            for j in range(i + 1, len(filters)):
+                merged = fnMerge(filters[i], filters[j])
+                cost = (coverage.fnCost(merged), merged.fnFreeBits())
+                if best is None or cost < best[0]:
+                    best = (cost, i, j, merged)
+
+        _, i, j, merged = best
+        filters = [f for k, f in enumerate(filters) if k not in (i, j)]
+        filters = [f for f in filters if not fnIsWithin(f, merged)]
+        filters.append(merged)
+
+    coverage.fnUpdate(filters)
+    return filters, coverage.fnUnwanted()
+
+
+def fnReduce(filters, keys, own_keys, max_filters):
+    """The fewest filters passing every wanted key, merged lossily if need
+       be to fit in max_filters; returns them and the unwanted key count"""
+    coverage = clCoverage(keys, own_keys)
+    exact = fnMergeExact(filters)
+    filters, unwanted = fnMergeLossy(exact, coverage, max_filters)
+
+    # With few filters it can pay to stop matching PS on PDU1 PGNs at all,
+    # which bottom-up merging does not find by itself
+    if len(exact) > max_filters and any(f.own for f in exact):
+        anydest = [clFilter(f.value, f.mask & ~PS_MASK) if f.own else f
+                   for f in exact]
+        other, other_unwanted = fnMergeLossy(fnMergeExact(anydest), coverage,
+                                             max_filters)
+        if other_unwanted < unwanted:
+            filters, unwanted = other, other_unwanted
+
+    result = sorted(filters, key=lambda f: (f.own, f.value, f.mask))
+    return result, unwanted
+
+
+def fnWriteHeader(path, stack_name, stack, filters, pgn_count, extra, addr):
+    prefix = stack['prefix']
+    guard = os.path.basename(path).upper().replace('.', '_')
+    source = stack['table'].split('/')[-1]
+    lines = []
+
+    lines.append('/*=============================================================================')
+    lines.append('  (c) 2026 Xantrex Canada ULC. All rights reserved.')
+    lines.append('  All trademarks are owned or licensed by Xantrex Canada ULC,')
+    lines.append('  its subsidiaries or affiliated companies.')
+    lines.append('')
+    lines.append(f'FILE NAME:  {os.path.basename(path)}')
+    lines.append('')
+    lines.append('PURPOSE:')
+    lines.append(f'    CAN acceptance filters for the PGNs received from {source}.')
+    lines.append('    GENERATED by MakeCanFilters.py, do not edit; rerun it after')
+    lines.append('    changing the PGN table:')
+    args = stack_name + (f' --addr {addr}' if addr is not None else '')
+    lines.append(f'        python3 MakeCanFilters.py {args}')
+    lines.append('')
+    lines.append(f'    {pgn_count} PGNs in {len(filters)} filters, '
+                 f'passing {extra} unwanted id patterns')
+    lines.append('    (priority and source address aside).')
+    lines.append('')
+    lines.append('=============================================================================*/')
+    lines.append('')
+    lines.append(f'#ifndef {guard}')
+    lines.append(f'#define {guard}')
+    lines.append('')
+    lines.append(f'#define {prefix}_NUM_ACCEPT_FILTERS  ( {len(filters)} )')
+    lines.append('')
+    lines.append(f'static const {prefix}_tzACCEPT_FILTER '
+                 f'{prefix}_katzACCEPT_FILTERS[ {prefix}_NUM_ACCEPT_FILTERS ] =')
+    lines.append('{')
+    lines.append('    //  Id,           Mask,         Flags')
+    for filt in filters:
+        flags = f'{prefix}_FILTER_OWN_ADDR' if filt.own else '0'
+        mask = filt.mask | (PS_MASK if filt.own else 0)
+        lines.append(f'    {{ 0x{filt.value << KEY_SHIFT:08X}UL, '
+                     f'0x{mask << KEY_SHIFT:08X}UL, {flags} }},')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'#endif  // {guard}')
+
+    with open(path, 'w') as fp:
+        fp.write('\n'.join(lines) + '\n')
+
+
+# The main program starts here
+def fnMain():
+    parser = argparse.ArgumentParser(description='Generate CAN acceptance filters')
+    parser.add_argument('stack', choices=sorted(STACKS))
+    parser.add_argument('--max', type=int, help='most filters the target can hold')
+    parser.add_argument('--addr', type=lambda s: int(s, 0),
+                        help='fixed source address of this node')
+    parser.add_argument('-o', '--output', help='generated header')
+    args = parser.parse_args()
+
+    stack = STACKS[args.stack]
+    max_filters = args.max if args.max is not None else stack['max']
+    output = args.output if args.output is not None else stack['output']
+
+    defines = fnReadDefines(stack['defines'])
+    if args.stack == 'xbtiny':
+        pgns = fnXbTinyPgns(stack, defines)
+    else:
+        pgns = fnRvcPgns(stack, defines)
+
+    filters, keys, own_keys = fnInitialFilters(args.stack, pgns, args.addr)
+    filters, extra = fnReduce(filters, keys, own_keys, max_filters)
+
+    fnWriteHeader(output, args.stack, stack, filters, len(set(pgns)), extra,
+                  args.addr)
+
+    print(f"{len(set(pgns))} PGNs in {len(filters)} filters "
+          f"({extra} unwanted id patterns) written to {output}")
+
+
+if __name__ == '__main__':
+    fnMain()
@@ -0,0 +1,211 @@
+###############################################################################
+# (c) 2026 Xantrex Canada ULC. All rights reserved.
+# All trademarks are owned or licensed by Xantrex Canada ULC,
+# its subsidiaries or affiliated companies.
+#
+# FILE NAME:  ProfileBlobGen.py
+#
+# PURPOSE:
+#     This is program to generate the binary model profile file used by the
+#     rvccc bridge.  It reads the same tables of the parameter database as
+#     ParamListGen.py and writes them as sorted fixed-size records with an
+#     interned string table, which the bridge memory-maps and uses in place
+#     (see model_profile.h for the layout).  New models can then be shipped
+#     by regenerating this file, without rebuilding the bridge.
+#
+###############################################################################
+
+###############################################################################
+#                               Includes
+###############################################################################
+
+import sqlite3
+import struct
+import sys
+from PgDesc import clXbDatabase
+from ParamListGen import DB_FILE, fnQualList, fnReverseInterpretFmi
+
+###############################################################################
+#                             Constant Data
+###############################################################################
+
+# Generated file name
+BLOB_FILE = 'xnet_profiles.bin'
+
+# Must match PROFILE_BLOB_MAGIC / PROFILE_BLOB_VERSION in model_profile.h
+BLOB_MAGIC = b'XNETPRF\0'
+BLOB_VERSION = 1
+
+# Record layouts, see model_profile.h
+HEADER_FMT = '<8s12I'
+MODEL_FMT = '<10I'
+SPEC_FMT = '<6I'
+QUAL_FMT = '<2I'
+ALERT_FMT = '<5iI'
+
+###############################################################################
+#                              Functions
+###############################################################################
+
+class clStringTable:
+    """Interned NUL-terminated strings; offset 0 is the empty string"""
+
+    def __init__(self):
+        self.data = bytearray(b'\0')
+        self.offsets = {'': 0}
+
+    def fnIntern(self, text):
+        if text is None:
+            text = ''
+
+        if text not in self.offsets:
+            self.offsets[text] = len(self.data)
+            self.data += text.encode('utf-8') + b'\0'
+
+        return self.offsets[text]
+
+
+def fnSpecList(db, model_id, cmd):
+    """The PARAM_MAP (cmd False) or CMD_MAP (cmd True) rows of a model,
+       sorted by parameter name as the bridge binary-searches them"""
+    cursor = db.cursor()
+    if cmd:
+        cursor.execute("""select param.id, param.name, rvc_support.cmd_pgn, rvc_support.cmd_sig,
+                          rvc_support.to_cmd_trans_func
+                          from param inner join rvc_support
+                          on param.id = rvc_support.param_id
+                          where cmd_pgn is not null
+                          and rvc_support.model_id = ?;""",
+                       (model_id,))
+    else:
+        cursor.execute("""select param.id, param.name, rvc_support.sts_pgn, rvc_support.sts_sig,
+                          rvc_support.from_sts_trans_func
+                          from param inner join rvc_support
+                          on param.id = rvc_support.param_id
+                          where rvc_support.model_id = ?;""",
+                       (model_id,))
+
+    specs = [row for row in cursor.fetchall() if row[1]]
+    cursor.close()
+
+    specs.sort(key=lambda row: row[1].encode('utf-8'))
+
+    return specs
+
+
+def fnAlertList(db, xbdb, model_id, model_type, alert_type):
+    """SPN/FMI to alert code mapping of a model, as in ParamListGen.fnModelAlerts"""
+    if model_type == 'scc':
+        dsa = 141
+    elif model_type.startswith('inv'):
+        dsa = 66
+    else:
+        dsa = 255
+
+    alerts = []
+    cursor = db.cursor()
+    cursor.execute("""select rvc_alert_mapping.spn, rvc_alert_mapping.fmi,
+                      rvc_alert_mapping.code, alerts.condition
+                      from rvc_alert_mapping inner join alerts
+                      on rvc_alert_mapping.model_id = alerts.model_id
+                      and rvc_alert_mapping.code = alerts.code
+                      where rvc_alert_mapping.model_id = ?
+                      and rvc_alert_mapping.alert_type = ?;""",
+                   (model_id, alert_type))
+    for spn_name, fmi_name, code, condition in cursor.fetchall():
+        spn_msb, spn_isb, spn_lsb = xbdb.fnReverseInterpretSpn(dsa, spn_name)
+        fmi = fnReverseInterpretFmi(xbdb, fmi_name)
+        alerts.append((spn_msb, spn_isb, spn_lsb, fmi, code, condition))
+
+    cursor.close()
+
+    alerts.sort()
+    result = []
+    for spn_msb, spn_isb, spn_lsb, fmi, code, condition in alerts:
+        # Unused SPN bytes are stored as -1 (None in XnetParams.py)
+        if spn_msb != 0 and spn_isb == 0:
+            spn_isb = -1
+
+        result.append((spn_msb, spn_isb, spn_lsb, fmi, code, condition))
+
+    return result
+
+
+def fnGenerate(db, xbdb):
+    strings = clStringTable()
+    models = []
+    specs = []
+    quals = []
+    alerts = []
+
+    def fnAddSpecs(model_id, rows):
+        first = len(specs)
+        for param_id, param_name, pgn_mnem, sig_mnem, trans_func in rows:
+            qlist = fnQualList(db, param_id, model_id)
+            specs.append((strings.fnIntern(param_name), strings.fnIntern(pgn_mnem),
+                          strings.fnIntern(sig_mnem), strings.fnIntern(trans_func),
+                          len(quals), len(qlist)))
+            for sig, val in qlist:
+                quals.append((strings.fnIntern(sig), strings.fnIntern(val)))
+
+        return first, len(specs) - first
+
+    def fnAddAlerts(alert_list):
+        first = len(alerts)
+        for spn_msb, spn_isb, spn_lsb, fmi, code, condition in alert_list:
+            alerts.append((spn_msb, spn_isb, spn_lsb, fmi, code, strings.fnIntern(condition)))
+
+        return first, len(alerts) - first
+
+    # Same model selection as ParamListGen.py, sorted by name for lookup
+    cursor = db.cursor()
+    cursor.execute("""select distinct model.id, model.devtype, model.name
+                      from model inner join rvc_support
+                      on model.id = rvc_support.model_id""")
+    model_rows = sorted(cursor.fetchall(), key=lambda row: row[2].encode('utf-8'))
+    cursor.close()
+
+    for model_id, model_type, model_name in model_rows:
+        params = fnAddSpecs(model_id, fnSpecList(db, model_id, False))
+        cmds = fnAddSpecs(model_id, fnSpecList(db, model_id, True))
+        faults = fnAddAlerts(fnAlertList(db, xbdb, model_id, model_type, 'fault'))
+        warnings = fnAddAlerts(fnAlertList(db, xbdb, model_id, model_type, 'warning'))
+        models.append((strings.fnIntern(model_name), strings.fnIntern(model_type))
+                      + params + cmds + faults + warnings)
+
+    # Lay the tables out after the header, then the string table, padded to 4 bytes
+    body = bytearray()
+    offset = struct.calcsize(HEADER_FMT)
+    tables = []
+    for fmt, records in ((MODEL_FMT, models), (SPEC_FMT, specs), (QUAL_FMT, quals), (ALERT_FMT, alerts)):
+        tables += [offset + len(body), len(records)]
+        for record in records:
+            body += struct.pack(fmt, *record)
+
+    string_offset = offset + len(body)
+    body += strings.data
+    body += b'\0' * (-len(body) % 4)
+
+    size = offset + len(body)
+    header = struct.pack(HEADER_FMT, BLOB_MAGIC, BLOB_VERSION, size, *tables,
+                         string_offset, len(strings.data))
+
+    return header + body
+
+
+# The main program starts here
+def fnMain():
+    out_file = sys.argv[1] if len(sys.argv) > 1 else BLOB_FILE
+
+    db = sqlite3.Connection(DB_FILE)
+    blob = fnGenerate(db, clXbDatabase())
+    db.close()
+
+    with open(out_file, 'wb') as fp:
+        fp.write(blob)
+
+    print(f"Wrote {len(blob)} bytes to {out_file}")
+
+
+if __name__ == '__main__':
+    fnMain()
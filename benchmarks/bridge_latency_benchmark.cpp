@@ -0,0 +1,1047 @@
+// End-to-end latency of the rvccc bridge, from a frame on the CAN bus to the
+// decoded value on MQTT, and the bridge's CPU time per frame, at a series of
+// bus loads.
+//
+// The benchmark plays a population of simulated RV-C inverter/chargers on a
+// SocketCAN interface (vcan0 by default) or on the UDPCAN shim over
+// loopback, starts the bridge on the same bus and subscribes to its MQTT
+// output. Every node claims an address, answers the bridge's requests for
+// ProdIdent (by RTS/CTS when asked directly, else by BAM) and InstSts, sends
+// DM-RV once a second and broadcasts InvSts, ChgSts and DC/AC status PGNs,
+// which together make up the bus load.
+//
+// The inverter and charger states of each node change every -c ms, the
+// charger half a period after the inverter and the nodes staggered across
+// the period. The latency of a signal is the time from the first frame that
+// carries a new value to the MQTT message with it, measured for InvOpState,
+// ChgOpState and the OpState derived from them. The change period must be
+// longer than the publish filter's minimum interval per topic
+// (PUBLISH_MIN_INTERVAL_MS, doubled for OpState, which changes twice a
+// period), or the filter holds changes back and that shows up as latency.
+//
+// CPU per frame is the user and system time of the bridge over each load
+// step, from /proc/<pid>/stat, divided by the frames put on the bus. The
+// results are written as JSON.
+//
+// Build from the repository root with the defines and include paths of
+// big.sh, e.g.
+//   g++ -std=c++20 -O2 <big.sh -D and -I flags> -I. \
+//       benchmarks/bridge_latency_benchmark.cpp librvc.so -lmosquitto -o bridge_latency_benchmark
+//
+// Run it with an MQTT broker on localhost, e.g. on a vcan interface
+//   ip link add dev vcan0 type vcan && ip link set up vcan0
+//   bridge_latency_benchmark -l 200,1000,4000 -o latency.json -- ./my_program
+// or on loopback, where the bridge is pointed at the benchmark through
+// XB_UDPCAN_DEST and kept off SocketCAN
+//   bridge_latency_benchmark -u -- ./my_program
+//
+// Usage: bridge_latency_benchmark [options] [-- bridge command]
+//   -i IFACE   SocketCAN interface (vcan0)
+//   -u         UDPCAN shim on loopback instead of SocketCAN
+//   -n NODES   simulated devices, 1 to 64 (4)
+//   -l LOADS   comma-separated bus loads in frames/s (100,500,1000,2000)
+//   -t SECS    measuring time per load (20)
+//   -c MS      signal change period (2500)
+//   -m MODEL   inverter/charger model the devices report (FX-8182010)
+//   -b         answer every ProdIdent request by BAM
+//   -H HOST    MQTT broker (localhost)
+//   -p PORT    MQTT broker port (1883)
+//   -a PID     measure a bridge that is already running on the bus
+//   -o FILE    JSON output (stdout)
+// The bridge command is ./my_program unless given after --.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <linux/can.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <mosquitto.h>
+#include "json.hpp"
+#include "rvcudefs.h"
+#include "xbudefs.h"
+#include "xbgdefs.h"
+#include "pgnudefs.h"
+#include "cdrive.h"
+#include "socketcan.h"
+#include "udpcan.h"
+
+#define BENCH_HEAP_SIZE 32768
+#define BENCH_MAX_NODES 64
+#define BENCH_NODE_ADDR 0xA0            // address of the first node
+#define BENCH_DEVICE_FUNC "invchg"      // the bridge names the nodes invchg<instance>
+#define BENCH_MAKE "Xantrex"
+#define BENCH_MODEL "FX-8182010"
+#define BENCH_STS_TOPIC "xnet/sts/"
+
+#define BENCH_UDP_HOST "127.0.0.1"
+#define BENCH_UDP_PORT 22594            // the bridge's UDPCAN receive port
+#define BENCH_UDP_REPLY_PORT 22595      // where the bridge sends to
+#define BENCH_NO_CAN_DEVICE "none"      // no such interface, keeps the bridge off SocketCAN
+
+#define BENCH_DIAG_PERIOD_MS 1000       // DM-RV keeps a node from timing out
+#define BENCH_WARMUP_S 60               // limit on every node being published
+#define BENCH_SETTLE_MS 2000            // between load steps
+#define BENCH_STOP_MS 3000              // for the bridge to exit on SIGINT
+#define BENCH_SEND_BURST 64             // frames sent before looking at received ones
+
+#define TP_CM_RTS 16
+#define TP_CM_CTS 17
+#define TP_CM_EOM 19
+#define TP_CM_BAM 32
+#define TP_CM_ABORT 255
+
+using Clock = std::chrono::steady_clock;
+using json = nlohmann::json;
+
+struct Frame {
+    uint32 pgn = 0;
+    uchar8 prio = 6;
+    uchar8 src = PGN_ADDR_NULL;
+    uchar8 dst = PGN_ADDR_GLOBAL;
+    uchar8 len = 8;
+    uchar8 data[8] = {};
+};
+
+static void fnToCanData(const Frame& frame, CANDATA& can) {
+    can.m_u8Priority = frame.prio;
+    can.m_u8DataPage = (frame.pgn >> 16) & 0x01;
+    can.m_u8PF = (frame.pgn >> 8) & 0xff;
+    can.m_u8PS = can.m_u8PF < 240 ? frame.dst : frame.pgn & 0xff;
+    can.m_u8SA = frame.src;
+    std::memcpy(can.m_u8Data, frame.data, sizeof(can.m_u8Data));
+    can.m_u8DataByteCount = frame.len;
+}
+
+static void fnFromCanData(const CANDATA& can, Frame& frame) {
+    frame.prio = can.m_u8Priority;
+    frame.src = can.m_u8SA;
+    frame.pgn = (uint32)(can.m_u8DataPage & 0x01) << 16 | (uint32)can.m_u8PF << 8;
+    if (can.m_u8PF < 240) {
+        // PDU1: PS is the destination
+        frame.dst = can.m_u8PS;
+    } else {
+        frame.pgn |= can.m_u8PS;
+        frame.dst = PGN_ADDR_GLOBAL;
+    }
+    frame.len = std::min<uchar8>(can.m_u8DataByteCount, 8);
+    std::memcpy(frame.data, can.m_u8Data, sizeof(frame.data));
+}
+
+// The bus the nodes and the bridge share
+class Bus {
+public:
+    virtual ~Bus() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    virtual bool fnOpen() = 0;
+    virtual bool fnSend(const Frame& frame) = 0;
+    // False when nothing is waiting
+    virtual bool fnRecv(Frame& frame) = 0;
+    virtual std::string fnName() const = 0;
+
+    int fd = -1;
+};
+
+class SocketCanBus : public Bus {
+public:
+    explicit SocketCanBus(std::string iface) : iface(std::move(iface)) {}
+
+    bool fnOpen() override {
+        fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+        if (fd < 0) {
+            std::perror("CAN socket");
+            return false;
+        }
+        struct ifreq ifr {};
+        std::strncpy(ifr.ifr_name, iface.c_str(), IFNAMSIZ - 1);
+        if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+            std::perror(iface.c_str());
+            return false;
+        }
+        struct sockaddr_can addr {};
+        addr.can_family = AF_CAN;
+        addr.can_ifindex = ifr.ifr_ifindex;
+        if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+            std::perror("CAN bind");
+            return false;
+        }
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+        return true;
+    }
+
+    bool fnSend(const Frame& frame) override {
+        CANDATA can;
+        fnToCanData(frame, can);
+        struct can_frame out {};
+        out.can_id = CAN_EFF_FLAG | (uint32_t)(can.m_u8Priority & 0x07) << 26 | (uint32_t)can.m_u8DataPage << 24 |
+                     (uint32_t)can.m_u8PF << 16 | (uint32_t)can.m_u8PS << 8 | can.m_u8SA;
+        out.can_dlc = can.m_u8DataByteCount;
+        std::memcpy(out.data, can.m_u8Data, sizeof(out.data));
+        return write(fd, &out, sizeof(out)) == (ssize_t)sizeof(out);
+    }
+
+    bool fnRecv(Frame& frame) override {
+        struct can_frame in;
+        while (read(fd, &in, sizeof(in)) == (ssize_t)sizeof(in)) {
+            if (!(in.can_id & CAN_EFF_FLAG) || (in.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG))) {
+                continue;
+            }
+            CANDATA can;
+            can.m_u8Priority = (in.can_id >> 26) & 0x07;
+            can.m_u8DataPage = (in.can_id >> 24) & 0x01;
+            can.m_u8PF = (in.can_id >> 16) & 0xff;
+            can.m_u8PS = (in.can_id >> 8) & 0xff;
+            can.m_u8SA = in.can_id & 0xff;
+            can.m_u8DataByteCount = in.can_dlc;
+            std::memcpy(can.m_u8Data, in.data, sizeof(can.m_u8Data));
+            fnFromCanData(can, frame);
+            return true;
+        }
+        return false;
+    }
+
+    std::string fnName() const override {
+        return iface;
+    }
+
+private:
+    std::string iface;
+};
+
+// The datagrams of udpcan.c: a CANDATA and its 16-bit byte sum, big endian
+class UdpCanBus : public Bus {
+public:
+    bool fnOpen() override {
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0) {
+            std::perror("UDP socket");
+            return false;
+        }
+        struct sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(BENCH_UDP_REPLY_PORT);
+        addr.sin_addr.s_addr = inet_addr(BENCH_UDP_HOST);
+        if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+            std::perror("UDP bind");
+            return false;
+        }
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+        bridge.sin_family = AF_INET;
+        bridge.sin_port = htons(BENCH_UDP_PORT);
+        bridge.sin_addr.s_addr = inet_addr(BENCH_UDP_HOST);
+        return true;
+    }
+
+    bool fnSend(const Frame& frame) override {
+        uchar8 buf[sizeof(CANDATA) + 2];
+        CANDATA can;
+        fnToCanData(frame, can);
+        std::memcpy(buf, &can, sizeof(can));
+        uint16_t sum = 0;
+        for (std::size_t i = 0; i < sizeof(can); i++) {
+            sum += buf[i];
+        }
+        buf[sizeof(can)] = sum >> 8;
+        buf[sizeof(can) + 1] = sum & 0xff;
+        return sendto(fd, buf, sizeof(buf), 0, (struct sockaddr*)&bridge, sizeof(bridge)) == (ssize_t)sizeof(buf);
+    }
+
+    bool fnRecv(Frame& frame) override {
+        uchar8 buf[sizeof(CANDATA) + 2];
+        while (recv(fd, buf, sizeof(buf), 0) >= (ssize_t)sizeof(CANDATA)) {
+            CANDATA can;
+            std::memcpy(&can, buf, sizeof(can));
+            fnFromCanData(can, frame);
+            return true;
+        }
+        return false;
+    }
+
+    std::string fnName() const override {
+        return "udp:" BENCH_UDP_HOST;
+    }
+
+private:
+    struct sockaddr_in bridge {};
+};
+
+// Message bytes of a PGN structure, packed by the stack's own tables
+static bool fnPack(uint32 pgn, void* source, uint16 size, std::vector<uchar8>& out) {
+    const PGN_tzPGN_INFO* info = XBPACK_fnGetPgnInfo(pgn, (sint16)XB_eGRP_FUNC_VALUE_DO_NOT_CARE);
+    if (info == NULL || info->pktzDesc == NULL) {
+        return false;
+    }
+    uint16 len;
+    uchar8* buf = XBPACK_fnPackPgn(info->pktzDesc, source, size, &len);
+    if (buf == NULL) {
+        return false;
+    }
+    out.assign(buf, buf + len);
+    XBMEM_fnFree(buf);
+    return true;
+}
+
+enum Signal { SIG_INV_OP_STATE, SIG_CHG_OP_STATE, SIG_OP_STATE, SIG_COUNT };
+static const char* const SIGNAL_PARAMS[SIG_COUNT] = {"InvOpState", "ChgOpState", "OpState"};
+
+// A value change on its way to MQTT
+struct Change {
+    uint32 carrier = 0;             // PGN of the frames that carry it
+    Clock::time_point first_frame;  // first of them on the bus
+    bool on_bus = false;
+    bool pending = false;           // not published yet
+};
+
+struct SignalStats {
+    std::vector<double> us;
+    unsigned long changes = 0;
+    unsigned long missed = 0;       // superseded before being published
+};
+
+struct Node {
+    uchar8 addr = PGN_ADDR_NULL;
+    int inst = 0;
+    std::string name;               // the bridge's name for it
+    uchar8 short_name[PGN_NAME_LEN] = {};
+    std::string ident;              // ProdIdent, Make*Model*Serial*
+    RVC_teRVC_INV_STS inv = RVC_eRVC_INV_STS_INVERT;
+    RVC_teRVC_CHG_OP_STATE chg = RVC_eRVC_CHG_OP_STATE_NOT_CHARGING;
+    Clock::time_point next_inv;
+    Clock::time_point next_chg;
+    Clock::time_point next_diag;
+    Clock::time_point claimed;
+    bool online = false;            // published as online
+    bool published = false;         // InvOpState published at least once
+    std::array<Change, SIG_COUNT> changes;
+
+    // Multipacket transfer in progress
+    std::vector<uchar8> tp_data;
+    uint32 tp_pgn = 0;
+    uchar8 tp_dst = PGN_ADDR_NULL;
+};
+
+class Bench {
+public:
+    Bench(Bus& bus, unsigned int count, const std::string& model, bool bam_only)
+        : bus(bus), bam_only(bam_only), nodes(count) {
+        for (unsigned int i = 0; i < count; i++) {
+            Node& node = nodes[i];
+            node.addr = (uchar8)(BENCH_NODE_ADDR + i);
+            node.inst = (int)i + 1;
+            node.name = BENCH_DEVICE_FUNC + std::to_string(node.inst);
+            char serial[16];
+            std::snprintf(serial, sizeof(serial), "BENCH%04u", i + 1);
+            node.ident = std::string(BENCH_MAKE "*") + model + "*" + serial + "*";
+
+            XB_tzPGN_ISO_ADDR_CLAIM claim;
+            std::memset(&claim, 0, sizeof(claim));
+            claim.ulUniqueNumber = 0x2000 + i;
+            claim.ucDeviceInstanceLower = (uchar8)i;
+            claim.teDeviceFunction = XB_eFUNC_CODE_INVERTER;
+            claim.ucSelfCfgAddr = 1;
+            XBADDR_fnNAME2ShortNAME(&claim, node.short_name);
+
+            by_name[node.name] = i;
+        }
+    }
+
+    // Every node claims its address and starts its schedules
+    void fnStart(std::chrono::milliseconds change_period) {
+        Clock::time_point now = Clock::now();
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            Node& node = nodes[i];
+            Clock::duration offset = change_period * i / nodes.size();
+            node.next_inv = now + offset;
+            node.next_chg = now + offset + change_period / 2;
+            node.next_diag = now + std::chrono::milliseconds(BENCH_DIAG_PERIOD_MS) * i / nodes.size();
+            fnSendClaim(node);
+            node.claimed = Clock::now();
+        }
+        period = change_period;
+    }
+
+    // Run the bus at a load until the deadline, or until every node has been
+    // published when warming up
+    void fnRun(double load, Clock::time_point end, bool warmup) {
+        Clock::duration interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / load));
+        Clock::time_point next_frame = Clock::now();
+        std::size_t seq = 0;
+
+        while (Clock::now() < end) {
+            if (warmup && fnAllPublished()) {
+                return;
+            }
+            Clock::time_point now = Clock::now();
+            fnChanges(now);
+            fnDiag(now);
+
+            for (int burst = 0; next_frame <= now && burst < BENCH_SEND_BURST; burst++) {
+                fnSendStatus(nodes[seq % nodes.size()], seq / nodes.size());
+                seq++;
+                next_frame += interval;
+            }
+            // Fell behind by more than a burst: the load is beyond this host
+            if (next_frame + interval * BENCH_SEND_BURST < now) {
+                next_frame = now;
+            }
+
+            Frame frame;
+            while (bus.fnRecv(frame)) {
+                fnHandle(frame);
+            }
+
+            Clock::time_point wake = std::min({next_frame, end, fnNextEvent()});
+            now = Clock::now();
+            if (wake > now) {
+                struct pollfd pfd = {bus.fd, POLLIN, 0};
+                auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wake - now).count();
+                struct timespec ts = {(time_t)(ns / 1000000000), (long)(ns % 1000000000)};
+                ppoll(&pfd, 1, &ts, NULL);
+            }
+        }
+    }
+
+    // Counters and samples start over
+    void fnBeginStep() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (SignalStats& set : stats) {
+            set = SignalStats();
+        }
+        frames_sent = 0;
+        frames_received = 0;
+        measuring = true;
+    }
+
+    void fnEndStep() {
+        std::lock_guard<std::mutex> lock(mutex);
+        measuring = false;
+    }
+
+    // Called on the MQTT thread
+    void fnOnMessage(const std::string& topic, const std::string& payload, bool retained) {
+        Clock::time_point now = Clock::now();
+        if (retained || topic.compare(0, sizeof(BENCH_STS_TOPIC) - 1, BENCH_STS_TOPIC) != 0) {
+            return;
+        }
+        std::size_t slash = topic.find('/', sizeof(BENCH_STS_TOPIC) - 1);
+        if (slash == std::string::npos) {
+            return;
+        }
+        auto it = by_name.find(topic.substr(sizeof(BENCH_STS_TOPIC) - 1, slash - (sizeof(BENCH_STS_TOPIC) - 1)));
+        if (it == by_name.end()) {
+            return;
+        }
+        std::string param = topic.substr(slash + 1);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Node& node = nodes[it->second];
+        if (param == "status") {
+            if (payload == "online" && !node.online) {
+                node.online = true;
+                discovery_ms.push_back(std::chrono::duration<double, std::milli>(now - node.claimed).count());
+            }
+            return;
+        }
+        for (int sig = 0; sig < SIG_COUNT; sig++) {
+            if (param != SIGNAL_PARAMS[sig]) {
+                continue;
+            }
+            if (sig == SIG_INV_OP_STATE) {
+                node.published = true;
+            }
+            Change& change = node.changes[sig];
+            if (change.pending && change.on_bus) {
+                change.pending = false;
+                if (measuring) {
+                    stats[sig].us.push_back(std::chrono::duration<double, std::micro>(now - change.first_frame).count());
+                }
+            }
+        }
+    }
+
+    json fnStepJson() {
+        std::lock_guard<std::mutex> lock(mutex);
+        json signals = json::object();
+        for (int sig = 0; sig < SIG_COUNT; sig++) {
+            SignalStats& set = stats[sig];
+            json entry = fnSummary(set.us, "_us");
+            entry["changes"] = set.changes;
+            entry["missed"] = set.missed;
+            signals[SIGNAL_PARAMS[sig]] = entry;
+        }
+        return {{"frames", frames_sent}, {"bridge_frames", frames_received}, {"signals", signals}};
+    }
+
+    json fnDiscoveryJson() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return fnSummary(discovery_ms, "_ms");
+    }
+
+    bool fnAllPublished() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return std::all_of(nodes.begin(), nodes.end(), [](const Node& node) { return node.published; });
+    }
+
+private:
+    static json fnSummary(std::vector<double>& samples, const std::string& unit) {
+        json entry = {{"count", samples.size()}};
+        if (samples.empty()) {
+            return entry;
+        }
+        std::sort(samples.begin(), samples.end());
+        double sum = 0;
+        for (double sample : samples) {
+            sum += sample;
+        }
+        auto rank = [&](double p) { return samples[std::min(samples.size() - 1, (std::size_t)(p * samples.size()))]; };
+        entry["mean" + unit] = sum / samples.size();
+        entry["p50" + unit] = rank(0.50);
+        entry["p90" + unit] = rank(0.90);
+        entry["p99" + unit] = rank(0.99);
+        entry["max" + unit] = samples.back();
+        return entry;
+    }
+
+    Clock::time_point fnNextEvent() const {
+        Clock::time_point next = Clock::time_point::max();
+        for (const Node& node : nodes) {
+            next = std::min({next, node.next_inv, node.next_chg, node.next_diag});
+        }
+        return next;
+    }
+
+    bool fnSend(const Frame& frame) {
+        if (!bus.fnSend(frame)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        frames_sent++;
+        return true;
+    }
+
+    bool fnSendBytes(uint32 pgn, uchar8 src, uchar8 dst, uchar8 prio, const uchar8* data, std::size_t len) {
+        Frame frame;
+        frame.pgn = pgn;
+        frame.src = src;
+        frame.dst = dst;
+        frame.prio = prio;
+        frame.len = (uchar8)std::min<std::size_t>(len, 8);
+        std::memset(frame.data, 0xff, sizeof(frame.data));
+        std::memcpy(frame.data, data, frame.len);
+        return fnSend(frame);
+    }
+
+    void fnSendClaim(const Node& node) {
+        fnSendBytes(RVC_PGN_ISO_ADDR_CLAIM, node.addr, PGN_ADDR_GLOBAL, 6, node.short_name, PGN_NAME_LEN);
+    }
+
+    // OpState as the bridge derives it from the two states, for telling
+    // whether a change of either changes it
+    static int fnOpState(const Node& node) {
+        return node.chg == RVC_eRVC_CHG_OP_STATE_BULK ? -1 : (int)node.inv;
+    }
+
+    // Caller holds mutex
+    void fnOpenChange(Node& node, int sig, uint32 carrier) {
+        Change& change = node.changes[sig];
+        if (measuring) {
+            if (change.pending && change.on_bus) {
+                stats[sig].missed++;
+            }
+            stats[sig].changes++;
+        }
+        change.carrier = carrier;
+        change.on_bus = false;
+        change.pending = true;
+    }
+
+    void fnChanges(Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Node& node : nodes) {
+            if (now >= node.next_inv) {
+                int before = fnOpState(node);
+                node.inv = node.inv == RVC_eRVC_INV_STS_INVERT ? RVC_eRVC_INV_STS_AC_PASSTHRU : RVC_eRVC_INV_STS_INVERT;
+                fnOpenChange(node, SIG_INV_OP_STATE, RVC_PGN_INV_STS);
+                if (fnOpState(node) != before) {
+                    fnOpenChange(node, SIG_OP_STATE, RVC_PGN_INV_STS);
+                }
+                node.next_inv += period;
+            }
+            if (now >= node.next_chg) {
+                int before = fnOpState(node);
+                node.chg = node.chg == RVC_eRVC_CHG_OP_STATE_BULK ? RVC_eRVC_CHG_OP_STATE_NOT_CHARGING
+                                                                   : RVC_eRVC_CHG_OP_STATE_BULK;
+                fnOpenChange(node, SIG_CHG_OP_STATE, RVC_PGN_CHG_STS);
+                if (fnOpState(node) != before) {
+                    fnOpenChange(node, SIG_OP_STATE, RVC_PGN_CHG_STS);
+                }
+                node.next_chg += period;
+            }
+        }
+    }
+
+    void fnDiag(Clock::time_point now) {
+        for (Node& node : nodes) {
+            if (now >= node.next_diag) {
+                uchar8 data[8];
+                std::memset(data, 0xff, sizeof(data));
+                data[0] = 0x05;     // operating status: on, active
+                fnSendBytes(RVC_PGN_DIAG_MSG1, node.addr, PGN_ADDR_GLOBAL, 6, data, sizeof(data));
+                node.next_diag += std::chrono::milliseconds(BENCH_DIAG_PERIOD_MS);
+            }
+        }
+    }
+
+    // The nth status frame of a node; InvSts and ChgSts carry the measured
+    // signals, the DC and AC status only add load
+    void fnSendStatus(Node& node, std::size_t n) {
+        static const uint32 STATUS_PGNS[] = {RVC_PGN_INV_STS, RVC_PGN_CHG_STS, RVC_PGN_DC_SRC_STS1,
+                                             RVC_PGN_INV_AC_STS1, RVC_PGN_CHG_AC_STS1};
+        uint32 pgn = STATUS_PGNS[n % (sizeof(STATUS_PGNS) / sizeof(STATUS_PGNS[0]))];
+        std::vector<uchar8> data;
+
+        if (pgn == RVC_PGN_INV_STS) {
+            RVC_tzPGN_INV_STS sts;
+            sts.ucInst = (uchar8)node.inst;
+            sts.teSts = node.inv;
+            sts.teBattTempSensPres = RVC_eGENERIC_STSPAIR_OFF;
+            sts.teLoadSenseEn = RVC_eGENERIC_STSPAIR_OFF;
+            sts.teInverterEn = RVC_eGENERIC_STSPAIR_ON;
+            sts.tePassthruEn = RVC_eGENERIC_STSPAIR_ON;
+            sts.teGenSupportEn = RVC_eGENERIC_STSPAIR_OFF;
+            fnPack(pgn, &sts, sizeof(sts), data);
+        } else if (pgn == RVC_PGN_CHG_STS) {
+            RVC_tzPGN_CHG_STS sts;
+            sts.ucInst = (uchar8)node.inst;
+            sts.uiChgV = 1380;      // 13.8 V
+            sts.uiChgI = 32000 + 200;
+            sts.ucChgIPerMax = 40;
+            sts.teOpState = node.chg;
+            sts.teDefltStatePwrUp = RVC_eCMD_PAIR_ON;
+            sts.teAutoReChgEn = RVC_eCMD_PAIR_ON;
+            sts.teForceChg = RVC_eRVC_FORCE_CHG_CHARGING_NOT_FORCED;
+            fnPack(pgn, &sts, sizeof(sts), data);
+        } else {
+            // Instance, then readings the bridge is not subscribed to
+            data.assign(8, 0xff);
+            data[0] = (uchar8)node.inst;
+            data[2] = (uchar8)n;
+            data[3] = 0x32;
+        }
+        if (data.empty()) {
+            return;
+        }
+
+        Frame frame;
+        frame.pgn = pgn;
+        frame.src = node.addr;
+        frame.len = (uchar8)std::min<std::size_t>(data.size(), 8);
+        std::memcpy(frame.data, data.data(), frame.len);
+        if (!bus.fnSend(frame)) {
+            return;
+        }
+
+        Clock::time_point sent = Clock::now();
+        std::lock_guard<std::mutex> lock(mutex);
+        frames_sent++;
+        for (Change& change : node.changes) {
+            if (change.pending && !change.on_bus && change.carrier == pgn) {
+                change.first_frame = sent;
+                change.on_bus = true;
+            }
+        }
+    }
+
+    // A multipacket message from a node, by BAM or by RTS/CTS to dst
+    void fnSendMultipacket(Node& node, uint32 pgn, const std::vector<uchar8>& data, uchar8 dst) {
+        uchar8 packets = (uchar8)((data.size() + 6) / 7);
+        uchar8 cm[8] = {dst == PGN_ADDR_GLOBAL ? (uchar8)TP_CM_BAM : (uchar8)TP_CM_RTS,
+                        (uchar8)data.size(), (uchar8)(data.size() >> 8), packets, 0xff,
+                        (uchar8)pgn, (uchar8)(pgn >> 8), (uchar8)(pgn >> 16)};
+        node.tp_data = data;
+        node.tp_pgn = pgn;
+        node.tp_dst = dst;
+        fnSendBytes(RVC_PGN_ISO_TP_CONN_MAN, node.addr, dst, 7, cm, sizeof(cm));
+        if (dst == PGN_ADDR_GLOBAL) {
+            fnSendPackets(node, 1, packets);
+            node.tp_data.clear();
+        }
+    }
+
+    void fnSendPackets(Node& node, unsigned int first, unsigned int count) {
+        for (unsigned int seq = first; seq < first + count; seq++) {
+            uchar8 dt[8];
+            std::memset(dt, 0xff, sizeof(dt));
+            dt[0] = (uchar8)seq;
+            for (std::size_t i = 0; i < 7 && (seq - 1) * 7 + i < node.tp_data.size(); i++) {
+                dt[1 + i] = node.tp_data[(seq - 1) * 7 + i];
+            }
+            fnSendBytes(RVC_PGN_ISO_TP_XFER, node.addr, node.tp_dst, 7, dt, sizeof(dt));
+        }
+    }
+
+    void fnSendIdent(Node& node, uchar8 requester) {
+        std::vector<RVC_tzPGN_EXTRA_PROD_IDENT> extra(node.ident.size());
+        for (std::size_t i = 0; i < node.ident.size(); i++) {
+            extra[i].ucData = (uchar8)node.ident[i];
+        }
+        RVC_tzPGN_PROD_IDENT ident;
+        ident.uiExtraCount = (uint16)extra.size();
+        ident.ptzExtra = extra.data();
+        std::vector<uchar8> data;
+        if (fnPack(RVC_PGN_PROD_IDENT, &ident, sizeof(ident), data)) {
+            fnSendMultipacket(node, RVC_PGN_PROD_IDENT, data, bam_only ? PGN_ADDR_GLOBAL : requester);
+        }
+    }
+
+    void fnSendInstSts(Node& node, uchar8 requester) {
+        RVC_tzPGN_INST_STS sts;
+        sts.teDevType = RVC_eDFLT_SRC_ADDR_INVERTER;
+        sts.ucBaseInst = (uchar8)node.inst;
+        sts.ucMaxInst = (uchar8)node.inst;
+        sts.uiBaseIntAddr = 0;
+        sts.uiMaxIntAddr = 0;
+        std::vector<uchar8> data;
+        if (fnPack(RVC_PGN_INST_STS, &sts, sizeof(sts), data)) {
+            fnSendBytes(RVC_PGN_INST_STS, node.addr, requester, 6, data.data(), data.size());
+        }
+    }
+
+    Node* fnFindNode(uchar8 addr) {
+        if (addr < BENCH_NODE_ADDR || addr >= BENCH_NODE_ADDR + nodes.size()) {
+            return nullptr;
+        }
+        return &nodes[addr - BENCH_NODE_ADDR];
+    }
+
+    // A frame from the bridge
+    void fnHandle(const Frame& frame) {
+        if (fnFindNode(frame.src) != nullptr) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            frames_received++;
+        }
+
+        if (frame.pgn == RVC_PGN_ISO_REQ && frame.len >= 3) {
+            uint32 pgn = (uint32)frame.data[0] | (uint32)frame.data[1] << 8 | (uint32)frame.data[2] << 16;
+            for (Node& node : nodes) {
+                if (frame.dst != PGN_ADDR_GLOBAL && frame.dst != node.addr) {
+                    continue;
+                }
+                if (pgn == RVC_PGN_ISO_ADDR_CLAIM) {
+                    fnSendClaim(node);
+                } else if (pgn == RVC_PGN_PROD_IDENT) {
+                    fnSendIdent(node, frame.dst == PGN_ADDR_GLOBAL ? PGN_ADDR_GLOBAL : frame.src);
+                } else if (pgn == RVC_PGN_INST_STS) {
+                    fnSendInstSts(node, frame.src);
+                }
+            }
+        } else if (frame.pgn == RVC_PGN_ISO_TP_CONN_MAN) {
+            Node* node = fnFindNode(frame.dst);
+            if (node == nullptr || node->tp_data.empty() || node->tp_dst != frame.src) {
+                return;
+            }
+            if (frame.data[0] == TP_CM_CTS) {
+                fnSendPackets(*node, frame.data[2], frame.data[1]);
+            } else if (frame.data[0] == TP_CM_EOM || frame.data[0] == TP_CM_ABORT) {
+                node->tp_data.clear();
+            }
+        }
+    }
+
+    Bus& bus;
+    bool bam_only;
+    std::vector<Node> nodes;
+    std::unordered_map<std::string, std::size_t> by_name;
+    std::chrono::milliseconds period{0};
+
+    // Shared with the MQTT thread
+    std::mutex mutex;
+    bool measuring = false;
+    std::array<SignalStats, SIG_COUNT> stats;
+    std::vector<double> discovery_ms;
+    unsigned long frames_sent = 0;
+    unsigned long frames_received = 0;
+};
+
+static void fnOnMessage(struct mosquitto*, void* obj, const struct mosquitto_message* msg) {
+    std::string payload((const char*)msg->payload, msg->payloadlen);
+    static_cast<Bench*>(obj)->fnOnMessage(msg->topic, payload, msg->retain);
+}
+
+// User and system time of a process in ns, -1 if it cannot be read
+static double fnCpuNs(pid_t pid) {
+    std::ifstream stat("/proc/" + std::to_string(pid) + "/stat");
+    std::string line;
+    if (!std::getline(stat, line)) {
+        return -1;
+    }
+    // Fields after the command name, which may hold spaces; utime and stime
+    // are fields 14 and 15
+    std::size_t paren = line.rfind(')');
+    if (paren == std::string::npos) {
+        return -1;
+    }
+    unsigned long long utime, stime;
+    if (std::sscanf(line.c_str() + paren + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu",
+                    &utime, &stime) != 2) {
+        return -1;
+    }
+    return (double)(utime + stime) * 1e9 / sysconf(_SC_CLK_TCK);
+}
+
+// The bridge on the benchmark's bus, its chatter on stdout discarded
+static pid_t fnStartBridge(char* const argv[], bool udp, const std::string& iface) {
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (udp) {
+            std::string dest = BENCH_UDP_HOST ":" + std::to_string(BENCH_UDP_REPLY_PORT);
+            setenv(UDPCAN_DEST_ENV, dest.c_str(), 1);
+            setenv(SOCKETCAN_DEVICE_ENV, BENCH_NO_CAN_DEVICE, 1);
+        } else {
+            setenv(SOCKETCAN_DEVICE_ENV, iface.c_str(), 1);
+        }
+        int null = open("/dev/null", O_WRONLY);
+        if (null >= 0) {
+            dup2(null, STDOUT_FILENO);
+        }
+        execvp(argv[0], argv);
+        std::perror(argv[0]);
+        _exit(127);
+    }
+    if (pid < 0) {
+        std::perror("fork");
+    }
+    return pid;
+}
+
+static bool fnRunning(pid_t pid) {
+    int status;
+    return waitpid(pid, &status, WNOHANG) == 0;
+}
+
+static void fnStopBridge(pid_t pid) {
+    kill(pid, SIGINT);
+    Clock::time_point end = Clock::now() + std::chrono::milliseconds(BENCH_STOP_MS);
+    while (Clock::now() < end) {
+        if (!fnRunning(pid)) {
+            return;
+        }
+        usleep(10000);
+    }
+    kill(pid, SIGKILL);
+    waitpid(pid, NULL, 0);
+}
+
+static bool fnParseLoads(const char* text, std::vector<double>& loads) {
+    loads.clear();
+    std::string list(text);
+    std::size_t pos = 0;
+    while (pos <= list.size()) {
+        std::size_t comma = list.find(',', pos);
+        std::string item = list.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        char* end;
+        double load = std::strtod(item.c_str(), &end);
+        if (item.empty() || *end != '\0' || load <= 0) {
+            return false;
+        }
+        loads.push_back(load);
+        if (comma == std::string::npos) {
+            break;
+        }
+        pos = comma + 1;
+    }
+    return !loads.empty();
+}
+
+static void fnUsage(const char* prog) {
+    std::fprintf(stderr,
+                 "usage: %s [-i iface | -u] [-n nodes] [-l loads] [-t seconds] [-c change ms] [-m model] [-b]\n"
+                 "       [-H host] [-p port] [-a pid] [-o file] [-- bridge command]\n",
+                 prog);
+}
+
+int main(int argc, char* argv[]) {
+    std::string iface = "vcan0";
+    bool udp = false;
+    unsigned int count = 4;
+    std::vector<double> loads = {100, 500, 1000, 2000};
+    unsigned int seconds = 20;
+    unsigned int change_ms = 2500;
+    std::string model = BENCH_MODEL;
+    bool bam_only = false;
+    std::string host = "localhost";
+    int port = 1883;
+    pid_t pid = 0;
+    const char* output = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:un:l:t:c:m:bH:p:a:o:")) != -1) {
+        switch (opt) {
+        case 'i': iface = optarg; break;
+        case 'u': udp = true; break;
+        case 'n': count = (unsigned int)std::strtoul(optarg, NULL, 0); break;
+        case 'l':
+            if (!fnParseLoads(optarg, loads)) {
+                std::fprintf(stderr, "bad load list %s\n", optarg);
+                return 2;
+            }
+            break;
+        case 't': seconds = (unsigned int)std::strtoul(optarg, NULL, 0); break;
+        case 'c': change_ms = (unsigned int)std::strtoul(optarg, NULL, 0); break;
+        case 'm': model = optarg; break;
+        case 'b': bam_only = true; break;
+        case 'H': host = optarg; break;
+        case 'p': port = std::atoi(optarg); break;
+        case 'a': pid = (pid_t)std::atoi(optarg); break;
+        case 'o': output = optarg; break;
+        default:
+            fnUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (count == 0 || count > BENCH_MAX_NODES || seconds == 0 || change_ms == 0) {
+        std::fprintf(stderr, "nodes must be 1 to %d, seconds and change period above 0\n", BENCH_MAX_NODES);
+        return 2;
+    }
+    static char default_bridge[] = "./my_program";
+    char* default_argv[] = {default_bridge, NULL};
+    char** bridge_argv = optind < argc ? argv + optind : default_argv;
+
+    if (XBMEM_fnCtor(std::malloc(BENCH_HEAP_SIZE), BENCH_HEAP_SIZE) != TRUE) {
+        std::fprintf(stderr, "XBMEM_fnCtor failed\n");
+        return 1;
+    }
+
+    std::unique_ptr<Bus> bus;
+    if (udp) {
+        bus = std::make_unique<UdpCanBus>();
+    } else {
+        bus = std::make_unique<SocketCanBus>(iface);
+    }
+    if (!bus->fnOpen()) {
+        return 1;
+    }
+    Bench bench(*bus, count, model, bam_only);
+
+    mosquitto_lib_init();
+    struct mosquitto* mosq = mosquitto_new(NULL, true, &bench);
+    if (mosq == NULL) {
+        std::fprintf(stderr, "mosquitto_new failed\n");
+        return 1;
+    }
+    mosquitto_message_callback_set(mosq, fnOnMessage);
+    if (mosquitto_connect(mosq, host.c_str(), port, 30) != MOSQ_ERR_SUCCESS) {
+        std::fprintf(stderr, "cannot connect to the MQTT broker at %s:%d\n", host.c_str(), port);
+        return 1;
+    }
+    mosquitto_subscribe(mosq, NULL, BENCH_STS_TOPIC "#", 0);
+    mosquitto_loop_start(mosq);
+
+    bool started = pid == 0;
+    if (started) {
+        pid = fnStartBridge(bridge_argv, udp, iface);
+        if (pid < 0) {
+            return 1;
+        }
+    }
+
+    // The bridge has to find the nodes, ask for their identity and instance
+    // and subscribe before anything it publishes can be measured
+    bench.fnStart(std::chrono::milliseconds(change_ms));
+    bench.fnRun(loads.front(), Clock::now() + std::chrono::seconds(BENCH_WARMUP_S), true);
+    int rc = 0;
+    json steps = json::array();
+    if (!bench.fnAllPublished()) {
+        std::fprintf(stderr, "the bridge did not publish every node within %d s\n", BENCH_WARMUP_S);
+        rc = 1;
+    } else if (started && !fnRunning(pid)) {
+        std::fprintf(stderr, "the bridge exited\n");
+        rc = 1;
+    }
+
+    for (std::size_t i = 0; rc == 0 && i < loads.size(); i++) {
+        bench.fnRun(loads[i], Clock::now() + std::chrono::milliseconds(BENCH_SETTLE_MS), false);
+
+        bench.fnBeginStep();
+        double cpu_start = fnCpuNs(pid);
+        Clock::time_point start = Clock::now();
+        bench.fnRun(loads[i], start + std::chrono::seconds(seconds), false);
+        double cpu_end = fnCpuNs(pid);
+        double wall_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        bench.fnEndStep();
+
+        json step = bench.fnStepJson();
+        unsigned long frames = step["frames"];
+        step["target_frames_per_s"] = loads[i];
+        step["frames_per_s"] = frames * 1e9 / wall_ns;
+        if (cpu_start >= 0 && cpu_end >= 0) {
+            step["cpu_ns_per_frame"] = frames ? (cpu_end - cpu_start) / frames : 0;
+            step["cpu_percent"] = (cpu_end - cpu_start) * 100 / wall_ns;
+        } else {
+            step["cpu_ns_per_frame"] = nullptr;
+            step["cpu_percent"] = nullptr;
+        }
+        steps.push_back(step);
+        std::fprintf(stderr, "%.0f frames/s: %.0f sent/s\n", loads[i], frames * 1e9 / wall_ns);
+
+        if (started && !fnRunning(pid)) {
+            std::fprintf(stderr, "the bridge exited\n");
+            rc = 1;
+        }
+    }
+
+    json result = {
+        {"benchmark", "bridge_latency"},
+        {"bus", bus->fnName()},
+        {"nodes", count},
+        {"model", model},
+        {"change_period_ms", change_ms},
+        {"seconds_per_load", seconds},
+        {"discovery", bench.fnDiscoveryJson()},
+        {"loads", steps},
+    };
+
+    if (started && fnRunning(pid)) {
+        fnStopBridge(pid);
+    }
+    mosquitto_disconnect(mosq);
+    mosquitto_loop_stop(mosq, true);
+    mosquitto_destroy(mosq);
+    mosquitto_lib_cleanup();
+
+    if (output != NULL) {
+        std::ofstream file(output);
+        file << result.dump(2) << '\n';
+        if (!file) {
+            std::perror(output);
+            return 1;
+        }
+    } else {
+        std::printf("%s\n", result.dump(2).c_str());
+    }
+    return rc;
+}
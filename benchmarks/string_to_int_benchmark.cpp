@@ -0,0 +1,115 @@
+// Micro-benchmark of MessageBase::stringToInt over the command vocabulary of
+// XnetParams.h, against the former stoll/stold implementation.
+//
+// Build from the repository root with the defines and include paths of
+// big.sh, e.g.
+//   g++ -std=c++20 -O2 <big.sh -D and -I flags> -I. \
+//       benchmarks/string_to_int_benchmark.cpp print_functions3/*.cpp librvc.so -o string_to_int_benchmark
+
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "XnetParams.h"
+#include "print_functions3.h"
+
+// The implementation this replaced, without its console output
+static bool fnLegacyIsInteger(const std::string& str) {
+    try {
+        std::size_t pos;
+        std::stoll(str, &pos);
+        return pos == str.size();
+    } catch (std::invalid_argument&) {
+        return false;
+    } catch (std::out_of_range&) {
+        return false;
+    }
+}
+
+static uint32 fnLegacyStringToInt(const std::string& buffer, uint32 noDataValue, uint32 outOfRangeValue, uint32 reservedValue, long double scale = 1, long double offset = 0) {
+    if (fnLegacyIsInteger(buffer)) return std::stoll(buffer);
+    else if (buffer == "No Data") {
+        return noDataValue;
+    } else if (buffer == "Out of range") {
+        return outOfRangeValue;
+    } else if (buffer == "Reserved") {
+        return reservedValue;
+    } else {
+        std::string numericPart = buffer.substr(0, buffer.find(' '));
+        try {
+            long double value = std::stold(numericPart);
+            value /= scale;
+            value -= offset;
+            return (uint32)(value+0.5);
+        } catch (const std::invalid_argument&) {
+        } catch (const std::out_of_range&) {
+        }
+    }
+    return 0xFFFFFFFF;
+}
+
+// Qualifier values of every command of every model, plus the payload shapes
+// a command carries: integers, decimals with units and the sentinels, and
+// the edge cases where from_chars and stoll/stold read differently: blanks,
+// signs and hex
+static std::vector<std::string> fnVocabulary() {
+    std::vector<std::string> words;
+    for (const char* edge : {" 12", "\t12", "\n12", "+12", "+-12", "12 ", " 12.5", "\t12.5", "+12.5 V",
+                             "12.5V", "0x10", "0X1a", "0x1p3", "0x.8", "0x", "0xg", "--5", "-+5", "1e3", "1e",
+                             "", " ", "abc"}) {
+        words.push_back(edge);
+    }
+    for (const auto& [model_name, model] : MODEL_MAP) {
+        for (const auto& [param, cmd] : std::get<2>(model)) {
+            for (const auto& [sig, value] : std::get<2>(cmd)) {
+                words.push_back(value);
+            }
+            for (const char* payload : {"12", "-40", "13.6 V", "120.0 Vac", "0.5", "No Data", "Out of range", "Reserved"}) {
+                words.push_back(payload);
+            }
+        }
+    }
+    return words;
+}
+
+template <typename Fn>
+static double fnTimeNs(const std::vector<std::string>& words, int rounds, uint64_t& checksum, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const std::string& word : words) {
+            checksum += fn(word);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / ((double)rounds * words.size());
+}
+
+int main() {
+    std::vector<std::string> words = fnVocabulary();
+    ProdIdent msg;
+
+    int mismatches = 0;
+    for (const std::string& word : words) {
+        if (msg.isInteger(word) != fnLegacyIsInteger(word)
+                || msg.stringToInt(word, 0xff, 0xfe, 0xfd, 0.05, 0) != fnLegacyStringToInt(word, 0xff, 0xfe, 0xfd, 0.05, 0)) {
+            std::printf("mismatch: \"%s\"\n", word.c_str());
+            mismatches++;
+        }
+    }
+
+    const int rounds = 200;
+    uint64_t legacy_sum = 0;
+    uint64_t sum = 0;
+    double legacy_ns = fnTimeNs(words, rounds, legacy_sum, [](const std::string& word) {
+        return fnLegacyStringToInt(word, 0xff, 0xfe, 0xfd, 0.05, 0);
+    });
+    double ns = fnTimeNs(words, rounds, sum, [&msg](const std::string& word) {
+        return msg.stringToInt(word, 0xff, 0xfe, 0xfd, 0.05, 0);
+    });
+
+    std::printf("%zu words, %d mismatches\n", words.size(), mismatches);
+    std::printf("stoll/stold: %8.1f ns/call\n", legacy_ns);
+    std::printf("from_chars:  %8.1f ns/call (%.1fx)\n", ns, legacy_ns / ns);
+    return mismatches != 0 || sum != legacy_sum;
+}
@@ -1,5 +1,45 @@
 #g++ -std=c++17 -pthread -Wno-psabi -o my_program rvccc.cpp -g -D_32BIT_ARCHITECTURE="" -DXT_FAR="" -DXT_LITTLE_ENDIAN="" -DNO_APOX="" -DNO_CANCARDX="" -DNO_CANUSB="" -DNO_XANBR="" -DDEVICE_CLAIM_PGN=RVC_PGN_DIAG_MSG1 -ICode/Pkgs/Protocols/XanBus/Inc -ICode/Inc -ICode/Pkgs/Protocols/XanBus/Common/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Devices/PROTOCOL_RVC/Inc librvc.so -lmosquitto
-g++ -march=armv6 -mfpu=vfp -mfloat-abi=hard -marm -std=c++17 -pthread -Wno-psabi -o my_program rvccc.cpp -g -D_32BIT_ARCHITECTURE="" -DXT_FAR="" -DXT_LITTLE_ENDIAN="" -DNO_APOX="" -DNO_CANCARDX="" -DNO_CANUSB="" -DNO_XANBR="" -DDEVICE_CLAIM_PGN=RVC_PGN_DIAG_MSG1 -Icpp_redis/includes -ICode/Pkgs/Protocols/XanBus/Inc -ICode/Inc -ICode/Pkgs/Protocols/XanBus/Common/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Devices/PROTOCOL_RVC/Inc -lstdc++ -lpthread -lm  -ldl -lc librvc.so -lmosquitto -I./cpp_redis/includes -L./cpp_redis/build/lib -I./cpp_redis/tacopie/includes cpp_redis/build/lib/libcpp_redis.so cpp_redis/build/lib/libtacopie.so
+CXXFLAGS="-march=armv6 -mfpu=vfp -mfloat-abi=hard -marm -std=c++20 -pthread -Wno-psabi -g -D_32BIT_ARCHITECTURE= -DXT_FAR= -DXT_LITTLE_ENDIAN= -DNO_APOX= -DNO_CANCARDX= -DNO_CANUSB= -DNO_XANBR= -DDEVICE_CLAIM_PGN=RVC_PGN_DIAG_MSG1 -ICode/Pkgs/Protocols/XanBus/Inc -ICode/Inc -ICode/Pkgs/Protocols/XanBus/Common/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Devices/PROTOCOL_RVC/Inc -I."
+
+# Generated message classes, one object per family; only the families whose
+# source or any header it includes changed are rebuilt, in parallel. The
+# headers come from the dependency file g++ -MMD -MP writes next to the object.
+stale() {
+    obj=$1
+    dep=${obj%.o}.d
+    [ -e $obj ] && [ -e $dep ] || return 0
+    for f in $(sed -e ':a' -e '/\\$/{N;s/\\\n//;ba' -e '}' $dep | head -n 1 | cut -d: -f2-); do
+        if [ ! -e $f ] || [ $f -nt $obj ]; then
+            return 0
+        fi
+    done
+    return 1
+}
+
+pids=
+for src in print_functions3/*.cpp; do
+    obj=${src%.cpp}.o
+    if stale $obj; then
+        g++ $CXXFLAGS -MMD -MP -c $src -o $obj &
+        pids="$pids $!"
+    fi
+done
+failed=0
+for pid in $pids; do
+    wait $pid || failed=1
+done
+if [ $failed != 0 ]; then
+    echo "big.sh: print_functions3 build failed" >&2
+    exit 1
+fi
+
+# The Redis Streams telemetry sink is opt-in: USE_REDIS_STREAMS=1 ./big.sh
+REDIS_FLAGS=
+if [ "$USE_REDIS_STREAMS" = 1 ]; then
+    REDIS_FLAGS=-DUSE_REDIS_STREAMS
+fi
+
+g++ $CXXFLAGS -o my_program rvccc.cpp print_functions3/*.o $REDIS_FLAGS -Icpp_redis/includes -lstdc++ -lpthread -lm  -ldl -lc librvc.so -lmosquitto -I./cpp_redis/includes -L./cpp_redis/build/lib -I./cpp_redis/tacopie/includes cpp_redis/build/lib/libcpp_redis.so cpp_redis/build/lib/libtacopie.so
 
 # arm-linux-gnueabihf-g++ -std=c++17 -pthread -Wno-psabi -o my_program rvccc.cpp -g -D_32BIT_ARCHITECTURE="" -DXT_FAR="" -DXT_LITTLE_ENDIAN="" -DNO_APOX="" -DNO_CANCARDX="" -DNO_CANUSB="" -DNO_XANBR="" -DDEVICE_CLAIM_PGN=RVC_PGN_DIAG_MSG1 -ICode/Pkgs/Protocols/XanBus/Inc -ICode/Inc -ICode/Pkgs/Protocols/XanBus/Common/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Windows/WIN32/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Inc -ICode/Pkgs/Protocols/XanBus/Targets/Linux/Pkgs/Inc -ICode/Pkgs/Protocols/XanBus/Devices/PROTOCOL_RVC/Inc --sysroot=/path/to/sysroot -L/path/to/sysroot/usr/lib -L/path/to/sysroot/lib librvc.so -lmosquitto
 
@@ -0,0 +1,127 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+//! Compares the former string concatenation of redis_connection::build_command with serialize_command
+//! writing into a reused buffer, on the HSET / XADD commands issued by a status publisher.
+//! Usage: command_serialization_benchmark [nb_commands]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif /* __cplusplus >= 201703L */
+
+#include <cpp_redis/network/command_serializer.hpp>
+
+//! count heap allocations made by the measured code
+static std::size_t nb_allocations = 0;
+
+void *
+operator new(std::size_t size) {
+	++nb_allocations;
+
+	if (void *ptr = std::malloc(size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void
+operator delete(void *ptr) noexcept {
+	std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+//! former implementation of redis_connection::build_command + send()
+static void
+legacy_send(std::string &buffer, const std::vector<std::string> &redis_cmd) {
+	std::string cmd = "*" + std::to_string(redis_cmd.size()) + "\r\n";
+
+	for (const auto &cmd_part : redis_cmd)
+		cmd += "$" + std::to_string(cmd_part.length()) + "\r\n" + cmd_part + "\r\n";
+
+	buffer += cmd;
+}
+
+template <typename Function>
+static void
+run(const char *name, std::size_t nb_commands, Function &&send_one) {
+	std::string buffer;
+
+	//! warm up: let the buffer reach its steady state capacity
+	for (std::size_t i = 0; i < nb_commands; ++i)
+		send_one(buffer, i);
+	buffer.clear();
+
+	nb_allocations = 0;
+	auto start = std::chrono::steady_clock::now();
+
+	for (std::size_t i = 0; i < nb_commands; ++i)
+		send_one(buffer, i);
+
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	std::size_t allocations = nb_allocations;
+
+	std::cout << name << ": " << elapsed.count() / nb_commands << " ns/command, "
+	          << static_cast<double>(allocations) / nb_commands << " allocations/command, "
+	          << buffer.size() << " bytes" << std::endl;
+}
+
+int
+main(int argc, char **argv) {
+	std::size_t nb_commands = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+
+	const std::vector<std::string> hset = {"HSET", "xnet:invchg1", "AcOut1Line1RmsVolts", "120.4"};
+	const std::vector<std::string> xadd = {"XADD", "xnet:stream:invchg1", "MAXLEN", "~", "10000", "*",
+	                                       "BattVolts", "13.21", "BattCurrent", "-4.50",
+	                                       "AcOut1Line1RmsVolts", "120.4", "AcOut1Line1RmsCurrent", "3.10"};
+
+	run("legacy HSET", nb_commands, [&](std::string &buffer, std::size_t) { legacy_send(buffer, hset); });
+	run("serialize_command HSET", nb_commands, [&](std::string &buffer, std::size_t) {
+			cpp_redis::network::serialize_command(buffer, hset.begin(), hset.end());
+	});
+
+	run("legacy XADD", nb_commands, [&](std::string &buffer, std::size_t) { legacy_send(buffer, xadd); });
+	run("serialize_command XADD", nb_commands, [&](std::string &buffer, std::size_t) {
+			cpp_redis::network::serialize_command(buffer, xadd.begin(), xadd.end());
+	});
+
+#if __cplusplus >= 201703L
+	run("serialize_command XADD (string_view)", nb_commands, [&](std::string &buffer, std::size_t) {
+			const std::string_view args[] = {"XADD", "xnet:stream:invchg1", "MAXLEN", "~", "10000", "*",
+			                                 "BattVolts", "13.21", "BattCurrent", "-4.50",
+			                                 "AcOut1Line1RmsVolts", "120.4", "AcOut1Line1RmsCurrent", "3.10"};
+			cpp_redis::network::serialize_command(buffer, std::begin(args), std::end(args));
+	});
+#endif /* __cplusplus >= 201703L */
+
+	return 0;
+}
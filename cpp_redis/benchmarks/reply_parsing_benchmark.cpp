@@ -0,0 +1,105 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+//! Parses a pipelined response of 10k replies fed in socket-sized chunks and reports the throughput of reply_builder.
+//! Usage: reply_parsing_benchmark [nb_replies] [nb_rounds]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <cpp_redis/builders/reply_builder.hpp>
+
+#ifndef __CPP_REDIS_READ_SIZE
+#define __CPP_REDIS_READ_SIZE 4096
+#endif /* __CPP_REDIS_READ_SIZE */
+
+//! a mix of what a status publisher sees back: integers (HSET), stream ids (XADD), values (GET) and field arrays (HGETALL)
+static std::string
+make_pipelined_response(std::size_t nb_replies) {
+	const std::string value(96, 'v');
+	std::string response;
+
+	for (std::size_t i = 0; i < nb_replies; ++i) {
+		switch (i % 4) {
+			case 0:
+				response += ":1\r\n";
+				break;
+			case 1:
+				response += "$15\r\n1700000000000-" + std::to_string(i % 10) + "\r\n";
+				break;
+			case 2:
+				response += "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+				break;
+			default:
+				response += "*4\r\n$5\r\nfield\r\n$" + std::to_string(value.size()) + "\r\n" + value + "\r\n+OK\r\n-ERR x\r\n";
+				break;
+		}
+	}
+
+	return response;
+}
+
+int
+main(int argc, char **argv) {
+	std::size_t nb_replies = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+	std::size_t nb_rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20;
+
+	const std::string response = make_pipelined_response(nb_replies);
+
+	double best_ms = 0;
+
+	for (std::size_t round = 0; round < nb_rounds; ++round) {
+		cpp_redis::builders::reply_builder builder;
+		std::size_t nb_parsed = 0;
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (std::size_t offset = 0; offset < response.size(); offset += __CPP_REDIS_READ_SIZE) {
+			builder << response.substr(offset, __CPP_REDIS_READ_SIZE);
+
+			while (builder.reply_available()) {
+				builder.pop_front();
+				++nb_parsed;
+			}
+		}
+
+		std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		if (nb_parsed != nb_replies) {
+			std::cerr << "parsed " << nb_parsed << " replies, expected " << nb_replies << std::endl;
+			return 1;
+		}
+
+		if (round == 0 || elapsed.count() < best_ms)
+			best_ms = elapsed.count();
+	}
+
+	std::cout << nb_replies << " replies, " << response.size() << " bytes, "
+	          << __CPP_REDIS_READ_SIZE << " bytes per read" << std::endl;
+	std::cout << "best of " << nb_rounds << ": " << best_ms << " ms, "
+	          << (response.size() / 1048576.0) / (best_ms / 1000.0) << " MiB/s, "
+	          << (best_ms * 1000000.0) / nb_replies << " ns/reply" << std::endl;
+
+	return 0;
+}
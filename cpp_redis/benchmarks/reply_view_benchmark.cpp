@@ -0,0 +1,148 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+//! Parses one large XRANGE-like array reply fed in socket-sized chunks with reply_builder and reply_view_builder,
+//! and reports time and heap allocations of each.
+//! Usage: reply_view_benchmark [nb_entries] [nb_rounds]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <cpp_redis/builders/reply_builder.hpp>
+#include <cpp_redis/builders/reply_view_builder.hpp>
+
+#ifndef __CPP_REDIS_READ_SIZE
+#define __CPP_REDIS_READ_SIZE 4096
+#endif /* __CPP_REDIS_READ_SIZE */
+
+//! count heap allocations made by the measured code
+static std::size_t nb_allocations = 0;
+
+void *
+operator new(std::size_t size) {
+	++nb_allocations;
+
+	if (void *ptr = std::malloc(size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void
+operator delete(void *ptr) noexcept {
+	std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+//! XRANGE reply: nb_entries x [id, [field, value] x 8]
+static std::string
+make_xrange_response(std::size_t nb_entries) {
+	std::string response = "*" + std::to_string(nb_entries) + "\r\n";
+
+	for (std::size_t i = 0; i < nb_entries; ++i) {
+		std::string id = "1700000000000-" + std::to_string(i);
+		response += "*2\r\n$" + std::to_string(id.size()) + "\r\n" + id + "\r\n*16\r\n";
+
+		for (std::size_t field = 0; field < 8; ++field) {
+			response += "$9\r\nSignal" + std::to_string(100 + field) + "\r\n";
+			response += "$6\r\n" + std::to_string(100000 + i % 900000) + "\r\n";
+		}
+	}
+
+	return response;
+}
+
+template <typename Builder, typename Visitor>
+static void
+run(const char *name, const std::string &response, std::size_t nb_rounds, Visitor &&visit) {
+	double best_ms = 0;
+	std::size_t allocations = 0;
+
+	for (std::size_t round = 0; round < nb_rounds; ++round) {
+		Builder builder;
+		std::size_t checksum = 0;
+
+		nb_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+
+		for (std::size_t offset = 0; offset < response.size(); offset += __CPP_REDIS_READ_SIZE) {
+			builder << response.substr(offset, __CPP_REDIS_READ_SIZE);
+
+			while (builder.reply_available()) {
+				checksum += visit(builder.get_front());
+				builder.pop_front();
+			}
+		}
+
+		std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		if (checksum == 0) {
+			std::cerr << name << ": no reply parsed" << std::endl;
+			std::exit(1);
+		}
+
+		if (round == 0 || elapsed.count() < best_ms) {
+			best_ms = elapsed.count();
+			allocations = nb_allocations;
+		}
+	}
+
+	std::cout << name << ": best of " << nb_rounds << ": " << best_ms << " ms, " << allocations << " allocations" << std::endl;
+}
+
+int
+main(int argc, char **argv) {
+	std::size_t nb_entries = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5000;
+	std::size_t nb_rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+
+	const std::string response = make_xrange_response(nb_entries);
+	std::cout << nb_entries << " entries, " << response.size() << " bytes, "
+	          << __CPP_REDIS_READ_SIZE << " bytes per read" << std::endl;
+
+	run<cpp_redis::builders::reply_builder>("reply_builder", response, nb_rounds, [](const cpp_redis::reply &reply) {
+			std::size_t size = 0;
+			for (const auto &entry : reply.as_array())
+				for (const auto &field : entry.as_array()[1].as_array())
+					size += field.as_string().size();
+			return size;
+	});
+
+	run<cpp_redis::builders::reply_view_builder>("reply_view_builder", response, nb_rounds, [](const cpp_redis::reply_view &reply) {
+			std::size_t size = 0;
+			for (std::size_t i = 0; i < reply.size(); ++i) {
+				auto fields = reply[i][1];
+				for (std::size_t j = 0; j < fields.size(); ++j)
+					size += fields[j].as_string().size();
+			}
+			return size;
+	});
+
+	return 0;
+}
@@ -0,0 +1,210 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_redis/builders/reply_builder.hpp>
+#include <cpp_redis/core/reply_view.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+/**
+ * builds reply_view objects out of the received data
+ *
+ * received data is appended to a shared buffer that the produced views reference instead of copying element values.
+ * parsing is resumable: a partially received reply keeps its parse state and only the new bytes are scanned on the next call.
+ * once views reference the buffer, new data goes into a fresh buffer holding only the pending bytes, so views never observe writes.
+ *
+ */
+class reply_view_builder {
+public:
+/**
+ * ctor
+ *
+ */
+  reply_view_builder();
+/**
+ * dtor
+ *
+ */
+  ~reply_view_builder() = default;
+
+/**
+ * copy ctor
+ *
+ */
+  reply_view_builder(const reply_view_builder&) = delete;
+/**
+ * assignment operator
+ *
+ */
+  reply_view_builder& operator=(const reply_view_builder&) = delete;
+
+public:
+/**
+ * add data to reply view builder
+ *
+ * @param data data to be used for building replies
+ * @param size number of bytes in data
+ * @return current instance
+ *
+ */
+  reply_view_builder& feed(const char* data, std::size_t size);
+
+/**
+ * add data to reply view builder
+ *
+ * @param data data to be used for building replies
+ * @return current instance
+ *
+ */
+  reply_view_builder& operator<<(const std::string& data);
+
+/**
+ * similar as get_front, store reply in the passed parameter
+ *
+ * @param reply reference to the reply object where to store the first available reply
+ *
+ */
+  void operator>>(reply_view& reply);
+
+/**
+ * @return the first available reply
+ *
+ */
+  const reply_view& get_front() const;
+
+/**
+ * pop the first available reply
+ *
+ */
+  void pop_front();
+
+/**
+ * @return whether a reply is available
+ *
+ */
+  bool reply_available() const;
+
+/**
+ * reset the reply view builder to its initial state (drop pending data and parse state)
+ *
+ */
+  void reset();
+
+private:
+/**
+ * stage of an array being parsed: next child slot to fill and end of its slots in the children table
+ *
+ */
+  struct array_stage {
+    std::size_t next;
+    std::size_t end;
+  };
+
+/**
+ * make m_buffer writable before appending data: reuse it if no view references it, otherwise move pending bytes to a new buffer
+ *
+ */
+  void prepare_buffer();
+
+/**
+ * drop the first offset bytes of the buffer from the parse state of the current reply
+ *
+ * @param offset number of bytes dropped
+ *
+ */
+  void rebase(std::size_t offset);
+
+/**
+ * build reply using m_buffer content
+ *
+ * @return whether a reply has been fully built or not
+ *
+ */
+  bool build_reply();
+
+/**
+ * parse the element at m_cursor into the current reply
+ *
+ * @return whether the element was complete
+ *
+ */
+  bool parse_node();
+
+/**
+ * add a parsed element to the current reply
+ *
+ * @param node parsed element
+ *
+ */
+  void add_node(const reply_view::node& node);
+
+private:
+/**
+ * buffer holding received data, shared with the views built from it
+ *
+ */
+  std::shared_ptr<std::string> m_buffer;
+
+/**
+ * parse cursor in m_buffer
+ *
+ */
+  std::size_t m_cursor;
+
+/**
+ * position of the reply being built in m_buffer
+ *
+ */
+  std::size_t m_reply_start;
+
+/**
+ * reply being built
+ *
+ */
+  std::shared_ptr<reply_view::storage> m_storage;
+
+/**
+ * arrays of the current reply that still expect elements
+ *
+ */
+  std::vector<array_stage> m_stages;
+
+/**
+ * queue of available (built) replies
+ *
+ */
+  std::deque<reply_view> m_available_replies;
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
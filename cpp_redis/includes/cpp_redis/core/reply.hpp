@@ -238,6 +238,15 @@ namespace cpp_redis {
  */
 			void set(const std::string &value, string_type reply_type);
 
+/**
+ * set a string reply, taking ownership of the value
+ *
+ * @param value string value
+ * @param reply_type of string reply
+ *
+ */
+			void set(std::string &&value, string_type reply_type);
+
 /**
  * set an integer reply
  *
@@ -263,6 +272,15 @@ namespace cpp_redis {
  */
 			reply &operator<<(const reply &reply);
 
+/**
+ * for array replies, move a new row into the reply
+ *
+ * @param reply new row to be appended
+ * @return current instance
+ *
+ */
+			reply &operator<<(reply &&reply);
+
 	public:
 /**
  * @return reply type
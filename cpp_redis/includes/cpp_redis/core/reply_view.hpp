@@ -0,0 +1,208 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif /* __cplusplus >= 201703L */
+
+#include <cpp_redis/core/reply.hpp>
+
+namespace cpp_redis {
+
+/**
+ * non-owning reference to a sequence of characters (std::string_view-like, usable from C++11)
+ *
+ */
+	class string_ref {
+	public:
+			string_ref() : m_data(nullptr), m_size(0) {}
+
+			string_ref(const char *data, std::size_t size) : m_data(data), m_size(size) {}
+
+			string_ref(const std::string &str) : m_data(str.data()), m_size(str.size()) {}
+
+	public:
+			const char *data() const { return m_data; }
+
+			std::size_t size() const { return m_size; }
+
+			bool empty() const { return m_size == 0; }
+
+			const char *begin() const { return m_data; }
+
+			const char *end() const { return m_data + m_size; }
+
+			char operator[](std::size_t i) const { return m_data[i]; }
+
+/**
+ * @return a copy of the referenced characters
+ *
+ */
+			std::string str() const { return std::string(m_data, m_size); }
+
+#if __cplusplus >= 201703L
+			operator std::string_view() const { return std::string_view(m_data, m_size); }
+#endif /* __cplusplus >= 201703L */
+
+			bool operator==(const string_ref &other) const {
+				return m_size == other.m_size && (m_size == 0 || std::memcmp(m_data, other.m_data, m_size) == 0);
+			}
+
+			bool operator!=(const string_ref &other) const { return !(*this == other); }
+
+	private:
+			const char *m_data;
+			std::size_t m_size;
+	};
+
+/**
+ * read-only view of a redis reply that references the raw receive buffer instead of copying it.
+ *
+ * a parsed reply is stored as a flat table of nodes (one per element) pointing into a shared receive buffer,
+ * so an array of thousands of elements costs a few allocations instead of one per element.
+ * views (and the elements returned by operator[]) keep that buffer alive: string_ref values stay valid as long as a view exists.
+ *
+ * to_reply() materialises the equivalent cpp_redis::reply for code relying on the owning API.
+ *
+ */
+	class reply_view {
+	public:
+/**
+ * element of the flat node table
+ * strings: [offset, offset + length) in the buffer
+ * arrays: length children, whose node indexes are stored from children[offset]
+ * integers: value
+ *
+ */
+			struct node {
+					reply::type type;
+					std::size_t offset;
+					std::size_t length;
+					int64_t value;
+			};
+
+/**
+ * storage shared by a parsed reply and all the views on its elements
+ *
+ */
+			struct storage {
+					std::shared_ptr<const std::string> buffer;
+					std::vector<node> nodes;
+					std::vector<std::size_t> children;
+			};
+
+	public:
+/**
+ * default ctor (null reply)
+ *
+ */
+			reply_view() : m_index(0) {}
+
+/**
+ * ctor
+ *
+ * @param storage parsed reply
+ * @param index node index of the element to view (0 for the reply itself)
+ *
+ */
+			reply_view(const std::shared_ptr<const storage> &storage, std::size_t index);
+
+	public:
+			bool is_array() const { return get_type() == reply::type::array; }
+
+			bool is_string() const { return is_simple_string() || is_bulk_string() || is_error(); }
+
+			bool is_simple_string() const { return get_type() == reply::type::simple_string; }
+
+			bool is_bulk_string() const { return get_type() == reply::type::bulk_string; }
+
+			bool is_error() const { return get_type() == reply::type::error; }
+
+			bool is_integer() const { return get_type() == reply::type::integer; }
+
+			bool is_null() const { return get_type() == reply::type::null; }
+
+			bool ok() const { return !is_error(); }
+
+			bool ko() const { return !ok(); }
+
+			explicit operator bool() const { return !is_error() && !is_null(); }
+
+			reply::type get_type() const { return m_storage ? get_node().type : reply::type::null; }
+
+	public:
+/**
+ * @return the error message (throws if the reply is not an error)
+ *
+ */
+			string_ref error() const;
+
+/**
+ * @return the string value, referencing the receive buffer (throws if the reply is not a string)
+ *
+ */
+			string_ref as_string() const;
+
+/**
+ * @return the integer value (throws if the reply is not an integer)
+ *
+ */
+			int64_t as_integer() const;
+
+/**
+ * @return number of elements for arrays, 0 otherwise
+ *
+ */
+			std::size_t size() const;
+
+/**
+ * @param i element index (throws if the reply is not an array or if i is out of range)
+ * @return view on the i-th element of the array
+ *
+ */
+			reply_view operator[](std::size_t i) const;
+
+	public:
+/**
+ * @return an owning copy of the reply, built recursively
+ *
+ */
+			reply to_reply() const;
+
+	private:
+			const node &get_node() const { return m_storage->nodes[m_index]; }
+
+	private:
+			std::shared_ptr<const storage> m_storage;
+			std::size_t m_index;
+	};
+
+} // namespace cpp_redis
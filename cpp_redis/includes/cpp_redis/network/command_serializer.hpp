@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+namespace cpp_redis {
+
+	namespace network {
+
+/**
+ * @return number of characters needed to print the given length in base 10
+ *
+ */
+		inline std::size_t
+		resp_length_digits(std::size_t length) {
+			std::size_t digits = 1;
+
+			while (length >= 10) {
+				length /= 10;
+				++digits;
+			}
+
+			return digits;
+		}
+
+/**
+ * append a RESP length header (for example "*3\r\n" or "$5\r\n") to buffer, without any temporary string
+ *
+ * @param buffer buffer to append to
+ * @param type '*' for arrays, '$' for bulk strings
+ * @param length length to be printed
+ *
+ */
+		inline void
+		append_resp_header(std::string &buffer, char type, std::size_t length) {
+			char digits[24];
+			char *end = digits + sizeof(digits);
+			char *it = end;
+
+			*--it = '\n';
+			*--it = '\r';
+			do {
+				*--it = static_cast<char>('0' + length % 10);
+				length /= 10;
+			} while (length);
+			*--it = type;
+
+			buffer.append(it, static_cast<std::size_t>(end - it));
+		}
+
+/**
+ * compute the size of the RESP encoding of a command
+ * arguments can be any type providing data() and size() (std::string, std::string_view, ...)
+ *
+ * @param begin first argument of the command
+ * @param end past-the-end argument of the command
+ * @return number of bytes needed to serialize the command
+ *
+ */
+		template <typename Iterator>
+		std::size_t
+		command_size(Iterator begin, Iterator end) {
+			std::size_t nb_parts = 0;
+			std::size_t size = 0;
+
+			for (Iterator it = begin; it != end; ++it, ++nb_parts)
+				size += 1 + resp_length_digits(it->size()) + 2 + it->size() + 2;
+
+			return size + 1 + resp_length_digits(nb_parts) + 2;
+		}
+
+/**
+ * append the RESP encoding of a command to buffer
+ * the total length is computed first, so buffer is reallocated at most once and no temporary string is created.
+ * callers reusing the same buffer across commands (clear() keeps the capacity) do not allocate at all in steady state.
+ *
+ * for example, {"GET", "HELLO"} is serialized as "*2\r\n$3\r\nGET\r\n$5\r\nHELLO\r\n"
+ *
+ * @param buffer buffer to append to
+ * @param begin first argument of the command
+ * @param end past-the-end argument of the command
+ *
+ */
+		template <typename Iterator>
+		void
+		serialize_command(std::string &buffer, Iterator begin, Iterator end) {
+			std::size_t size = command_size(begin, end);
+
+			//! keep the geometric growth of the buffer when many commands are pipelined
+			if (buffer.capacity() < buffer.size() + size)
+				buffer.reserve((std::max)(buffer.size() + size, 2 * buffer.capacity()));
+
+			append_resp_header(buffer, '*', static_cast<std::size_t>(std::distance(begin, end)));
+
+			for (Iterator it = begin; it != end; ++it) {
+				append_resp_header(buffer, '$', it->size());
+				buffer.append(it->data(), it->size());
+				buffer.append("\r\n", 2);
+			}
+		}
+
+	} // namespace network
+
+} // namespace cpp_redis
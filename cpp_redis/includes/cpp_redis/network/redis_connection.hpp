@@ -29,6 +29,8 @@
 #include <vector>
 
 #include <cpp_redis/builders/reply_builder.hpp>
+#include <cpp_redis/builders/reply_view_builder.hpp>
+#include <cpp_redis/network/command_serializer.hpp>
 #include <cpp_redis/network/tcp_client_iface.hpp>
 
 #ifndef __CPP_REDIS_READ_SIZE
@@ -94,6 +96,22 @@ namespace cpp_redis {
  */
 				typedef std::function<void(redis_connection &, reply &)> reply_callback_t;
 
+/**
+ * reply view handler takes as parameter the instance of the redis_connection and a view on the built reply
+ *
+ */
+				typedef std::function<void(redis_connection &, reply_view &)> reply_view_callback_t;
+
+/**
+ * deliver replies as reply_view objects referencing the receive buffer instead of building owning reply objects
+ * when set (non null), it replaces the reply callback passed to connect: use reply_view::to_reply() where an owning reply is needed
+ * should be set before connecting
+ *
+ * @param reply_view_callback handler to be called once a reply is ready
+ *
+ */
+				void set_reply_view_callback(const reply_view_callback_t &reply_view_callback);
+
 /**
  * connect to the given host and port, and set both disconnection and reply callbacks
  *
@@ -136,6 +154,26 @@ namespace cpp_redis {
  */
 				redis_connection &send(const std::vector<std::string> &redis_cmd);
 
+/**
+ * send the given command, given as a range of string-like arguments (std::string, std::string_view, ...)
+ * arguments are serialized straight into the send buffer, without building intermediate strings
+ * the command is actually pipelined and only buffered, so nothing is sent to the network
+ * please call commit() to flush the buffer
+ *
+ * @param begin first argument of the command
+ * @param end past-the-end argument of the command
+ * @return current instance
+ *
+ */
+				template <typename Iterator>
+				redis_connection &send(Iterator begin, Iterator end) {
+					std::lock_guard<std::mutex> lock(m_buffer_mutex);
+
+					serialize_command(m_buffer, begin, end);
+
+					return *this;
+				}
+
 /**
  * commit pipelined transaction
  * that is, send to the network all commands pipelined by calling send()
@@ -164,7 +202,8 @@ namespace cpp_redis {
 
 /**
  * transform a user command to a redis command using the redis protocol format
- * for example, transform {"GET", "HELLO"} to something like "*2\r\n+GET\r\n+HELLO\r\n"
+ * for example, transform {"GET", "HELLO"} to something like "*2\r\n$3\r\nGET\r\n$5\r\nHELLO\r\n"
+ * send() serializes directly into the send buffer, this is kept for callers needing a standalone string
  *
  */
 				std::string build_command(const std::vector<std::string> &redis_cmd);
@@ -189,6 +228,12 @@ namespace cpp_redis {
  */
 				reply_callback_t m_reply_callback;
 
+/**
+ * reply view callback called whenever a reply has been read, if set
+ *
+ */
+				reply_view_callback_t m_reply_view_callback;
+
 /**
  * disconnection handler whenever a disconnection occurred
  *
@@ -201,8 +246,15 @@ namespace cpp_redis {
  */
 				builders::reply_builder m_builder;
 
+/**
+ * reply view builder used to build replies when a reply view callback is set
+ *
+ */
+				builders::reply_view_builder m_view_builder;
+
 /**
  * internal buffer used for pipelining (commands are buffered here and flushed to the tcp client when commit is called)
+ * its capacity is kept across commits so that serializing commands does not allocate in steady state
  *
  */
 				std::string m_buffer;
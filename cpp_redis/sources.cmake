@@ -5,10 +5,12 @@ set(cpp_redis_sources
   sources/builders/error_builder.cpp
   sources/builders/integer_builder.cpp
   sources/builders/reply_builder.cpp
+  sources/builders/reply_view_builder.cpp
   sources/builders/simple_string_builder.cpp
   sources/core/client.cpp
   sources/core/consumer.cpp
   sources/core/reply.cpp
+  sources/core/reply_view.cpp
   sources/core/sentinel.cpp
   sources/core/subscriber.cpp
   sources/core/types.cpp
@@ -0,0 +1,243 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cpp_redis/builders/reply_view_builder.hpp>
+#include <cpp_redis/misc/error.hpp>
+
+namespace cpp_redis {
+
+	namespace builders {
+
+		namespace {
+
+			int64_t
+			parse_integer(const std::string &buffer, std::size_t begin, std::size_t end) {
+				bool negative = begin < end && buffer[begin] == '-';
+				if (negative)
+					++begin;
+
+				if (begin == end)
+					throw redis_error("Invalid character for integer redis reply");
+
+				int64_t value = 0;
+				for (std::size_t i = begin; i < end; ++i) {
+					if (buffer[i] < '0' || buffer[i] > '9')
+						throw redis_error("Invalid character for integer redis reply");
+
+					value = value * 10 + (buffer[i] - '0');
+				}
+
+				return negative ? -value : value;
+			}
+
+		} // namespace
+
+		reply_view_builder::reply_view_builder()
+				: m_buffer(std::make_shared<std::string>()), m_cursor(0), m_reply_start(0) {}
+
+		reply_view_builder &
+		reply_view_builder::feed(const char *data, std::size_t size) {
+			prepare_buffer();
+			m_buffer->append(data, size);
+
+			while (build_reply());
+
+			return *this;
+		}
+
+		reply_view_builder &
+		reply_view_builder::operator<<(const std::string &data) {
+			return feed(data.data(), data.size());
+		}
+
+		void
+		reply_view_builder::reset() {
+			m_buffer = std::make_shared<std::string>();
+			m_cursor = 0;
+			m_reply_start = 0;
+			m_storage = nullptr;
+			m_stages.clear();
+		}
+
+		void
+		reply_view_builder::prepare_buffer() {
+			if (m_buffer.use_count() > 1) {
+				//! views reference the buffer: never write to it again, carry the pending bytes over
+				auto buffer = std::make_shared<std::string>(m_buffer->begin() + m_reply_start, m_buffer->end());
+				rebase(m_reply_start);
+				m_buffer = std::move(buffer);
+			}
+			else if (m_reply_start == m_buffer->size()) {
+				//! everything consumed: keep the allocation, drop the content
+				m_buffer->clear();
+				m_cursor = 0;
+				m_reply_start = 0;
+			}
+			else if (m_reply_start >= __CPP_REDIS_REPLY_BUILDER_COMPACT_SIZE && m_reply_start >= m_buffer->size() / 2) {
+				m_buffer->erase(0, m_reply_start);
+				rebase(m_reply_start);
+			}
+		}
+
+		void
+		reply_view_builder::rebase(std::size_t offset) {
+			m_cursor -= offset;
+			m_reply_start -= offset;
+
+			if (!m_storage)
+				return;
+
+			for (auto &node : m_storage->nodes) {
+				if (node.type == reply::type::simple_string || node.type == reply::type::bulk_string ||
+				    node.type == reply::type::error)
+					node.offset -= offset;
+			}
+		}
+
+		bool
+		reply_view_builder::build_reply() {
+			while (m_cursor < m_buffer->size()) {
+				if (!m_storage) {
+					m_storage = std::make_shared<reply_view::storage>();
+					m_reply_start = m_cursor;
+				}
+
+				if (!parse_node())
+					return false;
+
+				if (m_stages.empty()) {
+					m_storage->buffer = m_buffer;
+					m_available_replies.emplace_back(m_storage, 0);
+					m_storage = nullptr;
+					m_reply_start = m_cursor;
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		bool
+		reply_view_builder::parse_node() {
+			const std::string &buffer = *m_buffer;
+			std::size_t end_of_line = buffer.find("\r\n", m_cursor + 1);
+
+			if (end_of_line == std::string::npos)
+				return false;
+
+			std::size_t data = m_cursor + 1;
+			std::size_t next = end_of_line + 2;
+			reply_view::node node = {reply::type::null, 0, 0, 0};
+
+			switch (buffer[m_cursor]) {
+				case '+':
+					node = {reply::type::simple_string, data, end_of_line - data, 0};
+					break;
+				case '-':
+					node = {reply::type::error, data, end_of_line - data, 0};
+					break;
+				case ':':
+					node.type = reply::type::integer;
+					node.value = parse_integer(buffer, data, end_of_line);
+					break;
+				case '$': {
+					int64_t length = parse_integer(buffer, data, end_of_line);
+					if (length < 0)
+						break;
+
+					std::size_t size = static_cast<std::size_t>(length);
+					if (buffer.size() < next + size + 2)
+						return false;
+
+					if (buffer[next + size] != '\r' || buffer[next + size + 1] != '\n')
+						throw redis_error("Wrong ending sequence");
+
+					node = {reply::type::bulk_string, next, size, 0};
+					next += size + 2;
+					break;
+				}
+				case '*': {
+					int64_t length = parse_integer(buffer, data, end_of_line);
+					if (length < 0)
+						break;
+
+					std::size_t size = static_cast<std::size_t>(length);
+					node = {reply::type::array, m_storage->children.size(), size, 0};
+					m_storage->children.resize(m_storage->children.size() + size);
+					break;
+				}
+				default:
+					throw redis_error("Invalid data");
+			}
+
+			m_cursor = next;
+			add_node(node);
+
+			return true;
+		}
+
+		void
+		reply_view_builder::add_node(const reply_view::node &node) {
+			std::size_t index = m_storage->nodes.size();
+			m_storage->nodes.push_back(node);
+
+			if (!m_stages.empty())
+				m_storage->children[m_stages.back().next++] = index;
+
+			if (node.type == reply::type::array && node.length > 0)
+				m_stages.push_back({node.offset, node.offset + node.length});
+
+			while (!m_stages.empty() && m_stages.back().next == m_stages.back().end)
+				m_stages.pop_back();
+		}
+
+		void
+		reply_view_builder::operator>>(reply_view &reply) {
+			reply = get_front();
+		}
+
+		const reply_view &
+		reply_view_builder::get_front() const {
+			if (!reply_available())
+				throw redis_error("No available reply");
+
+			return m_available_replies.front();
+		}
+
+		void
+		reply_view_builder::pop_front() {
+			if (!reply_available())
+				throw redis_error("No available reply");
+
+			m_available_replies.pop_front();
+		}
+
+		bool
+		reply_view_builder::reply_available() const {
+			return !m_available_replies.empty();
+		}
+
+	} // namespace builders
+
+} // namespace cpp_redis
@@ -99,6 +99,12 @@ namespace cpp_redis {
 		m_str_val = value;
 	}
 
+	void
+	reply::set(std::string &&value, string_type reply_type) {
+		m_type = static_cast<type>(reply_type);
+		m_str_val = std::move(value);
+	}
+
 	void
 	reply::set(int64_t value) {
 		m_type = type::integer;
@@ -119,6 +125,14 @@ namespace cpp_redis {
 		return *this;
 	}
 
+	reply &
+	reply::operator<<(reply &&reply) {
+		m_type = type::array;
+		m_rows.push_back(std::move(reply));
+
+		return *this;
+	}
+
 	bool
 	reply::is_array() const {
 		return m_type == type::array;
@@ -0,0 +1,103 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cpp_redis/core/reply_view.hpp>
+#include <cpp_redis/misc/error.hpp>
+
+namespace cpp_redis {
+
+	reply_view::reply_view(const std::shared_ptr<const storage> &storage, std::size_t index)
+			: m_storage(storage), m_index(index) {}
+
+	string_ref
+	reply_view::error() const {
+		if (!is_error())
+			throw cpp_redis::redis_error("Reply is not an error");
+
+		return as_string();
+	}
+
+	string_ref
+	reply_view::as_string() const {
+		if (!is_string())
+			throw cpp_redis::redis_error("Reply is not a string");
+
+		const node &n = get_node();
+		return {m_storage->buffer->data() + n.offset, n.length};
+	}
+
+	int64_t
+	reply_view::as_integer() const {
+		if (!is_integer())
+			throw cpp_redis::redis_error("Reply is not an integer");
+
+		return get_node().value;
+	}
+
+	std::size_t
+	reply_view::size() const {
+		return is_array() ? get_node().length : 0;
+	}
+
+	reply_view
+	reply_view::operator[](std::size_t i) const {
+		if (!is_array())
+			throw cpp_redis::redis_error("Reply is not an array");
+
+		const node &n = get_node();
+		if (i >= n.length)
+			throw cpp_redis::redis_error("Reply array index out of range");
+
+		return {m_storage, m_storage->children[n.offset + i]};
+	}
+
+	reply
+	reply_view::to_reply() const {
+		reply r;
+
+		switch (get_type()) {
+			case reply::type::error:
+				r.set(as_string().str(), reply::string_type::error);
+				break;
+			case reply::type::bulk_string:
+				r.set(as_string().str(), reply::string_type::bulk_string);
+				break;
+			case reply::type::simple_string:
+				r.set(as_string().str(), reply::string_type::simple_string);
+				break;
+			case reply::type::integer:
+				r.set(as_integer());
+				break;
+			case reply::type::array:
+				r.set(std::vector<reply>{});
+				for (std::size_t i = 0; i < size(); ++i)
+					r << (*this)[i].to_reply();
+				break;
+			case reply::type::null:
+				break;
+		}
+
+		return r;
+	}
+
+} // namespace cpp_redis
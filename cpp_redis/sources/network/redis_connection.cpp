@@ -102,10 +102,16 @@ namespace cpp_redis {
  * clear builder
  */
 			m_builder.reset();
+			m_view_builder.reset();
 
 			__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection disconnected");
 		}
 
+		void
+		redis_connection::set_reply_view_callback(const reply_view_callback_t &reply_view_callback) {
+			m_reply_view_callback = reply_view_callback;
+		}
+
 		bool
 		redis_connection::is_connected() const {
 			return m_client->is_connected();
@@ -113,10 +119,9 @@ namespace cpp_redis {
 
 		std::string
 		redis_connection::build_command(const std::vector<std::string> &redis_cmd) {
-			std::string cmd = "*" + std::to_string(redis_cmd.size()) + "\r\n";
+			std::string cmd;
 
-			for (const auto &cmd_part : redis_cmd)
-				cmd += "$" + std::to_string(cmd_part.length()) + "\r\n" + cmd_part + "\r\n";
+			serialize_command(cmd, redis_cmd.begin(), redis_cmd.end());
 
 			return cmd;
 		}
@@ -125,7 +130,7 @@ namespace cpp_redis {
 		redis_connection::send(const std::vector<std::string> &redis_cmd) {
 			std::lock_guard<std::mutex> lock(m_buffer_mutex);
 
-			m_buffer += build_command(redis_cmd);
+			serialize_command(m_buffer, redis_cmd.begin(), redis_cmd.end());
 			__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
 
 			return *this;
@@ -139,13 +144,13 @@ namespace cpp_redis {
 			std::lock_guard<std::mutex> lock(m_buffer_mutex);
 
 			/**
-			 * ensure buffer is cleared
+			 * ensure buffer is cleared, but keep its capacity for the next commands
 			 */
 			__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection attempts to send pipelined commands");
-			std::string buffer = std::move(m_buffer);
+			tcp_client_iface::write_request request = {std::vector<char>{m_buffer.begin(), m_buffer.end()}, nullptr};
+			m_buffer.clear();
 
 			try {
-				tcp_client_iface::write_request request = {std::vector<char>{buffer.begin(), buffer.end()}, nullptr};
 				m_client->async_write(request);
 			}
 			catch (const std::exception &e) {
@@ -170,15 +175,38 @@ namespace cpp_redis {
 		redis_connection::tcp_client_receive_handler(const tcp_client_iface::read_result &result) {
 			if (!result.success) { return; }
 
-			try {
-				__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection receives packet, attempts to build reply");
-				m_builder << std::string(result.buffer.begin(), result.buffer.end());
+			if (m_reply_view_callback) {
+				try {
+					__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection receives packet, attempts to build reply view");
+					m_view_builder.feed(result.buffer.data(), result.buffer.size());
+				}
+				catch (const redis_error &) {
+					__CPP_REDIS_LOG(error,
+					                "cpp_redis::network::redis_connection could not build reply (invalid format), disconnecting");
+					call_disconnection_handler();
+					return;
+				}
+
+				while (m_view_builder.reply_available()) {
+					__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection reply view fully built");
+
+					auto reply = m_view_builder.get_front();
+					m_view_builder.pop_front();
+
+					m_reply_view_callback(*this, reply);
+				}
 			}
-			catch (const redis_error &) {
-				__CPP_REDIS_LOG(error,
-				                "cpp_redis::network::redis_connection could not build reply (invalid format), disconnecting");
-				call_disconnection_handler();
-				return;
+			else {
+				try {
+					__CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection receives packet, attempts to build reply");
+					m_builder << std::string(result.buffer.begin(), result.buffer.end());
+				}
+				catch (const redis_error &) {
+					__CPP_REDIS_LOG(error,
+					                "cpp_redis::network::redis_connection could not build reply (invalid format), disconnecting");
+					call_disconnection_handler();
+					return;
+				}
 			}
 
 			while (m_builder.reply_available()) {
@@ -217,6 +245,7 @@ namespace cpp_redis {
  * clear builder
  */
 			m_builder.reset();
+			m_view_builder.reset();
 /**
  * call disconnection handler
  */
@@ -45,12 +45,24 @@
 #define __TACOPIE_IO_SERVICE_NB_WORKERS 1
 #endif /* __TACOPIE_IO_SERVICE_NB_WORKERS */
 
+#ifndef __TACOPIE_EPOLL_MAX_EVENTS
+#define __TACOPIE_EPOLL_MAX_EVENTS 64
+#endif /* __TACOPIE_EPOLL_MAX_EVENTS */
+
+//! only used by the epoll backend, forward declared to keep this header platform independent
+struct epoll_event;
+
 namespace tacopie {
 
 //!
 //! service that operates IO Handling.
 //! It polls sockets for input and output, processes read and write operations and calls the appropriate callbacks.
 //!
+//! The polling backend is chosen at build time:
+//!  * __TACOPIE_USE_EPOLL (default on Linux): sockets are registered once in an edge-triggered epoll set and only sockets reporting events are visited
+//!  * otherwise: fd_sets are rebuilt from the tracked sockets and given to select() on every loop
+//! The class layout is the same for both backends so that the choice only affects the library itself.
+//!
 class io_service {
 public:
   //!
@@ -148,6 +160,8 @@ private:
   //!  * wr_callback: callback to be executed on write availability
   //!  * is_executing_wr_callback: whether the wr callback is currently being executed or not
   //!  * marked_for_untrack: whether the socket is marked for being untrack (that is, will be untracked whenever all the callback completed their execution)
+  //!  * is_rd_ready / is_wr_ready: (epoll only) an edge has been reported and not consumed by a callback yet
+  //!  * is_queued: (epoll only) whether the socket is already in m_ready_fds
   //!
   //!
   struct tracked_socket {
@@ -166,6 +180,11 @@ private:
 
     //! marked for untrack
     std::atomic<bool> marked_for_untrack = ATOMIC_VAR_INIT(false);
+
+    //! pending readiness (edge-triggered backend)
+    bool is_rd_ready = false;
+    bool is_wr_ready = false;
+    bool is_queued   = false;
   };
 
 private:
@@ -205,6 +224,49 @@ private:
   //!
   void process_wr_event(const fd_t& fd, tracked_socket& socket);
 
+  //!
+  //! process the events reported by epoll_wait (epoll backend)
+  //! readiness is recorded on the tracked sockets and every socket that can make progress is dispatched
+  //!
+  //! \param events events returned by epoll_wait
+  //! \param nb_events number of valid entries in events
+  //!
+  void process_epoll_events(const struct epoll_event* events, int nb_events);
+
+  //!
+  //! dispatch the pending read/write readiness of a socket to its callbacks (epoll backend)
+  //! the socket is untracked if it was marked for untrack and no callback is running anymore
+  //!
+  //! \param it iterator on the tracked socket
+  //!
+  void dispatch_ready_socket(std::unordered_map<fd_t, tracked_socket>::iterator it);
+
+  //!
+  //! queue a socket for dispatch by the poll thread (epoll backend)
+  //! with edge-triggered notifications, data left unread by a callback does not produce a new event.
+  //! this checks the current readiness of the socket so that such data is not forgotten.
+  //!
+  //! \param fd fd of the socket
+  //! \param socket tracked_socket associated to the given fd
+  //! \param probe whether the current readiness must be checked with a non-blocking poll()
+  //!
+  void requeue_socket(const fd_t& fd, tracked_socket& socket, bool probe);
+
+  //!
+  //! register a newly tracked socket to the epoll set (epoll backend)
+  //! registrations are persistent: callbacks updates do not modify the epoll set
+  //!
+  //! \param fd fd to be registered
+  //!
+  void register_fd(const fd_t& fd);
+
+  //!
+  //! remove a socket from tracking, deregister it from the epoll set and notify the removal waiters
+  //!
+  //! \param it iterator on the tracked socket
+  //!
+  void erase_tracked_socket(std::unordered_map<fd_t, tracked_socket>::iterator it);
+
 private:
   //!
   //! tracked sockets
@@ -246,6 +308,16 @@ private:
   //!
   fd_set m_wr_set;
 
+  //!
+  //! epoll instance (epoll backend only, __TACOPIE_INVALID_FD otherwise)
+  //!
+  fd_t m_epoll_fd;
+
+  //!
+  //! sockets with pending readiness waiting for dispatch (epoll backend)
+  //!
+  std::vector<fd_t> m_ready_fds;
+
   //!
   //! condition variable to wait on removal
   //!
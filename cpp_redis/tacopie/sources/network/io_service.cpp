@@ -32,6 +32,12 @@
 #include <unistd.h>
 #endif /* _WIN32 */
 
+#ifdef __TACOPIE_USE_EPOLL
+#include <cerrno>
+#include <poll.h>
+#include <sys/epoll.h>
+#endif /* __TACOPIE_USE_EPOLL */
+
 namespace tacopie {
 
 //!
@@ -65,9 +71,24 @@ io_service::io_service(void)
 #else
 : m_should_stop(false)
 #endif /* _WIN32 */
-, m_callback_workers(__TACOPIE_IO_SERVICE_NB_WORKERS) {
+, m_callback_workers(__TACOPIE_IO_SERVICE_NB_WORKERS)
+, m_epoll_fd(__TACOPIE_INVALID_FD) {
   __TACOPIE_LOG(debug, "create io_service");
 
+#ifdef __TACOPIE_USE_EPOLL
+  m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (m_epoll_fd == -1) { __TACOPIE_THROW(error, "epoll_create1() failure"); }
+
+  //! the notifier stays level-triggered: clr_buffer() does not necessarily drain the pipe
+  struct epoll_event notifier_event;
+  notifier_event.events  = EPOLLIN;
+  notifier_event.data.fd = m_notifier.get_read_fd();
+  if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_notifier.get_read_fd(), &notifier_event) == -1) {
+    close(m_epoll_fd);
+    __TACOPIE_THROW(error, "epoll_ctl() failure");
+  }
+#endif /* __TACOPIE_USE_EPOLL */
+
   //! Start worker after everything has been initialized
   m_poll_worker = std::thread(std::bind(&io_service::poll, this));
 }
@@ -82,6 +103,10 @@ io_service::~io_service(void) {
     m_poll_worker.join();
   }
   m_callback_workers.stop();
+
+#ifdef __TACOPIE_USE_EPOLL
+  if (m_epoll_fd != __TACOPIE_INVALID_FD) { close(m_epoll_fd); }
+#endif /* __TACOPIE_USE_EPOLL */
 }
 
 //!
@@ -105,6 +130,34 @@ io_service::is_nb_worker_context() {
 //! poll worker function
 //!
 
+#ifdef __TACOPIE_USE_EPOLL
+void
+io_service::poll(void) {
+  __TACOPIE_LOG(debug, "starting poll() worker");
+
+  struct epoll_event events[__TACOPIE_EPOLL_MAX_EVENTS];
+
+  //! setup timeout (__TACOPIE_TIMEOUT is given in microseconds)
+  int timeout = -1;
+#ifdef __TACOPIE_TIMEOUT
+  timeout = __TACOPIE_TIMEOUT / 1000;
+#endif /* __TACOPIE_TIMEOUT */
+
+  while (!m_should_stop) {
+    __TACOPIE_LOG(debug, "polling fds");
+    int nb_events = epoll_wait(m_epoll_fd, events, __TACOPIE_EPOLL_MAX_EVENTS, timeout);
+
+    if (nb_events > 0) {
+      process_epoll_events(events, nb_events);
+    }
+    else {
+      __TACOPIE_LOG(debug, "poll woke up, but nothing to process");
+    }
+  }
+
+  __TACOPIE_LOG(debug, "stop poll() worker");
+}
+#else
 void
 io_service::poll(void) {
   __TACOPIE_LOG(debug, "starting poll() worker");
@@ -131,6 +184,7 @@ io_service::poll(void) {
 
   __TACOPIE_LOG(debug, "stop poll() worker");
 }
+#endif /* __TACOPIE_USE_EPOLL */
 
 //!
 //! process poll detected events
@@ -163,10 +217,140 @@ io_service::process_events(void) {
 
     if (socket.marked_for_untrack && !socket.is_executing_rd_callback && !socket.is_executing_wr_callback) {
       __TACOPIE_LOG(debug, "untrack socket");
-      m_tracked_sockets.erase(it);
-      m_wait_for_removal_condvar.notify_all();
+      erase_tracked_socket(it);
+    }
+  }
+}
+
+//!
+//! process epoll detected events
+//!
+
+void
+io_service::process_epoll_events(const struct epoll_event* events, int nb_events) {
+#ifdef __TACOPIE_USE_EPOLL
+  std::lock_guard<std::mutex> lock(m_tracked_sockets_mtx);
+
+  __TACOPIE_LOG(debug, "processing events");
+
+  for (int i = 0; i < nb_events; ++i) {
+    fd_t fd = events[i].data.fd;
+
+    if (fd == m_notifier.get_read_fd()) {
+      m_notifier.clr_buffer();
+      continue;
+    }
+
+    auto it = m_tracked_sockets.find(fd);
+
+    if (it == m_tracked_sockets.end()) { continue; }
+
+    auto& socket = it->second;
+
+    //! errors and hang-ups are reported to both callbacks, as select() does
+    if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) { socket.is_rd_ready = true; }
+    if (events[i].events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) { socket.is_wr_ready = true; }
+
+    requeue_socket(fd, socket, false);
+  }
+
+  //! sockets queued by callbacks completion or callbacks updates are handled in the same pass
+  std::vector<fd_t> ready_fds;
+  ready_fds.swap(m_ready_fds);
+
+  for (const auto& fd : ready_fds) {
+    auto it = m_tracked_sockets.find(fd);
+
+    if (it == m_tracked_sockets.end()) { continue; }
+
+    it->second.is_queued = false;
+    dispatch_ready_socket(it);
+  }
+
+  //! give the allocated capacity back for the next pass
+  if (m_ready_fds.empty()) {
+    ready_fds.clear();
+    m_ready_fds.swap(ready_fds);
+  }
+#else
+  (void) events;
+  (void) nb_events;
+#endif /* __TACOPIE_USE_EPOLL */
+}
+
+void
+io_service::dispatch_ready_socket(std::unordered_map<fd_t, tracked_socket>::iterator it) {
+  const auto& fd = it->first;
+  auto& socket   = it->second;
+
+  if (socket.is_rd_ready && socket.rd_callback && !socket.is_executing_rd_callback) {
+    socket.is_rd_ready = false;
+    process_rd_event(fd, socket);
+  }
+  if (socket.is_wr_ready && socket.wr_callback && !socket.is_executing_wr_callback) {
+    socket.is_wr_ready = false;
+    process_wr_event(fd, socket);
+  }
+
+  if (socket.marked_for_untrack && !socket.is_executing_rd_callback && !socket.is_executing_wr_callback) {
+    __TACOPIE_LOG(debug, "untrack socket");
+    erase_tracked_socket(it);
+  }
+}
+
+void
+io_service::requeue_socket(const fd_t& fd, tracked_socket& socket, bool probe) {
+#ifdef __TACOPIE_USE_EPOLL
+  //! the probe gives the current level, which replaces whatever edges were recorded during the callback
+  if (probe) {
+    struct pollfd poll_fd;
+    poll_fd.fd      = fd;
+    poll_fd.events  = POLLIN | POLLOUT;
+    poll_fd.revents = 0;
+
+    if (::poll(&poll_fd, 1, 0) >= 0) {
+      socket.is_rd_ready = (poll_fd.revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+      socket.is_wr_ready = (poll_fd.revents & (POLLOUT | POLLHUP | POLLERR)) != 0;
     }
   }
+
+  bool can_progress = (socket.is_rd_ready && socket.rd_callback) || (socket.is_wr_ready && socket.wr_callback) || socket.marked_for_untrack;
+
+  if (can_progress && !socket.is_queued) {
+    socket.is_queued = true;
+    m_ready_fds.push_back(fd);
+  }
+#else
+  (void) fd;
+  (void) socket;
+  (void) probe;
+#endif /* __TACOPIE_USE_EPOLL */
+}
+
+void
+io_service::register_fd(const fd_t& fd) {
+#ifdef __TACOPIE_USE_EPOLL
+  struct epoll_event event;
+  event.events  = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  event.data.fd = fd;
+
+  if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1 && errno == EEXIST) {
+    epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event);
+  }
+#else
+  (void) fd;
+#endif /* __TACOPIE_USE_EPOLL */
+}
+
+void
+io_service::erase_tracked_socket(std::unordered_map<fd_t, tracked_socket>::iterator it) {
+#ifdef __TACOPIE_USE_EPOLL
+  //! the fd may already be closed, in which case the kernel already dropped it from the set
+  epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, it->first, NULL);
+#endif /* __TACOPIE_USE_EPOLL */
+
+  m_tracked_sockets.erase(it);
+  m_wait_for_removal_condvar.notify_all();
 }
 
 void
@@ -191,8 +375,10 @@ io_service::process_rd_event(const fd_t& fd, tracked_socket& socket) {
 
     if (socket.marked_for_untrack && !socket.is_executing_wr_callback) {
       __TACOPIE_LOG(debug, "untrack socket");
-      m_tracked_sockets.erase(it);
-      m_wait_for_removal_condvar.notify_all();
+      erase_tracked_socket(it);
+    }
+    else {
+      requeue_socket(fd, socket, true);
     }
 
     m_notifier.notify();
@@ -221,8 +407,10 @@ io_service::process_wr_event(const fd_t& fd, tracked_socket& socket) {
 
     if (socket.marked_for_untrack && !socket.is_executing_rd_callback) {
       __TACOPIE_LOG(debug, "untrack socket");
-      m_tracked_sockets.erase(it);
-      m_wait_for_removal_condvar.notify_all();
+      erase_tracked_socket(it);
+    }
+    else {
+      requeue_socket(fd, socket, true);
     }
 
     m_notifier.notify();
@@ -281,12 +469,18 @@ io_service::track(const tcp_socket& socket, const event_callback_t& rd_callback,
 
   __TACOPIE_LOG(debug, "track new socket");
 
+  //! the fd may belong to a closed socket still marked for untrack, which the kernel already dropped from the epoll set
+  register_fd(socket.get_fd());
+
   auto& track_info                    = m_tracked_sockets[socket.get_fd()];
   track_info.rd_callback              = rd_callback;
   track_info.wr_callback              = wr_callback;
   track_info.marked_for_untrack       = false;
   track_info.is_executing_rd_callback = false;
   track_info.is_executing_wr_callback = false;
+  track_info.is_rd_ready              = false;
+  track_info.is_wr_ready              = false;
+  requeue_socket(socket.get_fd(), track_info, false);
 
   m_notifier.notify();
 }
@@ -297,8 +491,13 @@ io_service::set_rd_callback(const tcp_socket& socket, const event_callback_t& ev
 
   __TACOPIE_LOG(debug, "update read socket tracking callback");
 
+  register_fd(socket.get_fd());
+
   auto& track_info       = m_tracked_sockets[socket.get_fd()];
   track_info.rd_callback = event_callback;
+  //! a new callback on an fd marked for untrack is for a new socket reusing it
+  if (event_callback) { track_info.marked_for_untrack = false; }
+  requeue_socket(socket.get_fd(), track_info, false);
 
   m_notifier.notify();
 }
@@ -309,8 +508,13 @@ io_service::set_wr_callback(const tcp_socket& socket, const event_callback_t& ev
 
   __TACOPIE_LOG(debug, "update write socket tracking callback");
 
+  register_fd(socket.get_fd());
+
   auto& track_info       = m_tracked_sockets[socket.get_fd()];
   track_info.wr_callback = event_callback;
+  //! a new callback on an fd marked for untrack is for a new socket reusing it
+  if (event_callback) { track_info.marked_for_untrack = false; }
+  requeue_socket(socket.get_fd(), track_info, false);
 
   m_notifier.notify();
 }
@@ -329,8 +533,7 @@ io_service::untrack(const tcp_socket& socket) {
   }
   else {
     __TACOPIE_LOG(debug, "untrack socket");
-    m_tracked_sockets.erase(it);
-    m_wait_for_removal_condvar.notify_all();
+    erase_tracked_socket(it);
   }
 
   m_notifier.notify();
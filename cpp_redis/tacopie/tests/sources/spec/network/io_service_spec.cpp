@@ -0,0 +1,94 @@
+// MIT License
+//
+// Copyright (c) 2016-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <tacopie/network/tcp_client.hpp>
+#include <tacopie/network/tcp_server.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define TEST_HOST "127.0.0.1"
+#define TEST_PORT 3017
+
+//!
+//! a client reconnecting from inside its read callback gets the fd of the socket it just closed
+//! the io_service still has the old socket tracked, marked for untrack, and must track the new one
+//!
+TEST(IoService, ReconnectInsideReadCallback) {
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::vector<std::shared_ptr<tacopie::tcp_client>> accepted;
+  bool reconnected = false;
+
+  tacopie::tcp_server server;
+  server.start(TEST_HOST, TEST_PORT, [&](const std::shared_ptr<tacopie::tcp_client>& client) {
+    std::lock_guard<std::mutex> lock(mtx);
+    accepted.push_back(client);
+    cv.notify_all();
+    return true;
+  });
+
+  std::promise<std::string> second_read;
+  tacopie::tcp_client client;
+  client.connect(TEST_HOST, TEST_PORT);
+  tacopie::fd_t first_fd = client.get_socket().get_fd();
+
+  client.async_read({1, [&](tacopie::tcp_client::read_result&) {
+                       client.disconnect();
+                       client.connect(TEST_HOST, TEST_PORT);
+                       client.async_read({1, [&](tacopie::tcp_client::read_result& result) {
+                                            second_read.set_value(std::string(result.buffer.begin(), result.buffer.end()));
+                                          }});
+
+                       std::lock_guard<std::mutex> lock(mtx);
+                       reconnected = true;
+                       cv.notify_all();
+                     }});
+
+  std::unique_lock<std::mutex> lock(mtx);
+  ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(2), [&] { return accepted.size() == 1; }));
+  accepted[0]->async_write({{'a'}, nullptr});
+
+  ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(2), [&] { return reconnected && accepted.size() == 2; }));
+  EXPECT_EQ(client.get_socket().get_fd(), first_fd);
+
+  //! let the read callback complete first, so the data is only reported by an edge on the new socket
+  lock.unlock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  accepted[1]->async_write({{'b'}, nullptr});
+
+  auto future = second_read.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  EXPECT_EQ(future.get(), "b");
+
+  client.disconnect(true);
+  for (const auto& c : accepted) { c->disconnect(true); }
+  server.stop(true);
+}
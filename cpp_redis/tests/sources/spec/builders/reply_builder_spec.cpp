@@ -0,0 +1,167 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/array_builder.hpp>
+#include <cpp_redis/builders/bulk_string_builder.hpp>
+#include <cpp_redis/builders/error_builder.hpp>
+#include <cpp_redis/builders/integer_builder.hpp>
+#include <cpp_redis/builders/reply_builder.hpp>
+#include <cpp_redis/builders/simple_string_builder.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <gtest/gtest.h>
+
+TEST(ReplyBuilder, WithNoData) {
+  cpp_redis::builders::reply_builder builder;
+
+  EXPECT_EQ(false, builder.reply_available());
+}
+
+TEST(ReplyBuilder, WithNotEnoughData) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "*1\r\n";
+
+  EXPECT_EQ(false, builder.reply_available());
+}
+
+TEST(ReplyBuilder, WithPartOfEndSequence) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "*1\r\n+hello\r";
+
+  EXPECT_EQ(false, builder.reply_available());
+}
+
+TEST(ReplyBuilder, WithAllInOneTime) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "*4\r\n+simple_string\r\n-error\r\n:42\r\n$5\r\nhello\r\n";
+
+  EXPECT_EQ(true, builder.reply_available());
+
+  auto reply = builder.get_front();
+  EXPECT_TRUE(reply.is_array());
+
+  auto array = reply.as_array();
+  EXPECT_EQ(4U, array.size());
+
+  auto row_1 = array[0];
+  EXPECT_TRUE(row_1.is_simple_string());
+  EXPECT_EQ("simple_string", row_1.as_string());
+
+  auto row_2 = array[1];
+  EXPECT_TRUE(row_2.is_error());
+  EXPECT_EQ("error", row_2.as_string());
+
+  auto row_3 = array[2];
+  EXPECT_TRUE(row_3.is_integer());
+  EXPECT_EQ(42, row_3.as_integer());
+
+  auto row_4 = array[3];
+  EXPECT_TRUE(row_4.is_bulk_string());
+  EXPECT_EQ("hello", row_4.as_string());
+}
+
+TEST(ReplyBuilder, WithAllInMultipleTimes) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "*4\r\n+simple_string\r";
+  builder << "\n-error\r\n:42\r\n";
+  ;
+  builder << "$5\r\nhello\r\n";
+
+  EXPECT_EQ(true, builder.reply_available());
+
+  auto reply = builder.get_front();
+  EXPECT_TRUE(reply.is_array());
+
+  auto array = reply.as_array();
+  EXPECT_EQ(4U, array.size());
+
+  auto row_1 = array[0];
+  EXPECT_TRUE(row_1.is_simple_string());
+  EXPECT_EQ("simple_string", row_1.as_string());
+
+  auto row_2 = array[1];
+  EXPECT_TRUE(row_2.is_error());
+  EXPECT_EQ("error", row_2.as_string());
+
+  auto row_3 = array[2];
+  EXPECT_TRUE(row_3.is_integer());
+  EXPECT_EQ(42, row_3.as_integer());
+
+  auto row_4 = array[3];
+  EXPECT_TRUE(row_4.is_bulk_string());
+  EXPECT_EQ("hello", row_4.as_string());
+}
+
+TEST(ReplyBuilder, WithPipelinedRepliesSplitAtEveryByte) {
+  cpp_redis::builders::reply_builder builder;
+
+  std::string bulk(5000, 'x');
+  std::string response;
+  for (int i = 0; i < 10; ++i) {
+    response += "$" + std::to_string(bulk.size()) + "\r\n" + bulk + "\r\n";
+    response += "*2\r\n:" + std::to_string(i) + "\r\n$-1\r\n";
+  }
+
+  std::size_t nb_replies = 0;
+  for (char c : response) {
+    builder << std::string(1, c);
+
+    while (builder.reply_available()) {
+      auto reply = builder.get_front();
+      builder.pop_front();
+
+      if (nb_replies % 2 == 0) {
+        EXPECT_TRUE(reply.is_bulk_string());
+        EXPECT_EQ(bulk, reply.as_string());
+      }
+      else {
+        EXPECT_TRUE(reply.is_array());
+        EXPECT_EQ(2U, reply.as_array().size());
+        EXPECT_EQ(static_cast<int64_t>(nb_replies / 2), reply.as_array()[0].as_integer());
+        EXPECT_TRUE(reply.as_array()[1].is_null());
+      }
+
+      ++nb_replies;
+    }
+  }
+
+  EXPECT_EQ(20U, nb_replies);
+}
+
+TEST(ReplyBuilder, WithReplyFollowedByPartialReply) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "+OK\r\n$5\r\nhel";
+
+  EXPECT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.get_front().as_string());
+  builder.pop_front();
+  EXPECT_EQ(false, builder.reply_available());
+
+  builder << "lo\r\n";
+
+  EXPECT_EQ(true, builder.reply_available());
+  EXPECT_EQ("hello", builder.get_front().as_string());
+}
@@ -0,0 +1,146 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_view_builder.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <gtest/gtest.h>
+
+TEST(ReplyViewBuilder, WithNoData) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  EXPECT_EQ(false, builder.reply_available());
+}
+
+TEST(ReplyViewBuilder, WithNotEnoughData) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  builder << "*2\r\n$5\r\nhello\r\n$5\r\nwor";
+
+  EXPECT_EQ(false, builder.reply_available());
+}
+
+TEST(ReplyViewBuilder, WithAllInOneTime) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  builder << "*5\r\n+simple_string\r\n-error\r\n:-42\r\n$5\r\nhello\r\n$-1\r\n";
+
+  EXPECT_EQ(true, builder.reply_available());
+
+  auto reply = builder.get_front();
+  EXPECT_TRUE(reply.is_array());
+  EXPECT_EQ(5U, reply.size());
+
+  EXPECT_TRUE(reply[0].is_simple_string());
+  EXPECT_EQ("simple_string", reply[0].as_string().str());
+  EXPECT_TRUE(reply[1].is_error());
+  EXPECT_EQ("error", reply[1].error().str());
+  EXPECT_TRUE(reply[2].is_integer());
+  EXPECT_EQ(-42, reply[2].as_integer());
+  EXPECT_TRUE(reply[3].is_bulk_string());
+  EXPECT_EQ("hello", reply[3].as_string().str());
+  EXPECT_TRUE(reply[4].is_null());
+
+  EXPECT_THROW(reply[5], cpp_redis::redis_error);
+  EXPECT_THROW(reply[3].as_integer(), cpp_redis::redis_error);
+}
+
+TEST(ReplyViewBuilder, WithNestedArrays) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  //! XRANGE-like reply: [[id, [field, value, field, value]], [id, []]]
+  builder << "*2\r\n*2\r\n$3\r\n1-0\r\n*4\r\n$1\r\na\r\n$1\r\n1\r\n$1\r\nb\r\n$1\r\n2\r\n*2\r\n$3\r\n2-0\r\n*0\r\n";
+
+  ASSERT_TRUE(builder.reply_available());
+
+  auto reply = builder.get_front();
+  ASSERT_EQ(2U, reply.size());
+  EXPECT_EQ("1-0", reply[0][0].as_string().str());
+  ASSERT_EQ(4U, reply[0][1].size());
+  EXPECT_EQ("b", reply[0][1][2].as_string().str());
+  EXPECT_EQ("2", reply[0][1][3].as_string().str());
+  EXPECT_EQ("2-0", reply[1][0].as_string().str());
+  EXPECT_TRUE(reply[1][1].is_array());
+  EXPECT_EQ(0U, reply[1][1].size());
+}
+
+TEST(ReplyViewBuilder, WithPipelinedRepliesSplitAtEveryByte) {
+  const std::string data = "+OK\r\n*3\r\n$3\r\nfoo\r\n*1\r\n:7\r\n$0\r\n\r\n-ERR\r\n";
+
+  for (std::size_t split = 1; split < data.size(); ++split) {
+    cpp_redis::builders::reply_view_builder builder;
+    std::vector<cpp_redis::reply_view> replies;
+
+    for (std::size_t i = 0; i < data.size(); i += split) {
+      builder << data.substr(i, split);
+
+      while (builder.reply_available()) {
+        replies.push_back(builder.get_front());
+        builder.pop_front();
+      }
+    }
+
+    ASSERT_EQ(3U, replies.size()) << "split " << split;
+    EXPECT_EQ("OK", replies[0].as_string().str());
+    EXPECT_EQ("foo", replies[1][0].as_string().str());
+    EXPECT_EQ(7, replies[1][1][0].as_integer());
+    EXPECT_TRUE(replies[1][2].as_string().empty());
+    EXPECT_EQ("ERR", replies[2].error().str());
+  }
+}
+
+TEST(ReplyViewBuilder, ViewsOutliveBuilderData) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  builder << "$5\r\nhello\r\n$3\r\nfo";
+  auto first = builder.get_front();
+  builder.pop_front();
+
+  //! appending after a view was handed out must not move the bytes it references
+  const char* data = first.as_string().data();
+  builder << "o\r\n";
+  EXPECT_EQ(data, first.as_string().data());
+  EXPECT_EQ("hello", first.as_string().str());
+  EXPECT_EQ("foo", builder.get_front().as_string().str());
+
+  builder.reset();
+  EXPECT_EQ("hello", first.as_string().str());
+}
+
+TEST(ReplyViewBuilder, ToReply) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  builder << "*3\r\n$5\r\nhello\r\n:1\r\n*1\r\n+OK\r\n";
+
+  auto reply = builder.get_front().to_reply();
+  ASSERT_TRUE(reply.is_array());
+  ASSERT_EQ(3U, reply.as_array().size());
+  EXPECT_EQ("hello", reply.as_array()[0].as_string());
+  EXPECT_TRUE(reply.as_array()[0].is_bulk_string());
+  EXPECT_EQ(1, reply.as_array()[1].as_integer());
+  EXPECT_EQ("OK", reply.as_array()[2].as_array()[0].as_string());
+}
+
+TEST(ReplyViewBuilder, WithInvalidData) {
+  cpp_redis::builders::reply_view_builder builder;
+
+  EXPECT_THROW(builder << "?\r\n", cpp_redis::redis_error);
+}
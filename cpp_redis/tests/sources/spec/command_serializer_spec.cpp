@@ -0,0 +1,64 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/network/command_serializer.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(CommandSerializer, SerializeCommand) {
+  std::vector<std::string> cmd = {"SET", "key", ""};
+  std::string buffer;
+
+  cpp_redis::network::serialize_command(buffer, cmd.begin(), cmd.end());
+  EXPECT_EQ(buffer, "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$0\r\n\r\n");
+  EXPECT_EQ(buffer.size(), cpp_redis::network::command_size(cmd.begin(), cmd.end()));
+}
+
+TEST(CommandSerializer, AppendsToExistingBuffer) {
+  std::vector<std::string> cmd = {"PING"};
+  std::string buffer = "*1\r\n$4\r\nPING\r\n";
+
+  cpp_redis::network::serialize_command(buffer, cmd.begin(), cmd.end());
+  EXPECT_EQ(buffer, "*1\r\n$4\r\nPING\r\n*1\r\n$4\r\nPING\r\n");
+}
+
+TEST(CommandSerializer, MultiDigitLengths) {
+  std::vector<std::string> cmd(12, std::string(1234, 'x'));
+  std::string buffer;
+
+  cpp_redis::network::serialize_command(buffer, cmd.begin(), cmd.end());
+  EXPECT_EQ(buffer.compare(0, 13, "*12\r\n$1234\r\nx"), 0);
+  EXPECT_EQ(buffer.size(), 5 + 12 * (7 + 1234 + 2));
+}
+
+TEST(CommandSerializer, ReusesBufferCapacity) {
+  std::vector<std::string> cmd = {"HSET", "key", "field", "value"};
+  std::string buffer;
+
+  cpp_redis::network::serialize_command(buffer, cmd.begin(), cmd.end());
+  buffer.clear();
+  auto capacity = buffer.capacity();
+  cpp_redis::network::serialize_command(buffer, cmd.begin(), cmd.end());
+  EXPECT_EQ(buffer.capacity(), capacity);
+}
@@ -0,0 +1,203 @@
+#ifndef DIAG_ALERTS_H
+#define DIAG_ALERTS_H
+
+// DiagMsg1 decoding against a model's Fault/Warning tables.
+//
+// DiagAlertIndex hashes the alert records of a model by DTC key (SPN
+// MSB/ISB/LSB and FMI); it is built once per model and shared by every
+// device of that model, so matching a reported DTC is a single hash lookup
+// instead of a scan of the tables.
+//
+// Each DiagMsg1 is a snapshot of the DTCs a node currently has active.
+// DiagAlertTracker keeps the per-device alert set: an alert is raised after
+// DIAG_ALERT_RAISE_COUNT consecutive messages report it and cleared after
+// DIAG_ALERT_CLEAR_COUNT consecutive messages don't, and fnUpdate() only
+// returns true when the published set changed.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "json.hpp"
+#include "model_profile.h"
+#include "rvcudefs.h"
+
+#define DIAG_ALERT_RAISE_COUNT 2
+#define DIAG_ALERT_CLEAR_COUNT 3
+
+class DiagAlertIndex {
+public:
+    struct Alert {
+        const ProfileAlertRec* rec;
+        std::string_view condition;
+        bool fault;
+    };
+
+    explicit DiagAlertIndex(const ModelProfile& profile) {
+        fnAdd(profile, profile.fnFaultsBegin(), profile.fnFaultsEnd(), true);
+        fnAdd(profile, profile.fnWarningsBegin(), profile.fnWarningsEnd(), false);
+
+        std::stable_sort(alerts.begin(), alerts.end(), [](const Alert& a, const Alert& b) {
+            return fnRecKey(a.rec) < fnRecKey(b.rec);
+        });
+        buckets.reserve(alerts.size());
+        for (uint32_t i = 0; i < alerts.size(); ++i) {
+            auto& bucket = buckets.try_emplace(fnRecKey(alerts[i].rec), i, 0).first->second;
+            bucket.second++;
+        }
+    }
+
+    const Alert& operator[](uint32_t id) const {
+        return alerts[id];
+    }
+
+    // Call fn(id) for every alert matching a reported DTC. An unset (-1) SPN
+    // ISB in the tables is a DSA-specific SPN that matches any reported ISB.
+    template <typename Fn>
+    void fnForEach(int spn_msb, int spn_isb, int spn_lsb, int fmi, Fn&& fn) const {
+        fnForBucket(fnKey(spn_msb, spn_isb, spn_lsb, fmi), fn);
+        if (spn_isb != -1) {
+            fnForBucket(fnKey(spn_msb, -1, spn_lsb, fmi), fn);
+        }
+    }
+
+private:
+    // Each field is a byte or -1, stored biased by one in 9 bits
+    static uint64_t fnKey(int spn_msb, int spn_isb, int spn_lsb, int fmi) {
+        return (uint64_t(spn_msb + 1) & 0x1ff) << 27 | (uint64_t(spn_isb + 1) & 0x1ff) << 18
+             | (uint64_t(spn_lsb + 1) & 0x1ff) << 9 | (uint64_t(fmi + 1) & 0x1ff);
+    }
+
+    static uint64_t fnRecKey(const ProfileAlertRec* rec) {
+        return fnKey(rec->spn_msb, rec->spn_isb, rec->spn_lsb, rec->fmi);
+    }
+
+    void fnAdd(const ModelProfile& profile, const ProfileAlertRec* begin, const ProfileAlertRec* end, bool fault) {
+        for (const ProfileAlertRec* rec = begin; rec != end; ++rec) {
+            alerts.push_back({rec, profile.fnCondition(rec), fault});
+        }
+    }
+
+    template <typename Fn>
+    void fnForBucket(uint64_t key, Fn& fn) const {
+        auto it = buckets.find(key);
+        if (it != buckets.end()) {
+            for (uint32_t id = it->second.first; id != it->second.first + it->second.second; ++id) {
+                fn(id);
+            }
+        }
+    }
+
+    std::vector<Alert> alerts;  // sorted by DTC key
+    std::unordered_map<uint64_t, std::pair<uint32_t, uint32_t>> buckets;  // DTC key -> first alert, count
+};
+
+// Shared index of a model, built on first use
+inline const DiagAlertIndex& fnGetDiagAlertIndex(const ModelProfile& profile) {
+    static std::mutex index_mutex;
+    static std::unordered_map<std::string_view, std::unique_ptr<DiagAlertIndex>> indexes;
+
+    std::lock_guard<std::mutex> lock(index_mutex);
+    auto& index = indexes[profile.fnName()];
+    if (!index) {
+        index = std::make_unique<DiagAlertIndex>(profile);
+    }
+    return *index;
+}
+
+class DiagAlertTracker {
+public:
+    // Only a change of model resets the alert set. A device announces its
+    // ProdIdent again periodically, to other controllers' requests and after
+    // an address change, and an alert already published must still be
+    // cleared when it goes away.
+    void fnSetProfile(const ModelProfile& profile) {
+        const DiagAlertIndex* profile_index = profile ? &fnGetDiagAlertIndex(profile) : nullptr;
+        if (profile_index != index) {
+            index = profile_index;
+            states.clear();
+        }
+    }
+
+    // Apply one DiagMsg1; true if the set of active alerts changed
+    bool fnUpdate(const RVC_tzPGN_DIAG_MSG1& msg) {
+        if (index == nullptr) {
+            return false;
+        }
+
+        bool changed = false;
+        serial++;
+        for (uint16 i = 0; i < msg.uiExtraCount; i++) {
+            const RVC_tzPGN_EXTRA_DIAG_MSG1& dtc = msg.ptzExtra[i];
+            index->fnForEach(dtc.ucSpnMsb, dtc.ucSpnIsb, dtc.ucSpnLsb, dtc.teFmi, [&](uint32_t id) {
+                State& state = states[id];
+                if (state.serial == serial) {
+                    return;
+                }
+                state.serial = serial;
+                state.misses = 0;
+                if (!state.active && ++state.hits >= DIAG_ALERT_RAISE_COUNT) {
+                    state.active = true;
+                    changed = true;
+                }
+            });
+        }
+
+        for (auto it = states.begin(); it != states.end();) {
+            State& state = it->second;
+            if (state.serial != serial) {
+                state.hits = 0;
+                if (!state.active || ++state.misses >= DIAG_ALERT_CLEAR_COUNT) {
+                    changed |= state.active;
+                    it = states.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+        return changed;
+    }
+
+    // {"faults": [{"code": ..., "desc": ...}], "warnings": [...]}, ordered by code
+    std::string fnJson() const {
+        std::vector<const DiagAlertIndex::Alert*> active;
+        for (const auto& [id, state] : states) {
+            if (state.active) {
+                active.push_back(&(*index)[id]);
+            }
+        }
+        std::sort(active.begin(), active.end(), [](const auto* a, const auto* b) {
+            return a->rec->code < b->rec->code;
+        });
+
+        nlohmann::json alerts;
+        alerts["faults"] = nlohmann::json::array();
+        alerts["warnings"] = nlohmann::json::array();
+        for (const auto* alert : active) {
+            nlohmann::json entry = {
+                {"code", alert->rec->code},
+                {"desc", std::string(alert->condition)}
+            };
+            alerts[alert->fault ? "faults" : "warnings"].push_back(entry);
+        }
+        return alerts.dump();
+    }
+
+private:
+    struct State {
+        uint32_t serial = 0;  // last DiagMsg1 reporting the alert
+        uint8_t hits = 0;
+        uint8_t misses = 0;
+        bool active = false;
+    };
+
+    const DiagAlertIndex* index = nullptr;
+    std::unordered_map<uint32_t, State> states;  // alert id -> debounce state
+    uint32_t serial = 0;
+};
+
+#endif // DIAG_ALERTS_H
@@ -8440,7 +8440,8 @@ def generate_cpp_code(model_map):
     # Define necessary types
     gg = {""}
     global c_map, p_map
-    cpp_code += """
+    cpp_code += """#pragma once
+
 #include <unordered_map>
 #include <vector>
 #include <tuple>
@@ -8549,6 +8550,7 @@ using Model_Map = std::unordered_map<std::string, Model>;
     print(p_map)
     return cpp_code, cpp_code2
 
+import os
 import re
 
 def extract_structs(header_file):
@@ -8704,12 +8706,12 @@ def gen2(signal, field_name, lines, field_type, lines2, first, lines4):
             lines.append(f'            snprintf(buffer, sizeof(buffer), "??%d??", {field_name});')
             lines.append(f'            s += (buffer);')
         else:
-            lines.append(f'            if (ENUMLOOKUP[{signal["ddid"]}].find({field_name}) == ENUMLOOKUP[{signal["ddid"]}].end()) {{')
+            lines.append(f'            if (!{enum_table_name(signal["ddid"])}.fnContains({field_name})) {{')
             lines.append(f'                 char buffer[50];')
             lines.append(f'                 snprintf(buffer, sizeof(buffer), "??%d??", {field_name});')
             lines.append(f'                 s += (buffer);')
             lines.append(f'            }} else {{')
-            lines.append(f'                 s += ENUMLOOKUP[{signal["ddid"]}][{field_name}];')
+            lines.append(f'                 s += {enum_table_name(signal["ddid"])}.fnText({field_name});')
             lines.append("              }")
     elif signal["typename"] == "bit(n)":
         if (signal["units"] and (signal["units"] != 'characters')):
@@ -8878,14 +8880,14 @@ def gen(signal, field_name, lines, lines2, first, lines4, lines5, lines8):
             lines.append(f'            snprintf(buffer, sizeof(buffer), "??%d??", msg.{field_name});')
             lines.append(f'            return (buffer);')
         else:
-            lines.append(f'            if (ENUMLOOKUP[{signal["ddid"]}].find(msg.{field_name}) == ENUMLOOKUP[{signal["ddid"]}].end()) {{')
+            lines.append(f'            if (!{enum_table_name(signal["ddid"])}.fnContains(msg.{field_name})) {{')
             lines.append(f'                 char buffer[50];')
             lines.append(f'                 snprintf(buffer, sizeof(buffer), "??%d??", msg.{field_name});')
             lines.append(f'                 return (buffer);')
             lines.append(f'            }} else {{')
-            lines.append(f'                 return ENUMLOOKUP[{signal["ddid"]}][msg.{field_name}];')
+            lines.append(f'                 return std::string({enum_table_name(signal["ddid"])}.fnText(msg.{field_name}));')
             lines.append("              }")
-        lines5.append(f'     int enumValue = findEnumValue(ENUMLOOKUP[{signal["ddid"]}], value);')
+        lines5.append(f'     int enumValue = findEnumValue({enum_table_name(signal["ddid"])}, value);')
         lines5.append(f'     if (enumValue != -1) msg.{field_name} = static_cast<decltype(msg.{field_name})>(enumValue);')
         lines5.append(f'     else msg.{field_name} = static_cast<decltype(msg.{field_name})>(stringToInt(value, 0, 0, 0));')
     elif signal["typename"] == "bit(n)":
@@ -8928,6 +8930,26 @@ def gen(signal, field_name, lines, lines2, first, lines4, lines5, lines8):
     lines8.append(f'        }}')
 
 classes = []
+class_definitions = {}  # class name -> out-of-line member definitions
+
+# Message families with a translation unit of their own; the other classes go
+# to print_functions3/pgn_common.cpp
+SHARD_FAMILIES = ['ac', 'ags', 'batt', 'chg', 'dc', 'gen', 'inv', 'iso', 'pm', 'scc']
+SHARD_DIR = 'print_functions3'
+
+def shard_name(class_name):
+    family = re.match(r'[A-Z][a-z]*', class_name).group(0).lower()
+    return family if family in SHARD_FAMILIES else 'common'
+
+def split_method(class_name, method):
+    # '    void Print() const override {' + body -> the declaration for the
+    # class and the qualified definition, without default arguments
+    match = re.match(r'\s*(.*?)\b(\w+)\((.*)\)(\s*const)?\s+override \{$', method[0])
+    ret, name, args, const = match.groups()
+    declaration = method[0].rstrip()[:-len(' {')] + ';'
+    args = re.sub(r'\s*=\s*"[^"]*"', '', args)
+    definition = [f'{ret}{class_name}::{name}({args}){const or ""} {{'] + method[1:]
+    return declaration, '\n'.join(definition)
 
     # RVC_tzPGN_PROD_IDENT msg;
     # ProdIdent() {    }
@@ -8956,15 +8978,16 @@ def generate_class_definition(struct_name, typedef_name, fields, struct_name2=No
     lines.append(f'{typedef_name} msg;')
     lines.append(f'{class_name} () {{  memset(&msg, 0xFF, sizeof(msg));  }};')
     lines.append(f'{class_name} (void * pvStruct) {{  msg = *({typedef_name} *)pvStruct;  }};')
+    head_len = len(lines)
         
     # Add print function
     lines2 = [f'    void Print() const override {{']
     lines4 = [f'    uint32 fnGetRawValue(const std::string mnem) const override {{']
-    lines5 = [f'    void fnSetValue(const std::string mnem, const std::string value) override {{']
+    lines5 = [f'    void fnSetValue(const std::string& mnem, const std::string& value) override {{']
     lines6 = [f'    void fnSend(uint32 pgn, int grpfunc, int addr) override {{']
     lines6.append(f'        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );')
     lines6.append("    }")
-    lines7 = [f'    string fnTranslate(string func, const string param_value="") const override {{']
+    lines7 = [f'    string fnTranslate(const string& func, const string& param_value="") const override {{']
     lines8 = [f'    long double fnGetFloatValue(const std::string mnem) const override {{']
     # p_map.update(c_map)
     # Merging two dictionaries using the update() method
@@ -8974,7 +8997,7 @@ def generate_class_definition(struct_name, typedef_name, fields, struct_name2=No
         print("8962")
         print(class_name)
         lines7.insert(0, '#include "translate_functions.h"\n')
-        for value in merged_map[class_name.lower()]:
+        for value in sorted(merged_map[class_name.lower()]):
             # for value in v:
             lines7.append(f'        if (func == "{value}") return {value}(param_value);')
         # for value in c_map[class_name].items():
@@ -8988,7 +9011,7 @@ def generate_class_definition(struct_name, typedef_name, fields, struct_name2=No
         for fi in updated_data:
             fields.append(fi)
 
-    lines.append(f'    std::string fnGetValue(const std::string mnem) const override {{')
+    lines.append(f'    std::string fnGetValue(const std::string& mnem) const override {{')
     
     found = False
     found2 = False
@@ -9122,10 +9145,10 @@ def generate_class_definition(struct_name, typedef_name, fields, struct_name2=No
     lines8.append('        return 0.0;')
 
     
-    lines3 = ["    bool fnQualPasses(std::vector<std::tuple<std::string, std::string>> qual) const override {"]
+    lines3 = ["    bool fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const override {"]
     lines3.append("        for (const auto& qualtup : qual) {")
-    lines3.append("           std::string sig = std::get<0>(qualtup);")
-    lines3.append("          std::string testval = std::get<1>(qualtup);")
+    lines3.append("           const std::string& sig = std::get<0>(qualtup);")
+    lines3.append("          const std::string& testval = std::get<1>(qualtup);")
     lines3.append("         std::string val = fnGetValue(sig);")
     lines3.append("    ")
     lines3.append("            if (testval != val) {")
@@ -9142,42 +9165,171 @@ def generate_class_definition(struct_name, typedef_name, fields, struct_name2=No
     lines5.append('    }')
     lines8.append('    }')
 
-    lines.extend(lines2)
-    lines.extend(lines3)
-    lines.extend(lines4)
-    lines.extend(lines5)
-    lines.extend(lines6)
-    lines.extend(lines7)
-    lines.extend(lines8)
+    # The class declaration goes to the header, the member definitions to
+    # the translation unit of the class's family
+    declaration = lines[:head_len]
+    definitions = []
+    for method in [lines[head_len:], lines2, lines3, lines4, lines5, lines6, lines7, lines8]:
+        if method[0].startswith('#include'):
+            declaration.append(method[0].rstrip('\n'))
+            method = method[1:]
+        method_declaration, method_definition = split_method(class_name, method)
+        declaration.append(method_declaration)
+        definitions.append(method_definition)
+    declaration.append(f'}} {class_name};')
+    class_definitions[class_name] = '\n'.join(definitions)
 
-    lines.append(f'}} {class_name};')
+    return '\n'.join(declaration)
 
-    
-    return '\n'.join(lines)
+def enum_table_name(ddid):
+    return f"ENUMLOOKUP_{ddid}" if ddid >= 0 else f"ENUMLOOKUP_N{-ddid}"
+
+def enum_hash(text, seed):
+    # Must match fnEnumHash() in the generated header (seeded FNV-1a, then mixed)
+    h = (2166136261 ^ seed) & 0xffffffff
+    for byte in text.encode('utf-8'):
+        h ^= byte
+        h = (h * 16777619) & 0xffffffff
+    h ^= h >> 16
+    h = (h * 0x45d9f3b) & 0xffffffff
+    return h ^ (h >> 16)
+
+def enum_perfect_hash(texts):
+    # Hash and displace: texts are bucketed by fnEnumHash(text, 0), then each
+    # bucket, largest first, gets the smallest seed that puts all of its texts
+    # in free slots of the table.
+    size = 2
+    while size < 2 * len(texts):
+        size *= 2
+    mask = size - 1
+
+    buckets = [[] for _ in range(size)]
+    for index, text in enumerate(texts):
+        buckets[enum_hash(text, 0) & mask].append(index)
+
+    seeds = [0] * size
+    slots = [-1] * size
+    for bucket in sorted(range(size), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            break
+        seed = 1
+        while True:
+            wanted = [enum_hash(texts[index], seed) & mask for index in buckets[bucket]]
+            if len(set(wanted)) == len(wanted) and all(slots[slot] == -1 for slot in wanted):
+                break
+            seed += 1
+            if seed > 0xffff:
+                raise ValueError("No perfect hash found for enum table")
+        seeds[bucket] = seed
+        for index, slot in zip(buckets[bucket], wanted):
+            slots[slot] = index
+
+    return mask, seeds, slots
+
+def generate_enum_tables(enumlookup):
+    # Every DDID becomes a constexpr EnumTable: entries sorted by code, a dense
+    # code -> entry index table for formatting and a perfect hash of the texts
+    # for command parsing, so neither direction allocates or scans. Returns the
+    # types and extern declarations for the header and the tables themselves.
+    out = []
+    tables = []
+    out.append("struct EnumEntry {")
+    out.append("    int code;")
+    out.append("    std::string_view text;")
+    out.append("};")
+    out.append("")
+    out.append("constexpr uint32_t fnEnumHash(std::string_view text, uint32_t seed) {")
+    out.append("    uint32_t hash = 2166136261u ^ seed;")
+    out.append("    for (char c : text) {")
+    out.append("        hash ^= static_cast<unsigned char>(c);")
+    out.append("        hash *= 16777619u;")
+    out.append("    }")
+    out.append("    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;  // fold the high bits into the slot bits")
+    out.append("    return hash ^ (hash >> 16);")
+    out.append("}")
+    out.append("")
+    out.append("struct EnumTable {")
+    out.append("    const EnumEntry* entries;  // sorted by code")
+    out.append("    int base;                  // code of dense[0]")
+    out.append("    uint32_t dense_size;")
+    out.append("    const int16_t* dense;      // code - base -> entry index, -1 if unused")
+    out.append("    uint32_t mask;")
+    out.append("    const uint16_t* seeds;     // fnEnumHash(text, 0) & mask -> bucket seed")
+    out.append("    const int16_t* slots;      // fnEnumHash(text, seed) & mask -> entry index, -1 if empty")
+    out.append("")
+    out.append("    constexpr int16_t fnIndex(int code) const {")
+    out.append("        uint32_t offset = static_cast<uint32_t>(code) - static_cast<uint32_t>(base);")
+    out.append("        return offset < dense_size ? dense[offset] : -1;")
+    out.append("    }")
+    out.append("    constexpr bool fnContains(int code) const {")
+    out.append("        return fnIndex(code) >= 0;")
+    out.append("    }")
+    out.append("    // Text of a code, empty if the code is not in the table")
+    out.append("    constexpr std::string_view fnText(int code) const {")
+    out.append("        int16_t index = fnIndex(code);")
+    out.append("        return index >= 0 ? entries[index].text : std::string_view();")
+    out.append("    }")
+    out.append("    // Code of a text, -1 if the text is not in the table")
+    out.append("    constexpr int fnCode(std::string_view text) const {")
+    out.append("        uint32_t seed = seeds[fnEnumHash(text, 0) & mask];")
+    out.append("        int16_t index = slots[fnEnumHash(text, seed) & mask];")
+    out.append("        return (index >= 0 && entries[index].text == text) ? entries[index].code : -1;")
+    out.append("    }")
+    out.append("};")
+    out.append("")
+
+    tables.append('#include "print_functions3.h"')
+    tables.append("")
+    for ddid, values in enumlookup.items():
+        name = enum_table_name(ddid)
+        entries = sorted(values.items())
+        texts = [text for code, text in entries]
+        base = entries[0][0]
+        dense = [-1] * (entries[-1][0] - base + 1)
+        for index, (code, text) in enumerate(entries):
+            dense[code - base] = index
+        mask, seeds, slots = enum_perfect_hash(texts)
+
+        out.append(f"extern const EnumTable {name};")
+        tables.append(f"constexpr EnumEntry {name}_ENTRIES[] = {{")
+        for code, text in entries:
+            tables.append(f"    {{{code}, \"{text}\"}},")
+        tables.append("};")
+        tables.append(f"constexpr int16_t {name}_DENSE[] = {{{', '.join(map(str, dense))}}};")
+        tables.append(f"constexpr uint16_t {name}_SEEDS[] = {{{', '.join(map(str, seeds))}}};")
+        tables.append(f"constexpr int16_t {name}_SLOTS[] = {{{', '.join(map(str, slots))}}};")
+        tables.append(f"constexpr EnumTable {name} = {{{name}_ENTRIES, {base}, {len(dense)}, {name}_DENSE, {mask}, {name}_SEEDS, {name}_SLOTS}};")
+        tables.append("")
+
+    return '\n'.join(out) + '\n', '\n'.join(tables) + '\n'
 
 def main(header_file, output_file):
+    # Writes the header; returns the global tables for print_functions3/tables.cpp
     structs = extract_structs(header_file)
     
     with open(output_file, 'w') as file:
-        file.write('#include <iostream>\n#include "rvcudefs.h" \n#include "xbudefs.h" \n#include "xbgdefs.h" \n#include "xbwincb.h" \n#include "pgnudefs.h" \n #include <unordered_map>\n #include <tuple>\n #include <utility>\n #include <map> \n #include <memory> \n #include <functional>\n using namespace std;\n')
+        file.write('// Auto-generated by generate_print_functions.py. Declarations of the RV-C\n// message classes and tables; the definitions are in print_functions3/*.cpp.\n')
+        file.write('#ifndef PRINT_FUNCTIONS3_H\n#define PRINT_FUNCTIONS3_H\n\n')
+        file.write('#include <iostream>\n#include "rvcudefs.h" \n#include "xbudefs.h" \n#include "xbgdefs.h" \n#include "xbwincb.h" \n#include "pgnudefs.h" \n #include <unordered_map>\n #include <tuple>\n #include <utility>\n #include <map> \n #include <memory> \n #include <functional>\n #include <cstring>\n #include <vector>\n #include <cmath>\n #include <cstdint>\n #include <string_view>\n #include <charconv>\n #include <cctype>\n using namespace std;\n')
         
-        file.write("std::unordered_map<std::string, std::pair<int, int>> PGNREVERSE = {\n")
+        tables_code = "std::unordered_map<std::string, std::pair<int, int>> PGNREVERSE = {\n"
         for x, (y,z) in PGNREVERSE.items():
             if z == None:
-                file.write(f"{{ \"{x}\" , {{{y}, -1}} }},\n")
+                tables_code += f"{{ \"{x}\" , {{{y}, -1}} }},\n"
             else:
-                file.write(f"{{ \"{x}\" , {{{y}, {z}}} }},\n")
-        file.write("};\n\n")
+                tables_code += f"{{ \"{x}\" , {{{y}, {z}}} }},\n"
+        tables_code += "};\n\n"
+        file.write("extern std::unordered_map<std::string, std::pair<int, int>> PGNREVERSE;\n")
+        file.write("extern std::map<std::tuple<int, int>, std::string> PGNTABLE;\n")
+        file.write("extern std::map<std::tuple<int, int, int>, std::string> global_spns;\n")
+        file.write("extern std::map<int, std::map<std::tuple<int, int>, std::string>> spn_mapping;\n\n")
+
+        enum_header, enum_tables = generate_enum_tables(ENUMLOOKUP)
+        file.write(enum_header)
+        with open(f'{SHARD_DIR}/enum_tables.cpp', 'w') as tables_file:
+            tables_file.write('// Auto-generated by generate_print_functions.py: DDID enum tables\n')
+            tables_file.write(enum_tables)
 
-        file.write("std::unordered_map<int, std::unordered_map<int, std::string>> ENUMLOOKUP = {\n")
-        for x, y in ENUMLOOKUP.items():
-            file.write(f"{{{x}, ")
-            file.write("{")
-            for g_key, g_value in y.items():
-                file.write(f"{{{g_key}, \"{g_value}\"}}, ")
-            file.write("}")
-            file.write("},\n")
-        file.write("};\n")
         cpp_code = """
 std::map<std::tuple<int, int, int>, std::string> global_spns = {
 """
@@ -9186,7 +9338,7 @@ std::map<std::tuple<int, int, int>, std::string> global_spns = {
             cpp_code += f'    {{std::make_tuple({key_tuple}), "{value}"}},\n'
 
         cpp_code += '};\n'
-        file.write(cpp_code)
+        tables_code += cpp_code
 
         cpp_code = """
 
@@ -9200,65 +9352,118 @@ std::map<std::tuple<int, int, int>, std::string> global_spns = {
             cpp_code += '    }},\n'
 
         cpp_code += '};\n'
-        file.write(cpp_code)
+        tables_code += cpp_code
 
         file.write("\n")
         file.write("typedef struct MessageBase {\n")
         file.write("virtual ~MessageBase() = default;\n")
-        file.write("virtual std::string fnGetValue(const std::string mnem) const = 0;\n")
+        file.write("virtual std::string fnGetValue(const std::string& mnem) const = 0;\n")
         file.write("virtual uint32 fnGetRawValue(const std::string mnem) const = 0;\n")
         file.write("virtual long double fnGetFloatValue(const std::string mnem) const = 0;\n")
         file.write("virtual void Print() const = 0;\n")
-        file.write("virtual string fnTranslate(string func, const string param_value=\"\") const = 0;\n")
+        file.write("virtual string fnTranslate(const string& func, const string& param_value=\"\") const = 0;\n")
         file.write("virtual void fnSend(uint32 pgn, int grpfunc, int addr) = 0;\n")
-        file.write("virtual bool isInteger(const std::string& str) {\n")
-        file.write("    try {\n")
-        file.write("        std::size_t pos;\n")
-        file.write("        uint32 num = std::stoll(str, &pos);\n")
-        file.write("        cout << \"is_int: \" << (pos == str.size()) << endl;\n")
-        file.write("        return pos == str.size();  // Check if the entire string was converted\n")
-        file.write("    } catch (std::invalid_argument&) {\n")
-        file.write("        return false;  // Not an integer\n")
-        file.write("    } catch (std::out_of_range&) {\n")
-        file.write("        return false;  // The number is out of the range for an int\n")
-        file.write("    }\n")
-        file.write("}\n")
-        file.write("virtual uint32 stringToInt(const std::string& buffer, uint32 noDataValue, uint32 outOfRangeValue, uint32 reservedValue, long double scale = 1, long double offset = 0) { \n")
-        file.write('    if (isInteger(buffer)) return std::stoll(buffer);\n')
+        file.write('// Leading whitespace and a \'+\' sign, which stoll accepts and from_chars does not\n')
+        file.write('static const char* fnSkipSign(const char* first, const char* last) {\n')
+        file.write('    while (first != last && std::isspace((unsigned char)*first)) first++;\n')
+        file.write('    if (first != last && *first == \'+\' && first + 1 != last && *(first + 1) != \'-\') first++;\n')
+        file.write('    return first;\n')
+        file.write('}\n')
+        file.write('// Whole string is a base 10 integer in the range of long long\n')
+        file.write('static bool fnParseInteger(std::string_view str, long long& num) {\n')
+        file.write('    const char* last = str.data() + str.size();\n')
+        file.write('    const char* first = fnSkipSign(str.data(), last);\n')
+        file.write('    auto [ptr, ec] = std::from_chars(first, last, num);\n')
+        file.write('    return ec == std::errc() && ptr == last && first != last;\n')
+        file.write('}\n')
+        file.write('// Number at the start of str, read as stold reads it: leading whitespace, a\n')
+        file.write('// sign, then a decimal or a 0x hex value; whatever follows is ignored\n')
+        file.write('static bool fnParseDecimal(std::string_view str, long double& value) {\n')
+        file.write('    const char* last = str.data() + str.size();\n')
+        file.write('    const char* first = str.data();\n')
+        file.write('    while (first != last && std::isspace((unsigned char)*first)) first++;\n')
+        file.write('    bool negative = first != last && *first == \'-\';\n')
+        file.write('    if (first != last && (*first == \'+\' || *first == \'-\')) first++;\n')
+        file.write('    if (first == last || *first == \'+\' || *first == \'-\') return false;\n')
+        file.write('    std::chars_format format = std::chars_format::general;\n')
+        file.write('    if (last - first > 2 && first[0] == \'0\' && (first[1] == \'x\' || first[1] == \'X\')\n')
+        file.write('            && (std::isxdigit((unsigned char)first[2]) || (first[2] == \'.\' && last - first > 3 && std::isxdigit((unsigned char)first[3])))) {\n')
+        file.write('        first += 2;\n')
+        file.write('        format = std::chars_format::hex;\n')
+        file.write('    }\n')
+        file.write('    auto [ptr, ec] = std::from_chars(first, last, value, format);\n')
+        file.write('    if (ec != std::errc()) return false;\n')
+        file.write('    if (negative) value = -value;\n')
+        file.write('    return true;\n')
+        file.write('}\n')
+        file.write('virtual bool isInteger(const std::string& str) {\n')
+        file.write('    long long num;\n')
+        file.write('    return fnParseInteger(str, num);\n')
+        file.write('}\n')
+        file.write('virtual uint32 stringToInt(const std::string& buffer, uint32 noDataValue, uint32 outOfRangeValue, uint32 reservedValue, long double scale = 1, long double offset = 0) { \n')
+        file.write('    long long num;\n')
+        file.write('    if (fnParseInteger(buffer, num)) return (uint32)num;\n')
         file.write('    else if (buffer == "No Data") {\n')
         file.write('        return noDataValue;\n')
         file.write('    } else if (buffer == "Out of range") {\n')
         file.write('        return outOfRangeValue;\n')
         file.write('    } else if (buffer == "Reserved") {\n')
         file.write('        return reservedValue;\n')
-        file.write('    } else {\n')
-        file.write('        // Extract the numeric value from the buffer\n')
-        file.write('        std::string numericPart = buffer.substr(0, buffer.find(\' \'));\n')
-        file.write('        try {\n')
-        file.write('            long double value = std::stold(numericPart);  // Convert to integer\n')
-        file.write('            value /= scale;\n')
-        file.write('            value -= offset;\n')
-        file.write('            return (uint32)(value+0.5);\n')
-        file.write('        } catch (const std::invalid_argument&) {\n')
-        file.write('            cout <<  "Conversion failed" << endl;\n')
-        file.write('        } catch (const std::out_of_range&) {\n')
-        file.write('            cout << "Value was out of range for uint32" << endl; \n')
-        file.write('        }\n')
         file.write('    }\n')
-        file.write('    return 0xFFFFFFFF;\n')
+        file.write('    // A decimal, optionally followed by a space and the unit. Only the part\n')
+        file.write('    // before the first space is read, so a decimal with leading blanks is\n')
+        file.write('    // rejected, as it was with stold\n')
+        file.write('    std::string_view numeric(buffer);\n')
+        file.write('    long double value;\n')
+        file.write('    if (!fnParseDecimal(numeric.substr(0, numeric.find(\' \')), value)) {\n')
+        file.write('        return 0xFFFFFFFF;\n')
+        file.write('    }\n')
+        file.write('    value /= scale;\n')
+        file.write('    value -= offset;\n')
+        file.write('    return (uint32)(value+0.5);\n')
         file.write('}\n')
-        file.write("virtual int findEnumValue(const std::unordered_map<int, std::string>& enumMap, const std::string& value) {\n")
-        file.write("    for (const auto& [key, valStr] : enumMap) {\n")
-        file.write("        if (valStr == value) {\n")
-        file.write("            return key;\n")
-        file.write("        }\n")
-        file.write("    }\n")
-        file.write("    return -1;  // If not found\n")
+        file.write("virtual int findEnumValue(const EnumTable& table, const std::string& value) {\n")
+        file.write("    return table.fnCode(value);  // -1 if not found\n")
         file.write("}\n")
-        file.write("virtual void fnSetValue(const std::string mnem, const std::string value) = 0;\n")
-        file.write("virtual bool fnQualPasses(std::vector<std::tuple<std::string, std::string>> qual) const = 0;\n")
+        file.write("virtual void fnSetValue(const std::string& mnem, const std::string& value) = 0;\n")
+        file.write("virtual bool fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const = 0;\n")
         file.write("} MessageBase;\n")
         file.write("\n")
+        file.write("using MessageFactory = std::function<std::unique_ptr<MessageBase>(void *)>;\n")
+        file.write("using MessageDefFactory = std::function<std::unique_ptr<MessageBase>()>;\n")
+        file.write("\n")
+        file.write("// Message classes by mnemonic, registered at start-up by the message\n")
+        file.write("// families linked into the program (print_functions3/pgn_*.cpp)\n")
+        file.write("std::unordered_map<std::string, MessageFactory>& fnMessageTypes();\n")
+        file.write("std::unordered_map<std::string, MessageDefFactory>& fnMessageTypesDef();\n")
+        file.write("\n")
+        file.write("struct MessageRegistrar {\n")
+        file.write("    MessageRegistrar(const char* mnem, MessageFactory make, MessageDefFactory make_def) {\n")
+        file.write("        fnMessageTypes().emplace(mnem, std::move(make));\n")
+        file.write("        fnMessageTypesDef().emplace(mnem, std::move(make_def));\n")
+        file.write("    }\n")
+        file.write("};\n")
+        file.write("\n")
+        file.write("// Print() of the message received as (PGN, group function), for printall()\n")
+        file.write("using MessagePrinter = void (*)(void * pvStruct);\n")
+        file.write("\n")
+        file.write("constexpr uint64_t fnPgnKey(uint32 pgn, int grpfunc) {\n")
+        file.write("    return (uint64_t)pgn << 32 | (uint32_t)grpfunc;\n")
+        file.write("}\n")
+        file.write("\n")
+        file.write("std::unordered_map<uint64_t, MessagePrinter>& fnMessagePrinters();\n")
+        file.write("\n")
+        file.write("template <typename T>\n")
+        file.write("void fnPrintMessage(void * pvStruct) {\n")
+        file.write("    T(pvStruct).Print();\n")
+        file.write("}\n")
+        file.write("\n")
+        file.write("struct PrinterRegistrar {\n")
+        file.write("    PrinterRegistrar(uint32 pgn, int grpfunc, MessagePrinter print) {\n")
+        file.write("        fnMessagePrinters().emplace(fnPgnKey(pgn, grpfunc), print);\n")
+        file.write("    }\n")
+        file.write("};\n")
+        file.write("\n")
 
         for struct_name, fields, typedef_name in structs:
             parsed_fields = parse_fields(fields)
@@ -9310,43 +9515,8 @@ std::map<std::tuple<int, int, int>, std::string> global_spns = {
             file.write(f'// Auto-generated class definition for {typedef_name}\n')
             file.write(class_definition + '\n\n')
 
+    return tables_code
 
-def generate_code_from_file(filename):
-    # Pattern to match the #define directives
-    define_pattern = re.compile(r'#define\s+(RVC_PGN_\w+)\s+0x\w+L')
-
-    # List to store the parsed PGNs
-    pgns = []
-
-    # Read the file and extract the PGNs from the define statements
-    with open(filename, 'r') as file:
-        for line in file:
-            match = define_pattern.match(line)
-            if match:
-                pgns.append(match.group(1))
-
-    # Generate the else-if blocks
-    code_blocks = []
-    first = True
-    for pgn in pgns:
-        struct_name = pgn.replace("RVC_PGN_", "RVC_tzPGN_")
-        # function_name = pgn.replace("RVC_PGN_", "")
-        capitalized_elements = [element.capitalize() for element in struct_name.split('_')[2:]]       
-        combined_string = ''.join(capitalized_elements)
-        if first == True:
-            code_block = f"""if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "{combined_string}") {{
-    const {combined_string} *msg = (const {combined_string} *)ptzRecv->pvStruct;
-    msg->Print();
-}}"""   
-            first = False
-        else:
-            code_block = f"""else if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "{combined_string}") {{
-        const {combined_string} *msg = (const {combined_string} *)ptzRecv->pvStruct;
-        msg->Print();
-    }}"""
-        code_blocks.append(code_block)
-
-    return "\n".join(code_blocks)
 
 if __name__ == "__main__":
     with open("XnetParams.h", 'w') as file:
@@ -9356,45 +9526,72 @@ if __name__ == "__main__":
     
     header_file = 'header.h'  # Replace with your header file
     output_file = 'print_functions3.h'
-    main(header_file, output_file)
-    filename = 'rvcpgns.txt'
-    generated_code = generate_code_from_file(filename)
+    os.makedirs(SHARD_DIR, exist_ok=True)
+    tables_code = main(header_file, output_file)
 
-    with open("print_functions3.h", 'a') as file:
-        file.write("std::unordered_map<std::string, std::function<std::unique_ptr<MessageBase>(void *)>> message_types = {\n")
-        g = []
-        g2=[]
-        # print("9232")
-        for clas in classes:
-            for x, (y,z) in PGNREVERSE.items():
-                if x.lower() == clas.lower():
-                    file.write(f'{{\"{x}\", [](void * rcv) {{ return std::make_unique<{clas}>(rcv); }} }},\n')
-                    g.append(x)
-                    # print(x)
-        file.write("};\n")
-        file.write("std::unordered_map<std::string, std::function<std::unique_ptr<MessageBase>()>> message_types_def = {\n")
-        g = []
-        g2=[]
-        # print("9232")
-        for clas in classes:
-            for x, (y,z) in PGNREVERSE.items():
-                if x.lower() == clas.lower():
-                    file.write(f'{{\"{x}\", []() {{ return std::make_unique<{clas}>(); }} }},\n')
-                    g.append(x)
-                    # print(x)
-        file.write("};\n")
-        print("9238")
+    # Mnemonic of every class, as keyed in PGNREVERSE
+    g = []
+    g2=[]
+    mnems = {}
+    for clas in classes:
         for x, (y,z) in PGNREVERSE.items():
-            # print(x)     
-            g2.append(x)
-            # print(clas)
-        if sorted(g) == sorted(g2):
-            print("The lists are the same.")
-            print(len(g))
-            print(len(g2))
-        else:
-            print("The lists are different.")
-        # file.write("};\n")
+            if x.lower() == clas.lower():
+                mnems.setdefault(clas, []).append(x)
+                g.append(x)
+    print("9238")
+    for x, (y,z) in PGNREVERSE.items():
+        # print(x)     
+        g2.append(x)
+        # print(clas)
+    if sorted(g) == sorted(g2):
+        print("The lists are the same.")
+        print(len(g))
+        print(len(g2))
+    else:
+        print("The lists are different.")
+
+    # One translation unit per message family: the member definitions of its
+    # classes and their registration in fnMessageTypes()
+    shards = {}
+    for clas in classes:
+        shards.setdefault(shard_name(clas), []).append(clas)
+    for shard, shard_classes in sorted(shards.items()):
+        with open(f'{SHARD_DIR}/pgn_{shard}.cpp', 'w') as file:
+            file.write(f'// Auto-generated by generate_print_functions.py: {shard} message classes\n')
+            file.write('#include "print_functions3.h"\n\n')
+            for clas in shard_classes:
+                file.write(f'// {clas}\n')
+                file.write(class_definitions[clas] + '\n\n')
+            file.write(f'static const MessageRegistrar pgn_{shard}_registrars[] = {{\n')
+            for clas in shard_classes:
+                for x in mnems.get(clas, []):
+                    file.write(f'{{\"{x}\", [](void * rcv) {{ return std::make_unique<{clas}>(rcv); }}, []() {{ return std::make_unique<{clas}>(); }} }},\n')
+            file.write("};\n")
+            file.write(f'static const PrinterRegistrar pgn_{shard}_printers[] = {{\n')
+            for clas in shard_classes:
+                for (x, y), z in PGNLOOKUP.items():
+                    if z['mnem'].lower() == clas.lower():
+                        file.write(f'{{{x}, {-1 if y is None else y}, fnPrintMessage<{clas}>}},\n')
+            file.write("};\n")
+
+    with open(f'{SHARD_DIR}/tables.cpp', 'w') as file:
+        file.write('// Auto-generated by generate_print_functions.py: PGN tables and message registry\n')
+        file.write('#include "print_functions3.h"\n\n')
+        file.write(tables_code)
+        file.write("\n")
+        file.write("// Function statics, so the registrars of every family find them constructed\n")
+        file.write("std::unordered_map<std::string, MessageFactory>& fnMessageTypes() {\n")
+        file.write("    static std::unordered_map<std::string, MessageFactory> message_types;\n")
+        file.write("    return message_types;\n")
+        file.write("}\n")
+        file.write("std::unordered_map<std::string, MessageDefFactory>& fnMessageTypesDef() {\n")
+        file.write("    static std::unordered_map<std::string, MessageDefFactory> message_types_def;\n")
+        file.write("    return message_types_def;\n")
+        file.write("}\n")
+        file.write("std::unordered_map<uint64_t, MessagePrinter>& fnMessagePrinters() {\n")
+        file.write("    static std::unordered_map<uint64_t, MessagePrinter> message_printers;\n")
+        file.write("    return message_printers;\n")
+        file.write("}\n\n")
         file.write("std::map<std::tuple<int, int>, std::string> PGNTABLE = {\n")
         for (x, y), z in PGNLOOKUP.items():
             g = z['mnem']
@@ -9402,10 +9599,17 @@ if __name__ == "__main__":
                 y = -1
             file.write(f"{{ make_pair({x}, {y}) , \"{g}\"}},\n")
         file.write("};\n\n")
+        file.write("// One hash lookup on (PGN, group function), whatever the PGN\n")
         file.write("void printall(PGN_tzRECV_DATA *ptzRecv){\n")
-        file.write(generated_code)
-        file.write("\n}")
-        file.write("\n\n")
+        file.write("    auto it = fnMessagePrinters().find(fnPgnKey(ptzRecv->ulPgn, ptzRecv->siGrpFunc));\n")
+        file.write("    if (it != fnMessagePrinters().end()) {\n")
+        file.write("        it->second(ptzRecv->pvStruct);\n")
+        file.write("    }\n")
+        file.write("}\n\n")
+
+    with open("print_functions3.h", 'a') as file:
+        file.write("void printall(PGN_tzRECV_DATA *ptzRecv);\n\n")
+        file.write("#endif // PRINT_FUNCTIONS3_H\n")
         # file.write("std::unordered_map<std::string, std::pair<uint32, uint32>> PGNREVERSE = {\n")
         # for x, (y,z) in PGNREVERSE.items():
         #     if z == None:
@@ -0,0 +1,108 @@
+#ifndef INSTANCE_INDEX_H
+#define INSTANCE_INDEX_H
+
+// Devices grouped by (function, instance, secondary instance).
+//
+// Two devices of the same function reporting the same instances get the
+// same name, so the bridge marks both as duplicates. The index keeps the
+// addresses of every group and a running count of devices that share their
+// group with another, so an instance change, a departing node or the
+// duplicate alert costs a lookup of one group instead of a scan of all
+// devices.
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "xbudefs.h"
+
+class InstanceIndex {
+public:
+    using Group = std::vector<uchar8>;
+
+    // Put a device in the group of (func, inst, inst2), leaving its previous
+    // group; returns the new group, the device included
+    const Group& fnAdd(uchar8 addr, const std::string& func, int inst, int inst2) {
+        fnRemove(addr);
+        Key key{func, inst, inst2};
+        Group& group = groups[key];
+        group.push_back(addr);
+        if (group.size() == 2) {
+            duplicates += 2;
+        } else if (group.size() > 2) {
+            duplicates++;
+        }
+        where.emplace(addr, std::move(key));
+        return group;
+    }
+
+    // Take a device out of its group; returns the devices left in that group
+    Group fnRemove(uchar8 addr) {
+        auto it = where.find(addr);
+        if (it == where.end()) {
+            return {};
+        }
+        auto group_it = groups.find(it->second);
+        Group& group = group_it->second;
+        group.erase(std::find(group.begin(), group.end(), addr));
+        if (group.size() == 1) {
+            duplicates -= 2;
+        } else if (group.size() > 1) {
+            duplicates--;
+        }
+        Group left = group;
+        if (group.empty()) {
+            groups.erase(group_it);
+        }
+        where.erase(it);
+        return left;
+    }
+
+    // A node moved to another address
+    void fnMove(uchar8 old_addr, uchar8 new_addr) {
+        auto it = where.find(old_addr);
+        if (it == where.end()) {
+            return;
+        }
+        Key key = it->second;
+        fnRemove(old_addr);
+        fnAdd(new_addr, key.func, key.inst, key.inst2);
+    }
+
+    bool fnContains(uchar8 addr) const {
+        return where.count(addr) != 0;
+    }
+
+    // Number of devices sharing their group with another device
+    std::size_t fnDuplicates() const {
+        return duplicates;
+    }
+
+private:
+    struct Key {
+        std::string func;
+        int inst;
+        int inst2;
+
+        bool operator==(const Key& other) const {
+            return inst == other.inst && inst2 == other.inst2 && func == other.func;
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const {
+            std::size_t h = std::hash<std::string>()(key.func);
+            h ^= std::hash<int>()(key.inst) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<int>()(key.inst2) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    std::unordered_map<Key, Group, KeyHash> groups;
+    std::unordered_map<uchar8, Key> where;  // address -> group key
+    std::size_t duplicates = 0;
+};
+
+#endif // INSTANCE_INDEX_H
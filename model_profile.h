@@ -0,0 +1,487 @@
+#ifndef MODEL_PROFILE_H
+#define MODEL_PROFILE_H
+
+// Immutable per-model parameter/command/alert tables shared by every device
+// of that model.
+//
+// Profiles live in a single binary image (format below, written by
+// ProfileBlobGen.py from xnet_params.db) which is mmap'd from
+// fnProfileBlobPath() at start-up and used in place: looking up a model or a
+// parameter is a binary search over sorted fixed-size records and strings
+// are views into an interned string table, so nothing is constructed per
+// model or per device. When the blob file is missing or rejected, the same
+// image is built once in memory from the compiled-in MODEL_MAP (unless built
+// with XNET_PROFILE_BLOB_ONLY, which drops XnetParams.h altogether). Which
+// source was used, and why a blob was rejected, is logged to stderr.
+//
+// Blob layout (little endian, 4-byte aligned, all references are uint32):
+//   ProfileBlobHeader
+//   ProfileModelRec[model_count]     sorted by model name
+//   ProfileSpecRec[spec_count]       per model: params then cmds, each sorted by name
+//   ProfileQualRec[qual_count]
+//   ProfileAlertRec[alert_count]     per model: faults then warnings
+//   string table                     NUL-terminated strings, referenced by offset
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifndef XNET_PROFILE_BLOB_ONLY
+#include "XnetParams.h"
+#endif
+
+// Blob file; a relative path is taken from the directory of the executable.
+// XNET_PROFILE_BLOB in the environment overrides it.
+#ifndef PROFILE_BLOB_FILE
+#define PROFILE_BLOB_FILE "xnet_profiles.bin"
+#endif
+#define PROFILE_BLOB_MAGIC "XNETPRF"
+#define PROFILE_BLOB_VERSION 1
+
+struct ProfileBlobHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t size;
+    uint32_t model_offset, model_count;
+    uint32_t spec_offset, spec_count;
+    uint32_t qual_offset, qual_count;
+    uint32_t alert_offset, alert_count;
+    uint32_t string_offset, string_size;
+};
+
+struct ProfileModelRec {
+    uint32_t name, func;
+    uint32_t param_first, param_count;
+    uint32_t cmd_first, cmd_count;
+    uint32_t fault_first, fault_count;
+    uint32_t warning_first, warning_count;
+};
+
+struct ProfileSpecRec {
+    uint32_t name, pgn, sig, translator;
+    uint32_t qual_first, qual_count;
+};
+
+struct ProfileQualRec {
+    uint32_t signal, value;
+};
+
+// Same fields as the Fault/Warning tuples: SPN msb/isb/lsb, FMI, alert code (-1 when unset)
+struct ProfileAlertRec {
+    int32_t spn_msb, spn_isb, spn_lsb, fmi, code;
+    uint32_t condition;
+};
+
+using Qual = std::vector<std::tuple<std::string, std::string>>;
+
+class ProfileBlob;
+
+// One PARAM_MAP / CMD_MAP entry, viewing the blob
+struct ParamSpec {
+    std::string_view name;       // xnet parameter name (topic suffix)
+    std::string_view pgn;        // PGN mnemonic
+    std::string_view sig;        // signal mnemonic
+    std::string_view translator; // translation function name, empty if none
+    const ProfileBlob* blob;
+    const ProfileQualRec* qual;  // qualifier signal/value pairs
+    uint32_t qual_count;
+
+    inline Qual fnQual() const;
+};
+
+// A model's tables, viewing the blob; default constructed = unsupported model
+class ModelProfile {
+public:
+    ModelProfile() = default;
+    ModelProfile(const ProfileBlob* blob, const ProfileModelRec* rec) : blob(blob), rec(rec) {}
+
+    explicit operator bool() const { return rec != nullptr; }
+
+    inline std::string_view fnName() const;
+    inline std::string_view fnFunc() const;
+    inline std::optional<ParamSpec> fnFindParam(std::string_view name) const;
+    inline std::optional<ParamSpec> fnFindCmd(std::string_view name) const;
+
+    const ProfileAlertRec* fnFaultsBegin() const;
+    const ProfileAlertRec* fnFaultsEnd() const;
+    const ProfileAlertRec* fnWarningsBegin() const;
+    const ProfileAlertRec* fnWarningsEnd() const;
+    inline std::string_view fnCondition(const ProfileAlertRec* alert) const;
+
+private:
+    inline std::optional<ParamSpec> fnFind(uint32_t first, uint32_t count, std::string_view name) const;
+
+    const ProfileBlob* blob = nullptr;
+    const ProfileModelRec* rec = nullptr;
+};
+
+class ProfileBlob {
+public:
+    ProfileBlob() = default;
+    ProfileBlob(const ProfileBlob&) = delete;
+    ProfileBlob& operator=(const ProfileBlob&) = delete;
+
+    ~ProfileBlob() {
+        if (mapped) {
+            munmap(const_cast<char*>(data), size);
+        }
+    }
+
+    // Map a blob file read-only; false (and nothing mapped) if it is missing
+    // or invalid, with the reason in fnError()
+    bool fnLoad(const char* path) {
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            error = std::strerror(errno);
+            return false;
+        }
+        struct stat st;
+        void* map = MAP_FAILED;
+        if (fstat(fd, &st) != 0) {
+            error = std::strerror(errno);
+        } else if (st.st_size == 0) {
+            error = "empty file";
+        } else {
+            map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                error = std::strerror(errno);
+            }
+        }
+        close(fd);
+        if (map == MAP_FAILED) {
+            return false;
+        }
+        if (!fnAttach(static_cast<const char*>(map), st.st_size)) {
+            munmap(map, st.st_size);
+            return false;
+        }
+        mapped = true;
+        return true;
+    }
+
+    // Take ownership of an in-memory image
+    bool fnAdopt(std::vector<char>&& image) {
+        owned = std::move(image);
+        return fnAttach(owned.data(), owned.size());
+    }
+
+    bool fnValid() const {
+        return valid;
+    }
+
+    const std::string& fnError() const {
+        return error;
+    }
+
+    uint32_t fnModelCount() const {
+        return valid ? header->model_count : 0;
+    }
+
+    ModelProfile fnFindModel(std::string_view name) const {
+        if (!valid) {
+            return ModelProfile();
+        }
+        auto it = std::lower_bound(models, models + header->model_count, name,
+                                   [this](const ProfileModelRec& rec, std::string_view key) { return fnString(rec.name) < key; });
+        if (it != models + header->model_count && fnString(it->name) == name) {
+            return ModelProfile(this, it);
+        }
+        return ModelProfile();
+    }
+
+    std::string_view fnString(uint32_t ref) const {
+        return std::string_view(strings + ref);
+    }
+
+    const ProfileSpecRec* specs = nullptr;
+    const ProfileQualRec* quals = nullptr;
+    const ProfileAlertRec* alerts = nullptr;
+
+private:
+    template <typename T>
+    bool fnTable(uint32_t offset, uint32_t count, const T*& table) const {
+        if (offset % alignof(T) != 0 || offset > size || count > (size - offset) / sizeof(T)) {
+            return false;
+        }
+        table = reinterpret_cast<const T*>(data + offset);
+        return true;
+    }
+
+    bool fnRange(uint32_t first, uint32_t count, uint32_t total) const {
+        return first <= total && count <= total - first;
+    }
+
+    bool fnRef(uint32_t ref) const {
+        return ref < header->string_size;
+    }
+
+    // Validate every table and reference once so lookups can trust the image
+    bool fnAttach(const char* image, size_t image_size) {
+        data = image;
+        size = image_size;
+        header = reinterpret_cast<const ProfileBlobHeader*>(image);
+        if (size < sizeof(ProfileBlobHeader)
+                || std::memcmp(header->magic, PROFILE_BLOB_MAGIC, sizeof(PROFILE_BLOB_MAGIC)) != 0) {
+            error = "not a profile blob";
+            return false;
+        }
+        if (header->version != PROFILE_BLOB_VERSION) {
+            error = "version " + std::to_string(header->version) + ", expected " + std::to_string(PROFILE_BLOB_VERSION);
+            return false;
+        }
+        if (header->size != size) {
+            error = "size " + std::to_string(size) + ", header says " + std::to_string(header->size);
+            return false;
+        }
+        if (!fnTable(header->model_offset, header->model_count, models)
+                || !fnTable(header->spec_offset, header->spec_count, specs)
+                || !fnTable(header->qual_offset, header->qual_count, quals)
+                || !fnTable(header->alert_offset, header->alert_count, alerts)
+                || header->string_offset > size || header->string_size == 0
+                || header->string_size > size - header->string_offset
+                || data[header->string_offset + header->string_size - 1] != '\0') {
+            error = "table out of bounds";
+            return false;
+        }
+        strings = data + header->string_offset;
+        error = "reference out of bounds";
+
+        for (const ProfileModelRec* m = models; m != models + header->model_count; ++m) {
+            if (!fnRef(m->name) || !fnRef(m->func)
+                    || !fnRange(m->param_first, m->param_count, header->spec_count)
+                    || !fnRange(m->cmd_first, m->cmd_count, header->spec_count)
+                    || !fnRange(m->fault_first, m->fault_count, header->alert_count)
+                    || !fnRange(m->warning_first, m->warning_count, header->alert_count)) {
+                return false;
+            }
+        }
+        for (const ProfileSpecRec* s = specs; s != specs + header->spec_count; ++s) {
+            if (!fnRef(s->name) || !fnRef(s->pgn) || !fnRef(s->sig) || !fnRef(s->translator)
+                    || !fnRange(s->qual_first, s->qual_count, header->qual_count)) {
+                return false;
+            }
+        }
+        for (const ProfileQualRec* q = quals; q != quals + header->qual_count; ++q) {
+            if (!fnRef(q->signal) || !fnRef(q->value)) {
+                return false;
+            }
+        }
+        for (const ProfileAlertRec* a = alerts; a != alerts + header->alert_count; ++a) {
+            if (!fnRef(a->condition)) {
+                return false;
+            }
+        }
+        error.clear();
+        valid = true;
+        return true;
+    }
+
+    const char* data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    bool valid = false;
+    std::string error;
+    std::vector<char> owned;
+    const ProfileBlobHeader* header = nullptr;
+    const ProfileModelRec* models = nullptr;
+    const char* strings = nullptr;
+};
+
+inline Qual ParamSpec::fnQual() const {
+    Qual result;
+    result.reserve(qual_count);
+    for (uint32_t i = 0; i < qual_count; ++i) {
+        result.emplace_back(std::string(blob->fnString(qual[i].signal)), std::string(blob->fnString(qual[i].value)));
+    }
+    return result;
+}
+
+inline std::string_view ModelProfile::fnName() const {
+    return blob->fnString(rec->name);
+}
+
+inline std::string_view ModelProfile::fnFunc() const {
+    return blob->fnString(rec->func);
+}
+
+inline std::optional<ParamSpec> ModelProfile::fnFindParam(std::string_view name) const {
+    return rec ? fnFind(rec->param_first, rec->param_count, name) : std::nullopt;
+}
+
+inline std::optional<ParamSpec> ModelProfile::fnFindCmd(std::string_view name) const {
+    return rec ? fnFind(rec->cmd_first, rec->cmd_count, name) : std::nullopt;
+}
+
+inline const ProfileAlertRec* ModelProfile::fnFaultsBegin() const { return blob->alerts + rec->fault_first; }
+inline const ProfileAlertRec* ModelProfile::fnFaultsEnd() const { return fnFaultsBegin() + rec->fault_count; }
+inline const ProfileAlertRec* ModelProfile::fnWarningsBegin() const { return blob->alerts + rec->warning_first; }
+inline const ProfileAlertRec* ModelProfile::fnWarningsEnd() const { return fnWarningsBegin() + rec->warning_count; }
+
+inline std::string_view ModelProfile::fnCondition(const ProfileAlertRec* alert) const {
+    return blob->fnString(alert->condition);
+}
+
+inline std::optional<ParamSpec> ModelProfile::fnFind(uint32_t first, uint32_t count, std::string_view name) const {
+    const ProfileSpecRec* begin = blob->specs + first;
+    const ProfileSpecRec* end = begin + count;
+    auto it = std::lower_bound(begin, end, name,
+                               [this](const ProfileSpecRec& spec, std::string_view key) { return blob->fnString(spec.name) < key; });
+    if (it == end || blob->fnString(it->name) != name) {
+        return std::nullopt;
+    }
+    return ParamSpec{blob->fnString(it->name), blob->fnString(it->pgn), blob->fnString(it->sig),
+                     blob->fnString(it->translator), blob, blob->quals + it->qual_first, it->qual_count};
+}
+
+#ifndef XNET_PROFILE_BLOB_ONLY
+// Serialise MODEL_MAP into the blob format (fallback when no blob file is deployed)
+inline std::vector<char> fnBuildProfileBlob(const Model_Map& model_map) {
+    std::string strings(1, '\0');  // offset 0 is the empty string
+    std::unordered_map<std::string, uint32_t> interned = {{"", 0}};
+    auto intern = [&](const std::string& str) {
+        auto it = interned.find(str);
+        if (it != interned.end()) {
+            return it->second;
+        }
+        uint32_t ref = strings.size();
+        strings.append(str).push_back('\0');
+        interned.emplace(str, ref);
+        return ref;
+    };
+
+    std::vector<ProfileModelRec> models;
+    std::vector<ProfileSpecRec> specs;
+    std::vector<ProfileQualRec> quals;
+    std::vector<ProfileAlertRec> alerts;
+
+    auto add_specs = [&](const ParamCmdMap& map) {
+        std::vector<const ParamCmdMap::value_type*> sorted;
+        for (const auto& entry : map) {
+            sorted.push_back(&entry);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+        for (const auto* entry : sorted) {
+            const auto& [pgn, sig, qual, translator] = entry->second;
+            specs.push_back({intern(entry->first), intern(pgn), intern(sig), intern(translator),
+                             static_cast<uint32_t>(quals.size()), static_cast<uint32_t>(qual.size())});
+            for (const auto& [signal, value] : qual) {
+                quals.push_back({intern(signal), intern(value)});
+            }
+        }
+        return static_cast<uint32_t>(sorted.size());
+    };
+    auto add_alerts = [&](const Fault& lookup) {
+        for (const auto& [msb, isb, lsb, fmi, code, condition] : lookup) {
+            alerts.push_back({msb, isb, lsb, fmi, code, intern(condition)});
+        }
+        return static_cast<uint32_t>(lookup.size());
+    };
+
+    std::vector<const Model_Map::value_type*> sorted;
+    for (const auto& entry : model_map) {
+        sorted.push_back(&entry);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+    for (const auto* entry : sorted) {
+        const auto& [func, param_map, cmd_map, fault_lookup, warning_lookup] = entry->second;
+        ProfileModelRec rec{};
+        rec.name = intern(entry->first);
+        rec.func = intern(func);
+        rec.param_first = specs.size();
+        rec.param_count = add_specs(param_map);
+        rec.cmd_first = specs.size();
+        rec.cmd_count = add_specs(cmd_map);
+        rec.fault_first = alerts.size();
+        rec.fault_count = add_alerts(fault_lookup);
+        rec.warning_first = alerts.size();
+        rec.warning_count = add_alerts(warning_lookup);
+        models.push_back(rec);
+    }
+
+    ProfileBlobHeader header{};
+    std::memcpy(header.magic, PROFILE_BLOB_MAGIC, sizeof(PROFILE_BLOB_MAGIC));
+    header.version = PROFILE_BLOB_VERSION;
+    std::vector<char> image(sizeof(header));
+    auto append = [&image](const auto& table, uint32_t& offset, uint32_t& count) {
+        offset = image.size();
+        count = table.size();
+        const char* bytes = reinterpret_cast<const char*>(table.data());
+        image.insert(image.end(), bytes, bytes + table.size() * sizeof(table[0]));
+    };
+    append(models, header.model_offset, header.model_count);
+    append(specs, header.spec_offset, header.spec_count);
+    append(quals, header.qual_offset, header.qual_count);
+    append(alerts, header.alert_offset, header.alert_count);
+    header.string_offset = image.size();
+    header.string_size = strings.size();
+    image.insert(image.end(), strings.begin(), strings.end());
+    image.resize((image.size() + 3) & ~size_t(3), '\0');
+    header.size = image.size();
+    std::memcpy(image.data(), &header, sizeof(header));
+    return image;
+}
+#endif
+
+// Blob file to load: $XNET_PROFILE_BLOB, else PROFILE_BLOB_FILE, which when
+// relative is found next to the executable rather than in the working
+// directory the bridge happens to be started from
+inline std::string fnProfileBlobPath() {
+    const char* env = std::getenv("XNET_PROFILE_BLOB");
+    if (env != nullptr && *env != '\0') {
+        return env;
+    }
+    std::string path = PROFILE_BLOB_FILE;
+    if (path[0] == '/') {
+        return path;
+    }
+    char exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", exe, sizeof(exe));
+    if (len <= 0 || len == (ssize_t)sizeof(exe)) {
+        return path;
+    }
+    std::string dir(exe, len);
+    return dir.substr(0, dir.rfind('/') + 1) + path;
+}
+
+// Profile store: the mmap'd blob file, or the compiled-in MODEL_MAP as a fallback
+inline const ProfileBlob& fnProfileBlob() {
+    static ProfileBlob blob;
+    static bool loaded = [] {
+        std::string path = fnProfileBlobPath();
+        if (blob.fnLoad(path.c_str())) {
+            std::cerr << "Model profiles: " << blob.fnModelCount() << " models from " << path << std::endl;
+            return true;
+        }
+#ifndef XNET_PROFILE_BLOB_ONLY
+        std::cerr << "Model profiles: " << path << " not used (" << blob.fnError()
+                  << "), using the compiled-in MODEL_MAP" << std::endl;
+        return blob.fnAdopt(fnBuildProfileBlob(MODEL_MAP));
+#else
+        std::cerr << "Model profiles: " << path << " not used (" << blob.fnError()
+                  << "), no models are supported" << std::endl;
+        return false;
+#endif
+    }();
+    (void)loaded;
+    return blob;
+}
+
+// Shared profile of a model; evaluates to false if the model is not supported
+inline ModelProfile fnGetModelProfile(std::string_view model) {
+    return fnProfileBlob().fnFindModel(model);
+}
+
+#endif // MODEL_PROFILE_H
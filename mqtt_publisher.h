@@ -0,0 +1,288 @@
+#ifndef MQTT_PUBLISHER_H
+#define MQTT_PUBLISHER_H
+
+// MQTT output of the bridge, run on its own I/O thread.
+//
+// Producers (the CAN receive path and the main loop) only push messages
+// into a bounded lock-free queue and never touch the socket. The I/O thread
+// owns the mosquitto client: it connects and reconnects, drains the queue
+// into mosquitto_publish() and drives the network with mosquitto_loop(), so
+// a slow or absent broker can only fill the queue, never stall CAN
+// processing.
+//
+// When the queue is full, new messages are dropped and counted. Retained
+// messages (device status, alerts) may use the last MQTT_QUEUE_RESERVE
+// slots, which plain telemetry may not, so a burst of telemetry cannot
+// crowd out a status change. Messages wait in the queue while the broker is
+// disconnected; a message whose publish fails because the connection went
+// down is kept and published first after the reconnect.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <mosquitto.h>
+
+#define MQTT_QUEUE_SIZE 1024        // power of two
+#define MQTT_QUEUE_RESERVE 64       // slots only retained messages may use
+#define MQTT_LOOP_TIMEOUT_MS 10
+#define MQTT_DRAIN_BATCH 64         // publishes between network loop passes
+#define MQTT_RECONNECT_MIN_MS 500
+#define MQTT_RECONNECT_MAX_MS 30000
+#define MQTT_KEEPALIVE_S 5
+
+// Bounded multi-producer/multi-consumer queue (Vyukov). Every cell carries a
+// sequence number that tells producers and consumers whose turn it is, so
+// push and pop are a CAS on the position plus a release store, with no lock.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity)
+        : cells(new Cell[capacity]), mask(capacity - 1) {
+        for (std::size_t i = 0; i < capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // False if the queue is full; value is left untouched then
+    bool fnPush(T& value) {
+        std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = (std::intptr_t)seq - (std::intptr_t)pos;
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool fnPop(T& value) {
+        std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = (std::intptr_t)seq - (std::intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Approximate number of queued values
+    std::size_t fnDepth() const {
+        std::size_t head = dequeue_pos.load(std::memory_order_relaxed);
+        std::size_t tail = enqueue_pos.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    std::size_t fnCapacity() const {
+        return mask + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    std::size_t mask;
+    alignas(64) std::atomic<std::size_t> enqueue_pos{0};
+    alignas(64) std::atomic<std::size_t> dequeue_pos{0};
+};
+
+class MqttPublisher {
+public:
+    struct Stats {
+        std::size_t depth;
+        std::size_t high_water;
+        uint64_t queued;
+        uint64_t dropped;
+        uint64_t published;
+        uint64_t failed;
+        bool connected;
+    };
+
+    explicit MqttPublisher(struct mosquitto* mosq, std::size_t capacity = MQTT_QUEUE_SIZE)
+        : mosq(mosq), queue(capacity) {}
+
+    MqttPublisher(const MqttPublisher&) = delete;
+    MqttPublisher& operator=(const MqttPublisher&) = delete;
+
+    ~MqttPublisher() {
+        fnStop();
+    }
+
+    // Retained message published on every (re)connect, the counterpart of the will
+    void fnSetBirth(std::string_view topic, std::string payload) {
+        birth_topic = topic;
+        birth_payload = std::move(payload);
+    }
+
+    // Start the I/O thread; it connects to the broker and keeps reconnecting
+    void fnStart(std::string host = "localhost", int port = 1883) {
+        if (running.exchange(true)) {
+            return;
+        }
+        io_thread = std::thread(&MqttPublisher::fnRun, this, std::move(host), port);
+    }
+
+    // Stop the I/O thread after it published what is queued, if connected
+    void fnStop() {
+        if (running.exchange(false)) {
+            io_thread.join();
+        }
+    }
+
+    // Queue a message; never blocks. topic must be interned (publish_topics.h)
+    // or otherwise outlive the message. False if the message was dropped.
+    bool fnPublish(std::string_view topic, std::string payload, bool retain = false) {
+        std::size_t limit = queue.fnCapacity() - (retain ? 0 : MQTT_QUEUE_RESERVE);
+        Message msg{topic, std::move(payload), retain};
+        if (queue.fnDepth() >= limit || !queue.fnPush(msg)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        queued.fetch_add(1, std::memory_order_relaxed);
+
+        std::size_t depth = queue.fnDepth();
+        std::size_t high = high_water.load(std::memory_order_relaxed);
+        while (depth > high && !high_water.compare_exchange_weak(high, depth, std::memory_order_relaxed)) {
+        }
+        return true;
+    }
+
+    Stats fnStats() const {
+        return Stats{
+            queue.fnDepth(),
+            high_water.load(std::memory_order_relaxed),
+            queued.load(std::memory_order_relaxed),
+            dropped.load(std::memory_order_relaxed),
+            published.load(std::memory_order_relaxed),
+            failed.load(std::memory_order_relaxed),
+            connected.load(std::memory_order_relaxed)
+        };
+    }
+
+private:
+    struct Message {
+        std::string_view topic;
+        std::string payload;
+        bool retain = false;
+    };
+
+    void fnRun(std::string host, int port) {
+        auto backoff = std::chrono::milliseconds(MQTT_RECONNECT_MIN_MS);
+        bool ever_connected = false;
+
+        while (running.load(std::memory_order_relaxed)) {
+            if (!connected.load(std::memory_order_relaxed)) {
+                int rc = ever_connected ? mosquitto_reconnect(mosq)
+                                        : mosquitto_connect(mosq, host.c_str(), port, MQTT_KEEPALIVE_S);
+                if (rc != MOSQ_ERR_SUCCESS) {
+                    std::cerr << "MQTT connect failed: " << rc << std::endl;
+                    fnSleep(backoff);
+                    backoff = std::min(backoff * 2, std::chrono::milliseconds(MQTT_RECONNECT_MAX_MS));
+                    continue;
+                }
+                ever_connected = true;
+                connected.store(true, std::memory_order_relaxed);
+                if (!birth_topic.empty()) {
+                    mosquitto_publish(mosq, nullptr, birth_topic.data(), (int)birth_payload.size(),
+                                      birth_payload.data(), 0, true);
+                }
+                backoff = std::chrono::milliseconds(MQTT_RECONNECT_MIN_MS);
+            }
+
+            fnDrain(MQTT_DRAIN_BATCH);
+            if (mosquitto_loop(mosq, MQTT_LOOP_TIMEOUT_MS, 1) != MOSQ_ERR_SUCCESS) {
+                connected.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        if (connected.load(std::memory_order_relaxed)) {
+            fnDrain(queue.fnCapacity());
+            mosquitto_loop(mosq, MQTT_LOOP_TIMEOUT_MS, 1);
+            mosquitto_disconnect(mosq);
+            connected.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // Sleep that ends early when fnStop() is called
+    void fnSleep(std::chrono::milliseconds duration) {
+        auto until = std::chrono::steady_clock::now() + duration;
+        while (running.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < until) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+
+    // I/O thread only. A message the broker can never take (bad topic,
+    // oversized payload) is dropped and counted instead of retried.
+    void fnDrain(std::size_t max_messages) {
+        for (std::size_t i = 0; i < max_messages; i++) {
+            if (!retry_pending && !queue.fnPop(current)) {
+                return;
+            }
+            int rc = mosquitto_publish(mosq, nullptr, current.topic.data(), (int)current.payload.size(),
+                                       current.payload.data(), 0, current.retain);
+            retry_pending = false;
+            if (rc == MOSQ_ERR_SUCCESS) {
+                published.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            failed.fetch_add(1, std::memory_order_relaxed);
+            if (rc == MOSQ_ERR_NO_CONN || rc == MOSQ_ERR_CONN_LOST || rc == MOSQ_ERR_NOMEM) {
+                retry_pending = true;
+                connected.store(false, std::memory_order_relaxed);
+                return;
+            }
+            std::cerr << "MQTT publish to " << current.topic << " failed: " << rc << std::endl;
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    struct mosquitto* mosq;
+    std::string_view birth_topic;
+    std::string birth_payload;
+    BoundedQueue<Message> queue;
+    Message current;             // I/O thread only, kept for retry_pending
+    bool retry_pending = false;
+    std::thread io_thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> connected{false};
+    std::atomic<std::size_t> high_water{0};
+    std::atomic<uint64_t> queued{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> published{0};
+    std::atomic<uint64_t> failed{0};
+};
+
+#endif // MQTT_PUBLISHER_H
@@ -0,0 +1,124 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+// Per-PGN request scheduling for one device.
+//
+// Many PGNs are broadcast by the device on its own. PollScheduler learns the
+// transmit interval of each PGN from the unsolicited arrivals (an EWMA of the
+// gaps between them) and, once a PGN has arrived POLL_LEARN_COUNT times at
+// least once per poll period, stops requesting it for as long as it keeps
+// arriving. The remaining PGNs are requested once per poll period, each at
+// its own phase with POLL_JITTER_PCT of jitter, so the requests of a device
+// are spread over the period instead of going out together.
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#define POLL_LEARN_COUNT 3       // unsolicited arrivals before a PGN counts as broadcast
+#define POLL_MAX_GAP_MS 60000    // longer gaps are outages, not the transmit interval
+#define POLL_MISSED_FACTOR 2.5   // broadcast intervals missed before polling resumes
+#define POLL_JITTER_PCT 10
+
+class PollScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit PollScheduler(Clock::duration period, unsigned seed = 0)
+        : period(period), rng(seed) {}
+
+    // A PGN arrived; solicited if it answered one of our requests
+    void fnObserve(const std::string& pgn, bool solicited, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(scheduler_mutex);
+        Entry& entry = fnEntry(pgn, now);
+        if (!solicited) {
+            if (entry.broadcasts > 0) {
+                double gap = std::chrono::duration<double, std::milli>(now - entry.last_broadcast).count();
+                if (gap < POLL_MAX_GAP_MS) {
+                    entry.interval_ms = entry.interval_ms == 0 ? gap : entry.interval_ms + (gap - entry.interval_ms) / 4;
+                } else {
+                    entry.broadcasts = 0;
+                    entry.interval_ms = 0;
+                }
+            }
+            entry.broadcasts++;
+            entry.last_broadcast = now;
+        }
+        entry.last_rx = now;
+        entry.next_due = now + fnJittered();
+    }
+
+    // True if the PGN should be requested now
+    bool fnDue(const std::string& pgn, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(scheduler_mutex);
+        Entry& entry = fnEntry(pgn, now);
+        if (fnIsBroadcast(entry)) {
+            // Only poll a broadcast PGN after it stopped arriving
+            auto missed = std::chrono::duration<double, std::milli>(entry.interval_ms * POLL_MISSED_FACTOR);
+            return now - entry.last_rx > missed && now >= entry.next_due;
+        }
+        return now >= entry.next_due;
+    }
+
+    // The PGN was requested; the next request is due a period later
+    void fnRequested(const std::string& pgn, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(scheduler_mutex);
+        fnEntry(pgn, now).next_due = now + fnJittered();
+    }
+
+    bool fnIsBroadcast(const std::string& pgn) const {
+        std::lock_guard<std::mutex> lock(scheduler_mutex);
+        auto it = entries.find(pgn);
+        return it != entries.end() && fnIsBroadcast(it->second);
+    }
+
+    // Learned transmit interval, zero if the PGN is not broadcast
+    std::chrono::milliseconds fnInterval(const std::string& pgn) const {
+        std::lock_guard<std::mutex> lock(scheduler_mutex);
+        auto it = entries.find(pgn);
+        if (it == entries.end() || it->second.broadcasts < 2) {
+            return std::chrono::milliseconds(0);
+        }
+        return std::chrono::milliseconds(static_cast<long>(it->second.interval_ms));
+    }
+
+private:
+    struct Entry {
+        Clock::time_point last_rx;
+        Clock::time_point last_broadcast;
+        Clock::time_point next_due;
+        double interval_ms = 0;  // EWMA of the gaps between unsolicited arrivals
+        int broadcasts = 0;
+    };
+
+    // Caller holds scheduler_mutex. A new PGN gets a random phase in the period.
+    Entry& fnEntry(const std::string& pgn, Clock::time_point now) {
+        auto [it, added] = entries.try_emplace(pgn);
+        if (added) {
+            std::uniform_int_distribution<Clock::rep> phase(0, period.count());
+            it->second.next_due = now + Clock::duration(phase(rng));
+        }
+        return it->second;
+    }
+
+    bool fnIsBroadcast(const Entry& entry) const {
+        return entry.broadcasts >= POLL_LEARN_COUNT &&
+               std::chrono::duration<double, std::milli>(entry.interval_ms) <= period;
+    }
+
+    // Caller holds scheduler_mutex
+    Clock::duration fnJittered() {
+        Clock::rep spread = period.count() * POLL_JITTER_PCT / 100;
+        std::uniform_int_distribution<Clock::rep> jitter(-spread, spread);
+        return period + Clock::duration(jitter(rng));
+    }
+
+    mutable std::mutex scheduler_mutex;
+    Clock::duration period;
+    std::minstd_rand rng;
+    std::unordered_map<std::string, Entry> entries;
+};
+
+#endif // POLL_SCHEDULER_H
@@ -0,0 +1,222 @@
+#ifndef PPN_SESSION_H
+#define PPN_SESSION_H
+
+// Proprietary parameter (PPN) reads and writes for one device, ported from
+// the asyncio engine in Rvc2Mqtt.py (fnPpnRequest, fnPpnSessionCmd,
+// fnPpnWriteCmd, fnPollPpnSubscriptions, fnPollPpnWrites).
+//
+// The work runs as coro::task coroutines that send a command and co_await
+// the matching response with a timeout, retrying like the Python code. The
+// receive path hands responses to fnDeliver() and the main loop calls
+// fnPoll() to expire timeouts and start new work, so the sessions of
+// independent devices interleave instead of waiting on each other.
+//
+// fnDeliver() and fnPoll() run on different threads. They take the
+// coroutine to resume under session_mutex but resume it after releasing the
+// lock, so the coroutine may send and call back into the session; running
+// keeps the other thread from starting or replacing the job meanwhile.
+
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "task.h"
+
+#define PPN_CMD_TIMEOUT_MS 500
+#define PPN_CMD_MAX_TRIES 4
+#define PPN_REQ_TIMEOUT_MS 500
+#define PPN_REQ_MAX_TRIES 3
+#define PPN_READ_INTERVAL_MS 5000
+
+class PpnSession {
+public:
+    using Clock = std::chrono::steady_clock;
+    // Send a PmPpn command: PGN mnemonic, ParamId or SessEnDis text, value (writes only)
+    using SendFn = std::function<void(std::string_view pgn_mnem, const std::string& arg, const std::string& value)>;
+
+    PpnSession() = default;
+    PpnSession(const PpnSession&) = delete;  // running coroutines point at this session
+    PpnSession& operator=(const PpnSession&) = delete;
+
+    void fnSetSender(SendFn send) {
+        std::lock_guard<std::mutex> lock(session_mutex);
+        this->send = std::move(send);
+    }
+
+    // PPN mnemonics polled every PPN_READ_INTERVAL_MS
+    void fnSetReads(std::vector<std::string> reads) {
+        std::lock_guard<std::mutex> lock(session_mutex);
+        this->reads = std::move(reads);
+    }
+
+    // Queue a write; it is sent in the next session opened by fnPoll
+    void fnQueueWrite(std::string param, std::string value) {
+        std::lock_guard<std::mutex> lock(session_mutex);
+        write_queue.emplace_back(std::move(param), std::move(value));
+    }
+
+    // A PGN was received from the device; resumes the coroutine waiting for it
+    void fnDeliver(std::string_view pgn_mnem) {
+        std::unique_lock<std::mutex> lock(session_mutex);
+        if (waiter && (pgn_mnem == wait_pgn || pgn_mnem == "PmPpnNakRsp" || pgn_mnem == "IsoAck")) {
+            fnWake(lock, true);
+        }
+    }
+
+    // Expire a pending timeout and start queued writes or due reads when idle
+    void fnPoll(Clock::time_point now = Clock::now()) {
+        std::unique_lock<std::mutex> lock(session_mutex);
+        if (waiter && now >= deadline) {
+            fnWake(lock, false);
+        }
+        if (running || !job.done() || !send) {
+            return;
+        }
+        if (!write_queue.empty()) {
+            job = fnPollWrites();
+        } else if (!reads.empty() && now >= next_read) {
+            next_read = now + std::chrono::milliseconds(PPN_READ_INTERVAL_MS);
+            job = fnPollReads(reads);
+        } else {
+            return;
+        }
+        fnRun(lock, [this] { job.resume(); });
+    }
+
+    bool fnBusy() const {
+        std::lock_guard<std::mutex> lock(session_mutex);
+        return running || !job.done();
+    }
+
+private:
+    // co_await result: true if the response arrived, false on timeout
+    struct ResponseAwaiter {
+        PpnSession& session;
+        std::string_view pgn_mnem;
+        std::chrono::milliseconds timeout;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard<std::mutex> lock(session.session_mutex);
+            session.waiter = handle;
+            session.wait_pgn = pgn_mnem;
+            session.deadline = Clock::now() + timeout;
+            session.running = false;
+        }
+        bool await_resume() const noexcept { return session.response; }
+    };
+
+    ResponseAwaiter fnWaitForResponse(std::string_view pgn_mnem, int timeout_ms) {
+        return ResponseAwaiter{*this, pgn_mnem, std::chrono::milliseconds(timeout_ms)};
+    }
+
+    // Resume the waiting coroutine; lock holds session_mutex and is held again on return
+    void fnWake(std::unique_lock<std::mutex>& lock, bool got_response) {
+        response = got_response;
+        std::coroutine_handle<> handle = std::exchange(waiter, nullptr);
+        fnRun(lock, [handle] { handle.resume(); });
+    }
+
+    // Run the job with session_mutex released until it waits for the next
+    // response or finishes. Once it waits, the other thread may resume it
+    // before this returns, so running is only cleared here by the run that
+    // set it and saw the job finish.
+    template <typename Resume>
+    void fnRun(std::unique_lock<std::mutex>& lock, Resume resume) {
+        unsigned run = ++runs;
+        running = true;
+        lock.unlock();
+        resume();
+        lock.lock();
+        if (running && runs == run) {
+            running = false;
+        }
+    }
+
+    coro::task fnPollReads(std::vector<std::string> params) {
+        // An open session is not required for reading proprietary parameters
+        for (const std::string& param : params) {
+            if (param == "BpcSerialNum") {
+                // BPC serial number comes in two parts
+                co_await fnPpnRequest("BpcSerialNum1");
+                co_await fnPpnRequest("BpcSerialNum2");
+            } else {
+                co_await fnPpnRequest(param);
+            }
+        }
+    }
+
+    coro::task fnPollWrites() {
+        co_await fnPpnSessionCmd("On");
+        for (;;) {
+            std::pair<std::string, std::string> write;
+            {
+                // fnQueueWrite may add to the queue while the session is open
+                std::lock_guard<std::mutex> lock(session_mutex);
+                if (write_queue.empty()) {
+                    break;
+                }
+                write = std::move(write_queue.front());
+                write_queue.pop_front();
+            }
+            co_await fnPpnWriteCmd(write.first, write.second);
+        }
+        co_await fnPpnSessionCmd("Off");
+    }
+
+    // Read request; this usually takes two tries on a ZeroRPM battery
+    coro::task fnPpnRequest(std::string param) {
+        for (int tries = 0; tries < PPN_REQ_MAX_TRIES; tries++) {
+            send("PmPpnReadCmd", param, "");
+            if (co_await fnWaitForResponse("PmPpnReadRsp", PPN_REQ_TIMEOUT_MS)) {
+                co_return;
+            }
+        }
+        std::cerr << "No response to PPN request for " << param << std::endl;
+    }
+
+    coro::task fnPpnSessionCmd(std::string state) {
+        for (int tries = 0; tries < PPN_CMD_MAX_TRIES; tries++) {
+            send("PmPpnSessionCmd", state, "");
+            if (co_await fnWaitForResponse("PmPpnSessionRsp", PPN_CMD_TIMEOUT_MS)) {
+                co_return;
+            }
+        }
+        std::cerr << "No response to request to set PPN session to " << state << std::endl;
+    }
+
+    coro::task fnPpnWriteCmd(std::string param, std::string value) {
+        for (int tries = 0; tries < PPN_CMD_MAX_TRIES; tries++) {
+            send("PmPpnWriteCmd", param, value);
+            if (co_await fnWaitForResponse("PmPpnWriteRsp", PPN_CMD_TIMEOUT_MS)) {
+                co_return;
+            }
+        }
+        std::cerr << "No response to write request for PPN " << param << std::endl;
+    }
+
+    mutable std::mutex session_mutex;
+    SendFn send;
+    std::vector<std::string> reads;
+    std::deque<std::pair<std::string, std::string>> write_queue;
+    Clock::time_point next_read;
+    coro::task job;
+
+    // The coroutine suspended on a response, if any
+    std::coroutine_handle<> waiter = nullptr;
+    std::string_view wait_pgn;
+    Clock::time_point deadline;
+    bool response = false;
+
+    // Set while fnRun runs the job outside session_mutex
+    bool running = false;
+    unsigned runs = 0;
+};
+
+#endif // PPN_SESSION_H
@@ -0,0 +1,1231 @@
+// Auto-generated by generate_print_functions.py: DDID enum tables
+#include "print_functions3.h"
+
+constexpr EnumEntry ENUMLOOKUP_N2087867454_ENTRIES[] = {
+    {0, "CanAddr"},
+    {1, "BattInst"},
+    {2, "NumPacks"},
+    {3, "BankInst"},
+    {4, "ReserveLimit"},
+    {5, "MakeId"},
+    {6, "ModelNum1"},
+    {7, "ModelNum2"},
+    {8, "SerialNum"},
+    {9, "SwVer"},
+    {10, "ProdId"},
+    {11, "RatedCapacity"},
+    {12, "CellsInSeries"},
+    {13, "CellsInParallel"},
+    {14, "BmsSerialNum"},
+    {15, "BpcSerialNum1"},
+    {16, "BpcSerialNum2"},
+    {17, "BpcHwVer"},
+    {18, "BlueToothCfg"},
+    {19, "WiFiCfg"},
+};
+constexpr int16_t ENUMLOOKUP_N2087867454_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+constexpr uint16_t ENUMLOOKUP_N2087867454_SEEDS[] = {1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 1, 0, 0, 2, 1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_N2087867454_SLOTS[] = {-1, -1, -1, -1, -1, 13, -1, -1, 7, -1, 4, 5, 15, -1, -1, 0, 10, -1, -1, -1, -1, -1, 16, 3, -1, -1, -1, -1, -1, 12, 2, -1, -1, -1, -1, -1, 11, -1, -1, 17, -1, 1, 14, -1, -1, -1, 6, -1, -1, 9, -1, -1, -1, 18, -1, -1, 19, -1, 8, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_N2087867454 = {ENUMLOOKUP_N2087867454_ENTRIES, 0, 20, ENUMLOOKUP_N2087867454_DENSE, 63, ENUMLOOKUP_N2087867454_SEEDS, ENUMLOOKUP_N2087867454_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N1920850496_ENTRIES[] = {
+    {0, "Manual Off"},
+    {1, "Manual On"},
+    {2, "Automatic"},
+};
+constexpr int16_t ENUMLOOKUP_N1920850496_DENSE[] = {0, 1, 2};
+constexpr uint16_t ENUMLOOKUP_N1920850496_SEEDS[] = {0, 1, 0, 0, 0, 0, 1, 1};
+constexpr int16_t ENUMLOOKUP_N1920850496_SLOTS[] = {-1, -1, -1, 2, 0, -1, -1, 1};
+constexpr EnumTable ENUMLOOKUP_N1920850496 = {ENUMLOOKUP_N1920850496_ENTRIES, 0, 3, ENUMLOOKUP_N1920850496_DENSE, 7, ENUMLOOKUP_N1920850496_SEEDS, ENUMLOOKUP_N1920850496_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N1891506457_ENTRIES[] = {
+    {0, "Normal"},
+    {1, "Extreme Under Voltage"},
+    {2, "Under Voltage"},
+    {3, "Over Voltage"},
+    {4, "Extreme Over Voltage"},
+};
+constexpr int16_t ENUMLOOKUP_N1891506457_DENSE[] = {0, 1, 2, 3, 4};
+constexpr uint16_t ENUMLOOKUP_N1891506457_SEEDS[] = {1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0};
+constexpr int16_t ENUMLOOKUP_N1891506457_SLOTS[] = {-1, 4, 2, -1, 1, 3, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_N1891506457 = {ENUMLOOKUP_N1891506457_ENTRIES, 0, 5, ENUMLOOKUP_N1891506457_DENSE, 15, ENUMLOOKUP_N1891506457_SEEDS, ENUMLOOKUP_N1891506457_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N1372759813_ENTRIES[] = {
+    {0, "App"},
+    {1, "XB Lib"},
+    {2, "RVC"},
+    {3, "Loader"},
+};
+constexpr int16_t ENUMLOOKUP_N1372759813_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_N1372759813_SEEDS[] = {0, 0, 0, 1, 0, 1, 0, 1};
+constexpr int16_t ENUMLOOKUP_N1372759813_SLOTS[] = {-1, -1, 2, 3, 0, 1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_N1372759813 = {ENUMLOOKUP_N1372759813_ENTRIES, 0, 4, ENUMLOOKUP_N1372759813_DENSE, 7, ENUMLOOKUP_N1372759813_SEEDS, ENUMLOOKUP_N1372759813_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N1191777267_ENTRIES[] = {
+    {0, "Standalone"},
+    {1, "Master"},
+    {2, "Slave"},
+    {3, "Series Line 2 Master"},
+    {4, "Series Line 1 Master"},
+    {5, "Series Line 2 Slave"},
+    {6, "Series Line 1 Slave"},
+    {7, "Phase 1 Master"},
+    {8, "Phase 2 Master"},
+    {9, "Phase 3 Master"},
+    {10, "Phase 1 Slave"},
+    {11, "Phase 2 Slave"},
+    {12, "Phase 3 Slave"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_N1191777267_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13};
+constexpr uint16_t ENUMLOOKUP_N1191777267_SEEDS[] = {0, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_N1191777267_SLOTS[] = {13, -1, 10, 1, -1, 4, 11, 9, 5, -1, -1, -1, -1, 8, -1, -1, 3, -1, 0, -1, -1, 7, 2, -1, 6, -1, -1, -1, -1, -1, -1, 12};
+constexpr EnumTable ENUMLOOKUP_N1191777267 = {ENUMLOOKUP_N1191777267_ENTRIES, 0, 256, ENUMLOOKUP_N1191777267_DENSE, 31, ENUMLOOKUP_N1191777267_SEEDS, ENUMLOOKUP_N1191777267_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N961307955_ENTRIES[] = {
+    {0, "Not On"},
+    {1, "Manual On"},
+    {2, "Not Off"},
+    {3, "Manual Off"},
+    {4, "No Active Trigger"},
+    {5, "Trigger Override"},
+    {6, "Battery Voltage Low"},
+    {7, "Battery Voltage High"},
+    {8, "Battery Temp Low"},
+    {9, "Battery Temp High"},
+    {10, "Fault"},
+    {11, "AC Good"},
+    {12, "Bulk Exit"},
+    {13, "Absorption Exit"},
+    {14, "Internal Temp High"},
+    {15, "State Of Charge"},
+    {16, "Time Of Day"},
+};
+constexpr int16_t ENUMLOOKUP_N961307955_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+constexpr uint16_t ENUMLOOKUP_N961307955_SEEDS[] = {0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 2, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_N961307955_SLOTS[] = {-1, -1, 10, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, 5, -1, 7, -1, 16, -1, -1, 9, 11, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 13, -1, 4, -1, -1, -1, -1, -1, -1, -1, 8, -1, 12, -1, 2, 15, -1, -1, 14, -1, -1};
+constexpr EnumTable ENUMLOOKUP_N961307955 = {ENUMLOOKUP_N961307955_ENTRIES, 0, 17, ENUMLOOKUP_N961307955_DENSE, 63, ENUMLOOKUP_N961307955_SEEDS, ENUMLOOKUP_N961307955_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N725723354_ENTRIES[] = {
+    {0, "Hibernate"},
+    {1, "Power Save"},
+    {2, "Safe"},
+    {3, "Operating"},
+    {4, "Diagnostic"},
+    {5, "Remote Power Off"},
+    {10, "Cbg Backup"},
+    {11, "Cbg Self Consump"},
+    {12, "Cbg Self Consump Time"},
+    {13, "Cbg Send Cfg"},
+    {14, "Cbg Push Cfg"},
+    {252, "Last Mode"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_N725723354_DENSE[] = {0, 1, 2, 3, 4, 5, -1, -1, -1, -1, 6, 7, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12, 13, 14};
+constexpr uint16_t ENUMLOOKUP_N725723354_SEEDS[] = {0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 0, 3, 2, 0, 2, 0, 0, 0, 0, 1, 5, 0, 0, 3};
+constexpr int16_t ENUMLOOKUP_N725723354_SLOTS[] = {-1, -1, 0, -1, 3, 11, -1, 12, -1, 5, 13, 10, -1, 4, -1, 14, -1, -1, 2, -1, 9, -1, -1, -1, 7, -1, 6, 1, -1, -1, -1, 8};
+constexpr EnumTable ENUMLOOKUP_N725723354 = {ENUMLOOKUP_N725723354_ENTRIES, 0, 256, ENUMLOOKUP_N725723354_DENSE, 31, ENUMLOOKUP_N725723354_SEEDS, ENUMLOOKUP_N725723354_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N710120228_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "3Stage"},
+    {2, "2StageNoFloat"},
+    {3, "CVCC"},
+    {4, "Trickle"},
+    {5, "4Stage"},
+    {253, "Reserved"},
+    {254, "Out of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_N710120228_DENSE[] = {0, 1, 2, 3, 4, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, 7, 8};
+constexpr uint16_t ENUMLOOKUP_N710120228_SEEDS[] = {0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1};
+constexpr int16_t ENUMLOOKUP_N710120228_SLOTS[] = {-1, -1, 8, 7, -1, -1, -1, 6, -1, -1, 0, -1, -1, 2, -1, -1, 5, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, 1, -1, -1, -1, 4};
+constexpr EnumTable ENUMLOOKUP_N710120228 = {ENUMLOOKUP_N710120228_ENTRIES, 0, 256, ENUMLOOKUP_N710120228_DENSE, 31, ENUMLOOKUP_N710120228_SEEDS, ENUMLOOKUP_N710120228_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N624353124_ENTRIES[] = {
+    {0, "Normal"},
+    {1, "Extreme Under Temperature"},
+    {2, "Under Temperature"},
+    {3, "Over Temperature"},
+    {4, "Extreme Over Temperature"},
+};
+constexpr int16_t ENUMLOOKUP_N624353124_DENSE[] = {0, 1, 2, 3, 4};
+constexpr uint16_t ENUMLOOKUP_N624353124_SEEDS[] = {0, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_N624353124_SLOTS[] = {3, -1, -1, -1, 2, 1, -1, 4, -1, -1, -1, 0, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_N624353124 = {ENUMLOOKUP_N624353124_ENTRIES, 0, 5, ENUMLOOKUP_N624353124_DENSE, 15, ENUMLOOKUP_N624353124_SEEDS, ENUMLOOKUP_N624353124_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N595124272_ENTRIES[] = {
+    {0, "Unknown"},
+    {1, "Grid Priority"},
+    {2, "Generator Priority"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_N595124272_DENSE[] = {0, 1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, 4, 5};
+constexpr uint16_t ENUMLOOKUP_N595124272_SEEDS[] = {0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 2, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_N595124272_SLOTS[] = {2, -1, 5, -1, -1, -1, -1, 3, -1, -1, 4, -1, -1, -1, 1, 0};
+constexpr EnumTable ENUMLOOKUP_N595124272 = {ENUMLOOKUP_N595124272_ENTRIES, 0, 256, ENUMLOOKUP_N595124272_DENSE, 15, ENUMLOOKUP_N595124272_SEEDS, ENUMLOOKUP_N595124272_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_N100316561_ENTRIES[] = {
+    {0, "Inactive"},
+    {1, "Input1Active"},
+    {2, "Input2Active"},
+    {3, "Input1Delay"},
+    {4, "Input2Delay"},
+};
+constexpr int16_t ENUMLOOKUP_N100316561_DENSE[] = {0, 1, 2, 3, 4};
+constexpr uint16_t ENUMLOOKUP_N100316561_SEEDS[] = {0, 1, 0, 0, 0, 1, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_N100316561_SLOTS[] = {-1, 1, 2, -1, -1, -1, -1, -1, -1, -1, 4, 0, -1, -1, -1, 3};
+constexpr EnumTable ENUMLOOKUP_N100316561 = {ENUMLOOKUP_N100316561_ENTRIES, 0, 5, ENUMLOOKUP_N100316561_DENSE, 15, ENUMLOOKUP_N100316561_SEEDS, ENUMLOOKUP_N100316561_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_8982_ENTRIES[] = {
+    {64, "Generator"},
+    {65, "Genstart Controller"},
+    {66, "Inverter"},
+    {67, "Inverter 2"},
+    {68, "Control Panel"},
+    {69, "Battery Monitor"},
+    {70, "Battery Monitor 2"},
+    {71, "Chassis Battery Monitor"},
+    {74, "Converter"},
+    {75, "Converter 2"},
+    {76, "Charge Controller"},
+    {77, "AC Load Monitor"},
+    {78, "AC Fault Protection"},
+    {79, "Transfer Switch"},
+    {131, "DC Load"},
+    {132, "DC_Input_Keypad"},
+    {137, "AC Load"},
+    {138, "DC Motor Controller"},
+    {140, "Generic AC Source"},
+    {141, "Solar Charge Controller"},
+    {249, "Service Tool"},
+    {250, "System Clock"},
+    {251, "Data Logger"},
+    {252, "Chassis Bridge"},
+    {253, "Network Bridge"},
+    {255, "Global"},
+};
+constexpr int16_t ENUMLOOKUP_8982_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, -1, -1, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1, 16, 17, -1, 18, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 20, 21, 22, 23, 24, -1, 25};
+constexpr uint16_t ENUMLOOKUP_8982_SEEDS[] = {0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 2, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_8982_SLOTS[] = {10, -1, -1, 22, -1, -1, 20, -1, 23, 3, 4, 16, -1, 15, -1, -1, -1, 11, -1, -1, 0, -1, -1, -1, -1, 8, 12, 7, -1, 1, 13, -1, -1, -1, -1, -1, 24, -1, 5, 17, 19, -1, 14, 18, -1, 21, 2, -1, -1, -1, -1, -1, -1, -1, 25, -1, 6, -1, 9, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_8982 = {ENUMLOOKUP_8982_ENTRIES, 64, 192, ENUMLOOKUP_8982_DENSE, 63, ENUMLOOKUP_8982_SEEDS, ENUMLOOKUP_8982_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_8986_ENTRIES[] = {
+    {0, "Gps"},
+    {1, "Glonass"},
+    {2, "Wwv"},
+    {3, "Local Cesium"},
+    {4, "Local Rubidium"},
+    {5, "Local Crystal"},
+    {6, "Reserved"},
+    {15, "Null"},
+};
+constexpr int16_t ENUMLOOKUP_8986_DENSE[] = {0, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, 7};
+constexpr uint16_t ENUMLOOKUP_8986_SEEDS[] = {0, 0, 1, 0, 0, 0, 2, 0, 0, 1, 0, 2, 0, 7, 0, 1};
+constexpr int16_t ENUMLOOKUP_8986_SLOTS[] = {7, 3, -1, -1, -1, 5, 4, -1, 0, 2, -1, -1, -1, -1, 1, 6};
+constexpr EnumTable ENUMLOOKUP_8986 = {ENUMLOOKUP_8986_ENTRIES, 0, 16, ENUMLOOKUP_8986_DENSE, 15, ENUMLOOKUP_8986_SEEDS, ENUMLOOKUP_8986_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_8989_ENTRIES[] = {
+    {0, "All"},
+    {1, "On Highway"},
+    {2, "Agriculture"},
+    {3, "Construction"},
+    {4, "Marine"},
+    {5, "Industrial"},
+    {6, "Reserved 1"},
+    {7, "Reserved 2"},
+};
+constexpr int16_t ENUMLOOKUP_8989_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7};
+constexpr uint16_t ENUMLOOKUP_8989_SEEDS[] = {0, 0, 0, 1, 0, 1, 1, 2, 0, 1, 0, 0, 0, 0, 2, 0};
+constexpr int16_t ENUMLOOKUP_8989_SLOTS[] = {-1, 1, 7, -1, -1, 0, 3, 5, 2, -1, -1, -1, 4, -1, -1, 6};
+constexpr EnumTable ENUMLOOKUP_8989 = {ENUMLOOKUP_8989_ENTRIES, 0, 8, ENUMLOOKUP_8989_DENSE, 15, ENUMLOOKUP_8989_SEEDS, ENUMLOOKUP_8989_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_8991_ENTRIES[] = {
+    {0, "Ack"},
+    {1, "Nak"},
+    {2, "Dny"},
+};
+constexpr int16_t ENUMLOOKUP_8991_DENSE[] = {0, 1, 2};
+constexpr uint16_t ENUMLOOKUP_8991_SEEDS[] = {1, 0, 0, 0, 1, 1, 0, 0};
+constexpr int16_t ENUMLOOKUP_8991_SLOTS[] = {-1, -1, 1, 0, -1, 2, -1, -1};
+constexpr EnumTable ENUMLOOKUP_8991 = {ENUMLOOKUP_8991_ENTRIES, 0, 3, ENUMLOOKUP_8991_DENSE, 7, ENUMLOOKUP_8991_SEEDS, ENUMLOOKUP_8991_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_8996_ENTRIES[] = {
+    {-1, "Do Not Care"},
+    {241, "Unsupported"},
+    {242, "Not Available"},
+    {243, "Data Access Error"},
+    {244, "Data Not Available"},
+    {245, "Data Invalid"},
+    {246, "DLC Invalid"},
+    {247, "Message Count"},
+    {248, "CAC"},
+    {249, "Configuration Type"},
+    {250, "Protocol"},
+    {251, "Security"},
+    {252, "Wrong Mode"},
+    {253, "Memory Error"},
+};
+constexpr int16_t ENUMLOOKUP_8996_DENSE[] = {0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+constexpr uint16_t ENUMLOOKUP_8996_SEEDS[] = {1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 3, 1, 0, 1, 1, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_8996_SLOTS[] = {-1, -1, -1, 8, 9, -1, -1, 13, 10, -1, -1, 0, 2, -1, -1, -1, 3, -1, -1, 12, 5, -1, 7, -1, -1, 1, -1, 4, -1, 11, 6, -1};
+constexpr EnumTable ENUMLOOKUP_8996 = {ENUMLOOKUP_8996_ENTRIES, -1, 255, ENUMLOOKUP_8996_DENSE, 31, ENUMLOOKUP_8996_SEEDS, ENUMLOOKUP_8996_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9001_ENTRIES[] = {
+    {0, "Default"},
+    {128, "User Interface"},
+    {129, "Inverter Charger"},
+    {130, "Inverter"},
+    {131, "Charger"},
+    {132, "Battery Monitor"},
+    {133, "AGS"},
+    {134, "Diagnostic Terminal"},
+    {135, "Gateway"},
+    {136, "Energy Management System"},
+    {137, "Battery Management System"},
+    {249, "Service Tool"},
+    {250, "System Clock"},
+};
+constexpr int16_t ENUMLOOKUP_9001_DENSE[] = {0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12};
+constexpr uint16_t ENUMLOOKUP_9001_SEEDS[] = {0, 1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 2, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 1, 4, 0};
+constexpr int16_t ENUMLOOKUP_9001_SLOTS[] = {-1, 11, 8, -1, 9, -1, 5, 2, 4, -1, -1, -1, 10, 12, 3, -1, -1, 6, 7, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1};
+constexpr EnumTable ENUMLOOKUP_9001 = {ENUMLOOKUP_9001_ENTRIES, 0, 251, ENUMLOOKUP_9001_DENSE, 31, ENUMLOOKUP_9001_SEEDS, ENUMLOOKUP_9001_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9002_ENTRIES[] = {
+    {0, "Reserved"},
+    {10, "System Tools"},
+    {20, "Safety"},
+    {25, "Gateway"},
+    {30, "Power Management"},
+    {40, "Steering"},
+    {50, "Propulsion"},
+    {60, "Navigation"},
+    {70, "Communications"},
+    {80, "Instrumentation And General"},
+    {90, "Environmental"},
+    {100, "Deck Cargo Fishing"},
+};
+constexpr int16_t ENUMLOOKUP_9002_DENSE[] = {0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, 3, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11};
+constexpr uint16_t ENUMLOOKUP_9002_SEEDS[] = {0, 0, 2, 1, 0, 3, 2, 0, 0, 0, 0, 0, 1, 0, 1, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_9002_SLOTS[] = {9, -1, -1, -1, 8, -1, 6, 5, 2, -1, -1, -1, -1, -1, -1, 0, -1, -1, 10, 4, -1, -1, 3, -1, -1, 11, -1, 1, -1, -1, -1, 7};
+constexpr EnumTable ENUMLOOKUP_9002 = {ENUMLOOKUP_9002_ENTRIES, 0, 101, ENUMLOOKUP_9002_DENSE, 31, ENUMLOOKUP_9002_SEEDS, ENUMLOOKUP_9002_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9066_ENTRIES[] = {
+    {0, "Off"},
+    {1, "On"},
+    {2, "Reserved"},
+    {3, "No Change"},
+};
+constexpr int16_t ENUMLOOKUP_9066_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_9066_SEEDS[] = {1, 0, 1, 0, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_9066_SLOTS[] = {-1, -1, 3, -1, 1, -1, 0, 2};
+constexpr EnumTable ENUMLOOKUP_9066 = {ENUMLOOKUP_9066_ENTRIES, 0, 4, ENUMLOOKUP_9066_DENSE, 7, ENUMLOOKUP_9066_SEEDS, ENUMLOOKUP_9066_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9075_ENTRIES[] = {
+    {0, "Off"},
+    {1, "On"},
+    {2, "Error"},
+    {3, "Unknown"},
+};
+constexpr int16_t ENUMLOOKUP_9075_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_9075_SEEDS[] = {0, 1, 2, 0, 0, 0, 2, 0};
+constexpr int16_t ENUMLOOKUP_9075_SLOTS[] = {0, -1, -1, 1, 2, -1, -1, 3};
+constexpr EnumTable ENUMLOOKUP_9075 = {ENUMLOOKUP_9075_ENTRIES, 0, 4, ENUMLOOKUP_9075_DENSE, 7, ENUMLOOKUP_9075_SEEDS, ENUMLOOKUP_9075_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9275_ENTRIES[] = {
+    {0, "ReqMessage"},
+    {1, "CmndMessage"},
+    {2, "AckMessage"},
+};
+constexpr int16_t ENUMLOOKUP_9275_DENSE[] = {0, 1, 2};
+constexpr uint16_t ENUMLOOKUP_9275_SEEDS[] = {1, 0, 0, 0, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_9275_SLOTS[] = {-1, 1, 0, -1, -1, 2, -1, -1};
+constexpr EnumTable ENUMLOOKUP_9275 = {ENUMLOOKUP_9275_ENTRIES, 0, 3, ENUMLOOKUP_9275_DENSE, 7, ENUMLOOKUP_9275_SEEDS, ENUMLOOKUP_9275_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9276_ENTRIES[] = {
+    {0, "TxPGNListMessage"},
+    {1, "RxPGNListMessage"},
+};
+constexpr int16_t ENUMLOOKUP_9276_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_9276_SEEDS[] = {0, 1, 0, 1};
+constexpr int16_t ENUMLOOKUP_9276_SLOTS[] = {-1, 0, -1, 1};
+constexpr EnumTable ENUMLOOKUP_9276 = {ENUMLOOKUP_9276_ENTRIES, 0, 2, ENUMLOOKUP_9276_DENSE, 3, ENUMLOOKUP_9276_SEEDS, ENUMLOOKUP_9276_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9404_ENTRIES[] = {
+    {0, "Disabled"},
+    {1, "Invert"},
+    {2, "AC Passthru"},
+    {3, "APS Only"},
+    {4, "Load Sense"},
+    {5, "Waiting To Invert"},
+    {6, "Generator Support"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_9404_DENSE[] = {0, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7};
+constexpr uint16_t ENUMLOOKUP_9404_SEEDS[] = {1, 0, 1, 0, 1, 4, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_9404_SLOTS[] = {7, -1, -1, 6, -1, -1, 0, 5, 3, -1, -1, -1, 4, 2, -1, 1};
+constexpr EnumTable ENUMLOOKUP_9404 = {ENUMLOOKUP_9404_ENTRIES, 0, 256, ENUMLOOKUP_9404_DENSE, 15, ENUMLOOKUP_9404_SEEDS, ENUMLOOKUP_9404_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9405_ENTRIES[] = {
+    {0, "Disable"},
+    {1, "Enable Inverter"},
+};
+constexpr int16_t ENUMLOOKUP_9405_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_9405_SEEDS[] = {0, 0, 1, 1};
+constexpr int16_t ENUMLOOKUP_9405_SLOTS[] = {-1, -1, 0, 1};
+constexpr EnumTable ENUMLOOKUP_9405 = {ENUMLOOKUP_9405_ENTRIES, 0, 2, ENUMLOOKUP_9405_DENSE, 3, ENUMLOOKUP_9405_SEEDS, ENUMLOOKUP_9405_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9407_ENTRIES[] = {
+    {0, "Disable"},
+    {1, "Not Charging"},
+    {2, "Bulk"},
+    {3, "Absorption"},
+    {4, "Overcharge"},
+    {5, "Equalize"},
+    {6, "Float"},
+    {7, "Constant Voltage Constant Current"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_9407_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8};
+constexpr uint16_t ENUMLOOKUP_9407_SEEDS[] = {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 0};
+constexpr int16_t ENUMLOOKUP_9407_SLOTS[] = {8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, 4, 7, -1, 1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, 3, 0, -1};
+constexpr EnumTable ENUMLOOKUP_9407 = {ENUMLOOKUP_9407_ENTRIES, 0, 256, ENUMLOOKUP_9407_DENSE, 31, ENUMLOOKUP_9407_SEEDS, ENUMLOOKUP_9407_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9408_ENTRIES[] = {
+    {0, "Constant Voltage"},
+    {1, "Constant Current"},
+    {2, "3 Stage"},
+    {3, "2 Stage"},
+    {4, "Trickle"},
+    {249, "Custom 2"},
+    {250, "Custom 1"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_9408_DENSE[] = {0, 1, 2, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, -1, -1, -1, -1, 7};
+constexpr uint16_t ENUMLOOKUP_9408_SEEDS[] = {0, 1, 2, 0, 0, 0, 1, 0, 0, 0, 1, 2, 0, 0, 0, 1};
+constexpr int16_t ENUMLOOKUP_9408_SLOTS[] = {1, 5, 3, -1, 0, 7, -1, -1, -1, -1, 2, -1, -1, 6, -1, 4};
+constexpr EnumTable ENUMLOOKUP_9408 = {ENUMLOOKUP_9408_ENTRIES, 0, 256, ENUMLOOKUP_9408_DENSE, 15, ENUMLOOKUP_9408_SEEDS, ENUMLOOKUP_9408_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9409_ENTRIES[] = {
+    {0, "Standalone"},
+    {1, "Primary"},
+    {2, "Secondary"},
+    {3, "Linked To DC Source"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_9409_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4};
+constexpr uint16_t ENUMLOOKUP_9409_SEEDS[] = {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1};
+constexpr int16_t ENUMLOOKUP_9409_SLOTS[] = {4, -1, 0, -1, 3, -1, 2, -1, -1, -1, -1, -1, -1, 1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_9409 = {ENUMLOOKUP_9409_ENTRIES, 0, 256, ENUMLOOKUP_9409_DENSE, 15, ENUMLOOKUP_9409_SEEDS, ENUMLOOKUP_9409_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9410_ENTRIES[] = {
+    {0, "Flooded"},
+    {1, "Gel"},
+    {2, "AGM"},
+    {3, "Lithium-Iron-Phosphate"},
+    {11, "BMS Directed Custom Li-Ion"},
+    {12, "Custom Li-Ion For CC/CV"},
+    {13, "Custom 1"},
+    {15, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_9410_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, 4, 5, 6, -1, 7};
+constexpr uint16_t ENUMLOOKUP_9410_SEEDS[] = {0, 1, 1, 0, 0, 2, 0, 0, 0, 0, 1, 1, 0, 2, 0, 3};
+constexpr int16_t ENUMLOOKUP_9410_SLOTS[] = {7, -1, 1, -1, -1, 0, -1, 3, 5, -1, 4, -1, -1, 6, -1, 2};
+constexpr EnumTable ENUMLOOKUP_9410 = {ENUMLOOKUP_9410_ENTRIES, 0, 16, ENUMLOOKUP_9410_DENSE, 15, ENUMLOOKUP_9410_SEEDS, ENUMLOOKUP_9410_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9411_ENTRIES[] = {
+    {0, "Disable"},
+    {1, "Enable Charger"},
+    {2, "Start Equalization"},
+    {3, "Top Up Battery"},
+    {255, "Data Not Available"},
+};
+constexpr int16_t ENUMLOOKUP_9411_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4};
+constexpr uint16_t ENUMLOOKUP_9411_SEEDS[] = {0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_9411_SLOTS[] = {-1, -1, -1, -1, -1, -1, -1, 2, 3, -1, -1, 1, 4, -1, 0, -1};
+constexpr EnumTable ENUMLOOKUP_9411 = {ENUMLOOKUP_9411_ENTRIES, 0, 256, ENUMLOOKUP_9411_DENSE, 15, ENUMLOOKUP_9411_SEEDS, ENUMLOOKUP_9411_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9415_ENTRIES[] = {
+    {0, "Stop"},
+    {1, "Start"},
+    {2, "Manual Prime"},
+    {3, "Manual Preheat"},
+};
+constexpr int16_t ENUMLOOKUP_9415_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_9415_SEEDS[] = {1, 1, 1, 2, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_9415_SLOTS[] = {1, -1, -1, -1, 2, -1, 3, 0};
+constexpr EnumTable ENUMLOOKUP_9415 = {ENUMLOOKUP_9415_ENTRIES, 0, 4, ENUMLOOKUP_9415_DENSE, 7, ENUMLOOKUP_9415_SEEDS, ENUMLOOKUP_9415_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9417_ENTRIES[] = {
+    {1, "Run Crank Inputs"},
+    {2, "Crank Glow Stop Inputs"},
+    {3, "Preheat Start Prime Stop Inputs"},
+    {4, "Single On Off Input"},
+};
+constexpr int16_t ENUMLOOKUP_9417_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_9417_SEEDS[] = {0, 1, 0, 1, 1, 1, 0, 0};
+constexpr int16_t ENUMLOOKUP_9417_SLOTS[] = {-1, 3, -1, 1, 0, -1, 2, -1};
+constexpr EnumTable ENUMLOOKUP_9417 = {ENUMLOOKUP_9417_ENTRIES, 1, 4, ENUMLOOKUP_9417_DENSE, 7, ENUMLOOKUP_9417_SEEDS, ENUMLOOKUP_9417_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9419_ENTRIES[] = {
+    {0, "Datum Above Normal Operating Range"},
+    {1, "Datum Below Normal Operating Range"},
+    {2, "Datum Erratic Intermittent Invalid"},
+    {3, "Short Circuit High Voltage"},
+    {4, "Short Circuit Low Voltage"},
+    {5, "Current Below Normal"},
+    {6, "Current Above Normal"},
+    {7, "Mechanical System Not Responding"},
+    {8, "Abnormal Frequency Pulse Width Period"},
+    {9, "Abnormal Update Rate"},
+    {10, "Abnormal Rate of Change"},
+    {11, "Failure Not Identifiable"},
+    {12, "Bad Intelligent Device Component"},
+    {13, "Out Of Calibration"},
+    {14, "None Of The Above"},
+    {15, "Datum Valid But Above Normal - Least Severe"},
+    {16, "Datum Valid But Above Normal - Moderately Severe"},
+    {17, "Datum Valid But Below Normal - Least Severe"},
+    {18, "Datum Valid But Below Normal - Moderately Severe"},
+    {19, "Received Invalid Network Datum"},
+    {20, "Polarity Reversed"},
+    {21, "Networked Device Not Responding"},
+    {22, "Reserved 1"},
+    {23, "Reserved 2"},
+    {24, "Reserved 3"},
+    {25, "Reserved 4"},
+    {26, "Reserved 5"},
+    {27, "Reserved 6"},
+    {28, "Reserved 7"},
+    {29, "Reserved 8"},
+    {30, "Reserved 9"},
+    {31, "No Failure Information Available"},
+};
+constexpr int16_t ENUMLOOKUP_9419_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
+constexpr uint16_t ENUMLOOKUP_9419_SEEDS[] = {0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 4, 1, 0, 1, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 1, 1, 1, 1, 2, 0, 0, 1, 0, 3, 2, 1};
+constexpr int16_t ENUMLOOKUP_9419_SLOTS[] = {19, 3, 30, 10, 2, 28, 11, 6, -1, -1, 15, -1, 1, -1, 18, 22, 14, 24, 20, -1, -1, -1, -1, -1, -1, 8, -1, 17, -1, -1, -1, 9, -1, -1, -1, 7, 31, -1, -1, 21, -1, 26, -1, 4, 5, 0, -1, 29, -1, 27, 23, 16, -1, 25, -1, -1, -1, -1, -1, -1, 12, -1, -1, 13};
+constexpr EnumTable ENUMLOOKUP_9419 = {ENUMLOOKUP_9419_ENTRIES, 0, 32, ENUMLOOKUP_9419_DENSE, 63, ENUMLOOKUP_9419_SEEDS, ENUMLOOKUP_9419_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9421_ENTRIES[] = {
+    {0, "No Complementary Leg"},
+    {1, "In Phase"},
+    {2, "Split Phase"},
+    {3, "Variable Phase"},
+    {14, "Error"},
+    {15, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_9421_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5};
+constexpr uint16_t ENUMLOOKUP_9421_SEEDS[] = {0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_9421_SLOTS[] = {5, 1, -1, 0, -1, 2, -1, -1, -1, -1, -1, 3, -1, -1, 4, -1};
+constexpr EnumTable ENUMLOOKUP_9421 = {ENUMLOOKUP_9421_ENTRIES, 0, 16, ENUMLOOKUP_9421_DENSE, 15, ENUMLOOKUP_9421_SEEDS, ENUMLOOKUP_9421_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_9422_ENTRIES[] = {
+    {0, "Dc Voltage"},
+    {1, "Dc Soc"},
+    {2, "Dc Current"},
+    {3, "Amb Temp"},
+    {4, "Xfer Switch Ac Point Voltage"},
+    {128, "Proprietary 1"},
+    {129, "Proprietary 2"},
+    {130, "Proprietary 3"},
+};
+constexpr int16_t ENUMLOOKUP_9422_DENSE[] = {0, 1, 2, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 7};
+constexpr uint16_t ENUMLOOKUP_9422_SEEDS[] = {0, 0, 1, 0, 1, 0, 1, 2, 0, 0, 1, 0, 0, 1, 0, 2};
+constexpr int16_t ENUMLOOKUP_9422_SLOTS[] = {-1, -1, -1, -1, 0, -1, 3, 4, 2, 7, -1, 6, 5, -1, -1, 1};
+constexpr EnumTable ENUMLOOKUP_9422 = {ENUMLOOKUP_9422_ENTRIES, 0, 131, ENUMLOOKUP_9422_DENSE, 15, ENUMLOOKUP_9422_SEEDS, ENUMLOOKUP_9422_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_101476251_ENTRIES[] = {
+    {0, "Wait File DL Inf"},
+    {1, "Wait File DL Blk"},
+    {2, "Writing Blk"},
+    {3, "Checking File"},
+    {4, "Wait Reboot"},
+    {5, "Erasing Blk"},
+};
+constexpr int16_t ENUMLOOKUP_101476251_DENSE[] = {0, 1, 2, 3, 4, 5};
+constexpr uint16_t ENUMLOOKUP_101476251_SEEDS[] = {0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1};
+constexpr int16_t ENUMLOOKUP_101476251_SLOTS[] = {-1, -1, 0, -1, 3, -1, 4, -1, 1, 2, -1, -1, -1, -1, -1, 5};
+constexpr EnumTable ENUMLOOKUP_101476251 = {ENUMLOOKUP_101476251_ENTRIES, 0, 6, ENUMLOOKUP_101476251_DENSE, 15, ENUMLOOKUP_101476251_SEEDS, ENUMLOOKUP_101476251_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_217496074_ENTRIES[] = {
+    {0, "DCDC Enable/Disable"},
+    {1, "Device Mode"},
+    {2, "Association"},
+    {3, "Auxiliary Configuration"},
+    {4, "Auxiliary Trigger Level"},
+    {5, "Auxiliary Trigger Delay"},
+    {6, "Audible Alarm Enable/Disable"},
+    {7, "Auxiliary Status"},
+};
+constexpr int16_t ENUMLOOKUP_217496074_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7};
+constexpr uint16_t ENUMLOOKUP_217496074_SEEDS[] = {0, 1, 1, 0, 0, 0, 0, 3, 0, 3, 0, 1, 0, 3, 0, 0};
+constexpr int16_t ENUMLOOKUP_217496074_SLOTS[] = {-1, -1, 3, 6, -1, 2, -1, 5, 7, 0, -1, 4, -1, -1, 1, -1};
+constexpr EnumTable ENUMLOOKUP_217496074 = {ENUMLOOKUP_217496074_ENTRIES, 0, 8, ENUMLOOKUP_217496074_DENSE, 15, ENUMLOOKUP_217496074_SEEDS, ENUMLOOKUP_217496074_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_240482193_ENTRIES[] = {
+    {0, "Unknown"},
+    {1, "Grid Priority"},
+    {2, "Generator Priority"},
+    {3, "Inverter Priority"},
+};
+constexpr int16_t ENUMLOOKUP_240482193_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_240482193_SEEDS[] = {0, 1, 0, 1, 0, 0, 0, 3};
+constexpr int16_t ENUMLOOKUP_240482193_SLOTS[] = {2, -1, 1, 3, -1, -1, -1, 0};
+constexpr EnumTable ENUMLOOKUP_240482193 = {ENUMLOOKUP_240482193_ENTRIES, 0, 4, ENUMLOOKUP_240482193_DENSE, 7, ENUMLOOKUP_240482193_SEEDS, ENUMLOOKUP_240482193_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_276767036_ENTRIES[] = {
+    {0, "Connected"},
+    {1, "Disconnected"},
+};
+constexpr int16_t ENUMLOOKUP_276767036_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_276767036_SEEDS[] = {0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_276767036_SLOTS[] = {1, -1, -1, 0};
+constexpr EnumTable ENUMLOOKUP_276767036 = {ENUMLOOKUP_276767036_ENTRIES, 0, 2, ENUMLOOKUP_276767036_DENSE, 3, ENUMLOOKUP_276767036_SEEDS, ENUMLOOKUP_276767036_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_281300007_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "Line 1"},
+    {2, "Line 2"},
+    {3, "Line 3"},
+    {13, "Reserved"},
+    {14, "Out Of Range"},
+    {15, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_281300007_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 6};
+constexpr uint16_t ENUMLOOKUP_281300007_SEEDS[] = {0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 3, 0};
+constexpr int16_t ENUMLOOKUP_281300007_SLOTS[] = {-1, 5, 6, 1, -1, -1, -1, 4, 2, 3, 0, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_281300007 = {ENUMLOOKUP_281300007_ENTRIES, 0, 16, ENUMLOOKUP_281300007_DENSE, 15, ENUMLOOKUP_281300007_SEEDS, ENUMLOOKUP_281300007_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_321179986_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "None"},
+    {2, "Anonymous"},
+    {3, "Shore1"},
+    {4, "Shore2"},
+    {5, "Shore3"},
+    {6, "Shore4"},
+    {7, "Shore5"},
+    {8, "Shore6"},
+    {9, "Shore7"},
+    {10, "Shore8"},
+    {11, "Shore9"},
+    {12, "Shore10"},
+    {13, "Shore11"},
+    {14, "Shore12"},
+    {15, "Shore13"},
+    {16, "Shore14"},
+    {17, "Shore15"},
+    {18, "Shore16"},
+    {19, "Gen1"},
+    {20, "Gen2"},
+    {21, "Gen3"},
+    {22, "Gen4"},
+    {23, "Gen5"},
+    {24, "Gen6"},
+    {25, "Gen7"},
+    {26, "Gen8"},
+    {27, "Gen9"},
+    {28, "Gen10"},
+    {29, "Gen11"},
+    {30, "Gen12"},
+    {31, "Gen13"},
+    {32, "Gen14"},
+    {33, "Gen15"},
+    {34, "Gen16"},
+    {35, "AC1"},
+    {36, "AC2"},
+    {37, "AC3"},
+    {38, "AC4"},
+    {39, "AC5"},
+    {40, "AC6"},
+    {41, "AC7"},
+    {42, "AC8"},
+    {43, "AC9"},
+    {44, "AC10"},
+    {45, "AC11"},
+    {46, "AC12"},
+    {47, "AC13"},
+    {48, "AC14"},
+    {49, "AC15"},
+    {50, "AC16"},
+    {51, "AC Load1"},
+    {52, "AC Load2"},
+    {53, "AC Load3"},
+    {54, "AC Load4"},
+    {55, "AC Load5"},
+    {56, "AC Load6"},
+    {57, "AC Load7"},
+    {58, "AC Load8"},
+    {59, "AC Load9"},
+    {60, "AC Load10"},
+    {61, "AC Load11"},
+    {62, "AC Load12"},
+    {63, "AC Load13"},
+    {64, "AC Load14"},
+    {65, "AC Load15"},
+    {66, "AC Load16"},
+    {67, "Grid1"},
+    {68, "Grid2"},
+    {69, "Grid3"},
+    {70, "Grid4"},
+    {71, "Grid5"},
+    {72, "Grid6"},
+    {73, "Grid7"},
+    {74, "Grid8"},
+    {75, "Grid9"},
+    {76, "Grid10"},
+    {77, "Grid11"},
+    {78, "Grid12"},
+    {79, "Grid13"},
+    {80, "Grid14"},
+    {81, "Grid15"},
+    {82, "Grid16"},
+    {252, "All"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_321179986_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 83, 84, 85, 86};
+constexpr uint16_t ENUMLOOKUP_321179986_SEEDS[] = {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 2, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 2, 1, 1, 0, 1, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 2, 1, 0, 1, 3, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 2, 0, 0, 2, 0, 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 2, 0, 0, 0, 1, 0, 2, 0, 0, 1, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 2, 0, 0, 1, 0, 1};
+constexpr int16_t ENUMLOOKUP_321179986_SLOTS[] = {82, -1, -1, -1, 62, -1, -1, 26, 76, -1, -1, 61, -1, 24, -1, -1, 2, 73, 9, 44, 8, 10, 35, -1, -1, -1, 71, 49, -1, -1, -1, -1, -1, -1, -1, -1, -1, 77, -1, -1, 32, -1, -1, -1, 45, -1, -1, -1, 42, -1, 56, -1, -1, 79, -1, -1, -1, -1, 38, -1, -1, -1, 47, 11, -1, 63, -1, -1, -1, 15, -1, -1, -1, -1, 66, -1, 37, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, 57, -1, 12, -1, 25, 54, -1, -1, -1, -1, -1, 68, 1, 18, 84, 48, -1, 85, -1, -1, 20, 67, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 34, -1, -1, -1, -1, -1, 72, 86, -1, -1, -1, 46, 40, -1, -1, -1, -1, -1, 78, -1, -1, -1, 36, 69, -1, -1, -1, -1, -1, -1, 6, -1, -1, 65, -1, -1, -1, -1, -1, -1, -1, 33, -1, -1, 53, -1, -1, -1, -1, -1, -1, -1, -1, 17, -1, -1, 60, 43, -1, 52, -1, 28, -1, 41, -1, 59, -1, 75, -1, -1, -1, -1, 55, 70, -1, 80, -1, 19, 74, -1, 3, 5, 23, -1, -1, 14, -1, 7, 31, -1, -1, 39, -1, -1, -1, -1, 64, 21, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, 83, 30, 0, -1, -1, -1, -1, -1, -1, 13, -1, 50, 16, -1, 27, 81, 58, -1, -1, 29, -1, 51, -1, -1};
+constexpr EnumTable ENUMLOOKUP_321179986 = {ENUMLOOKUP_321179986_ENTRIES, 0, 256, ENUMLOOKUP_321179986_DENSE, 255, ENUMLOOKUP_321179986_SEEDS, ENUMLOOKUP_321179986_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_421711928_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "Main House Battery Bank"},
+    {2, "Chassis Start Battery"},
+    {3, "Secondary House Battery Bank"},
+    {255, "Unknown Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_421711928_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4};
+constexpr uint16_t ENUMLOOKUP_421711928_SEEDS[] = {0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1};
+constexpr int16_t ENUMLOOKUP_421711928_SLOTS[] = {-1, 3, 4, -1, -1, -1, -1, -1, 1, -1, 0, -1, -1, -1, 2, -1};
+constexpr EnumTable ENUMLOOKUP_421711928 = {ENUMLOOKUP_421711928_ENTRIES, 0, 256, ENUMLOOKUP_421711928_DENSE, 15, ENUMLOOKUP_421711928_SEEDS, ENUMLOOKUP_421711928_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_498223742_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "Being Qualified"},
+    {2, "Bad Frequency"},
+    {3, "Bad Level"},
+    {4, "Good"},
+    {21, "Frequency Low"},
+    {22, "Frequency High"},
+    {31, "Voltage Low"},
+    {32, "Voltage High"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_498223742_DENSE[] = {0, 1, 2, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, 7, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 9, 10, 11};
+constexpr uint16_t ENUMLOOKUP_498223742_SEEDS[] = {0, 0, 0, 0, 4, 0, 1, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 3, 1, 5, 0, 2, 0, 0, 0, 0, 3, 0, 0};
+constexpr int16_t ENUMLOOKUP_498223742_SLOTS[] = {4, -1, 10, -1, -1, -1, -1, 9, 8, 6, 5, -1, -1, -1, -1, 1, -1, 7, -1, -1, -1, 0, -1, -1, -1, 11, -1, -1, 2, -1, -1, 3};
+constexpr EnumTable ENUMLOOKUP_498223742 = {ENUMLOOKUP_498223742_ENTRIES, 0, 256, ENUMLOOKUP_498223742_DENSE, 31, ENUMLOOKUP_498223742_SEEDS, ENUMLOOKUP_498223742_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_535997516_ENTRIES[] = {
+    {0, "XanBus"},
+    {1, "OperatingSystem"},
+    {2, "Application"},
+    {3, "Loader"},
+    {4, "Reserved2"},
+    {5, "Other1"},
+    {6, "Other2"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_535997516_DENSE[] = {0, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, 8, 9};
+constexpr uint16_t ENUMLOOKUP_535997516_SEEDS[] = {0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_535997516_SLOTS[] = {-1, -1, 9, -1, -1, -1, -1, 7, -1, -1, 8, 3, -1, -1, -1, -1, -1, 2, -1, -1, 0, 4, 5, -1, -1, 6, -1, -1, -1, 1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_535997516 = {ENUMLOOKUP_535997516_ENTRIES, 0, 256, ENUMLOOKUP_535997516_DENSE, 31, ENUMLOOKUP_535997516_SEEDS, ENUMLOOKUP_535997516_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_666383381_ENTRIES[] = {
+    {0, "Not Derating"},
+    {1, "High Internal Temperature"},
+    {2, "High Battery Temperature"},
+    {3, "Battery Voltage"},
+    {4, "AC Input Voltage"},
+    {5, "AC Input Current"},
+};
+constexpr int16_t ENUMLOOKUP_666383381_DENSE[] = {0, 1, 2, 3, 4, 5};
+constexpr uint16_t ENUMLOOKUP_666383381_SEEDS[] = {1, 0, 0, 0, 3, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_666383381_SLOTS[] = {-1, -1, 0, -1, -1, -1, 4, 5, 3, 1, 2, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_666383381 = {ENUMLOOKUP_666383381_ENTRIES, 0, 6, ENUMLOOKUP_666383381_DENSE, 15, ENUMLOOKUP_666383381_SEEDS, ENUMLOOKUP_666383381_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_872434401_ENTRIES[] = {
+    {0, "Unqualified No AC Present"},
+    {1, "Unqualified Bad AC"},
+    {2, "Waiting to Qualify"},
+    {3, "Qualifying"},
+    {4, "Qualified Good AC"},
+    {15, "Undefined Value"},
+};
+constexpr int16_t ENUMLOOKUP_872434401_DENSE[] = {0, 1, 2, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5};
+constexpr uint16_t ENUMLOOKUP_872434401_SEEDS[] = {1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 2, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_872434401_SLOTS[] = {1, 4, 3, -1, -1, -1, 0, -1, 2, 5, -1, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_872434401 = {ENUMLOOKUP_872434401_ENTRIES, 0, 16, ENUMLOOKUP_872434401_DENSE, 15, ENUMLOOKUP_872434401_SEEDS, ENUMLOOKUP_872434401_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_972277822_ENTRIES[] = {
+    {0, "Time to Empty"},
+    {1, "Time to Full"},
+};
+constexpr int16_t ENUMLOOKUP_972277822_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_972277822_SEEDS[] = {1, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_972277822_SLOTS[] = {-1, 1, -1, 0};
+constexpr EnumTable ENUMLOOKUP_972277822 = {ENUMLOOKUP_972277822_ENTRIES, 0, 2, ENUMLOOKUP_972277822_DENSE, 3, ENUMLOOKUP_972277822_SEEDS, ENUMLOOKUP_972277822_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1426290752_ENTRIES[] = {
+    {0, "No Error"},
+    {1, "Invalid File DL Inf"},
+    {2, "Invalid File DL Blk"},
+    {3, "Blk Write Err"},
+    {4, "File CRC Err"},
+};
+constexpr int16_t ENUMLOOKUP_1426290752_DENSE[] = {0, 1, 2, 3, 4};
+constexpr uint16_t ENUMLOOKUP_1426290752_SEEDS[] = {1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_1426290752_SLOTS[] = {-1, -1, 2, -1, 3, -1, -1, 1, -1, 0, -1, 4, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1426290752 = {ENUMLOOKUP_1426290752_ENTRIES, 0, 5, ENUMLOOKUP_1426290752_DENSE, 15, ENUMLOOKUP_1426290752_SEEDS, ENUMLOOKUP_1426290752_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1484268128_ENTRIES[] = {
+    {0, "Not pre-charging"},
+    {1, "Pre-charging for equalization"},
+    {2, "Reserved"},
+    {3, "Undefined Value"},
+};
+constexpr int16_t ENUMLOOKUP_1484268128_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_1484268128_SEEDS[] = {0, 0, 1, 1, 0, 1, 1, 0};
+constexpr int16_t ENUMLOOKUP_1484268128_SLOTS[] = {-1, 3, 0, 1, -1, -1, -1, 2};
+constexpr EnumTable ENUMLOOKUP_1484268128 = {ENUMLOOKUP_1484268128_ENTRIES, 0, 4, ENUMLOOKUP_1484268128_DENSE, 7, ENUMLOOKUP_1484268128_SEEDS, ENUMLOOKUP_1484268128_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1484338823_ENTRIES[] = {
+    {0, "True Sine Wave"},
+    {1, "Not Sine Wave"},
+    {2, "Reserved"},
+    {3, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_1484338823_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_1484338823_SEEDS[] = {0, 0, 1, 1, 2, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_1484338823_SLOTS[] = {3, -1, 1, -1, 0, -1, -1, 2};
+constexpr EnumTable ENUMLOOKUP_1484338823 = {ENUMLOOKUP_1484338823_ENTRIES, 0, 4, ENUMLOOKUP_1484338823_DENSE, 7, ENUMLOOKUP_1484338823_SEEDS, ENUMLOOKUP_1484338823_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1484358105_ENTRIES[] = {
+    {0, "Charging Not Forced"},
+    {1, "Force Charge To Bulk"},
+    {2, "Force Charge To Float"},
+    {14, "No Change"},
+    {15, "Undefined"},
+};
+constexpr int16_t ENUMLOOKUP_1484358105_DENSE[] = {0, 1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, 4};
+constexpr uint16_t ENUMLOOKUP_1484358105_SEEDS[] = {1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 0, 0};
+constexpr int16_t ENUMLOOKUP_1484358105_SLOTS[] = {-1, -1, -1, -1, 1, 0, 4, -1, -1, -1, 3, -1, -1, 2, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1484358105 = {ENUMLOOKUP_1484358105_ENTRIES, 0, 16, ENUMLOOKUP_1484358105_DENSE, 15, ENUMLOOKUP_1484358105_SEEDS, ENUMLOOKUP_1484358105_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1485834791_ENTRIES[] = {
+    {0, "Voltage OK"},
+    {1, "Extremely Low Voltage"},
+    {2, "Low Voltage"},
+    {3, "High Voltage"},
+    {4, "Extremely High Voltage"},
+    {5, "Open Line 1 Detected"},
+    {6, "Open Line 2 Detected"},
+    {252, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available"},
+};
+constexpr int16_t ENUMLOOKUP_1485834791_DENSE[] = {0, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, 8, 9};
+constexpr uint16_t ENUMLOOKUP_1485834791_SEEDS[] = {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_1485834791_SLOTS[] = {-1, -1, -1, -1, 6, 5, 0, 7, 4, -1, 8, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, 1, -1, -1, -1, -1, 3, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1485834791 = {ENUMLOOKUP_1485834791_ENTRIES, 0, 256, ENUMLOOKUP_1485834791_DENSE, 31, ENUMLOOKUP_1485834791_SEEDS, ENUMLOOKUP_1485834791_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1486082168_ENTRIES[] = {
+    {20, "Voltmeter"},
+    {40, "Voltmeter Ammeter"},
+    {60, "Inverter"},
+    {80, "Charger"},
+    {100, "Inverter Charger"},
+    {120, "Battery SOC Device"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_1486082168_DENSE[] = {0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6};
+constexpr uint16_t ENUMLOOKUP_1486082168_SEEDS[] = {1, 1, 0, 0, 1, 0, 2, 1, 0, 0, 0, 1, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_1486082168_SLOTS[] = {6, -1, 3, -1, 1, 0, -1, 4, 5, -1, -1, -1, -1, -1, 2, -1};
+constexpr EnumTable ENUMLOOKUP_1486082168 = {ENUMLOOKUP_1486082168_ENTRIES, 20, 236, ENUMLOOKUP_1486082168_DENSE, 15, ENUMLOOKUP_1486082168_SEEDS, ENUMLOOKUP_1486082168_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1546649241_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "DCInput"},
+    {2, "DCOut"},
+    {3, "DCInputOut"},
+    {4, "Reserved"},
+    {5, "ACInput"},
+    {6, "ACOut"},
+    {7, "ACInputOut"},
+};
+constexpr int16_t ENUMLOOKUP_1546649241_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7};
+constexpr uint16_t ENUMLOOKUP_1546649241_SEEDS[] = {0, 0, 1, 0, 1, 0, 2, 0, 0, 2, 1, 0, 0, 1, 0, 1};
+constexpr int16_t ENUMLOOKUP_1546649241_SLOTS[] = {-1, 5, -1, -1, -1, -1, 2, 1, 7, 6, 0, -1, 3, -1, -1, 4};
+constexpr EnumTable ENUMLOOKUP_1546649241 = {ENUMLOOKUP_1546649241_ENTRIES, 0, 8, ENUMLOOKUP_1546649241_DENSE, 15, ENUMLOOKUP_1546649241_SEEDS, ENUMLOOKUP_1546649241_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1546651609_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "SinglePhaseStandAlone"},
+    {11, "SinglePhaseMaster"},
+    {12, "SinglePhaseSlave"},
+    {20, "SplitPhaseStandAlone"},
+    {21, "SplitPhaseMaster"},
+    {22, "SplitPhaseSlave"},
+    {23, "TwoPhase Phase1Master"},
+    {24, "TwoPhase Phase1Slave"},
+    {25, "TwoPhase Phase2Master"},
+    {26, "TwoPhase Phase2Slave"},
+    {30, "ThreePhaseStandAlone"},
+    {31, "ThreePhaseMaster"},
+    {32, "ThreePhaseSlave"},
+    {33, "ThreePhase Phase1Master"},
+    {34, "ThreePhase Phase1Slave"},
+    {35, "ThreePhase Phase2Master"},
+    {36, "ThreePhase Phase2Slave"},
+    {37, "ThreePhase Phase3Master"},
+    {38, "ThreePhase Phase3Slave"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_1546651609_DENSE[] = {0, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, -1, -1, -1, 4, 5, 6, 7, 8, 9, 10, -1, -1, -1, 11, 12, 13, 14, 15, 16, 17, 18, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 20, 21, 22};
+constexpr uint16_t ENUMLOOKUP_1546651609_SEEDS[] = {0, 1, 0, 0, 1, 1, 0, 0, 0, 4, 0, 1, 0, 1, 0, 2, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 2, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 3, 0};
+constexpr int16_t ENUMLOOKUP_1546651609_SLOTS[] = {18, -1, 22, 6, -1, 7, 3, -1, 16, 5, 12, -1, -1, 13, -1, -1, 2, -1, 8, -1, -1, -1, -1, 9, 19, -1, -1, -1, 17, -1, -1, 10, -1, -1, 21, -1, 1, -1, 11, 20, -1, -1, 0, -1, 15, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1546651609 = {ENUMLOOKUP_1546651609_ENTRIES, 0, 256, ENUMLOOKUP_1546651609_DENSE, 63, ENUMLOOKUP_1546651609_SEEDS, ENUMLOOKUP_1546651609_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1546979661_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "Assoc Cfg"},
+    {2, "Request"},
+    {3, "Assoc Sts"},
+    {4, "Dev Mode Cfg"},
+    {5, "FXCC Cfg Cmd"},
+    {6, "Dev Mode Sts"},
+    {7, "FXCC Cfg Sts"},
+    {8, "SW Ver Sts"},
+    {9, "RPC Cmd"},
+    {10, "Inv LS Sts"},
+    {11, "Inv Sts"},
+    {12, "Chg Sts"},
+    {14, "Inv Ctrl Cmd"},
+    {15, "AC Sts RMS"},
+    {16, "AC Xfer Sw Sts"},
+    {17, "Get Configuration Parameter"},
+    {18, "Set Configuration Parameter"},
+    {19, "Get Status Parameter"},
+    {96, "PpnSessionCmd"},
+    {97, "PpnSessionRsp"},
+    {98, "PpnReadCmd"},
+    {99, "PpnReadRsp"},
+    {100, "PpnWriteCmd"},
+    {101, "PpnWriteRsp"},
+    {127, "PpnNakRsp"},
+    {170, "Lithionics Cmd"},
+    {171, "Lithionics Sts"},
+};
+constexpr int16_t ENUMLOOKUP_1546979661_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, -1, 13, 14, 15, 16, 17, 18, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 19, 20, 21, 22, 23, 24, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 25, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 26, 27};
+constexpr uint16_t ENUMLOOKUP_1546979661_SEEDS[] = {1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1, 5, 0, 1, 0, 3, 0, 2, 0, 1, 1, 2, 0, 0, 1, 1, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+constexpr int16_t ENUMLOOKUP_1546979661_SLOTS[] = {19, -1, -1, 16, -1, -1, -1, 11, 6, 26, 2, 9, -1, -1, 17, -1, 21, -1, 22, 4, 23, -1, 20, 25, -1, -1, -1, -1, 18, 1, 15, -1, -1, 27, -1, -1, 3, -1, -1, 14, -1, -1, 0, -1, -1, 24, -1, -1, -1, -1, -1, 12, 7, -1, 10, -1, 5, -1, 8, -1, -1, 13, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1546979661 = {ENUMLOOKUP_1546979661_ENTRIES, 0, 172, ENUMLOOKUP_1546979661_DENSE, 63, ENUMLOOKUP_1546979661_SEEDS, ENUMLOOKUP_1546979661_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1552924287_ENTRIES[] = {
+    {0, "Off"},
+    {1, "Lock Out"},
+    {2, "Auto Off"},
+    {3, "Error"},
+};
+constexpr int16_t ENUMLOOKUP_1552924287_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_1552924287_SEEDS[] = {0, 0, 0, 5, 0, 0, 2, 0};
+constexpr int16_t ENUMLOOKUP_1552924287_SLOTS[] = {0, 2, -1, -1, 3, -1, -1, 1};
+constexpr EnumTable ENUMLOOKUP_1552924287 = {ENUMLOOKUP_1552924287_ENTRIES, 0, 4, ENUMLOOKUP_1552924287_DENSE, 7, ENUMLOOKUP_1552924287_SEEDS, ENUMLOOKUP_1552924287_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1558143328_ENTRIES[] = {
+    {1, "Battery Current"},
+    {2, "Battery Voltage"},
+    {3, "APS Voltage"},
+    {4, "AC1_In Current L1"},
+    {5, "AC1_In Current L2"},
+    {6, "AC1_In Voltage L1"},
+    {7, "AC1_In Voltage L2"},
+    {8, "AC1_In Voltage L1L2"},
+    {9, "AC2_In Current L1"},
+    {10, "AC2_In Current L2"},
+    {11, "AC2_In Voltage L1"},
+    {12, "AC2_In Voltage L2"},
+    {13, "AC2_In Voltage L1L2"},
+    {14, "AC Out Voltage"},
+    {15, "AC Out Current"},
+    {16, "AC Out Hi Res Current"},
+    {17, "AC Out Current L1"},
+    {18, "AC Out Current L2"},
+    {19, "Ref AC Out Voltage RMS"},
+    {20, "Ref DC Out Voltage"},
+    {21, "Ref DC Out Current"},
+    {22, "DC_DC Out Current"},
+    {23, "DC_DC Out Voltage"},
+};
+constexpr int16_t ENUMLOOKUP_1558143328_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22};
+constexpr uint16_t ENUMLOOKUP_1558143328_SEEDS[] = {0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 2, 0, 2, 1, 0, 0, 0, 0, 0, 2};
+constexpr int16_t ENUMLOOKUP_1558143328_SLOTS[] = {-1, 15, -1, -1, -1, -1, 8, -1, -1, -1, 2, 12, -1, 3, -1, 21, 18, -1, -1, 16, -1, 20, -1, -1, -1, -1, -1, -1, 11, -1, 13, 17, -1, 14, 7, -1, -1, -1, 5, 19, -1, -1, -1, -1, -1, -1, 4, -1, -1, 0, 6, -1, -1, 9, -1, 10, 1, -1, 22, -1, -1, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1558143328 = {ENUMLOOKUP_1558143328_ENTRIES, 1, 23, ENUMLOOKUP_1558143328_DENSE, 63, ENUMLOOKUP_1558143328_SEEDS, ENUMLOOKUP_1558143328_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1576267937_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "AC Input 1"},
+    {2, "AC Input 2"},
+    {3, "AC Input 3"},
+    {4, "AC Input 4"},
+    {5, "AC Output 1"},
+    {6, "AC Output 2"},
+    {7, "AC Output 3"},
+    {8, "AC Output 4"},
+    {13, "Reserved"},
+    {14, "Out Of Range"},
+    {15, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_1576267937_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, -1, -1, -1, -1, 9, 10, 11};
+constexpr uint16_t ENUMLOOKUP_1576267937_SEEDS[] = {0, 3, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 1, 3, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_1576267937_SLOTS[] = {-1, -1, 10, -1, 4, -1, -1, 1, 6, -1, 0, -1, -1, 3, -1, 9, -1, 5, -1, 8, -1, -1, -1, -1, -1, 11, -1, -1, 2, -1, -1, 7};
+constexpr EnumTable ENUMLOOKUP_1576267937 = {ENUMLOOKUP_1576267937_ENTRIES, 0, 16, ENUMLOOKUP_1576267937_DENSE, 31, ENUMLOOKUP_1576267937_SEEDS, ENUMLOOKUP_1576267937_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1594080027_ENTRIES[] = {
+    {0, "Auto On"},
+    {1, "Auto Off"},
+    {2, "Manual On"},
+    {3, "Manual Off"},
+};
+constexpr int16_t ENUMLOOKUP_1594080027_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_1594080027_SEEDS[] = {0, 0, 0, 1, 0, 0, 1, 1};
+constexpr int16_t ENUMLOOKUP_1594080027_SLOTS[] = {1, -1, -1, 0, 3, -1, -1, 2};
+constexpr EnumTable ENUMLOOKUP_1594080027 = {ENUMLOOKUP_1594080027_ENTRIES, 0, 4, ENUMLOOKUP_1594080027_DENSE, 7, ENUMLOOKUP_1594080027_SEEDS, ENUMLOOKUP_1594080027_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1594238759_ENTRIES[] = {
+    {0, "Battery Voltage Low Set"},
+    {1, "Battery Voltage Low Clr"},
+    {2, "Battery Voltage High Set"},
+    {3, "Battery Voltage High Clr"},
+    {4, "Battery Temp Low Set"},
+    {5, "Battery Temp Low Clr"},
+    {6, "Battery Temp High Set"},
+    {7, "Battery Temp High Clr"},
+    {8, "Fault Set"},
+    {9, "Fault Clr"},
+    {10, "AC Good Set"},
+    {11, "AC Good Clr"},
+    {12, "Bulk Exit Clr"},
+    {13, "Absorption Exit Clr"},
+    {14, "Internal Temp High Set"},
+    {15, "Internal Temp High Clr"},
+    {16, "Time Of Day Set"},
+    {17, "Time Of Day Clr"},
+};
+constexpr int16_t ENUMLOOKUP_1594238759_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+constexpr uint16_t ENUMLOOKUP_1594238759_SEEDS[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_1594238759_SLOTS[] = {3, -1, 11, -1, 15, -1, -1, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1, 10, -1, -1, -1, 0, -1, 8, -1, -1, -1, -1, -1, 2, -1, -1, 14, -1, -1, -1, -1, -1, 17, -1, -1, -1, -1, 13, -1, -1, 4, -1, 9, -1, -1, -1, -1, -1, -1, -1, 12, -1, -1, -1, 1, 6, 16, -1};
+constexpr EnumTable ENUMLOOKUP_1594238759 = {ENUMLOOKUP_1594238759_ENTRIES, 0, 18, ENUMLOOKUP_1594238759_DENSE, 63, ENUMLOOKUP_1594238759_SEEDS, ENUMLOOKUP_1594238759_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1599683911_ENTRIES[] = {
+    {0, "Undefined Source Decides"},
+    {1, "Do Not Charge"},
+    {2, "Bulk"},
+    {3, "Absorption"},
+    {4, "Overcharge"},
+    {5, "Equalize"},
+    {6, "Float"},
+    {7, "CVCC"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_1599683911_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8};
+constexpr uint16_t ENUMLOOKUP_1599683911_SEEDS[] = {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 2};
+constexpr int16_t ENUMLOOKUP_1599683911_SLOTS[] = {8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, 4, -1, 7, -1, -1, -1, 0, -1, 5, -1, -1, 1, -1, -1, 3, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1599683911 = {ENUMLOOKUP_1599683911_ENTRIES, 0, 256, ENUMLOOKUP_1599683911_DENSE, 31, ENUMLOOKUP_1599683911_SEEDS, ENUMLOOKUP_1599683911_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1608161778_ENTRIES[] = {
+    {0, "Off"},
+    {1, "On"},
+};
+constexpr int16_t ENUMLOOKUP_1608161778_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_1608161778_SEEDS[] = {0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_1608161778_SLOTS[] = {1, -1, 0, -1};
+constexpr EnumTable ENUMLOOKUP_1608161778 = {ENUMLOOKUP_1608161778_ENTRIES, 0, 2, ENUMLOOKUP_1608161778_DENSE, 3, ENUMLOOKUP_1608161778_SEEDS, ENUMLOOKUP_1608161778_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1650332213_ENTRIES[] = {
+    {0, "Not Charging"},
+    {1, "Bulk"},
+    {2, "Absorption"},
+    {3, "Overcharge"},
+    {4, "Equalize"},
+    {5, "Float"},
+    {6, "No Float"},
+    {7, "Constant VI"},
+    {8, "Charger Disabled"},
+    {9, "Qualifying AC"},
+    {10, "Qualifying APS"},
+    {11, "Engaging Charger"},
+    {12, "Charge Fault"},
+    {13, "Charger Suspend"},
+    {14, "AC Good"},
+    {15, "APS Good"},
+    {16, "AC Fault"},
+    {17, "Charge"},
+    {18, "Absorption Exit Pending"},
+    {19, "Ground Fault"},
+    {20, "AC Good Pending"},
+    {21, "Load Shaving"},
+    {22, "AC Support"},
+    {23, "AC Coupled"},
+    {24, "AC Coupled Bulk"},
+    {25, "AC Coupled Absorption"},
+    {26, "AC Coupled Float"},
+    {27, "AC Coupled No Float"},
+    {28, "External BMS"},
+    {29, "Load Sense"},
+};
+constexpr int16_t ENUMLOOKUP_1650332213_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29};
+constexpr uint16_t ENUMLOOKUP_1650332213_SEEDS[] = {0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 2, 1, 0, 0, 0, 1, 0, 0, 0, 0, 3, 1, 0, 0, 2, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 2, 0, 0, 2};
+constexpr int16_t ENUMLOOKUP_1650332213_SLOTS[] = {24, 16, 20, -1, 10, 4, 8, -1, 23, -1, -1, -1, -1, 1, -1, 17, -1, -1, 14, -1, -1, -1, 5, 3, 18, -1, 15, -1, -1, 29, -1, 12, 0, -1, 13, 26, -1, -1, -1, -1, 28, 6, 21, -1, -1, -1, -1, -1, -1, -1, -1, -1, 27, 9, 7, 19, -1, -1, 11, 22, -1, 2, -1, 25};
+constexpr EnumTable ENUMLOOKUP_1650332213 = {ENUMLOOKUP_1650332213_ENTRIES, 0, 30, ENUMLOOKUP_1650332213_DENSE, 63, ENUMLOOKUP_1650332213_SEEDS, ENUMLOOKUP_1650332213_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1653075463_ENTRIES[] = {
+    {0, "Cell Not Balance"},
+    {1, "Balance Process Active"},
+};
+constexpr int16_t ENUMLOOKUP_1653075463_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_1653075463_SEEDS[] = {1, 0, 3, 0};
+constexpr int16_t ENUMLOOKUP_1653075463_SLOTS[] = {-1, 1, 0, -1};
+constexpr EnumTable ENUMLOOKUP_1653075463 = {ENUMLOOKUP_1653075463_ENTRIES, 0, 2, ENUMLOOKUP_1653075463_DENSE, 3, ENUMLOOKUP_1653075463_SEEDS, ENUMLOOKUP_1653075463_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1659473592_ENTRIES[] = {
+    {0, "Off"},
+    {1, "On"},
+    {254, "Reserved"},
+    {255, "No Data"},
+};
+constexpr int16_t ENUMLOOKUP_1659473592_DENSE[] = {0, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_1659473592_SEEDS[] = {0, 0, 1, 1, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_1659473592_SLOTS[] = {3, -1, -1, -1, 1, -1, 0, 2};
+constexpr EnumTable ENUMLOOKUP_1659473592 = {ENUMLOOKUP_1659473592_ENTRIES, 0, 256, ENUMLOOKUP_1659473592_DENSE, 7, ENUMLOOKUP_1659473592_SEEDS, ENUMLOOKUP_1659473592_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1663267569_ENTRIES[] = {
+    {0, "DCDC Voltage"},
+    {1, "DCDC Current"},
+    {2, "Auxiliary Status"},
+};
+constexpr int16_t ENUMLOOKUP_1663267569_DENSE[] = {0, 1, 2};
+constexpr uint16_t ENUMLOOKUP_1663267569_SEEDS[] = {0, 0, 1, 1, 0, 0, 0, 1};
+constexpr int16_t ENUMLOOKUP_1663267569_SLOTS[] = {2, -1, -1, 1, 0, -1, -1, -1};
+constexpr EnumTable ENUMLOOKUP_1663267569 = {ENUMLOOKUP_1663267569_ENTRIES, 0, 3, ENUMLOOKUP_1663267569_DENSE, 7, ENUMLOOKUP_1663267569_SEEDS, ENUMLOOKUP_1663267569_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1671234938_ENTRIES[] = {
+    {0, "Invalid"},
+    {1, "Source Connection"},
+    {2, "Load Connection"},
+    {3, "Primary To Secondary Bridge"},
+    {4, "Main Battery Contactor"},
+    {5, "Reserved1"},
+    {6, "Reserved2"},
+    {7, "Reserved3"},
+    {8, "Reserved4"},
+    {9, "Reserved5"},
+    {10, "Reserved6"},
+    {11, "Reserved7"},
+    {12, "Reserved8"},
+    {13, "Reserved9"},
+    {14, "Reserved10"},
+    {15, "Unspecified"},
+};
+constexpr int16_t ENUMLOOKUP_1671234938_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+constexpr uint16_t ENUMLOOKUP_1671234938_SEEDS[] = {1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 4, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_1671234938_SLOTS[] = {11, -1, -1, 8, -1, -1, -1, -1, 12, 13, 0, -1, 15, -1, -1, 4, -1, -1, 2, 9, 14, 6, -1, 5, -1, 3, -1, 7, 10, -1, -1, 1};
+constexpr EnumTable ENUMLOOKUP_1671234938 = {ENUMLOOKUP_1671234938_ENTRIES, 0, 16, ENUMLOOKUP_1671234938_DENSE, 31, ENUMLOOKUP_1671234938_SEEDS, ENUMLOOKUP_1671234938_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1679608493_ENTRIES[] = {
+    {0, "Standalone"},
+    {1, "Primary"},
+    {2, "Secondary"},
+    {3, "Echo"},
+    {253, "Reserved"},
+    {254, "Out of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_1679608493_DENSE[] = {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 6};
+constexpr uint16_t ENUMLOOKUP_1679608493_SEEDS[] = {0, 0, 0, 0, 2, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1};
+constexpr int16_t ENUMLOOKUP_1679608493_SLOTS[] = {-1, -1, 0, 5, -1, -1, 2, 4, 3, -1, -1, -1, -1, 1, -1, 6};
+constexpr EnumTable ENUMLOOKUP_1679608493 = {ENUMLOOKUP_1679608493_ENTRIES, 0, 256, ENUMLOOKUP_1679608493_DENSE, 15, ENUMLOOKUP_1679608493_SEEDS, ENUMLOOKUP_1679608493_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_1687015300_ENTRIES[] = {
+    {0, "Invert"},
+    {1, "AC Passthru"},
+    {2, "APSOnly"},
+    {3, "Load Sense Active"},
+    {4, "Inverter Disabled"},
+    {5, "Load Sense Ready"},
+    {6, "Engaging Inverter"},
+    {7, "Invert Fault"},
+    {8, "Inverter Standby"},
+    {9, "Grid Tied"},
+    {10, "Grid Support"},
+    {11, "Gen Support"},
+    {12, "Sell To Grid"},
+    {13, "Load Shaving"},
+    {14, "Grid Frequency Stabilization"},
+    {15, "AC Coupling"},
+    {16, "Reverse Ibatt"},
+};
+constexpr int16_t ENUMLOOKUP_1687015300_DENSE[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+constexpr uint16_t ENUMLOOKUP_1687015300_SEEDS[] = {0, 1, 1, 0, 0, 1, 1, 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1};
+constexpr int16_t ENUMLOOKUP_1687015300_SLOTS[] = {16, -1, -1, 10, -1, 15, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, 11, 7, -1, -1, -1, -1, 12, -1, -1, 8, -1, 13, -1, -1, 4, -1, -1, -1, 3, -1, 0, -1, -1, 9, -1, -1, -1, -1, -1, 14, 1, -1, 6};
+constexpr EnumTable ENUMLOOKUP_1687015300 = {ENUMLOOKUP_1687015300_ENTRIES, 0, 17, ENUMLOOKUP_1687015300_DENSE, 63, ENUMLOOKUP_1687015300_SEEDS, ENUMLOOKUP_1687015300_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_2027188828_ENTRIES[] = {
+    {0, "Reboot"},
+    {1, "RebootDLMode"},
+    {2, "Factory"},
+    {3, "OEM"},
+    {4, "Clear Nv And Reboot"},
+    {252, "NoChange"},
+    {253, "Reserved"},
+    {254, "Out Of Range"},
+    {255, "Data Not Available Do Not Change"},
+};
+constexpr int16_t ENUMLOOKUP_2027188828_DENSE[] = {0, 1, 2, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 7, 8};
+constexpr uint16_t ENUMLOOKUP_2027188828_SEEDS[] = {2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr int16_t ENUMLOOKUP_2027188828_SLOTS[] = {-1, -1, 8, -1, -1, -1, -1, 6, 1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, 2, 0, -1, -1, 5, -1, 4, -1};
+constexpr EnumTable ENUMLOOKUP_2027188828 = {ENUMLOOKUP_2027188828_ENTRIES, 0, 256, ENUMLOOKUP_2027188828_DENSE, 31, ENUMLOOKUP_2027188828_SEEDS, ENUMLOOKUP_2027188828_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_2041349348_ENTRIES[] = {
+    {0, "Charger Not Derating"},
+    {1, "Charger Derating"},
+};
+constexpr int16_t ENUMLOOKUP_2041349348_DENSE[] = {0, 1};
+constexpr uint16_t ENUMLOOKUP_2041349348_SEEDS[] = {1, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_2041349348_SLOTS[] = {1, -1, -1, 0};
+constexpr EnumTable ENUMLOOKUP_2041349348 = {ENUMLOOKUP_2041349348_ENTRIES, 0, 2, ENUMLOOKUP_2041349348_DENSE, 3, ENUMLOOKUP_2041349348_SEEDS, ENUMLOOKUP_2041349348_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_2056474510_ENTRIES[] = {
+    {0, "Line 1"},
+    {1, "Line 2"},
+    {2, "Reserved"},
+    {3, "Undefined"},
+};
+constexpr int16_t ENUMLOOKUP_2056474510_DENSE[] = {0, 1, 2, 3};
+constexpr uint16_t ENUMLOOKUP_2056474510_SEEDS[] = {0, 0, 0, 1, 0, 0, 1, 1};
+constexpr int16_t ENUMLOOKUP_2056474510_SLOTS[] = {1, -1, -1, 0, -1, -1, 3, 2};
+constexpr EnumTable ENUMLOOKUP_2056474510 = {ENUMLOOKUP_2056474510_ENTRIES, 0, 4, ENUMLOOKUP_2056474510_DENSE, 7, ENUMLOOKUP_2056474510_SEEDS, ENUMLOOKUP_2056474510_SLOTS};
+
+constexpr EnumEntry ENUMLOOKUP_2110464705_ENTRIES[] = {
+    {0, "Active Low"},
+    {1, "Active High"},
+    {2, "Data Not Supported"},
+};
+constexpr int16_t ENUMLOOKUP_2110464705_DENSE[] = {0, 1, 2};
+constexpr uint16_t ENUMLOOKUP_2110464705_SEEDS[] = {1, 0, 0, 0, 1, 0, 1, 0};
+constexpr int16_t ENUMLOOKUP_2110464705_SLOTS[] = {-1, -1, -1, 0, 1, -1, 2, -1};
+constexpr EnumTable ENUMLOOKUP_2110464705 = {ENUMLOOKUP_2110464705_ENTRIES, 0, 3, ENUMLOOKUP_2110464705_DENSE, 7, ENUMLOOKUP_2110464705_SEEDS, ENUMLOOKUP_2110464705_SLOTS};
+
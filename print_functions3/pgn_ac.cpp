@@ -0,0 +1,641 @@
+// Auto-generated by generate_print_functions.py: ac message classes
+#include "print_functions3.h"
+
+// AcFltCtrlCfgCmd2
+std::string AcFltCtrlCfgCmd2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "HiFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucHiFreqLimit == 0xff) ? "No Data" : (msg.ucHiFreqLimit == 0xfe) ? "Out of range" : (msg.ucHiFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucLoFreqLimit == 0xff) ? "No Data" : (msg.ucLoFreqLimit == 0xfe) ? "Out of range" : (msg.ucLoFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void AcFltCtrlCfgCmd2::Print() const {
+        std::cout << "PGN: AcFltCtrlCfgCmd2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "HiFreqLimit      : " << fnGetValue("HiFreqLimit") << " (" << fnGetRawValue("HiFreqLimit") << ")" << endl;
+        cout << "LoFreqLimit      : " << fnGetValue("LoFreqLimit") << " (" << fnGetRawValue("LoFreqLimit") << ")" << endl;
+    }
+bool AcFltCtrlCfgCmd2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AcFltCtrlCfgCmd2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return static_cast<uint32_t>(msg.ucHiFreqLimit);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return static_cast<uint32_t>(msg.ucLoFreqLimit);
+        }
+        return UINT32_MAX;
+    }
+void AcFltCtrlCfgCmd2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiFreqLimit") {
+     msg.ucHiFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+     msg.ucLoFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void AcFltCtrlCfgCmd2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AcFltCtrlCfgCmd2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AcFltCtrlCfgCmd2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return 1.0 * (long double)(msg.ucHiFreqLimit + 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return 1.0 * (long double)(msg.ucLoFreqLimit + 0.0);
+        }
+        return 0.0;
+    }
+
+// AcFltCtrlCfgCmd1
+std::string AcFltCtrlCfgCmd1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "ExtremeLoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeLoV == 0xff) ? "No Data" : (msg.ucExtremeLoV == 0xfe) ? "Out of range" : (msg.ucExtremeLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucLoV == 0xff) ? "No Data" : (msg.ucLoV == 0xfe) ? "Out of range" : (msg.ucLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucHiV == 0xff) ? "No Data" : (msg.ucHiV == 0xfe) ? "Out of range" : (msg.ucHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtremeHiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeHiV == 0xff) ? "No Data" : (msg.ucExtremeHiV == 0xfe) ? "Out of range" : (msg.ucExtremeHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "QualTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucQualTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucQualTime == 0xff) ? "No Data" : (msg.ucQualTime == 0xfe) ? "Out of range" : (msg.ucQualTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BypassMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassMode));
+              }
+        }
+        else return "no pgn";
+    }
+void AcFltCtrlCfgCmd1::Print() const {
+        std::cout << "PGN: AcFltCtrlCfgCmd1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "ExtremeLoV      : " << fnGetValue("ExtremeLoV") << " (" << fnGetRawValue("ExtremeLoV") << ")" << endl;
+        cout << "LoV      : " << fnGetValue("LoV") << " (" << fnGetRawValue("LoV") << ")" << endl;
+        cout << "HiV      : " << fnGetValue("HiV") << " (" << fnGetRawValue("HiV") << ")" << endl;
+        cout << "ExtremeHiV      : " << fnGetValue("ExtremeHiV") << " (" << fnGetRawValue("ExtremeHiV") << ")" << endl;
+        cout << "QualTime      : " << fnGetValue("QualTime") << " (" << fnGetRawValue("QualTime") << ")" << endl;
+        cout << "BypassMode      : " << fnGetValue("BypassMode") << " (" << fnGetRawValue("BypassMode") << ")" << endl;
+    }
+bool AcFltCtrlCfgCmd1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AcFltCtrlCfgCmd1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return static_cast<uint32_t>(msg.ucExtremeLoV);
+        }
+        else if (mnem == "LoV") {
+            return static_cast<uint32_t>(msg.ucLoV);
+        }
+        else if (mnem == "HiV") {
+            return static_cast<uint32_t>(msg.ucHiV);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return static_cast<uint32_t>(msg.ucExtremeHiV);
+        }
+        else if (mnem == "QualTime") {
+            return static_cast<uint32_t>(msg.ucQualTime);
+        }
+        else if (mnem == "BypassMode") {
+            return static_cast<uint32_t>(msg.teBypassMode);
+        }
+        return UINT32_MAX;
+    }
+void AcFltCtrlCfgCmd1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ExtremeLoV") {
+     msg.ucExtremeLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoV") {
+     msg.ucLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "HiV") {
+     msg.ucHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+     msg.ucExtremeHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "QualTime") {
+     msg.ucQualTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "BypassMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(enumValue);
+     else msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void AcFltCtrlCfgCmd1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AcFltCtrlCfgCmd1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AcFltCtrlCfgCmd1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return 1.0 * (long double)(msg.ucExtremeLoV + 0.0);
+        }
+        else if (mnem == "LoV") {
+            return 1.0 * (long double)(msg.ucLoV + 0.0);
+        }
+        else if (mnem == "HiV") {
+            return 1.0 * (long double)(msg.ucHiV + 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return 1.0 * (long double)(msg.ucExtremeHiV + 0.0);
+        }
+        else if (mnem == "QualTime") {
+            return 1.0 * (long double)(msg.ucQualTime + 0.0);
+        }
+        else if (mnem == "BypassMode") {
+            return 1.0 * (long double)(msg.teBypassMode + 0.0);
+        }
+        return 0.0;
+    }
+
+// AcFltCtrlCfgSts2
+std::string AcFltCtrlCfgSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "HiFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucHiFreqLimit == 0xff) ? "No Data" : (msg.ucHiFreqLimit == 0xfe) ? "Out of range" : (msg.ucHiFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucLoFreqLimit == 0xff) ? "No Data" : (msg.ucLoFreqLimit == 0xfe) ? "Out of range" : (msg.ucLoFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void AcFltCtrlCfgSts2::Print() const {
+        std::cout << "PGN: AcFltCtrlCfgSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "HiFreqLimit      : " << fnGetValue("HiFreqLimit") << " (" << fnGetRawValue("HiFreqLimit") << ")" << endl;
+        cout << "LoFreqLimit      : " << fnGetValue("LoFreqLimit") << " (" << fnGetRawValue("LoFreqLimit") << ")" << endl;
+    }
+bool AcFltCtrlCfgSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AcFltCtrlCfgSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return static_cast<uint32_t>(msg.ucHiFreqLimit);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return static_cast<uint32_t>(msg.ucLoFreqLimit);
+        }
+        return UINT32_MAX;
+    }
+void AcFltCtrlCfgSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiFreqLimit") {
+     msg.ucHiFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+     msg.ucLoFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void AcFltCtrlCfgSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AcFltCtrlCfgSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AcFltCtrlCfgSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return 1.0 * (long double)(msg.ucHiFreqLimit + 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return 1.0 * (long double)(msg.ucLoFreqLimit + 0.0);
+        }
+        return 0.0;
+    }
+
+// AcFltCtrlCfgSts1
+std::string AcFltCtrlCfgSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "ExtremeLoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeLoV == 0xff) ? "No Data" : (msg.ucExtremeLoV == 0xfe) ? "Out of range" : (msg.ucExtremeLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucLoV == 0xff) ? "No Data" : (msg.ucLoV == 0xfe) ? "Out of range" : (msg.ucLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucHiV == 0xff) ? "No Data" : (msg.ucHiV == 0xfe) ? "Out of range" : (msg.ucHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtremeHiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeHiV == 0xff) ? "No Data" : (msg.ucExtremeHiV == 0xfe) ? "Out of range" : (msg.ucExtremeHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "QualTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucQualTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucQualTime == 0xff) ? "No Data" : (msg.ucQualTime == 0xfe) ? "Out of range" : (msg.ucQualTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BypassMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassMode));
+              }
+        }
+        else return "no pgn";
+    }
+void AcFltCtrlCfgSts1::Print() const {
+        std::cout << "PGN: AcFltCtrlCfgSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "ExtremeLoV      : " << fnGetValue("ExtremeLoV") << " (" << fnGetRawValue("ExtremeLoV") << ")" << endl;
+        cout << "LoV      : " << fnGetValue("LoV") << " (" << fnGetRawValue("LoV") << ")" << endl;
+        cout << "HiV      : " << fnGetValue("HiV") << " (" << fnGetRawValue("HiV") << ")" << endl;
+        cout << "ExtremeHiV      : " << fnGetValue("ExtremeHiV") << " (" << fnGetRawValue("ExtremeHiV") << ")" << endl;
+        cout << "QualTime      : " << fnGetValue("QualTime") << " (" << fnGetRawValue("QualTime") << ")" << endl;
+        cout << "BypassMode      : " << fnGetValue("BypassMode") << " (" << fnGetRawValue("BypassMode") << ")" << endl;
+    }
+bool AcFltCtrlCfgSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AcFltCtrlCfgSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return static_cast<uint32_t>(msg.ucExtremeLoV);
+        }
+        else if (mnem == "LoV") {
+            return static_cast<uint32_t>(msg.ucLoV);
+        }
+        else if (mnem == "HiV") {
+            return static_cast<uint32_t>(msg.ucHiV);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return static_cast<uint32_t>(msg.ucExtremeHiV);
+        }
+        else if (mnem == "QualTime") {
+            return static_cast<uint32_t>(msg.ucQualTime);
+        }
+        else if (mnem == "BypassMode") {
+            return static_cast<uint32_t>(msg.teBypassMode);
+        }
+        return UINT32_MAX;
+    }
+void AcFltCtrlCfgSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ExtremeLoV") {
+     msg.ucExtremeLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoV") {
+     msg.ucLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "HiV") {
+     msg.ucHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+     msg.ucExtremeHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "QualTime") {
+     msg.ucQualTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "BypassMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(enumValue);
+     else msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void AcFltCtrlCfgSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AcFltCtrlCfgSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AcFltCtrlCfgSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return 1.0 * (long double)(msg.ucExtremeLoV + 0.0);
+        }
+        else if (mnem == "LoV") {
+            return 1.0 * (long double)(msg.ucLoV + 0.0);
+        }
+        else if (mnem == "HiV") {
+            return 1.0 * (long double)(msg.ucHiV + 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return 1.0 * (long double)(msg.ucExtremeHiV + 0.0);
+        }
+        else if (mnem == "QualTime") {
+            return 1.0 * (long double)(msg.ucQualTime + 0.0);
+        }
+        else if (mnem == "BypassMode") {
+            return 1.0 * (long double)(msg.teBypassMode + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_ac_registrars[] = {
+{"AcFltCtrlCfgCmd2", [](void * rcv) { return std::make_unique<AcFltCtrlCfgCmd2>(rcv); }, []() { return std::make_unique<AcFltCtrlCfgCmd2>(); } },
+{"AcFltCtrlCfgCmd1", [](void * rcv) { return std::make_unique<AcFltCtrlCfgCmd1>(rcv); }, []() { return std::make_unique<AcFltCtrlCfgCmd1>(); } },
+{"AcFltCtrlCfgSts2", [](void * rcv) { return std::make_unique<AcFltCtrlCfgSts2>(rcv); }, []() { return std::make_unique<AcFltCtrlCfgSts2>(); } },
+{"AcFltCtrlCfgSts1", [](void * rcv) { return std::make_unique<AcFltCtrlCfgSts1>(rcv); }, []() { return std::make_unique<AcFltCtrlCfgSts1>(); } },
+};
+static const PrinterRegistrar pgn_ac_printers[] = {
+{130996, -1, fnPrintMessage<AcFltCtrlCfgCmd2>},
+{130997, -1, fnPrintMessage<AcFltCtrlCfgCmd1>},
+{130998, -1, fnPrintMessage<AcFltCtrlCfgSts2>},
+{130999, -1, fnPrintMessage<AcFltCtrlCfgSts1>},
+};
@@ -0,0 +1,1556 @@
+// Auto-generated by generate_print_functions.py: ags message classes
+#include "print_functions3.h"
+
+// AgsCritCmdXferAcV
+std::string AgsCritCmdXferAcV::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teCmd));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "AcInst") {
+            return (msg.ucAcInst == 0xff) ? "No Data" : (msg.ucAcInst == 0xfe) ? "Out of range" : (msg.ucAcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucAcInst);
+        }
+        else if (mnem == "AcVThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiAcVThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiAcVThresh == 0xffff) ? "No Data" : (msg.uiAcVThresh == 0xfffe) ? "Out of range" : (msg.uiAcVThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritCmdXferAcV::Print() const {
+        std::cout << "PGN: AgsCritCmdXferAcV" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "AcInst      : " << fnGetValue("AcInst") << " (" << fnGetRawValue("AcInst") << ")" << endl;
+        cout << "AcVThresh      : " << fnGetValue("AcVThresh") << " (" << fnGetRawValue("AcVThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritCmdXferAcV::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritCmdXferAcV::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "AcInst") {
+            return static_cast<uint32_t>(msg.ucAcInst);
+        }
+        else if (mnem == "AcVThresh") {
+            return static_cast<uint32_t>(msg.uiAcVThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritCmdXferAcV::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcInst") {
+     msg.ucAcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AcVThresh") {
+     msg.uiAcVThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritCmdXferAcV::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritCmdXferAcV::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritCmdXferAcV::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "AcInst") {
+            return 1.0 * (long double)(msg.ucAcInst + 0.0);
+        }
+        else if (mnem == "AcVThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiAcVThresh + 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritCmdDcSoc
+std::string AgsCritCmdDcSoc::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teCmd));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "DcInst") {
+            return (msg.ucDcInst == 0xff) ? "No Data" : (msg.ucDcInst == 0xfe) ? "Out of range" : (msg.ucDcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcInst);
+        }
+        else if (mnem == "DcSocThresh") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucDcSocThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucDcSocThresh == 0xff) ? "No Data" : (msg.ucDcSocThresh == 0xfe) ? "Out of range" : (msg.ucDcSocThresh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritCmdDcSoc::Print() const {
+        std::cout << "PGN: AgsCritCmdDcSoc" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcSocThresh      : " << fnGetValue("DcSocThresh") << " (" << fnGetRawValue("DcSocThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritCmdDcSoc::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritCmdDcSoc::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.ucDcInst);
+        }
+        else if (mnem == "DcSocThresh") {
+            return static_cast<uint32_t>(msg.ucDcSocThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritCmdDcSoc::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     msg.ucDcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSocThresh") {
+     msg.ucDcSocThresh = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritCmdDcSoc::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritCmdDcSoc::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritCmdDcSoc::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.ucDcInst + 0.0);
+        }
+        else if (mnem == "DcSocThresh") {
+            return 0.5 * (long double)(msg.ucDcSocThresh + 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritCmdDcV
+std::string AgsCritCmdDcV::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teCmd));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "DcInst") {
+            return (msg.ucDcInst == 0xff) ? "No Data" : (msg.ucDcInst == 0xfe) ? "Out of range" : (msg.ucDcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcInst);
+        }
+        else if (mnem == "DcVThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcVThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcVThresh == 0xffff) ? "No Data" : (msg.uiDcVThresh == 0xfffe) ? "Out of range" : (msg.uiDcVThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritCmdDcV::Print() const {
+        std::cout << "PGN: AgsCritCmdDcV" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcVThresh      : " << fnGetValue("DcVThresh") << " (" << fnGetRawValue("DcVThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritCmdDcV::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritCmdDcV::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.ucDcInst);
+        }
+        else if (mnem == "DcVThresh") {
+            return static_cast<uint32_t>(msg.uiDcVThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritCmdDcV::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     msg.ucDcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcVThresh") {
+     msg.uiDcVThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritCmdDcV::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritCmdDcV::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritCmdDcV::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.ucDcInst + 0.0);
+        }
+        else if (mnem == "DcVThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiDcVThresh + 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritCmdAmbTemp
+std::string AgsCritCmdAmbTemp::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teCmd));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "ThermAmbInst") {
+            return (msg.ucThermAmbInst == 0xff) ? "No Data" : (msg.ucThermAmbInst == 0xfe) ? "Out of range" : (msg.ucThermAmbInst == 0xfd) ? "Reserved" : std::to_string(msg.ucThermAmbInst);
+        }
+        else if (mnem == "AmbTempThresh") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiAmbTempThresh + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiAmbTempThresh == 0xffff) ? "No Data" : (msg.uiAmbTempThresh == 0xfffe) ? "Out of range" : (msg.uiAmbTempThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritCmdAmbTemp::Print() const {
+        std::cout << "PGN: AgsCritCmdAmbTemp" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "ThermAmbInst      : " << fnGetValue("ThermAmbInst") << " (" << fnGetRawValue("ThermAmbInst") << ")" << endl;
+        cout << "AmbTempThresh      : " << fnGetValue("AmbTempThresh") << " (" << fnGetRawValue("AmbTempThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritCmdAmbTemp::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritCmdAmbTemp::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "ThermAmbInst") {
+            return static_cast<uint32_t>(msg.ucThermAmbInst);
+        }
+        else if (mnem == "AmbTempThresh") {
+            return static_cast<uint32_t>(msg.uiAmbTempThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritCmdAmbTemp::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ThermAmbInst") {
+     msg.ucThermAmbInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AmbTempThresh") {
+     msg.uiAmbTempThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritCmdAmbTemp::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritCmdAmbTemp::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritCmdAmbTemp::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "ThermAmbInst") {
+            return 1.0 * (long double)(msg.ucThermAmbInst + 0.0);
+        }
+        else if (mnem == "AmbTempThresh") {
+            return 0.03125 * (long double)(msg.uiAmbTempThresh + -8736.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritCmdDcI
+std::string AgsCritCmdDcI::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teCmd));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "DcInst") {
+            return (msg.ucDcInst == 0xff) ? "No Data" : (msg.ucDcInst == 0xfe) ? "Out of range" : (msg.ucDcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcInst);
+        }
+        else if (mnem == "DcIThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcIThresh + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiDcIThresh == 0xffff) ? "No Data" : (msg.uiDcIThresh == 0xfffe) ? "Out of range" : (msg.uiDcIThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeOverThresh") {
+            return (msg.ucTimeOverThresh == 0xff) ? "No Data" : (msg.ucTimeOverThresh == 0xfe) ? "Out of range" : (msg.ucTimeOverThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeOverThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritCmdDcI::Print() const {
+        std::cout << "PGN: AgsCritCmdDcI" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcIThresh      : " << fnGetValue("DcIThresh") << " (" << fnGetRawValue("DcIThresh") << ")" << endl;
+        cout << "TimeOverThresh      : " << fnGetValue("TimeOverThresh") << " (" << fnGetRawValue("TimeOverThresh") << ")" << endl;
+    }
+bool AgsCritCmdDcI::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritCmdDcI::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.ucDcInst);
+        }
+        else if (mnem == "DcIThresh") {
+            return static_cast<uint32_t>(msg.uiDcIThresh);
+        }
+        else if (mnem == "TimeOverThresh") {
+            return static_cast<uint32_t>(msg.ucTimeOverThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritCmdDcI::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     msg.ucDcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcIThresh") {
+     msg.uiDcIThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "TimeOverThresh") {
+     msg.ucTimeOverThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritCmdDcI::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritCmdDcI::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritCmdDcI::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.ucDcInst + 0.0);
+        }
+        else if (mnem == "DcIThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiDcIThresh + -32000.0);
+        }
+        else if (mnem == "TimeOverThresh") {
+            return 1.0 * (long double)(msg.ucTimeOverThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritStsAmbTemp
+std::string AgsCritStsAmbTemp::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teCurrDemandSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCurrDemandSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teCurrDemandSts));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "ThermAmbInst") {
+            return (msg.ucThermAmbInst == 0xff) ? "No Data" : (msg.ucThermAmbInst == 0xfe) ? "Out of range" : (msg.ucThermAmbInst == 0xfd) ? "Reserved" : std::to_string(msg.ucThermAmbInst);
+        }
+        else if (mnem == "AmbTempThresh") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiAmbTempThresh + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiAmbTempThresh == 0xffff) ? "No Data" : (msg.uiAmbTempThresh == 0xfffe) ? "Out of range" : (msg.uiAmbTempThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritStsAmbTemp::Print() const {
+        std::cout << "PGN: AgsCritStsAmbTemp" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "CurrDemandSts      : " << fnGetValue("CurrDemandSts") << " (" << fnGetRawValue("CurrDemandSts") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "ThermAmbInst      : " << fnGetValue("ThermAmbInst") << " (" << fnGetRawValue("ThermAmbInst") << ")" << endl;
+        cout << "AmbTempThresh      : " << fnGetValue("AmbTempThresh") << " (" << fnGetRawValue("AmbTempThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritStsAmbTemp::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritStsAmbTemp::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return static_cast<uint32_t>(msg.teCurrDemandSts);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "ThermAmbInst") {
+            return static_cast<uint32_t>(msg.ucThermAmbInst);
+        }
+        else if (mnem == "AmbTempThresh") {
+            return static_cast<uint32_t>(msg.uiAmbTempThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritStsAmbTemp::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "CurrDemandSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(enumValue);
+     else msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ThermAmbInst") {
+     msg.ucThermAmbInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AmbTempThresh") {
+     msg.uiAmbTempThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritStsAmbTemp::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritStsAmbTemp::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritStsAmbTemp::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return 1.0 * (long double)(msg.teCurrDemandSts + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "ThermAmbInst") {
+            return 1.0 * (long double)(msg.ucThermAmbInst + 0.0);
+        }
+        else if (mnem == "AmbTempThresh") {
+            return 0.03125 * (long double)(msg.uiAmbTempThresh + -8736.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritStsDcV
+std::string AgsCritStsDcV::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teCurrDemandSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCurrDemandSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teCurrDemandSts));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "DcInst") {
+            return (msg.ucDcInst == 0xff) ? "No Data" : (msg.ucDcInst == 0xfe) ? "Out of range" : (msg.ucDcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcInst);
+        }
+        else if (mnem == "DcVThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcVThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcVThresh == 0xffff) ? "No Data" : (msg.uiDcVThresh == 0xfffe) ? "Out of range" : (msg.uiDcVThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritStsDcV::Print() const {
+        std::cout << "PGN: AgsCritStsDcV" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "CurrDemandSts      : " << fnGetValue("CurrDemandSts") << " (" << fnGetRawValue("CurrDemandSts") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcVThresh      : " << fnGetValue("DcVThresh") << " (" << fnGetRawValue("DcVThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritStsDcV::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritStsDcV::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return static_cast<uint32_t>(msg.teCurrDemandSts);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.ucDcInst);
+        }
+        else if (mnem == "DcVThresh") {
+            return static_cast<uint32_t>(msg.uiDcVThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritStsDcV::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "CurrDemandSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(enumValue);
+     else msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     msg.ucDcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcVThresh") {
+     msg.uiDcVThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritStsDcV::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritStsDcV::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritStsDcV::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return 1.0 * (long double)(msg.teCurrDemandSts + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.ucDcInst + 0.0);
+        }
+        else if (mnem == "DcVThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiDcVThresh + 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritStsDcSoc
+std::string AgsCritStsDcSoc::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teCurrDemandSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCurrDemandSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teCurrDemandSts));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "DcInst") {
+            return (msg.ucDcInst == 0xff) ? "No Data" : (msg.ucDcInst == 0xfe) ? "Out of range" : (msg.ucDcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcInst);
+        }
+        else if (mnem == "DcSocThresh") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucDcSocThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucDcSocThresh == 0xff) ? "No Data" : (msg.ucDcSocThresh == 0xfe) ? "Out of range" : (msg.ucDcSocThresh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritStsDcSoc::Print() const {
+        std::cout << "PGN: AgsCritStsDcSoc" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "CurrDemandSts      : " << fnGetValue("CurrDemandSts") << " (" << fnGetRawValue("CurrDemandSts") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcSocThresh      : " << fnGetValue("DcSocThresh") << " (" << fnGetRawValue("DcSocThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritStsDcSoc::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritStsDcSoc::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return static_cast<uint32_t>(msg.teCurrDemandSts);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.ucDcInst);
+        }
+        else if (mnem == "DcSocThresh") {
+            return static_cast<uint32_t>(msg.ucDcSocThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritStsDcSoc::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "CurrDemandSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(enumValue);
+     else msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     msg.ucDcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSocThresh") {
+     msg.ucDcSocThresh = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritStsDcSoc::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritStsDcSoc::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritStsDcSoc::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return 1.0 * (long double)(msg.teCurrDemandSts + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.ucDcInst + 0.0);
+        }
+        else if (mnem == "DcSocThresh") {
+            return 0.5 * (long double)(msg.ucDcSocThresh + 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritStsDcI
+std::string AgsCritStsDcI::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teCurrDemandSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCurrDemandSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teCurrDemandSts));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "DcInst") {
+            return (msg.ucDcInst == 0xff) ? "No Data" : (msg.ucDcInst == 0xfe) ? "Out of range" : (msg.ucDcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcInst);
+        }
+        else if (mnem == "DcIThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcIThresh + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiDcIThresh == 0xffff) ? "No Data" : (msg.uiDcIThresh == 0xfffe) ? "Out of range" : (msg.uiDcIThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeOverThresh") {
+            return (msg.ucTimeOverThresh == 0xff) ? "No Data" : (msg.ucTimeOverThresh == 0xfe) ? "Out of range" : (msg.ucTimeOverThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeOverThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritStsDcI::Print() const {
+        std::cout << "PGN: AgsCritStsDcI" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "CurrDemandSts      : " << fnGetValue("CurrDemandSts") << " (" << fnGetRawValue("CurrDemandSts") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcIThresh      : " << fnGetValue("DcIThresh") << " (" << fnGetRawValue("DcIThresh") << ")" << endl;
+        cout << "TimeOverThresh      : " << fnGetValue("TimeOverThresh") << " (" << fnGetRawValue("TimeOverThresh") << ")" << endl;
+    }
+bool AgsCritStsDcI::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritStsDcI::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return static_cast<uint32_t>(msg.teCurrDemandSts);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.ucDcInst);
+        }
+        else if (mnem == "DcIThresh") {
+            return static_cast<uint32_t>(msg.uiDcIThresh);
+        }
+        else if (mnem == "TimeOverThresh") {
+            return static_cast<uint32_t>(msg.ucTimeOverThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritStsDcI::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "CurrDemandSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(enumValue);
+     else msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     msg.ucDcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcIThresh") {
+     msg.uiDcIThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "TimeOverThresh") {
+     msg.ucTimeOverThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritStsDcI::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritStsDcI::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritStsDcI::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return 1.0 * (long double)(msg.teCurrDemandSts + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.ucDcInst + 0.0);
+        }
+        else if (mnem == "DcIThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiDcIThresh + -32000.0);
+        }
+        else if (mnem == "TimeOverThresh") {
+            return 1.0 * (long double)(msg.ucTimeOverThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// AgsCritStsXferAcV
+std::string AgsCritStsXferAcV::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teCurrDemandSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCurrDemandSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teCurrDemandSts));
+              }
+        }
+        else if (mnem == "ActSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teActSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teActSts));
+              }
+        }
+        else if (mnem == "CritType") {
+            if (!ENUMLOOKUP_9422.fnContains(msg.teCritType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCritType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9422.fnText(msg.teCritType));
+              }
+        }
+        else if (mnem == "AcInst") {
+            return (msg.ucAcInst == 0xff) ? "No Data" : (msg.ucAcInst == 0xfe) ? "Out of range" : (msg.ucAcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucAcInst);
+        }
+        else if (mnem == "AcVThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiAcVThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiAcVThresh == 0xffff) ? "No Data" : (msg.uiAcVThresh == 0xfffe) ? "Out of range" : (msg.uiAcVThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return (msg.ucTimeUnderThresh == 0xff) ? "No Data" : (msg.ucTimeUnderThresh == 0xfe) ? "Out of range" : (msg.ucTimeUnderThresh == 0xfd) ? "Reserved" : std::to_string(msg.ucTimeUnderThresh);
+        }
+        else return "no pgn";
+    }
+void AgsCritStsXferAcV::Print() const {
+        std::cout << "PGN: AgsCritStsXferAcV" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "CurrDemandSts      : " << fnGetValue("CurrDemandSts") << " (" << fnGetRawValue("CurrDemandSts") << ")" << endl;
+        cout << "ActSts      : " << fnGetValue("ActSts") << " (" << fnGetRawValue("ActSts") << ")" << endl;
+        cout << "CritType      : " << fnGetValue("CritType") << " (" << fnGetRawValue("CritType") << ")" << endl;
+        cout << "AcInst      : " << fnGetValue("AcInst") << " (" << fnGetRawValue("AcInst") << ")" << endl;
+        cout << "AcVThresh      : " << fnGetValue("AcVThresh") << " (" << fnGetRawValue("AcVThresh") << ")" << endl;
+        cout << "TimeUnderThresh      : " << fnGetValue("TimeUnderThresh") << " (" << fnGetRawValue("TimeUnderThresh") << ")" << endl;
+    }
+bool AgsCritStsXferAcV::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AgsCritStsXferAcV::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return static_cast<uint32_t>(msg.teCurrDemandSts);
+        }
+        else if (mnem == "ActSts") {
+            return static_cast<uint32_t>(msg.teActSts);
+        }
+        else if (mnem == "CritType") {
+            return static_cast<uint32_t>(msg.teCritType);
+        }
+        else if (mnem == "AcInst") {
+            return static_cast<uint32_t>(msg.ucAcInst);
+        }
+        else if (mnem == "AcVThresh") {
+            return static_cast<uint32_t>(msg.uiAcVThresh);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return static_cast<uint32_t>(msg.ucTimeUnderThresh);
+        }
+        return UINT32_MAX;
+    }
+void AgsCritStsXferAcV::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "CurrDemandSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(enumValue);
+     else msg.teCurrDemandSts = static_cast<decltype(msg.teCurrDemandSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teActSts = static_cast<decltype(msg.teActSts)>(enumValue);
+     else msg.teActSts = static_cast<decltype(msg.teActSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CritType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9422, value);
+     if (enumValue != -1) msg.teCritType = static_cast<decltype(msg.teCritType)>(enumValue);
+     else msg.teCritType = static_cast<decltype(msg.teCritType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcInst") {
+     msg.ucAcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AcVThresh") {
+     msg.uiAcVThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+     msg.ucTimeUnderThresh = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void AgsCritStsXferAcV::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AgsCritStsXferAcV::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AgsCritStsXferAcV::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "CurrDemandSts") {
+            return 1.0 * (long double)(msg.teCurrDemandSts + 0.0);
+        }
+        else if (mnem == "ActSts") {
+            return 1.0 * (long double)(msg.teActSts + 0.0);
+        }
+        else if (mnem == "CritType") {
+            return 1.0 * (long double)(msg.teCritType + 0.0);
+        }
+        else if (mnem == "AcInst") {
+            return 1.0 * (long double)(msg.ucAcInst + 0.0);
+        }
+        else if (mnem == "AcVThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiAcVThresh + 0.0);
+        }
+        else if (mnem == "TimeUnderThresh") {
+            return 1.0 * (long double)(msg.ucTimeUnderThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_ags_registrars[] = {
+{"AGSCritCmdDcSoc", [](void * rcv) { return std::make_unique<AgsCritCmdDcSoc>(rcv); }, []() { return std::make_unique<AgsCritCmdDcSoc>(); } },
+{"AGSCritCmdDcV", [](void * rcv) { return std::make_unique<AgsCritCmdDcV>(rcv); }, []() { return std::make_unique<AgsCritCmdDcV>(); } },
+{"AGSCritCmdAmbTemp", [](void * rcv) { return std::make_unique<AgsCritCmdAmbTemp>(rcv); }, []() { return std::make_unique<AgsCritCmdAmbTemp>(); } },
+{"AGSCritCmdDcI", [](void * rcv) { return std::make_unique<AgsCritCmdDcI>(rcv); }, []() { return std::make_unique<AgsCritCmdDcI>(); } },
+{"AGSCritStsAmbTemp", [](void * rcv) { return std::make_unique<AgsCritStsAmbTemp>(rcv); }, []() { return std::make_unique<AgsCritStsAmbTemp>(); } },
+{"AGSCritStsDcV", [](void * rcv) { return std::make_unique<AgsCritStsDcV>(rcv); }, []() { return std::make_unique<AgsCritStsDcV>(); } },
+{"AGSCritStsDcSoc", [](void * rcv) { return std::make_unique<AgsCritStsDcSoc>(rcv); }, []() { return std::make_unique<AgsCritStsDcSoc>(); } },
+{"AGSCritStsDcI", [](void * rcv) { return std::make_unique<AgsCritStsDcI>(rcv); }, []() { return std::make_unique<AgsCritStsDcI>(); } },
+{"AGSCritStsXferAcV", [](void * rcv) { return std::make_unique<AgsCritStsXferAcV>(rcv); }, []() { return std::make_unique<AgsCritStsXferAcV>(); } },
+};
+static const PrinterRegistrar pgn_ags_printers[] = {
+{131007, 4, fnPrintMessage<AgsCritCmdXferAcV>},
+{131007, 3, fnPrintMessage<AgsCritCmdDcSoc>},
+{131007, 2, fnPrintMessage<AgsCritCmdDcV>},
+{131007, 1, fnPrintMessage<AgsCritCmdAmbTemp>},
+{131007, -1, fnPrintMessage<AgsCritCmdDcI>},
+{131008, 5, fnPrintMessage<AgsCritStsAmbTemp>},
+{131008, 4, fnPrintMessage<AgsCritStsDcV>},
+{131008, 1, fnPrintMessage<AgsCritStsDcSoc>},
+{131008, 3, fnPrintMessage<AgsCritStsDcI>},
+{131008, 2, fnPrintMessage<AgsCritStsXferAcV>},
+};
@@ -0,0 +1,1405 @@
+// Auto-generated by generate_print_functions.py: batt message classes
+#include "print_functions3.h"
+
+// BattSumm
+std::string BattSumm::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "SeriesString") {
+            return (msg.ucSeriesString == 0xff) ? "No Data" : (msg.ucSeriesString == 0xfe) ? "Out of range" : (msg.ucSeriesString == 0xfd) ? "Reserved" : std::to_string(msg.ucSeriesString);
+        }
+        else if (mnem == "ModuleCnt") {
+            if (!ENUMLOOKUP_1653075463.fnContains(msg.teModuleCnt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teModuleCnt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1653075463.fnText(msg.teModuleCnt));
+              }
+        }
+        else if (mnem == "CellsPerModule") {
+            return (msg.ucCellsPerModule == 0xff) ? "No Data" : (msg.ucCellsPerModule == 0xfe) ? "Out of range" : (msg.ucCellsPerModule == 0xfd) ? "Reserved" : std::to_string(msg.ucCellsPerModule);
+        }
+        else if (mnem == "VoltSts") {
+            if (!ENUMLOOKUP_N1891506457.fnContains(msg.teVoltSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teVoltSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N1891506457.fnText(msg.teVoltSts));
+              }
+        }
+        else if (mnem == "TempSts") {
+            if (!ENUMLOOKUP_N624353124.fnContains(msg.teTempSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTempSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N624353124.fnText(msg.teTempSts));
+              }
+        }
+        else return "no pgn";
+    }
+void BattSumm::Print() const {
+        std::cout << "PGN: BattSumm" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "SeriesString      : " << fnGetValue("SeriesString") << " (" << fnGetRawValue("SeriesString") << ")" << endl;
+        cout << "ModuleCnt      : " << fnGetValue("ModuleCnt") << " (" << fnGetRawValue("ModuleCnt") << ")" << endl;
+        cout << "CellsPerModule      : " << fnGetValue("CellsPerModule") << " (" << fnGetRawValue("CellsPerModule") << ")" << endl;
+        cout << "VoltSts      : " << fnGetValue("VoltSts") << " (" << fnGetRawValue("VoltSts") << ")" << endl;
+        cout << "TempSts      : " << fnGetValue("TempSts") << " (" << fnGetRawValue("TempSts") << ")" << endl;
+    }
+bool BattSumm::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSumm::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "SeriesString") {
+            return static_cast<uint32_t>(msg.ucSeriesString);
+        }
+        else if (mnem == "ModuleCnt") {
+            return static_cast<uint32_t>(msg.teModuleCnt);
+        }
+        else if (mnem == "CellsPerModule") {
+            return static_cast<uint32_t>(msg.ucCellsPerModule);
+        }
+        else if (mnem == "VoltSts") {
+            return static_cast<uint32_t>(msg.teVoltSts);
+        }
+        else if (mnem == "TempSts") {
+            return static_cast<uint32_t>(msg.teTempSts);
+        }
+        return UINT32_MAX;
+    }
+void BattSumm::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SeriesString") {
+     msg.ucSeriesString = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ModuleCnt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1653075463, value);
+     if (enumValue != -1) msg.teModuleCnt = static_cast<decltype(msg.teModuleCnt)>(enumValue);
+     else msg.teModuleCnt = static_cast<decltype(msg.teModuleCnt)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CellsPerModule") {
+     msg.ucCellsPerModule = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "VoltSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N1891506457, value);
+     if (enumValue != -1) msg.teVoltSts = static_cast<decltype(msg.teVoltSts)>(enumValue);
+     else msg.teVoltSts = static_cast<decltype(msg.teVoltSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TempSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N624353124, value);
+     if (enumValue != -1) msg.teTempSts = static_cast<decltype(msg.teTempSts)>(enumValue);
+     else msg.teTempSts = static_cast<decltype(msg.teTempSts)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void BattSumm::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSumm::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSumm::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "SeriesString") {
+            return 1.0 * (long double)(msg.ucSeriesString + 0.0);
+        }
+        else if (mnem == "ModuleCnt") {
+            return 1.0 * (long double)(msg.teModuleCnt + 0.0);
+        }
+        else if (mnem == "CellsPerModule") {
+            return 1.0 * (long double)(msg.ucCellsPerModule + 0.0);
+        }
+        else if (mnem == "VoltSts") {
+            return 1.0 * (long double)(msg.teVoltSts + 0.0);
+        }
+        else if (mnem == "TempSts") {
+            return 1.0 * (long double)(msg.teTempSts + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattCmd
+std::string BattCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DesiredLoadOnOffSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teDesiredLoadOnOffSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDesiredLoadOnOffSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teDesiredLoadOnOffSts));
+              }
+        }
+        else if (mnem == "DesiredChgOnOffSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teDesiredChgOnOffSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDesiredChgOnOffSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teDesiredChgOnOffSts));
+              }
+        }
+        else if (mnem == "ClrHistory") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teClrHistory)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teClrHistory);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teClrHistory));
+              }
+        }
+        else if (mnem == "RtnModuleCellDetail") {
+            return (msg.ucRtnModuleCellDetail == 0xff) ? "No Data" : (msg.ucRtnModuleCellDetail == 0xfe) ? "Out of range" : (msg.ucRtnModuleCellDetail == 0xfd) ? "Reserved" : std::to_string(msg.ucRtnModuleCellDetail);
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else return "no pgn";
+    }
+void BattCmd::Print() const {
+        std::cout << "PGN: BattCmd" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DesiredLoadOnOffSts      : " << fnGetValue("DesiredLoadOnOffSts") << " (" << fnGetRawValue("DesiredLoadOnOffSts") << ")" << endl;
+        cout << "DesiredChgOnOffSts      : " << fnGetValue("DesiredChgOnOffSts") << " (" << fnGetRawValue("DesiredChgOnOffSts") << ")" << endl;
+        cout << "ClrHistory      : " << fnGetValue("ClrHistory") << " (" << fnGetRawValue("ClrHistory") << ")" << endl;
+        cout << "RtnModuleCellDetail      : " << fnGetValue("RtnModuleCellDetail") << " (" << fnGetRawValue("RtnModuleCellDetail") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+    }
+bool BattCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DesiredLoadOnOffSts") {
+            return static_cast<uint32_t>(msg.teDesiredLoadOnOffSts);
+        }
+        else if (mnem == "DesiredChgOnOffSts") {
+            return static_cast<uint32_t>(msg.teDesiredChgOnOffSts);
+        }
+        else if (mnem == "ClrHistory") {
+            return static_cast<uint32_t>(msg.teClrHistory);
+        }
+        else if (mnem == "RtnModuleCellDetail") {
+            return static_cast<uint32_t>(msg.ucRtnModuleCellDetail);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        return UINT32_MAX;
+    }
+void BattCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DesiredLoadOnOffSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teDesiredLoadOnOffSts = static_cast<decltype(msg.teDesiredLoadOnOffSts)>(enumValue);
+     else msg.teDesiredLoadOnOffSts = static_cast<decltype(msg.teDesiredLoadOnOffSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DesiredChgOnOffSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teDesiredChgOnOffSts = static_cast<decltype(msg.teDesiredChgOnOffSts)>(enumValue);
+     else msg.teDesiredChgOnOffSts = static_cast<decltype(msg.teDesiredChgOnOffSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ClrHistory") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teClrHistory = static_cast<decltype(msg.teClrHistory)>(enumValue);
+     else msg.teClrHistory = static_cast<decltype(msg.teClrHistory)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RtnModuleCellDetail") {
+     msg.ucRtnModuleCellDetail = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void BattCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DesiredLoadOnOffSts") {
+            return 1.0 * (long double)(msg.teDesiredLoadOnOffSts + 0.0);
+        }
+        else if (mnem == "DesiredChgOnOffSts") {
+            return 1.0 * (long double)(msg.teDesiredChgOnOffSts + 0.0);
+        }
+        else if (mnem == "ClrHistory") {
+            return 1.0 * (long double)(msg.teClrHistory + 0.0);
+        }
+        else if (mnem == "RtnModuleCellDetail") {
+            return 1.0 * (long double)(msg.ucRtnModuleCellDetail + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattSts11
+std::string BattSts11::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "DischgOnOffSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teDischgOnOffSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDischgOnOffSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teDischgOnOffSts));
+              }
+        }
+        else if (mnem == "ChgOnOffSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teChgOnOffSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgOnOffSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teChgOnOffSts));
+              }
+        }
+        else if (mnem == "ChgDetect") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teChgDetect)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgDetect);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teChgDetect));
+              }
+        }
+        else if (mnem == "ReservSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teReservSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teReservSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teReservSts));
+              }
+        }
+        else if (mnem == "NomFullCap") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiNomFullCap + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiNomFullCap == 0xffff) ? "No Data" : (msg.uiNomFullCap == 0xfffe) ? "Out of range" : (msg.uiNomFullCap == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcPwr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiDcPwr + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiDcPwr == 0xffff) ? "No Data" : (msg.uiDcPwr == 0xfffe) ? "Out of range" : (msg.uiDcPwr == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void BattSts11::Print() const {
+        std::cout << "PGN: BattSts11" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DischgOnOffSts      : " << fnGetValue("DischgOnOffSts") << " (" << fnGetRawValue("DischgOnOffSts") << ")" << endl;
+        cout << "ChgOnOffSts      : " << fnGetValue("ChgOnOffSts") << " (" << fnGetRawValue("ChgOnOffSts") << ")" << endl;
+        cout << "ChgDetect      : " << fnGetValue("ChgDetect") << " (" << fnGetRawValue("ChgDetect") << ")" << endl;
+        cout << "ReservSts      : " << fnGetValue("ReservSts") << " (" << fnGetRawValue("ReservSts") << ")" << endl;
+        cout << "NomFullCap      : " << fnGetValue("NomFullCap") << " (" << fnGetRawValue("NomFullCap") << ")" << endl;
+        cout << "DcPwr      : " << fnGetValue("DcPwr") << " (" << fnGetRawValue("DcPwr") << ")" << endl;
+    }
+bool BattSts11::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSts11::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "DischgOnOffSts") {
+            return static_cast<uint32_t>(msg.teDischgOnOffSts);
+        }
+        else if (mnem == "ChgOnOffSts") {
+            return static_cast<uint32_t>(msg.teChgOnOffSts);
+        }
+        else if (mnem == "ChgDetect") {
+            return static_cast<uint32_t>(msg.teChgDetect);
+        }
+        else if (mnem == "ReservSts") {
+            return static_cast<uint32_t>(msg.teReservSts);
+        }
+        else if (mnem == "NomFullCap") {
+            return static_cast<uint32_t>(msg.uiNomFullCap);
+        }
+        else if (mnem == "DcPwr") {
+            return static_cast<uint32_t>(msg.uiDcPwr);
+        }
+        return UINT32_MAX;
+    }
+void BattSts11::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DischgOnOffSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teDischgOnOffSts = static_cast<decltype(msg.teDischgOnOffSts)>(enumValue);
+     else msg.teDischgOnOffSts = static_cast<decltype(msg.teDischgOnOffSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgOnOffSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teChgOnOffSts = static_cast<decltype(msg.teChgOnOffSts)>(enumValue);
+     else msg.teChgOnOffSts = static_cast<decltype(msg.teChgOnOffSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgDetect") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teChgDetect = static_cast<decltype(msg.teChgDetect)>(enumValue);
+     else msg.teChgDetect = static_cast<decltype(msg.teChgDetect)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ReservSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teReservSts = static_cast<decltype(msg.teReservSts)>(enumValue);
+     else msg.teReservSts = static_cast<decltype(msg.teReservSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "NomFullCap") {
+     msg.uiNomFullCap = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "DcPwr") {
+     msg.uiDcPwr = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void BattSts11::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSts11::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSts11::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "DischgOnOffSts") {
+            return 1.0 * (long double)(msg.teDischgOnOffSts + 0.0);
+        }
+        else if (mnem == "ChgOnOffSts") {
+            return 1.0 * (long double)(msg.teChgOnOffSts + 0.0);
+        }
+        else if (mnem == "ChgDetect") {
+            return 1.0 * (long double)(msg.teChgDetect + 0.0);
+        }
+        else if (mnem == "ReservSts") {
+            return 1.0 * (long double)(msg.teReservSts + 0.0);
+        }
+        else if (mnem == "NomFullCap") {
+            return 1.0 * (long double)(msg.uiNomFullCap + 0.0);
+        }
+        else if (mnem == "DcPwr") {
+            return 1.0 * (long double)(msg.uiDcPwr + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattSts6
+std::string BattSts6::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "HiVoltLimitSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teHiVoltLimitSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHiVoltLimitSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teHiVoltLimitSts));
+              }
+        }
+        else if (mnem == "HiVoltDisconSts") {
+            if (!ENUMLOOKUP_276767036.fnContains(msg.teHiVoltDisconSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHiVoltDisconSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_276767036.fnText(msg.teHiVoltDisconSts));
+              }
+        }
+        else if (mnem == "LowVoltLimitSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLowVoltLimitSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowVoltLimitSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLowVoltLimitSts));
+              }
+        }
+        else if (mnem == "LowVoltDisconSts") {
+            if (!ENUMLOOKUP_276767036.fnContains(msg.teLowVoltDisconSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowVoltDisconSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_276767036.fnText(msg.teLowVoltDisconSts));
+              }
+        }
+        else if (mnem == "LowSocLimitSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLowSocLimitSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowSocLimitSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLowSocLimitSts));
+              }
+        }
+        else if (mnem == "LowSocDisconSts") {
+            if (!ENUMLOOKUP_276767036.fnContains(msg.teLowSocDisconSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowSocDisconSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_276767036.fnText(msg.teLowSocDisconSts));
+              }
+        }
+        else if (mnem == "LowDcSrcTempLimitSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLowDcSrcTempLimitSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowDcSrcTempLimitSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLowDcSrcTempLimitSts));
+              }
+        }
+        else if (mnem == "LowDcSrcTempDisconSts") {
+            if (!ENUMLOOKUP_276767036.fnContains(msg.teLowDcSrcTempDisconSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowDcSrcTempDisconSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_276767036.fnText(msg.teLowDcSrcTempDisconSts));
+              }
+        }
+        else if (mnem == "HiDcSrcTempLimitSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teHiDcSrcTempLimitSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHiDcSrcTempLimitSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teHiDcSrcTempLimitSts));
+              }
+        }
+        else if (mnem == "HiDcSrcTempDisconSts") {
+            if (!ENUMLOOKUP_276767036.fnContains(msg.teHiDcSrcTempDisconSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHiDcSrcTempDisconSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_276767036.fnText(msg.teHiDcSrcTempDisconSts));
+              }
+        }
+        else if (mnem == "HiAmpDcSrcLimitSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teHiAmpDcSrcLimitSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHiAmpDcSrcLimitSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teHiAmpDcSrcLimitSts));
+              }
+        }
+        else if (mnem == "HiAmpDcSrcDisconSts") {
+            if (!ENUMLOOKUP_276767036.fnContains(msg.teHiAmpDcSrcDisconSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHiAmpDcSrcDisconSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_276767036.fnText(msg.teHiAmpDcSrcDisconSts));
+              }
+        }
+        else return "no pgn";
+    }
+void BattSts6::Print() const {
+        std::cout << "PGN: BattSts6" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "HiVoltLimitSts      : " << fnGetValue("HiVoltLimitSts") << " (" << fnGetRawValue("HiVoltLimitSts") << ")" << endl;
+        cout << "HiVoltDisconSts      : " << fnGetValue("HiVoltDisconSts") << " (" << fnGetRawValue("HiVoltDisconSts") << ")" << endl;
+        cout << "LowVoltLimitSts      : " << fnGetValue("LowVoltLimitSts") << " (" << fnGetRawValue("LowVoltLimitSts") << ")" << endl;
+        cout << "LowVoltDisconSts      : " << fnGetValue("LowVoltDisconSts") << " (" << fnGetRawValue("LowVoltDisconSts") << ")" << endl;
+        cout << "LowSocLimitSts      : " << fnGetValue("LowSocLimitSts") << " (" << fnGetRawValue("LowSocLimitSts") << ")" << endl;
+        cout << "LowSocDisconSts      : " << fnGetValue("LowSocDisconSts") << " (" << fnGetRawValue("LowSocDisconSts") << ")" << endl;
+        cout << "LowDcSrcTempLimitSts      : " << fnGetValue("LowDcSrcTempLimitSts") << " (" << fnGetRawValue("LowDcSrcTempLimitSts") << ")" << endl;
+        cout << "LowDcSrcTempDisconSts      : " << fnGetValue("LowDcSrcTempDisconSts") << " (" << fnGetRawValue("LowDcSrcTempDisconSts") << ")" << endl;
+        cout << "HiDcSrcTempLimitSts      : " << fnGetValue("HiDcSrcTempLimitSts") << " (" << fnGetRawValue("HiDcSrcTempLimitSts") << ")" << endl;
+        cout << "HiDcSrcTempDisconSts      : " << fnGetValue("HiDcSrcTempDisconSts") << " (" << fnGetRawValue("HiDcSrcTempDisconSts") << ")" << endl;
+        cout << "HiAmpDcSrcLimitSts      : " << fnGetValue("HiAmpDcSrcLimitSts") << " (" << fnGetRawValue("HiAmpDcSrcLimitSts") << ")" << endl;
+        cout << "HiAmpDcSrcDisconSts      : " << fnGetValue("HiAmpDcSrcDisconSts") << " (" << fnGetRawValue("HiAmpDcSrcDisconSts") << ")" << endl;
+    }
+bool BattSts6::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSts6::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "HiVoltLimitSts") {
+            return static_cast<uint32_t>(msg.teHiVoltLimitSts);
+        }
+        else if (mnem == "HiVoltDisconSts") {
+            return static_cast<uint32_t>(msg.teHiVoltDisconSts);
+        }
+        else if (mnem == "LowVoltLimitSts") {
+            return static_cast<uint32_t>(msg.teLowVoltLimitSts);
+        }
+        else if (mnem == "LowVoltDisconSts") {
+            return static_cast<uint32_t>(msg.teLowVoltDisconSts);
+        }
+        else if (mnem == "LowSocLimitSts") {
+            return static_cast<uint32_t>(msg.teLowSocLimitSts);
+        }
+        else if (mnem == "LowSocDisconSts") {
+            return static_cast<uint32_t>(msg.teLowSocDisconSts);
+        }
+        else if (mnem == "LowDcSrcTempLimitSts") {
+            return static_cast<uint32_t>(msg.teLowDcSrcTempLimitSts);
+        }
+        else if (mnem == "LowDcSrcTempDisconSts") {
+            return static_cast<uint32_t>(msg.teLowDcSrcTempDisconSts);
+        }
+        else if (mnem == "HiDcSrcTempLimitSts") {
+            return static_cast<uint32_t>(msg.teHiDcSrcTempLimitSts);
+        }
+        else if (mnem == "HiDcSrcTempDisconSts") {
+            return static_cast<uint32_t>(msg.teHiDcSrcTempDisconSts);
+        }
+        else if (mnem == "HiAmpDcSrcLimitSts") {
+            return static_cast<uint32_t>(msg.teHiAmpDcSrcLimitSts);
+        }
+        else if (mnem == "HiAmpDcSrcDisconSts") {
+            return static_cast<uint32_t>(msg.teHiAmpDcSrcDisconSts);
+        }
+        return UINT32_MAX;
+    }
+void BattSts6::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiVoltLimitSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teHiVoltLimitSts = static_cast<decltype(msg.teHiVoltLimitSts)>(enumValue);
+     else msg.teHiVoltLimitSts = static_cast<decltype(msg.teHiVoltLimitSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiVoltDisconSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_276767036, value);
+     if (enumValue != -1) msg.teHiVoltDisconSts = static_cast<decltype(msg.teHiVoltDisconSts)>(enumValue);
+     else msg.teHiVoltDisconSts = static_cast<decltype(msg.teHiVoltDisconSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowVoltLimitSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLowVoltLimitSts = static_cast<decltype(msg.teLowVoltLimitSts)>(enumValue);
+     else msg.teLowVoltLimitSts = static_cast<decltype(msg.teLowVoltLimitSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowVoltDisconSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_276767036, value);
+     if (enumValue != -1) msg.teLowVoltDisconSts = static_cast<decltype(msg.teLowVoltDisconSts)>(enumValue);
+     else msg.teLowVoltDisconSts = static_cast<decltype(msg.teLowVoltDisconSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowSocLimitSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLowSocLimitSts = static_cast<decltype(msg.teLowSocLimitSts)>(enumValue);
+     else msg.teLowSocLimitSts = static_cast<decltype(msg.teLowSocLimitSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowSocDisconSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_276767036, value);
+     if (enumValue != -1) msg.teLowSocDisconSts = static_cast<decltype(msg.teLowSocDisconSts)>(enumValue);
+     else msg.teLowSocDisconSts = static_cast<decltype(msg.teLowSocDisconSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowDcSrcTempLimitSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLowDcSrcTempLimitSts = static_cast<decltype(msg.teLowDcSrcTempLimitSts)>(enumValue);
+     else msg.teLowDcSrcTempLimitSts = static_cast<decltype(msg.teLowDcSrcTempLimitSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowDcSrcTempDisconSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_276767036, value);
+     if (enumValue != -1) msg.teLowDcSrcTempDisconSts = static_cast<decltype(msg.teLowDcSrcTempDisconSts)>(enumValue);
+     else msg.teLowDcSrcTempDisconSts = static_cast<decltype(msg.teLowDcSrcTempDisconSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiDcSrcTempLimitSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teHiDcSrcTempLimitSts = static_cast<decltype(msg.teHiDcSrcTempLimitSts)>(enumValue);
+     else msg.teHiDcSrcTempLimitSts = static_cast<decltype(msg.teHiDcSrcTempLimitSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiDcSrcTempDisconSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_276767036, value);
+     if (enumValue != -1) msg.teHiDcSrcTempDisconSts = static_cast<decltype(msg.teHiDcSrcTempDisconSts)>(enumValue);
+     else msg.teHiDcSrcTempDisconSts = static_cast<decltype(msg.teHiDcSrcTempDisconSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiAmpDcSrcLimitSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teHiAmpDcSrcLimitSts = static_cast<decltype(msg.teHiAmpDcSrcLimitSts)>(enumValue);
+     else msg.teHiAmpDcSrcLimitSts = static_cast<decltype(msg.teHiAmpDcSrcLimitSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiAmpDcSrcDisconSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_276767036, value);
+     if (enumValue != -1) msg.teHiAmpDcSrcDisconSts = static_cast<decltype(msg.teHiAmpDcSrcDisconSts)>(enumValue);
+     else msg.teHiAmpDcSrcDisconSts = static_cast<decltype(msg.teHiAmpDcSrcDisconSts)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void BattSts6::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSts6::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSts6::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "HiVoltLimitSts") {
+            return 1.0 * (long double)(msg.teHiVoltLimitSts + 0.0);
+        }
+        else if (mnem == "HiVoltDisconSts") {
+            return 1.0 * (long double)(msg.teHiVoltDisconSts + 0.0);
+        }
+        else if (mnem == "LowVoltLimitSts") {
+            return 1.0 * (long double)(msg.teLowVoltLimitSts + 0.0);
+        }
+        else if (mnem == "LowVoltDisconSts") {
+            return 1.0 * (long double)(msg.teLowVoltDisconSts + 0.0);
+        }
+        else if (mnem == "LowSocLimitSts") {
+            return 1.0 * (long double)(msg.teLowSocLimitSts + 0.0);
+        }
+        else if (mnem == "LowSocDisconSts") {
+            return 1.0 * (long double)(msg.teLowSocDisconSts + 0.0);
+        }
+        else if (mnem == "LowDcSrcTempLimitSts") {
+            return 1.0 * (long double)(msg.teLowDcSrcTempLimitSts + 0.0);
+        }
+        else if (mnem == "LowDcSrcTempDisconSts") {
+            return 1.0 * (long double)(msg.teLowDcSrcTempDisconSts + 0.0);
+        }
+        else if (mnem == "HiDcSrcTempLimitSts") {
+            return 1.0 * (long double)(msg.teHiDcSrcTempLimitSts + 0.0);
+        }
+        else if (mnem == "HiDcSrcTempDisconSts") {
+            return 1.0 * (long double)(msg.teHiDcSrcTempDisconSts + 0.0);
+        }
+        else if (mnem == "HiAmpDcSrcLimitSts") {
+            return 1.0 * (long double)(msg.teHiAmpDcSrcLimitSts + 0.0);
+        }
+        else if (mnem == "HiAmpDcSrcDisconSts") {
+            return 1.0 * (long double)(msg.teHiAmpDcSrcDisconSts + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattSts4
+std::string BattSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "DesChgState") {
+            if (!ENUMLOOKUP_1599683911.fnContains(msg.teDesChgState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDesChgState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1599683911.fnText(msg.teDesChgState));
+              }
+        }
+        else if (mnem == "DesDcV") {
+            return (msg.uiDesDcV == 0xffff) ? "No Data" : (msg.uiDesDcV == 0xfffe) ? "Out of range" : (msg.uiDesDcV == 0xfffd) ? "Reserved" : std::to_string(msg.uiDesDcV);
+        }
+        else if (mnem == "DesDcI") {
+            return (msg.uiDesDcI == 0xffff) ? "No Data" : (msg.uiDesDcI == 0xfffe) ? "Out of range" : (msg.uiDesDcI == 0xfffd) ? "Reserved" : std::to_string(msg.uiDesDcI);
+        }
+        else if (mnem == "BattType") {
+            if (!ENUMLOOKUP_9410.fnContains(msg.teBattType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9410.fnText(msg.teBattType));
+              }
+        }
+        else return "no pgn";
+    }
+void BattSts4::Print() const {
+        std::cout << "PGN: BattSts4" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DesChgState      : " << fnGetValue("DesChgState") << " (" << fnGetRawValue("DesChgState") << ")" << endl;
+        cout << "DesDcV      : " << fnGetValue("DesDcV") << " (" << fnGetRawValue("DesDcV") << ")" << endl;
+        cout << "DesDcI      : " << fnGetValue("DesDcI") << " (" << fnGetRawValue("DesDcI") << ")" << endl;
+        cout << "BattType      : " << fnGetValue("BattType") << " (" << fnGetRawValue("BattType") << ")" << endl;
+    }
+bool BattSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "DesChgState") {
+            return static_cast<uint32_t>(msg.teDesChgState);
+        }
+        else if (mnem == "DesDcV") {
+            return static_cast<uint32_t>(msg.uiDesDcV);
+        }
+        else if (mnem == "DesDcI") {
+            return static_cast<uint32_t>(msg.uiDesDcI);
+        }
+        else if (mnem == "BattType") {
+            return static_cast<uint32_t>(msg.teBattType);
+        }
+        return UINT32_MAX;
+    }
+void BattSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DesChgState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1599683911, value);
+     if (enumValue != -1) msg.teDesChgState = static_cast<decltype(msg.teDesChgState)>(enumValue);
+     else msg.teDesChgState = static_cast<decltype(msg.teDesChgState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DesDcV") {
+     msg.uiDesDcV = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "DesDcI") {
+     msg.uiDesDcI = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "BattType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9410, value);
+     if (enumValue != -1) msg.teBattType = static_cast<decltype(msg.teBattType)>(enumValue);
+     else msg.teBattType = static_cast<decltype(msg.teBattType)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void BattSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSts4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "DesChgState") {
+            return 1.0 * (long double)(msg.teDesChgState + 0.0);
+        }
+        else if (mnem == "DesDcV") {
+            return 1.0 * (long double)(msg.uiDesDcV + 0.0);
+        }
+        else if (mnem == "DesDcI") {
+            return 1.0 * (long double)(msg.uiDesDcI + 0.0);
+        }
+        else if (mnem == "BattType") {
+            return 1.0 * (long double)(msg.teBattType + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattSts3
+std::string BattSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "Soh") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucSoh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucSoh == 0xff) ? "No Data" : (msg.ucSoh == 0xfe) ? "Out of range" : (msg.ucSoh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "CapRemain") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiCapRemain + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiCapRemain == 0xffff) ? "No Data" : (msg.uiCapRemain == 0xfffe) ? "Out of range" : (msg.uiCapRemain == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "RelCap") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucRelCap + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucRelCap == 0xff) ? "No Data" : (msg.ucRelCap == 0xfe) ? "Out of range" : (msg.ucRelCap == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AcRmsRipple") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiAcRmsRipple + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "mV");
+            return (msg.uiAcRmsRipple == 0xffff) ? "No Data" : (msg.uiAcRmsRipple == 0xfffe) ? "Out of range" : (msg.uiAcRmsRipple == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void BattSts3::Print() const {
+        std::cout << "PGN: BattSts3" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "Soh      : " << fnGetValue("Soh") << " (" << fnGetRawValue("Soh") << ")" << endl;
+        cout << "CapRemain      : " << fnGetValue("CapRemain") << " (" << fnGetRawValue("CapRemain") << ")" << endl;
+        cout << "RelCap      : " << fnGetValue("RelCap") << " (" << fnGetRawValue("RelCap") << ")" << endl;
+        cout << "AcRmsRipple      : " << fnGetValue("AcRmsRipple") << " (" << fnGetRawValue("AcRmsRipple") << ")" << endl;
+    }
+bool BattSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "Soh") {
+            return static_cast<uint32_t>(msg.ucSoh);
+        }
+        else if (mnem == "CapRemain") {
+            return static_cast<uint32_t>(msg.uiCapRemain);
+        }
+        else if (mnem == "RelCap") {
+            return static_cast<uint32_t>(msg.ucRelCap);
+        }
+        else if (mnem == "AcRmsRipple") {
+            return static_cast<uint32_t>(msg.uiAcRmsRipple);
+        }
+        return UINT32_MAX;
+    }
+void BattSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Soh") {
+     msg.ucSoh = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "CapRemain") {
+     msg.uiCapRemain = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "RelCap") {
+     msg.ucRelCap = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "AcRmsRipple") {
+     msg.uiAcRmsRipple = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void BattSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "Soh") {
+            return 0.5 * (long double)(msg.ucSoh + 0.0);
+        }
+        else if (mnem == "CapRemain") {
+            return 1.0 * (long double)(msg.uiCapRemain + 0.0);
+        }
+        else if (mnem == "RelCap") {
+            return 0.5 * (long double)(msg.ucRelCap + 0.0);
+        }
+        else if (mnem == "AcRmsRipple") {
+            return 1.0 * (long double)(msg.uiAcRmsRipple + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattSts2
+std::string BattSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "SrcTemp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiSrcTemp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiSrcTemp == 0xffff) ? "No Data" : (msg.uiSrcTemp == 0xfffe) ? "Out of range" : (msg.uiSrcTemp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Soc") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucSoc + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucSoc == 0xff) ? "No Data" : (msg.ucSoc == 0xfe) ? "Out of range" : (msg.ucSoc == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeRemain") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiTimeRemain + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiTimeRemain == 0xffff) ? "No Data" : (msg.uiTimeRemain == 0xfffe) ? "Out of range" : (msg.uiTimeRemain == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TimeRemainInterp") {
+            if (!ENUMLOOKUP_972277822.fnContains(msg.teTimeRemainInterp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTimeRemainInterp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_972277822.fnText(msg.teTimeRemainInterp));
+              }
+        }
+        else return "no pgn";
+    }
+void BattSts2::Print() const {
+        std::cout << "PGN: BattSts2" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "SrcTemp      : " << fnGetValue("SrcTemp") << " (" << fnGetRawValue("SrcTemp") << ")" << endl;
+        cout << "Soc      : " << fnGetValue("Soc") << " (" << fnGetRawValue("Soc") << ")" << endl;
+        cout << "TimeRemain      : " << fnGetValue("TimeRemain") << " (" << fnGetRawValue("TimeRemain") << ")" << endl;
+        cout << "TimeRemainInterp      : " << fnGetValue("TimeRemainInterp") << " (" << fnGetRawValue("TimeRemainInterp") << ")" << endl;
+    }
+bool BattSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "SrcTemp") {
+            return static_cast<uint32_t>(msg.uiSrcTemp);
+        }
+        else if (mnem == "Soc") {
+            return static_cast<uint32_t>(msg.ucSoc);
+        }
+        else if (mnem == "TimeRemain") {
+            return static_cast<uint32_t>(msg.uiTimeRemain);
+        }
+        else if (mnem == "TimeRemainInterp") {
+            return static_cast<uint32_t>(msg.teTimeRemainInterp);
+        }
+        return UINT32_MAX;
+    }
+void BattSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SrcTemp") {
+     msg.uiSrcTemp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "Soc") {
+     msg.ucSoc = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "TimeRemain") {
+     msg.uiTimeRemain = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "TimeRemainInterp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_972277822, value);
+     if (enumValue != -1) msg.teTimeRemainInterp = static_cast<decltype(msg.teTimeRemainInterp)>(enumValue);
+     else msg.teTimeRemainInterp = static_cast<decltype(msg.teTimeRemainInterp)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void BattSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "SrcTemp") {
+            return 0.03125 * (long double)(msg.uiSrcTemp + -8736.0);
+        }
+        else if (mnem == "Soc") {
+            return 0.5 * (long double)(msg.ucSoc + 0.0);
+        }
+        else if (mnem == "TimeRemain") {
+            return 1.0 * (long double)(msg.uiTimeRemain + 0.0);
+        }
+        else if (mnem == "TimeRemainInterp") {
+            return 1.0 * (long double)(msg.teTimeRemainInterp + 0.0);
+        }
+        return 0.0;
+    }
+
+// BattSts1
+std::string BattSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BattInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teBattInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teBattInst));
+              }
+        }
+        else if (mnem == "DcInst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInst));
+              }
+        }
+        else if (mnem == "DcV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcV == 0xffff) ? "No Data" : (msg.uiDcV == 0xfffe) ? "Out of range" : (msg.uiDcV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcI") {
+            char buffer[50];
+            auto engval = 0.0010000000474974513 * (long double) (msg.ulDcI + -2000000000.0);
+            snprintf(buffer, sizeof(buffer), "%.3f %s", engval, "A");
+            return (msg.ulDcI == 0xffffffff) ? "No Data" : (msg.ulDcI == 0xfffffffe) ? "Out of range" : (msg.ulDcI == 0xfffffffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void BattSts1::Print() const {
+        std::cout << "PGN: BattSts1" << std::endl;
+        cout << "BattInst      : " << fnGetValue("BattInst") << " (" << fnGetRawValue("BattInst") << ")" << endl;
+        cout << "DcInst      : " << fnGetValue("DcInst") << " (" << fnGetRawValue("DcInst") << ")" << endl;
+        cout << "DcV      : " << fnGetValue("DcV") << " (" << fnGetRawValue("DcV") << ")" << endl;
+        cout << "DcI      : " << fnGetValue("DcI") << " (" << fnGetRawValue("DcI") << ")" << endl;
+    }
+bool BattSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 BattSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return static_cast<uint32_t>(msg.teBattInst);
+        }
+        else if (mnem == "DcInst") {
+            return static_cast<uint32_t>(msg.teDcInst);
+        }
+        else if (mnem == "DcV") {
+            return static_cast<uint32_t>(msg.uiDcV);
+        }
+        else if (mnem == "DcI") {
+            return static_cast<uint32_t>(msg.ulDcI);
+        }
+        return UINT32_MAX;
+    }
+void BattSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BattInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teBattInst = static_cast<decltype(msg.teBattInst)>(enumValue);
+     else msg.teBattInst = static_cast<decltype(msg.teBattInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInst = static_cast<decltype(msg.teDcInst)>(enumValue);
+     else msg.teDcInst = static_cast<decltype(msg.teDcInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcV") {
+     msg.uiDcV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "DcI") {
+     msg.ulDcI = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd, 0.0010000000474974513, -2000000000.0);
+        }
+    }
+void BattSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string BattSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double BattSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BattInst") {
+            return 1.0 * (long double)(msg.teBattInst + 0.0);
+        }
+        else if (mnem == "DcInst") {
+            return 1.0 * (long double)(msg.teDcInst + 0.0);
+        }
+        else if (mnem == "DcV") {
+            return 0.05000000074505806 * (long double)(msg.uiDcV + 0.0);
+        }
+        else if (mnem == "DcI") {
+            return 0.0010000000474974513 * (long double)(msg.ulDcI + -2000000000.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_batt_registrars[] = {
+{"BattSumm", [](void * rcv) { return std::make_unique<BattSumm>(rcv); }, []() { return std::make_unique<BattSumm>(); } },
+{"BattCmd", [](void * rcv) { return std::make_unique<BattCmd>(rcv); }, []() { return std::make_unique<BattCmd>(); } },
+{"BattSts11", [](void * rcv) { return std::make_unique<BattSts11>(rcv); }, []() { return std::make_unique<BattSts11>(); } },
+{"BattSts6", [](void * rcv) { return std::make_unique<BattSts6>(rcv); }, []() { return std::make_unique<BattSts6>(); } },
+{"BattSts4", [](void * rcv) { return std::make_unique<BattSts4>(rcv); }, []() { return std::make_unique<BattSts4>(); } },
+{"BattSts3", [](void * rcv) { return std::make_unique<BattSts3>(rcv); }, []() { return std::make_unique<BattSts3>(); } },
+{"BattSts2", [](void * rcv) { return std::make_unique<BattSts2>(rcv); }, []() { return std::make_unique<BattSts2>(); } },
+{"BattSts1", [](void * rcv) { return std::make_unique<BattSts1>(rcv); }, []() { return std::make_unique<BattSts1>(); } },
+};
+static const PrinterRegistrar pgn_batt_printers[] = {
+{130545, -1, fnPrintMessage<BattSumm>},
+{130698, -1, fnPrintMessage<BattCmd>},
+{130699, -1, fnPrintMessage<BattSts11>},
+{130704, -1, fnPrintMessage<BattSts6>},
+{130706, -1, fnPrintMessage<BattSts4>},
+{130707, -1, fnPrintMessage<BattSts3>},
+{130708, -1, fnPrintMessage<BattSts2>},
+{130709, -1, fnPrintMessage<BattSts1>},
+};
@@ -0,0 +1,3357 @@
+// Auto-generated by generate_print_functions.py: chg message classes
+#include "print_functions3.h"
+
+// ChgSts3
+std::string ChgSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "ChgInst") {
+            return (msg.ucChgInst == 0xff) ? "No Data" : (msg.ucChgInst == 0xfe) ? "Out of range" : (msg.ucChgInst == 0xfd) ? "Reserved" : std::to_string(msg.ucChgInst);
+        }
+        else if (mnem == "DerateSts") {
+            if (!ENUMLOOKUP_2041349348.fnContains(msg.teDerateSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDerateSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2041349348.fnText(msg.teDerateSts));
+              }
+        }
+        else if (mnem == "DerateReason") {
+            if (!ENUMLOOKUP_666383381.fnContains(msg.teDerateReason)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDerateReason);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_666383381.fnText(msg.teDerateReason));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgSts3::Print() const {
+        std::cout << "PGN: ChgSts3" << std::endl;
+        cout << "ChgInst      : " << fnGetValue("ChgInst") << " (" << fnGetRawValue("ChgInst") << ")" << endl;
+        cout << "DerateSts      : " << fnGetValue("DerateSts") << " (" << fnGetRawValue("DerateSts") << ")" << endl;
+        cout << "DerateReason      : " << fnGetValue("DerateReason") << " (" << fnGetRawValue("DerateReason") << ")" << endl;
+    }
+bool ChgSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "ChgInst") {
+            return static_cast<uint32_t>(msg.ucChgInst);
+        }
+        else if (mnem == "DerateSts") {
+            return static_cast<uint32_t>(msg.teDerateSts);
+        }
+        else if (mnem == "DerateReason") {
+            return static_cast<uint32_t>(msg.teDerateReason);
+        }
+        return UINT32_MAX;
+    }
+void ChgSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "ChgInst") {
+     msg.ucChgInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DerateSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2041349348, value);
+     if (enumValue != -1) msg.teDerateSts = static_cast<decltype(msg.teDerateSts)>(enumValue);
+     else msg.teDerateSts = static_cast<decltype(msg.teDerateSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DerateReason") {
+     int enumValue = findEnumValue(ENUMLOOKUP_666383381, value);
+     if (enumValue != -1) msg.teDerateReason = static_cast<decltype(msg.teDerateReason)>(enumValue);
+     else msg.teDerateReason = static_cast<decltype(msg.teDerateReason)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "ChgInst") {
+            return 1.0 * (long double)(msg.ucChgInst + 0.0);
+        }
+        else if (mnem == "DerateSts") {
+            return 1.0 * (long double)(msg.teDerateSts + 0.0);
+        }
+        else if (mnem == "DerateReason") {
+            return 1.0 * (long double)(msg.teDerateReason + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgSts2
+std::string ChgSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "ChgInst") {
+            return (msg.ucChgInst == 0xff) ? "No Data" : (msg.ucChgInst == 0xfe) ? "Out of range" : (msg.ucChgInst == 0xfd) ? "Reserved" : std::to_string(msg.ucChgInst);
+        }
+        else if (mnem == "DcSrcInst") {
+            return (msg.ucDcSrcInst == 0xff) ? "No Data" : (msg.ucDcSrcInst == 0xfe) ? "Out of range" : (msg.ucDcSrcInst == 0xfd) ? "Reserved" : std::to_string(msg.ucDcSrcInst);
+        }
+        else if (mnem == "ChgPrio") {
+            if (!ENUMLOOKUP_1486082168.fnContains(msg.teChgPrio)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgPrio);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1486082168.fnText(msg.teChgPrio));
+              }
+        }
+        else if (mnem == "ChgV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiChgV == 0xffff) ? "No Data" : (msg.uiChgV == 0xfffe) ? "Out of range" : (msg.uiChgV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiChgI == 0xffff) ? "No Data" : (msg.uiChgI == 0xfffe) ? "Out of range" : (msg.uiChgI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucChgTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucChgTemp == 0xff) ? "No Data" : (msg.ucChgTemp == 0xfe) ? "Out of range" : (msg.ucChgTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgSts2::Print() const {
+        std::cout << "PGN: ChgSts2" << std::endl;
+        cout << "ChgInst      : " << fnGetValue("ChgInst") << " (" << fnGetRawValue("ChgInst") << ")" << endl;
+        cout << "DcSrcInst      : " << fnGetValue("DcSrcInst") << " (" << fnGetRawValue("DcSrcInst") << ")" << endl;
+        cout << "ChgPrio      : " << fnGetValue("ChgPrio") << " (" << fnGetRawValue("ChgPrio") << ")" << endl;
+        cout << "ChgV      : " << fnGetValue("ChgV") << " (" << fnGetRawValue("ChgV") << ")" << endl;
+        cout << "ChgI      : " << fnGetValue("ChgI") << " (" << fnGetRawValue("ChgI") << ")" << endl;
+        cout << "ChgTemp      : " << fnGetValue("ChgTemp") << " (" << fnGetRawValue("ChgTemp") << ")" << endl;
+    }
+bool ChgSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "ChgInst") {
+            return static_cast<uint32_t>(msg.ucChgInst);
+        }
+        else if (mnem == "DcSrcInst") {
+            return static_cast<uint32_t>(msg.ucDcSrcInst);
+        }
+        else if (mnem == "ChgPrio") {
+            return static_cast<uint32_t>(msg.teChgPrio);
+        }
+        else if (mnem == "ChgV") {
+            return static_cast<uint32_t>(msg.uiChgV);
+        }
+        else if (mnem == "ChgI") {
+            return static_cast<uint32_t>(msg.uiChgI);
+        }
+        else if (mnem == "ChgTemp") {
+            return static_cast<uint32_t>(msg.ucChgTemp);
+        }
+        return UINT32_MAX;
+    }
+void ChgSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "ChgInst") {
+     msg.ucChgInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSrcInst") {
+     msg.ucDcSrcInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ChgPrio") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1486082168, value);
+     if (enumValue != -1) msg.teChgPrio = static_cast<decltype(msg.teChgPrio)>(enumValue);
+     else msg.teChgPrio = static_cast<decltype(msg.teChgPrio)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgV") {
+     msg.uiChgV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "ChgI") {
+     msg.uiChgI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "ChgTemp") {
+     msg.ucChgTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void ChgSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "ChgInst") {
+            return 1.0 * (long double)(msg.ucChgInst + 0.0);
+        }
+        else if (mnem == "DcSrcInst") {
+            return 1.0 * (long double)(msg.ucDcSrcInst + 0.0);
+        }
+        else if (mnem == "ChgPrio") {
+            return 1.0 * (long double)(msg.teChgPrio + 0.0);
+        }
+        else if (mnem == "ChgV") {
+            return 0.05000000074505806 * (long double)(msg.uiChgV + 0.0);
+        }
+        else if (mnem == "ChgI") {
+            return 0.05000000074505806 * (long double)(msg.uiChgI + -32000.0);
+        }
+        else if (mnem == "ChgTemp") {
+            return 1.0 * (long double)(msg.ucChgTemp + -40.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgCmd4
+std::string ChgCfgCmd4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BulkTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBulkTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiBulkTime == 0xffff) ? "No Data" : (msg.uiBulkTime == 0xfffe) ? "Out of range" : (msg.uiBulkTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AbsorpTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiAbsorpTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiAbsorpTime == 0xffff) ? "No Data" : (msg.uiAbsorpTime == 0xfffe) ? "Out of range" : (msg.uiAbsorpTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FloatTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiFloatTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiFloatTime == 0xffff) ? "No Data" : (msg.uiFloatTime == 0xfffe) ? "Out of range" : (msg.uiFloatTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgCfgCmd4::Print() const {
+        std::cout << "PGN: ChgCfgCmd4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BulkTime      : " << fnGetValue("BulkTime") << " (" << fnGetRawValue("BulkTime") << ")" << endl;
+        cout << "AbsorpTime      : " << fnGetValue("AbsorpTime") << " (" << fnGetRawValue("AbsorpTime") << ")" << endl;
+        cout << "FloatTime      : " << fnGetValue("FloatTime") << " (" << fnGetRawValue("FloatTime") << ")" << endl;
+    }
+bool ChgCfgCmd4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgCmd4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BulkTime") {
+            return static_cast<uint32_t>(msg.uiBulkTime);
+        }
+        else if (mnem == "AbsorpTime") {
+            return static_cast<uint32_t>(msg.uiAbsorpTime);
+        }
+        else if (mnem == "FloatTime") {
+            return static_cast<uint32_t>(msg.uiFloatTime);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgCmd4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BulkTime") {
+     msg.uiBulkTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+     msg.uiAbsorpTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "FloatTime") {
+     msg.uiFloatTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void ChgCfgCmd4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgCmd4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgCfgCmd4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BulkTime") {
+            return 1.0 * (long double)(msg.uiBulkTime + 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+            return 1.0 * (long double)(msg.uiAbsorpTime + 0.0);
+        }
+        else if (mnem == "FloatTime") {
+            return 1.0 * (long double)(msg.uiFloatTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgSts4
+std::string ChgCfgSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BulkTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBulkTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiBulkTime == 0xffff) ? "No Data" : (msg.uiBulkTime == 0xfffe) ? "Out of range" : (msg.uiBulkTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AbsorpTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiAbsorpTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiAbsorpTime == 0xffff) ? "No Data" : (msg.uiAbsorpTime == 0xfffe) ? "Out of range" : (msg.uiAbsorpTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FloatTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiFloatTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiFloatTime == 0xffff) ? "No Data" : (msg.uiFloatTime == 0xfffe) ? "Out of range" : (msg.uiFloatTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgCfgSts4::Print() const {
+        std::cout << "PGN: ChgCfgSts4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BulkTime      : " << fnGetValue("BulkTime") << " (" << fnGetRawValue("BulkTime") << ")" << endl;
+        cout << "AbsorpTime      : " << fnGetValue("AbsorpTime") << " (" << fnGetRawValue("AbsorpTime") << ")" << endl;
+        cout << "FloatTime      : " << fnGetValue("FloatTime") << " (" << fnGetRawValue("FloatTime") << ")" << endl;
+    }
+bool ChgCfgSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BulkTime") {
+            return static_cast<uint32_t>(msg.uiBulkTime);
+        }
+        else if (mnem == "AbsorpTime") {
+            return static_cast<uint32_t>(msg.uiAbsorpTime);
+        }
+        else if (mnem == "FloatTime") {
+            return static_cast<uint32_t>(msg.uiFloatTime);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BulkTime") {
+     msg.uiBulkTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+     msg.uiAbsorpTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "FloatTime") {
+     msg.uiFloatTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void ChgCfgSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgSts4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgCfgSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BulkTime") {
+            return 1.0 * (long double)(msg.uiBulkTime + 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+            return 1.0 * (long double)(msg.uiAbsorpTime + 0.0);
+        }
+        else if (mnem == "FloatTime") {
+            return 1.0 * (long double)(msg.uiFloatTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgCmd3
+std::string ChgCfgCmd3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBulkV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBulkV == 0xffff) ? "No Data" : (msg.uiBulkV == 0xfffe) ? "Out of range" : (msg.uiBulkV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AbsorpV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiAbsorpV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiAbsorpV == 0xffff) ? "No Data" : (msg.uiAbsorpV == 0xfffe) ? "Out of range" : (msg.uiAbsorpV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FloatV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiFloatV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiFloatV == 0xffff) ? "No Data" : (msg.uiFloatV == 0xfffe) ? "Out of range" : (msg.uiFloatV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TempCompConst") {
+            return (msg.ucTempCompConst == 0xff) ? "No Data" : (msg.ucTempCompConst == 0xfe) ? "Out of range" : (msg.ucTempCompConst == 0xfd) ? "Reserved" : std::to_string(msg.ucTempCompConst);
+        }
+        else return "no pgn";
+    }
+void ChgCfgCmd3::Print() const {
+        std::cout << "PGN: ChgCfgCmd3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BulkV      : " << fnGetValue("BulkV") << " (" << fnGetRawValue("BulkV") << ")" << endl;
+        cout << "AbsorpV      : " << fnGetValue("AbsorpV") << " (" << fnGetRawValue("AbsorpV") << ")" << endl;
+        cout << "FloatV      : " << fnGetValue("FloatV") << " (" << fnGetRawValue("FloatV") << ")" << endl;
+        cout << "TempCompConst      : " << fnGetValue("TempCompConst") << " (" << fnGetRawValue("TempCompConst") << ")" << endl;
+    }
+bool ChgCfgCmd3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgCmd3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            return static_cast<uint32_t>(msg.uiBulkV);
+        }
+        else if (mnem == "AbsorpV") {
+            return static_cast<uint32_t>(msg.uiAbsorpV);
+        }
+        else if (mnem == "FloatV") {
+            return static_cast<uint32_t>(msg.uiFloatV);
+        }
+        else if (mnem == "TempCompConst") {
+            return static_cast<uint32_t>(msg.ucTempCompConst);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgCmd3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "BulkV") {
+     msg.uiBulkV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "AbsorpV") {
+     msg.uiAbsorpV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "FloatV") {
+     msg.uiFloatV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+     msg.ucTempCompConst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void ChgCfgCmd3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgCmd3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgCfgCmd3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BulkV") {
+            return 0.05000000074505806 * (long double)(msg.uiBulkV + 0.0);
+        }
+        else if (mnem == "AbsorpV") {
+            return 0.05000000074505806 * (long double)(msg.uiAbsorpV + 0.0);
+        }
+        else if (mnem == "FloatV") {
+            return 0.05000000074505806 * (long double)(msg.uiFloatV + 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+            return 1.0 * (long double)(msg.ucTempCompConst + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgSts3
+std::string ChgCfgSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBulkV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBulkV == 0xffff) ? "No Data" : (msg.uiBulkV == 0xfffe) ? "Out of range" : (msg.uiBulkV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AbsorpV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiAbsorpV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiAbsorpV == 0xffff) ? "No Data" : (msg.uiAbsorpV == 0xfffe) ? "Out of range" : (msg.uiAbsorpV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FloatV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiFloatV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiFloatV == 0xffff) ? "No Data" : (msg.uiFloatV == 0xfffe) ? "Out of range" : (msg.uiFloatV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TempCompConst") {
+            return (msg.ucTempCompConst == 0xff) ? "No Data" : (msg.ucTempCompConst == 0xfe) ? "Out of range" : (msg.ucTempCompConst == 0xfd) ? "Reserved" : std::to_string(msg.ucTempCompConst);
+        }
+        else return "no pgn";
+    }
+void ChgCfgSts3::Print() const {
+        std::cout << "PGN: ChgCfgSts3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BulkV      : " << fnGetValue("BulkV") << " (" << fnGetRawValue("BulkV") << ")" << endl;
+        cout << "AbsorpV      : " << fnGetValue("AbsorpV") << " (" << fnGetRawValue("AbsorpV") << ")" << endl;
+        cout << "FloatV      : " << fnGetValue("FloatV") << " (" << fnGetRawValue("FloatV") << ")" << endl;
+        cout << "TempCompConst      : " << fnGetValue("TempCompConst") << " (" << fnGetRawValue("TempCompConst") << ")" << endl;
+    }
+bool ChgCfgSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            return static_cast<uint32_t>(msg.uiBulkV);
+        }
+        else if (mnem == "AbsorpV") {
+            return static_cast<uint32_t>(msg.uiAbsorpV);
+        }
+        else if (mnem == "FloatV") {
+            return static_cast<uint32_t>(msg.uiFloatV);
+        }
+        else if (mnem == "TempCompConst") {
+            return static_cast<uint32_t>(msg.ucTempCompConst);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "BulkV") {
+     msg.uiBulkV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "AbsorpV") {
+     msg.uiAbsorpV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "FloatV") {
+     msg.uiFloatV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+     msg.ucTempCompConst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void ChgCfgSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgCfgSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BulkV") {
+            return 0.05000000074505806 * (long double)(msg.uiBulkV + 0.0);
+        }
+        else if (mnem == "AbsorpV") {
+            return 0.05000000074505806 * (long double)(msg.uiAbsorpV + 0.0);
+        }
+        else if (mnem == "FloatV") {
+            return 0.05000000074505806 * (long double)(msg.uiFloatV + 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+            return 1.0 * (long double)(msg.ucTempCompConst + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcFltCfgCmd2
+std::string ChgAcFltCfgCmd2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "HiFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucHiFreqLimit == 0xff) ? "No Data" : (msg.ucHiFreqLimit == 0xfe) ? "Out of range" : (msg.ucHiFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucLoFreqLimit == 0xff) ? "No Data" : (msg.ucLoFreqLimit == 0xfe) ? "Out of range" : (msg.ucLoFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgAcFltCfgCmd2::Print() const {
+        std::cout << "PGN: ChgAcFltCfgCmd2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "HiFreqLimit      : " << fnGetValue("HiFreqLimit") << " (" << fnGetRawValue("HiFreqLimit") << ")" << endl;
+        cout << "LoFreqLimit      : " << fnGetValue("LoFreqLimit") << " (" << fnGetRawValue("LoFreqLimit") << ")" << endl;
+    }
+bool ChgAcFltCfgCmd2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcFltCfgCmd2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return static_cast<uint32_t>(msg.ucHiFreqLimit);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return static_cast<uint32_t>(msg.ucLoFreqLimit);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcFltCfgCmd2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiFreqLimit") {
+     msg.ucHiFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+     msg.ucLoFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void ChgAcFltCfgCmd2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcFltCfgCmd2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcFltCfgCmd2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return 1.0 * (long double)(msg.ucHiFreqLimit + 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return 1.0 * (long double)(msg.ucLoFreqLimit + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcFltCfgCmd1
+std::string ChgAcFltCfgCmd1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "ExtremeLoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeLoV == 0xff) ? "No Data" : (msg.ucExtremeLoV == 0xfe) ? "Out of range" : (msg.ucExtremeLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucLoV == 0xff) ? "No Data" : (msg.ucLoV == 0xfe) ? "Out of range" : (msg.ucLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucHiV == 0xff) ? "No Data" : (msg.ucHiV == 0xfe) ? "Out of range" : (msg.ucHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtremeHiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeHiV == 0xff) ? "No Data" : (msg.ucExtremeHiV == 0xfe) ? "Out of range" : (msg.ucExtremeHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "QualTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucQualTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucQualTime == 0xff) ? "No Data" : (msg.ucQualTime == 0xfe) ? "Out of range" : (msg.ucQualTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BypassMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassMode));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgAcFltCfgCmd1::Print() const {
+        std::cout << "PGN: ChgAcFltCfgCmd1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "ExtremeLoV      : " << fnGetValue("ExtremeLoV") << " (" << fnGetRawValue("ExtremeLoV") << ")" << endl;
+        cout << "LoV      : " << fnGetValue("LoV") << " (" << fnGetRawValue("LoV") << ")" << endl;
+        cout << "HiV      : " << fnGetValue("HiV") << " (" << fnGetRawValue("HiV") << ")" << endl;
+        cout << "ExtremeHiV      : " << fnGetValue("ExtremeHiV") << " (" << fnGetRawValue("ExtremeHiV") << ")" << endl;
+        cout << "QualTime      : " << fnGetValue("QualTime") << " (" << fnGetRawValue("QualTime") << ")" << endl;
+        cout << "BypassMode      : " << fnGetValue("BypassMode") << " (" << fnGetRawValue("BypassMode") << ")" << endl;
+    }
+bool ChgAcFltCfgCmd1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcFltCfgCmd1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return static_cast<uint32_t>(msg.ucExtremeLoV);
+        }
+        else if (mnem == "LoV") {
+            return static_cast<uint32_t>(msg.ucLoV);
+        }
+        else if (mnem == "HiV") {
+            return static_cast<uint32_t>(msg.ucHiV);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return static_cast<uint32_t>(msg.ucExtremeHiV);
+        }
+        else if (mnem == "QualTime") {
+            return static_cast<uint32_t>(msg.ucQualTime);
+        }
+        else if (mnem == "BypassMode") {
+            return static_cast<uint32_t>(msg.teBypassMode);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcFltCfgCmd1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ExtremeLoV") {
+     msg.ucExtremeLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoV") {
+     msg.ucLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "HiV") {
+     msg.ucHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+     msg.ucExtremeHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "QualTime") {
+     msg.ucQualTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "BypassMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(enumValue);
+     else msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgAcFltCfgCmd1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcFltCfgCmd1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcFltCfgCmd1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return 1.0 * (long double)(msg.ucExtremeLoV + 0.0);
+        }
+        else if (mnem == "LoV") {
+            return 1.0 * (long double)(msg.ucLoV + 0.0);
+        }
+        else if (mnem == "HiV") {
+            return 1.0 * (long double)(msg.ucHiV + 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return 1.0 * (long double)(msg.ucExtremeHiV + 0.0);
+        }
+        else if (mnem == "QualTime") {
+            return 1.0 * (long double)(msg.ucQualTime + 0.0);
+        }
+        else if (mnem == "BypassMode") {
+            return 1.0 * (long double)(msg.teBypassMode + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcFltCfgSts2
+std::string ChgAcFltCfgSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "HiFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucHiFreqLimit == 0xff) ? "No Data" : (msg.ucHiFreqLimit == 0xfe) ? "Out of range" : (msg.ucHiFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoFreqLimit") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoFreqLimit + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucLoFreqLimit == 0xff) ? "No Data" : (msg.ucLoFreqLimit == 0xfe) ? "Out of range" : (msg.ucLoFreqLimit == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgAcFltCfgSts2::Print() const {
+        std::cout << "PGN: ChgAcFltCfgSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "HiFreqLimit      : " << fnGetValue("HiFreqLimit") << " (" << fnGetRawValue("HiFreqLimit") << ")" << endl;
+        cout << "LoFreqLimit      : " << fnGetValue("LoFreqLimit") << " (" << fnGetRawValue("LoFreqLimit") << ")" << endl;
+    }
+bool ChgAcFltCfgSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcFltCfgSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return static_cast<uint32_t>(msg.ucHiFreqLimit);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return static_cast<uint32_t>(msg.ucLoFreqLimit);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcFltCfgSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HiFreqLimit") {
+     msg.ucHiFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+     msg.ucLoFreqLimit = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void ChgAcFltCfgSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcFltCfgSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcFltCfgSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "HiFreqLimit") {
+            return 1.0 * (long double)(msg.ucHiFreqLimit + 0.0);
+        }
+        else if (mnem == "LoFreqLimit") {
+            return 1.0 * (long double)(msg.ucLoFreqLimit + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcFltCfgSts1
+std::string ChgAcFltCfgSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "ExtremeLoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeLoV == 0xff) ? "No Data" : (msg.ucExtremeLoV == 0xfe) ? "Out of range" : (msg.ucExtremeLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucLoV == 0xff) ? "No Data" : (msg.ucLoV == 0xfe) ? "Out of range" : (msg.ucLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucHiV == 0xff) ? "No Data" : (msg.ucHiV == 0xfe) ? "Out of range" : (msg.ucHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtremeHiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeHiV == 0xff) ? "No Data" : (msg.ucExtremeHiV == 0xfe) ? "Out of range" : (msg.ucExtremeHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "QualTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucQualTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucQualTime == 0xff) ? "No Data" : (msg.ucQualTime == 0xfe) ? "Out of range" : (msg.ucQualTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BypassMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassMode));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgAcFltCfgSts1::Print() const {
+        std::cout << "PGN: ChgAcFltCfgSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "ExtremeLoV      : " << fnGetValue("ExtremeLoV") << " (" << fnGetRawValue("ExtremeLoV") << ")" << endl;
+        cout << "LoV      : " << fnGetValue("LoV") << " (" << fnGetRawValue("LoV") << ")" << endl;
+        cout << "HiV      : " << fnGetValue("HiV") << " (" << fnGetRawValue("HiV") << ")" << endl;
+        cout << "ExtremeHiV      : " << fnGetValue("ExtremeHiV") << " (" << fnGetRawValue("ExtremeHiV") << ")" << endl;
+        cout << "QualTime      : " << fnGetValue("QualTime") << " (" << fnGetRawValue("QualTime") << ")" << endl;
+        cout << "BypassMode      : " << fnGetValue("BypassMode") << " (" << fnGetRawValue("BypassMode") << ")" << endl;
+    }
+bool ChgAcFltCfgSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcFltCfgSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return static_cast<uint32_t>(msg.ucExtremeLoV);
+        }
+        else if (mnem == "LoV") {
+            return static_cast<uint32_t>(msg.ucLoV);
+        }
+        else if (mnem == "HiV") {
+            return static_cast<uint32_t>(msg.ucHiV);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return static_cast<uint32_t>(msg.ucExtremeHiV);
+        }
+        else if (mnem == "QualTime") {
+            return static_cast<uint32_t>(msg.ucQualTime);
+        }
+        else if (mnem == "BypassMode") {
+            return static_cast<uint32_t>(msg.teBypassMode);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcFltCfgSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ExtremeLoV") {
+     msg.ucExtremeLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoV") {
+     msg.ucLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "HiV") {
+     msg.ucHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+     msg.ucExtremeHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "QualTime") {
+     msg.ucQualTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "BypassMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(enumValue);
+     else msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgAcFltCfgSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcFltCfgSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcFltCfgSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return 1.0 * (long double)(msg.ucExtremeLoV + 0.0);
+        }
+        else if (mnem == "LoV") {
+            return 1.0 * (long double)(msg.ucLoV + 0.0);
+        }
+        else if (mnem == "HiV") {
+            return 1.0 * (long double)(msg.ucHiV + 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return 1.0 * (long double)(msg.ucExtremeHiV + 0.0);
+        }
+        else if (mnem == "QualTime") {
+            return 1.0 * (long double)(msg.ucQualTime + 0.0);
+        }
+        else if (mnem == "BypassMode") {
+            return 1.0 * (long double)(msg.teBypassMode + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcSts4
+std::string ChgAcSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "VFlt") {
+            if (!ENUMLOOKUP_1485834791.fnContains(msg.teVFlt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teVFlt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1485834791.fnText(msg.teVFlt));
+              }
+        }
+        else if (mnem == "FltSurgeProt") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltSurgeProt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltSurgeProt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltSurgeProt));
+              }
+        }
+        else if (mnem == "FltHiFreq") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltHiFreq)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltHiFreq);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltHiFreq));
+              }
+        }
+        else if (mnem == "FltLoFreq") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltLoFreq)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltLoFreq);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltLoFreq));
+              }
+        }
+        else if (mnem == "BypassModeAct") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassModeAct)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassModeAct);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassModeAct));
+              }
+        }
+        else if (mnem == "QualifStat") {
+            if (!ENUMLOOKUP_872434401.fnContains(msg.teQualifStat)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teQualifStat);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_872434401.fnText(msg.teQualifStat));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgAcSts4::Print() const {
+        std::cout << "PGN: ChgAcSts4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "VFlt      : " << fnGetValue("VFlt") << " (" << fnGetRawValue("VFlt") << ")" << endl;
+        cout << "FltSurgeProt      : " << fnGetValue("FltSurgeProt") << " (" << fnGetRawValue("FltSurgeProt") << ")" << endl;
+        cout << "FltHiFreq      : " << fnGetValue("FltHiFreq") << " (" << fnGetRawValue("FltHiFreq") << ")" << endl;
+        cout << "FltLoFreq      : " << fnGetValue("FltLoFreq") << " (" << fnGetRawValue("FltLoFreq") << ")" << endl;
+        cout << "BypassModeAct      : " << fnGetValue("BypassModeAct") << " (" << fnGetRawValue("BypassModeAct") << ")" << endl;
+        cout << "QualifStat      : " << fnGetValue("QualifStat") << " (" << fnGetRawValue("QualifStat") << ")" << endl;
+    }
+bool ChgAcSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "VFlt") {
+            return static_cast<uint32_t>(msg.teVFlt);
+        }
+        else if (mnem == "FltSurgeProt") {
+            return static_cast<uint32_t>(msg.teFltSurgeProt);
+        }
+        else if (mnem == "FltHiFreq") {
+            return static_cast<uint32_t>(msg.teFltHiFreq);
+        }
+        else if (mnem == "FltLoFreq") {
+            return static_cast<uint32_t>(msg.teFltLoFreq);
+        }
+        else if (mnem == "BypassModeAct") {
+            return static_cast<uint32_t>(msg.teBypassModeAct);
+        }
+        else if (mnem == "QualifStat") {
+            return static_cast<uint32_t>(msg.teQualifStat);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "VFlt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1485834791, value);
+     if (enumValue != -1) msg.teVFlt = static_cast<decltype(msg.teVFlt)>(enumValue);
+     else msg.teVFlt = static_cast<decltype(msg.teVFlt)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltSurgeProt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltSurgeProt = static_cast<decltype(msg.teFltSurgeProt)>(enumValue);
+     else msg.teFltSurgeProt = static_cast<decltype(msg.teFltSurgeProt)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltHiFreq") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltHiFreq = static_cast<decltype(msg.teFltHiFreq)>(enumValue);
+     else msg.teFltHiFreq = static_cast<decltype(msg.teFltHiFreq)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltLoFreq") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltLoFreq = static_cast<decltype(msg.teFltLoFreq)>(enumValue);
+     else msg.teFltLoFreq = static_cast<decltype(msg.teFltLoFreq)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BypassModeAct") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassModeAct = static_cast<decltype(msg.teBypassModeAct)>(enumValue);
+     else msg.teBypassModeAct = static_cast<decltype(msg.teBypassModeAct)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "QualifStat") {
+     int enumValue = findEnumValue(ENUMLOOKUP_872434401, value);
+     if (enumValue != -1) msg.teQualifStat = static_cast<decltype(msg.teQualifStat)>(enumValue);
+     else msg.teQualifStat = static_cast<decltype(msg.teQualifStat)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgAcSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcSts4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "VFlt") {
+            return 1.0 * (long double)(msg.teVFlt + 0.0);
+        }
+        else if (mnem == "FltSurgeProt") {
+            return 1.0 * (long double)(msg.teFltSurgeProt + 0.0);
+        }
+        else if (mnem == "FltHiFreq") {
+            return 1.0 * (long double)(msg.teFltHiFreq + 0.0);
+        }
+        else if (mnem == "FltLoFreq") {
+            return 1.0 * (long double)(msg.teFltLoFreq + 0.0);
+        }
+        else if (mnem == "BypassModeAct") {
+            return 1.0 * (long double)(msg.teBypassModeAct + 0.0);
+        }
+        else if (mnem == "QualifStat") {
+            return 1.0 * (long double)(msg.teQualifStat + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgCmd2
+std::string ChgCfgCmd2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "MaxChgIPer") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucMaxChgIPer + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucMaxChgIPer == 0xff) ? "No Data" : (msg.ucMaxChgIPer == 0xfe) ? "Out of range" : (msg.ucMaxChgIPer == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucChgRateLimitPerBankSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucChgRateLimitPerBankSz == 0xff) ? "No Data" : (msg.ucChgRateLimitPerBankSz == 0xfe) ? "Out of range" : (msg.ucChgRateLimitPerBankSz == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ShoreBrkSz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucShoreBrkSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucShoreBrkSz == 0xff) ? "No Data" : (msg.ucShoreBrkSz == 0xfe) ? "Out of range" : (msg.ucShoreBrkSz == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DefBattTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucDefBattTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucDefBattTemp == 0xff) ? "No Data" : (msg.ucDefBattTemp == 0xfe) ? "Out of range" : (msg.ucDefBattTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ReChgVolt") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiReChgVolt + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiReChgVolt == 0xffff) ? "No Data" : (msg.uiReChgVolt == 0xfffe) ? "Out of range" : (msg.uiReChgVolt == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgCfgCmd2::Print() const {
+        std::cout << "PGN: ChgCfgCmd2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "MaxChgIPer      : " << fnGetValue("MaxChgIPer") << " (" << fnGetRawValue("MaxChgIPer") << ")" << endl;
+        cout << "ChgRateLimitPerBankSz      : " << fnGetValue("ChgRateLimitPerBankSz") << " (" << fnGetRawValue("ChgRateLimitPerBankSz") << ")" << endl;
+        cout << "ShoreBrkSz      : " << fnGetValue("ShoreBrkSz") << " (" << fnGetRawValue("ShoreBrkSz") << ")" << endl;
+        cout << "DefBattTemp      : " << fnGetValue("DefBattTemp") << " (" << fnGetRawValue("DefBattTemp") << ")" << endl;
+        cout << "ReChgVolt      : " << fnGetValue("ReChgVolt") << " (" << fnGetRawValue("ReChgVolt") << ")" << endl;
+    }
+bool ChgCfgCmd2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgCmd2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "MaxChgIPer") {
+            return static_cast<uint32_t>(msg.ucMaxChgIPer);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+            return static_cast<uint32_t>(msg.ucChgRateLimitPerBankSz);
+        }
+        else if (mnem == "ShoreBrkSz") {
+            return static_cast<uint32_t>(msg.ucShoreBrkSz);
+        }
+        else if (mnem == "DefBattTemp") {
+            return static_cast<uint32_t>(msg.ucDefBattTemp);
+        }
+        else if (mnem == "ReChgVolt") {
+            return static_cast<uint32_t>(msg.uiReChgVolt);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgCmd2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "MaxChgIPer") {
+     msg.ucMaxChgIPer = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+     msg.ucChgRateLimitPerBankSz = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "ShoreBrkSz") {
+     msg.ucShoreBrkSz = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "DefBattTemp") {
+     msg.ucDefBattTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "ReChgVolt") {
+     msg.uiReChgVolt = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void ChgCfgCmd2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgCmd2::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnDefBattTemp2Cmd") return fnDefBattTemp2Cmd(param_value);
+ return "";     };
+long double ChgCfgCmd2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "MaxChgIPer") {
+            return 0.5 * (long double)(msg.ucMaxChgIPer + 0.0);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+            return 0.5 * (long double)(msg.ucChgRateLimitPerBankSz + 0.0);
+        }
+        else if (mnem == "ShoreBrkSz") {
+            return 1.0 * (long double)(msg.ucShoreBrkSz + 0.0);
+        }
+        else if (mnem == "DefBattTemp") {
+            return 1.0 * (long double)(msg.ucDefBattTemp + -40.0);
+        }
+        else if (mnem == "ReChgVolt") {
+            return 0.05000000074505806 * (long double)(msg.uiReChgVolt + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgSts2
+std::string ChgCfgSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "MaxChgIPer") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucMaxChgIPer + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucMaxChgIPer == 0xff) ? "No Data" : (msg.ucMaxChgIPer == 0xfe) ? "Out of range" : (msg.ucMaxChgIPer == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucChgRateLimitPerBankSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucChgRateLimitPerBankSz == 0xff) ? "No Data" : (msg.ucChgRateLimitPerBankSz == 0xfe) ? "Out of range" : (msg.ucChgRateLimitPerBankSz == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ShoreBrkSz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucShoreBrkSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucShoreBrkSz == 0xff) ? "No Data" : (msg.ucShoreBrkSz == 0xfe) ? "Out of range" : (msg.ucShoreBrkSz == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DefBattTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucDefBattTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucDefBattTemp == 0xff) ? "No Data" : (msg.ucDefBattTemp == 0xfe) ? "Out of range" : (msg.ucDefBattTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ReChgVolt") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiReChgVolt + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiReChgVolt == 0xffff) ? "No Data" : (msg.uiReChgVolt == 0xfffe) ? "Out of range" : (msg.uiReChgVolt == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgCfgSts2::Print() const {
+        std::cout << "PGN: ChgCfgSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "MaxChgIPer      : " << fnGetValue("MaxChgIPer") << " (" << fnGetRawValue("MaxChgIPer") << ")" << endl;
+        cout << "ChgRateLimitPerBankSz      : " << fnGetValue("ChgRateLimitPerBankSz") << " (" << fnGetRawValue("ChgRateLimitPerBankSz") << ")" << endl;
+        cout << "ShoreBrkSz      : " << fnGetValue("ShoreBrkSz") << " (" << fnGetRawValue("ShoreBrkSz") << ")" << endl;
+        cout << "DefBattTemp      : " << fnGetValue("DefBattTemp") << " (" << fnGetRawValue("DefBattTemp") << ")" << endl;
+        cout << "ReChgVolt      : " << fnGetValue("ReChgVolt") << " (" << fnGetRawValue("ReChgVolt") << ")" << endl;
+    }
+bool ChgCfgSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "MaxChgIPer") {
+            return static_cast<uint32_t>(msg.ucMaxChgIPer);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+            return static_cast<uint32_t>(msg.ucChgRateLimitPerBankSz);
+        }
+        else if (mnem == "ShoreBrkSz") {
+            return static_cast<uint32_t>(msg.ucShoreBrkSz);
+        }
+        else if (mnem == "DefBattTemp") {
+            return static_cast<uint32_t>(msg.ucDefBattTemp);
+        }
+        else if (mnem == "ReChgVolt") {
+            return static_cast<uint32_t>(msg.uiReChgVolt);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "MaxChgIPer") {
+     msg.ucMaxChgIPer = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+     msg.ucChgRateLimitPerBankSz = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "ShoreBrkSz") {
+     msg.ucShoreBrkSz = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "DefBattTemp") {
+     msg.ucDefBattTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "ReChgVolt") {
+     msg.uiReChgVolt = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void ChgCfgSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgSts2::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnSts2DefBattTemp") return fnSts2DefBattTemp(param_value);
+ return "";     };
+long double ChgCfgSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "MaxChgIPer") {
+            return 0.5 * (long double)(msg.ucMaxChgIPer + 0.0);
+        }
+        else if (mnem == "ChgRateLimitPerBankSz") {
+            return 0.5 * (long double)(msg.ucChgRateLimitPerBankSz + 0.0);
+        }
+        else if (mnem == "ShoreBrkSz") {
+            return 1.0 * (long double)(msg.ucShoreBrkSz + 0.0);
+        }
+        else if (mnem == "DefBattTemp") {
+            return 1.0 * (long double)(msg.ucDefBattTemp + -40.0);
+        }
+        else if (mnem == "ReChgVolt") {
+            return 0.05000000074505806 * (long double)(msg.uiReChgVolt + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgEqlzCfgCmd
+std::string ChgEqlzCfgCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiEqlzV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiEqlzV == 0xffff) ? "No Data" : (msg.uiEqlzV == 0xfffe) ? "Out of range" : (msg.uiEqlzV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EqlzTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiEqlzTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiEqlzTime == 0xffff) ? "No Data" : (msg.uiEqlzTime == 0xfffe) ? "Out of range" : (msg.uiEqlzTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgEqlzCfgCmd::Print() const {
+        std::cout << "PGN: ChgEqlzCfgCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "EqlzV      : " << fnGetValue("EqlzV") << " (" << fnGetRawValue("EqlzV") << ")" << endl;
+        cout << "EqlzTime      : " << fnGetValue("EqlzTime") << " (" << fnGetRawValue("EqlzTime") << ")" << endl;
+    }
+bool ChgEqlzCfgCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgEqlzCfgCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            return static_cast<uint32_t>(msg.uiEqlzV);
+        }
+        else if (mnem == "EqlzTime") {
+            return static_cast<uint32_t>(msg.uiEqlzTime);
+        }
+        return UINT32_MAX;
+    }
+void ChgEqlzCfgCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "EqlzV") {
+     msg.uiEqlzV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+     msg.uiEqlzTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void ChgEqlzCfgCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgEqlzCfgCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgEqlzCfgCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "EqlzV") {
+            return 0.05000000074505806 * (long double)(msg.uiEqlzV + 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+            return 1.0 * (long double)(msg.uiEqlzTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgEqlzCfgSts
+std::string ChgEqlzCfgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiEqlzV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiEqlzV == 0xffff) ? "No Data" : (msg.uiEqlzV == 0xfffe) ? "Out of range" : (msg.uiEqlzV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EqlzTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiEqlzTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiEqlzTime == 0xffff) ? "No Data" : (msg.uiEqlzTime == 0xfffe) ? "Out of range" : (msg.uiEqlzTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgEqlzCfgSts::Print() const {
+        std::cout << "PGN: ChgEqlzCfgSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "EqlzV      : " << fnGetValue("EqlzV") << " (" << fnGetRawValue("EqlzV") << ")" << endl;
+        cout << "EqlzTime      : " << fnGetValue("EqlzTime") << " (" << fnGetRawValue("EqlzTime") << ")" << endl;
+    }
+bool ChgEqlzCfgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgEqlzCfgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            return static_cast<uint32_t>(msg.uiEqlzV);
+        }
+        else if (mnem == "EqlzTime") {
+            return static_cast<uint32_t>(msg.uiEqlzTime);
+        }
+        return UINT32_MAX;
+    }
+void ChgEqlzCfgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "EqlzV") {
+     msg.uiEqlzV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+     msg.uiEqlzTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void ChgEqlzCfgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgEqlzCfgSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgEqlzCfgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "EqlzV") {
+            return 0.05000000074505806 * (long double)(msg.uiEqlzV + 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+            return 1.0 * (long double)(msg.uiEqlzTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgEqlzSts
+std::string ChgEqlzSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "TimeRem") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiTimeRem + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiTimeRem == 0xffff) ? "No Data" : (msg.uiTimeRem == 0xfffe) ? "Out of range" : (msg.uiTimeRem == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "PreChgSts") {
+            if (!ENUMLOOKUP_1484268128.fnContains(msg.tePreChgSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePreChgSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484268128.fnText(msg.tePreChgSts));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgEqlzSts::Print() const {
+        std::cout << "PGN: ChgEqlzSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "TimeRem      : " << fnGetValue("TimeRem") << " (" << fnGetRawValue("TimeRem") << ")" << endl;
+        cout << "PreChgSts      : " << fnGetValue("PreChgSts") << " (" << fnGetRawValue("PreChgSts") << ")" << endl;
+    }
+bool ChgEqlzSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgEqlzSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "TimeRem") {
+            return static_cast<uint32_t>(msg.uiTimeRem);
+        }
+        else if (mnem == "PreChgSts") {
+            return static_cast<uint32_t>(msg.tePreChgSts);
+        }
+        return UINT32_MAX;
+    }
+void ChgEqlzSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TimeRem") {
+     msg.uiTimeRem = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "PreChgSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484268128, value);
+     if (enumValue != -1) msg.tePreChgSts = static_cast<decltype(msg.tePreChgSts)>(enumValue);
+     else msg.tePreChgSts = static_cast<decltype(msg.tePreChgSts)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgEqlzSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgEqlzSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgEqlzSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "TimeRem") {
+            return 1.0 * (long double)(msg.uiTimeRem + 0.0);
+        }
+        else if (mnem == "PreChgSts") {
+            return 1.0 * (long double)(msg.tePreChgSts + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgStatsSts
+std::string ChgStatsSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else return "no pgn";
+    }
+void ChgStatsSts::Print() const {
+        std::cout << "PGN: ChgStatsSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+    }
+bool ChgStatsSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgStatsSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        return UINT32_MAX;
+    }
+void ChgStatsSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void ChgStatsSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgStatsSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgStatsSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgCmd1
+std::string ChgCfgCmd1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            if (!ENUMLOOKUP_9408.fnContains(msg.teChgAlg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgAlg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9408.fnText(msg.teChgAlg));
+              }
+        }
+        else if (mnem == "ChgMode") {
+            if (!ENUMLOOKUP_9409.fnContains(msg.teChgMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9409.fnText(msg.teChgMode));
+              }
+        }
+        else if (mnem == "BattSensPres") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBattSensPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattSensPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBattSensPres));
+              }
+        }
+        else if (mnem == "ChgInstLine") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teChgInstLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgInstLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teChgInstLine));
+              }
+        }
+        else if (mnem == "BattBankSz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBattBankSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiBattBankSz == 0xffff) ? "No Data" : (msg.uiBattBankSz == 0xfffe) ? "Out of range" : (msg.uiBattBankSz == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattType") {
+            if (!ENUMLOOKUP_9410.fnContains(msg.teBattType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9410.fnText(msg.teBattType));
+              }
+        }
+        else if (mnem == "MaxChgI") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucMaxChgI + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucMaxChgI == 0xff) ? "No Data" : (msg.ucMaxChgI == 0xfe) ? "Out of range" : (msg.ucMaxChgI == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgCfgCmd1::Print() const {
+        std::cout << "PGN: ChgCfgCmd1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgAlg      : " << fnGetValue("ChgAlg") << " (" << fnGetRawValue("ChgAlg") << ")" << endl;
+        cout << "ChgMode      : " << fnGetValue("ChgMode") << " (" << fnGetRawValue("ChgMode") << ")" << endl;
+        cout << "BattSensPres      : " << fnGetValue("BattSensPres") << " (" << fnGetRawValue("BattSensPres") << ")" << endl;
+        cout << "ChgInstLine      : " << fnGetValue("ChgInstLine") << " (" << fnGetRawValue("ChgInstLine") << ")" << endl;
+        cout << "BattBankSz      : " << fnGetValue("BattBankSz") << " (" << fnGetRawValue("BattBankSz") << ")" << endl;
+        cout << "BattType      : " << fnGetValue("BattType") << " (" << fnGetRawValue("BattType") << ")" << endl;
+        cout << "MaxChgI      : " << fnGetValue("MaxChgI") << " (" << fnGetRawValue("MaxChgI") << ")" << endl;
+    }
+bool ChgCfgCmd1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgCmd1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            return static_cast<uint32_t>(msg.teChgAlg);
+        }
+        else if (mnem == "ChgMode") {
+            return static_cast<uint32_t>(msg.teChgMode);
+        }
+        else if (mnem == "BattSensPres") {
+            return static_cast<uint32_t>(msg.teBattSensPres);
+        }
+        else if (mnem == "ChgInstLine") {
+            return static_cast<uint32_t>(msg.teChgInstLine);
+        }
+        else if (mnem == "BattBankSz") {
+            return static_cast<uint32_t>(msg.uiBattBankSz);
+        }
+        else if (mnem == "BattType") {
+            return static_cast<uint32_t>(msg.teBattType);
+        }
+        else if (mnem == "MaxChgI") {
+            return static_cast<uint32_t>(msg.ucMaxChgI);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgCmd1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ChgAlg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9408, value);
+     if (enumValue != -1) msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(enumValue);
+     else msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9409, value);
+     if (enumValue != -1) msg.teChgMode = static_cast<decltype(msg.teChgMode)>(enumValue);
+     else msg.teChgMode = static_cast<decltype(msg.teChgMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattSensPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(enumValue);
+     else msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgInstLine") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teChgInstLine = static_cast<decltype(msg.teChgInstLine)>(enumValue);
+     else msg.teChgInstLine = static_cast<decltype(msg.teChgInstLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattBankSz") {
+     msg.uiBattBankSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "BattType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9410, value);
+     if (enumValue != -1) msg.teBattType = static_cast<decltype(msg.teBattType)>(enumValue);
+     else msg.teBattType = static_cast<decltype(msg.teBattType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "MaxChgI") {
+     msg.ucMaxChgI = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void ChgCfgCmd1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgCmd1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgCfgCmd1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgAlg") {
+            return 1.0 * (long double)(msg.teChgAlg + 0.0);
+        }
+        else if (mnem == "ChgMode") {
+            return 1.0 * (long double)(msg.teChgMode + 0.0);
+        }
+        else if (mnem == "BattSensPres") {
+            return 1.0 * (long double)(msg.teBattSensPres + 0.0);
+        }
+        else if (mnem == "ChgInstLine") {
+            return 1.0 * (long double)(msg.teChgInstLine + 0.0);
+        }
+        else if (mnem == "BattBankSz") {
+            return 1.0 * (long double)(msg.uiBattBankSz + 0.0);
+        }
+        else if (mnem == "BattType") {
+            return 1.0 * (long double)(msg.teBattType + 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+            return 1.0 * (long double)(msg.ucMaxChgI + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCmd
+std::string ChgCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Sts") {
+            if (!ENUMLOOKUP_9411.fnContains(msg.teSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9411.fnText(msg.teSts));
+              }
+        }
+        else if (mnem == "DfltStatePwrUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teDfltStatePwrUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDfltStatePwrUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teDfltStatePwrUp));
+              }
+        }
+        else if (mnem == "AutoReChgEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teAutoReChgEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAutoReChgEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teAutoReChgEn));
+              }
+        }
+        else if (mnem == "ForceChg") {
+            if (!ENUMLOOKUP_1484358105.fnContains(msg.teForceChg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teForceChg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484358105.fnText(msg.teForceChg));
+              }
+        }
+        else if (mnem == "CtrlVCCCV") {
+            return (msg.uiCtrlVCCCV == 0xffff) ? "No Data" : (msg.uiCtrlVCCCV == 0xfffe) ? "Out of range" : (msg.uiCtrlVCCCV == 0xfffd) ? "Reserved" : std::to_string(msg.uiCtrlVCCCV);
+        }
+        else if (mnem == "CtrlICCCV") {
+            return (msg.uiCtrlICCCV == 0xffff) ? "No Data" : (msg.uiCtrlICCCV == 0xfffe) ? "Out of range" : (msg.uiCtrlICCCV == 0xfffd) ? "Reserved" : std::to_string(msg.uiCtrlICCCV);
+        }
+        else return "no pgn";
+    }
+void ChgCmd::Print() const {
+        std::cout << "PGN: ChgCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Sts      : " << fnGetValue("Sts") << " (" << fnGetRawValue("Sts") << ")" << endl;
+        cout << "DfltStatePwrUp      : " << fnGetValue("DfltStatePwrUp") << " (" << fnGetRawValue("DfltStatePwrUp") << ")" << endl;
+        cout << "AutoReChgEn      : " << fnGetValue("AutoReChgEn") << " (" << fnGetRawValue("AutoReChgEn") << ")" << endl;
+        cout << "ForceChg      : " << fnGetValue("ForceChg") << " (" << fnGetRawValue("ForceChg") << ")" << endl;
+        cout << "CtrlVCCCV      : " << fnGetValue("CtrlVCCCV") << " (" << fnGetRawValue("CtrlVCCCV") << ")" << endl;
+        cout << "CtrlICCCV      : " << fnGetValue("CtrlICCCV") << " (" << fnGetRawValue("CtrlICCCV") << ")" << endl;
+    }
+bool ChgCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Sts") {
+            return static_cast<uint32_t>(msg.teSts);
+        }
+        else if (mnem == "DfltStatePwrUp") {
+            return static_cast<uint32_t>(msg.teDfltStatePwrUp);
+        }
+        else if (mnem == "AutoReChgEn") {
+            return static_cast<uint32_t>(msg.teAutoReChgEn);
+        }
+        else if (mnem == "ForceChg") {
+            return static_cast<uint32_t>(msg.teForceChg);
+        }
+        else if (mnem == "CtrlVCCCV") {
+            return static_cast<uint32_t>(msg.uiCtrlVCCCV);
+        }
+        else if (mnem == "CtrlICCCV") {
+            return static_cast<uint32_t>(msg.uiCtrlICCCV);
+        }
+        return UINT32_MAX;
+    }
+void ChgCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Sts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9411, value);
+     if (enumValue != -1) msg.teSts = static_cast<decltype(msg.teSts)>(enumValue);
+     else msg.teSts = static_cast<decltype(msg.teSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DfltStatePwrUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teDfltStatePwrUp = static_cast<decltype(msg.teDfltStatePwrUp)>(enumValue);
+     else msg.teDfltStatePwrUp = static_cast<decltype(msg.teDfltStatePwrUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AutoReChgEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teAutoReChgEn = static_cast<decltype(msg.teAutoReChgEn)>(enumValue);
+     else msg.teAutoReChgEn = static_cast<decltype(msg.teAutoReChgEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ForceChg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484358105, value);
+     if (enumValue != -1) msg.teForceChg = static_cast<decltype(msg.teForceChg)>(enumValue);
+     else msg.teForceChg = static_cast<decltype(msg.teForceChg)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CtrlVCCCV") {
+     msg.uiCtrlVCCCV = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "CtrlICCCV") {
+     msg.uiCtrlICCCV = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void ChgCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCmd::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnChgEn2ChgCmdSts") return fnChgEn2ChgCmdSts(param_value);
+        if (func == "fnStartEqlz2ChgCmdSts") return fnStartEqlz2ChgCmdSts(param_value);
+ return "";     };
+long double ChgCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Sts") {
+            return 1.0 * (long double)(msg.teSts + 0.0);
+        }
+        else if (mnem == "DfltStatePwrUp") {
+            return 1.0 * (long double)(msg.teDfltStatePwrUp + 0.0);
+        }
+        else if (mnem == "AutoReChgEn") {
+            return 1.0 * (long double)(msg.teAutoReChgEn + 0.0);
+        }
+        else if (mnem == "ForceChg") {
+            return 1.0 * (long double)(msg.teForceChg + 0.0);
+        }
+        else if (mnem == "CtrlVCCCV") {
+            return 1.0 * (long double)(msg.uiCtrlVCCCV + 0.0);
+        }
+        else if (mnem == "CtrlICCCV") {
+            return 1.0 * (long double)(msg.uiCtrlICCCV + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgCfgSts1
+std::string ChgCfgSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            if (!ENUMLOOKUP_9408.fnContains(msg.teChgAlg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgAlg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9408.fnText(msg.teChgAlg));
+              }
+        }
+        else if (mnem == "ChgMode") {
+            if (!ENUMLOOKUP_9409.fnContains(msg.teChgMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9409.fnText(msg.teChgMode));
+              }
+        }
+        else if (mnem == "BattSensPres") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBattSensPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattSensPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBattSensPres));
+              }
+        }
+        else if (mnem == "ChgInstLine") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teChgInstLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgInstLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teChgInstLine));
+              }
+        }
+        else if (mnem == "BattType") {
+            if (!ENUMLOOKUP_9410.fnContains(msg.teBattType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9410.fnText(msg.teBattType));
+              }
+        }
+        else if (mnem == "BattBankSz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBattBankSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiBattBankSz == 0xffff) ? "No Data" : (msg.uiBattBankSz == 0xfffe) ? "Out of range" : (msg.uiBattBankSz == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "MaxChgI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiMaxChgI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiMaxChgI == 0xffff) ? "No Data" : (msg.uiMaxChgI == 0xfffe) ? "Out of range" : (msg.uiMaxChgI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgCfgSts1::Print() const {
+        std::cout << "PGN: ChgCfgSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgAlg      : " << fnGetValue("ChgAlg") << " (" << fnGetRawValue("ChgAlg") << ")" << endl;
+        cout << "ChgMode      : " << fnGetValue("ChgMode") << " (" << fnGetRawValue("ChgMode") << ")" << endl;
+        cout << "BattSensPres      : " << fnGetValue("BattSensPres") << " (" << fnGetRawValue("BattSensPres") << ")" << endl;
+        cout << "ChgInstLine      : " << fnGetValue("ChgInstLine") << " (" << fnGetRawValue("ChgInstLine") << ")" << endl;
+        cout << "BattType      : " << fnGetValue("BattType") << " (" << fnGetRawValue("BattType") << ")" << endl;
+        cout << "BattBankSz      : " << fnGetValue("BattBankSz") << " (" << fnGetRawValue("BattBankSz") << ")" << endl;
+        cout << "MaxChgI      : " << fnGetValue("MaxChgI") << " (" << fnGetRawValue("MaxChgI") << ")" << endl;
+    }
+bool ChgCfgSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgCfgSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            return static_cast<uint32_t>(msg.teChgAlg);
+        }
+        else if (mnem == "ChgMode") {
+            return static_cast<uint32_t>(msg.teChgMode);
+        }
+        else if (mnem == "BattSensPres") {
+            return static_cast<uint32_t>(msg.teBattSensPres);
+        }
+        else if (mnem == "ChgInstLine") {
+            return static_cast<uint32_t>(msg.teChgInstLine);
+        }
+        else if (mnem == "BattType") {
+            return static_cast<uint32_t>(msg.teBattType);
+        }
+        else if (mnem == "BattBankSz") {
+            return static_cast<uint32_t>(msg.uiBattBankSz);
+        }
+        else if (mnem == "MaxChgI") {
+            return static_cast<uint32_t>(msg.uiMaxChgI);
+        }
+        return UINT32_MAX;
+    }
+void ChgCfgSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ChgAlg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9408, value);
+     if (enumValue != -1) msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(enumValue);
+     else msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9409, value);
+     if (enumValue != -1) msg.teChgMode = static_cast<decltype(msg.teChgMode)>(enumValue);
+     else msg.teChgMode = static_cast<decltype(msg.teChgMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattSensPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(enumValue);
+     else msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgInstLine") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teChgInstLine = static_cast<decltype(msg.teChgInstLine)>(enumValue);
+     else msg.teChgInstLine = static_cast<decltype(msg.teChgInstLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9410, value);
+     if (enumValue != -1) msg.teBattType = static_cast<decltype(msg.teBattType)>(enumValue);
+     else msg.teBattType = static_cast<decltype(msg.teBattType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattBankSz") {
+     msg.uiBattBankSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+     msg.uiMaxChgI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+    }
+void ChgCfgSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgCfgSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgCfgSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgAlg") {
+            return 1.0 * (long double)(msg.teChgAlg + 0.0);
+        }
+        else if (mnem == "ChgMode") {
+            return 1.0 * (long double)(msg.teChgMode + 0.0);
+        }
+        else if (mnem == "BattSensPres") {
+            return 1.0 * (long double)(msg.teBattSensPres + 0.0);
+        }
+        else if (mnem == "ChgInstLine") {
+            return 1.0 * (long double)(msg.teChgInstLine + 0.0);
+        }
+        else if (mnem == "BattType") {
+            return 1.0 * (long double)(msg.teBattType + 0.0);
+        }
+        else if (mnem == "BattBankSz") {
+            return 1.0 * (long double)(msg.uiBattBankSz + 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+            return 0.05000000074505806 * (long double)(msg.uiMaxChgI + -32000.0);
+        }
+        return 0.0;
+    }
+
+// ChgSts
+std::string ChgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiChgV == 0xffff) ? "No Data" : (msg.uiChgV == 0xfffe) ? "Out of range" : (msg.uiChgV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiChgI == 0xffff) ? "No Data" : (msg.uiChgI == 0xfffe) ? "Out of range" : (msg.uiChgI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgIPerMax") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucChgIPerMax + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucChgIPerMax == 0xff) ? "No Data" : (msg.ucChgIPerMax == 0xfe) ? "Out of range" : (msg.ucChgIPerMax == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "OpState") {
+            if (!ENUMLOOKUP_9407.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9407.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "DefltStatePwrUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teDefltStatePwrUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDefltStatePwrUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teDefltStatePwrUp));
+              }
+        }
+        else if (mnem == "AutoReChgEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teAutoReChgEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAutoReChgEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teAutoReChgEn));
+              }
+        }
+        else if (mnem == "ForceChg") {
+            if (!ENUMLOOKUP_1484358105.fnContains(msg.teForceChg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teForceChg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484358105.fnText(msg.teForceChg));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgSts::Print() const {
+        std::cout << "PGN: ChgSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgV      : " << fnGetValue("ChgV") << " (" << fnGetRawValue("ChgV") << ")" << endl;
+        cout << "ChgI      : " << fnGetValue("ChgI") << " (" << fnGetRawValue("ChgI") << ")" << endl;
+        cout << "ChgIPerMax      : " << fnGetValue("ChgIPerMax") << " (" << fnGetRawValue("ChgIPerMax") << ")" << endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "DefltStatePwrUp      : " << fnGetValue("DefltStatePwrUp") << " (" << fnGetRawValue("DefltStatePwrUp") << ")" << endl;
+        cout << "AutoReChgEn      : " << fnGetValue("AutoReChgEn") << " (" << fnGetRawValue("AutoReChgEn") << ")" << endl;
+        cout << "ForceChg      : " << fnGetValue("ForceChg") << " (" << fnGetRawValue("ForceChg") << ")" << endl;
+    }
+bool ChgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgV") {
+            return static_cast<uint32_t>(msg.uiChgV);
+        }
+        else if (mnem == "ChgI") {
+            return static_cast<uint32_t>(msg.uiChgI);
+        }
+        else if (mnem == "ChgIPerMax") {
+            return static_cast<uint32_t>(msg.ucChgIPerMax);
+        }
+        else if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "DefltStatePwrUp") {
+            return static_cast<uint32_t>(msg.teDefltStatePwrUp);
+        }
+        else if (mnem == "AutoReChgEn") {
+            return static_cast<uint32_t>(msg.teAutoReChgEn);
+        }
+        else if (mnem == "ForceChg") {
+            return static_cast<uint32_t>(msg.teForceChg);
+        }
+        return UINT32_MAX;
+    }
+void ChgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ChgV") {
+     msg.uiChgV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "ChgI") {
+     msg.uiChgI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "ChgIPerMax") {
+     msg.ucChgIPerMax = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9407, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DefltStatePwrUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teDefltStatePwrUp = static_cast<decltype(msg.teDefltStatePwrUp)>(enumValue);
+     else msg.teDefltStatePwrUp = static_cast<decltype(msg.teDefltStatePwrUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AutoReChgEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teAutoReChgEn = static_cast<decltype(msg.teAutoReChgEn)>(enumValue);
+     else msg.teAutoReChgEn = static_cast<decltype(msg.teAutoReChgEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ForceChg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484358105, value);
+     if (enumValue != -1) msg.teForceChg = static_cast<decltype(msg.teForceChg)>(enumValue);
+     else msg.teForceChg = static_cast<decltype(msg.teForceChg)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgV") {
+            return 0.05000000074505806 * (long double)(msg.uiChgV + 0.0);
+        }
+        else if (mnem == "ChgI") {
+            return 0.05000000074505806 * (long double)(msg.uiChgI + -32000.0);
+        }
+        else if (mnem == "ChgIPerMax") {
+            return 0.5 * (long double)(msg.ucChgIPerMax + 0.0);
+        }
+        else if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "DefltStatePwrUp") {
+            return 1.0 * (long double)(msg.teDefltStatePwrUp + 0.0);
+        }
+        else if (mnem == "AutoReChgEn") {
+            return 1.0 * (long double)(msg.teAutoReChgEn + 0.0);
+        }
+        else if (mnem == "ForceChg") {
+            return 1.0 * (long double)(msg.teForceChg + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcSts3
+std::string ChgAcSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "Waveform") {
+            if (!ENUMLOOKUP_1484338823.fnContains(msg.teWaveform)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teWaveform);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484338823.fnText(msg.teWaveform));
+              }
+        }
+        else if (mnem == "PhsSts") {
+            if (!ENUMLOOKUP_9421.fnContains(msg.tePhsSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePhsSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9421.fnText(msg.tePhsSts));
+              }
+        }
+        else if (mnem == "RealPwr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiRealPwr + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiRealPwr == 0xffff) ? "No Data" : (msg.uiRealPwr == 0xfffe) ? "Out of range" : (msg.uiRealPwr == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ReactivePwr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiReactivePwr + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "VAR");
+            return (msg.uiReactivePwr == 0xffff) ? "No Data" : (msg.uiReactivePwr == 0xfffe) ? "Out of range" : (msg.uiReactivePwr == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HarmonicDist") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucHarmonicDist + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucHarmonicDist == 0xff) ? "No Data" : (msg.ucHarmonicDist == 0xfe) ? "Out of range" : (msg.ucHarmonicDist == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "CompLeg") {
+            return std::to_string(msg.ucCompLeg);
+        }
+        else return "no pgn";
+    }
+void ChgAcSts3::Print() const {
+        std::cout << "PGN: ChgAcSts3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "Waveform      : " << fnGetValue("Waveform") << " (" << fnGetRawValue("Waveform") << ")" << endl;
+        cout << "PhsSts      : " << fnGetValue("PhsSts") << " (" << fnGetRawValue("PhsSts") << ")" << endl;
+        cout << "RealPwr      : " << fnGetValue("RealPwr") << " (" << fnGetRawValue("RealPwr") << ")" << endl;
+        cout << "ReactivePwr      : " << fnGetValue("ReactivePwr") << " (" << fnGetRawValue("ReactivePwr") << ")" << endl;
+        cout << "HarmonicDist      : " << fnGetValue("HarmonicDist") << " (" << fnGetRawValue("HarmonicDist") << ")" << endl;
+        cout << "CompLeg      : " << fnGetValue("CompLeg") << " (" << fnGetRawValue("CompLeg") << ")" << endl;
+    }
+bool ChgAcSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "Waveform") {
+            return static_cast<uint32_t>(msg.teWaveform);
+        }
+        else if (mnem == "PhsSts") {
+            return static_cast<uint32_t>(msg.tePhsSts);
+        }
+        else if (mnem == "RealPwr") {
+            return static_cast<uint32_t>(msg.uiRealPwr);
+        }
+        else if (mnem == "ReactivePwr") {
+            return static_cast<uint32_t>(msg.uiReactivePwr);
+        }
+        else if (mnem == "HarmonicDist") {
+            return static_cast<uint32_t>(msg.ucHarmonicDist);
+        }
+        else if (mnem == "CompLeg") {
+            return static_cast<uint32_t>(msg.ucCompLeg);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Waveform") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484338823, value);
+     if (enumValue != -1) msg.teWaveform = static_cast<decltype(msg.teWaveform)>(enumValue);
+     else msg.teWaveform = static_cast<decltype(msg.teWaveform)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PhsSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9421, value);
+     if (enumValue != -1) msg.tePhsSts = static_cast<decltype(msg.tePhsSts)>(enumValue);
+     else msg.tePhsSts = static_cast<decltype(msg.tePhsSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RealPwr") {
+     msg.uiRealPwr = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "ReactivePwr") {
+     msg.uiReactivePwr = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, -32000.0);
+        }
+        else if (mnem == "HarmonicDist") {
+     msg.ucHarmonicDist = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "CompLeg") {
+     msg.ucCompLeg = stringToInt(value, 0, 0, 0);
+        }
+    }
+void ChgAcSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "Waveform") {
+            return 1.0 * (long double)(msg.teWaveform + 0.0);
+        }
+        else if (mnem == "PhsSts") {
+            return 1.0 * (long double)(msg.tePhsSts + 0.0);
+        }
+        else if (mnem == "RealPwr") {
+            return 1.0 * (long double)(msg.uiRealPwr + 0.0);
+        }
+        else if (mnem == "ReactivePwr") {
+            return 1.0 * (long double)(msg.uiReactivePwr + -32000.0);
+        }
+        else if (mnem == "HarmonicDist") {
+            return 0.5 * (long double)(msg.ucHarmonicDist + 0.0);
+        }
+        else if (mnem == "CompLeg") {
+            return 1.0 * (long double)(msg.ucCompLeg + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcSts2
+std::string ChgAcSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "PkV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiPkV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiPkV == 0xffff) ? "No Data" : (msg.uiPkV == 0xfffe) ? "Out of range" : (msg.uiPkV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "PkI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiPkI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiPkI == 0xffff) ? "No Data" : (msg.uiPkI == 0xfffe) ? "Out of range" : (msg.uiPkI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GndI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiGndI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiGndI == 0xffff) ? "No Data" : (msg.uiGndI == 0xfffe) ? "Out of range" : (msg.uiGndI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Cap") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucCap + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucCap == 0xff) ? "No Data" : (msg.ucCap == 0xfe) ? "Out of range" : (msg.ucCap == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ChgAcSts2::Print() const {
+        std::cout << "PGN: ChgAcSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "PkV      : " << fnGetValue("PkV") << " (" << fnGetRawValue("PkV") << ")" << endl;
+        cout << "PkI      : " << fnGetValue("PkI") << " (" << fnGetRawValue("PkI") << ")" << endl;
+        cout << "GndI      : " << fnGetValue("GndI") << " (" << fnGetRawValue("GndI") << ")" << endl;
+        cout << "Cap      : " << fnGetValue("Cap") << " (" << fnGetRawValue("Cap") << ")" << endl;
+    }
+bool ChgAcSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "PkV") {
+            return static_cast<uint32_t>(msg.uiPkV);
+        }
+        else if (mnem == "PkI") {
+            return static_cast<uint32_t>(msg.uiPkI);
+        }
+        else if (mnem == "GndI") {
+            return static_cast<uint32_t>(msg.uiGndI);
+        }
+        else if (mnem == "Cap") {
+            return static_cast<uint32_t>(msg.ucCap);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PkV") {
+     msg.uiPkV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "PkI") {
+     msg.uiPkI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "GndI") {
+     msg.uiGndI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Cap") {
+     msg.ucCap = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void ChgAcSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "PkV") {
+            return 0.05000000074505806 * (long double)(msg.uiPkV + 0.0);
+        }
+        else if (mnem == "PkI") {
+            return 0.05000000074505806 * (long double)(msg.uiPkI + -32000.0);
+        }
+        else if (mnem == "GndI") {
+            return 0.05000000074505806 * (long double)(msg.uiGndI + -32000.0);
+        }
+        else if (mnem == "Cap") {
+            return 1.0 * (long double)(msg.ucCap + 0.0);
+        }
+        return 0.0;
+    }
+
+// ChgAcSts1
+std::string ChgAcSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "RmsV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRmsV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiRmsV == 0xffff) ? "No Data" : (msg.uiRmsV == 0xfffe) ? "Out of range" : (msg.uiRmsV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "RmsI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRmsI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiRmsI == 0xffff) ? "No Data" : (msg.uiRmsI == 0xfffe) ? "Out of range" : (msg.uiRmsI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Freq") {
+            char buffer[50];
+            auto engval = 0.0078125 * (long double) (msg.uiFreq + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "Hz");
+            return (msg.uiFreq == 0xffff) ? "No Data" : (msg.uiFreq == 0xfffe) ? "Out of range" : (msg.uiFreq == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FltOpnGnd") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltOpnGnd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltOpnGnd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltOpnGnd));
+              }
+        }
+        else if (mnem == "FltOpnNeutral") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltOpnNeutral)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltOpnNeutral);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltOpnNeutral));
+              }
+        }
+        else if (mnem == "FltRevPolarity") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltRevPolarity)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltRevPolarity);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltRevPolarity));
+              }
+        }
+        else if (mnem == "FltGndFlt") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltGndFlt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltGndFlt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltGndFlt));
+              }
+        }
+        else return "no pgn";
+    }
+void ChgAcSts1::Print() const {
+        std::cout << "PGN: ChgAcSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "RmsV      : " << fnGetValue("RmsV") << " (" << fnGetRawValue("RmsV") << ")" << endl;
+        cout << "RmsI      : " << fnGetValue("RmsI") << " (" << fnGetRawValue("RmsI") << ")" << endl;
+        cout << "Freq      : " << fnGetValue("Freq") << " (" << fnGetRawValue("Freq") << ")" << endl;
+        cout << "FltOpnGnd      : " << fnGetValue("FltOpnGnd") << " (" << fnGetRawValue("FltOpnGnd") << ")" << endl;
+        cout << "FltOpnNeutral      : " << fnGetValue("FltOpnNeutral") << " (" << fnGetRawValue("FltOpnNeutral") << ")" << endl;
+        cout << "FltRevPolarity      : " << fnGetValue("FltRevPolarity") << " (" << fnGetRawValue("FltRevPolarity") << ")" << endl;
+        cout << "FltGndFlt      : " << fnGetValue("FltGndFlt") << " (" << fnGetRawValue("FltGndFlt") << ")" << endl;
+    }
+bool ChgAcSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ChgAcSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "RmsV") {
+            return static_cast<uint32_t>(msg.uiRmsV);
+        }
+        else if (mnem == "RmsI") {
+            return static_cast<uint32_t>(msg.uiRmsI);
+        }
+        else if (mnem == "Freq") {
+            return static_cast<uint32_t>(msg.uiFreq);
+        }
+        else if (mnem == "FltOpnGnd") {
+            return static_cast<uint32_t>(msg.teFltOpnGnd);
+        }
+        else if (mnem == "FltOpnNeutral") {
+            return static_cast<uint32_t>(msg.teFltOpnNeutral);
+        }
+        else if (mnem == "FltRevPolarity") {
+            return static_cast<uint32_t>(msg.teFltRevPolarity);
+        }
+        else if (mnem == "FltGndFlt") {
+            return static_cast<uint32_t>(msg.teFltGndFlt);
+        }
+        return UINT32_MAX;
+    }
+void ChgAcSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RmsV") {
+     msg.uiRmsV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "RmsI") {
+     msg.uiRmsI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Freq") {
+     msg.uiFreq = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.0078125, 0.0);
+        }
+        else if (mnem == "FltOpnGnd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltOpnGnd = static_cast<decltype(msg.teFltOpnGnd)>(enumValue);
+     else msg.teFltOpnGnd = static_cast<decltype(msg.teFltOpnGnd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltOpnNeutral") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltOpnNeutral = static_cast<decltype(msg.teFltOpnNeutral)>(enumValue);
+     else msg.teFltOpnNeutral = static_cast<decltype(msg.teFltOpnNeutral)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltRevPolarity") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltRevPolarity = static_cast<decltype(msg.teFltRevPolarity)>(enumValue);
+     else msg.teFltRevPolarity = static_cast<decltype(msg.teFltRevPolarity)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltGndFlt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltGndFlt = static_cast<decltype(msg.teFltGndFlt)>(enumValue);
+     else msg.teFltGndFlt = static_cast<decltype(msg.teFltGndFlt)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void ChgAcSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ChgAcSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ChgAcSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "RmsV") {
+            return 0.05000000074505806 * (long double)(msg.uiRmsV + 0.0);
+        }
+        else if (mnem == "RmsI") {
+            return 0.05000000074505806 * (long double)(msg.uiRmsI + -32000.0);
+        }
+        else if (mnem == "Freq") {
+            return 0.0078125 * (long double)(msg.uiFreq + 0.0);
+        }
+        else if (mnem == "FltOpnGnd") {
+            return 1.0 * (long double)(msg.teFltOpnGnd + 0.0);
+        }
+        else if (mnem == "FltOpnNeutral") {
+            return 1.0 * (long double)(msg.teFltOpnNeutral + 0.0);
+        }
+        else if (mnem == "FltRevPolarity") {
+            return 1.0 * (long double)(msg.teFltRevPolarity + 0.0);
+        }
+        else if (mnem == "FltGndFlt") {
+            return 1.0 * (long double)(msg.teFltGndFlt + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_chg_registrars[] = {
+{"ChgSts3", [](void * rcv) { return std::make_unique<ChgSts3>(rcv); }, []() { return std::make_unique<ChgSts3>(); } },
+{"ChgSts2", [](void * rcv) { return std::make_unique<ChgSts2>(rcv); }, []() { return std::make_unique<ChgSts2>(); } },
+{"ChgCfgCmd4", [](void * rcv) { return std::make_unique<ChgCfgCmd4>(rcv); }, []() { return std::make_unique<ChgCfgCmd4>(); } },
+{"ChgCfgSts4", [](void * rcv) { return std::make_unique<ChgCfgSts4>(rcv); }, []() { return std::make_unique<ChgCfgSts4>(); } },
+{"ChgCfgCmd3", [](void * rcv) { return std::make_unique<ChgCfgCmd3>(rcv); }, []() { return std::make_unique<ChgCfgCmd3>(); } },
+{"ChgCfgSts3", [](void * rcv) { return std::make_unique<ChgCfgSts3>(rcv); }, []() { return std::make_unique<ChgCfgSts3>(); } },
+{"ChgAcFltCfgCmd2", [](void * rcv) { return std::make_unique<ChgAcFltCfgCmd2>(rcv); }, []() { return std::make_unique<ChgAcFltCfgCmd2>(); } },
+{"ChgAcFltCfgCmd1", [](void * rcv) { return std::make_unique<ChgAcFltCfgCmd1>(rcv); }, []() { return std::make_unique<ChgAcFltCfgCmd1>(); } },
+{"ChgAcFltCfgSts2", [](void * rcv) { return std::make_unique<ChgAcFltCfgSts2>(rcv); }, []() { return std::make_unique<ChgAcFltCfgSts2>(); } },
+{"ChgAcFltCfgSts1", [](void * rcv) { return std::make_unique<ChgAcFltCfgSts1>(rcv); }, []() { return std::make_unique<ChgAcFltCfgSts1>(); } },
+{"ChgAcSts4", [](void * rcv) { return std::make_unique<ChgAcSts4>(rcv); }, []() { return std::make_unique<ChgAcSts4>(); } },
+{"ChgCfgCmd2", [](void * rcv) { return std::make_unique<ChgCfgCmd2>(rcv); }, []() { return std::make_unique<ChgCfgCmd2>(); } },
+{"ChgCfgSts2", [](void * rcv) { return std::make_unique<ChgCfgSts2>(rcv); }, []() { return std::make_unique<ChgCfgSts2>(); } },
+{"ChgEqlzCfgCmd", [](void * rcv) { return std::make_unique<ChgEqlzCfgCmd>(rcv); }, []() { return std::make_unique<ChgEqlzCfgCmd>(); } },
+{"ChgEqlzCfgSts", [](void * rcv) { return std::make_unique<ChgEqlzCfgSts>(rcv); }, []() { return std::make_unique<ChgEqlzCfgSts>(); } },
+{"ChgEqlzSts", [](void * rcv) { return std::make_unique<ChgEqlzSts>(rcv); }, []() { return std::make_unique<ChgEqlzSts>(); } },
+{"ChgStatsSts", [](void * rcv) { return std::make_unique<ChgStatsSts>(rcv); }, []() { return std::make_unique<ChgStatsSts>(); } },
+{"ChgCfgCmd1", [](void * rcv) { return std::make_unique<ChgCfgCmd1>(rcv); }, []() { return std::make_unique<ChgCfgCmd1>(); } },
+{"ChgCmd", [](void * rcv) { return std::make_unique<ChgCmd>(rcv); }, []() { return std::make_unique<ChgCmd>(); } },
+{"ChgCfgSts1", [](void * rcv) { return std::make_unique<ChgCfgSts1>(rcv); }, []() { return std::make_unique<ChgCfgSts1>(); } },
+{"ChgSts", [](void * rcv) { return std::make_unique<ChgSts>(rcv); }, []() { return std::make_unique<ChgSts>(); } },
+{"ChgAcSts3", [](void * rcv) { return std::make_unique<ChgAcSts3>(rcv); }, []() { return std::make_unique<ChgAcSts3>(); } },
+{"ChgAcSts2", [](void * rcv) { return std::make_unique<ChgAcSts2>(rcv); }, []() { return std::make_unique<ChgAcSts2>(); } },
+{"ChgAcSts1", [](void * rcv) { return std::make_unique<ChgAcSts1>(rcv); }, []() { return std::make_unique<ChgAcSts1>(); } },
+};
+static const PrinterRegistrar pgn_chg_printers[] = {
+{130506, -1, fnPrintMessage<ChgSts3>},
+{130723, -1, fnPrintMessage<ChgSts2>},
+{130750, -1, fnPrintMessage<ChgCfgCmd4>},
+{130751, -1, fnPrintMessage<ChgCfgSts4>},
+{130763, -1, fnPrintMessage<ChgCfgCmd3>},
+{130764, -1, fnPrintMessage<ChgCfgSts3>},
+{130950, -1, fnPrintMessage<ChgAcFltCfgCmd2>},
+{130951, -1, fnPrintMessage<ChgAcFltCfgCmd1>},
+{130952, -1, fnPrintMessage<ChgAcFltCfgSts2>},
+{130953, -1, fnPrintMessage<ChgAcFltCfgSts1>},
+{130954, -1, fnPrintMessage<ChgAcSts4>},
+{130965, -1, fnPrintMessage<ChgCfgCmd2>},
+{130966, -1, fnPrintMessage<ChgCfgSts2>},
+{130967, -1, fnPrintMessage<ChgEqlzCfgCmd>},
+{130968, -1, fnPrintMessage<ChgEqlzCfgSts>},
+{130969, -1, fnPrintMessage<ChgEqlzSts>},
+{131011, -1, fnPrintMessage<ChgStatsSts>},
+{131012, -1, fnPrintMessage<ChgCfgCmd1>},
+{131013, -1, fnPrintMessage<ChgCmd>},
+{131014, -1, fnPrintMessage<ChgCfgSts1>},
+{131015, -1, fnPrintMessage<ChgSts>},
+{131016, -1, fnPrintMessage<ChgAcSts3>},
+{131017, -1, fnPrintMessage<ChgAcSts2>},
+{131018, -1, fnPrintMessage<ChgAcSts1>},
+};
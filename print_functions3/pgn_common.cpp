@@ -0,0 +1,2504 @@
+// Auto-generated by generate_print_functions.py: common message classes
+#include "print_functions3.h"
+
+// ProdIdent
+std::string ProdIdent::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Data") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucData = msg.ptzExtra[i].ucData;
+            s += (ucData);
+          }
+            return s;
+        }
+if (mnem == "Make"){
+    std::string s;
+    for (int i = 0; i < msg.uiExtraCount; i++) {
+        uchar8 ucData = msg.ptzExtra[i].ucData;
+        if (ucData == '*') break;
+        s += (ucData);
+    }
+    return s;
+}
+else if (mnem == "Model"){
+    std::string s;
+    int c = 0;
+    for (int i = 0; i < msg.uiExtraCount; i++) {
+        uchar8 ucData = msg.ptzExtra[i].ucData;
+        if (c == 1 && ucData != '*') s += (ucData);
+        if (ucData == '*') c++;
+        if (c == 2) break;
+    }
+    return s;
+}
+else if (mnem == "Serial"){
+    std::string s;
+    int c = 0;
+    for (int i = 0; i < msg.uiExtraCount; i++) {
+        uchar8 ucData = msg.ptzExtra[i].ucData;
+        if (c == 2 && ucData != '*') s += (ucData);
+        if (ucData == '*') c++;
+        if (c == 3) break;
+    }
+    return s;
+}
+else if (mnem == "Unit"){
+    std::string s;
+    int c = 0;
+    for (int i = 0; i < msg.uiExtraCount; i++) {
+        uchar8 ucData = msg.ptzExtra[i].ucData;
+        if (c == 3 && ucData != '*') s += (ucData);
+        if (ucData == '*') c++;
+        if (c == 4) break;
+    }
+    return s;
+}
+        else return "no pgn";
+    }
+void ProdIdent::Print() const {
+        std::cout << "PGN: ProdIdent" << std::endl;
+        cout << "Data      : " << fnGetValue("Data") << endl;
+     cout << "   " << fnGetValue("Make") << endl;
+     cout << "   " << fnGetValue("Model") << endl;
+     cout << "   " << fnGetValue("Serial") << endl;
+     cout << "   " << fnGetValue("Unit") << endl;
+    }
+bool ProdIdent::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ProdIdent::fnGetRawValue(const std::string mnem) const {
+        return UINT32_MAX;
+    }
+void ProdIdent::fnSetValue(const std::string& mnem, const std::string& value) {
+    }
+void ProdIdent::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ProdIdent::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ProdIdent::fnGetFloatValue(const std::string mnem) const {
+        return 0.0;
+    }
+
+// FileDnldBlk
+std::string FileDnldBlk::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BlkNum") {
+            return (msg.uiBlkNum == 0xffff) ? "No Data" : (msg.uiBlkNum == 0xfffe) ? "Out of range" : (msg.uiBlkNum == 0xfffd) ? "Reserved" : std::to_string(msg.uiBlkNum);
+        }
+        else if (mnem == "BlkSz") {
+            return (msg.uiBlkSz == 0xffff) ? "No Data" : (msg.uiBlkSz == 0xfffe) ? "Out of range" : (msg.uiBlkSz == 0xfffd) ? "Reserved" : std::to_string(msg.uiBlkSz);
+        }
+        else if (mnem == "BlkData") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucBlkData = msg.ptzExtra[i].ucBlkData;
+            char buffer[50];
+            auto engval = 1.0 * (long double) (ucBlkData + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "8-Bit Bytes");
+            s += (ucBlkData == 0xff) ? "No Data" : (ucBlkData == 0xfe) ? "Out of range" : (ucBlkData == 0xfd) ? "Reserved" : (buffer);
+          }
+            return s;
+        }
+        else return "no pgn";
+    }
+void FileDnldBlk::Print() const {
+        std::cout << "PGN: FileDnldBlk" << std::endl;
+        cout << "BlkNum      : " << fnGetValue("BlkNum") << " (" << fnGetRawValue("BlkNum") << ")" << endl;
+        cout << "BlkSz      : " << fnGetValue("BlkSz") << " (" << fnGetRawValue("BlkSz") << ")" << endl;
+        cout << "BlkData      : " << fnGetValue("BlkData") << endl;
+    }
+bool FileDnldBlk::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 FileDnldBlk::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BlkNum") {
+            return static_cast<uint32_t>(msg.uiBlkNum);
+        }
+        else if (mnem == "BlkSz") {
+            return static_cast<uint32_t>(msg.uiBlkSz);
+        }
+        return UINT32_MAX;
+    }
+void FileDnldBlk::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BlkNum") {
+     msg.uiBlkNum = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "BlkSz") {
+     msg.uiBlkSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void FileDnldBlk::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string FileDnldBlk::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double FileDnldBlk::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BlkNum") {
+            return 1.0 * (long double)(msg.uiBlkNum + 0.0);
+        }
+        else if (mnem == "BlkSz") {
+            return 1.0 * (long double)(msg.uiBlkSz + 0.0);
+        }
+        return 0.0;
+    }
+
+// SwVerSts
+std::string SwVerSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgCount") {
+            return std::to_string(msg.ucMsgCount);
+        }
+        else if (mnem == "ProcessorInst") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucProcessorInst = msg.ptzExtra[i].ucProcessorInst;
+            s += std::to_string(ucProcessorInst);
+          }
+            return s;
+        }
+        else if (mnem == "SwModId") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            RVC_teSW_MOD_ID teSwModId = msg.ptzExtra[i].teSwModId;
+            if (!ENUMLOOKUP_535997516.fnContains(teSwModId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", teSwModId);
+                 s += (buffer);
+            } else {
+                 s += ENUMLOOKUP_535997516.fnText(teSwModId);
+              }
+          }
+            return s;
+        }
+        else if (mnem == "SwVer") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uint32 ulSwVer = msg.ptzExtra[i].ulSwVer;
+            s += (ulSwVer == 0xffffffff) ? "No Data" : (ulSwVer == 0xfffffffe) ? "Out of range" : (ulSwVer == 0xfffffffd) ? "Reserved" : std::to_string(ulSwVer);
+          }
+            return s;
+        }
+        else if (mnem == "SwBldNum") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uint16 uiSwBldNum = msg.ptzExtra[i].uiSwBldNum;
+            s += (uiSwBldNum == 0xffff) ? "No Data" : (uiSwBldNum == 0xfffe) ? "Out of range" : (uiSwBldNum == 0xfffd) ? "Reserved" : std::to_string(uiSwBldNum);
+          }
+            return s;
+        }
+        else return "no pgn";
+    }
+void SwVerSts::Print() const {
+        std::cout << "PGN: SwVerSts" << std::endl;
+        cout << "MsgCount      : " << fnGetValue("MsgCount") << " (" << fnGetRawValue("MsgCount") << ")" << endl;
+        cout << "ProcessorInst      : " << fnGetValue("ProcessorInst") << endl;
+        cout << "SwModId      : " << fnGetValue("SwModId") << endl;
+        cout << "SwVer      : " << fnGetValue("SwVer") << endl;
+        cout << "SwBldNum      : " << fnGetValue("SwBldNum") << endl;
+    }
+bool SwVerSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SwVerSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgCount") {
+            return static_cast<uint32_t>(msg.ucMsgCount);
+        }
+        return UINT32_MAX;
+    }
+void SwVerSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgCount") {
+     msg.ucMsgCount = stringToInt(value, 0, 0, 0);
+        }
+    }
+void SwVerSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SwVerSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SwVerSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgCount") {
+            return 1.0 * (long double)(msg.ucMsgCount + 0.0);
+        }
+        return 0.0;
+    }
+
+// DiagMsg1
+std::string DiagMsg1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "OpStsProdOn") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOpStsProdOn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpStsProdOn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOpStsProdOn));
+              }
+        }
+        else if (mnem == "OpStsProdActive") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOpStsProdActive)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpStsProdActive);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOpStsProdActive));
+              }
+        }
+        else if (mnem == "OpStsYel") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOpStsYel)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpStsYel);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOpStsYel));
+              }
+        }
+        else if (mnem == "OpStsRed") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOpStsRed)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpStsRed);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOpStsRed));
+              }
+        }
+        else if (mnem == "ProdId") {
+            if (!ENUMLOOKUP_8982.fnContains(msg.teProdId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teProdId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8982.fnText(msg.teProdId));
+              }
+        }
+        else if (mnem == "SpnMsb") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucSpnMsb = msg.ptzExtra[i].ucSpnMsb;
+            s += (ucSpnMsb == 0xff) ? "No Data" : (ucSpnMsb == 0xfe) ? "Out of range" : (ucSpnMsb == 0xfd) ? "Reserved" : std::to_string(ucSpnMsb);
+          }
+            return s;
+        }
+        else if (mnem == "SpnIsb") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucSpnIsb = msg.ptzExtra[i].ucSpnIsb;
+            s += (ucSpnIsb == 0xff) ? "No Data" : (ucSpnIsb == 0xfe) ? "Out of range" : (ucSpnIsb == 0xfd) ? "Reserved" : std::to_string(ucSpnIsb);
+          }
+            return s;
+        }
+        else if (mnem == "Fmi") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            RVC_teSAEJ1939FMI teFmi = msg.ptzExtra[i].teFmi;
+            if (!ENUMLOOKUP_9419.fnContains(teFmi)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", teFmi);
+                 s += (buffer);
+            } else {
+                 s += ENUMLOOKUP_9419.fnText(teFmi);
+              }
+          }
+            return s;
+        }
+        else if (mnem == "SpnLsb") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucSpnLsb = msg.ptzExtra[i].ucSpnLsb;
+            s += std::to_string(ucSpnLsb);
+          }
+            return s;
+        }
+        else if (mnem == "OccurrenceCnt") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucOccurrenceCnt = msg.ptzExtra[i].ucOccurrenceCnt;
+            s += std::to_string(ucOccurrenceCnt);
+          }
+            return s;
+        }
+        else if (mnem == "ProdIdExt") {
+            std::string s;
+            for(int i =0; i < msg.uiExtraCount; i++) {
+            uchar8 ucProdIdExt = msg.ptzExtra[i].ucProdIdExt;
+            s += (ucProdIdExt == 0xff) ? "No Data" : (ucProdIdExt == 0xfe) ? "Out of range" : (ucProdIdExt == 0xfd) ? "Reserved" : std::to_string(ucProdIdExt);
+          }
+            return s;
+        }
+       else if (mnem == "Spn"){
+            std::string s;
+            for(int i = 0; i < msg.uiExtraCount; i++) {
+                uchar8 msb = msg.ptzExtra[i].ucSpnMsb, lsb = msg.ptzExtra[i].ucSpnLsb, isb = msg.ptzExtra[i].ucSpnIsb;
+                int spn = (msb << 11) + (isb << 3) + lsb;
+
+                if (msb == 0){
+                    std::tuple<int, int, int> key = {msb, isb, lsb};
+                    auto it = global_spns.find(key);
+                    if (it != global_spns.end()) {
+                        s += it->second;
+                        if(i < (msg.uiExtraCount-1)) s += '\n';
+                        continue;
+                    }
+                }
+                else{
+                    auto it = spn_mapping.find(msg.teProdId);
+                    if (it != spn_mapping.end()) {
+                        auto& spn_dict = it->second;
+                        std::tuple<int, int> key = std::make_tuple(msb, lsb);
+                        auto spn_it = spn_dict.find(key);
+                        if (spn_it != spn_dict.end()) {
+                            s += spn_it->second + " " + std::to_string(isb);
+                            if(i < (msg.uiExtraCount-1)) s += '\n';
+                            continue;
+                        }
+                    }
+                }
+                char buffer[50];
+                snprintf(buffer, sizeof(buffer), "?%02x-%d-%d?", msb, isb, lsb);
+                s += buffer;
+                if(i < (msg.uiExtraCount-1)) s += '\n';
+            }
+            return s;
+        }
+        else return "no pgn";
+    }
+void DiagMsg1::Print() const {
+        std::cout << "PGN: DiagMsg1" << std::endl;
+        cout << "OpStsProdOn      : " << fnGetValue("OpStsProdOn") << " (" << fnGetRawValue("OpStsProdOn") << ")" << endl;
+        cout << "OpStsProdActive      : " << fnGetValue("OpStsProdActive") << " (" << fnGetRawValue("OpStsProdActive") << ")" << endl;
+        cout << "OpStsYel      : " << fnGetValue("OpStsYel") << " (" << fnGetRawValue("OpStsYel") << ")" << endl;
+        cout << "OpStsRed      : " << fnGetValue("OpStsRed") << " (" << fnGetRawValue("OpStsRed") << ")" << endl;
+        cout << "ProdId      : " << fnGetValue("ProdId") << " (" << fnGetRawValue("ProdId") << ")" << endl;
+        cout << "SpnMsb      : " << fnGetValue("SpnMsb") << endl;
+        cout << "SpnIsb      : " << fnGetValue("SpnIsb") << endl;
+        cout << "Fmi      : " << fnGetValue("Fmi") << endl;
+        cout << "SpnLsb      : " << fnGetValue("SpnLsb") << endl;
+        cout << "OccurrenceCnt      : " << fnGetValue("OccurrenceCnt") << endl;
+        cout << "ProdIdExt      : " << fnGetValue("ProdIdExt") << endl;
+        cout << "   " << fnGetValue("Spn") << endl;
+    }
+bool DiagMsg1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 DiagMsg1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "OpStsProdOn") {
+            return static_cast<uint32_t>(msg.teOpStsProdOn);
+        }
+        else if (mnem == "OpStsProdActive") {
+            return static_cast<uint32_t>(msg.teOpStsProdActive);
+        }
+        else if (mnem == "OpStsYel") {
+            return static_cast<uint32_t>(msg.teOpStsYel);
+        }
+        else if (mnem == "OpStsRed") {
+            return static_cast<uint32_t>(msg.teOpStsRed);
+        }
+        else if (mnem == "ProdId") {
+            return static_cast<uint32_t>(msg.teProdId);
+        }
+        return UINT32_MAX;
+    }
+void DiagMsg1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "OpStsProdOn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOpStsProdOn = static_cast<decltype(msg.teOpStsProdOn)>(enumValue);
+     else msg.teOpStsProdOn = static_cast<decltype(msg.teOpStsProdOn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OpStsProdActive") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOpStsProdActive = static_cast<decltype(msg.teOpStsProdActive)>(enumValue);
+     else msg.teOpStsProdActive = static_cast<decltype(msg.teOpStsProdActive)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OpStsYel") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOpStsYel = static_cast<decltype(msg.teOpStsYel)>(enumValue);
+     else msg.teOpStsYel = static_cast<decltype(msg.teOpStsYel)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OpStsRed") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOpStsRed = static_cast<decltype(msg.teOpStsRed)>(enumValue);
+     else msg.teOpStsRed = static_cast<decltype(msg.teOpStsRed)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ProdId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8982, value);
+     if (enumValue != -1) msg.teProdId = static_cast<decltype(msg.teProdId)>(enumValue);
+     else msg.teProdId = static_cast<decltype(msg.teProdId)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void DiagMsg1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string DiagMsg1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double DiagMsg1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "OpStsProdOn") {
+            return 1.0 * (long double)(msg.teOpStsProdOn + 0.0);
+        }
+        else if (mnem == "OpStsProdActive") {
+            return 1.0 * (long double)(msg.teOpStsProdActive + 0.0);
+        }
+        else if (mnem == "OpStsYel") {
+            return 1.0 * (long double)(msg.teOpStsYel + 0.0);
+        }
+        else if (mnem == "OpStsRed") {
+            return 1.0 * (long double)(msg.teOpStsRed + 0.0);
+        }
+        else if (mnem == "ProdId") {
+            return 1.0 * (long double)(msg.teProdId + 0.0);
+        }
+        return 0.0;
+    }
+
+// XbResetCmd
+std::string XbResetCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "ProcessorInst") {
+            return std::to_string(msg.ucProcessorInst);
+        }
+        else if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_2027188828.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2027188828.fnText(msg.teCmd));
+              }
+        }
+        else return "no pgn";
+    }
+void XbResetCmd::Print() const {
+        std::cout << "PGN: XbResetCmd" << std::endl;
+        cout << "ProcessorInst      : " << fnGetValue("ProcessorInst") << " (" << fnGetRawValue("ProcessorInst") << ")" << endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+    }
+bool XbResetCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 XbResetCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "ProcessorInst") {
+            return static_cast<uint32_t>(msg.ucProcessorInst);
+        }
+        else if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        return UINT32_MAX;
+    }
+void XbResetCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "ProcessorInst") {
+     msg.ucProcessorInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2027188828, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void XbResetCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string XbResetCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double XbResetCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "ProcessorInst") {
+            return 1.0 * (long double)(msg.ucProcessorInst + 0.0);
+        }
+        else if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        return 0.0;
+    }
+
+// FileDnldInf
+std::string FileDnldInf::fnGetValue(const std::string& mnem) const {
+        if (mnem == "DeviceFunction") {
+            if (!ENUMLOOKUP_9001.fnContains(msg.teDeviceFunction)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDeviceFunction);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9001.fnText(msg.teDeviceFunction));
+              }
+        }
+        else if (mnem == "ProcessorInst") {
+            return std::to_string(msg.ucProcessorInst);
+        }
+        else if (mnem == "SwModId") {
+            if (!ENUMLOOKUP_535997516.fnContains(msg.teSwModId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSwModId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_535997516.fnText(msg.teSwModId));
+              }
+        }
+        else if (mnem == "SwVer") {
+            return (msg.ulSwVer == 0xffffffff) ? "No Data" : (msg.ulSwVer == 0xfffffffe) ? "Out of range" : (msg.ulSwVer == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulSwVer);
+        }
+        else if (mnem == "FileSz") {
+            return (msg.ulFileSz == 0xffffffff) ? "No Data" : (msg.ulFileSz == 0xfffffffe) ? "Out of range" : (msg.ulFileSz == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulFileSz);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else if (mnem == "ExpectNumBlks") {
+            return (msg.uiExpectNumBlks == 0xffff) ? "No Data" : (msg.uiExpectNumBlks == 0xfffe) ? "Out of range" : (msg.uiExpectNumBlks == 0xfffd) ? "Reserved" : std::to_string(msg.uiExpectNumBlks);
+        }
+        else return "no pgn";
+    }
+void FileDnldInf::Print() const {
+        std::cout << "PGN: FileDnldInf" << std::endl;
+        cout << "DeviceFunction      : " << fnGetValue("DeviceFunction") << " (" << fnGetRawValue("DeviceFunction") << ")" << endl;
+        cout << "ProcessorInst      : " << fnGetValue("ProcessorInst") << " (" << fnGetRawValue("ProcessorInst") << ")" << endl;
+        cout << "SwModId      : " << fnGetValue("SwModId") << " (" << fnGetRawValue("SwModId") << ")" << endl;
+        cout << "SwVer      : " << fnGetValue("SwVer") << " (" << fnGetRawValue("SwVer") << ")" << endl;
+        cout << "FileSz      : " << fnGetValue("FileSz") << " (" << fnGetRawValue("FileSz") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+        cout << "ExpectNumBlks      : " << fnGetValue("ExpectNumBlks") << " (" << fnGetRawValue("ExpectNumBlks") << ")" << endl;
+    }
+bool FileDnldInf::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 FileDnldInf::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "DeviceFunction") {
+            return static_cast<uint32_t>(msg.teDeviceFunction);
+        }
+        else if (mnem == "ProcessorInst") {
+            return static_cast<uint32_t>(msg.ucProcessorInst);
+        }
+        else if (mnem == "SwModId") {
+            return static_cast<uint32_t>(msg.teSwModId);
+        }
+        else if (mnem == "SwVer") {
+            return static_cast<uint32_t>(msg.ulSwVer);
+        }
+        else if (mnem == "FileSz") {
+            return static_cast<uint32_t>(msg.ulFileSz);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        else if (mnem == "ExpectNumBlks") {
+            return static_cast<uint32_t>(msg.uiExpectNumBlks);
+        }
+        return UINT32_MAX;
+    }
+void FileDnldInf::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "DeviceFunction") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9001, value);
+     if (enumValue != -1) msg.teDeviceFunction = static_cast<decltype(msg.teDeviceFunction)>(enumValue);
+     else msg.teDeviceFunction = static_cast<decltype(msg.teDeviceFunction)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ProcessorInst") {
+     msg.ucProcessorInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "SwModId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_535997516, value);
+     if (enumValue != -1) msg.teSwModId = static_cast<decltype(msg.teSwModId)>(enumValue);
+     else msg.teSwModId = static_cast<decltype(msg.teSwModId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SwVer") {
+     msg.ulSwVer = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "FileSz") {
+     msg.ulFileSz = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "ExpectNumBlks") {
+     msg.uiExpectNumBlks = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void FileDnldInf::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string FileDnldInf::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double FileDnldInf::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "DeviceFunction") {
+            return 1.0 * (long double)(msg.teDeviceFunction + 0.0);
+        }
+        else if (mnem == "ProcessorInst") {
+            return 1.0 * (long double)(msg.ucProcessorInst + 0.0);
+        }
+        else if (mnem == "SwModId") {
+            return 1.0 * (long double)(msg.teSwModId + 0.0);
+        }
+        else if (mnem == "SwVer") {
+            return 1.0 * (long double)(msg.ulSwVer + 0.0);
+        }
+        else if (mnem == "FileSz") {
+            return 1.0 * (long double)(msg.ulFileSz + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        else if (mnem == "ExpectNumBlks") {
+            return 1.0 * (long double)(msg.uiExpectNumBlks + 0.0);
+        }
+        return 0.0;
+    }
+
+// SimpleCalibCfg
+std::string SimpleCalibCfg::fnGetValue(const std::string& mnem) const {
+        if (mnem == "RsvBits") {
+            return std::to_string(msg.ucRsvBits);
+        }
+        else if (mnem == "MsgCount") {
+            return std::to_string(msg.ucMsgCount);
+        }
+        else if (mnem == "StsPgn") {
+            return std::to_string(msg.ulStsPgn);
+        }
+        else if (mnem == "DataPtId") {
+            if (!ENUMLOOKUP_1558143328.fnContains(msg.teDataPtId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDataPtId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1558143328.fnText(msg.teDataPtId));
+              }
+        }
+        else if (mnem == "Scale") {
+            return (msg.uiScale == 0xffff) ? "No Data" : (msg.uiScale == 0xfffe) ? "Out of range" : (msg.uiScale == 0xfffd) ? "Reserved" : std::to_string(msg.uiScale);
+        }
+        else if (mnem == "Offset") {
+            return (msg.uiOffset == 0xffff) ? "No Data" : (msg.uiOffset == 0xfffe) ? "Out of range" : (msg.uiOffset == 0xfffd) ? "Reserved" : std::to_string(msg.uiOffset);
+        }
+        else if (mnem == "Value") {
+            return (msg.ulValue == 0xffffffff) ? "No Data" : (msg.ulValue == 0xfffffffe) ? "Out of range" : (msg.ulValue == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulValue);
+        }
+        else return "no pgn";
+    }
+void SimpleCalibCfg::Print() const {
+        std::cout << "PGN: SimpleCalibCfg" << std::endl;
+        cout << "RsvBits      : " << fnGetValue("RsvBits") << " (" << fnGetRawValue("RsvBits") << ")" << endl;
+        cout << "MsgCount      : " << fnGetValue("MsgCount") << " (" << fnGetRawValue("MsgCount") << ")" << endl;
+        cout << "StsPgn      : " << fnGetValue("StsPgn") << " (" << fnGetRawValue("StsPgn") << ")" << endl;
+        cout << "DataPtId      : " << fnGetValue("DataPtId") << " (" << fnGetRawValue("DataPtId") << ")" << endl;
+        cout << "Scale      : " << fnGetValue("Scale") << " (" << fnGetRawValue("Scale") << ")" << endl;
+        cout << "Offset      : " << fnGetValue("Offset") << " (" << fnGetRawValue("Offset") << ")" << endl;
+        cout << "Value      : " << fnGetValue("Value") << " (" << fnGetRawValue("Value") << ")" << endl;
+    }
+bool SimpleCalibCfg::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SimpleCalibCfg::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "RsvBits") {
+            return static_cast<uint32_t>(msg.ucRsvBits);
+        }
+        else if (mnem == "MsgCount") {
+            return static_cast<uint32_t>(msg.ucMsgCount);
+        }
+        else if (mnem == "StsPgn") {
+            return static_cast<uint32_t>(msg.ulStsPgn);
+        }
+        else if (mnem == "DataPtId") {
+            return static_cast<uint32_t>(msg.teDataPtId);
+        }
+        else if (mnem == "Scale") {
+            return static_cast<uint32_t>(msg.uiScale);
+        }
+        else if (mnem == "Offset") {
+            return static_cast<uint32_t>(msg.uiOffset);
+        }
+        else if (mnem == "Value") {
+            return static_cast<uint32_t>(msg.ulValue);
+        }
+        return UINT32_MAX;
+    }
+void SimpleCalibCfg::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "RsvBits") {
+     msg.ucRsvBits = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "MsgCount") {
+     msg.ucMsgCount = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "StsPgn") {
+     msg.ulStsPgn = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DataPtId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1558143328, value);
+     if (enumValue != -1) msg.teDataPtId = static_cast<decltype(msg.teDataPtId)>(enumValue);
+     else msg.teDataPtId = static_cast<decltype(msg.teDataPtId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Scale") {
+     msg.uiScale = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "Offset") {
+     msg.uiOffset = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "Value") {
+     msg.ulValue = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+    }
+void SimpleCalibCfg::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SimpleCalibCfg::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SimpleCalibCfg::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "RsvBits") {
+            return 1.0 * (long double)(msg.ucRsvBits + 0.0);
+        }
+        else if (mnem == "MsgCount") {
+            return 1.0 * (long double)(msg.ucMsgCount + 0.0);
+        }
+        else if (mnem == "StsPgn") {
+            return 1.0 * (long double)(msg.ulStsPgn + 0.0);
+        }
+        else if (mnem == "DataPtId") {
+            return 1.0 * (long double)(msg.teDataPtId + 0.0);
+        }
+        else if (mnem == "Scale") {
+            return 1.0 * (long double)(msg.uiScale + 0.0);
+        }
+        else if (mnem == "Offset") {
+            return 1.0 * (long double)(msg.uiOffset + 0.0);
+        }
+        else if (mnem == "Value") {
+            return 1.0 * (long double)(msg.ulValue + 0.0);
+        }
+        return 0.0;
+    }
+
+// FileDnldSts
+std::string FileDnldSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "OpState") {
+            if (!ENUMLOOKUP_101476251.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_101476251.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "ResultCode") {
+            if (!ENUMLOOKUP_1426290752.fnContains(msg.teResultCode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teResultCode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1426290752.fnText(msg.teResultCode));
+              }
+        }
+        else if (mnem == "ProcessorInst") {
+            return std::to_string(msg.ucProcessorInst);
+        }
+        else if (mnem == "ModelNum") {
+            return (msg.uiModelNum == 0xffff) ? "No Data" : (msg.uiModelNum == 0xfffe) ? "Out of range" : (msg.uiModelNum == 0xfffd) ? "Reserved" : std::to_string(msg.uiModelNum);
+        }
+        else if (mnem == "HwModRev") {
+            return (msg.uiHwModRev == 0xffff) ? "No Data" : (msg.uiHwModRev == 0xfffe) ? "Out of range" : (msg.uiHwModRev == 0xfffd) ? "Reserved" : std::to_string(msg.uiHwModRev);
+        }
+        else if (mnem == "BlkNum") {
+            return (msg.uiBlkNum == 0xffff) ? "No Data" : (msg.uiBlkNum == 0xfffe) ? "Out of range" : (msg.uiBlkNum == 0xfffd) ? "Reserved" : std::to_string(msg.uiBlkNum);
+        }
+        else return "no pgn";
+    }
+void FileDnldSts::Print() const {
+        std::cout << "PGN: FileDnldSts" << std::endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "ResultCode      : " << fnGetValue("ResultCode") << " (" << fnGetRawValue("ResultCode") << ")" << endl;
+        cout << "ProcessorInst      : " << fnGetValue("ProcessorInst") << " (" << fnGetRawValue("ProcessorInst") << ")" << endl;
+        cout << "ModelNum      : " << fnGetValue("ModelNum") << " (" << fnGetRawValue("ModelNum") << ")" << endl;
+        cout << "HwModRev      : " << fnGetValue("HwModRev") << " (" << fnGetRawValue("HwModRev") << ")" << endl;
+        cout << "BlkNum      : " << fnGetValue("BlkNum") << " (" << fnGetRawValue("BlkNum") << ")" << endl;
+    }
+bool FileDnldSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 FileDnldSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "ResultCode") {
+            return static_cast<uint32_t>(msg.teResultCode);
+        }
+        else if (mnem == "ProcessorInst") {
+            return static_cast<uint32_t>(msg.ucProcessorInst);
+        }
+        else if (mnem == "ModelNum") {
+            return static_cast<uint32_t>(msg.uiModelNum);
+        }
+        else if (mnem == "HwModRev") {
+            return static_cast<uint32_t>(msg.uiHwModRev);
+        }
+        else if (mnem == "BlkNum") {
+            return static_cast<uint32_t>(msg.uiBlkNum);
+        }
+        return UINT32_MAX;
+    }
+void FileDnldSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_101476251, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ResultCode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1426290752, value);
+     if (enumValue != -1) msg.teResultCode = static_cast<decltype(msg.teResultCode)>(enumValue);
+     else msg.teResultCode = static_cast<decltype(msg.teResultCode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ProcessorInst") {
+     msg.ucProcessorInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ModelNum") {
+     msg.uiModelNum = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "HwModRev") {
+     msg.uiHwModRev = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "BlkNum") {
+     msg.uiBlkNum = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void FileDnldSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string FileDnldSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double FileDnldSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "ResultCode") {
+            return 1.0 * (long double)(msg.teResultCode + 0.0);
+        }
+        else if (mnem == "ProcessorInst") {
+            return 1.0 * (long double)(msg.ucProcessorInst + 0.0);
+        }
+        else if (mnem == "ModelNum") {
+            return 1.0 * (long double)(msg.uiModelNum + 0.0);
+        }
+        else if (mnem == "HwModRev") {
+            return 1.0 * (long double)(msg.uiHwModRev + 0.0);
+        }
+        else if (mnem == "BlkNum") {
+            return 1.0 * (long double)(msg.uiBlkNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// InstSts
+std::string InstSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "DevType") {
+            if (!ENUMLOOKUP_8982.fnContains(msg.teDevType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDevType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8982.fnText(msg.teDevType));
+              }
+        }
+        else if (mnem == "BaseInst") {
+            return (msg.ucBaseInst == 0xff) ? "No Data" : (msg.ucBaseInst == 0xfe) ? "Out of range" : (msg.ucBaseInst == 0xfd) ? "Reserved" : std::to_string(msg.ucBaseInst);
+        }
+        else if (mnem == "MaxInst") {
+            return (msg.ucMaxInst == 0xff) ? "No Data" : (msg.ucMaxInst == 0xfe) ? "Out of range" : (msg.ucMaxInst == 0xfd) ? "Reserved" : std::to_string(msg.ucMaxInst);
+        }
+        else if (mnem == "BaseIntAddr") {
+            return (msg.uiBaseIntAddr == 0xffff) ? "No Data" : (msg.uiBaseIntAddr == 0xfffe) ? "Out of range" : (msg.uiBaseIntAddr == 0xfffd) ? "Reserved" : std::to_string(msg.uiBaseIntAddr);
+        }
+        else if (mnem == "MaxIntAddr") {
+            return (msg.uiMaxIntAddr == 0xffff) ? "No Data" : (msg.uiMaxIntAddr == 0xfffe) ? "Out of range" : (msg.uiMaxIntAddr == 0xfffd) ? "Reserved" : std::to_string(msg.uiMaxIntAddr);
+        }
+        else return "no pgn";
+    }
+void InstSts::Print() const {
+        std::cout << "PGN: InstSts" << std::endl;
+        cout << "DevType      : " << fnGetValue("DevType") << " (" << fnGetRawValue("DevType") << ")" << endl;
+        cout << "BaseInst      : " << fnGetValue("BaseInst") << " (" << fnGetRawValue("BaseInst") << ")" << endl;
+        cout << "MaxInst      : " << fnGetValue("MaxInst") << " (" << fnGetRawValue("MaxInst") << ")" << endl;
+        cout << "BaseIntAddr      : " << fnGetValue("BaseIntAddr") << " (" << fnGetRawValue("BaseIntAddr") << ")" << endl;
+        cout << "MaxIntAddr      : " << fnGetValue("MaxIntAddr") << " (" << fnGetRawValue("MaxIntAddr") << ")" << endl;
+    }
+bool InstSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InstSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "DevType") {
+            return static_cast<uint32_t>(msg.teDevType);
+        }
+        else if (mnem == "BaseInst") {
+            return static_cast<uint32_t>(msg.ucBaseInst);
+        }
+        else if (mnem == "MaxInst") {
+            return static_cast<uint32_t>(msg.ucMaxInst);
+        }
+        else if (mnem == "BaseIntAddr") {
+            return static_cast<uint32_t>(msg.uiBaseIntAddr);
+        }
+        else if (mnem == "MaxIntAddr") {
+            return static_cast<uint32_t>(msg.uiMaxIntAddr);
+        }
+        return UINT32_MAX;
+    }
+void InstSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "DevType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8982, value);
+     if (enumValue != -1) msg.teDevType = static_cast<decltype(msg.teDevType)>(enumValue);
+     else msg.teDevType = static_cast<decltype(msg.teDevType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BaseInst") {
+     msg.ucBaseInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "MaxInst") {
+     msg.ucMaxInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "BaseIntAddr") {
+     msg.uiBaseIntAddr = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "MaxIntAddr") {
+     msg.uiMaxIntAddr = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void InstSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InstSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InstSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "DevType") {
+            return 1.0 * (long double)(msg.teDevType + 0.0);
+        }
+        else if (mnem == "BaseInst") {
+            return 1.0 * (long double)(msg.ucBaseInst + 0.0);
+        }
+        else if (mnem == "MaxInst") {
+            return 1.0 * (long double)(msg.ucMaxInst + 0.0);
+        }
+        else if (mnem == "BaseIntAddr") {
+            return 1.0 * (long double)(msg.uiBaseIntAddr + 0.0);
+        }
+        else if (mnem == "MaxIntAddr") {
+            return 1.0 * (long double)(msg.uiMaxIntAddr + 0.0);
+        }
+        return 0.0;
+    }
+
+// InstAssign
+std::string InstAssign::fnGetValue(const std::string& mnem) const {
+        if (mnem == "DevType") {
+            if (!ENUMLOOKUP_8982.fnContains(msg.teDevType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDevType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8982.fnText(msg.teDevType));
+              }
+        }
+        else if (mnem == "BaseInst") {
+            return (msg.ucBaseInst == 0xff) ? "No Data" : (msg.ucBaseInst == 0xfe) ? "Out of range" : (msg.ucBaseInst == 0xfd) ? "Reserved" : std::to_string(msg.ucBaseInst);
+        }
+        else if (mnem == "MaxInst") {
+            return (msg.ucMaxInst == 0xff) ? "No Data" : (msg.ucMaxInst == 0xfe) ? "Out of range" : (msg.ucMaxInst == 0xfd) ? "Reserved" : std::to_string(msg.ucMaxInst);
+        }
+        else if (mnem == "BaseIntAddr") {
+            return (msg.uiBaseIntAddr == 0xffff) ? "No Data" : (msg.uiBaseIntAddr == 0xfffe) ? "Out of range" : (msg.uiBaseIntAddr == 0xfffd) ? "Reserved" : std::to_string(msg.uiBaseIntAddr);
+        }
+        else if (mnem == "MaxIntAddr") {
+            return (msg.uiMaxIntAddr == 0xffff) ? "No Data" : (msg.uiMaxIntAddr == 0xfffe) ? "Out of range" : (msg.uiMaxIntAddr == 0xfffd) ? "Reserved" : std::to_string(msg.uiMaxIntAddr);
+        }
+        else return "no pgn";
+    }
+void InstAssign::Print() const {
+        std::cout << "PGN: InstAssign" << std::endl;
+        cout << "DevType      : " << fnGetValue("DevType") << " (" << fnGetRawValue("DevType") << ")" << endl;
+        cout << "BaseInst      : " << fnGetValue("BaseInst") << " (" << fnGetRawValue("BaseInst") << ")" << endl;
+        cout << "MaxInst      : " << fnGetValue("MaxInst") << " (" << fnGetRawValue("MaxInst") << ")" << endl;
+        cout << "BaseIntAddr      : " << fnGetValue("BaseIntAddr") << " (" << fnGetRawValue("BaseIntAddr") << ")" << endl;
+        cout << "MaxIntAddr      : " << fnGetValue("MaxIntAddr") << " (" << fnGetRawValue("MaxIntAddr") << ")" << endl;
+    }
+bool InstAssign::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InstAssign::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "DevType") {
+            return static_cast<uint32_t>(msg.teDevType);
+        }
+        else if (mnem == "BaseInst") {
+            return static_cast<uint32_t>(msg.ucBaseInst);
+        }
+        else if (mnem == "MaxInst") {
+            return static_cast<uint32_t>(msg.ucMaxInst);
+        }
+        else if (mnem == "BaseIntAddr") {
+            return static_cast<uint32_t>(msg.uiBaseIntAddr);
+        }
+        else if (mnem == "MaxIntAddr") {
+            return static_cast<uint32_t>(msg.uiMaxIntAddr);
+        }
+        return UINT32_MAX;
+    }
+void InstAssign::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "DevType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8982, value);
+     if (enumValue != -1) msg.teDevType = static_cast<decltype(msg.teDevType)>(enumValue);
+     else msg.teDevType = static_cast<decltype(msg.teDevType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BaseInst") {
+     msg.ucBaseInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "MaxInst") {
+     msg.ucMaxInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "BaseIntAddr") {
+     msg.uiBaseIntAddr = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "MaxIntAddr") {
+     msg.uiMaxIntAddr = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void InstAssign::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InstAssign::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InstAssign::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "DevType") {
+            return 1.0 * (long double)(msg.teDevType + 0.0);
+        }
+        else if (mnem == "BaseInst") {
+            return 1.0 * (long double)(msg.ucBaseInst + 0.0);
+        }
+        else if (mnem == "MaxInst") {
+            return 1.0 * (long double)(msg.ucMaxInst + 0.0);
+        }
+        else if (mnem == "BaseIntAddr") {
+            return 1.0 * (long double)(msg.uiBaseIntAddr + 0.0);
+        }
+        else if (mnem == "MaxIntAddr") {
+            return 1.0 * (long double)(msg.uiMaxIntAddr + 0.0);
+        }
+        return 0.0;
+    }
+
+// VirtualTerminal
+std::string VirtualTerminal::fnGetValue(const std::string& mnem) const {
+        if (mnem == "AsciiChar1") {
+            return (msg.ucAsciiChar1 == 0xff) ? "No Data" : (msg.ucAsciiChar1 == 0xfe) ? "Out of range" : (msg.ucAsciiChar1 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar1);
+        }
+        else if (mnem == "AsciiChar2") {
+            return (msg.ucAsciiChar2 == 0xff) ? "No Data" : (msg.ucAsciiChar2 == 0xfe) ? "Out of range" : (msg.ucAsciiChar2 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar2);
+        }
+        else if (mnem == "AsciiChar3") {
+            return (msg.ucAsciiChar3 == 0xff) ? "No Data" : (msg.ucAsciiChar3 == 0xfe) ? "Out of range" : (msg.ucAsciiChar3 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar3);
+        }
+        else if (mnem == "AsciiChar4") {
+            return (msg.ucAsciiChar4 == 0xff) ? "No Data" : (msg.ucAsciiChar4 == 0xfe) ? "Out of range" : (msg.ucAsciiChar4 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar4);
+        }
+        else if (mnem == "AsciiChar5") {
+            return (msg.ucAsciiChar5 == 0xff) ? "No Data" : (msg.ucAsciiChar5 == 0xfe) ? "Out of range" : (msg.ucAsciiChar5 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar5);
+        }
+        else if (mnem == "AsciiChar6") {
+            return (msg.ucAsciiChar6 == 0xff) ? "No Data" : (msg.ucAsciiChar6 == 0xfe) ? "Out of range" : (msg.ucAsciiChar6 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar6);
+        }
+        else if (mnem == "AsciiChar7") {
+            return (msg.ucAsciiChar7 == 0xff) ? "No Data" : (msg.ucAsciiChar7 == 0xfe) ? "Out of range" : (msg.ucAsciiChar7 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar7);
+        }
+        else if (mnem == "AsciiChar8") {
+            return (msg.ucAsciiChar8 == 0xff) ? "No Data" : (msg.ucAsciiChar8 == 0xfe) ? "Out of range" : (msg.ucAsciiChar8 == 0xfd) ? "Reserved" : std::to_string(msg.ucAsciiChar8);
+        }
+        else return "no pgn";
+    }
+void VirtualTerminal::Print() const {
+        std::cout << "PGN: VirtualTerminal" << std::endl;
+        cout << "AsciiChar1      : " << fnGetValue("AsciiChar1") << " (" << fnGetRawValue("AsciiChar1") << ")" << endl;
+        cout << "AsciiChar2      : " << fnGetValue("AsciiChar2") << " (" << fnGetRawValue("AsciiChar2") << ")" << endl;
+        cout << "AsciiChar3      : " << fnGetValue("AsciiChar3") << " (" << fnGetRawValue("AsciiChar3") << ")" << endl;
+        cout << "AsciiChar4      : " << fnGetValue("AsciiChar4") << " (" << fnGetRawValue("AsciiChar4") << ")" << endl;
+        cout << "AsciiChar5      : " << fnGetValue("AsciiChar5") << " (" << fnGetRawValue("AsciiChar5") << ")" << endl;
+        cout << "AsciiChar6      : " << fnGetValue("AsciiChar6") << " (" << fnGetRawValue("AsciiChar6") << ")" << endl;
+        cout << "AsciiChar7      : " << fnGetValue("AsciiChar7") << " (" << fnGetRawValue("AsciiChar7") << ")" << endl;
+        cout << "AsciiChar8      : " << fnGetValue("AsciiChar8") << " (" << fnGetRawValue("AsciiChar8") << ")" << endl;
+    }
+bool VirtualTerminal::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 VirtualTerminal::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "AsciiChar1") {
+            return static_cast<uint32_t>(msg.ucAsciiChar1);
+        }
+        else if (mnem == "AsciiChar2") {
+            return static_cast<uint32_t>(msg.ucAsciiChar2);
+        }
+        else if (mnem == "AsciiChar3") {
+            return static_cast<uint32_t>(msg.ucAsciiChar3);
+        }
+        else if (mnem == "AsciiChar4") {
+            return static_cast<uint32_t>(msg.ucAsciiChar4);
+        }
+        else if (mnem == "AsciiChar5") {
+            return static_cast<uint32_t>(msg.ucAsciiChar5);
+        }
+        else if (mnem == "AsciiChar6") {
+            return static_cast<uint32_t>(msg.ucAsciiChar6);
+        }
+        else if (mnem == "AsciiChar7") {
+            return static_cast<uint32_t>(msg.ucAsciiChar7);
+        }
+        else if (mnem == "AsciiChar8") {
+            return static_cast<uint32_t>(msg.ucAsciiChar8);
+        }
+        return UINT32_MAX;
+    }
+void VirtualTerminal::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "AsciiChar1") {
+     msg.ucAsciiChar1 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar2") {
+     msg.ucAsciiChar2 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar3") {
+     msg.ucAsciiChar3 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar4") {
+     msg.ucAsciiChar4 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar5") {
+     msg.ucAsciiChar5 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar6") {
+     msg.ucAsciiChar6 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar7") {
+     msg.ucAsciiChar7 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "AsciiChar8") {
+     msg.ucAsciiChar8 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void VirtualTerminal::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string VirtualTerminal::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double VirtualTerminal::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "AsciiChar1") {
+            return 1.0 * (long double)(msg.ucAsciiChar1 + 0.0);
+        }
+        else if (mnem == "AsciiChar2") {
+            return 1.0 * (long double)(msg.ucAsciiChar2 + 0.0);
+        }
+        else if (mnem == "AsciiChar3") {
+            return 1.0 * (long double)(msg.ucAsciiChar3 + 0.0);
+        }
+        else if (mnem == "AsciiChar4") {
+            return 1.0 * (long double)(msg.ucAsciiChar4 + 0.0);
+        }
+        else if (mnem == "AsciiChar5") {
+            return 1.0 * (long double)(msg.ucAsciiChar5 + 0.0);
+        }
+        else if (mnem == "AsciiChar6") {
+            return 1.0 * (long double)(msg.ucAsciiChar6 + 0.0);
+        }
+        else if (mnem == "AsciiChar7") {
+            return 1.0 * (long double)(msg.ucAsciiChar7 + 0.0);
+        }
+        else if (mnem == "AsciiChar8") {
+            return 1.0 * (long double)(msg.ucAsciiChar8 + 0.0);
+        }
+        return 0.0;
+    }
+
+// ProdInfoSts
+std::string ProdInfoSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgCount") {
+            return std::to_string(msg.ucMsgCount);
+        }
+        else if (mnem == "ModelName") {
+            return reinterpret_cast< char const* >(msg.aucModelName);
+        }
+        else if (mnem == "Fga") {
+            return reinterpret_cast< char const* >(msg.aucFga);
+        }
+        else if (mnem == "PwrLvl") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ulPwrLvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.ulPwrLvl == 0xffffffff) ? "No Data" : (msg.ulPwrLvl == 0xfffffffe) ? "Out of range" : (msg.ulPwrLvl == 0xfffffffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "NomDcLvl") {
+            char buffer[50];
+            auto engval = 0.0010000000474974513 * (long double) (msg.slNomDcLvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.3f %s", engval, "V");
+            return (msg.slNomDcLvl == 0x7fffffff) ? "No Data" : (msg.slNomDcLvl == 0x7ffffffe) ? "Out of range" : (msg.slNomDcLvl == 0x7ffffffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "NomAcLvl") {
+            char buffer[50];
+            auto engval = 0.0010000000474974513 * (long double) (msg.ulNomAcLvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.3f %s", engval, "V");
+            return (msg.ulNomAcLvl == 0xffffffff) ? "No Data" : (msg.ulNomAcLvl == 0xfffffffe) ? "Out of range" : (msg.ulNomAcLvl == 0xfffffffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "NomAcOutFreq") {
+            char buffer[50];
+            auto engval = 0.009999999776482582 * (long double) (msg.uiNomAcOutFreq + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "Hz");
+            return (msg.uiNomAcOutFreq == 0xffff) ? "No Data" : (msg.uiNomAcOutFreq == 0xfffe) ? "Out of range" : (msg.uiNomAcOutFreq == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void ProdInfoSts::Print() const {
+        std::cout << "PGN: ProdInfoSts" << std::endl;
+        cout << "MsgCount      : " << fnGetValue("MsgCount") << " (" << fnGetRawValue("MsgCount") << ")" << endl;
+        cout << "ModelName      : " << fnGetValue("ModelName") << " (" << fnGetRawValue("ModelName") << ")" << endl;
+        cout << "Fga      : " << fnGetValue("Fga") << " (" << fnGetRawValue("Fga") << ")" << endl;
+        cout << "PwrLvl      : " << fnGetValue("PwrLvl") << " (" << fnGetRawValue("PwrLvl") << ")" << endl;
+        cout << "NomDcLvl      : " << fnGetValue("NomDcLvl") << " (" << fnGetRawValue("NomDcLvl") << ")" << endl;
+        cout << "NomAcLvl      : " << fnGetValue("NomAcLvl") << " (" << fnGetRawValue("NomAcLvl") << ")" << endl;
+        cout << "NomAcOutFreq      : " << fnGetValue("NomAcOutFreq") << " (" << fnGetRawValue("NomAcOutFreq") << ")" << endl;
+    }
+bool ProdInfoSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 ProdInfoSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgCount") {
+            return static_cast<uint32_t>(msg.ucMsgCount);
+        }
+        else if (mnem == "ModelName") {
+            return UINT32_MAX;
+        }
+        else if (mnem == "Fga") {
+            return UINT32_MAX;
+        }
+        else if (mnem == "PwrLvl") {
+            return static_cast<uint32_t>(msg.ulPwrLvl);
+        }
+        else if (mnem == "NomDcLvl") {
+            return static_cast<uint32_t>(msg.slNomDcLvl);
+        }
+        else if (mnem == "NomAcLvl") {
+            return static_cast<uint32_t>(msg.ulNomAcLvl);
+        }
+        else if (mnem == "NomAcOutFreq") {
+            return static_cast<uint32_t>(msg.uiNomAcOutFreq);
+        }
+        return UINT32_MAX;
+    }
+void ProdInfoSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgCount") {
+     msg.ucMsgCount = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ModelName") {
+        }
+        else if (mnem == "Fga") {
+        }
+        else if (mnem == "PwrLvl") {
+     msg.ulPwrLvl = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd, 1.0, 0.0);
+        }
+        else if (mnem == "NomDcLvl") {
+     msg.slNomDcLvl = stringToInt(value, 0x7fffffff, 0x7ffffffe, 0x7ffffffd, 0.0010000000474974513, 0.0);
+        }
+        else if (mnem == "NomAcLvl") {
+     msg.ulNomAcLvl = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd, 0.0010000000474974513, 0.0);
+        }
+        else if (mnem == "NomAcOutFreq") {
+     msg.uiNomAcOutFreq = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.009999999776482582, 0.0);
+        }
+    }
+void ProdInfoSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string ProdInfoSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double ProdInfoSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgCount") {
+            return 1.0 * (long double)(msg.ucMsgCount + 0.0);
+        }
+        else if (mnem == "ModelName") {
+            return 0.0;
+        }
+        else if (mnem == "Fga") {
+            return 0.0;
+        }
+        else if (mnem == "PwrLvl") {
+            return 1.0 * (long double)(msg.ulPwrLvl + 0.0);
+        }
+        else if (mnem == "NomDcLvl") {
+            return 0.0010000000474974513 * (long double)(msg.slNomDcLvl + 0.0);
+        }
+        else if (mnem == "NomAcLvl") {
+            return 0.0010000000474974513 * (long double)(msg.ulNomAcLvl + 0.0);
+        }
+        else if (mnem == "NomAcOutFreq") {
+            return 0.009999999776482582 * (long double)(msg.uiNomAcOutFreq + 0.0);
+        }
+        return 0.0;
+    }
+
+// DeviceStateSync
+std::string DeviceStateSync::fnGetValue(const std::string& mnem) const {
+        if (mnem == "ManufacturerCode") {
+            return std::to_string(msg.uiManufacturerCode);
+        }
+        else if (mnem == "PayloadID") {
+            return (msg.ucPayloadID == 0xff) ? "No Data" : (msg.ucPayloadID == 0xfe) ? "Out of range" : (msg.ucPayloadID == 0xfd) ? "Reserved" : std::to_string(msg.ucPayloadID);
+        }
+        else if (mnem == "Payload1") {
+            return (msg.ucPayload1 == 0xff) ? "No Data" : (msg.ucPayload1 == 0xfe) ? "Out of range" : (msg.ucPayload1 == 0xfd) ? "Reserved" : std::to_string(msg.ucPayload1);
+        }
+        else if (mnem == "Payload2") {
+            return (msg.ucPayload2 == 0xff) ? "No Data" : (msg.ucPayload2 == 0xfe) ? "Out of range" : (msg.ucPayload2 == 0xfd) ? "Reserved" : std::to_string(msg.ucPayload2);
+        }
+        else if (mnem == "Payload3") {
+            return (msg.ucPayload3 == 0xff) ? "No Data" : (msg.ucPayload3 == 0xfe) ? "Out of range" : (msg.ucPayload3 == 0xfd) ? "Reserved" : std::to_string(msg.ucPayload3);
+        }
+        else if (mnem == "Payload4") {
+            return (msg.ucPayload4 == 0xff) ? "No Data" : (msg.ucPayload4 == 0xfe) ? "Out of range" : (msg.ucPayload4 == 0xfd) ? "Reserved" : std::to_string(msg.ucPayload4);
+        }
+        else if (mnem == "Payload5") {
+            return (msg.ucPayload5 == 0xff) ? "No Data" : (msg.ucPayload5 == 0xfe) ? "Out of range" : (msg.ucPayload5 == 0xfd) ? "Reserved" : std::to_string(msg.ucPayload5);
+        }
+        else return "no pgn";
+    }
+void DeviceStateSync::Print() const {
+        std::cout << "PGN: DeviceStateSync" << std::endl;
+        cout << "ManufacturerCode      : " << fnGetValue("ManufacturerCode") << " (" << fnGetRawValue("ManufacturerCode") << ")" << endl;
+        cout << "PayloadID      : " << fnGetValue("PayloadID") << " (" << fnGetRawValue("PayloadID") << ")" << endl;
+        cout << "Payload1      : " << fnGetValue("Payload1") << " (" << fnGetRawValue("Payload1") << ")" << endl;
+        cout << "Payload2      : " << fnGetValue("Payload2") << " (" << fnGetRawValue("Payload2") << ")" << endl;
+        cout << "Payload3      : " << fnGetValue("Payload3") << " (" << fnGetRawValue("Payload3") << ")" << endl;
+        cout << "Payload4      : " << fnGetValue("Payload4") << " (" << fnGetRawValue("Payload4") << ")" << endl;
+        cout << "Payload5      : " << fnGetValue("Payload5") << " (" << fnGetRawValue("Payload5") << ")" << endl;
+    }
+bool DeviceStateSync::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 DeviceStateSync::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "ManufacturerCode") {
+            return static_cast<uint32_t>(msg.uiManufacturerCode);
+        }
+        else if (mnem == "PayloadID") {
+            return static_cast<uint32_t>(msg.ucPayloadID);
+        }
+        else if (mnem == "Payload1") {
+            return static_cast<uint32_t>(msg.ucPayload1);
+        }
+        else if (mnem == "Payload2") {
+            return static_cast<uint32_t>(msg.ucPayload2);
+        }
+        else if (mnem == "Payload3") {
+            return static_cast<uint32_t>(msg.ucPayload3);
+        }
+        else if (mnem == "Payload4") {
+            return static_cast<uint32_t>(msg.ucPayload4);
+        }
+        else if (mnem == "Payload5") {
+            return static_cast<uint32_t>(msg.ucPayload5);
+        }
+        return UINT32_MAX;
+    }
+void DeviceStateSync::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "ManufacturerCode") {
+     msg.uiManufacturerCode = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "PayloadID") {
+     msg.ucPayloadID = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Payload1") {
+     msg.ucPayload1 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Payload2") {
+     msg.ucPayload2 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Payload3") {
+     msg.ucPayload3 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Payload4") {
+     msg.ucPayload4 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Payload5") {
+     msg.ucPayload5 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void DeviceStateSync::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string DeviceStateSync::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double DeviceStateSync::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "ManufacturerCode") {
+            return 1.0 * (long double)(msg.uiManufacturerCode + 0.0);
+        }
+        else if (mnem == "PayloadID") {
+            return 1.0 * (long double)(msg.ucPayloadID + 0.0);
+        }
+        else if (mnem == "Payload1") {
+            return 1.0 * (long double)(msg.ucPayload1 + 0.0);
+        }
+        else if (mnem == "Payload2") {
+            return 1.0 * (long double)(msg.ucPayload2 + 0.0);
+        }
+        else if (mnem == "Payload3") {
+            return 1.0 * (long double)(msg.ucPayload3 + 0.0);
+        }
+        else if (mnem == "Payload4") {
+            return 1.0 * (long double)(msg.ucPayload4 + 0.0);
+        }
+        else if (mnem == "Payload5") {
+            return 1.0 * (long double)(msg.ucPayload5 + 0.0);
+        }
+        return 0.0;
+    }
+
+// AlarmCmd
+std::string AlarmCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DevType") {
+            if (!ENUMLOOKUP_8982.fnContains(msg.teDevType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDevType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8982.fnText(msg.teDevType));
+              }
+        }
+        else if (mnem == "ReadyAlarm") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teReadyAlarm)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teReadyAlarm);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teReadyAlarm));
+              }
+        }
+        else if (mnem == "AckAlarm") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teAckAlarm)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAckAlarm);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teAckAlarm));
+              }
+        }
+        else if (mnem == "AutoRstEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teAutoRstEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAutoRstEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teAutoRstEn));
+              }
+        }
+        else if (mnem == "DevInst") {
+            return std::to_string(msg.ucDevInst);
+        }
+        else return "no pgn";
+    }
+void AlarmCmd::Print() const {
+        std::cout << "PGN: AlarmCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DevType      : " << fnGetValue("DevType") << " (" << fnGetRawValue("DevType") << ")" << endl;
+        cout << "ReadyAlarm      : " << fnGetValue("ReadyAlarm") << " (" << fnGetRawValue("ReadyAlarm") << ")" << endl;
+        cout << "AckAlarm      : " << fnGetValue("AckAlarm") << " (" << fnGetRawValue("AckAlarm") << ")" << endl;
+        cout << "AutoRstEn      : " << fnGetValue("AutoRstEn") << " (" << fnGetRawValue("AutoRstEn") << ")" << endl;
+        cout << "DevInst      : " << fnGetValue("DevInst") << " (" << fnGetRawValue("DevInst") << ")" << endl;
+    }
+bool AlarmCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AlarmCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DevType") {
+            return static_cast<uint32_t>(msg.teDevType);
+        }
+        else if (mnem == "ReadyAlarm") {
+            return static_cast<uint32_t>(msg.teReadyAlarm);
+        }
+        else if (mnem == "AckAlarm") {
+            return static_cast<uint32_t>(msg.teAckAlarm);
+        }
+        else if (mnem == "AutoRstEn") {
+            return static_cast<uint32_t>(msg.teAutoRstEn);
+        }
+        else if (mnem == "DevInst") {
+            return static_cast<uint32_t>(msg.ucDevInst);
+        }
+        return UINT32_MAX;
+    }
+void AlarmCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DevType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8982, value);
+     if (enumValue != -1) msg.teDevType = static_cast<decltype(msg.teDevType)>(enumValue);
+     else msg.teDevType = static_cast<decltype(msg.teDevType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ReadyAlarm") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teReadyAlarm = static_cast<decltype(msg.teReadyAlarm)>(enumValue);
+     else msg.teReadyAlarm = static_cast<decltype(msg.teReadyAlarm)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AckAlarm") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teAckAlarm = static_cast<decltype(msg.teAckAlarm)>(enumValue);
+     else msg.teAckAlarm = static_cast<decltype(msg.teAckAlarm)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AutoRstEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teAutoRstEn = static_cast<decltype(msg.teAutoRstEn)>(enumValue);
+     else msg.teAutoRstEn = static_cast<decltype(msg.teAutoRstEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DevInst") {
+     msg.ucDevInst = stringToInt(value, 0, 0, 0);
+        }
+    }
+void AlarmCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AlarmCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AlarmCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DevType") {
+            return 1.0 * (long double)(msg.teDevType + 0.0);
+        }
+        else if (mnem == "ReadyAlarm") {
+            return 1.0 * (long double)(msg.teReadyAlarm + 0.0);
+        }
+        else if (mnem == "AckAlarm") {
+            return 1.0 * (long double)(msg.teAckAlarm + 0.0);
+        }
+        else if (mnem == "AutoRstEn") {
+            return 1.0 * (long double)(msg.teAutoRstEn + 0.0);
+        }
+        else if (mnem == "DevInst") {
+            return 1.0 * (long double)(msg.ucDevInst + 0.0);
+        }
+        return 0.0;
+    }
+
+// AlarmSts
+std::string AlarmSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DevType") {
+            if (!ENUMLOOKUP_8982.fnContains(msg.teDevType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDevType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8982.fnText(msg.teDevType));
+              }
+        }
+        else if (mnem == "AlarmTrig") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmTrig)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmTrig);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmTrig));
+              }
+        }
+        else if (mnem == "AlarmRdy") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmRdy)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmRdy);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmRdy));
+              }
+        }
+        else if (mnem == "AlarmAckd") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmAckd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmAckd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmAckd));
+              }
+        }
+        else if (mnem == "AlarmRstEn") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmRstEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmRstEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmRstEn));
+              }
+        }
+        else if (mnem == "ElapsedTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiElapsedTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiElapsedTime == 0xffff) ? "No Data" : (msg.uiElapsedTime == 0xfffe) ? "Out of range" : (msg.uiElapsedTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DevInst") {
+            return std::to_string(msg.ucDevInst);
+        }
+        else if (mnem == "FtMonReq") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFtMonReq)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFtMonReq);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFtMonReq));
+              }
+        }
+        else if (mnem == "AlarmForLog") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmForLog)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmForLog);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmForLog));
+              }
+        }
+        else if (mnem == "AlarmForUser") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmForUser)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmForUser);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmForUser));
+              }
+        }
+        else return "no pgn";
+    }
+void AlarmSts::Print() const {
+        std::cout << "PGN: AlarmSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DevType      : " << fnGetValue("DevType") << " (" << fnGetRawValue("DevType") << ")" << endl;
+        cout << "AlarmTrig      : " << fnGetValue("AlarmTrig") << " (" << fnGetRawValue("AlarmTrig") << ")" << endl;
+        cout << "AlarmRdy      : " << fnGetValue("AlarmRdy") << " (" << fnGetRawValue("AlarmRdy") << ")" << endl;
+        cout << "AlarmAckd      : " << fnGetValue("AlarmAckd") << " (" << fnGetRawValue("AlarmAckd") << ")" << endl;
+        cout << "AlarmRstEn      : " << fnGetValue("AlarmRstEn") << " (" << fnGetRawValue("AlarmRstEn") << ")" << endl;
+        cout << "ElapsedTime      : " << fnGetValue("ElapsedTime") << " (" << fnGetRawValue("ElapsedTime") << ")" << endl;
+        cout << "DevInst      : " << fnGetValue("DevInst") << " (" << fnGetRawValue("DevInst") << ")" << endl;
+        cout << "FtMonReq      : " << fnGetValue("FtMonReq") << " (" << fnGetRawValue("FtMonReq") << ")" << endl;
+        cout << "AlarmForLog      : " << fnGetValue("AlarmForLog") << " (" << fnGetRawValue("AlarmForLog") << ")" << endl;
+        cout << "AlarmForUser      : " << fnGetValue("AlarmForUser") << " (" << fnGetRawValue("AlarmForUser") << ")" << endl;
+    }
+bool AlarmSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 AlarmSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DevType") {
+            return static_cast<uint32_t>(msg.teDevType);
+        }
+        else if (mnem == "AlarmTrig") {
+            return static_cast<uint32_t>(msg.teAlarmTrig);
+        }
+        else if (mnem == "AlarmRdy") {
+            return static_cast<uint32_t>(msg.teAlarmRdy);
+        }
+        else if (mnem == "AlarmAckd") {
+            return static_cast<uint32_t>(msg.teAlarmAckd);
+        }
+        else if (mnem == "AlarmRstEn") {
+            return static_cast<uint32_t>(msg.teAlarmRstEn);
+        }
+        else if (mnem == "ElapsedTime") {
+            return static_cast<uint32_t>(msg.uiElapsedTime);
+        }
+        else if (mnem == "DevInst") {
+            return static_cast<uint32_t>(msg.ucDevInst);
+        }
+        else if (mnem == "FtMonReq") {
+            return static_cast<uint32_t>(msg.teFtMonReq);
+        }
+        else if (mnem == "AlarmForLog") {
+            return static_cast<uint32_t>(msg.teAlarmForLog);
+        }
+        else if (mnem == "AlarmForUser") {
+            return static_cast<uint32_t>(msg.teAlarmForUser);
+        }
+        return UINT32_MAX;
+    }
+void AlarmSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DevType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8982, value);
+     if (enumValue != -1) msg.teDevType = static_cast<decltype(msg.teDevType)>(enumValue);
+     else msg.teDevType = static_cast<decltype(msg.teDevType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmTrig") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmTrig = static_cast<decltype(msg.teAlarmTrig)>(enumValue);
+     else msg.teAlarmTrig = static_cast<decltype(msg.teAlarmTrig)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmRdy") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmRdy = static_cast<decltype(msg.teAlarmRdy)>(enumValue);
+     else msg.teAlarmRdy = static_cast<decltype(msg.teAlarmRdy)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmAckd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmAckd = static_cast<decltype(msg.teAlarmAckd)>(enumValue);
+     else msg.teAlarmAckd = static_cast<decltype(msg.teAlarmAckd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmRstEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmRstEn = static_cast<decltype(msg.teAlarmRstEn)>(enumValue);
+     else msg.teAlarmRstEn = static_cast<decltype(msg.teAlarmRstEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ElapsedTime") {
+     msg.uiElapsedTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "DevInst") {
+     msg.ucDevInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "FtMonReq") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFtMonReq = static_cast<decltype(msg.teFtMonReq)>(enumValue);
+     else msg.teFtMonReq = static_cast<decltype(msg.teFtMonReq)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmForLog") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmForLog = static_cast<decltype(msg.teAlarmForLog)>(enumValue);
+     else msg.teAlarmForLog = static_cast<decltype(msg.teAlarmForLog)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmForUser") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmForUser = static_cast<decltype(msg.teAlarmForUser)>(enumValue);
+     else msg.teAlarmForUser = static_cast<decltype(msg.teAlarmForUser)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void AlarmSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string AlarmSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double AlarmSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DevType") {
+            return 1.0 * (long double)(msg.teDevType + 0.0);
+        }
+        else if (mnem == "AlarmTrig") {
+            return 1.0 * (long double)(msg.teAlarmTrig + 0.0);
+        }
+        else if (mnem == "AlarmRdy") {
+            return 1.0 * (long double)(msg.teAlarmRdy + 0.0);
+        }
+        else if (mnem == "AlarmAckd") {
+            return 1.0 * (long double)(msg.teAlarmAckd + 0.0);
+        }
+        else if (mnem == "AlarmRstEn") {
+            return 1.0 * (long double)(msg.teAlarmRstEn + 0.0);
+        }
+        else if (mnem == "ElapsedTime") {
+            return 1.0 * (long double)(msg.uiElapsedTime + 0.0);
+        }
+        else if (mnem == "DevInst") {
+            return 1.0 * (long double)(msg.ucDevInst + 0.0);
+        }
+        else if (mnem == "FtMonReq") {
+            return 1.0 * (long double)(msg.teFtMonReq + 0.0);
+        }
+        else if (mnem == "AlarmForLog") {
+            return 1.0 * (long double)(msg.teAlarmForLog + 0.0);
+        }
+        else if (mnem == "AlarmForUser") {
+            return 1.0 * (long double)(msg.teAlarmForUser + 0.0);
+        }
+        return 0.0;
+    }
+
+// CommSts3
+std::string CommSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BusOffErrCnt") {
+            return (msg.uiBusOffErrCnt == 0xffff) ? "No Data" : (msg.uiBusOffErrCnt == 0xfffe) ? "Out of range" : (msg.uiBusOffErrCnt == 0xfffd) ? "Reserved" : std::to_string(msg.uiBusOffErrCnt);
+        }
+        else if (mnem == "RxFrameDropCnt") {
+            return (msg.uiRxFrameDropCnt == 0xffff) ? "No Data" : (msg.uiRxFrameDropCnt == 0xfffe) ? "Out of range" : (msg.uiRxFrameDropCnt == 0xfffd) ? "Reserved" : std::to_string(msg.uiRxFrameDropCnt);
+        }
+        else if (mnem == "TxFrameDropCnt") {
+            return (msg.uiTxFrameDropCnt == 0xffff) ? "No Data" : (msg.uiTxFrameDropCnt == 0xfffe) ? "Out of range" : (msg.uiTxFrameDropCnt == 0xfffd) ? "Reserved" : std::to_string(msg.uiTxFrameDropCnt);
+        }
+        else return "no pgn";
+    }
+void CommSts3::Print() const {
+        std::cout << "PGN: CommSts3" << std::endl;
+        cout << "BusOffErrCnt      : " << fnGetValue("BusOffErrCnt") << " (" << fnGetRawValue("BusOffErrCnt") << ")" << endl;
+        cout << "RxFrameDropCnt      : " << fnGetValue("RxFrameDropCnt") << " (" << fnGetRawValue("RxFrameDropCnt") << ")" << endl;
+        cout << "TxFrameDropCnt      : " << fnGetValue("TxFrameDropCnt") << " (" << fnGetRawValue("TxFrameDropCnt") << ")" << endl;
+    }
+bool CommSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 CommSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BusOffErrCnt") {
+            return static_cast<uint32_t>(msg.uiBusOffErrCnt);
+        }
+        else if (mnem == "RxFrameDropCnt") {
+            return static_cast<uint32_t>(msg.uiRxFrameDropCnt);
+        }
+        else if (mnem == "TxFrameDropCnt") {
+            return static_cast<uint32_t>(msg.uiTxFrameDropCnt);
+        }
+        return UINT32_MAX;
+    }
+void CommSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BusOffErrCnt") {
+     msg.uiBusOffErrCnt = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "RxFrameDropCnt") {
+     msg.uiRxFrameDropCnt = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "TxFrameDropCnt") {
+     msg.uiTxFrameDropCnt = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void CommSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string CommSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double CommSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BusOffErrCnt") {
+            return 1.0 * (long double)(msg.uiBusOffErrCnt + 0.0);
+        }
+        else if (mnem == "RxFrameDropCnt") {
+            return 1.0 * (long double)(msg.uiRxFrameDropCnt + 0.0);
+        }
+        else if (mnem == "TxFrameDropCnt") {
+            return 1.0 * (long double)(msg.uiTxFrameDropCnt + 0.0);
+        }
+        return 0.0;
+    }
+
+// CommSts2
+std::string CommSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "TxFramesCnt") {
+            return (msg.ulTxFramesCnt == 0xffffffff) ? "No Data" : (msg.ulTxFramesCnt == 0xfffffffe) ? "Out of range" : (msg.ulTxFramesCnt == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulTxFramesCnt);
+        }
+        else if (mnem == "RxFramesCnt") {
+            return (msg.ulRxFramesCnt == 0xffffffff) ? "No Data" : (msg.ulRxFramesCnt == 0xfffffffe) ? "Out of range" : (msg.ulRxFramesCnt == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulRxFramesCnt);
+        }
+        else return "no pgn";
+    }
+void CommSts2::Print() const {
+        std::cout << "PGN: CommSts2" << std::endl;
+        cout << "TxFramesCnt      : " << fnGetValue("TxFramesCnt") << " (" << fnGetRawValue("TxFramesCnt") << ")" << endl;
+        cout << "RxFramesCnt      : " << fnGetValue("RxFramesCnt") << " (" << fnGetRawValue("RxFramesCnt") << ")" << endl;
+    }
+bool CommSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 CommSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "TxFramesCnt") {
+            return static_cast<uint32_t>(msg.ulTxFramesCnt);
+        }
+        else if (mnem == "RxFramesCnt") {
+            return static_cast<uint32_t>(msg.ulRxFramesCnt);
+        }
+        return UINT32_MAX;
+    }
+void CommSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "TxFramesCnt") {
+     msg.ulTxFramesCnt = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "RxFramesCnt") {
+     msg.ulRxFramesCnt = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+    }
+void CommSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string CommSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double CommSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "TxFramesCnt") {
+            return 1.0 * (long double)(msg.ulTxFramesCnt + 0.0);
+        }
+        else if (mnem == "RxFramesCnt") {
+            return 1.0 * (long double)(msg.ulRxFramesCnt + 0.0);
+        }
+        return 0.0;
+    }
+
+// CommSts1
+std::string CommSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "TmrCnt") {
+            return (msg.ulTmrCnt == 0xffffffff) ? "No Data" : (msg.ulTmrCnt == 0xfffffffe) ? "Out of range" : (msg.ulTmrCnt == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulTmrCnt);
+        }
+        else if (mnem == "RxErrCnt") {
+            return (msg.uiRxErrCnt == 0xffff) ? "No Data" : (msg.uiRxErrCnt == 0xfffe) ? "Out of range" : (msg.uiRxErrCnt == 0xfffd) ? "Reserved" : std::to_string(msg.uiRxErrCnt);
+        }
+        else if (mnem == "TxErrCnt") {
+            return (msg.uiTxErrCnt == 0xffff) ? "No Data" : (msg.uiTxErrCnt == 0xfffe) ? "Out of range" : (msg.uiTxErrCnt == 0xfffd) ? "Reserved" : std::to_string(msg.uiTxErrCnt);
+        }
+        else return "no pgn";
+    }
+void CommSts1::Print() const {
+        std::cout << "PGN: CommSts1" << std::endl;
+        cout << "TmrCnt      : " << fnGetValue("TmrCnt") << " (" << fnGetRawValue("TmrCnt") << ")" << endl;
+        cout << "RxErrCnt      : " << fnGetValue("RxErrCnt") << " (" << fnGetRawValue("RxErrCnt") << ")" << endl;
+        cout << "TxErrCnt      : " << fnGetValue("TxErrCnt") << " (" << fnGetRawValue("TxErrCnt") << ")" << endl;
+    }
+bool CommSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 CommSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "TmrCnt") {
+            return static_cast<uint32_t>(msg.ulTmrCnt);
+        }
+        else if (mnem == "RxErrCnt") {
+            return static_cast<uint32_t>(msg.uiRxErrCnt);
+        }
+        else if (mnem == "TxErrCnt") {
+            return static_cast<uint32_t>(msg.uiTxErrCnt);
+        }
+        return UINT32_MAX;
+    }
+void CommSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "TmrCnt") {
+     msg.ulTmrCnt = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "RxErrCnt") {
+     msg.uiRxErrCnt = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "TxErrCnt") {
+     msg.uiTxErrCnt = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void CommSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string CommSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double CommSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "TmrCnt") {
+            return 1.0 * (long double)(msg.ulTmrCnt + 0.0);
+        }
+        else if (mnem == "RxErrCnt") {
+            return 1.0 * (long double)(msg.uiRxErrCnt + 0.0);
+        }
+        else if (mnem == "TxErrCnt") {
+            return 1.0 * (long double)(msg.uiTxErrCnt + 0.0);
+        }
+        return 0.0;
+    }
+
+// SetSysDateTime
+std::string SetSysDateTime::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Yr") {
+            return (msg.ucYr == 0xff) ? "No Data" : (msg.ucYr == 0xfe) ? "Out of range" : (msg.ucYr == 0xfd) ? "Reserved" : std::to_string(msg.ucYr);
+        }
+        else if (mnem == "Mn") {
+            return (msg.ucMn == 0xff) ? "No Data" : (msg.ucMn == 0xfe) ? "Out of range" : (msg.ucMn == 0xfd) ? "Reserved" : std::to_string(msg.ucMn);
+        }
+        else if (mnem == "Date") {
+            return (msg.ucDate == 0xff) ? "No Data" : (msg.ucDate == 0xfe) ? "Out of range" : (msg.ucDate == 0xfd) ? "Reserved" : std::to_string(msg.ucDate);
+        }
+        else if (mnem == "Dow") {
+            return (msg.ucDow == 0xff) ? "No Data" : (msg.ucDow == 0xfe) ? "Out of range" : (msg.ucDow == 0xfd) ? "Reserved" : std::to_string(msg.ucDow);
+        }
+        else if (mnem == "Hr") {
+            return (msg.ucHr == 0xff) ? "No Data" : (msg.ucHr == 0xfe) ? "Out of range" : (msg.ucHr == 0xfd) ? "Reserved" : std::to_string(msg.ucHr);
+        }
+        else if (mnem == "Min") {
+            return (msg.ucMin == 0xff) ? "No Data" : (msg.ucMin == 0xfe) ? "Out of range" : (msg.ucMin == 0xfd) ? "Reserved" : std::to_string(msg.ucMin);
+        }
+        else if (mnem == "Sec") {
+            return (msg.ucSec == 0xff) ? "No Data" : (msg.ucSec == 0xfe) ? "Out of range" : (msg.ucSec == 0xfd) ? "Reserved" : std::to_string(msg.ucSec);
+        }
+        else if (mnem == "Tz") {
+            return (msg.ucTz == 0xff) ? "No Data" : (msg.ucTz == 0xfe) ? "Out of range" : (msg.ucTz == 0xfd) ? "Reserved" : std::to_string(msg.ucTz);
+        }
+        else return "no pgn";
+    }
+void SetSysDateTime::Print() const {
+        std::cout << "PGN: SetSysDateTime" << std::endl;
+        cout << "Yr      : " << fnGetValue("Yr") << " (" << fnGetRawValue("Yr") << ")" << endl;
+        cout << "Mn      : " << fnGetValue("Mn") << " (" << fnGetRawValue("Mn") << ")" << endl;
+        cout << "Date      : " << fnGetValue("Date") << " (" << fnGetRawValue("Date") << ")" << endl;
+        cout << "Dow      : " << fnGetValue("Dow") << " (" << fnGetRawValue("Dow") << ")" << endl;
+        cout << "Hr      : " << fnGetValue("Hr") << " (" << fnGetRawValue("Hr") << ")" << endl;
+        cout << "Min      : " << fnGetValue("Min") << " (" << fnGetRawValue("Min") << ")" << endl;
+        cout << "Sec      : " << fnGetValue("Sec") << " (" << fnGetRawValue("Sec") << ")" << endl;
+        cout << "Tz      : " << fnGetValue("Tz") << " (" << fnGetRawValue("Tz") << ")" << endl;
+    }
+bool SetSysDateTime::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SetSysDateTime::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Yr") {
+            return static_cast<uint32_t>(msg.ucYr);
+        }
+        else if (mnem == "Mn") {
+            return static_cast<uint32_t>(msg.ucMn);
+        }
+        else if (mnem == "Date") {
+            return static_cast<uint32_t>(msg.ucDate);
+        }
+        else if (mnem == "Dow") {
+            return static_cast<uint32_t>(msg.ucDow);
+        }
+        else if (mnem == "Hr") {
+            return static_cast<uint32_t>(msg.ucHr);
+        }
+        else if (mnem == "Min") {
+            return static_cast<uint32_t>(msg.ucMin);
+        }
+        else if (mnem == "Sec") {
+            return static_cast<uint32_t>(msg.ucSec);
+        }
+        else if (mnem == "Tz") {
+            return static_cast<uint32_t>(msg.ucTz);
+        }
+        return UINT32_MAX;
+    }
+void SetSysDateTime::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Yr") {
+     msg.ucYr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Mn") {
+     msg.ucMn = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Date") {
+     msg.ucDate = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Dow") {
+     msg.ucDow = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Hr") {
+     msg.ucHr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Min") {
+     msg.ucMin = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Sec") {
+     msg.ucSec = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Tz") {
+     msg.ucTz = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void SetSysDateTime::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SetSysDateTime::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SetSysDateTime::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Yr") {
+            return 1.0 * (long double)(msg.ucYr + 0.0);
+        }
+        else if (mnem == "Mn") {
+            return 1.0 * (long double)(msg.ucMn + 0.0);
+        }
+        else if (mnem == "Date") {
+            return 1.0 * (long double)(msg.ucDate + 0.0);
+        }
+        else if (mnem == "Dow") {
+            return 1.0 * (long double)(msg.ucDow + 0.0);
+        }
+        else if (mnem == "Hr") {
+            return 1.0 * (long double)(msg.ucHr + 0.0);
+        }
+        else if (mnem == "Min") {
+            return 1.0 * (long double)(msg.ucMin + 0.0);
+        }
+        else if (mnem == "Sec") {
+            return 1.0 * (long double)(msg.ucSec + 0.0);
+        }
+        else if (mnem == "Tz") {
+            return 1.0 * (long double)(msg.ucTz + 0.0);
+        }
+        return 0.0;
+    }
+
+// SysDateTimeSts
+std::string SysDateTimeSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Yr") {
+            return (msg.ucYr == 0xff) ? "No Data" : (msg.ucYr == 0xfe) ? "Out of range" : (msg.ucYr == 0xfd) ? "Reserved" : std::to_string(msg.ucYr);
+        }
+        else if (mnem == "Mn") {
+            return (msg.ucMn == 0xff) ? "No Data" : (msg.ucMn == 0xfe) ? "Out of range" : (msg.ucMn == 0xfd) ? "Reserved" : std::to_string(msg.ucMn);
+        }
+        else if (mnem == "Date") {
+            return (msg.ucDate == 0xff) ? "No Data" : (msg.ucDate == 0xfe) ? "Out of range" : (msg.ucDate == 0xfd) ? "Reserved" : std::to_string(msg.ucDate);
+        }
+        else if (mnem == "Dow") {
+            return (msg.ucDow == 0xff) ? "No Data" : (msg.ucDow == 0xfe) ? "Out of range" : (msg.ucDow == 0xfd) ? "Reserved" : std::to_string(msg.ucDow);
+        }
+        else if (mnem == "Hr") {
+            return (msg.ucHr == 0xff) ? "No Data" : (msg.ucHr == 0xfe) ? "Out of range" : (msg.ucHr == 0xfd) ? "Reserved" : std::to_string(msg.ucHr);
+        }
+        else if (mnem == "Min") {
+            return (msg.ucMin == 0xff) ? "No Data" : (msg.ucMin == 0xfe) ? "Out of range" : (msg.ucMin == 0xfd) ? "Reserved" : std::to_string(msg.ucMin);
+        }
+        else if (mnem == "Sec") {
+            return (msg.ucSec == 0xff) ? "No Data" : (msg.ucSec == 0xfe) ? "Out of range" : (msg.ucSec == 0xfd) ? "Reserved" : std::to_string(msg.ucSec);
+        }
+        else if (mnem == "Tz") {
+            return (msg.ucTz == 0xff) ? "No Data" : (msg.ucTz == 0xfe) ? "Out of range" : (msg.ucTz == 0xfd) ? "Reserved" : std::to_string(msg.ucTz);
+        }
+        else return "no pgn";
+    }
+void SysDateTimeSts::Print() const {
+        std::cout << "PGN: SysDateTimeSts" << std::endl;
+        cout << "Yr      : " << fnGetValue("Yr") << " (" << fnGetRawValue("Yr") << ")" << endl;
+        cout << "Mn      : " << fnGetValue("Mn") << " (" << fnGetRawValue("Mn") << ")" << endl;
+        cout << "Date      : " << fnGetValue("Date") << " (" << fnGetRawValue("Date") << ")" << endl;
+        cout << "Dow      : " << fnGetValue("Dow") << " (" << fnGetRawValue("Dow") << ")" << endl;
+        cout << "Hr      : " << fnGetValue("Hr") << " (" << fnGetRawValue("Hr") << ")" << endl;
+        cout << "Min      : " << fnGetValue("Min") << " (" << fnGetRawValue("Min") << ")" << endl;
+        cout << "Sec      : " << fnGetValue("Sec") << " (" << fnGetRawValue("Sec") << ")" << endl;
+        cout << "Tz      : " << fnGetValue("Tz") << " (" << fnGetRawValue("Tz") << ")" << endl;
+    }
+bool SysDateTimeSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SysDateTimeSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Yr") {
+            return static_cast<uint32_t>(msg.ucYr);
+        }
+        else if (mnem == "Mn") {
+            return static_cast<uint32_t>(msg.ucMn);
+        }
+        else if (mnem == "Date") {
+            return static_cast<uint32_t>(msg.ucDate);
+        }
+        else if (mnem == "Dow") {
+            return static_cast<uint32_t>(msg.ucDow);
+        }
+        else if (mnem == "Hr") {
+            return static_cast<uint32_t>(msg.ucHr);
+        }
+        else if (mnem == "Min") {
+            return static_cast<uint32_t>(msg.ucMin);
+        }
+        else if (mnem == "Sec") {
+            return static_cast<uint32_t>(msg.ucSec);
+        }
+        else if (mnem == "Tz") {
+            return static_cast<uint32_t>(msg.ucTz);
+        }
+        return UINT32_MAX;
+    }
+void SysDateTimeSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Yr") {
+     msg.ucYr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Mn") {
+     msg.ucMn = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Date") {
+     msg.ucDate = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Dow") {
+     msg.ucDow = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Hr") {
+     msg.ucHr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Min") {
+     msg.ucMin = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Sec") {
+     msg.ucSec = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Tz") {
+     msg.ucTz = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void SysDateTimeSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SysDateTimeSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SysDateTimeSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Yr") {
+            return 1.0 * (long double)(msg.ucYr + 0.0);
+        }
+        else if (mnem == "Mn") {
+            return 1.0 * (long double)(msg.ucMn + 0.0);
+        }
+        else if (mnem == "Date") {
+            return 1.0 * (long double)(msg.ucDate + 0.0);
+        }
+        else if (mnem == "Dow") {
+            return 1.0 * (long double)(msg.ucDow + 0.0);
+        }
+        else if (mnem == "Hr") {
+            return 1.0 * (long double)(msg.ucHr + 0.0);
+        }
+        else if (mnem == "Min") {
+            return 1.0 * (long double)(msg.ucMin + 0.0);
+        }
+        else if (mnem == "Sec") {
+            return 1.0 * (long double)(msg.ucSec + 0.0);
+        }
+        else if (mnem == "Tz") {
+            return 1.0 * (long double)(msg.ucTz + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_common_registrars[] = {
+{"ProdIdent", [](void * rcv) { return std::make_unique<ProdIdent>(rcv); }, []() { return std::make_unique<ProdIdent>(); } },
+{"FileDnldBlk", [](void * rcv) { return std::make_unique<FileDnldBlk>(rcv); }, []() { return std::make_unique<FileDnldBlk>(); } },
+{"SwVerSts", [](void * rcv) { return std::make_unique<SwVerSts>(rcv); }, []() { return std::make_unique<SwVerSts>(); } },
+{"DiagMsg1", [](void * rcv) { return std::make_unique<DiagMsg1>(rcv); }, []() { return std::make_unique<DiagMsg1>(); } },
+{"XbResetCmd", [](void * rcv) { return std::make_unique<XbResetCmd>(rcv); }, []() { return std::make_unique<XbResetCmd>(); } },
+{"FileDnldInf", [](void * rcv) { return std::make_unique<FileDnldInf>(rcv); }, []() { return std::make_unique<FileDnldInf>(); } },
+{"SimpleCalibCfg", [](void * rcv) { return std::make_unique<SimpleCalibCfg>(rcv); }, []() { return std::make_unique<SimpleCalibCfg>(); } },
+{"FileDnldSts", [](void * rcv) { return std::make_unique<FileDnldSts>(rcv); }, []() { return std::make_unique<FileDnldSts>(); } },
+{"InstSts", [](void * rcv) { return std::make_unique<InstSts>(rcv); }, []() { return std::make_unique<InstSts>(); } },
+{"InstAssign", [](void * rcv) { return std::make_unique<InstAssign>(rcv); }, []() { return std::make_unique<InstAssign>(); } },
+{"VirtualTerminal", [](void * rcv) { return std::make_unique<VirtualTerminal>(rcv); }, []() { return std::make_unique<VirtualTerminal>(); } },
+{"ProdInfoSts", [](void * rcv) { return std::make_unique<ProdInfoSts>(rcv); }, []() { return std::make_unique<ProdInfoSts>(); } },
+{"DeviceStateSync", [](void * rcv) { return std::make_unique<DeviceStateSync>(rcv); }, []() { return std::make_unique<DeviceStateSync>(); } },
+{"AlarmCmd", [](void * rcv) { return std::make_unique<AlarmCmd>(rcv); }, []() { return std::make_unique<AlarmCmd>(); } },
+{"AlarmSts", [](void * rcv) { return std::make_unique<AlarmSts>(rcv); }, []() { return std::make_unique<AlarmSts>(); } },
+{"CommSts3", [](void * rcv) { return std::make_unique<CommSts3>(rcv); }, []() { return std::make_unique<CommSts3>(); } },
+{"CommSts2", [](void * rcv) { return std::make_unique<CommSts2>(rcv); }, []() { return std::make_unique<CommSts2>(); } },
+{"CommSts1", [](void * rcv) { return std::make_unique<CommSts1>(rcv); }, []() { return std::make_unique<CommSts1>(); } },
+{"SetSysDateTime", [](void * rcv) { return std::make_unique<SetSysDateTime>(rcv); }, []() { return std::make_unique<SetSysDateTime>(); } },
+{"SysDateTimeSts", [](void * rcv) { return std::make_unique<SysDateTimeSts>(rcv); }, []() { return std::make_unique<SysDateTimeSts>(); } },
+};
+static const PrinterRegistrar pgn_common_printers[] = {
+{65259, -1, fnPrintMessage<ProdIdent>},
+{78080, -1, fnPrintMessage<FileDnldBlk>},
+{129038, -1, fnPrintMessage<SwVerSts>},
+{130762, -1, fnPrintMessage<DiagMsg1>},
+{74752, -1, fnPrintMessage<XbResetCmd>},
+{78336, -1, fnPrintMessage<FileDnldInf>},
+{79872, -1, fnPrintMessage<SimpleCalibCfg>},
+{80640, -1, fnPrintMessage<FileDnldSts>},
+{97024, -1, fnPrintMessage<InstSts>},
+{97280, -1, fnPrintMessage<InstAssign>},
+{97792, -1, fnPrintMessage<VirtualTerminal>},
+{126996, -1, fnPrintMessage<ProdInfoSts>},
+{130513, -1, fnPrintMessage<DeviceStateSync>},
+{130718, -1, fnPrintMessage<AlarmCmd>},
+{130719, -1, fnPrintMessage<AlarmSts>},
+{131064, -1, fnPrintMessage<CommSts3>},
+{131065, -1, fnPrintMessage<CommSts2>},
+{131066, -1, fnPrintMessage<CommSts1>},
+{131070, -1, fnPrintMessage<SetSysDateTime>},
+{131071, -1, fnPrintMessage<SysDateTimeSts>},
+};
@@ -0,0 +1,1223 @@
+// Auto-generated by generate_print_functions.py: gen message classes
+#include "print_functions3.h"
+
+// GenRst
+std::string GenRst::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Reboot") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teReboot)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teReboot);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teReboot));
+              }
+        }
+        else if (mnem == "ClrFlts") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teClrFlts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teClrFlts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teClrFlts));
+              }
+        }
+        else if (mnem == "RstDflt") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teRstDflt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teRstDflt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teRstDflt));
+              }
+        }
+        else if (mnem == "RstStats") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teRstStats)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teRstStats);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teRstStats));
+              }
+        }
+        else if (mnem == "TestMd") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teTestMd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTestMd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teTestMd));
+              }
+        }
+        else if (mnem == "RstOEM") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teRstOEM)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teRstOEM);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teRstOEM));
+              }
+        }
+        else if (mnem == "RstLdr") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teRstLdr)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teRstLdr);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teRstLdr));
+              }
+        }
+        else return "no pgn";
+    }
+void GenRst::Print() const {
+        std::cout << "PGN: GenRst" << std::endl;
+        cout << "Reboot      : " << fnGetValue("Reboot") << " (" << fnGetRawValue("Reboot") << ")" << endl;
+        cout << "ClrFlts      : " << fnGetValue("ClrFlts") << " (" << fnGetRawValue("ClrFlts") << ")" << endl;
+        cout << "RstDflt      : " << fnGetValue("RstDflt") << " (" << fnGetRawValue("RstDflt") << ")" << endl;
+        cout << "RstStats      : " << fnGetValue("RstStats") << " (" << fnGetRawValue("RstStats") << ")" << endl;
+        cout << "TestMd      : " << fnGetValue("TestMd") << " (" << fnGetRawValue("TestMd") << ")" << endl;
+        cout << "RstOEM      : " << fnGetValue("RstOEM") << " (" << fnGetRawValue("RstOEM") << ")" << endl;
+        cout << "RstLdr      : " << fnGetValue("RstLdr") << " (" << fnGetRawValue("RstLdr") << ")" << endl;
+    }
+bool GenRst::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenRst::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Reboot") {
+            return static_cast<uint32_t>(msg.teReboot);
+        }
+        else if (mnem == "ClrFlts") {
+            return static_cast<uint32_t>(msg.teClrFlts);
+        }
+        else if (mnem == "RstDflt") {
+            return static_cast<uint32_t>(msg.teRstDflt);
+        }
+        else if (mnem == "RstStats") {
+            return static_cast<uint32_t>(msg.teRstStats);
+        }
+        else if (mnem == "TestMd") {
+            return static_cast<uint32_t>(msg.teTestMd);
+        }
+        else if (mnem == "RstOEM") {
+            return static_cast<uint32_t>(msg.teRstOEM);
+        }
+        else if (mnem == "RstLdr") {
+            return static_cast<uint32_t>(msg.teRstLdr);
+        }
+        return UINT32_MAX;
+    }
+void GenRst::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Reboot") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teReboot = static_cast<decltype(msg.teReboot)>(enumValue);
+     else msg.teReboot = static_cast<decltype(msg.teReboot)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ClrFlts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teClrFlts = static_cast<decltype(msg.teClrFlts)>(enumValue);
+     else msg.teClrFlts = static_cast<decltype(msg.teClrFlts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RstDflt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teRstDflt = static_cast<decltype(msg.teRstDflt)>(enumValue);
+     else msg.teRstDflt = static_cast<decltype(msg.teRstDflt)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RstStats") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teRstStats = static_cast<decltype(msg.teRstStats)>(enumValue);
+     else msg.teRstStats = static_cast<decltype(msg.teRstStats)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TestMd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teTestMd = static_cast<decltype(msg.teTestMd)>(enumValue);
+     else msg.teTestMd = static_cast<decltype(msg.teTestMd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RstOEM") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teRstOEM = static_cast<decltype(msg.teRstOEM)>(enumValue);
+     else msg.teRstOEM = static_cast<decltype(msg.teRstOEM)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RstLdr") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teRstLdr = static_cast<decltype(msg.teRstLdr)>(enumValue);
+     else msg.teRstLdr = static_cast<decltype(msg.teRstLdr)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void GenRst::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenRst::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenRst::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Reboot") {
+            return 1.0 * (long double)(msg.teReboot + 0.0);
+        }
+        else if (mnem == "ClrFlts") {
+            return 1.0 * (long double)(msg.teClrFlts + 0.0);
+        }
+        else if (mnem == "RstDflt") {
+            return 1.0 * (long double)(msg.teRstDflt + 0.0);
+        }
+        else if (mnem == "RstStats") {
+            return 1.0 * (long double)(msg.teRstStats + 0.0);
+        }
+        else if (mnem == "TestMd") {
+            return 1.0 * (long double)(msg.teTestMd + 0.0);
+        }
+        else if (mnem == "RstOEM") {
+            return 1.0 * (long double)(msg.teRstOEM + 0.0);
+        }
+        else if (mnem == "RstLdr") {
+            return 1.0 * (long double)(msg.teRstLdr + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenDemandCmd
+std::string GenDemandCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "GenDemand") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teGenDemand)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenDemand);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teGenDemand));
+              }
+        }
+        else if (mnem == "QuietTimeOverride") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teQuietTimeOverride)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teQuietTimeOverride);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teQuietTimeOverride));
+              }
+        }
+        else if (mnem == "ExtActRst") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teExtActRst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teExtActRst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teExtActRst));
+              }
+        }
+        else if (mnem == "ManOverride") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teManOverride)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teManOverride);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teManOverride));
+              }
+        }
+        else if (mnem == "GenLock") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teGenLock)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenLock);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teGenLock));
+              }
+        }
+        else if (mnem == "SetQuietTimeBeginHr") {
+            return (msg.ucSetQuietTimeBeginHr == 0xff) ? "No Data" : (msg.ucSetQuietTimeBeginHr == 0xfe) ? "Out of range" : (msg.ucSetQuietTimeBeginHr == 0xfd) ? "Reserved" : std::to_string(msg.ucSetQuietTimeBeginHr);
+        }
+        else if (mnem == "SetQuietTimeBeginMin") {
+            return (msg.ucSetQuietTimeBeginMin == 0xff) ? "No Data" : (msg.ucSetQuietTimeBeginMin == 0xfe) ? "Out of range" : (msg.ucSetQuietTimeBeginMin == 0xfd) ? "Reserved" : std::to_string(msg.ucSetQuietTimeBeginMin);
+        }
+        else if (mnem == "SetQuietTimeEndHr") {
+            return (msg.ucSetQuietTimeEndHr == 0xff) ? "No Data" : (msg.ucSetQuietTimeEndHr == 0xfe) ? "Out of range" : (msg.ucSetQuietTimeEndHr == 0xfd) ? "Reserved" : std::to_string(msg.ucSetQuietTimeEndHr);
+        }
+        else if (mnem == "SetQuietTimeEndMin") {
+            return (msg.ucSetQuietTimeEndMin == 0xff) ? "No Data" : (msg.ucSetQuietTimeEndMin == 0xfe) ? "Out of range" : (msg.ucSetQuietTimeEndMin == 0xfd) ? "Reserved" : std::to_string(msg.ucSetQuietTimeEndMin);
+        }
+        else if (mnem == "SetMinCycTime") {
+            return (msg.ucSetMinCycTime == 0xff) ? "No Data" : (msg.ucSetMinCycTime == 0xfe) ? "Out of range" : (msg.ucSetMinCycTime == 0xfd) ? "Reserved" : std::to_string(msg.ucSetMinCycTime);
+        }
+        else return "no pgn";
+    }
+void GenDemandCmd::Print() const {
+        std::cout << "PGN: GenDemandCmd" << std::endl;
+        cout << "GenDemand      : " << fnGetValue("GenDemand") << " (" << fnGetRawValue("GenDemand") << ")" << endl;
+        cout << "QuietTimeOverride      : " << fnGetValue("QuietTimeOverride") << " (" << fnGetRawValue("QuietTimeOverride") << ")" << endl;
+        cout << "ExtActRst      : " << fnGetValue("ExtActRst") << " (" << fnGetRawValue("ExtActRst") << ")" << endl;
+        cout << "ManOverride      : " << fnGetValue("ManOverride") << " (" << fnGetRawValue("ManOverride") << ")" << endl;
+        cout << "GenLock      : " << fnGetValue("GenLock") << " (" << fnGetRawValue("GenLock") << ")" << endl;
+        cout << "SetQuietTimeBeginHr      : " << fnGetValue("SetQuietTimeBeginHr") << " (" << fnGetRawValue("SetQuietTimeBeginHr") << ")" << endl;
+        cout << "SetQuietTimeBeginMin      : " << fnGetValue("SetQuietTimeBeginMin") << " (" << fnGetRawValue("SetQuietTimeBeginMin") << ")" << endl;
+        cout << "SetQuietTimeEndHr      : " << fnGetValue("SetQuietTimeEndHr") << " (" << fnGetRawValue("SetQuietTimeEndHr") << ")" << endl;
+        cout << "SetQuietTimeEndMin      : " << fnGetValue("SetQuietTimeEndMin") << " (" << fnGetRawValue("SetQuietTimeEndMin") << ")" << endl;
+        cout << "SetMinCycTime      : " << fnGetValue("SetMinCycTime") << " (" << fnGetRawValue("SetMinCycTime") << ")" << endl;
+    }
+bool GenDemandCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenDemandCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "GenDemand") {
+            return static_cast<uint32_t>(msg.teGenDemand);
+        }
+        else if (mnem == "QuietTimeOverride") {
+            return static_cast<uint32_t>(msg.teQuietTimeOverride);
+        }
+        else if (mnem == "ExtActRst") {
+            return static_cast<uint32_t>(msg.teExtActRst);
+        }
+        else if (mnem == "ManOverride") {
+            return static_cast<uint32_t>(msg.teManOverride);
+        }
+        else if (mnem == "GenLock") {
+            return static_cast<uint32_t>(msg.teGenLock);
+        }
+        else if (mnem == "SetQuietTimeBeginHr") {
+            return static_cast<uint32_t>(msg.ucSetQuietTimeBeginHr);
+        }
+        else if (mnem == "SetQuietTimeBeginMin") {
+            return static_cast<uint32_t>(msg.ucSetQuietTimeBeginMin);
+        }
+        else if (mnem == "SetQuietTimeEndHr") {
+            return static_cast<uint32_t>(msg.ucSetQuietTimeEndHr);
+        }
+        else if (mnem == "SetQuietTimeEndMin") {
+            return static_cast<uint32_t>(msg.ucSetQuietTimeEndMin);
+        }
+        else if (mnem == "SetMinCycTime") {
+            return static_cast<uint32_t>(msg.ucSetMinCycTime);
+        }
+        return UINT32_MAX;
+    }
+void GenDemandCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "GenDemand") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teGenDemand = static_cast<decltype(msg.teGenDemand)>(enumValue);
+     else msg.teGenDemand = static_cast<decltype(msg.teGenDemand)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "QuietTimeOverride") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teQuietTimeOverride = static_cast<decltype(msg.teQuietTimeOverride)>(enumValue);
+     else msg.teQuietTimeOverride = static_cast<decltype(msg.teQuietTimeOverride)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ExtActRst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teExtActRst = static_cast<decltype(msg.teExtActRst)>(enumValue);
+     else msg.teExtActRst = static_cast<decltype(msg.teExtActRst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ManOverride") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teManOverride = static_cast<decltype(msg.teManOverride)>(enumValue);
+     else msg.teManOverride = static_cast<decltype(msg.teManOverride)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenLock") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teGenLock = static_cast<decltype(msg.teGenLock)>(enumValue);
+     else msg.teGenLock = static_cast<decltype(msg.teGenLock)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SetQuietTimeBeginHr") {
+     msg.ucSetQuietTimeBeginHr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "SetQuietTimeBeginMin") {
+     msg.ucSetQuietTimeBeginMin = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "SetQuietTimeEndHr") {
+     msg.ucSetQuietTimeEndHr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "SetQuietTimeEndMin") {
+     msg.ucSetQuietTimeEndMin = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "SetMinCycTime") {
+     msg.ucSetMinCycTime = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void GenDemandCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenDemandCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenDemandCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "GenDemand") {
+            return 1.0 * (long double)(msg.teGenDemand + 0.0);
+        }
+        else if (mnem == "QuietTimeOverride") {
+            return 1.0 * (long double)(msg.teQuietTimeOverride + 0.0);
+        }
+        else if (mnem == "ExtActRst") {
+            return 1.0 * (long double)(msg.teExtActRst + 0.0);
+        }
+        else if (mnem == "ManOverride") {
+            return 1.0 * (long double)(msg.teManOverride + 0.0);
+        }
+        else if (mnem == "GenLock") {
+            return 1.0 * (long double)(msg.teGenLock + 0.0);
+        }
+        else if (mnem == "SetQuietTimeBeginHr") {
+            return 1.0 * (long double)(msg.ucSetQuietTimeBeginHr + 0.0);
+        }
+        else if (mnem == "SetQuietTimeBeginMin") {
+            return 1.0 * (long double)(msg.ucSetQuietTimeBeginMin + 0.0);
+        }
+        else if (mnem == "SetQuietTimeEndHr") {
+            return 1.0 * (long double)(msg.ucSetQuietTimeEndHr + 0.0);
+        }
+        else if (mnem == "SetQuietTimeEndMin") {
+            return 1.0 * (long double)(msg.ucSetQuietTimeEndMin + 0.0);
+        }
+        else if (mnem == "SetMinCycTime") {
+            return 1.0 * (long double)(msg.ucSetMinCycTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenDemandSts
+std::string GenDemandSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "GenDemand") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teGenDemand)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenDemand);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teGenDemand));
+              }
+        }
+        else if (mnem == "IntGenDemand") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teIntGenDemand)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teIntGenDemand);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teIntGenDemand));
+              }
+        }
+        else if (mnem == "NetGenDemand") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teNetGenDemand)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teNetGenDemand);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teNetGenDemand));
+              }
+        }
+        else if (mnem == "ExtActDetect") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teExtActDetect)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teExtActDetect);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teExtActDetect));
+              }
+        }
+        else if (mnem == "ManOverrideDetect") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teManOverrideDetect)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teManOverrideDetect);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teManOverrideDetect));
+              }
+        }
+        else if (mnem == "QuietTime") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teQuietTime)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teQuietTime);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teQuietTime));
+              }
+        }
+        else if (mnem == "QuietTimeOverride") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teQuietTimeOverride)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teQuietTimeOverride);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teQuietTimeOverride));
+              }
+        }
+        else if (mnem == "GenLock") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teGenLock)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenLock);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teGenLock));
+              }
+        }
+        else if (mnem == "QuietTimeBeginHr") {
+            return (msg.ucQuietTimeBeginHr == 0xff) ? "No Data" : (msg.ucQuietTimeBeginHr == 0xfe) ? "Out of range" : (msg.ucQuietTimeBeginHr == 0xfd) ? "Reserved" : std::to_string(msg.ucQuietTimeBeginHr);
+        }
+        else if (mnem == "QuietTimeBeginMin") {
+            return (msg.ucQuietTimeBeginMin == 0xff) ? "No Data" : (msg.ucQuietTimeBeginMin == 0xfe) ? "Out of range" : (msg.ucQuietTimeBeginMin == 0xfd) ? "Reserved" : std::to_string(msg.ucQuietTimeBeginMin);
+        }
+        else if (mnem == "QuietTimeEndHr") {
+            return (msg.ucQuietTimeEndHr == 0xff) ? "No Data" : (msg.ucQuietTimeEndHr == 0xfe) ? "Out of range" : (msg.ucQuietTimeEndHr == 0xfd) ? "Reserved" : std::to_string(msg.ucQuietTimeEndHr);
+        }
+        else if (mnem == "QuietTimeEndMin") {
+            return (msg.ucQuietTimeEndMin == 0xff) ? "No Data" : (msg.ucQuietTimeEndMin == 0xfe) ? "Out of range" : (msg.ucQuietTimeEndMin == 0xfd) ? "Reserved" : std::to_string(msg.ucQuietTimeEndMin);
+        }
+        else if (mnem == "MinCycTime") {
+            return (msg.ucMinCycTime == 0xff) ? "No Data" : (msg.ucMinCycTime == 0xfe) ? "Out of range" : (msg.ucMinCycTime == 0xfd) ? "Reserved" : std::to_string(msg.ucMinCycTime);
+        }
+        else return "no pgn";
+    }
+void GenDemandSts::Print() const {
+        std::cout << "PGN: GenDemandSts" << std::endl;
+        cout << "GenDemand      : " << fnGetValue("GenDemand") << " (" << fnGetRawValue("GenDemand") << ")" << endl;
+        cout << "IntGenDemand      : " << fnGetValue("IntGenDemand") << " (" << fnGetRawValue("IntGenDemand") << ")" << endl;
+        cout << "NetGenDemand      : " << fnGetValue("NetGenDemand") << " (" << fnGetRawValue("NetGenDemand") << ")" << endl;
+        cout << "ExtActDetect      : " << fnGetValue("ExtActDetect") << " (" << fnGetRawValue("ExtActDetect") << ")" << endl;
+        cout << "ManOverrideDetect      : " << fnGetValue("ManOverrideDetect") << " (" << fnGetRawValue("ManOverrideDetect") << ")" << endl;
+        cout << "QuietTime      : " << fnGetValue("QuietTime") << " (" << fnGetRawValue("QuietTime") << ")" << endl;
+        cout << "QuietTimeOverride      : " << fnGetValue("QuietTimeOverride") << " (" << fnGetRawValue("QuietTimeOverride") << ")" << endl;
+        cout << "GenLock      : " << fnGetValue("GenLock") << " (" << fnGetRawValue("GenLock") << ")" << endl;
+        cout << "QuietTimeBeginHr      : " << fnGetValue("QuietTimeBeginHr") << " (" << fnGetRawValue("QuietTimeBeginHr") << ")" << endl;
+        cout << "QuietTimeBeginMin      : " << fnGetValue("QuietTimeBeginMin") << " (" << fnGetRawValue("QuietTimeBeginMin") << ")" << endl;
+        cout << "QuietTimeEndHr      : " << fnGetValue("QuietTimeEndHr") << " (" << fnGetRawValue("QuietTimeEndHr") << ")" << endl;
+        cout << "QuietTimeEndMin      : " << fnGetValue("QuietTimeEndMin") << " (" << fnGetRawValue("QuietTimeEndMin") << ")" << endl;
+        cout << "MinCycTime      : " << fnGetValue("MinCycTime") << " (" << fnGetRawValue("MinCycTime") << ")" << endl;
+    }
+bool GenDemandSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenDemandSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "GenDemand") {
+            return static_cast<uint32_t>(msg.teGenDemand);
+        }
+        else if (mnem == "IntGenDemand") {
+            return static_cast<uint32_t>(msg.teIntGenDemand);
+        }
+        else if (mnem == "NetGenDemand") {
+            return static_cast<uint32_t>(msg.teNetGenDemand);
+        }
+        else if (mnem == "ExtActDetect") {
+            return static_cast<uint32_t>(msg.teExtActDetect);
+        }
+        else if (mnem == "ManOverrideDetect") {
+            return static_cast<uint32_t>(msg.teManOverrideDetect);
+        }
+        else if (mnem == "QuietTime") {
+            return static_cast<uint32_t>(msg.teQuietTime);
+        }
+        else if (mnem == "QuietTimeOverride") {
+            return static_cast<uint32_t>(msg.teQuietTimeOverride);
+        }
+        else if (mnem == "GenLock") {
+            return static_cast<uint32_t>(msg.teGenLock);
+        }
+        else if (mnem == "QuietTimeBeginHr") {
+            return static_cast<uint32_t>(msg.ucQuietTimeBeginHr);
+        }
+        else if (mnem == "QuietTimeBeginMin") {
+            return static_cast<uint32_t>(msg.ucQuietTimeBeginMin);
+        }
+        else if (mnem == "QuietTimeEndHr") {
+            return static_cast<uint32_t>(msg.ucQuietTimeEndHr);
+        }
+        else if (mnem == "QuietTimeEndMin") {
+            return static_cast<uint32_t>(msg.ucQuietTimeEndMin);
+        }
+        else if (mnem == "MinCycTime") {
+            return static_cast<uint32_t>(msg.ucMinCycTime);
+        }
+        return UINT32_MAX;
+    }
+void GenDemandSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "GenDemand") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teGenDemand = static_cast<decltype(msg.teGenDemand)>(enumValue);
+     else msg.teGenDemand = static_cast<decltype(msg.teGenDemand)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "IntGenDemand") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teIntGenDemand = static_cast<decltype(msg.teIntGenDemand)>(enumValue);
+     else msg.teIntGenDemand = static_cast<decltype(msg.teIntGenDemand)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "NetGenDemand") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teNetGenDemand = static_cast<decltype(msg.teNetGenDemand)>(enumValue);
+     else msg.teNetGenDemand = static_cast<decltype(msg.teNetGenDemand)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ExtActDetect") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teExtActDetect = static_cast<decltype(msg.teExtActDetect)>(enumValue);
+     else msg.teExtActDetect = static_cast<decltype(msg.teExtActDetect)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ManOverrideDetect") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teManOverrideDetect = static_cast<decltype(msg.teManOverrideDetect)>(enumValue);
+     else msg.teManOverrideDetect = static_cast<decltype(msg.teManOverrideDetect)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "QuietTime") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teQuietTime = static_cast<decltype(msg.teQuietTime)>(enumValue);
+     else msg.teQuietTime = static_cast<decltype(msg.teQuietTime)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "QuietTimeOverride") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teQuietTimeOverride = static_cast<decltype(msg.teQuietTimeOverride)>(enumValue);
+     else msg.teQuietTimeOverride = static_cast<decltype(msg.teQuietTimeOverride)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenLock") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teGenLock = static_cast<decltype(msg.teGenLock)>(enumValue);
+     else msg.teGenLock = static_cast<decltype(msg.teGenLock)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "QuietTimeBeginHr") {
+     msg.ucQuietTimeBeginHr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "QuietTimeBeginMin") {
+     msg.ucQuietTimeBeginMin = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "QuietTimeEndHr") {
+     msg.ucQuietTimeEndHr = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "QuietTimeEndMin") {
+     msg.ucQuietTimeEndMin = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "MinCycTime") {
+     msg.ucMinCycTime = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void GenDemandSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenDemandSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenDemandSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "GenDemand") {
+            return 1.0 * (long double)(msg.teGenDemand + 0.0);
+        }
+        else if (mnem == "IntGenDemand") {
+            return 1.0 * (long double)(msg.teIntGenDemand + 0.0);
+        }
+        else if (mnem == "NetGenDemand") {
+            return 1.0 * (long double)(msg.teNetGenDemand + 0.0);
+        }
+        else if (mnem == "ExtActDetect") {
+            return 1.0 * (long double)(msg.teExtActDetect + 0.0);
+        }
+        else if (mnem == "ManOverrideDetect") {
+            return 1.0 * (long double)(msg.teManOverrideDetect + 0.0);
+        }
+        else if (mnem == "QuietTime") {
+            return 1.0 * (long double)(msg.teQuietTime + 0.0);
+        }
+        else if (mnem == "QuietTimeOverride") {
+            return 1.0 * (long double)(msg.teQuietTimeOverride + 0.0);
+        }
+        else if (mnem == "GenLock") {
+            return 1.0 * (long double)(msg.teGenLock + 0.0);
+        }
+        else if (mnem == "QuietTimeBeginHr") {
+            return 1.0 * (long double)(msg.ucQuietTimeBeginHr + 0.0);
+        }
+        else if (mnem == "QuietTimeBeginMin") {
+            return 1.0 * (long double)(msg.ucQuietTimeBeginMin + 0.0);
+        }
+        else if (mnem == "QuietTimeEndHr") {
+            return 1.0 * (long double)(msg.ucQuietTimeEndHr + 0.0);
+        }
+        else if (mnem == "QuietTimeEndMin") {
+            return 1.0 * (long double)(msg.ucQuietTimeEndMin + 0.0);
+        }
+        else if (mnem == "MinCycTime") {
+            return 1.0 * (long double)(msg.ucMinCycTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenStartCfgCmd
+std::string GenStartCfgCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "GenType") {
+            if (!ENUMLOOKUP_9417.fnContains(msg.teGenType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9417.fnText(msg.teGenType));
+              }
+        }
+        else if (mnem == "GenPrecrankTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucGenPrecrankTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucGenPrecrankTime == 0xff) ? "No Data" : (msg.ucGenPrecrankTime == 0xfe) ? "Out of range" : (msg.ucGenPrecrankTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucGenMaxCrankTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucGenMaxCrankTime == 0xff) ? "No Data" : (msg.ucGenMaxCrankTime == 0xfe) ? "Out of range" : (msg.ucGenMaxCrankTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GenStopTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucGenStopTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucGenStopTime == 0xff) ? "No Data" : (msg.ucGenStopTime == 0xfe) ? "Out of range" : (msg.ucGenStopTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void GenStartCfgCmd::Print() const {
+        std::cout << "PGN: GenStartCfgCmd" << std::endl;
+        cout << "GenType      : " << fnGetValue("GenType") << " (" << fnGetRawValue("GenType") << ")" << endl;
+        cout << "GenPrecrankTime      : " << fnGetValue("GenPrecrankTime") << " (" << fnGetRawValue("GenPrecrankTime") << ")" << endl;
+        cout << "GenMaxCrankTime      : " << fnGetValue("GenMaxCrankTime") << " (" << fnGetRawValue("GenMaxCrankTime") << ")" << endl;
+        cout << "GenStopTime      : " << fnGetValue("GenStopTime") << " (" << fnGetRawValue("GenStopTime") << ")" << endl;
+    }
+bool GenStartCfgCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenStartCfgCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "GenType") {
+            return static_cast<uint32_t>(msg.teGenType);
+        }
+        else if (mnem == "GenPrecrankTime") {
+            return static_cast<uint32_t>(msg.ucGenPrecrankTime);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+            return static_cast<uint32_t>(msg.ucGenMaxCrankTime);
+        }
+        else if (mnem == "GenStopTime") {
+            return static_cast<uint32_t>(msg.ucGenStopTime);
+        }
+        return UINT32_MAX;
+    }
+void GenStartCfgCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "GenType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9417, value);
+     if (enumValue != -1) msg.teGenType = static_cast<decltype(msg.teGenType)>(enumValue);
+     else msg.teGenType = static_cast<decltype(msg.teGenType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenPrecrankTime") {
+     msg.ucGenPrecrankTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+     msg.ucGenMaxCrankTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "GenStopTime") {
+     msg.ucGenStopTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void GenStartCfgCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenStartCfgCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenStartCfgCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "GenType") {
+            return 1.0 * (long double)(msg.teGenType + 0.0);
+        }
+        else if (mnem == "GenPrecrankTime") {
+            return 1.0 * (long double)(msg.ucGenPrecrankTime + 0.0);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+            return 1.0 * (long double)(msg.ucGenMaxCrankTime + 0.0);
+        }
+        else if (mnem == "GenStopTime") {
+            return 1.0 * (long double)(msg.ucGenStopTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenStartCfgSts
+std::string GenStartCfgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "GenType") {
+            if (!ENUMLOOKUP_9417.fnContains(msg.teGenType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9417.fnText(msg.teGenType));
+              }
+        }
+        else if (mnem == "GenPrecrankTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucGenPrecrankTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucGenPrecrankTime == 0xff) ? "No Data" : (msg.ucGenPrecrankTime == 0xfe) ? "Out of range" : (msg.ucGenPrecrankTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucGenMaxCrankTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucGenMaxCrankTime == 0xff) ? "No Data" : (msg.ucGenMaxCrankTime == 0xfe) ? "Out of range" : (msg.ucGenMaxCrankTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GenStopTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucGenStopTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucGenStopTime == 0xff) ? "No Data" : (msg.ucGenStopTime == 0xfe) ? "Out of range" : (msg.ucGenStopTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void GenStartCfgSts::Print() const {
+        std::cout << "PGN: GenStartCfgSts" << std::endl;
+        cout << "GenType      : " << fnGetValue("GenType") << " (" << fnGetRawValue("GenType") << ")" << endl;
+        cout << "GenPrecrankTime      : " << fnGetValue("GenPrecrankTime") << " (" << fnGetRawValue("GenPrecrankTime") << ")" << endl;
+        cout << "GenMaxCrankTime      : " << fnGetValue("GenMaxCrankTime") << " (" << fnGetRawValue("GenMaxCrankTime") << ")" << endl;
+        cout << "GenStopTime      : " << fnGetValue("GenStopTime") << " (" << fnGetRawValue("GenStopTime") << ")" << endl;
+    }
+bool GenStartCfgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenStartCfgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "GenType") {
+            return static_cast<uint32_t>(msg.teGenType);
+        }
+        else if (mnem == "GenPrecrankTime") {
+            return static_cast<uint32_t>(msg.ucGenPrecrankTime);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+            return static_cast<uint32_t>(msg.ucGenMaxCrankTime);
+        }
+        else if (mnem == "GenStopTime") {
+            return static_cast<uint32_t>(msg.ucGenStopTime);
+        }
+        return UINT32_MAX;
+    }
+void GenStartCfgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "GenType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9417, value);
+     if (enumValue != -1) msg.teGenType = static_cast<decltype(msg.teGenType)>(enumValue);
+     else msg.teGenType = static_cast<decltype(msg.teGenType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenPrecrankTime") {
+     msg.ucGenPrecrankTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+     msg.ucGenMaxCrankTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "GenStopTime") {
+     msg.ucGenStopTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void GenStartCfgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenStartCfgSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenStartCfgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "GenType") {
+            return 1.0 * (long double)(msg.teGenType + 0.0);
+        }
+        else if (mnem == "GenPrecrankTime") {
+            return 1.0 * (long double)(msg.ucGenPrecrankTime + 0.0);
+        }
+        else if (mnem == "GenMaxCrankTime") {
+            return 1.0 * (long double)(msg.ucGenMaxCrankTime + 0.0);
+        }
+        else if (mnem == "GenStopTime") {
+            return 1.0 * (long double)(msg.ucGenStopTime + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenCmd
+std::string GenCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Cmd") {
+            if (!ENUMLOOKUP_9415.fnContains(msg.teCmd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCmd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9415.fnText(msg.teCmd));
+              }
+        }
+        else return "no pgn";
+    }
+void GenCmd::Print() const {
+        std::cout << "PGN: GenCmd" << std::endl;
+        cout << "Cmd      : " << fnGetValue("Cmd") << " (" << fnGetRawValue("Cmd") << ")" << endl;
+    }
+bool GenCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Cmd") {
+            return static_cast<uint32_t>(msg.teCmd);
+        }
+        return UINT32_MAX;
+    }
+void GenCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Cmd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9415, value);
+     if (enumValue != -1) msg.teCmd = static_cast<decltype(msg.teCmd)>(enumValue);
+     else msg.teCmd = static_cast<decltype(msg.teCmd)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void GenCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Cmd") {
+            return 1.0 * (long double)(msg.teCmd + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenSts2
+std::string GenSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "TempSdSw") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teTempSdSw)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTempSdSw);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teTempSdSw));
+              }
+        }
+        else if (mnem == "OilPresSdSw") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOilPresSdSw)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOilPresSdSw);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOilPresSdSw));
+              }
+        }
+        else if (mnem == "OilLvlSw") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOilLvlSw)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOilLvlSw);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOilLvlSw));
+              }
+        }
+        else if (mnem == "CautionLight") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teCautionLight)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCautionLight);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teCautionLight));
+              }
+        }
+        else if (mnem == "EngCoolantTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucEngCoolantTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucEngCoolantTemp == 0xff) ? "No Data" : (msg.ucEngCoolantTemp == 0xfe) ? "Out of range" : (msg.ucEngCoolantTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EngOilPress") {
+            char buffer[50];
+            auto engval = 4.0 * (long double) (msg.ucEngOilPress + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "kPa");
+            return (msg.ucEngOilPress == 0xff) ? "No Data" : (msg.ucEngOilPress == 0xfe) ? "Out of range" : (msg.ucEngOilPress == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EngRpm") {
+            return (msg.uiEngRpm == 0xffff) ? "No Data" : (msg.uiEngRpm == 0xfffe) ? "Out of range" : (msg.uiEngRpm == 0xfffd) ? "Reserved" : std::to_string(msg.uiEngRpm);
+        }
+        else if (mnem == "FuelRate") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiFuelRate + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "lph");
+            return (msg.uiFuelRate == 0xffff) ? "No Data" : (msg.uiFuelRate == 0xfffe) ? "Out of range" : (msg.uiFuelRate == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void GenSts2::Print() const {
+        std::cout << "PGN: GenSts2" << std::endl;
+        cout << "TempSdSw      : " << fnGetValue("TempSdSw") << " (" << fnGetRawValue("TempSdSw") << ")" << endl;
+        cout << "OilPresSdSw      : " << fnGetValue("OilPresSdSw") << " (" << fnGetRawValue("OilPresSdSw") << ")" << endl;
+        cout << "OilLvlSw      : " << fnGetValue("OilLvlSw") << " (" << fnGetRawValue("OilLvlSw") << ")" << endl;
+        cout << "CautionLight      : " << fnGetValue("CautionLight") << " (" << fnGetRawValue("CautionLight") << ")" << endl;
+        cout << "EngCoolantTemp      : " << fnGetValue("EngCoolantTemp") << " (" << fnGetRawValue("EngCoolantTemp") << ")" << endl;
+        cout << "EngOilPress      : " << fnGetValue("EngOilPress") << " (" << fnGetRawValue("EngOilPress") << ")" << endl;
+        cout << "EngRpm      : " << fnGetValue("EngRpm") << " (" << fnGetRawValue("EngRpm") << ")" << endl;
+        cout << "FuelRate      : " << fnGetValue("FuelRate") << " (" << fnGetRawValue("FuelRate") << ")" << endl;
+    }
+bool GenSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "TempSdSw") {
+            return static_cast<uint32_t>(msg.teTempSdSw);
+        }
+        else if (mnem == "OilPresSdSw") {
+            return static_cast<uint32_t>(msg.teOilPresSdSw);
+        }
+        else if (mnem == "OilLvlSw") {
+            return static_cast<uint32_t>(msg.teOilLvlSw);
+        }
+        else if (mnem == "CautionLight") {
+            return static_cast<uint32_t>(msg.teCautionLight);
+        }
+        else if (mnem == "EngCoolantTemp") {
+            return static_cast<uint32_t>(msg.ucEngCoolantTemp);
+        }
+        else if (mnem == "EngOilPress") {
+            return static_cast<uint32_t>(msg.ucEngOilPress);
+        }
+        else if (mnem == "EngRpm") {
+            return static_cast<uint32_t>(msg.uiEngRpm);
+        }
+        else if (mnem == "FuelRate") {
+            return static_cast<uint32_t>(msg.uiFuelRate);
+        }
+        return UINT32_MAX;
+    }
+void GenSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "TempSdSw") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teTempSdSw = static_cast<decltype(msg.teTempSdSw)>(enumValue);
+     else msg.teTempSdSw = static_cast<decltype(msg.teTempSdSw)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OilPresSdSw") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOilPresSdSw = static_cast<decltype(msg.teOilPresSdSw)>(enumValue);
+     else msg.teOilPresSdSw = static_cast<decltype(msg.teOilPresSdSw)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OilLvlSw") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOilLvlSw = static_cast<decltype(msg.teOilLvlSw)>(enumValue);
+     else msg.teOilLvlSw = static_cast<decltype(msg.teOilLvlSw)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CautionLight") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teCautionLight = static_cast<decltype(msg.teCautionLight)>(enumValue);
+     else msg.teCautionLight = static_cast<decltype(msg.teCautionLight)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "EngCoolantTemp") {
+     msg.ucEngCoolantTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "EngOilPress") {
+     msg.ucEngOilPress = stringToInt(value, 0xff, 0xfe, 0xfd, 4.0, 0.0);
+        }
+        else if (mnem == "EngRpm") {
+     msg.uiEngRpm = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "FuelRate") {
+     msg.uiFuelRate = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void GenSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "TempSdSw") {
+            return 1.0 * (long double)(msg.teTempSdSw + 0.0);
+        }
+        else if (mnem == "OilPresSdSw") {
+            return 1.0 * (long double)(msg.teOilPresSdSw + 0.0);
+        }
+        else if (mnem == "OilLvlSw") {
+            return 1.0 * (long double)(msg.teOilLvlSw + 0.0);
+        }
+        else if (mnem == "CautionLight") {
+            return 1.0 * (long double)(msg.teCautionLight + 0.0);
+        }
+        else if (mnem == "EngCoolantTemp") {
+            return 1.0 * (long double)(msg.ucEngCoolantTemp + -40.0);
+        }
+        else if (mnem == "EngOilPress") {
+            return 4.0 * (long double)(msg.ucEngOilPress + 0.0);
+        }
+        else if (mnem == "EngRpm") {
+            return 1.0 * (long double)(msg.uiEngRpm + 0.0);
+        }
+        else if (mnem == "FuelRate") {
+            return 0.05000000074505806 * (long double)(msg.uiFuelRate + 0.0);
+        }
+        return 0.0;
+    }
+
+// GenSts1
+std::string GenSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Sts") {
+            if (!ENUMLOOKUP_9404.fnContains(msg.teSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9404.fnText(msg.teSts));
+              }
+        }
+        else if (mnem == "EngRunTime") {
+            return (msg.ulEngRunTime == 0xffffffff) ? "No Data" : (msg.ulEngRunTime == 0xfffffffe) ? "Out of range" : (msg.ulEngRunTime == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulEngRunTime);
+        }
+        else if (mnem == "EngLoad") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucEngLoad + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucEngLoad == 0xff) ? "No Data" : (msg.ucEngLoad == 0xfe) ? "Out of range" : (msg.ucEngLoad == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "StartBattV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiStartBattV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiStartBattV == 0xffff) ? "No Data" : (msg.uiStartBattV == 0xfffe) ? "Out of range" : (msg.uiStartBattV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void GenSts1::Print() const {
+        std::cout << "PGN: GenSts1" << std::endl;
+        cout << "Sts      : " << fnGetValue("Sts") << " (" << fnGetRawValue("Sts") << ")" << endl;
+        cout << "EngRunTime      : " << fnGetValue("EngRunTime") << " (" << fnGetRawValue("EngRunTime") << ")" << endl;
+        cout << "EngLoad      : " << fnGetValue("EngLoad") << " (" << fnGetRawValue("EngLoad") << ")" << endl;
+        cout << "StartBattV      : " << fnGetValue("StartBattV") << " (" << fnGetRawValue("StartBattV") << ")" << endl;
+    }
+bool GenSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 GenSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Sts") {
+            return static_cast<uint32_t>(msg.teSts);
+        }
+        else if (mnem == "EngRunTime") {
+            return static_cast<uint32_t>(msg.ulEngRunTime);
+        }
+        else if (mnem == "EngLoad") {
+            return static_cast<uint32_t>(msg.ucEngLoad);
+        }
+        else if (mnem == "StartBattV") {
+            return static_cast<uint32_t>(msg.uiStartBattV);
+        }
+        return UINT32_MAX;
+    }
+void GenSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Sts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9404, value);
+     if (enumValue != -1) msg.teSts = static_cast<decltype(msg.teSts)>(enumValue);
+     else msg.teSts = static_cast<decltype(msg.teSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "EngRunTime") {
+     msg.ulEngRunTime = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "EngLoad") {
+     msg.ucEngLoad = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "StartBattV") {
+     msg.uiStartBattV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void GenSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string GenSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double GenSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Sts") {
+            return 1.0 * (long double)(msg.teSts + 0.0);
+        }
+        else if (mnem == "EngRunTime") {
+            return 1.0 * (long double)(msg.ulEngRunTime + 0.0);
+        }
+        else if (mnem == "EngLoad") {
+            return 0.5 * (long double)(msg.ucEngLoad + 0.0);
+        }
+        else if (mnem == "StartBattV") {
+            return 0.05000000074505806 * (long double)(msg.uiStartBattV + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_gen_registrars[] = {
+{"GenRst", [](void * rcv) { return std::make_unique<GenRst>(rcv); }, []() { return std::make_unique<GenRst>(); } },
+{"GenDemandCmd", [](void * rcv) { return std::make_unique<GenDemandCmd>(rcv); }, []() { return std::make_unique<GenDemandCmd>(); } },
+{"GenDemandSts", [](void * rcv) { return std::make_unique<GenDemandSts>(rcv); }, []() { return std::make_unique<GenDemandSts>(); } },
+{"GenStartCfgCmd", [](void * rcv) { return std::make_unique<GenStartCfgCmd>(rcv); }, []() { return std::make_unique<GenStartCfgCmd>(); } },
+{"GenStartCfgSts", [](void * rcv) { return std::make_unique<GenStartCfgSts>(rcv); }, []() { return std::make_unique<GenStartCfgSts>(); } },
+{"GenCmd", [](void * rcv) { return std::make_unique<GenCmd>(rcv); }, []() { return std::make_unique<GenCmd>(); } },
+{"GenSts2", [](void * rcv) { return std::make_unique<GenSts2>(rcv); }, []() { return std::make_unique<GenSts2>(); } },
+{"GenSts1", [](void * rcv) { return std::make_unique<GenSts1>(rcv); }, []() { return std::make_unique<GenSts1>(); } },
+};
+static const PrinterRegistrar pgn_gen_printers[] = {
+{98048, -1, fnPrintMessage<GenRst>},
+{131009, -1, fnPrintMessage<GenDemandCmd>},
+{131010, -1, fnPrintMessage<GenDemandSts>},
+{131032, -1, fnPrintMessage<GenStartCfgCmd>},
+{131033, -1, fnPrintMessage<GenStartCfgSts>},
+{131034, -1, fnPrintMessage<GenCmd>},
+{131035, -1, fnPrintMessage<GenSts2>},
+{131036, -1, fnPrintMessage<GenSts1>},
+};
@@ -0,0 +1,3262 @@
+// Auto-generated by generate_print_functions.py: inv message classes
+#include "print_functions3.h"
+
+// InvTempSts2
+std::string InvTempSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "CtrlBrdTemp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiCtrlBrdTemp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiCtrlBrdTemp == 0xffff) ? "No Data" : (msg.uiCtrlBrdTemp == 0xfffe) ? "Out of range" : (msg.uiCtrlBrdTemp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "CapTemp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiCapTemp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiCapTemp == 0xffff) ? "No Data" : (msg.uiCapTemp == 0xfffe) ? "Out of range" : (msg.uiCapTemp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AmbTemp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiAmbTemp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiAmbTemp == 0xffff) ? "No Data" : (msg.uiAmbTemp == 0xfffe) ? "Out of range" : (msg.uiAmbTemp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvTempSts2::Print() const {
+        std::cout << "PGN: InvTempSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "CtrlBrdTemp      : " << fnGetValue("CtrlBrdTemp") << " (" << fnGetRawValue("CtrlBrdTemp") << ")" << endl;
+        cout << "CapTemp      : " << fnGetValue("CapTemp") << " (" << fnGetRawValue("CapTemp") << ")" << endl;
+        cout << "AmbTemp      : " << fnGetValue("AmbTemp") << " (" << fnGetRawValue("AmbTemp") << ")" << endl;
+    }
+bool InvTempSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvTempSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "CtrlBrdTemp") {
+            return static_cast<uint32_t>(msg.uiCtrlBrdTemp);
+        }
+        else if (mnem == "CapTemp") {
+            return static_cast<uint32_t>(msg.uiCapTemp);
+        }
+        else if (mnem == "AmbTemp") {
+            return static_cast<uint32_t>(msg.uiAmbTemp);
+        }
+        return UINT32_MAX;
+    }
+void InvTempSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "CtrlBrdTemp") {
+     msg.uiCtrlBrdTemp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "CapTemp") {
+     msg.uiCapTemp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "AmbTemp") {
+     msg.uiAmbTemp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+    }
+void InvTempSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvTempSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvTempSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "CtrlBrdTemp") {
+            return 0.03125 * (long double)(msg.uiCtrlBrdTemp + -8736.0);
+        }
+        else if (mnem == "CapTemp") {
+            return 0.03125 * (long double)(msg.uiCapTemp + -8736.0);
+        }
+        else if (mnem == "AmbTemp") {
+            return 0.03125 * (long double)(msg.uiAmbTemp + -8736.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgCmd4
+std::string InvCfgCmd4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "OutACVolt") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiOutACVolt + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiOutACVolt == 0xffff) ? "No Data" : (msg.uiOutACVolt == 0xfffe) ? "Out of range" : (msg.uiOutACVolt == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "OutFreq") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucOutFreq + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucOutFreq == 0xff) ? "No Data" : (msg.ucOutFreq == 0xfe) ? "Out of range" : (msg.ucOutFreq == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ACOutPwrLim") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiACOutPwrLim + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiACOutPwrLim == 0xffff) ? "No Data" : (msg.uiACOutPwrLim == 0xfffe) ? "Out of range" : (msg.uiACOutPwrLim == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.uiACOutPwrTimeLim + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "s");
+            return (msg.uiACOutPwrTimeLim == 0xffff) ? "No Data" : (msg.uiACOutPwrTimeLim == 0xfffe) ? "Out of range" : (msg.uiACOutPwrTimeLim == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgCmd4::Print() const {
+        std::cout << "PGN: InvCfgCmd4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "OutACVolt      : " << fnGetValue("OutACVolt") << " (" << fnGetRawValue("OutACVolt") << ")" << endl;
+        cout << "OutFreq      : " << fnGetValue("OutFreq") << " (" << fnGetRawValue("OutFreq") << ")" << endl;
+        cout << "ACOutPwrLim      : " << fnGetValue("ACOutPwrLim") << " (" << fnGetRawValue("ACOutPwrLim") << ")" << endl;
+        cout << "ACOutPwrTimeLim      : " << fnGetValue("ACOutPwrTimeLim") << " (" << fnGetRawValue("ACOutPwrTimeLim") << ")" << endl;
+    }
+bool InvCfgCmd4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgCmd4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "OutACVolt") {
+            return static_cast<uint32_t>(msg.uiOutACVolt);
+        }
+        else if (mnem == "OutFreq") {
+            return static_cast<uint32_t>(msg.ucOutFreq);
+        }
+        else if (mnem == "ACOutPwrLim") {
+            return static_cast<uint32_t>(msg.uiACOutPwrLim);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+            return static_cast<uint32_t>(msg.uiACOutPwrTimeLim);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgCmd4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "OutACVolt") {
+     msg.uiOutACVolt = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "OutFreq") {
+     msg.ucOutFreq = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ACOutPwrLim") {
+     msg.uiACOutPwrLim = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+     msg.uiACOutPwrTimeLim = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.5, 0.0);
+        }
+    }
+void InvCfgCmd4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgCmd4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgCmd4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "OutACVolt") {
+            return 0.05000000074505806 * (long double)(msg.uiOutACVolt + 0.0);
+        }
+        else if (mnem == "OutFreq") {
+            return 1.0 * (long double)(msg.ucOutFreq + 0.0);
+        }
+        else if (mnem == "ACOutPwrLim") {
+            return 1.0 * (long double)(msg.uiACOutPwrLim + 0.0);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+            return 0.5 * (long double)(msg.uiACOutPwrTimeLim + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgSts4
+std::string InvCfgSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "OutACVolt") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiOutACVolt + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiOutACVolt == 0xffff) ? "No Data" : (msg.uiOutACVolt == 0xfffe) ? "Out of range" : (msg.uiOutACVolt == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "OutFreq") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucOutFreq + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Hz");
+            return (msg.ucOutFreq == 0xff) ? "No Data" : (msg.ucOutFreq == 0xfe) ? "Out of range" : (msg.ucOutFreq == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ACOutPwrLim") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiACOutPwrLim + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiACOutPwrLim == 0xffff) ? "No Data" : (msg.uiACOutPwrLim == 0xfffe) ? "Out of range" : (msg.uiACOutPwrLim == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.uiACOutPwrTimeLim + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "s");
+            return (msg.uiACOutPwrTimeLim == 0xffff) ? "No Data" : (msg.uiACOutPwrTimeLim == 0xfffe) ? "Out of range" : (msg.uiACOutPwrTimeLim == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgSts4::Print() const {
+        std::cout << "PGN: InvCfgSts4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "OutACVolt      : " << fnGetValue("OutACVolt") << " (" << fnGetRawValue("OutACVolt") << ")" << endl;
+        cout << "OutFreq      : " << fnGetValue("OutFreq") << " (" << fnGetRawValue("OutFreq") << ")" << endl;
+        cout << "ACOutPwrLim      : " << fnGetValue("ACOutPwrLim") << " (" << fnGetRawValue("ACOutPwrLim") << ")" << endl;
+        cout << "ACOutPwrTimeLim      : " << fnGetValue("ACOutPwrTimeLim") << " (" << fnGetRawValue("ACOutPwrTimeLim") << ")" << endl;
+    }
+bool InvCfgSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "OutACVolt") {
+            return static_cast<uint32_t>(msg.uiOutACVolt);
+        }
+        else if (mnem == "OutFreq") {
+            return static_cast<uint32_t>(msg.ucOutFreq);
+        }
+        else if (mnem == "ACOutPwrLim") {
+            return static_cast<uint32_t>(msg.uiACOutPwrLim);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+            return static_cast<uint32_t>(msg.uiACOutPwrTimeLim);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "OutACVolt") {
+     msg.uiOutACVolt = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "OutFreq") {
+     msg.ucOutFreq = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ACOutPwrLim") {
+     msg.uiACOutPwrLim = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+     msg.uiACOutPwrTimeLim = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.5, 0.0);
+        }
+    }
+void InvCfgSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgSts4::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnInvChgSts4OutACVolt2Enum") return fnInvChgSts4OutACVolt2Enum(param_value);
+ return "";     };
+long double InvCfgSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "OutACVolt") {
+            return 0.05000000074505806 * (long double)(msg.uiOutACVolt + 0.0);
+        }
+        else if (mnem == "OutFreq") {
+            return 1.0 * (long double)(msg.ucOutFreq + 0.0);
+        }
+        else if (mnem == "ACOutPwrLim") {
+            return 1.0 * (long double)(msg.uiACOutPwrLim + 0.0);
+        }
+        else if (mnem == "ACOutPwrTimeLim") {
+            return 0.5 * (long double)(msg.uiACOutPwrTimeLim + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvTempSts
+std::string InvTempSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Fet1Temp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiFet1Temp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiFet1Temp == 0xffff) ? "No Data" : (msg.uiFet1Temp == 0xfffe) ? "Out of range" : (msg.uiFet1Temp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "XfmrTemp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiXfmrTemp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiXfmrTemp == 0xffff) ? "No Data" : (msg.uiXfmrTemp == 0xfffe) ? "Out of range" : (msg.uiXfmrTemp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Fet2Temp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiFet2Temp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiFet2Temp == 0xffff) ? "No Data" : (msg.uiFet2Temp == 0xfffe) ? "Out of range" : (msg.uiFet2Temp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvTempSts::Print() const {
+        std::cout << "PGN: InvTempSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Fet1Temp      : " << fnGetValue("Fet1Temp") << " (" << fnGetRawValue("Fet1Temp") << ")" << endl;
+        cout << "XfmrTemp      : " << fnGetValue("XfmrTemp") << " (" << fnGetRawValue("XfmrTemp") << ")" << endl;
+        cout << "Fet2Temp      : " << fnGetValue("Fet2Temp") << " (" << fnGetRawValue("Fet2Temp") << ")" << endl;
+    }
+bool InvTempSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvTempSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Fet1Temp") {
+            return static_cast<uint32_t>(msg.uiFet1Temp);
+        }
+        else if (mnem == "XfmrTemp") {
+            return static_cast<uint32_t>(msg.uiXfmrTemp);
+        }
+        else if (mnem == "Fet2Temp") {
+            return static_cast<uint32_t>(msg.uiFet2Temp);
+        }
+        return UINT32_MAX;
+    }
+void InvTempSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Fet1Temp") {
+     msg.uiFet1Temp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "XfmrTemp") {
+     msg.uiXfmrTemp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+        else if (mnem == "Fet2Temp") {
+     msg.uiFet2Temp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+    }
+void InvTempSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvTempSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvTempSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Fet1Temp") {
+            return 0.03125 * (long double)(msg.uiFet1Temp + -8736.0);
+        }
+        else if (mnem == "XfmrTemp") {
+            return 0.03125 * (long double)(msg.uiXfmrTemp + -8736.0);
+        }
+        else if (mnem == "Fet2Temp") {
+            return 0.03125 * (long double)(msg.uiFet2Temp + -8736.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgCmd3
+std::string InvCfgCmd3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.uiDcSrcShtDwnDly + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "s");
+            return (msg.uiDcSrcShtDwnDly == 0xffff) ? "No Data" : (msg.uiDcSrcShtDwnDly == 0xfffe) ? "Out of range" : (msg.uiDcSrcShtDwnDly == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "StackMd") {
+            if (!ENUMLOOKUP_N1191777267.fnContains(msg.teStackMd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teStackMd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N1191777267.fnText(msg.teStackMd));
+              }
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcUvSdRecLvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcUvSdRecLvl == 0xffff) ? "No Data" : (msg.uiDcUvSdRecLvl == 0xfffe) ? "Out of range" : (msg.uiDcUvSdRecLvl == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GenSupportEngI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiGenSupportEngI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiGenSupportEngI == 0xffff) ? "No Data" : (msg.uiGenSupportEngI == 0xfffe) ? "Out of range" : (msg.uiGenSupportEngI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgCmd3::Print() const {
+        std::cout << "PGN: InvCfgCmd3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DcSrcShtDwnDly      : " << fnGetValue("DcSrcShtDwnDly") << " (" << fnGetRawValue("DcSrcShtDwnDly") << ")" << endl;
+        cout << "StackMd      : " << fnGetValue("StackMd") << " (" << fnGetRawValue("StackMd") << ")" << endl;
+        cout << "DcUvSdRecLvl      : " << fnGetValue("DcUvSdRecLvl") << " (" << fnGetRawValue("DcUvSdRecLvl") << ")" << endl;
+        cout << "GenSupportEngI      : " << fnGetValue("GenSupportEngI") << " (" << fnGetRawValue("GenSupportEngI") << ")" << endl;
+    }
+bool InvCfgCmd3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgCmd3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+            return static_cast<uint32_t>(msg.uiDcSrcShtDwnDly);
+        }
+        else if (mnem == "StackMd") {
+            return static_cast<uint32_t>(msg.teStackMd);
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+            return static_cast<uint32_t>(msg.uiDcUvSdRecLvl);
+        }
+        else if (mnem == "GenSupportEngI") {
+            return static_cast<uint32_t>(msg.uiGenSupportEngI);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgCmd3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+     msg.uiDcSrcShtDwnDly = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.5, 0.0);
+        }
+        else if (mnem == "StackMd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N1191777267, value);
+     if (enumValue != -1) msg.teStackMd = static_cast<decltype(msg.teStackMd)>(enumValue);
+     else msg.teStackMd = static_cast<decltype(msg.teStackMd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+     msg.uiDcUvSdRecLvl = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "GenSupportEngI") {
+     msg.uiGenSupportEngI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+    }
+void InvCfgCmd3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgCmd3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgCmd3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+            return 0.5 * (long double)(msg.uiDcSrcShtDwnDly + 0.0);
+        }
+        else if (mnem == "StackMd") {
+            return 1.0 * (long double)(msg.teStackMd + 0.0);
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+            return 0.05000000074505806 * (long double)(msg.uiDcUvSdRecLvl + 0.0);
+        }
+        else if (mnem == "GenSupportEngI") {
+            return 0.05000000074505806 * (long double)(msg.uiGenSupportEngI + -32000.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgSts3
+std::string InvCfgSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.uiDcSrcShtDwnDly + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "s");
+            return (msg.uiDcSrcShtDwnDly == 0xffff) ? "No Data" : (msg.uiDcSrcShtDwnDly == 0xfffe) ? "Out of range" : (msg.uiDcSrcShtDwnDly == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "StackMd") {
+            if (!ENUMLOOKUP_N1191777267.fnContains(msg.teStackMd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teStackMd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N1191777267.fnText(msg.teStackMd));
+              }
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcUvSdRecLvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcUvSdRecLvl == 0xffff) ? "No Data" : (msg.uiDcUvSdRecLvl == 0xfffe) ? "Out of range" : (msg.uiDcUvSdRecLvl == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GenSupportEngI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiGenSupportEngI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiGenSupportEngI == 0xffff) ? "No Data" : (msg.uiGenSupportEngI == 0xfffe) ? "Out of range" : (msg.uiGenSupportEngI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgSts3::Print() const {
+        std::cout << "PGN: InvCfgSts3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DcSrcShtDwnDly      : " << fnGetValue("DcSrcShtDwnDly") << " (" << fnGetRawValue("DcSrcShtDwnDly") << ")" << endl;
+        cout << "StackMd      : " << fnGetValue("StackMd") << " (" << fnGetRawValue("StackMd") << ")" << endl;
+        cout << "DcUvSdRecLvl      : " << fnGetValue("DcUvSdRecLvl") << " (" << fnGetRawValue("DcUvSdRecLvl") << ")" << endl;
+        cout << "GenSupportEngI      : " << fnGetValue("GenSupportEngI") << " (" << fnGetRawValue("GenSupportEngI") << ")" << endl;
+    }
+bool InvCfgSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+            return static_cast<uint32_t>(msg.uiDcSrcShtDwnDly);
+        }
+        else if (mnem == "StackMd") {
+            return static_cast<uint32_t>(msg.teStackMd);
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+            return static_cast<uint32_t>(msg.uiDcUvSdRecLvl);
+        }
+        else if (mnem == "GenSupportEngI") {
+            return static_cast<uint32_t>(msg.uiGenSupportEngI);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+     msg.uiDcSrcShtDwnDly = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.5, 0.0);
+        }
+        else if (mnem == "StackMd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N1191777267, value);
+     if (enumValue != -1) msg.teStackMd = static_cast<decltype(msg.teStackMd)>(enumValue);
+     else msg.teStackMd = static_cast<decltype(msg.teStackMd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+     msg.uiDcUvSdRecLvl = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "GenSupportEngI") {
+     msg.uiGenSupportEngI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+    }
+void InvCfgSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DcSrcShtDwnDly") {
+            return 0.5 * (long double)(msg.uiDcSrcShtDwnDly + 0.0);
+        }
+        else if (mnem == "StackMd") {
+            return 1.0 * (long double)(msg.teStackMd + 0.0);
+        }
+        else if (mnem == "DcUvSdRecLvl") {
+            return 0.05000000074505806 * (long double)(msg.uiDcUvSdRecLvl + 0.0);
+        }
+        else if (mnem == "GenSupportEngI") {
+            return 0.05000000074505806 * (long double)(msg.uiGenSupportEngI + -32000.0);
+        }
+        return 0.0;
+    }
+
+// InvDcSts
+std::string InvDcSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DcVolt") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcVolt + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcVolt == 0xffff) ? "No Data" : (msg.uiDcVolt == 0xfffe) ? "Out of range" : (msg.uiDcVolt == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcAmps") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcAmps + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiDcAmps == 0xffff) ? "No Data" : (msg.uiDcAmps == 0xfffe) ? "Out of range" : (msg.uiDcAmps == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvDcSts::Print() const {
+        std::cout << "PGN: InvDcSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DcVolt      : " << fnGetValue("DcVolt") << " (" << fnGetRawValue("DcVolt") << ")" << endl;
+        cout << "DcAmps      : " << fnGetValue("DcAmps") << " (" << fnGetRawValue("DcAmps") << ")" << endl;
+    }
+bool InvDcSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvDcSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DcVolt") {
+            return static_cast<uint32_t>(msg.uiDcVolt);
+        }
+        else if (mnem == "DcAmps") {
+            return static_cast<uint32_t>(msg.uiDcAmps);
+        }
+        return UINT32_MAX;
+    }
+void InvDcSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcVolt") {
+     msg.uiDcVolt = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "DcAmps") {
+     msg.uiDcAmps = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+    }
+void InvDcSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvDcSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvDcSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DcVolt") {
+            return 0.05000000074505806 * (long double)(msg.uiDcVolt + 0.0);
+        }
+        else if (mnem == "DcAmps") {
+            return 0.05000000074505806 * (long double)(msg.uiDcAmps + -32000.0);
+        }
+        return 0.0;
+    }
+
+// InvAcFltCfgCmd1
+std::string InvAcFltCfgCmd1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ExtremeLoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeLoV == 0xff) ? "No Data" : (msg.ucExtremeLoV == 0xfe) ? "Out of range" : (msg.ucExtremeLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucLoV == 0xff) ? "No Data" : (msg.ucLoV == 0xfe) ? "Out of range" : (msg.ucLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucHiV == 0xff) ? "No Data" : (msg.ucHiV == 0xfe) ? "Out of range" : (msg.ucHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtremeHiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeHiV == 0xff) ? "No Data" : (msg.ucExtremeHiV == 0xfe) ? "Out of range" : (msg.ucExtremeHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "QualTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucQualTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucQualTime == 0xff) ? "No Data" : (msg.ucQualTime == 0xfe) ? "Out of range" : (msg.ucQualTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BypassMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassMode));
+              }
+        }
+        else if (mnem == "RsvBits") {
+            return std::to_string(msg.ucRsvBits);
+        }
+        else return "no pgn";
+    }
+void InvAcFltCfgCmd1::Print() const {
+        std::cout << "PGN: InvAcFltCfgCmd1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ExtremeLoV      : " << fnGetValue("ExtremeLoV") << " (" << fnGetRawValue("ExtremeLoV") << ")" << endl;
+        cout << "LoV      : " << fnGetValue("LoV") << " (" << fnGetRawValue("LoV") << ")" << endl;
+        cout << "HiV      : " << fnGetValue("HiV") << " (" << fnGetRawValue("HiV") << ")" << endl;
+        cout << "ExtremeHiV      : " << fnGetValue("ExtremeHiV") << " (" << fnGetRawValue("ExtremeHiV") << ")" << endl;
+        cout << "QualTime      : " << fnGetValue("QualTime") << " (" << fnGetRawValue("QualTime") << ")" << endl;
+        cout << "BypassMode      : " << fnGetValue("BypassMode") << " (" << fnGetRawValue("BypassMode") << ")" << endl;
+        cout << "RsvBits      : " << fnGetValue("RsvBits") << " (" << fnGetRawValue("RsvBits") << ")" << endl;
+    }
+bool InvAcFltCfgCmd1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvAcFltCfgCmd1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return static_cast<uint32_t>(msg.ucExtremeLoV);
+        }
+        else if (mnem == "LoV") {
+            return static_cast<uint32_t>(msg.ucLoV);
+        }
+        else if (mnem == "HiV") {
+            return static_cast<uint32_t>(msg.ucHiV);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return static_cast<uint32_t>(msg.ucExtremeHiV);
+        }
+        else if (mnem == "QualTime") {
+            return static_cast<uint32_t>(msg.ucQualTime);
+        }
+        else if (mnem == "BypassMode") {
+            return static_cast<uint32_t>(msg.teBypassMode);
+        }
+        else if (mnem == "RsvBits") {
+            return static_cast<uint32_t>(msg.ucRsvBits);
+        }
+        return UINT32_MAX;
+    }
+void InvAcFltCfgCmd1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ExtremeLoV") {
+     msg.ucExtremeLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoV") {
+     msg.ucLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "HiV") {
+     msg.ucHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+     msg.ucExtremeHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "QualTime") {
+     msg.ucQualTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "BypassMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(enumValue);
+     else msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RsvBits") {
+     msg.ucRsvBits = stringToInt(value, 0, 0, 0);
+        }
+    }
+void InvAcFltCfgCmd1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvAcFltCfgCmd1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvAcFltCfgCmd1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return 1.0 * (long double)(msg.ucExtremeLoV + 0.0);
+        }
+        else if (mnem == "LoV") {
+            return 1.0 * (long double)(msg.ucLoV + 0.0);
+        }
+        else if (mnem == "HiV") {
+            return 1.0 * (long double)(msg.ucHiV + 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return 1.0 * (long double)(msg.ucExtremeHiV + 0.0);
+        }
+        else if (mnem == "QualTime") {
+            return 1.0 * (long double)(msg.ucQualTime + 0.0);
+        }
+        else if (mnem == "BypassMode") {
+            return 1.0 * (long double)(msg.teBypassMode + 0.0);
+        }
+        else if (mnem == "RsvBits") {
+            return 1.0 * (long double)(msg.ucRsvBits + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvAcFltCfgSts1
+std::string InvAcFltCfgSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ExtremeLoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeLoV == 0xff) ? "No Data" : (msg.ucExtremeLoV == 0xfe) ? "Out of range" : (msg.ucExtremeLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucLoV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucLoV == 0xff) ? "No Data" : (msg.ucLoV == 0xfe) ? "Out of range" : (msg.ucLoV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucHiV == 0xff) ? "No Data" : (msg.ucHiV == 0xfe) ? "Out of range" : (msg.ucHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtremeHiV") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtremeHiV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "V");
+            return (msg.ucExtremeHiV == 0xff) ? "No Data" : (msg.ucExtremeHiV == 0xfe) ? "Out of range" : (msg.ucExtremeHiV == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "QualTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucQualTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucQualTime == 0xff) ? "No Data" : (msg.ucQualTime == 0xfe) ? "Out of range" : (msg.ucQualTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BypassMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassMode));
+              }
+        }
+        else if (mnem == "RsvBits") {
+            return std::to_string(msg.ucRsvBits);
+        }
+        else return "no pgn";
+    }
+void InvAcFltCfgSts1::Print() const {
+        std::cout << "PGN: InvAcFltCfgSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ExtremeLoV      : " << fnGetValue("ExtremeLoV") << " (" << fnGetRawValue("ExtremeLoV") << ")" << endl;
+        cout << "LoV      : " << fnGetValue("LoV") << " (" << fnGetRawValue("LoV") << ")" << endl;
+        cout << "HiV      : " << fnGetValue("HiV") << " (" << fnGetRawValue("HiV") << ")" << endl;
+        cout << "ExtremeHiV      : " << fnGetValue("ExtremeHiV") << " (" << fnGetRawValue("ExtremeHiV") << ")" << endl;
+        cout << "QualTime      : " << fnGetValue("QualTime") << " (" << fnGetRawValue("QualTime") << ")" << endl;
+        cout << "BypassMode      : " << fnGetValue("BypassMode") << " (" << fnGetRawValue("BypassMode") << ")" << endl;
+        cout << "RsvBits      : " << fnGetValue("RsvBits") << " (" << fnGetRawValue("RsvBits") << ")" << endl;
+    }
+bool InvAcFltCfgSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvAcFltCfgSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return static_cast<uint32_t>(msg.ucExtremeLoV);
+        }
+        else if (mnem == "LoV") {
+            return static_cast<uint32_t>(msg.ucLoV);
+        }
+        else if (mnem == "HiV") {
+            return static_cast<uint32_t>(msg.ucHiV);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return static_cast<uint32_t>(msg.ucExtremeHiV);
+        }
+        else if (mnem == "QualTime") {
+            return static_cast<uint32_t>(msg.ucQualTime);
+        }
+        else if (mnem == "BypassMode") {
+            return static_cast<uint32_t>(msg.teBypassMode);
+        }
+        else if (mnem == "RsvBits") {
+            return static_cast<uint32_t>(msg.ucRsvBits);
+        }
+        return UINT32_MAX;
+    }
+void InvAcFltCfgSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ExtremeLoV") {
+     msg.ucExtremeLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "LoV") {
+     msg.ucLoV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "HiV") {
+     msg.ucHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+     msg.ucExtremeHiV = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "QualTime") {
+     msg.ucQualTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "BypassMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(enumValue);
+     else msg.teBypassMode = static_cast<decltype(msg.teBypassMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RsvBits") {
+     msg.ucRsvBits = stringToInt(value, 0, 0, 0);
+        }
+    }
+void InvAcFltCfgSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvAcFltCfgSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvAcFltCfgSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ExtremeLoV") {
+            return 1.0 * (long double)(msg.ucExtremeLoV + 0.0);
+        }
+        else if (mnem == "LoV") {
+            return 1.0 * (long double)(msg.ucLoV + 0.0);
+        }
+        else if (mnem == "HiV") {
+            return 1.0 * (long double)(msg.ucHiV + 0.0);
+        }
+        else if (mnem == "ExtremeHiV") {
+            return 1.0 * (long double)(msg.ucExtremeHiV + 0.0);
+        }
+        else if (mnem == "QualTime") {
+            return 1.0 * (long double)(msg.ucQualTime + 0.0);
+        }
+        else if (mnem == "BypassMode") {
+            return 1.0 * (long double)(msg.teBypassMode + 0.0);
+        }
+        else if (mnem == "RsvBits") {
+            return 1.0 * (long double)(msg.ucRsvBits + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvAcSts4
+std::string InvAcSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "VFlt") {
+            if (!ENUMLOOKUP_1485834791.fnContains(msg.teVFlt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teVFlt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1485834791.fnText(msg.teVFlt));
+              }
+        }
+        else if (mnem == "FltSurgeProt") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltSurgeProt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltSurgeProt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltSurgeProt));
+              }
+        }
+        else if (mnem == "FltHiFreq") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltHiFreq)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltHiFreq);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltHiFreq));
+              }
+        }
+        else if (mnem == "FltLoFreq") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltLoFreq)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltLoFreq);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltLoFreq));
+              }
+        }
+        else if (mnem == "BypassModeAct") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBypassModeAct)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBypassModeAct);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBypassModeAct));
+              }
+        }
+        else if (mnem == "QualifStat") {
+            if (!ENUMLOOKUP_872434401.fnContains(msg.teQualifStat)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teQualifStat);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_872434401.fnText(msg.teQualifStat));
+              }
+        }
+        else return "no pgn";
+    }
+void InvAcSts4::Print() const {
+        std::cout << "PGN: InvAcSts4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "VFlt      : " << fnGetValue("VFlt") << " (" << fnGetRawValue("VFlt") << ")" << endl;
+        cout << "FltSurgeProt      : " << fnGetValue("FltSurgeProt") << " (" << fnGetRawValue("FltSurgeProt") << ")" << endl;
+        cout << "FltHiFreq      : " << fnGetValue("FltHiFreq") << " (" << fnGetRawValue("FltHiFreq") << ")" << endl;
+        cout << "FltLoFreq      : " << fnGetValue("FltLoFreq") << " (" << fnGetRawValue("FltLoFreq") << ")" << endl;
+        cout << "BypassModeAct      : " << fnGetValue("BypassModeAct") << " (" << fnGetRawValue("BypassModeAct") << ")" << endl;
+        cout << "QualifStat      : " << fnGetValue("QualifStat") << " (" << fnGetRawValue("QualifStat") << ")" << endl;
+    }
+bool InvAcSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvAcSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "VFlt") {
+            return static_cast<uint32_t>(msg.teVFlt);
+        }
+        else if (mnem == "FltSurgeProt") {
+            return static_cast<uint32_t>(msg.teFltSurgeProt);
+        }
+        else if (mnem == "FltHiFreq") {
+            return static_cast<uint32_t>(msg.teFltHiFreq);
+        }
+        else if (mnem == "FltLoFreq") {
+            return static_cast<uint32_t>(msg.teFltLoFreq);
+        }
+        else if (mnem == "BypassModeAct") {
+            return static_cast<uint32_t>(msg.teBypassModeAct);
+        }
+        else if (mnem == "QualifStat") {
+            return static_cast<uint32_t>(msg.teQualifStat);
+        }
+        return UINT32_MAX;
+    }
+void InvAcSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "VFlt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1485834791, value);
+     if (enumValue != -1) msg.teVFlt = static_cast<decltype(msg.teVFlt)>(enumValue);
+     else msg.teVFlt = static_cast<decltype(msg.teVFlt)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltSurgeProt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltSurgeProt = static_cast<decltype(msg.teFltSurgeProt)>(enumValue);
+     else msg.teFltSurgeProt = static_cast<decltype(msg.teFltSurgeProt)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltHiFreq") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltHiFreq = static_cast<decltype(msg.teFltHiFreq)>(enumValue);
+     else msg.teFltHiFreq = static_cast<decltype(msg.teFltHiFreq)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltLoFreq") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltLoFreq = static_cast<decltype(msg.teFltLoFreq)>(enumValue);
+     else msg.teFltLoFreq = static_cast<decltype(msg.teFltLoFreq)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BypassModeAct") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBypassModeAct = static_cast<decltype(msg.teBypassModeAct)>(enumValue);
+     else msg.teBypassModeAct = static_cast<decltype(msg.teBypassModeAct)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "QualifStat") {
+     int enumValue = findEnumValue(ENUMLOOKUP_872434401, value);
+     if (enumValue != -1) msg.teQualifStat = static_cast<decltype(msg.teQualifStat)>(enumValue);
+     else msg.teQualifStat = static_cast<decltype(msg.teQualifStat)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void InvAcSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvAcSts4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvAcSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "VFlt") {
+            return 1.0 * (long double)(msg.teVFlt + 0.0);
+        }
+        else if (mnem == "FltSurgeProt") {
+            return 1.0 * (long double)(msg.teFltSurgeProt + 0.0);
+        }
+        else if (mnem == "FltHiFreq") {
+            return 1.0 * (long double)(msg.teFltHiFreq + 0.0);
+        }
+        else if (mnem == "FltLoFreq") {
+            return 1.0 * (long double)(msg.teFltLoFreq + 0.0);
+        }
+        else if (mnem == "BypassModeAct") {
+            return 1.0 * (long double)(msg.teBypassModeAct + 0.0);
+        }
+        else if (mnem == "QualifStat") {
+            return 1.0 * (long double)(msg.teQualifStat + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvOpsSts
+std::string InvOpsSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "TotalInst") {
+            return (msg.ucTotalInst == 0xff) ? "No Data" : (msg.ucTotalInst == 0xfe) ? "Out of range" : (msg.ucTotalInst == 0xfd) ? "Reserved" : std::to_string(msg.ucTotalInst);
+        }
+        else if (mnem == "Voltage") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiVoltage + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiVoltage == 0xffff) ? "No Data" : (msg.uiVoltage == 0xfffe) ? "Out of range" : (msg.uiVoltage == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Current") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiCurrent + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiCurrent == 0xffff) ? "No Data" : (msg.uiCurrent == 0xfffe) ? "Out of range" : (msg.uiCurrent == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Temp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucTemp == 0xff) ? "No Data" : (msg.ucTemp == 0xfe) ? "Out of range" : (msg.ucTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvOpsSts::Print() const {
+        std::cout << "PGN: InvOpsSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "TotalInst      : " << fnGetValue("TotalInst") << " (" << fnGetRawValue("TotalInst") << ")" << endl;
+        cout << "Voltage      : " << fnGetValue("Voltage") << " (" << fnGetRawValue("Voltage") << ")" << endl;
+        cout << "Current      : " << fnGetValue("Current") << " (" << fnGetRawValue("Current") << ")" << endl;
+        cout << "Temp      : " << fnGetValue("Temp") << " (" << fnGetRawValue("Temp") << ")" << endl;
+    }
+bool InvOpsSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvOpsSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "TotalInst") {
+            return static_cast<uint32_t>(msg.ucTotalInst);
+        }
+        else if (mnem == "Voltage") {
+            return static_cast<uint32_t>(msg.uiVoltage);
+        }
+        else if (mnem == "Current") {
+            return static_cast<uint32_t>(msg.uiCurrent);
+        }
+        else if (mnem == "Temp") {
+            return static_cast<uint32_t>(msg.ucTemp);
+        }
+        return UINT32_MAX;
+    }
+void InvOpsSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TotalInst") {
+     msg.ucTotalInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Voltage") {
+     msg.uiVoltage = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "Current") {
+     msg.uiCurrent = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Temp") {
+     msg.ucTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void InvOpsSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvOpsSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvOpsSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "TotalInst") {
+            return 1.0 * (long double)(msg.ucTotalInst + 0.0);
+        }
+        else if (mnem == "Voltage") {
+            return 0.05000000074505806 * (long double)(msg.uiVoltage + 0.0);
+        }
+        else if (mnem == "Current") {
+            return 0.05000000074505806 * (long double)(msg.uiCurrent + -32000.0);
+        }
+        else if (mnem == "Temp") {
+            return 1.0 * (long double)(msg.ucTemp + -40.0);
+        }
+        return 0.0;
+    }
+
+// InvHvDcBusSts
+std::string InvHvDcBusSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "TotalInst") {
+            return (msg.ucTotalInst == 0xff) ? "No Data" : (msg.ucTotalInst == 0xfe) ? "Out of range" : (msg.ucTotalInst == 0xfd) ? "Reserved" : std::to_string(msg.ucTotalInst);
+        }
+        else if (mnem == "Voltage") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiVoltage + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiVoltage == 0xffff) ? "No Data" : (msg.uiVoltage == 0xfffe) ? "Out of range" : (msg.uiVoltage == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Current") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiCurrent + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiCurrent == 0xffff) ? "No Data" : (msg.uiCurrent == 0xfffe) ? "Out of range" : (msg.uiCurrent == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Temp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucTemp == 0xff) ? "No Data" : (msg.ucTemp == 0xfe) ? "Out of range" : (msg.ucTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvHvDcBusSts::Print() const {
+        std::cout << "PGN: InvHvDcBusSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "TotalInst      : " << fnGetValue("TotalInst") << " (" << fnGetRawValue("TotalInst") << ")" << endl;
+        cout << "Voltage      : " << fnGetValue("Voltage") << " (" << fnGetRawValue("Voltage") << ")" << endl;
+        cout << "Current      : " << fnGetValue("Current") << " (" << fnGetRawValue("Current") << ")" << endl;
+        cout << "Temp      : " << fnGetValue("Temp") << " (" << fnGetRawValue("Temp") << ")" << endl;
+    }
+bool InvHvDcBusSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvHvDcBusSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "TotalInst") {
+            return static_cast<uint32_t>(msg.ucTotalInst);
+        }
+        else if (mnem == "Voltage") {
+            return static_cast<uint32_t>(msg.uiVoltage);
+        }
+        else if (mnem == "Current") {
+            return static_cast<uint32_t>(msg.uiCurrent);
+        }
+        else if (mnem == "Temp") {
+            return static_cast<uint32_t>(msg.ucTemp);
+        }
+        return UINT32_MAX;
+    }
+void InvHvDcBusSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TotalInst") {
+     msg.ucTotalInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Voltage") {
+     msg.uiVoltage = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "Current") {
+     msg.uiCurrent = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Temp") {
+     msg.ucTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void InvHvDcBusSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvHvDcBusSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvHvDcBusSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "TotalInst") {
+            return 1.0 * (long double)(msg.ucTotalInst + 0.0);
+        }
+        else if (mnem == "Voltage") {
+            return 0.05000000074505806 * (long double)(msg.uiVoltage + 0.0);
+        }
+        else if (mnem == "Current") {
+            return 0.05000000074505806 * (long double)(msg.uiCurrent + -32000.0);
+        }
+        else if (mnem == "Temp") {
+            return 1.0 * (long double)(msg.ucTemp + -40.0);
+        }
+        return 0.0;
+    }
+
+// InvApsSts
+std::string InvApsSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "TotalInst") {
+            return (msg.ucTotalInst == 0xff) ? "No Data" : (msg.ucTotalInst == 0xfe) ? "Out of range" : (msg.ucTotalInst == 0xfd) ? "Reserved" : std::to_string(msg.ucTotalInst);
+        }
+        else if (mnem == "Voltage") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiVoltage + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiVoltage == 0xffff) ? "No Data" : (msg.uiVoltage == 0xfffe) ? "Out of range" : (msg.uiVoltage == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Current") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiCurrent + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiCurrent == 0xffff) ? "No Data" : (msg.uiCurrent == 0xfffe) ? "Out of range" : (msg.uiCurrent == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Temp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucTemp == 0xff) ? "No Data" : (msg.ucTemp == 0xfe) ? "Out of range" : (msg.ucTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvApsSts::Print() const {
+        std::cout << "PGN: InvApsSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "TotalInst      : " << fnGetValue("TotalInst") << " (" << fnGetRawValue("TotalInst") << ")" << endl;
+        cout << "Voltage      : " << fnGetValue("Voltage") << " (" << fnGetRawValue("Voltage") << ")" << endl;
+        cout << "Current      : " << fnGetValue("Current") << " (" << fnGetRawValue("Current") << ")" << endl;
+        cout << "Temp      : " << fnGetValue("Temp") << " (" << fnGetRawValue("Temp") << ")" << endl;
+    }
+bool InvApsSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvApsSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "TotalInst") {
+            return static_cast<uint32_t>(msg.ucTotalInst);
+        }
+        else if (mnem == "Voltage") {
+            return static_cast<uint32_t>(msg.uiVoltage);
+        }
+        else if (mnem == "Current") {
+            return static_cast<uint32_t>(msg.uiCurrent);
+        }
+        else if (mnem == "Temp") {
+            return static_cast<uint32_t>(msg.ucTemp);
+        }
+        return UINT32_MAX;
+    }
+void InvApsSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TotalInst") {
+     msg.ucTotalInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Voltage") {
+     msg.uiVoltage = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "Current") {
+     msg.uiCurrent = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Temp") {
+     msg.ucTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void InvApsSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvApsSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvApsSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "TotalInst") {
+            return 1.0 * (long double)(msg.ucTotalInst + 0.0);
+        }
+        else if (mnem == "Voltage") {
+            return 0.05000000074505806 * (long double)(msg.uiVoltage + 0.0);
+        }
+        else if (mnem == "Current") {
+            return 0.05000000074505806 * (long double)(msg.uiCurrent + -32000.0);
+        }
+        else if (mnem == "Temp") {
+            return 1.0 * (long double)(msg.ucTemp + -40.0);
+        }
+        return 0.0;
+    }
+
+// InvStatsSts
+std::string InvStatsSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "NumDcUvDetects") {
+            return (msg.uiNumDcUvDetects == 0xffff) ? "No Data" : (msg.uiNumDcUvDetects == 0xfffe) ? "Out of range" : (msg.uiNumDcUvDetects == 0xfffd) ? "Reserved" : std::to_string(msg.uiNumDcUvDetects);
+        }
+        else if (mnem == "NumInvAcOutOvlds") {
+            return (msg.uiNumInvAcOutOvlds == 0xffff) ? "No Data" : (msg.uiNumInvAcOutOvlds == 0xfffe) ? "Out of range" : (msg.uiNumInvAcOutOvlds == 0xfffd) ? "Reserved" : std::to_string(msg.uiNumInvAcOutOvlds);
+        }
+        else if (mnem == "NumLdSensEngage") {
+            return (msg.uiNumLdSensEngage == 0xffff) ? "No Data" : (msg.uiNumLdSensEngage == 0xfffe) ? "Out of range" : (msg.uiNumLdSensEngage == 0xfffd) ? "Reserved" : std::to_string(msg.uiNumLdSensEngage);
+        }
+        else if (mnem == "LowestDcV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiLowestDcV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiLowestDcV == 0xffff) ? "No Data" : (msg.uiLowestDcV == 0xfffe) ? "Out of range" : (msg.uiLowestDcV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HighestDcV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiHighestDcV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiHighestDcV == 0xffff) ? "No Data" : (msg.uiHighestDcV == 0xfffe) ? "Out of range" : (msg.uiHighestDcV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LowestAcVIn") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiLowestAcVIn + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiLowestAcVIn == 0xffff) ? "No Data" : (msg.uiLowestAcVIn == 0xfffe) ? "Out of range" : (msg.uiLowestAcVIn == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HighestAcVIn") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiHighestAcVIn + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiHighestAcVIn == 0xffff) ? "No Data" : (msg.uiHighestAcVIn == 0xfffe) ? "Out of range" : (msg.uiHighestAcVIn == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LowestAcVOut") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiLowestAcVOut + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiLowestAcVOut == 0xffff) ? "No Data" : (msg.uiLowestAcVOut == 0xfffe) ? "Out of range" : (msg.uiLowestAcVOut == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HighestAcVOut") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiHighestAcVOut + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiHighestAcVOut == 0xffff) ? "No Data" : (msg.uiHighestAcVOut == 0xfffe) ? "Out of range" : (msg.uiHighestAcVOut == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvStatsSts::Print() const {
+        std::cout << "PGN: InvStatsSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "NumDcUvDetects      : " << fnGetValue("NumDcUvDetects") << " (" << fnGetRawValue("NumDcUvDetects") << ")" << endl;
+        cout << "NumInvAcOutOvlds      : " << fnGetValue("NumInvAcOutOvlds") << " (" << fnGetRawValue("NumInvAcOutOvlds") << ")" << endl;
+        cout << "NumLdSensEngage      : " << fnGetValue("NumLdSensEngage") << " (" << fnGetRawValue("NumLdSensEngage") << ")" << endl;
+        cout << "LowestDcV      : " << fnGetValue("LowestDcV") << " (" << fnGetRawValue("LowestDcV") << ")" << endl;
+        cout << "HighestDcV      : " << fnGetValue("HighestDcV") << " (" << fnGetRawValue("HighestDcV") << ")" << endl;
+        cout << "LowestAcVIn      : " << fnGetValue("LowestAcVIn") << " (" << fnGetRawValue("LowestAcVIn") << ")" << endl;
+        cout << "HighestAcVIn      : " << fnGetValue("HighestAcVIn") << " (" << fnGetRawValue("HighestAcVIn") << ")" << endl;
+        cout << "LowestAcVOut      : " << fnGetValue("LowestAcVOut") << " (" << fnGetRawValue("LowestAcVOut") << ")" << endl;
+        cout << "HighestAcVOut      : " << fnGetValue("HighestAcVOut") << " (" << fnGetRawValue("HighestAcVOut") << ")" << endl;
+    }
+bool InvStatsSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvStatsSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "NumDcUvDetects") {
+            return static_cast<uint32_t>(msg.uiNumDcUvDetects);
+        }
+        else if (mnem == "NumInvAcOutOvlds") {
+            return static_cast<uint32_t>(msg.uiNumInvAcOutOvlds);
+        }
+        else if (mnem == "NumLdSensEngage") {
+            return static_cast<uint32_t>(msg.uiNumLdSensEngage);
+        }
+        else if (mnem == "LowestDcV") {
+            return static_cast<uint32_t>(msg.uiLowestDcV);
+        }
+        else if (mnem == "HighestDcV") {
+            return static_cast<uint32_t>(msg.uiHighestDcV);
+        }
+        else if (mnem == "LowestAcVIn") {
+            return static_cast<uint32_t>(msg.uiLowestAcVIn);
+        }
+        else if (mnem == "HighestAcVIn") {
+            return static_cast<uint32_t>(msg.uiHighestAcVIn);
+        }
+        else if (mnem == "LowestAcVOut") {
+            return static_cast<uint32_t>(msg.uiLowestAcVOut);
+        }
+        else if (mnem == "HighestAcVOut") {
+            return static_cast<uint32_t>(msg.uiHighestAcVOut);
+        }
+        return UINT32_MAX;
+    }
+void InvStatsSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "NumDcUvDetects") {
+     msg.uiNumDcUvDetects = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "NumInvAcOutOvlds") {
+     msg.uiNumInvAcOutOvlds = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "NumLdSensEngage") {
+     msg.uiNumLdSensEngage = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "LowestDcV") {
+     msg.uiLowestDcV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "HighestDcV") {
+     msg.uiHighestDcV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "LowestAcVIn") {
+     msg.uiLowestAcVIn = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "HighestAcVIn") {
+     msg.uiHighestAcVIn = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "LowestAcVOut") {
+     msg.uiLowestAcVOut = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "HighestAcVOut") {
+     msg.uiHighestAcVOut = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void InvStatsSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvStatsSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvStatsSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "NumDcUvDetects") {
+            return 1.0 * (long double)(msg.uiNumDcUvDetects + 0.0);
+        }
+        else if (mnem == "NumInvAcOutOvlds") {
+            return 1.0 * (long double)(msg.uiNumInvAcOutOvlds + 0.0);
+        }
+        else if (mnem == "NumLdSensEngage") {
+            return 1.0 * (long double)(msg.uiNumLdSensEngage + 0.0);
+        }
+        else if (mnem == "LowestDcV") {
+            return 0.05000000074505806 * (long double)(msg.uiLowestDcV + 0.0);
+        }
+        else if (mnem == "HighestDcV") {
+            return 0.05000000074505806 * (long double)(msg.uiHighestDcV + 0.0);
+        }
+        else if (mnem == "LowestAcVIn") {
+            return 0.05000000074505806 * (long double)(msg.uiLowestAcVIn + 0.0);
+        }
+        else if (mnem == "HighestAcVIn") {
+            return 0.05000000074505806 * (long double)(msg.uiHighestAcVIn + 0.0);
+        }
+        else if (mnem == "LowestAcVOut") {
+            return 0.05000000074505806 * (long double)(msg.uiLowestAcVOut + 0.0);
+        }
+        else if (mnem == "HighestAcVOut") {
+            return 0.05000000074505806 * (long double)(msg.uiHighestAcVOut + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgCmd2
+std::string InvCfgCmd2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcSdVMax + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcSdVMax == 0xffff) ? "No Data" : (msg.uiDcSrcSdVMax == 0xfffe) ? "Out of range" : (msg.uiDcSrcSdVMax == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcWrnVMin + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcWrnVMin == 0xffff) ? "No Data" : (msg.uiDcSrcWrnVMin == 0xfffe) ? "Out of range" : (msg.uiDcSrcWrnVMin == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcWrnVMax + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcWrnVMax == 0xffff) ? "No Data" : (msg.uiDcSrcWrnVMax == 0xfffe) ? "Out of range" : (msg.uiDcSrcWrnVMax == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgCmd2::Print() const {
+        std::cout << "PGN: InvCfgCmd2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DcSrcSdVMax      : " << fnGetValue("DcSrcSdVMax") << " (" << fnGetRawValue("DcSrcSdVMax") << ")" << endl;
+        cout << "DcSrcWrnVMin      : " << fnGetValue("DcSrcWrnVMin") << " (" << fnGetRawValue("DcSrcWrnVMin") << ")" << endl;
+        cout << "DcSrcWrnVMax      : " << fnGetValue("DcSrcWrnVMax") << " (" << fnGetRawValue("DcSrcWrnVMax") << ")" << endl;
+    }
+bool InvCfgCmd2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgCmd2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+            return static_cast<uint32_t>(msg.uiDcSrcSdVMax);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+            return static_cast<uint32_t>(msg.uiDcSrcWrnVMin);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+            return static_cast<uint32_t>(msg.uiDcSrcWrnVMax);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgCmd2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+     msg.uiDcSrcSdVMax = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+     msg.uiDcSrcWrnVMin = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+     msg.uiDcSrcWrnVMax = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void InvCfgCmd2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgCmd2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgCmd2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcSdVMax + 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcWrnVMin + 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcWrnVMax + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgCmd1
+std::string InvCfgCmd1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiLoadSensePwrThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiLoadSensePwrThresh == 0xffff) ? "No Data" : (msg.uiLoadSensePwrThresh == 0xfffe) ? "Out of range" : (msg.uiLoadSensePwrThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.uiLoadSenseIntvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "s");
+            return (msg.uiLoadSenseIntvl == 0xffff) ? "No Data" : (msg.uiLoadSenseIntvl == 0xfffe) ? "Out of range" : (msg.uiLoadSenseIntvl == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcSdVMin + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcSdVMin == 0xffff) ? "No Data" : (msg.uiDcSrcSdVMin == 0xfffe) ? "Out of range" : (msg.uiDcSrcSdVMin == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgCmd1::Print() const {
+        std::cout << "PGN: InvCfgCmd1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "LoadSensePwrThresh      : " << fnGetValue("LoadSensePwrThresh") << " (" << fnGetRawValue("LoadSensePwrThresh") << ")" << endl;
+        cout << "LoadSenseIntvl      : " << fnGetValue("LoadSenseIntvl") << " (" << fnGetRawValue("LoadSenseIntvl") << ")" << endl;
+        cout << "DcSrcSdVMin      : " << fnGetValue("DcSrcSdVMin") << " (" << fnGetRawValue("DcSrcSdVMin") << ")" << endl;
+    }
+bool InvCfgCmd1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgCmd1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+            return static_cast<uint32_t>(msg.uiLoadSensePwrThresh);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+            return static_cast<uint32_t>(msg.uiLoadSenseIntvl);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+            return static_cast<uint32_t>(msg.uiDcSrcSdVMin);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgCmd1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+     msg.uiLoadSensePwrThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+     msg.uiLoadSenseIntvl = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.5, 0.0);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+     msg.uiDcSrcSdVMin = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void InvCfgCmd1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgCmd1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgCmd1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+            return 1.0 * (long double)(msg.uiLoadSensePwrThresh + 0.0);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+            return 0.5 * (long double)(msg.uiLoadSenseIntvl + 0.0);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcSdVMin + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgSts2
+std::string InvCfgSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcSdVMax + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcSdVMax == 0xffff) ? "No Data" : (msg.uiDcSrcSdVMax == 0xfffe) ? "Out of range" : (msg.uiDcSrcSdVMax == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcWrnVMin + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcWrnVMin == 0xffff) ? "No Data" : (msg.uiDcSrcWrnVMin == 0xfffe) ? "Out of range" : (msg.uiDcSrcWrnVMin == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcWrnVMax + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcWrnVMax == 0xffff) ? "No Data" : (msg.uiDcSrcWrnVMax == 0xfffe) ? "Out of range" : (msg.uiDcSrcWrnVMax == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvCfgSts2::Print() const {
+        std::cout << "PGN: InvCfgSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DcSrcSdVMax      : " << fnGetValue("DcSrcSdVMax") << " (" << fnGetRawValue("DcSrcSdVMax") << ")" << endl;
+        cout << "DcSrcWrnVMin      : " << fnGetValue("DcSrcWrnVMin") << " (" << fnGetRawValue("DcSrcWrnVMin") << ")" << endl;
+        cout << "DcSrcWrnVMax      : " << fnGetValue("DcSrcWrnVMax") << " (" << fnGetRawValue("DcSrcWrnVMax") << ")" << endl;
+    }
+bool InvCfgSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+            return static_cast<uint32_t>(msg.uiDcSrcSdVMax);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+            return static_cast<uint32_t>(msg.uiDcSrcWrnVMin);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+            return static_cast<uint32_t>(msg.uiDcSrcWrnVMax);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+     msg.uiDcSrcSdVMax = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+     msg.uiDcSrcWrnVMin = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+     msg.uiDcSrcWrnVMax = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void InvCfgSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DcSrcSdVMax") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcSdVMax + 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMin") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcWrnVMin + 0.0);
+        }
+        else if (mnem == "DcSrcWrnVMax") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcWrnVMax + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvCfgSts1
+std::string InvCfgSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiLoadSensePwrThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiLoadSensePwrThresh == 0xffff) ? "No Data" : (msg.uiLoadSensePwrThresh == 0xfffe) ? "Out of range" : (msg.uiLoadSensePwrThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.uiLoadSenseIntvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "s");
+            return (msg.uiLoadSenseIntvl == 0xffff) ? "No Data" : (msg.uiLoadSenseIntvl == 0xfffe) ? "Out of range" : (msg.uiLoadSenseIntvl == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiDcSrcSdVMin + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiDcSrcSdVMin == 0xffff) ? "No Data" : (msg.uiDcSrcSdVMin == 0xfffe) ? "Out of range" : (msg.uiDcSrcSdVMin == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "InvEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teInvEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teInvEnOnStartUp));
+              }
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teLdSenseEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLdSenseEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teLdSenseEnOnStartUp));
+              }
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teAcPassThruEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcPassThruEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teAcPassThruEnOnStartUp));
+              }
+        }
+        else if (mnem == "GenSupportEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teGenSupportEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenSupportEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teGenSupportEnOnStartUp));
+              }
+        }
+        else return "no pgn";
+    }
+void InvCfgSts1::Print() const {
+        std::cout << "PGN: InvCfgSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "LoadSensePwrThresh      : " << fnGetValue("LoadSensePwrThresh") << " (" << fnGetRawValue("LoadSensePwrThresh") << ")" << endl;
+        cout << "LoadSenseIntvl      : " << fnGetValue("LoadSenseIntvl") << " (" << fnGetRawValue("LoadSenseIntvl") << ")" << endl;
+        cout << "DcSrcSdVMin      : " << fnGetValue("DcSrcSdVMin") << " (" << fnGetRawValue("DcSrcSdVMin") << ")" << endl;
+        cout << "InvEnOnStartUp      : " << fnGetValue("InvEnOnStartUp") << " (" << fnGetRawValue("InvEnOnStartUp") << ")" << endl;
+        cout << "LdSenseEnOnStartUp      : " << fnGetValue("LdSenseEnOnStartUp") << " (" << fnGetRawValue("LdSenseEnOnStartUp") << ")" << endl;
+        cout << "AcPassThruEnOnStartUp      : " << fnGetValue("AcPassThruEnOnStartUp") << " (" << fnGetRawValue("AcPassThruEnOnStartUp") << ")" << endl;
+        cout << "GenSupportEnOnStartUp      : " << fnGetValue("GenSupportEnOnStartUp") << " (" << fnGetRawValue("GenSupportEnOnStartUp") << ")" << endl;
+    }
+bool InvCfgSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCfgSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+            return static_cast<uint32_t>(msg.uiLoadSensePwrThresh);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+            return static_cast<uint32_t>(msg.uiLoadSenseIntvl);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+            return static_cast<uint32_t>(msg.uiDcSrcSdVMin);
+        }
+        else if (mnem == "InvEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teInvEnOnStartUp);
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teLdSenseEnOnStartUp);
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teAcPassThruEnOnStartUp);
+        }
+        else if (mnem == "GenSupportEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teGenSupportEnOnStartUp);
+        }
+        return UINT32_MAX;
+    }
+void InvCfgSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+     msg.uiLoadSensePwrThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+     msg.uiLoadSenseIntvl = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.5, 0.0);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+     msg.uiDcSrcSdVMin = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "InvEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teInvEnOnStartUp = static_cast<decltype(msg.teInvEnOnStartUp)>(enumValue);
+     else msg.teInvEnOnStartUp = static_cast<decltype(msg.teInvEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teLdSenseEnOnStartUp = static_cast<decltype(msg.teLdSenseEnOnStartUp)>(enumValue);
+     else msg.teLdSenseEnOnStartUp = static_cast<decltype(msg.teLdSenseEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teAcPassThruEnOnStartUp = static_cast<decltype(msg.teAcPassThruEnOnStartUp)>(enumValue);
+     else msg.teAcPassThruEnOnStartUp = static_cast<decltype(msg.teAcPassThruEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenSupportEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teGenSupportEnOnStartUp = static_cast<decltype(msg.teGenSupportEnOnStartUp)>(enumValue);
+     else msg.teGenSupportEnOnStartUp = static_cast<decltype(msg.teGenSupportEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void InvCfgSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCfgSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCfgSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "LoadSensePwrThresh") {
+            return 1.0 * (long double)(msg.uiLoadSensePwrThresh + 0.0);
+        }
+        else if (mnem == "LoadSenseIntvl") {
+            return 0.5 * (long double)(msg.uiLoadSenseIntvl + 0.0);
+        }
+        else if (mnem == "DcSrcSdVMin") {
+            return 0.05000000074505806 * (long double)(msg.uiDcSrcSdVMin + 0.0);
+        }
+        else if (mnem == "InvEnOnStartUp") {
+            return 1.0 * (long double)(msg.teInvEnOnStartUp + 0.0);
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+            return 1.0 * (long double)(msg.teLdSenseEnOnStartUp + 0.0);
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+            return 1.0 * (long double)(msg.teAcPassThruEnOnStartUp + 0.0);
+        }
+        else if (mnem == "GenSupportEnOnStartUp") {
+            return 1.0 * (long double)(msg.teGenSupportEnOnStartUp + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvCmd
+std::string InvCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "InvEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teInvEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teInvEn));
+              }
+        }
+        else if (mnem == "LoadSenseEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teLoadSenseEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLoadSenseEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teLoadSenseEn));
+              }
+        }
+        else if (mnem == "PassThruEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.tePassThruEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePassThruEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.tePassThruEn));
+              }
+        }
+        else if (mnem == "GenSupportEn") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teGenSupportEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenSupportEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teGenSupportEn));
+              }
+        }
+        else if (mnem == "InvEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teInvEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teInvEnOnStartUp));
+              }
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teLdSenseEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLdSenseEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teLdSenseEnOnStartUp));
+              }
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teAcPassThruEnOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcPassThruEnOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teAcPassThruEnOnStartUp));
+              }
+        }
+        else if (mnem == "GenSupportOnStartUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teGenSupportOnStartUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenSupportOnStartUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teGenSupportOnStartUp));
+              }
+        }
+        else return "no pgn";
+    }
+void InvCmd::Print() const {
+        std::cout << "PGN: InvCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "InvEn      : " << fnGetValue("InvEn") << " (" << fnGetRawValue("InvEn") << ")" << endl;
+        cout << "LoadSenseEn      : " << fnGetValue("LoadSenseEn") << " (" << fnGetRawValue("LoadSenseEn") << ")" << endl;
+        cout << "PassThruEn      : " << fnGetValue("PassThruEn") << " (" << fnGetRawValue("PassThruEn") << ")" << endl;
+        cout << "GenSupportEn      : " << fnGetValue("GenSupportEn") << " (" << fnGetRawValue("GenSupportEn") << ")" << endl;
+        cout << "InvEnOnStartUp      : " << fnGetValue("InvEnOnStartUp") << " (" << fnGetRawValue("InvEnOnStartUp") << ")" << endl;
+        cout << "LdSenseEnOnStartUp      : " << fnGetValue("LdSenseEnOnStartUp") << " (" << fnGetRawValue("LdSenseEnOnStartUp") << ")" << endl;
+        cout << "AcPassThruEnOnStartUp      : " << fnGetValue("AcPassThruEnOnStartUp") << " (" << fnGetRawValue("AcPassThruEnOnStartUp") << ")" << endl;
+        cout << "GenSupportOnStartUp      : " << fnGetValue("GenSupportOnStartUp") << " (" << fnGetRawValue("GenSupportOnStartUp") << ")" << endl;
+    }
+bool InvCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "InvEn") {
+            return static_cast<uint32_t>(msg.teInvEn);
+        }
+        else if (mnem == "LoadSenseEn") {
+            return static_cast<uint32_t>(msg.teLoadSenseEn);
+        }
+        else if (mnem == "PassThruEn") {
+            return static_cast<uint32_t>(msg.tePassThruEn);
+        }
+        else if (mnem == "GenSupportEn") {
+            return static_cast<uint32_t>(msg.teGenSupportEn);
+        }
+        else if (mnem == "InvEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teInvEnOnStartUp);
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teLdSenseEnOnStartUp);
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+            return static_cast<uint32_t>(msg.teAcPassThruEnOnStartUp);
+        }
+        else if (mnem == "GenSupportOnStartUp") {
+            return static_cast<uint32_t>(msg.teGenSupportOnStartUp);
+        }
+        return UINT32_MAX;
+    }
+void InvCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "InvEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teInvEn = static_cast<decltype(msg.teInvEn)>(enumValue);
+     else msg.teInvEn = static_cast<decltype(msg.teInvEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LoadSenseEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teLoadSenseEn = static_cast<decltype(msg.teLoadSenseEn)>(enumValue);
+     else msg.teLoadSenseEn = static_cast<decltype(msg.teLoadSenseEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PassThruEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.tePassThruEn = static_cast<decltype(msg.tePassThruEn)>(enumValue);
+     else msg.tePassThruEn = static_cast<decltype(msg.tePassThruEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenSupportEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teGenSupportEn = static_cast<decltype(msg.teGenSupportEn)>(enumValue);
+     else msg.teGenSupportEn = static_cast<decltype(msg.teGenSupportEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InvEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teInvEnOnStartUp = static_cast<decltype(msg.teInvEnOnStartUp)>(enumValue);
+     else msg.teInvEnOnStartUp = static_cast<decltype(msg.teInvEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teLdSenseEnOnStartUp = static_cast<decltype(msg.teLdSenseEnOnStartUp)>(enumValue);
+     else msg.teLdSenseEnOnStartUp = static_cast<decltype(msg.teLdSenseEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teAcPassThruEnOnStartUp = static_cast<decltype(msg.teAcPassThruEnOnStartUp)>(enumValue);
+     else msg.teAcPassThruEnOnStartUp = static_cast<decltype(msg.teAcPassThruEnOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenSupportOnStartUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teGenSupportOnStartUp = static_cast<decltype(msg.teGenSupportOnStartUp)>(enumValue);
+     else msg.teGenSupportOnStartUp = static_cast<decltype(msg.teGenSupportOnStartUp)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void InvCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "InvEn") {
+            return 1.0 * (long double)(msg.teInvEn + 0.0);
+        }
+        else if (mnem == "LoadSenseEn") {
+            return 1.0 * (long double)(msg.teLoadSenseEn + 0.0);
+        }
+        else if (mnem == "PassThruEn") {
+            return 1.0 * (long double)(msg.tePassThruEn + 0.0);
+        }
+        else if (mnem == "GenSupportEn") {
+            return 1.0 * (long double)(msg.teGenSupportEn + 0.0);
+        }
+        else if (mnem == "InvEnOnStartUp") {
+            return 1.0 * (long double)(msg.teInvEnOnStartUp + 0.0);
+        }
+        else if (mnem == "LdSenseEnOnStartUp") {
+            return 1.0 * (long double)(msg.teLdSenseEnOnStartUp + 0.0);
+        }
+        else if (mnem == "AcPassThruEnOnStartUp") {
+            return 1.0 * (long double)(msg.teAcPassThruEnOnStartUp + 0.0);
+        }
+        else if (mnem == "GenSupportOnStartUp") {
+            return 1.0 * (long double)(msg.teGenSupportOnStartUp + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvSts
+std::string InvSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return (msg.ucInst == 0xff) ? "No Data" : (msg.ucInst == 0xfe) ? "Out of range" : (msg.ucInst == 0xfd) ? "Reserved" : std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Sts") {
+            if (!ENUMLOOKUP_9404.fnContains(msg.teSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9404.fnText(msg.teSts));
+              }
+        }
+        else if (mnem == "BattTempSensPres") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBattTempSensPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattTempSensPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBattTempSensPres));
+              }
+        }
+        else if (mnem == "LoadSenseEn") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLoadSenseEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLoadSenseEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLoadSenseEn));
+              }
+        }
+        else if (mnem == "InverterEn") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInverterEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInverterEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInverterEn));
+              }
+        }
+        else if (mnem == "PassthruEn") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.tePassthruEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePassthruEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.tePassthruEn));
+              }
+        }
+        else if (mnem == "GenSupportEn") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teGenSupportEn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGenSupportEn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teGenSupportEn));
+              }
+        }
+        else return "no pgn";
+    }
+void InvSts::Print() const {
+        std::cout << "PGN: InvSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Sts      : " << fnGetValue("Sts") << " (" << fnGetRawValue("Sts") << ")" << endl;
+        cout << "BattTempSensPres      : " << fnGetValue("BattTempSensPres") << " (" << fnGetRawValue("BattTempSensPres") << ")" << endl;
+        cout << "LoadSenseEn      : " << fnGetValue("LoadSenseEn") << " (" << fnGetRawValue("LoadSenseEn") << ")" << endl;
+        cout << "InverterEn      : " << fnGetValue("InverterEn") << " (" << fnGetRawValue("InverterEn") << ")" << endl;
+        cout << "PassthruEn      : " << fnGetValue("PassthruEn") << " (" << fnGetRawValue("PassthruEn") << ")" << endl;
+        cout << "GenSupportEn      : " << fnGetValue("GenSupportEn") << " (" << fnGetRawValue("GenSupportEn") << ")" << endl;
+    }
+bool InvSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Sts") {
+            return static_cast<uint32_t>(msg.teSts);
+        }
+        else if (mnem == "BattTempSensPres") {
+            return static_cast<uint32_t>(msg.teBattTempSensPres);
+        }
+        else if (mnem == "LoadSenseEn") {
+            return static_cast<uint32_t>(msg.teLoadSenseEn);
+        }
+        else if (mnem == "InverterEn") {
+            return static_cast<uint32_t>(msg.teInverterEn);
+        }
+        else if (mnem == "PassthruEn") {
+            return static_cast<uint32_t>(msg.tePassthruEn);
+        }
+        else if (mnem == "GenSupportEn") {
+            return static_cast<uint32_t>(msg.teGenSupportEn);
+        }
+        return UINT32_MAX;
+    }
+void InvSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Sts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9404, value);
+     if (enumValue != -1) msg.teSts = static_cast<decltype(msg.teSts)>(enumValue);
+     else msg.teSts = static_cast<decltype(msg.teSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattTempSensPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBattTempSensPres = static_cast<decltype(msg.teBattTempSensPres)>(enumValue);
+     else msg.teBattTempSensPres = static_cast<decltype(msg.teBattTempSensPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LoadSenseEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLoadSenseEn = static_cast<decltype(msg.teLoadSenseEn)>(enumValue);
+     else msg.teLoadSenseEn = static_cast<decltype(msg.teLoadSenseEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InverterEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInverterEn = static_cast<decltype(msg.teInverterEn)>(enumValue);
+     else msg.teInverterEn = static_cast<decltype(msg.teInverterEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PassthruEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.tePassthruEn = static_cast<decltype(msg.tePassthruEn)>(enumValue);
+     else msg.tePassthruEn = static_cast<decltype(msg.tePassthruEn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GenSupportEn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teGenSupportEn = static_cast<decltype(msg.teGenSupportEn)>(enumValue);
+     else msg.teGenSupportEn = static_cast<decltype(msg.teGenSupportEn)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void InvSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvSts::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnInvSts2InvEnDis") return fnInvSts2InvEnDis(param_value);
+ return "";     };
+long double InvSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Sts") {
+            return 1.0 * (long double)(msg.teSts + 0.0);
+        }
+        else if (mnem == "BattTempSensPres") {
+            return 1.0 * (long double)(msg.teBattTempSensPres + 0.0);
+        }
+        else if (mnem == "LoadSenseEn") {
+            return 1.0 * (long double)(msg.teLoadSenseEn + 0.0);
+        }
+        else if (mnem == "InverterEn") {
+            return 1.0 * (long double)(msg.teInverterEn + 0.0);
+        }
+        else if (mnem == "PassthruEn") {
+            return 1.0 * (long double)(msg.tePassthruEn + 0.0);
+        }
+        else if (mnem == "GenSupportEn") {
+            return 1.0 * (long double)(msg.teGenSupportEn + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvAcSts3
+std::string InvAcSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "Waveform") {
+            if (!ENUMLOOKUP_1484338823.fnContains(msg.teWaveform)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teWaveform);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484338823.fnText(msg.teWaveform));
+              }
+        }
+        else if (mnem == "PhsSts") {
+            if (!ENUMLOOKUP_9421.fnContains(msg.tePhsSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePhsSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9421.fnText(msg.tePhsSts));
+              }
+        }
+        else if (mnem == "RealPwr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiRealPwr + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiRealPwr == 0xffff) ? "No Data" : (msg.uiRealPwr == 0xfffe) ? "Out of range" : (msg.uiRealPwr == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ReactivePwr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiReactivePwr + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "VAR");
+            return (msg.uiReactivePwr == 0xffff) ? "No Data" : (msg.uiReactivePwr == 0xfffe) ? "Out of range" : (msg.uiReactivePwr == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HarmonicDist") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucHarmonicDist + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucHarmonicDist == 0xff) ? "No Data" : (msg.ucHarmonicDist == 0xfe) ? "Out of range" : (msg.ucHarmonicDist == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "CompLeg") {
+            return std::to_string(msg.ucCompLeg);
+        }
+        else return "no pgn";
+    }
+void InvAcSts3::Print() const {
+        std::cout << "PGN: InvAcSts3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "Waveform      : " << fnGetValue("Waveform") << " (" << fnGetRawValue("Waveform") << ")" << endl;
+        cout << "PhsSts      : " << fnGetValue("PhsSts") << " (" << fnGetRawValue("PhsSts") << ")" << endl;
+        cout << "RealPwr      : " << fnGetValue("RealPwr") << " (" << fnGetRawValue("RealPwr") << ")" << endl;
+        cout << "ReactivePwr      : " << fnGetValue("ReactivePwr") << " (" << fnGetRawValue("ReactivePwr") << ")" << endl;
+        cout << "HarmonicDist      : " << fnGetValue("HarmonicDist") << " (" << fnGetRawValue("HarmonicDist") << ")" << endl;
+        cout << "CompLeg      : " << fnGetValue("CompLeg") << " (" << fnGetRawValue("CompLeg") << ")" << endl;
+    }
+bool InvAcSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvAcSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "Waveform") {
+            return static_cast<uint32_t>(msg.teWaveform);
+        }
+        else if (mnem == "PhsSts") {
+            return static_cast<uint32_t>(msg.tePhsSts);
+        }
+        else if (mnem == "RealPwr") {
+            return static_cast<uint32_t>(msg.uiRealPwr);
+        }
+        else if (mnem == "ReactivePwr") {
+            return static_cast<uint32_t>(msg.uiReactivePwr);
+        }
+        else if (mnem == "HarmonicDist") {
+            return static_cast<uint32_t>(msg.ucHarmonicDist);
+        }
+        else if (mnem == "CompLeg") {
+            return static_cast<uint32_t>(msg.ucCompLeg);
+        }
+        return UINT32_MAX;
+    }
+void InvAcSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Waveform") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484338823, value);
+     if (enumValue != -1) msg.teWaveform = static_cast<decltype(msg.teWaveform)>(enumValue);
+     else msg.teWaveform = static_cast<decltype(msg.teWaveform)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PhsSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9421, value);
+     if (enumValue != -1) msg.tePhsSts = static_cast<decltype(msg.tePhsSts)>(enumValue);
+     else msg.tePhsSts = static_cast<decltype(msg.tePhsSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RealPwr") {
+     msg.uiRealPwr = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "ReactivePwr") {
+     msg.uiReactivePwr = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, -32000.0);
+        }
+        else if (mnem == "HarmonicDist") {
+     msg.ucHarmonicDist = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "CompLeg") {
+     msg.ucCompLeg = stringToInt(value, 0, 0, 0);
+        }
+    }
+void InvAcSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvAcSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvAcSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "Waveform") {
+            return 1.0 * (long double)(msg.teWaveform + 0.0);
+        }
+        else if (mnem == "PhsSts") {
+            return 1.0 * (long double)(msg.tePhsSts + 0.0);
+        }
+        else if (mnem == "RealPwr") {
+            return 1.0 * (long double)(msg.uiRealPwr + 0.0);
+        }
+        else if (mnem == "ReactivePwr") {
+            return 1.0 * (long double)(msg.uiReactivePwr + -32000.0);
+        }
+        else if (mnem == "HarmonicDist") {
+            return 0.5 * (long double)(msg.ucHarmonicDist + 0.0);
+        }
+        else if (mnem == "CompLeg") {
+            return 1.0 * (long double)(msg.ucCompLeg + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvAcSts2
+std::string InvAcSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "PkV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiPkV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiPkV == 0xffff) ? "No Data" : (msg.uiPkV == 0xfffe) ? "Out of range" : (msg.uiPkV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "PkI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiPkI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiPkI == 0xffff) ? "No Data" : (msg.uiPkI == 0xfffe) ? "Out of range" : (msg.uiPkI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "GndI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiGndI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiGndI == 0xffff) ? "No Data" : (msg.uiGndI == 0xfffe) ? "Out of range" : (msg.uiGndI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Cap") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucCap + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucCap == 0xff) ? "No Data" : (msg.ucCap == 0xfe) ? "Out of range" : (msg.ucCap == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void InvAcSts2::Print() const {
+        std::cout << "PGN: InvAcSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "PkV      : " << fnGetValue("PkV") << " (" << fnGetRawValue("PkV") << ")" << endl;
+        cout << "PkI      : " << fnGetValue("PkI") << " (" << fnGetRawValue("PkI") << ")" << endl;
+        cout << "GndI      : " << fnGetValue("GndI") << " (" << fnGetRawValue("GndI") << ")" << endl;
+        cout << "Cap      : " << fnGetValue("Cap") << " (" << fnGetRawValue("Cap") << ")" << endl;
+    }
+bool InvAcSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvAcSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "PkV") {
+            return static_cast<uint32_t>(msg.uiPkV);
+        }
+        else if (mnem == "PkI") {
+            return static_cast<uint32_t>(msg.uiPkI);
+        }
+        else if (mnem == "GndI") {
+            return static_cast<uint32_t>(msg.uiGndI);
+        }
+        else if (mnem == "Cap") {
+            return static_cast<uint32_t>(msg.ucCap);
+        }
+        return UINT32_MAX;
+    }
+void InvAcSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PkV") {
+     msg.uiPkV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "PkI") {
+     msg.uiPkI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "GndI") {
+     msg.uiGndI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Cap") {
+     msg.ucCap = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void InvAcSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvAcSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvAcSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "PkV") {
+            return 0.05000000074505806 * (long double)(msg.uiPkV + 0.0);
+        }
+        else if (mnem == "PkI") {
+            return 0.05000000074505806 * (long double)(msg.uiPkI + -32000.0);
+        }
+        else if (mnem == "GndI") {
+            return 0.05000000074505806 * (long double)(msg.uiGndI + -32000.0);
+        }
+        else if (mnem == "Cap") {
+            return 1.0 * (long double)(msg.ucCap + 0.0);
+        }
+        return 0.0;
+    }
+
+// InvAcSts1
+std::string InvAcSts1::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_2056474510.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2056474510.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InOut") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teInOut)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInOut);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teInOut));
+              }
+        }
+        else if (mnem == "RmsV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRmsV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiRmsV == 0xffff) ? "No Data" : (msg.uiRmsV == 0xfffe) ? "Out of range" : (msg.uiRmsV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "RmsI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRmsI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiRmsI == 0xffff) ? "No Data" : (msg.uiRmsI == 0xfffe) ? "Out of range" : (msg.uiRmsI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Freq") {
+            char buffer[50];
+            auto engval = 0.0078125 * (long double) (msg.uiFreq + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "Hz");
+            return (msg.uiFreq == 0xffff) ? "No Data" : (msg.uiFreq == 0xfffe) ? "Out of range" : (msg.uiFreq == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FltOpnGnd") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltOpnGnd)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltOpnGnd);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltOpnGnd));
+              }
+        }
+        else if (mnem == "FltOpnNeutral") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltOpnNeutral)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltOpnNeutral);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltOpnNeutral));
+              }
+        }
+        else if (mnem == "FltRevPolarity") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltRevPolarity)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltRevPolarity);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltRevPolarity));
+              }
+        }
+        else if (mnem == "FltGndFlt") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teFltGndFlt)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teFltGndFlt);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teFltGndFlt));
+              }
+        }
+        else return "no pgn";
+    }
+void InvAcSts1::Print() const {
+        std::cout << "PGN: InvAcSts1" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InOut      : " << fnGetValue("InOut") << " (" << fnGetRawValue("InOut") << ")" << endl;
+        cout << "RmsV      : " << fnGetValue("RmsV") << " (" << fnGetRawValue("RmsV") << ")" << endl;
+        cout << "RmsI      : " << fnGetValue("RmsI") << " (" << fnGetRawValue("RmsI") << ")" << endl;
+        cout << "Freq      : " << fnGetValue("Freq") << " (" << fnGetRawValue("Freq") << ")" << endl;
+        cout << "FltOpnGnd      : " << fnGetValue("FltOpnGnd") << " (" << fnGetRawValue("FltOpnGnd") << ")" << endl;
+        cout << "FltOpnNeutral      : " << fnGetValue("FltOpnNeutral") << " (" << fnGetRawValue("FltOpnNeutral") << ")" << endl;
+        cout << "FltRevPolarity      : " << fnGetValue("FltRevPolarity") << " (" << fnGetRawValue("FltRevPolarity") << ")" << endl;
+        cout << "FltGndFlt      : " << fnGetValue("FltGndFlt") << " (" << fnGetRawValue("FltGndFlt") << ")" << endl;
+    }
+bool InvAcSts1::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 InvAcSts1::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InOut") {
+            return static_cast<uint32_t>(msg.teInOut);
+        }
+        else if (mnem == "RmsV") {
+            return static_cast<uint32_t>(msg.uiRmsV);
+        }
+        else if (mnem == "RmsI") {
+            return static_cast<uint32_t>(msg.uiRmsI);
+        }
+        else if (mnem == "Freq") {
+            return static_cast<uint32_t>(msg.uiFreq);
+        }
+        else if (mnem == "FltOpnGnd") {
+            return static_cast<uint32_t>(msg.teFltOpnGnd);
+        }
+        else if (mnem == "FltOpnNeutral") {
+            return static_cast<uint32_t>(msg.teFltOpnNeutral);
+        }
+        else if (mnem == "FltRevPolarity") {
+            return static_cast<uint32_t>(msg.teFltRevPolarity);
+        }
+        else if (mnem == "FltGndFlt") {
+            return static_cast<uint32_t>(msg.teFltGndFlt);
+        }
+        return UINT32_MAX;
+    }
+void InvAcSts1::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2056474510, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InOut") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teInOut = static_cast<decltype(msg.teInOut)>(enumValue);
+     else msg.teInOut = static_cast<decltype(msg.teInOut)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RmsV") {
+     msg.uiRmsV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "RmsI") {
+     msg.uiRmsI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "Freq") {
+     msg.uiFreq = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.0078125, 0.0);
+        }
+        else if (mnem == "FltOpnGnd") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltOpnGnd = static_cast<decltype(msg.teFltOpnGnd)>(enumValue);
+     else msg.teFltOpnGnd = static_cast<decltype(msg.teFltOpnGnd)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltOpnNeutral") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltOpnNeutral = static_cast<decltype(msg.teFltOpnNeutral)>(enumValue);
+     else msg.teFltOpnNeutral = static_cast<decltype(msg.teFltOpnNeutral)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltRevPolarity") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltRevPolarity = static_cast<decltype(msg.teFltRevPolarity)>(enumValue);
+     else msg.teFltRevPolarity = static_cast<decltype(msg.teFltRevPolarity)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "FltGndFlt") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teFltGndFlt = static_cast<decltype(msg.teFltGndFlt)>(enumValue);
+     else msg.teFltGndFlt = static_cast<decltype(msg.teFltGndFlt)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void InvAcSts1::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string InvAcSts1::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double InvAcSts1::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InOut") {
+            return 1.0 * (long double)(msg.teInOut + 0.0);
+        }
+        else if (mnem == "RmsV") {
+            return 0.05000000074505806 * (long double)(msg.uiRmsV + 0.0);
+        }
+        else if (mnem == "RmsI") {
+            return 0.05000000074505806 * (long double)(msg.uiRmsI + -32000.0);
+        }
+        else if (mnem == "Freq") {
+            return 0.0078125 * (long double)(msg.uiFreq + 0.0);
+        }
+        else if (mnem == "FltOpnGnd") {
+            return 1.0 * (long double)(msg.teFltOpnGnd + 0.0);
+        }
+        else if (mnem == "FltOpnNeutral") {
+            return 1.0 * (long double)(msg.teFltOpnNeutral + 0.0);
+        }
+        else if (mnem == "FltRevPolarity") {
+            return 1.0 * (long double)(msg.teFltRevPolarity + 0.0);
+        }
+        else if (mnem == "FltGndFlt") {
+            return 1.0 * (long double)(msg.teFltGndFlt + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_inv_registrars[] = {
+{"InvTempSts2", [](void * rcv) { return std::make_unique<InvTempSts2>(rcv); }, []() { return std::make_unique<InvTempSts2>(); } },
+{"InvCfgCmd4", [](void * rcv) { return std::make_unique<InvCfgCmd4>(rcv); }, []() { return std::make_unique<InvCfgCmd4>(); } },
+{"InvCfgSts4", [](void * rcv) { return std::make_unique<InvCfgSts4>(rcv); }, []() { return std::make_unique<InvCfgSts4>(); } },
+{"InvTempSts", [](void * rcv) { return std::make_unique<InvTempSts>(rcv); }, []() { return std::make_unique<InvTempSts>(); } },
+{"InvCfgCmd3", [](void * rcv) { return std::make_unique<InvCfgCmd3>(rcv); }, []() { return std::make_unique<InvCfgCmd3>(); } },
+{"InvCfgSts3", [](void * rcv) { return std::make_unique<InvCfgSts3>(rcv); }, []() { return std::make_unique<InvCfgSts3>(); } },
+{"InvDcSts", [](void * rcv) { return std::make_unique<InvDcSts>(rcv); }, []() { return std::make_unique<InvDcSts>(); } },
+{"InvAcFltCfgCmd1", [](void * rcv) { return std::make_unique<InvAcFltCfgCmd1>(rcv); }, []() { return std::make_unique<InvAcFltCfgCmd1>(); } },
+{"InvAcFltCfgSts1", [](void * rcv) { return std::make_unique<InvAcFltCfgSts1>(rcv); }, []() { return std::make_unique<InvAcFltCfgSts1>(); } },
+{"InvAcSts4", [](void * rcv) { return std::make_unique<InvAcSts4>(rcv); }, []() { return std::make_unique<InvAcSts4>(); } },
+{"InvOpsSts", [](void * rcv) { return std::make_unique<InvOpsSts>(rcv); }, []() { return std::make_unique<InvOpsSts>(); } },
+{"InvHvDcBusSts", [](void * rcv) { return std::make_unique<InvHvDcBusSts>(rcv); }, []() { return std::make_unique<InvHvDcBusSts>(); } },
+{"InvApsSts", [](void * rcv) { return std::make_unique<InvApsSts>(rcv); }, []() { return std::make_unique<InvApsSts>(); } },
+{"InvStatsSts", [](void * rcv) { return std::make_unique<InvStatsSts>(rcv); }, []() { return std::make_unique<InvStatsSts>(); } },
+{"InvCfgCmd2", [](void * rcv) { return std::make_unique<InvCfgCmd2>(rcv); }, []() { return std::make_unique<InvCfgCmd2>(); } },
+{"InvCfgCmd1", [](void * rcv) { return std::make_unique<InvCfgCmd1>(rcv); }, []() { return std::make_unique<InvCfgCmd1>(); } },
+{"InvCfgSts2", [](void * rcv) { return std::make_unique<InvCfgSts2>(rcv); }, []() { return std::make_unique<InvCfgSts2>(); } },
+{"InvCfgSts1", [](void * rcv) { return std::make_unique<InvCfgSts1>(rcv); }, []() { return std::make_unique<InvCfgSts1>(); } },
+{"InvCmd", [](void * rcv) { return std::make_unique<InvCmd>(rcv); }, []() { return std::make_unique<InvCmd>(); } },
+{"InvSts", [](void * rcv) { return std::make_unique<InvSts>(rcv); }, []() { return std::make_unique<InvSts>(); } },
+{"InvAcSts3", [](void * rcv) { return std::make_unique<InvAcSts3>(rcv); }, []() { return std::make_unique<InvAcSts3>(); } },
+{"InvAcSts2", [](void * rcv) { return std::make_unique<InvAcSts2>(rcv); }, []() { return std::make_unique<InvAcSts2>(); } },
+{"InvAcSts1", [](void * rcv) { return std::make_unique<InvAcSts1>(rcv); }, []() { return std::make_unique<InvAcSts1>(); } },
+};
+static const PrinterRegistrar pgn_inv_printers[] = {
+{130507, -1, fnPrintMessage<InvTempSts2>},
+{130714, -1, fnPrintMessage<InvCfgCmd4>},
+{130715, -1, fnPrintMessage<InvCfgSts4>},
+{130749, -1, fnPrintMessage<InvTempSts>},
+{130765, -1, fnPrintMessage<InvCfgCmd3>},
+{130766, -1, fnPrintMessage<InvCfgSts3>},
+{130792, -1, fnPrintMessage<InvDcSts>},
+{130956, -1, fnPrintMessage<InvAcFltCfgCmd1>},
+{130958, -1, fnPrintMessage<InvAcFltCfgSts1>},
+{130959, -1, fnPrintMessage<InvAcSts4>},
+{131019, -1, fnPrintMessage<InvOpsSts>},
+{131020, -1, fnPrintMessage<InvHvDcBusSts>},
+{131021, -1, fnPrintMessage<InvApsSts>},
+{131022, -1, fnPrintMessage<InvStatsSts>},
+{131023, -1, fnPrintMessage<InvCfgCmd2>},
+{131024, -1, fnPrintMessage<InvCfgCmd1>},
+{131025, -1, fnPrintMessage<InvCfgSts2>},
+{131026, -1, fnPrintMessage<InvCfgSts1>},
+{131027, -1, fnPrintMessage<InvCmd>},
+{131028, -1, fnPrintMessage<InvSts>},
+{131029, -1, fnPrintMessage<InvAcSts3>},
+{131030, -1, fnPrintMessage<InvAcSts2>},
+{131031, -1, fnPrintMessage<InvAcSts1>},
+};
@@ -0,0 +1,1033 @@
+// Auto-generated by generate_print_functions.py: iso message classes
+#include "print_functions3.h"
+
+// IsoAck
+std::string IsoAck::fnGetValue(const std::string& mnem) const {
+        if (mnem == "CtrlByte") {
+            if (!ENUMLOOKUP_8991.fnContains(msg.teCtrlByte)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCtrlByte);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8991.fnText(msg.teCtrlByte));
+              }
+        }
+        else if (mnem == "GroupFunctionValue") {
+            if (!ENUMLOOKUP_8996.fnContains(msg.teGroupFunctionValue)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teGroupFunctionValue);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8996.fnText(msg.teGroupFunctionValue));
+              }
+        }
+        else if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoAck::Print() const {
+        std::cout << "PGN: IsoAck" << std::endl;
+        cout << "CtrlByte      : " << fnGetValue("CtrlByte") << " (" << fnGetRawValue("CtrlByte") << ")" << endl;
+        cout << "GroupFunctionValue      : " << fnGetValue("GroupFunctionValue") << " (" << fnGetRawValue("GroupFunctionValue") << ")" << endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoAck::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoAck::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "CtrlByte") {
+            return static_cast<uint32_t>(msg.teCtrlByte);
+        }
+        else if (mnem == "GroupFunctionValue") {
+            return static_cast<uint32_t>(msg.teGroupFunctionValue);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoAck::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "CtrlByte") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8991, value);
+     if (enumValue != -1) msg.teCtrlByte = static_cast<decltype(msg.teCtrlByte)>(enumValue);
+     else msg.teCtrlByte = static_cast<decltype(msg.teCtrlByte)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "GroupFunctionValue") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8996, value);
+     if (enumValue != -1) msg.teGroupFunctionValue = static_cast<decltype(msg.teGroupFunctionValue)>(enumValue);
+     else msg.teGroupFunctionValue = static_cast<decltype(msg.teGroupFunctionValue)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoAck::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoAck::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoAck::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "CtrlByte") {
+            return 1.0 * (long double)(msg.teCtrlByte + 0.0);
+        }
+        else if (mnem == "GroupFunctionValue") {
+            return 1.0 * (long double)(msg.teGroupFunctionValue + 0.0);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoReq
+std::string IsoReq::fnGetValue(const std::string& mnem) const {
+        if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoReq::Print() const {
+        std::cout << "PGN: IsoReq" << std::endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoReq::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoReq::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoReq::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoReq::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoReq::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoReq::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoTpXfer
+std::string IsoTpXfer::fnGetValue(const std::string& mnem) const {
+        if (mnem == "SeqNumMultiPacketFrame") {
+            return (msg.ucSeqNumMultiPacketFrame == 0xff) ? "No Data" : (msg.ucSeqNumMultiPacketFrame == 0xfe) ? "Out of range" : (msg.ucSeqNumMultiPacketFrame == 0xfd) ? "Reserved" : std::to_string(msg.ucSeqNumMultiPacketFrame);
+        }
+        else if (mnem == "MultiPacketPacketizedData") {
+            return reinterpret_cast< char const* >(msg.aucMultiPacketPacketizedData);
+        }
+        else return "no pgn";
+    }
+void IsoTpXfer::Print() const {
+        std::cout << "PGN: IsoTpXfer" << std::endl;
+        cout << "SeqNumMultiPacketFrame      : " << fnGetValue("SeqNumMultiPacketFrame") << " (" << fnGetRawValue("SeqNumMultiPacketFrame") << ")" << endl;
+        cout << "MultiPacketPacketizedData      : " << fnGetValue("MultiPacketPacketizedData") << " (" << fnGetRawValue("MultiPacketPacketizedData") << ")" << endl;
+    }
+bool IsoTpXfer::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoTpXfer::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "SeqNumMultiPacketFrame") {
+            return static_cast<uint32_t>(msg.ucSeqNumMultiPacketFrame);
+        }
+        else if (mnem == "MultiPacketPacketizedData") {
+            return UINT32_MAX;
+        }
+        return UINT32_MAX;
+    }
+void IsoTpXfer::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "SeqNumMultiPacketFrame") {
+     msg.ucSeqNumMultiPacketFrame = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "MultiPacketPacketizedData") {
+        }
+    }
+void IsoTpXfer::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoTpXfer::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoTpXfer::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "SeqNumMultiPacketFrame") {
+            return 1.0 * (long double)(msg.ucSeqNumMultiPacketFrame + 0.0);
+        }
+        else if (mnem == "MultiPacketPacketizedData") {
+            return 0.0;
+        }
+        return 0.0;
+    }
+
+// IsoTpConnManRts
+std::string IsoTpConnManRts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "RtsGroupFunctionCode") {
+            return (msg.ucRtsGroupFunctionCode == 0xff) ? "No Data" : (msg.ucRtsGroupFunctionCode == 0xfe) ? "Out of range" : (msg.ucRtsGroupFunctionCode == 0xfd) ? "Reserved" : std::to_string(msg.ucRtsGroupFunctionCode);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return (msg.uiTotalMsgSz == 0xffff) ? "No Data" : (msg.uiTotalMsgSz == 0xfffe) ? "Out of range" : (msg.uiTotalMsgSz == 0xfffd) ? "Reserved" : std::to_string(msg.uiTotalMsgSz);
+        }
+        else if (mnem == "TotalNumFramesXmit") {
+            return (msg.ucTotalNumFramesXmit == 0xff) ? "No Data" : (msg.ucTotalNumFramesXmit == 0xfe) ? "Out of range" : (msg.ucTotalNumFramesXmit == 0xfd) ? "Reserved" : std::to_string(msg.ucTotalNumFramesXmit);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoTpConnManRts::Print() const {
+        std::cout << "PGN: IsoTpConnManRts" << std::endl;
+        cout << "RtsGroupFunctionCode      : " << fnGetValue("RtsGroupFunctionCode") << " (" << fnGetRawValue("RtsGroupFunctionCode") << ")" << endl;
+        cout << "TotalMsgSz      : " << fnGetValue("TotalMsgSz") << " (" << fnGetRawValue("TotalMsgSz") << ")" << endl;
+        cout << "TotalNumFramesXmit      : " << fnGetValue("TotalNumFramesXmit") << " (" << fnGetRawValue("TotalNumFramesXmit") << ")" << endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoTpConnManRts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoTpConnManRts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "RtsGroupFunctionCode") {
+            return static_cast<uint32_t>(msg.ucRtsGroupFunctionCode);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return static_cast<uint32_t>(msg.uiTotalMsgSz);
+        }
+        else if (mnem == "TotalNumFramesXmit") {
+            return static_cast<uint32_t>(msg.ucTotalNumFramesXmit);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoTpConnManRts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "RtsGroupFunctionCode") {
+     msg.ucRtsGroupFunctionCode = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TotalMsgSz") {
+     msg.uiTotalMsgSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "TotalNumFramesXmit") {
+     msg.ucTotalNumFramesXmit = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoTpConnManRts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoTpConnManRts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoTpConnManRts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "RtsGroupFunctionCode") {
+            return 1.0 * (long double)(msg.ucRtsGroupFunctionCode + 0.0);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return 1.0 * (long double)(msg.uiTotalMsgSz + 0.0);
+        }
+        else if (mnem == "TotalNumFramesXmit") {
+            return 1.0 * (long double)(msg.ucTotalNumFramesXmit + 0.0);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoTpConnManCts
+std::string IsoTpConnManCts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "CtsGroupFunctionCode") {
+            return (msg.ucCtsGroupFunctionCode == 0xff) ? "No Data" : (msg.ucCtsGroupFunctionCode == 0xfe) ? "Out of range" : (msg.ucCtsGroupFunctionCode == 0xfd) ? "Reserved" : std::to_string(msg.ucCtsGroupFunctionCode);
+        }
+        else if (mnem == "NumFramesThatCanBeSent") {
+            return (msg.ucNumFramesThatCanBeSent == 0xff) ? "No Data" : (msg.ucNumFramesThatCanBeSent == 0xfe) ? "Out of range" : (msg.ucNumFramesThatCanBeSent == 0xfd) ? "Reserved" : std::to_string(msg.ucNumFramesThatCanBeSent);
+        }
+        else if (mnem == "NumNextFrameToBeSent") {
+            return (msg.ucNumNextFrameToBeSent == 0xff) ? "No Data" : (msg.ucNumNextFrameToBeSent == 0xfe) ? "Out of range" : (msg.ucNumNextFrameToBeSent == 0xfd) ? "Reserved" : std::to_string(msg.ucNumNextFrameToBeSent);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoTpConnManCts::Print() const {
+        std::cout << "PGN: IsoTpConnManCts" << std::endl;
+        cout << "CtsGroupFunctionCode      : " << fnGetValue("CtsGroupFunctionCode") << " (" << fnGetRawValue("CtsGroupFunctionCode") << ")" << endl;
+        cout << "NumFramesThatCanBeSent      : " << fnGetValue("NumFramesThatCanBeSent") << " (" << fnGetRawValue("NumFramesThatCanBeSent") << ")" << endl;
+        cout << "NumNextFrameToBeSent      : " << fnGetValue("NumNextFrameToBeSent") << " (" << fnGetRawValue("NumNextFrameToBeSent") << ")" << endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoTpConnManCts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoTpConnManCts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "CtsGroupFunctionCode") {
+            return static_cast<uint32_t>(msg.ucCtsGroupFunctionCode);
+        }
+        else if (mnem == "NumFramesThatCanBeSent") {
+            return static_cast<uint32_t>(msg.ucNumFramesThatCanBeSent);
+        }
+        else if (mnem == "NumNextFrameToBeSent") {
+            return static_cast<uint32_t>(msg.ucNumNextFrameToBeSent);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoTpConnManCts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "CtsGroupFunctionCode") {
+     msg.ucCtsGroupFunctionCode = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "NumFramesThatCanBeSent") {
+     msg.ucNumFramesThatCanBeSent = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "NumNextFrameToBeSent") {
+     msg.ucNumNextFrameToBeSent = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoTpConnManCts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoTpConnManCts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoTpConnManCts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "CtsGroupFunctionCode") {
+            return 1.0 * (long double)(msg.ucCtsGroupFunctionCode + 0.0);
+        }
+        else if (mnem == "NumFramesThatCanBeSent") {
+            return 1.0 * (long double)(msg.ucNumFramesThatCanBeSent + 0.0);
+        }
+        else if (mnem == "NumNextFrameToBeSent") {
+            return 1.0 * (long double)(msg.ucNumNextFrameToBeSent + 0.0);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoTpConnManEom
+std::string IsoTpConnManEom::fnGetValue(const std::string& mnem) const {
+        if (mnem == "EomGroupFunctionCode") {
+            return (msg.ucEomGroupFunctionCode == 0xff) ? "No Data" : (msg.ucEomGroupFunctionCode == 0xfe) ? "Out of range" : (msg.ucEomGroupFunctionCode == 0xfd) ? "Reserved" : std::to_string(msg.ucEomGroupFunctionCode);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return (msg.uiTotalMsgSz == 0xffff) ? "No Data" : (msg.uiTotalMsgSz == 0xfffe) ? "Out of range" : (msg.uiTotalMsgSz == 0xfffd) ? "Reserved" : std::to_string(msg.uiTotalMsgSz);
+        }
+        else if (mnem == "TotalNumFramesRxed") {
+            return (msg.ucTotalNumFramesRxed == 0xff) ? "No Data" : (msg.ucTotalNumFramesRxed == 0xfe) ? "Out of range" : (msg.ucTotalNumFramesRxed == 0xfd) ? "Reserved" : std::to_string(msg.ucTotalNumFramesRxed);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoTpConnManEom::Print() const {
+        std::cout << "PGN: IsoTpConnManEom" << std::endl;
+        cout << "EomGroupFunctionCode      : " << fnGetValue("EomGroupFunctionCode") << " (" << fnGetRawValue("EomGroupFunctionCode") << ")" << endl;
+        cout << "TotalMsgSz      : " << fnGetValue("TotalMsgSz") << " (" << fnGetRawValue("TotalMsgSz") << ")" << endl;
+        cout << "TotalNumFramesRxed      : " << fnGetValue("TotalNumFramesRxed") << " (" << fnGetRawValue("TotalNumFramesRxed") << ")" << endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoTpConnManEom::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoTpConnManEom::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "EomGroupFunctionCode") {
+            return static_cast<uint32_t>(msg.ucEomGroupFunctionCode);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return static_cast<uint32_t>(msg.uiTotalMsgSz);
+        }
+        else if (mnem == "TotalNumFramesRxed") {
+            return static_cast<uint32_t>(msg.ucTotalNumFramesRxed);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoTpConnManEom::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "EomGroupFunctionCode") {
+     msg.ucEomGroupFunctionCode = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TotalMsgSz") {
+     msg.uiTotalMsgSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "TotalNumFramesRxed") {
+     msg.ucTotalNumFramesRxed = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoTpConnManEom::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoTpConnManEom::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoTpConnManEom::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "EomGroupFunctionCode") {
+            return 1.0 * (long double)(msg.ucEomGroupFunctionCode + 0.0);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return 1.0 * (long double)(msg.uiTotalMsgSz + 0.0);
+        }
+        else if (mnem == "TotalNumFramesRxed") {
+            return 1.0 * (long double)(msg.ucTotalNumFramesRxed + 0.0);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoTpConnManBam
+std::string IsoTpConnManBam::fnGetValue(const std::string& mnem) const {
+        if (mnem == "BamGroupFunctionCode") {
+            return (msg.ucBamGroupFunctionCode == 0xff) ? "No Data" : (msg.ucBamGroupFunctionCode == 0xfe) ? "Out of range" : (msg.ucBamGroupFunctionCode == 0xfd) ? "Reserved" : std::to_string(msg.ucBamGroupFunctionCode);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return (msg.uiTotalMsgSz == 0xffff) ? "No Data" : (msg.uiTotalMsgSz == 0xfffe) ? "Out of range" : (msg.uiTotalMsgSz == 0xfffd) ? "Reserved" : std::to_string(msg.uiTotalMsgSz);
+        }
+        else if (mnem == "TotalNumFramesToBeSent") {
+            return (msg.ucTotalNumFramesToBeSent == 0xff) ? "No Data" : (msg.ucTotalNumFramesToBeSent == 0xfe) ? "Out of range" : (msg.ucTotalNumFramesToBeSent == 0xfd) ? "Reserved" : std::to_string(msg.ucTotalNumFramesToBeSent);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoTpConnManBam::Print() const {
+        std::cout << "PGN: IsoTpConnManBam" << std::endl;
+        cout << "BamGroupFunctionCode      : " << fnGetValue("BamGroupFunctionCode") << " (" << fnGetRawValue("BamGroupFunctionCode") << ")" << endl;
+        cout << "TotalMsgSz      : " << fnGetValue("TotalMsgSz") << " (" << fnGetRawValue("TotalMsgSz") << ")" << endl;
+        cout << "TotalNumFramesToBeSent      : " << fnGetValue("TotalNumFramesToBeSent") << " (" << fnGetRawValue("TotalNumFramesToBeSent") << ")" << endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoTpConnManBam::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoTpConnManBam::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "BamGroupFunctionCode") {
+            return static_cast<uint32_t>(msg.ucBamGroupFunctionCode);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return static_cast<uint32_t>(msg.uiTotalMsgSz);
+        }
+        else if (mnem == "TotalNumFramesToBeSent") {
+            return static_cast<uint32_t>(msg.ucTotalNumFramesToBeSent);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoTpConnManBam::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "BamGroupFunctionCode") {
+     msg.ucBamGroupFunctionCode = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "TotalMsgSz") {
+     msg.uiTotalMsgSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+        else if (mnem == "TotalNumFramesToBeSent") {
+     msg.ucTotalNumFramesToBeSent = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoTpConnManBam::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoTpConnManBam::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoTpConnManBam::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "BamGroupFunctionCode") {
+            return 1.0 * (long double)(msg.ucBamGroupFunctionCode + 0.0);
+        }
+        else if (mnem == "TotalMsgSz") {
+            return 1.0 * (long double)(msg.uiTotalMsgSz + 0.0);
+        }
+        else if (mnem == "TotalNumFramesToBeSent") {
+            return 1.0 * (long double)(msg.ucTotalNumFramesToBeSent + 0.0);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoTpConnManAbort
+std::string IsoTpConnManAbort::fnGetValue(const std::string& mnem) const {
+        if (mnem == "AbortGroupFunctionCode") {
+            return (msg.ucAbortGroupFunctionCode == 0xff) ? "No Data" : (msg.ucAbortGroupFunctionCode == 0xfe) ? "Out of range" : (msg.ucAbortGroupFunctionCode == 0xfd) ? "Reserved" : std::to_string(msg.ucAbortGroupFunctionCode);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return std::to_string(msg.ulParmGrpNum);
+        }
+        else return "no pgn";
+    }
+void IsoTpConnManAbort::Print() const {
+        std::cout << "PGN: IsoTpConnManAbort" << std::endl;
+        cout << "AbortGroupFunctionCode      : " << fnGetValue("AbortGroupFunctionCode") << " (" << fnGetRawValue("AbortGroupFunctionCode") << ")" << endl;
+        cout << "ParmGrpNum      : " << fnGetValue("ParmGrpNum") << " (" << fnGetRawValue("ParmGrpNum") << ")" << endl;
+    }
+bool IsoTpConnManAbort::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoTpConnManAbort::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "AbortGroupFunctionCode") {
+            return static_cast<uint32_t>(msg.ucAbortGroupFunctionCode);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return static_cast<uint32_t>(msg.ulParmGrpNum);
+        }
+        return UINT32_MAX;
+    }
+void IsoTpConnManAbort::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "AbortGroupFunctionCode") {
+     msg.ucAbortGroupFunctionCode = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "ParmGrpNum") {
+     msg.ulParmGrpNum = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoTpConnManAbort::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoTpConnManAbort::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoTpConnManAbort::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "AbortGroupFunctionCode") {
+            return 1.0 * (long double)(msg.ucAbortGroupFunctionCode + 0.0);
+        }
+        else if (mnem == "ParmGrpNum") {
+            return 1.0 * (long double)(msg.ulParmGrpNum + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoAddrClaim
+std::string IsoAddrClaim::fnGetValue(const std::string& mnem) const {
+        if (mnem == "UniqueNumber") {
+            return std::to_string(msg.ulUniqueNumber);
+        }
+        else if (mnem == "ManufacturerCode") {
+            return std::to_string(msg.uiManufacturerCode);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+            return std::to_string(msg.ucDeviceInstanceLower);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+            return std::to_string(msg.ucDeviceInstanceUpper);
+        }
+        else if (mnem == "DeviceFunction") {
+            if (!ENUMLOOKUP_9001.fnContains(msg.teDeviceFunction)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDeviceFunction);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9001.fnText(msg.teDeviceFunction));
+              }
+        }
+        else if (mnem == "RsvBit") {
+            return std::to_string(msg.ucRsvBit);
+        }
+        else if (mnem == "DeviceClass") {
+            if (!ENUMLOOKUP_9002.fnContains(msg.teDeviceClass)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDeviceClass);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9002.fnText(msg.teDeviceClass));
+              }
+        }
+        else if (mnem == "SystemInstance") {
+            return std::to_string(msg.ucSystemInstance);
+        }
+        else if (mnem == "IndustryGroup") {
+            if (!ENUMLOOKUP_8989.fnContains(msg.teIndustryGroup)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teIndustryGroup);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8989.fnText(msg.teIndustryGroup));
+              }
+        }
+        else if (mnem == "SelfCfgAddr") {
+            return std::to_string(msg.ucSelfCfgAddr);
+        }
+        else return "no pgn";
+    }
+void IsoAddrClaim::Print() const {
+        std::cout << "PGN: IsoAddrClaim" << std::endl;
+        cout << "UniqueNumber      : " << fnGetValue("UniqueNumber") << " (" << fnGetRawValue("UniqueNumber") << ")" << endl;
+        cout << "ManufacturerCode      : " << fnGetValue("ManufacturerCode") << " (" << fnGetRawValue("ManufacturerCode") << ")" << endl;
+        cout << "DeviceInstanceLower      : " << fnGetValue("DeviceInstanceLower") << " (" << fnGetRawValue("DeviceInstanceLower") << ")" << endl;
+        cout << "DeviceInstanceUpper      : " << fnGetValue("DeviceInstanceUpper") << " (" << fnGetRawValue("DeviceInstanceUpper") << ")" << endl;
+        cout << "DeviceFunction      : " << fnGetValue("DeviceFunction") << " (" << fnGetRawValue("DeviceFunction") << ")" << endl;
+        cout << "RsvBit      : " << fnGetValue("RsvBit") << " (" << fnGetRawValue("RsvBit") << ")" << endl;
+        cout << "DeviceClass      : " << fnGetValue("DeviceClass") << " (" << fnGetRawValue("DeviceClass") << ")" << endl;
+        cout << "SystemInstance      : " << fnGetValue("SystemInstance") << " (" << fnGetRawValue("SystemInstance") << ")" << endl;
+        cout << "IndustryGroup      : " << fnGetValue("IndustryGroup") << " (" << fnGetRawValue("IndustryGroup") << ")" << endl;
+        cout << "SelfCfgAddr      : " << fnGetValue("SelfCfgAddr") << " (" << fnGetRawValue("SelfCfgAddr") << ")" << endl;
+    }
+bool IsoAddrClaim::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoAddrClaim::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "UniqueNumber") {
+            return static_cast<uint32_t>(msg.ulUniqueNumber);
+        }
+        else if (mnem == "ManufacturerCode") {
+            return static_cast<uint32_t>(msg.uiManufacturerCode);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+            return static_cast<uint32_t>(msg.ucDeviceInstanceLower);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+            return static_cast<uint32_t>(msg.ucDeviceInstanceUpper);
+        }
+        else if (mnem == "DeviceFunction") {
+            return static_cast<uint32_t>(msg.teDeviceFunction);
+        }
+        else if (mnem == "RsvBit") {
+            return static_cast<uint32_t>(msg.ucRsvBit);
+        }
+        else if (mnem == "DeviceClass") {
+            return static_cast<uint32_t>(msg.teDeviceClass);
+        }
+        else if (mnem == "SystemInstance") {
+            return static_cast<uint32_t>(msg.ucSystemInstance);
+        }
+        else if (mnem == "IndustryGroup") {
+            return static_cast<uint32_t>(msg.teIndustryGroup);
+        }
+        else if (mnem == "SelfCfgAddr") {
+            return static_cast<uint32_t>(msg.ucSelfCfgAddr);
+        }
+        return UINT32_MAX;
+    }
+void IsoAddrClaim::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "UniqueNumber") {
+     msg.ulUniqueNumber = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ManufacturerCode") {
+     msg.uiManufacturerCode = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+     msg.ucDeviceInstanceLower = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+     msg.ucDeviceInstanceUpper = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceFunction") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9001, value);
+     if (enumValue != -1) msg.teDeviceFunction = static_cast<decltype(msg.teDeviceFunction)>(enumValue);
+     else msg.teDeviceFunction = static_cast<decltype(msg.teDeviceFunction)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RsvBit") {
+     msg.ucRsvBit = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceClass") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9002, value);
+     if (enumValue != -1) msg.teDeviceClass = static_cast<decltype(msg.teDeviceClass)>(enumValue);
+     else msg.teDeviceClass = static_cast<decltype(msg.teDeviceClass)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SystemInstance") {
+     msg.ucSystemInstance = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "IndustryGroup") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8989, value);
+     if (enumValue != -1) msg.teIndustryGroup = static_cast<decltype(msg.teIndustryGroup)>(enumValue);
+     else msg.teIndustryGroup = static_cast<decltype(msg.teIndustryGroup)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SelfCfgAddr") {
+     msg.ucSelfCfgAddr = stringToInt(value, 0, 0, 0);
+        }
+    }
+void IsoAddrClaim::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoAddrClaim::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoAddrClaim::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "UniqueNumber") {
+            return 1.0 * (long double)(msg.ulUniqueNumber + 0.0);
+        }
+        else if (mnem == "ManufacturerCode") {
+            return 1.0 * (long double)(msg.uiManufacturerCode + 0.0);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+            return 1.0 * (long double)(msg.ucDeviceInstanceLower + 0.0);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+            return 1.0 * (long double)(msg.ucDeviceInstanceUpper + 0.0);
+        }
+        else if (mnem == "DeviceFunction") {
+            return 1.0 * (long double)(msg.teDeviceFunction + 0.0);
+        }
+        else if (mnem == "RsvBit") {
+            return 1.0 * (long double)(msg.ucRsvBit + 0.0);
+        }
+        else if (mnem == "DeviceClass") {
+            return 1.0 * (long double)(msg.teDeviceClass + 0.0);
+        }
+        else if (mnem == "SystemInstance") {
+            return 1.0 * (long double)(msg.ucSystemInstance + 0.0);
+        }
+        else if (mnem == "IndustryGroup") {
+            return 1.0 * (long double)(msg.teIndustryGroup + 0.0);
+        }
+        else if (mnem == "SelfCfgAddr") {
+            return 1.0 * (long double)(msg.ucSelfCfgAddr + 0.0);
+        }
+        return 0.0;
+    }
+
+// IsoCmdAddr
+std::string IsoCmdAddr::fnGetValue(const std::string& mnem) const {
+        if (mnem == "UniqueNumber") {
+            return std::to_string(msg.ulUniqueNumber);
+        }
+        else if (mnem == "ManufacturerCode") {
+            return std::to_string(msg.uiManufacturerCode);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+            return std::to_string(msg.ucDeviceInstanceLower);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+            return std::to_string(msg.ucDeviceInstanceUpper);
+        }
+        else if (mnem == "DeviceFunction") {
+            if (!ENUMLOOKUP_9001.fnContains(msg.teDeviceFunction)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDeviceFunction);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9001.fnText(msg.teDeviceFunction));
+              }
+        }
+        else if (mnem == "RsvBit") {
+            return std::to_string(msg.ucRsvBit);
+        }
+        else if (mnem == "DeviceClass") {
+            if (!ENUMLOOKUP_9002.fnContains(msg.teDeviceClass)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDeviceClass);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9002.fnText(msg.teDeviceClass));
+              }
+        }
+        else if (mnem == "SystemInstance") {
+            return std::to_string(msg.ucSystemInstance);
+        }
+        else if (mnem == "IndustryGroup") {
+            if (!ENUMLOOKUP_8989.fnContains(msg.teIndustryGroup)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teIndustryGroup);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8989.fnText(msg.teIndustryGroup));
+              }
+        }
+        else if (mnem == "SelfCfgAddr") {
+            return std::to_string(msg.ucSelfCfgAddr);
+        }
+        else if (mnem == "PrefSrcAddr") {
+            if (!ENUMLOOKUP_8982.fnContains(msg.tePrefSrcAddr)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePrefSrcAddr);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_8982.fnText(msg.tePrefSrcAddr));
+              }
+        }
+        else return "no pgn";
+    }
+void IsoCmdAddr::Print() const {
+        std::cout << "PGN: IsoCmdAddr" << std::endl;
+        cout << "UniqueNumber      : " << fnGetValue("UniqueNumber") << " (" << fnGetRawValue("UniqueNumber") << ")" << endl;
+        cout << "ManufacturerCode      : " << fnGetValue("ManufacturerCode") << " (" << fnGetRawValue("ManufacturerCode") << ")" << endl;
+        cout << "DeviceInstanceLower      : " << fnGetValue("DeviceInstanceLower") << " (" << fnGetRawValue("DeviceInstanceLower") << ")" << endl;
+        cout << "DeviceInstanceUpper      : " << fnGetValue("DeviceInstanceUpper") << " (" << fnGetRawValue("DeviceInstanceUpper") << ")" << endl;
+        cout << "DeviceFunction      : " << fnGetValue("DeviceFunction") << " (" << fnGetRawValue("DeviceFunction") << ")" << endl;
+        cout << "RsvBit      : " << fnGetValue("RsvBit") << " (" << fnGetRawValue("RsvBit") << ")" << endl;
+        cout << "DeviceClass      : " << fnGetValue("DeviceClass") << " (" << fnGetRawValue("DeviceClass") << ")" << endl;
+        cout << "SystemInstance      : " << fnGetValue("SystemInstance") << " (" << fnGetRawValue("SystemInstance") << ")" << endl;
+        cout << "IndustryGroup      : " << fnGetValue("IndustryGroup") << " (" << fnGetRawValue("IndustryGroup") << ")" << endl;
+        cout << "SelfCfgAddr      : " << fnGetValue("SelfCfgAddr") << " (" << fnGetRawValue("SelfCfgAddr") << ")" << endl;
+        cout << "PrefSrcAddr      : " << fnGetValue("PrefSrcAddr") << " (" << fnGetRawValue("PrefSrcAddr") << ")" << endl;
+    }
+bool IsoCmdAddr::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 IsoCmdAddr::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "UniqueNumber") {
+            return static_cast<uint32_t>(msg.ulUniqueNumber);
+        }
+        else if (mnem == "ManufacturerCode") {
+            return static_cast<uint32_t>(msg.uiManufacturerCode);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+            return static_cast<uint32_t>(msg.ucDeviceInstanceLower);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+            return static_cast<uint32_t>(msg.ucDeviceInstanceUpper);
+        }
+        else if (mnem == "DeviceFunction") {
+            return static_cast<uint32_t>(msg.teDeviceFunction);
+        }
+        else if (mnem == "RsvBit") {
+            return static_cast<uint32_t>(msg.ucRsvBit);
+        }
+        else if (mnem == "DeviceClass") {
+            return static_cast<uint32_t>(msg.teDeviceClass);
+        }
+        else if (mnem == "SystemInstance") {
+            return static_cast<uint32_t>(msg.ucSystemInstance);
+        }
+        else if (mnem == "IndustryGroup") {
+            return static_cast<uint32_t>(msg.teIndustryGroup);
+        }
+        else if (mnem == "SelfCfgAddr") {
+            return static_cast<uint32_t>(msg.ucSelfCfgAddr);
+        }
+        else if (mnem == "PrefSrcAddr") {
+            return static_cast<uint32_t>(msg.tePrefSrcAddr);
+        }
+        return UINT32_MAX;
+    }
+void IsoCmdAddr::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "UniqueNumber") {
+     msg.ulUniqueNumber = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ManufacturerCode") {
+     msg.uiManufacturerCode = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+     msg.ucDeviceInstanceLower = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+     msg.ucDeviceInstanceUpper = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceFunction") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9001, value);
+     if (enumValue != -1) msg.teDeviceFunction = static_cast<decltype(msg.teDeviceFunction)>(enumValue);
+     else msg.teDeviceFunction = static_cast<decltype(msg.teDeviceFunction)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "RsvBit") {
+     msg.ucRsvBit = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DeviceClass") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9002, value);
+     if (enumValue != -1) msg.teDeviceClass = static_cast<decltype(msg.teDeviceClass)>(enumValue);
+     else msg.teDeviceClass = static_cast<decltype(msg.teDeviceClass)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SystemInstance") {
+     msg.ucSystemInstance = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "IndustryGroup") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8989, value);
+     if (enumValue != -1) msg.teIndustryGroup = static_cast<decltype(msg.teIndustryGroup)>(enumValue);
+     else msg.teIndustryGroup = static_cast<decltype(msg.teIndustryGroup)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SelfCfgAddr") {
+     msg.ucSelfCfgAddr = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "PrefSrcAddr") {
+     int enumValue = findEnumValue(ENUMLOOKUP_8982, value);
+     if (enumValue != -1) msg.tePrefSrcAddr = static_cast<decltype(msg.tePrefSrcAddr)>(enumValue);
+     else msg.tePrefSrcAddr = static_cast<decltype(msg.tePrefSrcAddr)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void IsoCmdAddr::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string IsoCmdAddr::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double IsoCmdAddr::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "UniqueNumber") {
+            return 1.0 * (long double)(msg.ulUniqueNumber + 0.0);
+        }
+        else if (mnem == "ManufacturerCode") {
+            return 1.0 * (long double)(msg.uiManufacturerCode + 0.0);
+        }
+        else if (mnem == "DeviceInstanceLower") {
+            return 1.0 * (long double)(msg.ucDeviceInstanceLower + 0.0);
+        }
+        else if (mnem == "DeviceInstanceUpper") {
+            return 1.0 * (long double)(msg.ucDeviceInstanceUpper + 0.0);
+        }
+        else if (mnem == "DeviceFunction") {
+            return 1.0 * (long double)(msg.teDeviceFunction + 0.0);
+        }
+        else if (mnem == "RsvBit") {
+            return 1.0 * (long double)(msg.ucRsvBit + 0.0);
+        }
+        else if (mnem == "DeviceClass") {
+            return 1.0 * (long double)(msg.teDeviceClass + 0.0);
+        }
+        else if (mnem == "SystemInstance") {
+            return 1.0 * (long double)(msg.ucSystemInstance + 0.0);
+        }
+        else if (mnem == "IndustryGroup") {
+            return 1.0 * (long double)(msg.teIndustryGroup + 0.0);
+        }
+        else if (mnem == "SelfCfgAddr") {
+            return 1.0 * (long double)(msg.ucSelfCfgAddr + 0.0);
+        }
+        else if (mnem == "PrefSrcAddr") {
+            return 1.0 * (long double)(msg.tePrefSrcAddr + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_iso_registrars[] = {
+{"IsoAck", [](void * rcv) { return std::make_unique<IsoAck>(rcv); }, []() { return std::make_unique<IsoAck>(); } },
+{"IsoReq", [](void * rcv) { return std::make_unique<IsoReq>(rcv); }, []() { return std::make_unique<IsoReq>(); } },
+{"IsoTpXfer", [](void * rcv) { return std::make_unique<IsoTpXfer>(rcv); }, []() { return std::make_unique<IsoTpXfer>(); } },
+{"IsoTpConnManRts", [](void * rcv) { return std::make_unique<IsoTpConnManRts>(rcv); }, []() { return std::make_unique<IsoTpConnManRts>(); } },
+{"IsoTpConnManCts", [](void * rcv) { return std::make_unique<IsoTpConnManCts>(rcv); }, []() { return std::make_unique<IsoTpConnManCts>(); } },
+{"IsoTpConnManEom", [](void * rcv) { return std::make_unique<IsoTpConnManEom>(rcv); }, []() { return std::make_unique<IsoTpConnManEom>(); } },
+{"IsoTpConnManBam", [](void * rcv) { return std::make_unique<IsoTpConnManBam>(rcv); }, []() { return std::make_unique<IsoTpConnManBam>(); } },
+{"IsoTpConnManAbort", [](void * rcv) { return std::make_unique<IsoTpConnManAbort>(rcv); }, []() { return std::make_unique<IsoTpConnManAbort>(); } },
+{"IsoAddrClaim", [](void * rcv) { return std::make_unique<IsoAddrClaim>(rcv); }, []() { return std::make_unique<IsoAddrClaim>(); } },
+{"IsoCmdAddr", [](void * rcv) { return std::make_unique<IsoCmdAddr>(rcv); }, []() { return std::make_unique<IsoCmdAddr>(); } },
+};
+static const PrinterRegistrar pgn_iso_printers[] = {
+{59392, -1, fnPrintMessage<IsoAck>},
+{59904, -1, fnPrintMessage<IsoReq>},
+{60160, -1, fnPrintMessage<IsoTpXfer>},
+{60416, 16, fnPrintMessage<IsoTpConnManRts>},
+{60416, 17, fnPrintMessage<IsoTpConnManCts>},
+{60416, 19, fnPrintMessage<IsoTpConnManEom>},
+{60416, 32, fnPrintMessage<IsoTpConnManBam>},
+{60416, 255, fnPrintMessage<IsoTpConnManAbort>},
+{60928, -1, fnPrintMessage<IsoAddrClaim>},
+{65240, -1, fnPrintMessage<IsoCmdAddr>},
+};
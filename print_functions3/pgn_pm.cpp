@@ -0,0 +1,4410 @@
+// Auto-generated by generate_print_functions.py: pm message classes
+#include "print_functions3.h"
+
+// PmParamDevMdCfg
+std::string PmParamDevMdCfg::fnGetValue(const std::string& mnem) const {
+        if (mnem == "DesiredMode") {
+            if (!ENUMLOOKUP_N725723354.fnContains(msg.teDesiredMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDesiredMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N725723354.fnText(msg.teDesiredMode));
+              }
+        }
+        else return "no pgn";
+    }
+void PmParamDevMdCfg::Print() const {
+        std::cout << "PGN: PmParamDevMdCfg" << std::endl;
+        cout << "DesiredMode      : " << fnGetValue("DesiredMode") << " (" << fnGetRawValue("DesiredMode") << ")" << endl;
+    }
+bool PmParamDevMdCfg::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmParamDevMdCfg::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "DesiredMode") {
+            return static_cast<uint32_t>(msg.teDesiredMode);
+        }
+        return UINT32_MAX;
+    }
+void PmParamDevMdCfg::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "DesiredMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N725723354, value);
+     if (enumValue != -1) msg.teDesiredMode = static_cast<decltype(msg.teDesiredMode)>(enumValue);
+     else msg.teDesiredMode = static_cast<decltype(msg.teDesiredMode)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmParamDevMdCfg::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmParamDevMdCfg::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmParamDevMdCfg::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "DesiredMode") {
+            return 1.0 * (long double)(msg.teDesiredMode + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmParamAssocCfg
+std::string PmParamAssocCfg::fnGetValue(const std::string& mnem) const {
+        if (mnem == "AssocType") {
+            if (!ENUMLOOKUP_1546649241.fnContains(msg.teAssocType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAssocType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546649241.fnText(msg.teAssocType));
+              }
+        }
+        else if (mnem == "AssocInst") {
+            return std::to_string(msg.ucAssocInst);
+        }
+        else if (mnem == "AssocId") {
+            return (msg.ucAssocId == 0xff) ? "No Data" : (msg.ucAssocId == 0xfe) ? "Out of range" : (msg.ucAssocId == 0xfd) ? "Reserved" : std::to_string(msg.ucAssocId);
+        }
+        else return "no pgn";
+    }
+void PmParamAssocCfg::Print() const {
+        std::cout << "PGN: PmParamAssocCfg" << std::endl;
+        cout << "AssocType      : " << fnGetValue("AssocType") << " (" << fnGetRawValue("AssocType") << ")" << endl;
+        cout << "AssocInst      : " << fnGetValue("AssocInst") << " (" << fnGetRawValue("AssocInst") << ")" << endl;
+        cout << "AssocId      : " << fnGetValue("AssocId") << " (" << fnGetRawValue("AssocId") << ")" << endl;
+    }
+bool PmParamAssocCfg::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmParamAssocCfg::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "AssocType") {
+            return static_cast<uint32_t>(msg.teAssocType);
+        }
+        else if (mnem == "AssocInst") {
+            return static_cast<uint32_t>(msg.ucAssocInst);
+        }
+        else if (mnem == "AssocId") {
+            return static_cast<uint32_t>(msg.ucAssocId);
+        }
+        return UINT32_MAX;
+    }
+void PmParamAssocCfg::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "AssocType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546649241, value);
+     if (enumValue != -1) msg.teAssocType = static_cast<decltype(msg.teAssocType)>(enumValue);
+     else msg.teAssocType = static_cast<decltype(msg.teAssocType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AssocInst") {
+     msg.ucAssocInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "AssocId") {
+     msg.ucAssocId = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void PmParamAssocCfg::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmParamAssocCfg::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmParamAssocCfg::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "AssocType") {
+            return 1.0 * (long double)(msg.teAssocType + 0.0);
+        }
+        else if (mnem == "AssocInst") {
+            return 1.0 * (long double)(msg.ucAssocInst + 0.0);
+        }
+        else if (mnem == "AssocId") {
+            return 1.0 * (long double)(msg.ucAssocId + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmParamAuxCfg
+std::string PmParamAuxCfg::fnGetValue(const std::string& mnem) const {
+        if (mnem == "OutputId") {
+            return std::to_string(msg.ucOutputId);
+        }
+        else if (mnem == "DesiredState") {
+            if (!ENUMLOOKUP_N1920850496.fnContains(msg.teDesiredState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDesiredState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N1920850496.fnText(msg.teDesiredState));
+              }
+        }
+        else if (mnem == "ActiveLevel") {
+            if (!ENUMLOOKUP_2110464705.fnContains(msg.teActiveLevel)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teActiveLevel);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_2110464705.fnText(msg.teActiveLevel));
+              }
+        }
+        else if (mnem == "SetTrigger") {
+            if (!ENUMLOOKUP_1594238759.fnContains(msg.teSetTrigger)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSetTrigger);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1594238759.fnText(msg.teSetTrigger));
+              }
+        }
+        else if (mnem == "ClrTrigger") {
+            if (!ENUMLOOKUP_1594238759.fnContains(msg.teClrTrigger)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teClrTrigger);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1594238759.fnText(msg.teClrTrigger));
+              }
+        }
+        else return "no pgn";
+    }
+void PmParamAuxCfg::Print() const {
+        std::cout << "PGN: PmParamAuxCfg" << std::endl;
+        cout << "OutputId      : " << fnGetValue("OutputId") << " (" << fnGetRawValue("OutputId") << ")" << endl;
+        cout << "DesiredState      : " << fnGetValue("DesiredState") << " (" << fnGetRawValue("DesiredState") << ")" << endl;
+        cout << "ActiveLevel      : " << fnGetValue("ActiveLevel") << " (" << fnGetRawValue("ActiveLevel") << ")" << endl;
+        cout << "SetTrigger      : " << fnGetValue("SetTrigger") << " (" << fnGetRawValue("SetTrigger") << ")" << endl;
+        cout << "ClrTrigger      : " << fnGetValue("ClrTrigger") << " (" << fnGetRawValue("ClrTrigger") << ")" << endl;
+    }
+bool PmParamAuxCfg::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmParamAuxCfg::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "OutputId") {
+            return static_cast<uint32_t>(msg.ucOutputId);
+        }
+        else if (mnem == "DesiredState") {
+            return static_cast<uint32_t>(msg.teDesiredState);
+        }
+        else if (mnem == "ActiveLevel") {
+            return static_cast<uint32_t>(msg.teActiveLevel);
+        }
+        else if (mnem == "SetTrigger") {
+            return static_cast<uint32_t>(msg.teSetTrigger);
+        }
+        else if (mnem == "ClrTrigger") {
+            return static_cast<uint32_t>(msg.teClrTrigger);
+        }
+        return UINT32_MAX;
+    }
+void PmParamAuxCfg::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "OutputId") {
+     msg.ucOutputId = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DesiredState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N1920850496, value);
+     if (enumValue != -1) msg.teDesiredState = static_cast<decltype(msg.teDesiredState)>(enumValue);
+     else msg.teDesiredState = static_cast<decltype(msg.teDesiredState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ActiveLevel") {
+     int enumValue = findEnumValue(ENUMLOOKUP_2110464705, value);
+     if (enumValue != -1) msg.teActiveLevel = static_cast<decltype(msg.teActiveLevel)>(enumValue);
+     else msg.teActiveLevel = static_cast<decltype(msg.teActiveLevel)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SetTrigger") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1594238759, value);
+     if (enumValue != -1) msg.teSetTrigger = static_cast<decltype(msg.teSetTrigger)>(enumValue);
+     else msg.teSetTrigger = static_cast<decltype(msg.teSetTrigger)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ClrTrigger") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1594238759, value);
+     if (enumValue != -1) msg.teClrTrigger = static_cast<decltype(msg.teClrTrigger)>(enumValue);
+     else msg.teClrTrigger = static_cast<decltype(msg.teClrTrigger)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmParamAuxCfg::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmParamAuxCfg::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmParamAuxCfg::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "OutputId") {
+            return 1.0 * (long double)(msg.ucOutputId + 0.0);
+        }
+        else if (mnem == "DesiredState") {
+            return 1.0 * (long double)(msg.teDesiredState + 0.0);
+        }
+        else if (mnem == "ActiveLevel") {
+            return 1.0 * (long double)(msg.teActiveLevel + 0.0);
+        }
+        else if (mnem == "SetTrigger") {
+            return 1.0 * (long double)(msg.teSetTrigger + 0.0);
+        }
+        else if (mnem == "ClrTrigger") {
+            return 1.0 * (long double)(msg.teClrTrigger + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmParamAuxCfgTrigLvl
+std::string PmParamAuxCfgTrigLvl::fnGetValue(const std::string& mnem) const {
+        if (mnem == "TriggerId") {
+            if (!ENUMLOOKUP_1594238759.fnContains(msg.teTriggerId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTriggerId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1594238759.fnText(msg.teTriggerId));
+              }
+        }
+        else if (mnem == "TriggerLvl") {
+            return (msg.siTriggerLvl == 0x7fff) ? "No Data" : (msg.siTriggerLvl == 0x7ffe) ? "Out of range" : (msg.siTriggerLvl == 0x7ffd) ? "Reserved" : std::to_string(msg.siTriggerLvl);
+        }
+        else return "no pgn";
+    }
+void PmParamAuxCfgTrigLvl::Print() const {
+        std::cout << "PGN: PmParamAuxCfgTrigLvl" << std::endl;
+        cout << "TriggerId      : " << fnGetValue("TriggerId") << " (" << fnGetRawValue("TriggerId") << ")" << endl;
+        cout << "TriggerLvl      : " << fnGetValue("TriggerLvl") << " (" << fnGetRawValue("TriggerLvl") << ")" << endl;
+    }
+bool PmParamAuxCfgTrigLvl::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmParamAuxCfgTrigLvl::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "TriggerId") {
+            return static_cast<uint32_t>(msg.teTriggerId);
+        }
+        else if (mnem == "TriggerLvl") {
+            return static_cast<uint32_t>(msg.siTriggerLvl);
+        }
+        return UINT32_MAX;
+    }
+void PmParamAuxCfgTrigLvl::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "TriggerId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1594238759, value);
+     if (enumValue != -1) msg.teTriggerId = static_cast<decltype(msg.teTriggerId)>(enumValue);
+     else msg.teTriggerId = static_cast<decltype(msg.teTriggerId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TriggerLvl") {
+     msg.siTriggerLvl = stringToInt(value, 0x7fff, 0x7ffe, 0x7ffd);
+        }
+    }
+void PmParamAuxCfgTrigLvl::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmParamAuxCfgTrigLvl::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmParamAuxCfgTrigLvl::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "TriggerId") {
+            return 1.0 * (long double)(msg.teTriggerId + 0.0);
+        }
+        else if (mnem == "TriggerLvl") {
+            return 1.0 * (long double)(msg.siTriggerLvl + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmParamAuxCfgTrigDly
+std::string PmParamAuxCfgTrigDly::fnGetValue(const std::string& mnem) const {
+        if (mnem == "TriggerId") {
+            if (!ENUMLOOKUP_1594238759.fnContains(msg.teTriggerId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTriggerId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1594238759.fnText(msg.teTriggerId));
+              }
+        }
+        else if (mnem == "TriggerDly") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiTriggerDly + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.uiTriggerDly == 0xffff) ? "No Data" : (msg.uiTriggerDly == 0xfffe) ? "Out of range" : (msg.uiTriggerDly == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void PmParamAuxCfgTrigDly::Print() const {
+        std::cout << "PGN: PmParamAuxCfgTrigDly" << std::endl;
+        cout << "TriggerId      : " << fnGetValue("TriggerId") << " (" << fnGetRawValue("TriggerId") << ")" << endl;
+        cout << "TriggerDly      : " << fnGetValue("TriggerDly") << " (" << fnGetRawValue("TriggerDly") << ")" << endl;
+    }
+bool PmParamAuxCfgTrigDly::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmParamAuxCfgTrigDly::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "TriggerId") {
+            return static_cast<uint32_t>(msg.teTriggerId);
+        }
+        else if (mnem == "TriggerDly") {
+            return static_cast<uint32_t>(msg.uiTriggerDly);
+        }
+        return UINT32_MAX;
+    }
+void PmParamAuxCfgTrigDly::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "TriggerId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1594238759, value);
+     if (enumValue != -1) msg.teTriggerId = static_cast<decltype(msg.teTriggerId)>(enumValue);
+     else msg.teTriggerId = static_cast<decltype(msg.teTriggerId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TriggerDly") {
+     msg.uiTriggerDly = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void PmParamAuxCfgTrigDly::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmParamAuxCfgTrigDly::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmParamAuxCfgTrigDly::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "TriggerId") {
+            return 1.0 * (long double)(msg.teTriggerId + 0.0);
+        }
+        else if (mnem == "TriggerDly") {
+            return 1.0 * (long double)(msg.uiTriggerDly + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmParamAuxSts
+std::string PmParamAuxSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "OutputId") {
+            return std::to_string(msg.ucOutputId);
+        }
+        else if (mnem == "OpState") {
+            if (!ENUMLOOKUP_1594080027.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1594080027.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "OnReason") {
+            if (!ENUMLOOKUP_N961307955.fnContains(msg.teOnReason)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOnReason);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N961307955.fnText(msg.teOnReason));
+              }
+        }
+        else if (mnem == "OffReason") {
+            if (!ENUMLOOKUP_N961307955.fnContains(msg.teOffReason)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOffReason);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N961307955.fnText(msg.teOffReason));
+              }
+        }
+        else return "no pgn";
+    }
+void PmParamAuxSts::Print() const {
+        std::cout << "PGN: PmParamAuxSts" << std::endl;
+        cout << "OutputId      : " << fnGetValue("OutputId") << " (" << fnGetRawValue("OutputId") << ")" << endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "OnReason      : " << fnGetValue("OnReason") << " (" << fnGetRawValue("OnReason") << ")" << endl;
+        cout << "OffReason      : " << fnGetValue("OffReason") << " (" << fnGetRawValue("OffReason") << ")" << endl;
+    }
+bool PmParamAuxSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmParamAuxSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "OutputId") {
+            return static_cast<uint32_t>(msg.ucOutputId);
+        }
+        else if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "OnReason") {
+            return static_cast<uint32_t>(msg.teOnReason);
+        }
+        else if (mnem == "OffReason") {
+            return static_cast<uint32_t>(msg.teOffReason);
+        }
+        return UINT32_MAX;
+    }
+void PmParamAuxSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "OutputId") {
+     msg.ucOutputId = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1594080027, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OnReason") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N961307955, value);
+     if (enumValue != -1) msg.teOnReason = static_cast<decltype(msg.teOnReason)>(enumValue);
+     else msg.teOnReason = static_cast<decltype(msg.teOnReason)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OffReason") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N961307955, value);
+     if (enumValue != -1) msg.teOffReason = static_cast<decltype(msg.teOffReason)>(enumValue);
+     else msg.teOffReason = static_cast<decltype(msg.teOffReason)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmParamAuxSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmParamAuxSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmParamAuxSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "OutputId") {
+            return 1.0 * (long double)(msg.ucOutputId + 0.0);
+        }
+        else if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "OnReason") {
+            return 1.0 * (long double)(msg.teOnReason + 0.0);
+        }
+        else if (mnem == "OffReason") {
+            return 1.0 * (long double)(msg.teOffReason + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmAssocCfg
+std::string PmAssocCfg::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "AssocType") {
+            if (!ENUMLOOKUP_1546649241.fnContains(msg.teAssocType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAssocType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546649241.fnText(msg.teAssocType));
+              }
+        }
+        else if (mnem == "AssocInst") {
+            return std::to_string(msg.ucAssocInst);
+        }
+        else if (mnem == "AssocId") {
+            return (msg.ucAssocId == 0xff) ? "No Data" : (msg.ucAssocId == 0xfe) ? "Out of range" : (msg.ucAssocId == 0xfd) ? "Reserved" : std::to_string(msg.ucAssocId);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmAssocCfg::Print() const {
+        std::cout << "PGN: PmAssocCfg" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "AssocType      : " << fnGetValue("AssocType") << " (" << fnGetRawValue("AssocType") << ")" << endl;
+        cout << "AssocInst      : " << fnGetValue("AssocInst") << " (" << fnGetRawValue("AssocInst") << ")" << endl;
+        cout << "AssocId      : " << fnGetValue("AssocId") << " (" << fnGetRawValue("AssocId") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmAssocCfg::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmAssocCfg::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "AssocType") {
+            return static_cast<uint32_t>(msg.teAssocType);
+        }
+        else if (mnem == "AssocInst") {
+            return static_cast<uint32_t>(msg.ucAssocInst);
+        }
+        else if (mnem == "AssocId") {
+            return static_cast<uint32_t>(msg.ucAssocId);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmAssocCfg::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AssocType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546649241, value);
+     if (enumValue != -1) msg.teAssocType = static_cast<decltype(msg.teAssocType)>(enumValue);
+     else msg.teAssocType = static_cast<decltype(msg.teAssocType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AssocInst") {
+     msg.ucAssocInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "AssocId") {
+     msg.ucAssocId = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmAssocCfg::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmAssocCfg::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmAssocCfg::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "AssocType") {
+            return 1.0 * (long double)(msg.teAssocType + 0.0);
+        }
+        else if (mnem == "AssocInst") {
+            return 1.0 * (long double)(msg.ucAssocInst + 0.0);
+        }
+        else if (mnem == "AssocId") {
+            return 1.0 * (long double)(msg.ucAssocId + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmReq
+std::string PmReq::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ReqId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teReqId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teReqId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teReqId));
+              }
+        }
+        else if (mnem == "Param1") {
+            return (msg.ucParam1 == 0xff) ? "No Data" : (msg.ucParam1 == 0xfe) ? "Out of range" : (msg.ucParam1 == 0xfd) ? "Reserved" : std::to_string(msg.ucParam1);
+        }
+        else if (mnem == "Param2") {
+            return (msg.ucParam2 == 0xff) ? "No Data" : (msg.ucParam2 == 0xfe) ? "Out of range" : (msg.ucParam2 == 0xfd) ? "Reserved" : std::to_string(msg.ucParam2);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmReq::Print() const {
+        std::cout << "PGN: PmReq" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ReqId      : " << fnGetValue("ReqId") << " (" << fnGetRawValue("ReqId") << ")" << endl;
+        cout << "Param1      : " << fnGetValue("Param1") << " (" << fnGetRawValue("Param1") << ")" << endl;
+        cout << "Param2      : " << fnGetValue("Param2") << " (" << fnGetRawValue("Param2") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmReq::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmReq::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ReqId") {
+            return static_cast<uint32_t>(msg.teReqId);
+        }
+        else if (mnem == "Param1") {
+            return static_cast<uint32_t>(msg.ucParam1);
+        }
+        else if (mnem == "Param2") {
+            return static_cast<uint32_t>(msg.ucParam2);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmReq::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ReqId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teReqId = static_cast<decltype(msg.teReqId)>(enumValue);
+     else msg.teReqId = static_cast<decltype(msg.teReqId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Param1") {
+     msg.ucParam1 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Param2") {
+     msg.ucParam2 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmReq::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmReq::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmReq::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ReqId") {
+            return 1.0 * (long double)(msg.teReqId + 0.0);
+        }
+        else if (mnem == "Param1") {
+            return 1.0 * (long double)(msg.ucParam1 + 0.0);
+        }
+        else if (mnem == "Param2") {
+            return 1.0 * (long double)(msg.ucParam2 + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmAssocSts
+std::string PmAssocSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "AssocType") {
+            if (!ENUMLOOKUP_1546649241.fnContains(msg.teAssocType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAssocType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546649241.fnText(msg.teAssocType));
+              }
+        }
+        else if (mnem == "AssocInst") {
+            return std::to_string(msg.ucAssocInst);
+        }
+        else if (mnem == "AssocId") {
+            return (msg.ucAssocId == 0xff) ? "No Data" : (msg.ucAssocId == 0xfe) ? "Out of range" : (msg.ucAssocId == 0xfd) ? "Reserved" : std::to_string(msg.ucAssocId);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmAssocSts::Print() const {
+        std::cout << "PGN: PmAssocSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "AssocType      : " << fnGetValue("AssocType") << " (" << fnGetRawValue("AssocType") << ")" << endl;
+        cout << "AssocInst      : " << fnGetValue("AssocInst") << " (" << fnGetRawValue("AssocInst") << ")" << endl;
+        cout << "AssocId      : " << fnGetValue("AssocId") << " (" << fnGetRawValue("AssocId") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmAssocSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmAssocSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "AssocType") {
+            return static_cast<uint32_t>(msg.teAssocType);
+        }
+        else if (mnem == "AssocInst") {
+            return static_cast<uint32_t>(msg.ucAssocInst);
+        }
+        else if (mnem == "AssocId") {
+            return static_cast<uint32_t>(msg.ucAssocId);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmAssocSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AssocType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546649241, value);
+     if (enumValue != -1) msg.teAssocType = static_cast<decltype(msg.teAssocType)>(enumValue);
+     else msg.teAssocType = static_cast<decltype(msg.teAssocType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AssocInst") {
+     msg.ucAssocInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "AssocId") {
+     msg.ucAssocId = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmAssocSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmAssocSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmAssocSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "AssocType") {
+            return 1.0 * (long double)(msg.teAssocType + 0.0);
+        }
+        else if (mnem == "AssocInst") {
+            return 1.0 * (long double)(msg.ucAssocInst + 0.0);
+        }
+        else if (mnem == "AssocId") {
+            return 1.0 * (long double)(msg.ucAssocId + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmDevMdCfg
+std::string PmDevMdCfg::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "DesiredMode") {
+            if (!ENUMLOOKUP_N725723354.fnContains(msg.teDesiredMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDesiredMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N725723354.fnText(msg.teDesiredMode));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmDevMdCfg::Print() const {
+        std::cout << "PGN: PmDevMdCfg" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "DesiredMode      : " << fnGetValue("DesiredMode") << " (" << fnGetRawValue("DesiredMode") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmDevMdCfg::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmDevMdCfg::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "DesiredMode") {
+            return static_cast<uint32_t>(msg.teDesiredMode);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmDevMdCfg::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DesiredMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N725723354, value);
+     if (enumValue != -1) msg.teDesiredMode = static_cast<decltype(msg.teDesiredMode)>(enumValue);
+     else msg.teDesiredMode = static_cast<decltype(msg.teDesiredMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmDevMdCfg::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmDevMdCfg::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmDevMdCfg::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "DesiredMode") {
+            return 1.0 * (long double)(msg.teDesiredMode + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmFxccCfgCmd
+std::string PmFxccCfgCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "PwrSvHr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucPwrSvHr + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "h");
+            return (msg.ucPwrSvHr == 0xff) ? "No Data" : (msg.ucPwrSvHr == 0xfe) ? "Out of range" : (msg.ucPwrSvHr == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "InvIgnCtrl") {
+            if (!ENUMLOOKUP_1552924287.fnContains(msg.teInvIgnCtrl)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvIgnCtrl);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1552924287.fnText(msg.teInvIgnCtrl));
+              }
+        }
+        else if (mnem == "TransMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teTransMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTransMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teTransMode));
+              }
+        }
+        else if (mnem == "AlarmEnDis") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmEnDis));
+              }
+        }
+        else if (mnem == "OverFltRecEnDis") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOverFltRecEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOverFltRecEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOverFltRecEnDis));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmFxccCfgCmd::Print() const {
+        std::cout << "PGN: PmFxccCfgCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "PwrSvHr      : " << fnGetValue("PwrSvHr") << " (" << fnGetRawValue("PwrSvHr") << ")" << endl;
+        cout << "InvIgnCtrl      : " << fnGetValue("InvIgnCtrl") << " (" << fnGetRawValue("InvIgnCtrl") << ")" << endl;
+        cout << "TransMode      : " << fnGetValue("TransMode") << " (" << fnGetRawValue("TransMode") << ")" << endl;
+        cout << "AlarmEnDis      : " << fnGetValue("AlarmEnDis") << " (" << fnGetRawValue("AlarmEnDis") << ")" << endl;
+        cout << "OverFltRecEnDis      : " << fnGetValue("OverFltRecEnDis") << " (" << fnGetRawValue("OverFltRecEnDis") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmFxccCfgCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmFxccCfgCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "PwrSvHr") {
+            return static_cast<uint32_t>(msg.ucPwrSvHr);
+        }
+        else if (mnem == "InvIgnCtrl") {
+            return static_cast<uint32_t>(msg.teInvIgnCtrl);
+        }
+        else if (mnem == "TransMode") {
+            return static_cast<uint32_t>(msg.teTransMode);
+        }
+        else if (mnem == "AlarmEnDis") {
+            return static_cast<uint32_t>(msg.teAlarmEnDis);
+        }
+        else if (mnem == "OverFltRecEnDis") {
+            return static_cast<uint32_t>(msg.teOverFltRecEnDis);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmFxccCfgCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PwrSvHr") {
+     msg.ucPwrSvHr = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "InvIgnCtrl") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1552924287, value);
+     if (enumValue != -1) msg.teInvIgnCtrl = static_cast<decltype(msg.teInvIgnCtrl)>(enumValue);
+     else msg.teInvIgnCtrl = static_cast<decltype(msg.teInvIgnCtrl)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TransMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teTransMode = static_cast<decltype(msg.teTransMode)>(enumValue);
+     else msg.teTransMode = static_cast<decltype(msg.teTransMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmEnDis = static_cast<decltype(msg.teAlarmEnDis)>(enumValue);
+     else msg.teAlarmEnDis = static_cast<decltype(msg.teAlarmEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OverFltRecEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOverFltRecEnDis = static_cast<decltype(msg.teOverFltRecEnDis)>(enumValue);
+     else msg.teOverFltRecEnDis = static_cast<decltype(msg.teOverFltRecEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmFxccCfgCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmFxccCfgCmd::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnInvFaultRecovery2Cmd") return fnInvFaultRecovery2Cmd(param_value);
+        if (func == "fnPwrSaveTime2Cmd") return fnPwrSaveTime2Cmd(param_value);
+ return "";     };
+long double PmFxccCfgCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "PwrSvHr") {
+            return 1.0 * (long double)(msg.ucPwrSvHr + 0.0);
+        }
+        else if (mnem == "InvIgnCtrl") {
+            return 1.0 * (long double)(msg.teInvIgnCtrl + 0.0);
+        }
+        else if (mnem == "TransMode") {
+            return 1.0 * (long double)(msg.teTransMode + 0.0);
+        }
+        else if (mnem == "AlarmEnDis") {
+            return 1.0 * (long double)(msg.teAlarmEnDis + 0.0);
+        }
+        else if (mnem == "OverFltRecEnDis") {
+            return 1.0 * (long double)(msg.teOverFltRecEnDis + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmDevMdSts
+std::string PmDevMdSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "CurrentMode") {
+            if (!ENUMLOOKUP_N725723354.fnContains(msg.teCurrentMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCurrentMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N725723354.fnText(msg.teCurrentMode));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmDevMdSts::Print() const {
+        std::cout << "PGN: PmDevMdSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "CurrentMode      : " << fnGetValue("CurrentMode") << " (" << fnGetRawValue("CurrentMode") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmDevMdSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmDevMdSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "CurrentMode") {
+            return static_cast<uint32_t>(msg.teCurrentMode);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmDevMdSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CurrentMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N725723354, value);
+     if (enumValue != -1) msg.teCurrentMode = static_cast<decltype(msg.teCurrentMode)>(enumValue);
+     else msg.teCurrentMode = static_cast<decltype(msg.teCurrentMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmDevMdSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmDevMdSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmDevMdSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "CurrentMode") {
+            return 1.0 * (long double)(msg.teCurrentMode + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmFxccCfgSts
+std::string PmFxccCfgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "PwrSvHr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucPwrSvHr + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "h");
+            return (msg.ucPwrSvHr == 0xff) ? "No Data" : (msg.ucPwrSvHr == 0xfe) ? "Out of range" : (msg.ucPwrSvHr == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "InvIgnCtrl") {
+            if (!ENUMLOOKUP_1552924287.fnContains(msg.teInvIgnCtrl)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvIgnCtrl);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1552924287.fnText(msg.teInvIgnCtrl));
+              }
+        }
+        else if (mnem == "TransMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teTransMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTransMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teTransMode));
+              }
+        }
+        else if (mnem == "AlarmEnDis") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teAlarmEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAlarmEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teAlarmEnDis));
+              }
+        }
+        else if (mnem == "OvrFltRecEnDis") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teOvrFltRecEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOvrFltRecEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teOvrFltRecEnDis));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmFxccCfgSts::Print() const {
+        std::cout << "PGN: PmFxccCfgSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "PwrSvHr      : " << fnGetValue("PwrSvHr") << " (" << fnGetRawValue("PwrSvHr") << ")" << endl;
+        cout << "InvIgnCtrl      : " << fnGetValue("InvIgnCtrl") << " (" << fnGetRawValue("InvIgnCtrl") << ")" << endl;
+        cout << "TransMode      : " << fnGetValue("TransMode") << " (" << fnGetRawValue("TransMode") << ")" << endl;
+        cout << "AlarmEnDis      : " << fnGetValue("AlarmEnDis") << " (" << fnGetRawValue("AlarmEnDis") << ")" << endl;
+        cout << "OvrFltRecEnDis      : " << fnGetValue("OvrFltRecEnDis") << " (" << fnGetRawValue("OvrFltRecEnDis") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmFxccCfgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmFxccCfgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "PwrSvHr") {
+            return static_cast<uint32_t>(msg.ucPwrSvHr);
+        }
+        else if (mnem == "InvIgnCtrl") {
+            return static_cast<uint32_t>(msg.teInvIgnCtrl);
+        }
+        else if (mnem == "TransMode") {
+            return static_cast<uint32_t>(msg.teTransMode);
+        }
+        else if (mnem == "AlarmEnDis") {
+            return static_cast<uint32_t>(msg.teAlarmEnDis);
+        }
+        else if (mnem == "OvrFltRecEnDis") {
+            return static_cast<uint32_t>(msg.teOvrFltRecEnDis);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmFxccCfgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PwrSvHr") {
+     msg.ucPwrSvHr = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "InvIgnCtrl") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1552924287, value);
+     if (enumValue != -1) msg.teInvIgnCtrl = static_cast<decltype(msg.teInvIgnCtrl)>(enumValue);
+     else msg.teInvIgnCtrl = static_cast<decltype(msg.teInvIgnCtrl)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TransMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teTransMode = static_cast<decltype(msg.teTransMode)>(enumValue);
+     else msg.teTransMode = static_cast<decltype(msg.teTransMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AlarmEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teAlarmEnDis = static_cast<decltype(msg.teAlarmEnDis)>(enumValue);
+     else msg.teAlarmEnDis = static_cast<decltype(msg.teAlarmEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OvrFltRecEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teOvrFltRecEnDis = static_cast<decltype(msg.teOvrFltRecEnDis)>(enumValue);
+     else msg.teOvrFltRecEnDis = static_cast<decltype(msg.teOvrFltRecEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmFxccCfgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmFxccCfgSts::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnSts2InvFaultRecovery") return fnSts2InvFaultRecovery(param_value);
+        if (func == "fnSts2PwrSaveTime") return fnSts2PwrSaveTime(param_value);
+ return "";     };
+long double PmFxccCfgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "PwrSvHr") {
+            return 1.0 * (long double)(msg.ucPwrSvHr + 0.0);
+        }
+        else if (mnem == "InvIgnCtrl") {
+            return 1.0 * (long double)(msg.teInvIgnCtrl + 0.0);
+        }
+        else if (mnem == "TransMode") {
+            return 1.0 * (long double)(msg.teTransMode + 0.0);
+        }
+        else if (mnem == "AlarmEnDis") {
+            return 1.0 * (long double)(msg.teAlarmEnDis + 0.0);
+        }
+        else if (mnem == "OvrFltRecEnDis") {
+            return 1.0 * (long double)(msg.teOvrFltRecEnDis + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmSwVerSts
+std::string PmSwVerSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ProcInst") {
+            return std::to_string(msg.ucProcInst);
+        }
+        else if (mnem == "SwModIdent") {
+            if (!ENUMLOOKUP_N1372759813.fnContains(msg.teSwModIdent)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSwModIdent);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N1372759813.fnText(msg.teSwModIdent));
+              }
+        }
+        else if (mnem == "SwVerMsb") {
+            return std::to_string(msg.ucSwVerMsb);
+        }
+        else if (mnem == "SwVerIsb") {
+            return std::to_string(msg.ucSwVerIsb);
+        }
+        else if (mnem == "SwVerLsb") {
+            return std::to_string(msg.ucSwVerLsb);
+        }
+        else if (mnem == "SwBldNumMsb") {
+            return std::to_string(msg.ucSwBldNumMsb);
+        }
+        else if (mnem == "SwBldNumLsb") {
+            return std::to_string(msg.ucSwBldNumLsb);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmSwVerSts::Print() const {
+        std::cout << "PGN: PmSwVerSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ProcInst      : " << fnGetValue("ProcInst") << " (" << fnGetRawValue("ProcInst") << ")" << endl;
+        cout << "SwModIdent      : " << fnGetValue("SwModIdent") << " (" << fnGetRawValue("SwModIdent") << ")" << endl;
+        cout << "SwVerMsb      : " << fnGetValue("SwVerMsb") << " (" << fnGetRawValue("SwVerMsb") << ")" << endl;
+        cout << "SwVerIsb      : " << fnGetValue("SwVerIsb") << " (" << fnGetRawValue("SwVerIsb") << ")" << endl;
+        cout << "SwVerLsb      : " << fnGetValue("SwVerLsb") << " (" << fnGetRawValue("SwVerLsb") << ")" << endl;
+        cout << "SwBldNumMsb      : " << fnGetValue("SwBldNumMsb") << " (" << fnGetRawValue("SwBldNumMsb") << ")" << endl;
+        cout << "SwBldNumLsb      : " << fnGetValue("SwBldNumLsb") << " (" << fnGetRawValue("SwBldNumLsb") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmSwVerSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmSwVerSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ProcInst") {
+            return static_cast<uint32_t>(msg.ucProcInst);
+        }
+        else if (mnem == "SwModIdent") {
+            return static_cast<uint32_t>(msg.teSwModIdent);
+        }
+        else if (mnem == "SwVerMsb") {
+            return static_cast<uint32_t>(msg.ucSwVerMsb);
+        }
+        else if (mnem == "SwVerIsb") {
+            return static_cast<uint32_t>(msg.ucSwVerIsb);
+        }
+        else if (mnem == "SwVerLsb") {
+            return static_cast<uint32_t>(msg.ucSwVerLsb);
+        }
+        else if (mnem == "SwBldNumMsb") {
+            return static_cast<uint32_t>(msg.ucSwBldNumMsb);
+        }
+        else if (mnem == "SwBldNumLsb") {
+            return static_cast<uint32_t>(msg.ucSwBldNumLsb);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmSwVerSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ProcInst") {
+     msg.ucProcInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "SwModIdent") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N1372759813, value);
+     if (enumValue != -1) msg.teSwModIdent = static_cast<decltype(msg.teSwModIdent)>(enumValue);
+     else msg.teSwModIdent = static_cast<decltype(msg.teSwModIdent)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SwVerMsb") {
+     msg.ucSwVerMsb = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "SwVerIsb") {
+     msg.ucSwVerIsb = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "SwVerLsb") {
+     msg.ucSwVerLsb = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "SwBldNumMsb") {
+     msg.ucSwBldNumMsb = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "SwBldNumLsb") {
+     msg.ucSwBldNumLsb = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmSwVerSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmSwVerSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmSwVerSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ProcInst") {
+            return 1.0 * (long double)(msg.ucProcInst + 0.0);
+        }
+        else if (mnem == "SwModIdent") {
+            return 1.0 * (long double)(msg.teSwModIdent + 0.0);
+        }
+        else if (mnem == "SwVerMsb") {
+            return 1.0 * (long double)(msg.ucSwVerMsb + 0.0);
+        }
+        else if (mnem == "SwVerIsb") {
+            return 1.0 * (long double)(msg.ucSwVerIsb + 0.0);
+        }
+        else if (mnem == "SwVerLsb") {
+            return 1.0 * (long double)(msg.ucSwVerLsb + 0.0);
+        }
+        else if (mnem == "SwBldNumMsb") {
+            return 1.0 * (long double)(msg.ucSwBldNumMsb + 0.0);
+        }
+        else if (mnem == "SwBldNumLsb") {
+            return 1.0 * (long double)(msg.ucSwBldNumLsb + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmRpcCmd
+std::string PmRpcCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ProcedureId") {
+            return std::to_string(msg.ucProcedureId);
+        }
+        else if (mnem == "ProcedureArg") {
+            return (msg.ulProcedureArg == 0xffffffff) ? "No Data" : (msg.ulProcedureArg == 0xfffffffe) ? "Out of range" : (msg.ulProcedureArg == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulProcedureArg);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmRpcCmd::Print() const {
+        std::cout << "PGN: PmRpcCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ProcedureId      : " << fnGetValue("ProcedureId") << " (" << fnGetRawValue("ProcedureId") << ")" << endl;
+        cout << "ProcedureArg      : " << fnGetValue("ProcedureArg") << " (" << fnGetRawValue("ProcedureArg") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmRpcCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmRpcCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ProcedureId") {
+            return static_cast<uint32_t>(msg.ucProcedureId);
+        }
+        else if (mnem == "ProcedureArg") {
+            return static_cast<uint32_t>(msg.ulProcedureArg);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmRpcCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ProcedureId") {
+     msg.ucProcedureId = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ProcedureArg") {
+     msg.ulProcedureArg = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmRpcCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmRpcCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmRpcCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ProcedureId") {
+            return 1.0 * (long double)(msg.ucProcedureId + 0.0);
+        }
+        else if (mnem == "ProcedureArg") {
+            return 1.0 * (long double)(msg.ulProcedureArg + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmInvLdShSts
+std::string PmInvLdShSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "AcSrcId") {
+            if (!ENUMLOOKUP_321179986.fnContains(msg.teAcSrcId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcSrcId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_321179986.fnText(msg.teAcSrcId));
+              }
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_281300007.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_281300007.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "InvOutPwr_1") {
+            return std::to_string(msg.ucInvOutPwr_1);
+        }
+        else if (mnem == "InvOutPwr_2") {
+            return std::to_string(msg.ucInvOutPwr_2);
+        }
+        else if (mnem == "InvOutPwr_3") {
+            return std::to_string(msg.ucInvOutPwr_3);
+        }
+        else if (mnem == "Current_1") {
+            return std::to_string(msg.ucCurrent_1);
+        }
+        else if (mnem == "Current_2") {
+            return std::to_string(msg.ucCurrent_2);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmInvLdShSts::Print() const {
+        std::cout << "PGN: PmInvLdShSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "AcSrcId      : " << fnGetValue("AcSrcId") << " (" << fnGetRawValue("AcSrcId") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "InvOutPwr_1      : " << fnGetValue("InvOutPwr_1") << " (" << fnGetRawValue("InvOutPwr_1") << ")" << endl;
+        cout << "InvOutPwr_2      : " << fnGetValue("InvOutPwr_2") << " (" << fnGetRawValue("InvOutPwr_2") << ")" << endl;
+        cout << "InvOutPwr_3      : " << fnGetValue("InvOutPwr_3") << " (" << fnGetRawValue("InvOutPwr_3") << ")" << endl;
+        cout << "Current_1      : " << fnGetValue("Current_1") << " (" << fnGetRawValue("Current_1") << ")" << endl;
+        cout << "Current_2      : " << fnGetValue("Current_2") << " (" << fnGetRawValue("Current_2") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmInvLdShSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmInvLdShSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "AcSrcId") {
+            return static_cast<uint32_t>(msg.teAcSrcId);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "InvOutPwr_1") {
+            return static_cast<uint32_t>(msg.ucInvOutPwr_1);
+        }
+        else if (mnem == "InvOutPwr_2") {
+            return static_cast<uint32_t>(msg.ucInvOutPwr_2);
+        }
+        else if (mnem == "InvOutPwr_3") {
+            return static_cast<uint32_t>(msg.ucInvOutPwr_3);
+        }
+        else if (mnem == "Current_1") {
+            return static_cast<uint32_t>(msg.ucCurrent_1);
+        }
+        else if (mnem == "Current_2") {
+            return static_cast<uint32_t>(msg.ucCurrent_2);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmInvLdShSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcSrcId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_321179986, value);
+     if (enumValue != -1) msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(enumValue);
+     else msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_281300007, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InvOutPwr_1") {
+     msg.ucInvOutPwr_1 = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "InvOutPwr_2") {
+     msg.ucInvOutPwr_2 = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "InvOutPwr_3") {
+     msg.ucInvOutPwr_3 = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Current_1") {
+     msg.ucCurrent_1 = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Current_2") {
+     msg.ucCurrent_2 = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmInvLdShSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmInvLdShSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmInvLdShSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "AcSrcId") {
+            return 1.0 * (long double)(msg.teAcSrcId + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "InvOutPwr_1") {
+            return 1.0 * (long double)(msg.ucInvOutPwr_1 + 0.0);
+        }
+        else if (mnem == "InvOutPwr_2") {
+            return 1.0 * (long double)(msg.ucInvOutPwr_2 + 0.0);
+        }
+        else if (mnem == "InvOutPwr_3") {
+            return 1.0 * (long double)(msg.ucInvOutPwr_3 + 0.0);
+        }
+        else if (mnem == "Current_1") {
+            return 1.0 * (long double)(msg.ucCurrent_1 + 0.0);
+        }
+        else if (mnem == "Current_2") {
+            return 1.0 * (long double)(msg.ucCurrent_2 + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmInvSts
+std::string PmInvSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "AcSrcId") {
+            if (!ENUMLOOKUP_321179986.fnContains(msg.teAcSrcId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcSrcId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_321179986.fnText(msg.teAcSrcId));
+              }
+        }
+        else if (mnem == "InvMode") {
+            if (!ENUMLOOKUP_1546651609.fnContains(msg.teInvMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546651609.fnText(msg.teInvMode));
+              }
+        }
+        else if (mnem == "OpState") {
+            if (!ENUMLOOKUP_1687015300.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1687015300.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "InvEnDis") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teInvEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teInvEnDis));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmInvSts::Print() const {
+        std::cout << "PGN: PmInvSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "AcSrcId      : " << fnGetValue("AcSrcId") << " (" << fnGetRawValue("AcSrcId") << ")" << endl;
+        cout << "InvMode      : " << fnGetValue("InvMode") << " (" << fnGetRawValue("InvMode") << ")" << endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "InvEnDis      : " << fnGetValue("InvEnDis") << " (" << fnGetRawValue("InvEnDis") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmInvSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmInvSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "AcSrcId") {
+            return static_cast<uint32_t>(msg.teAcSrcId);
+        }
+        else if (mnem == "InvMode") {
+            return static_cast<uint32_t>(msg.teInvMode);
+        }
+        else if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "InvEnDis") {
+            return static_cast<uint32_t>(msg.teInvEnDis);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmInvSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcSrcId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_321179986, value);
+     if (enumValue != -1) msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(enumValue);
+     else msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InvMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546651609, value);
+     if (enumValue != -1) msg.teInvMode = static_cast<decltype(msg.teInvMode)>(enumValue);
+     else msg.teInvMode = static_cast<decltype(msg.teInvMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1687015300, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InvEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teInvEnDis = static_cast<decltype(msg.teInvEnDis)>(enumValue);
+     else msg.teInvEnDis = static_cast<decltype(msg.teInvEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmInvSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmInvSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmInvSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "AcSrcId") {
+            return 1.0 * (long double)(msg.teAcSrcId + 0.0);
+        }
+        else if (mnem == "InvMode") {
+            return 1.0 * (long double)(msg.teInvMode + 0.0);
+        }
+        else if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "InvEnDis") {
+            return 1.0 * (long double)(msg.teInvEnDis + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmChgSts
+std::string PmChgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "DcInOutAssocId") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teDcInOutAssocId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teDcInOutAssocId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teDcInOutAssocId));
+              }
+        }
+        else if (mnem == "BattTempSensorPresent") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBattTempSensorPresent)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattTempSensorPresent);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBattTempSensorPresent));
+              }
+        }
+        else if (mnem == "OpState") {
+            if (!ENUMLOOKUP_1650332213.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1650332213.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "ChgMode") {
+            if (!ENUMLOOKUP_1679608493.fnContains(msg.teChgMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1679608493.fnText(msg.teChgMode));
+              }
+        }
+        else if (mnem == "ChgAlgorithm") {
+            if (!ENUMLOOKUP_N710120228.fnContains(msg.teChgAlgorithm)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgAlgorithm);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N710120228.fnText(msg.teChgAlgorithm));
+              }
+        }
+        else if (mnem == "CtrlVolts") {
+            char buffer[50];
+            auto engval = 0.010000000707805157 * (long double) (msg.siCtrlVolts + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "V");
+            return (msg.siCtrlVolts == 0x7fff) ? "No Data" : (msg.siCtrlVolts == 0x7ffe) ? "Out of range" : (msg.siCtrlVolts == 0x7ffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmChgSts::Print() const {
+        std::cout << "PGN: PmChgSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "DcInOutAssocId      : " << fnGetValue("DcInOutAssocId") << " (" << fnGetRawValue("DcInOutAssocId") << ")" << endl;
+        cout << "BattTempSensorPresent      : " << fnGetValue("BattTempSensorPresent") << " (" << fnGetRawValue("BattTempSensorPresent") << ")" << endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "ChgMode      : " << fnGetValue("ChgMode") << " (" << fnGetRawValue("ChgMode") << ")" << endl;
+        cout << "ChgAlgorithm      : " << fnGetValue("ChgAlgorithm") << " (" << fnGetRawValue("ChgAlgorithm") << ")" << endl;
+        cout << "CtrlVolts      : " << fnGetValue("CtrlVolts") << " (" << fnGetRawValue("CtrlVolts") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmChgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmChgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "DcInOutAssocId") {
+            return static_cast<uint32_t>(msg.teDcInOutAssocId);
+        }
+        else if (mnem == "BattTempSensorPresent") {
+            return static_cast<uint32_t>(msg.teBattTempSensorPresent);
+        }
+        else if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "ChgMode") {
+            return static_cast<uint32_t>(msg.teChgMode);
+        }
+        else if (mnem == "ChgAlgorithm") {
+            return static_cast<uint32_t>(msg.teChgAlgorithm);
+        }
+        else if (mnem == "CtrlVolts") {
+            return static_cast<uint32_t>(msg.siCtrlVolts);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmChgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "DcInOutAssocId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teDcInOutAssocId = static_cast<decltype(msg.teDcInOutAssocId)>(enumValue);
+     else msg.teDcInOutAssocId = static_cast<decltype(msg.teDcInOutAssocId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattTempSensorPresent") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBattTempSensorPresent = static_cast<decltype(msg.teBattTempSensorPresent)>(enumValue);
+     else msg.teBattTempSensorPresent = static_cast<decltype(msg.teBattTempSensorPresent)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1650332213, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1679608493, value);
+     if (enumValue != -1) msg.teChgMode = static_cast<decltype(msg.teChgMode)>(enumValue);
+     else msg.teChgMode = static_cast<decltype(msg.teChgMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgAlgorithm") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N710120228, value);
+     if (enumValue != -1) msg.teChgAlgorithm = static_cast<decltype(msg.teChgAlgorithm)>(enumValue);
+     else msg.teChgAlgorithm = static_cast<decltype(msg.teChgAlgorithm)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CtrlVolts") {
+     msg.siCtrlVolts = stringToInt(value, 0x7fff, 0x7ffe, 0x7ffd, 0.010000000707805157, 0.0);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmChgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmChgSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmChgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "DcInOutAssocId") {
+            return 1.0 * (long double)(msg.teDcInOutAssocId + 0.0);
+        }
+        else if (mnem == "BattTempSensorPresent") {
+            return 1.0 * (long double)(msg.teBattTempSensorPresent + 0.0);
+        }
+        else if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "ChgMode") {
+            return 1.0 * (long double)(msg.teChgMode + 0.0);
+        }
+        else if (mnem == "ChgAlgorithm") {
+            return 1.0 * (long double)(msg.teChgAlgorithm + 0.0);
+        }
+        else if (mnem == "CtrlVolts") {
+            return 0.010000000707805157 * (long double)(msg.siCtrlVolts + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmInvCtrlCmd
+std::string PmInvCtrlCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "AcSrcId") {
+            if (!ENUMLOOKUP_321179986.fnContains(msg.teAcSrcId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcSrcId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_321179986.fnText(msg.teAcSrcId));
+              }
+        }
+        else if (mnem == "InvEnDis") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teInvEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInvEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teInvEnDis));
+              }
+        }
+        else if (mnem == "SellToGridEnDis") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teSellToGridEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSellToGridEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teSellToGridEnDis));
+              }
+        }
+        else if (mnem == "ForceSell") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teForceSell)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teForceSell);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teForceSell));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmInvCtrlCmd::Print() const {
+        std::cout << "PGN: PmInvCtrlCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "AcSrcId      : " << fnGetValue("AcSrcId") << " (" << fnGetRawValue("AcSrcId") << ")" << endl;
+        cout << "InvEnDis      : " << fnGetValue("InvEnDis") << " (" << fnGetRawValue("InvEnDis") << ")" << endl;
+        cout << "SellToGridEnDis      : " << fnGetValue("SellToGridEnDis") << " (" << fnGetRawValue("SellToGridEnDis") << ")" << endl;
+        cout << "ForceSell      : " << fnGetValue("ForceSell") << " (" << fnGetRawValue("ForceSell") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmInvCtrlCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmInvCtrlCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "AcSrcId") {
+            return static_cast<uint32_t>(msg.teAcSrcId);
+        }
+        else if (mnem == "InvEnDis") {
+            return static_cast<uint32_t>(msg.teInvEnDis);
+        }
+        else if (mnem == "SellToGridEnDis") {
+            return static_cast<uint32_t>(msg.teSellToGridEnDis);
+        }
+        else if (mnem == "ForceSell") {
+            return static_cast<uint32_t>(msg.teForceSell);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmInvCtrlCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcSrcId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_321179986, value);
+     if (enumValue != -1) msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(enumValue);
+     else msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "InvEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teInvEnDis = static_cast<decltype(msg.teInvEnDis)>(enumValue);
+     else msg.teInvEnDis = static_cast<decltype(msg.teInvEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SellToGridEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teSellToGridEnDis = static_cast<decltype(msg.teSellToGridEnDis)>(enumValue);
+     else msg.teSellToGridEnDis = static_cast<decltype(msg.teSellToGridEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ForceSell") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teForceSell = static_cast<decltype(msg.teForceSell)>(enumValue);
+     else msg.teForceSell = static_cast<decltype(msg.teForceSell)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmInvCtrlCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmInvCtrlCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmInvCtrlCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "AcSrcId") {
+            return 1.0 * (long double)(msg.teAcSrcId + 0.0);
+        }
+        else if (mnem == "InvEnDis") {
+            return 1.0 * (long double)(msg.teInvEnDis + 0.0);
+        }
+        else if (mnem == "SellToGridEnDis") {
+            return 1.0 * (long double)(msg.teSellToGridEnDis + 0.0);
+        }
+        else if (mnem == "ForceSell") {
+            return 1.0 * (long double)(msg.teForceSell + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmAcStsRms
+std::string PmAcStsRms::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "AcSrcId") {
+            if (!ENUMLOOKUP_321179986.fnContains(msg.teAcSrcId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcSrcId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_321179986.fnText(msg.teAcSrcId));
+              }
+        }
+        else if (mnem == "Line") {
+            if (!ENUMLOOKUP_281300007.fnContains(msg.teLine)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLine);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_281300007.fnText(msg.teLine));
+              }
+        }
+        else if (mnem == "AcConn") {
+            if (!ENUMLOOKUP_1576267937.fnContains(msg.teAcConn)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcConn);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1576267937.fnText(msg.teAcConn));
+              }
+        }
+        else if (mnem == "Quality") {
+            if (!ENUMLOOKUP_498223742.fnContains(msg.teQuality)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teQuality);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_498223742.fnText(msg.teQuality));
+              }
+        }
+        else if (mnem == "Freq") {
+            char buffer[50];
+            auto engval = 0.009999999776482582 * (long double) (msg.uiFreq + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "Hz");
+            return (msg.uiFreq == 0xffff) ? "No Data" : (msg.uiFreq == 0xfffe) ? "Out of range" : (msg.uiFreq == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmAcStsRms::Print() const {
+        std::cout << "PGN: PmAcStsRms" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "AcSrcId      : " << fnGetValue("AcSrcId") << " (" << fnGetRawValue("AcSrcId") << ")" << endl;
+        cout << "Line      : " << fnGetValue("Line") << " (" << fnGetRawValue("Line") << ")" << endl;
+        cout << "AcConn      : " << fnGetValue("AcConn") << " (" << fnGetRawValue("AcConn") << ")" << endl;
+        cout << "Quality      : " << fnGetValue("Quality") << " (" << fnGetRawValue("Quality") << ")" << endl;
+        cout << "Freq      : " << fnGetValue("Freq") << " (" << fnGetRawValue("Freq") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmAcStsRms::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmAcStsRms::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "AcSrcId") {
+            return static_cast<uint32_t>(msg.teAcSrcId);
+        }
+        else if (mnem == "Line") {
+            return static_cast<uint32_t>(msg.teLine);
+        }
+        else if (mnem == "AcConn") {
+            return static_cast<uint32_t>(msg.teAcConn);
+        }
+        else if (mnem == "Quality") {
+            return static_cast<uint32_t>(msg.teQuality);
+        }
+        else if (mnem == "Freq") {
+            return static_cast<uint32_t>(msg.uiFreq);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmAcStsRms::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcSrcId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_321179986, value);
+     if (enumValue != -1) msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(enumValue);
+     else msg.teAcSrcId = static_cast<decltype(msg.teAcSrcId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Line") {
+     int enumValue = findEnumValue(ENUMLOOKUP_281300007, value);
+     if (enumValue != -1) msg.teLine = static_cast<decltype(msg.teLine)>(enumValue);
+     else msg.teLine = static_cast<decltype(msg.teLine)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcConn") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1576267937, value);
+     if (enumValue != -1) msg.teAcConn = static_cast<decltype(msg.teAcConn)>(enumValue);
+     else msg.teAcConn = static_cast<decltype(msg.teAcConn)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Quality") {
+     int enumValue = findEnumValue(ENUMLOOKUP_498223742, value);
+     if (enumValue != -1) msg.teQuality = static_cast<decltype(msg.teQuality)>(enumValue);
+     else msg.teQuality = static_cast<decltype(msg.teQuality)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Freq") {
+     msg.uiFreq = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.009999999776482582, 0.0);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmAcStsRms::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmAcStsRms::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmAcStsRms::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "AcSrcId") {
+            return 1.0 * (long double)(msg.teAcSrcId + 0.0);
+        }
+        else if (mnem == "Line") {
+            return 1.0 * (long double)(msg.teLine + 0.0);
+        }
+        else if (mnem == "AcConn") {
+            return 1.0 * (long double)(msg.teAcConn + 0.0);
+        }
+        else if (mnem == "Quality") {
+            return 1.0 * (long double)(msg.teQuality + 0.0);
+        }
+        else if (mnem == "Freq") {
+            return 0.009999999776482582 * (long double)(msg.uiFreq + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmAcXferSwSts
+std::string PmAcXferSwSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "OpState") {
+            if (!ENUMLOOKUP_N100316561.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N100316561.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "XferSwMode") {
+            if (!ENUMLOOKUP_240482193.fnContains(msg.teXferSwMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teXferSwMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_240482193.fnText(msg.teXferSwMode));
+              }
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmAcXferSwSts::Print() const {
+        std::cout << "PGN: PmAcXferSwSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "XferSwMode      : " << fnGetValue("XferSwMode") << " (" << fnGetRawValue("XferSwMode") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmAcXferSwSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmAcXferSwSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "XferSwMode") {
+            return static_cast<uint32_t>(msg.teXferSwMode);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmAcXferSwSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N100316561, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "XferSwMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_240482193, value);
+     if (enumValue != -1) msg.teXferSwMode = static_cast<decltype(msg.teXferSwMode)>(enumValue);
+     else msg.teXferSwMode = static_cast<decltype(msg.teXferSwMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmAcXferSwSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmAcXferSwSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmAcXferSwSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "XferSwMode") {
+            return 1.0 * (long double)(msg.teXferSwMode + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmGetConfigParam
+std::string PmGetConfigParam::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "CfgParamId") {
+            if (!ENUMLOOKUP_217496074.fnContains(msg.teCfgParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCfgParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_217496074.fnText(msg.teCfgParamId));
+              }
+        }
+        else if (mnem == "ParamValue") {
+            return (msg.ulParamValue == 0xffffffff) ? "No Data" : (msg.ulParamValue == 0xfffffffe) ? "Out of range" : (msg.ulParamValue == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulParamValue);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmGetConfigParam::Print() const {
+        std::cout << "PGN: PmGetConfigParam" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "CfgParamId      : " << fnGetValue("CfgParamId") << " (" << fnGetRawValue("CfgParamId") << ")" << endl;
+        cout << "ParamValue      : " << fnGetValue("ParamValue") << " (" << fnGetRawValue("ParamValue") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmGetConfigParam::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmGetConfigParam::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "CfgParamId") {
+            return static_cast<uint32_t>(msg.teCfgParamId);
+        }
+        else if (mnem == "ParamValue") {
+            return static_cast<uint32_t>(msg.ulParamValue);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmGetConfigParam::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CfgParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_217496074, value);
+     if (enumValue != -1) msg.teCfgParamId = static_cast<decltype(msg.teCfgParamId)>(enumValue);
+     else msg.teCfgParamId = static_cast<decltype(msg.teCfgParamId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamValue") {
+     msg.ulParamValue = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmGetConfigParam::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmGetConfigParam::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmGetConfigParam::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "CfgParamId") {
+            return 1.0 * (long double)(msg.teCfgParamId + 0.0);
+        }
+        else if (mnem == "ParamValue") {
+            return 1.0 * (long double)(msg.ulParamValue + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmSetConfigParam
+std::string PmSetConfigParam::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "CfgParamId") {
+            if (!ENUMLOOKUP_217496074.fnContains(msg.teCfgParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCfgParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_217496074.fnText(msg.teCfgParamId));
+              }
+        }
+        else if (mnem == "ParamValue") {
+            return (msg.ulParamValue == 0xffffffff) ? "No Data" : (msg.ulParamValue == 0xfffffffe) ? "Out of range" : (msg.ulParamValue == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulParamValue);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmSetConfigParam::Print() const {
+        std::cout << "PGN: PmSetConfigParam" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "CfgParamId      : " << fnGetValue("CfgParamId") << " (" << fnGetRawValue("CfgParamId") << ")" << endl;
+        cout << "ParamValue      : " << fnGetValue("ParamValue") << " (" << fnGetRawValue("ParamValue") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmSetConfigParam::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmSetConfigParam::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "CfgParamId") {
+            return static_cast<uint32_t>(msg.teCfgParamId);
+        }
+        else if (mnem == "ParamValue") {
+            return static_cast<uint32_t>(msg.ulParamValue);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmSetConfigParam::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CfgParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_217496074, value);
+     if (enumValue != -1) msg.teCfgParamId = static_cast<decltype(msg.teCfgParamId)>(enumValue);
+     else msg.teCfgParamId = static_cast<decltype(msg.teCfgParamId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamValue") {
+     msg.ulParamValue = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmSetConfigParam::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmSetConfigParam::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmSetConfigParam::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "CfgParamId") {
+            return 1.0 * (long double)(msg.teCfgParamId + 0.0);
+        }
+        else if (mnem == "ParamValue") {
+            return 1.0 * (long double)(msg.ulParamValue + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmGetStatusParam
+std::string PmGetStatusParam::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "StsParamId") {
+            if (!ENUMLOOKUP_1663267569.fnContains(msg.teStsParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teStsParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1663267569.fnText(msg.teStsParamId));
+              }
+        }
+        else if (mnem == "ParamValue") {
+            return (msg.ulParamValue == 0xffffffff) ? "No Data" : (msg.ulParamValue == 0xfffffffe) ? "Out of range" : (msg.ulParamValue == 0xfffffffd) ? "Reserved" : std::to_string(msg.ulParamValue);
+        }
+        else if (mnem == "Crc") {
+            return (msg.uiCrc == 0xffff) ? "No Data" : (msg.uiCrc == 0xfffe) ? "Out of range" : (msg.uiCrc == 0xfffd) ? "Reserved" : std::to_string(msg.uiCrc);
+        }
+        else return "no pgn";
+    }
+void PmGetStatusParam::Print() const {
+        std::cout << "PGN: PmGetStatusParam" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "StsParamId      : " << fnGetValue("StsParamId") << " (" << fnGetRawValue("StsParamId") << ")" << endl;
+        cout << "ParamValue      : " << fnGetValue("ParamValue") << " (" << fnGetRawValue("ParamValue") << ")" << endl;
+        cout << "Crc      : " << fnGetValue("Crc") << " (" << fnGetRawValue("Crc") << ")" << endl;
+    }
+bool PmGetStatusParam::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmGetStatusParam::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "StsParamId") {
+            return static_cast<uint32_t>(msg.teStsParamId);
+        }
+        else if (mnem == "ParamValue") {
+            return static_cast<uint32_t>(msg.ulParamValue);
+        }
+        else if (mnem == "Crc") {
+            return static_cast<uint32_t>(msg.uiCrc);
+        }
+        return UINT32_MAX;
+    }
+void PmGetStatusParam::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "StsParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1663267569, value);
+     if (enumValue != -1) msg.teStsParamId = static_cast<decltype(msg.teStsParamId)>(enumValue);
+     else msg.teStsParamId = static_cast<decltype(msg.teStsParamId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamValue") {
+     msg.ulParamValue = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd);
+        }
+        else if (mnem == "Crc") {
+     msg.uiCrc = stringToInt(value, 0xffff, 0xfffe, 0xfffd);
+        }
+    }
+void PmGetStatusParam::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmGetStatusParam::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmGetStatusParam::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "StsParamId") {
+            return 1.0 * (long double)(msg.teStsParamId + 0.0);
+        }
+        else if (mnem == "ParamValue") {
+            return 1.0 * (long double)(msg.ulParamValue + 0.0);
+        }
+        else if (mnem == "Crc") {
+            return 1.0 * (long double)(msg.uiCrc + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnSessionCmd
+std::string PmPpnSessionCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "SessEnDis") {
+            if (!ENUMLOOKUP_1659473592.fnContains(msg.teSessEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSessEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1659473592.fnText(msg.teSessEnDis));
+              }
+        }
+        else return "no pgn";
+    }
+void PmPpnSessionCmd::Print() const {
+        std::cout << "PGN: PmPpnSessionCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "SessEnDis      : " << fnGetValue("SessEnDis") << " (" << fnGetRawValue("SessEnDis") << ")" << endl;
+    }
+bool PmPpnSessionCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnSessionCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "SessEnDis") {
+            return static_cast<uint32_t>(msg.teSessEnDis);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnSessionCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SessEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1659473592, value);
+     if (enumValue != -1) msg.teSessEnDis = static_cast<decltype(msg.teSessEnDis)>(enumValue);
+     else msg.teSessEnDis = static_cast<decltype(msg.teSessEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmPpnSessionCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnSessionCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnSessionCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "SessEnDis") {
+            return 1.0 * (long double)(msg.teSessEnDis + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnSessionRsp
+std::string PmPpnSessionRsp::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "SessEnDis") {
+            if (!ENUMLOOKUP_1659473592.fnContains(msg.teSessEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSessEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1659473592.fnText(msg.teSessEnDis));
+              }
+        }
+        else return "no pgn";
+    }
+void PmPpnSessionRsp::Print() const {
+        std::cout << "PGN: PmPpnSessionRsp" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "SessEnDis      : " << fnGetValue("SessEnDis") << " (" << fnGetRawValue("SessEnDis") << ")" << endl;
+    }
+bool PmPpnSessionRsp::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnSessionRsp::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "SessEnDis") {
+            return static_cast<uint32_t>(msg.teSessEnDis);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnSessionRsp::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "SessEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1659473592, value);
+     if (enumValue != -1) msg.teSessEnDis = static_cast<decltype(msg.teSessEnDis)>(enumValue);
+     else msg.teSessEnDis = static_cast<decltype(msg.teSessEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmPpnSessionRsp::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnSessionRsp::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnSessionRsp::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "SessEnDis") {
+            return 1.0 * (long double)(msg.teSessEnDis + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnReadCmd
+std::string PmPpnReadCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ParamId") {
+            if (!ENUMLOOKUP_N2087867454.fnContains(msg.teParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N2087867454.fnText(msg.teParamId));
+              }
+        }
+        else return "no pgn";
+    }
+void PmPpnReadCmd::Print() const {
+        std::cout << "PGN: PmPpnReadCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ParamId      : " << fnGetValue("ParamId") << " (" << fnGetRawValue("ParamId") << ")" << endl;
+    }
+bool PmPpnReadCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnReadCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ParamId") {
+            return static_cast<uint32_t>(msg.teParamId);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnReadCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N2087867454, value);
+     if (enumValue != -1) msg.teParamId = static_cast<decltype(msg.teParamId)>(enumValue);
+     else msg.teParamId = static_cast<decltype(msg.teParamId)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmPpnReadCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnReadCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnReadCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ParamId") {
+            return 1.0 * (long double)(msg.teParamId + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnReadRsp
+std::string PmPpnReadRsp::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ParamId") {
+            if (!ENUMLOOKUP_N2087867454.fnContains(msg.teParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N2087867454.fnText(msg.teParamId));
+              }
+        }
+        else if (mnem == "Value0") {
+            return (msg.ucValue0 == 0xff) ? "No Data" : (msg.ucValue0 == 0xfe) ? "Out of range" : (msg.ucValue0 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue0);
+        }
+        else if (mnem == "Value1") {
+            return (msg.ucValue1 == 0xff) ? "No Data" : (msg.ucValue1 == 0xfe) ? "Out of range" : (msg.ucValue1 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue1);
+        }
+        else if (mnem == "Value2") {
+            return (msg.ucValue2 == 0xff) ? "No Data" : (msg.ucValue2 == 0xfe) ? "Out of range" : (msg.ucValue2 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue2);
+        }
+        else if (mnem == "Value3") {
+            return (msg.ucValue3 == 0xff) ? "No Data" : (msg.ucValue3 == 0xfe) ? "Out of range" : (msg.ucValue3 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue3);
+        }
+        else if (mnem == "Value4") {
+            return (msg.ucValue4 == 0xff) ? "No Data" : (msg.ucValue4 == 0xfe) ? "Out of range" : (msg.ucValue4 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue4);
+        }
+        else if (mnem == "Value5") {
+            return (msg.ucValue5 == 0xff) ? "No Data" : (msg.ucValue5 == 0xfe) ? "Out of range" : (msg.ucValue5 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue5);
+        }
+        else return "no pgn";
+    }
+void PmPpnReadRsp::Print() const {
+        std::cout << "PGN: PmPpnReadRsp" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ParamId      : " << fnGetValue("ParamId") << " (" << fnGetRawValue("ParamId") << ")" << endl;
+        cout << "Value0      : " << fnGetValue("Value0") << " (" << fnGetRawValue("Value0") << ")" << endl;
+        cout << "Value1      : " << fnGetValue("Value1") << " (" << fnGetRawValue("Value1") << ")" << endl;
+        cout << "Value2      : " << fnGetValue("Value2") << " (" << fnGetRawValue("Value2") << ")" << endl;
+        cout << "Value3      : " << fnGetValue("Value3") << " (" << fnGetRawValue("Value3") << ")" << endl;
+        cout << "Value4      : " << fnGetValue("Value4") << " (" << fnGetRawValue("Value4") << ")" << endl;
+        cout << "Value5      : " << fnGetValue("Value5") << " (" << fnGetRawValue("Value5") << ")" << endl;
+    }
+bool PmPpnReadRsp::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnReadRsp::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ParamId") {
+            return static_cast<uint32_t>(msg.teParamId);
+        }
+        else if (mnem == "Value0") {
+            return static_cast<uint32_t>(msg.ucValue0);
+        }
+        else if (mnem == "Value1") {
+            return static_cast<uint32_t>(msg.ucValue1);
+        }
+        else if (mnem == "Value2") {
+            return static_cast<uint32_t>(msg.ucValue2);
+        }
+        else if (mnem == "Value3") {
+            return static_cast<uint32_t>(msg.ucValue3);
+        }
+        else if (mnem == "Value4") {
+            return static_cast<uint32_t>(msg.ucValue4);
+        }
+        else if (mnem == "Value5") {
+            return static_cast<uint32_t>(msg.ucValue5);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnReadRsp::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N2087867454, value);
+     if (enumValue != -1) msg.teParamId = static_cast<decltype(msg.teParamId)>(enumValue);
+     else msg.teParamId = static_cast<decltype(msg.teParamId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Value0") {
+     msg.ucValue0 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value1") {
+     msg.ucValue1 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value2") {
+     msg.ucValue2 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value3") {
+     msg.ucValue3 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value4") {
+     msg.ucValue4 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value5") {
+     msg.ucValue5 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void PmPpnReadRsp::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnReadRsp::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnReadRsp::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ParamId") {
+            return 1.0 * (long double)(msg.teParamId + 0.0);
+        }
+        else if (mnem == "Value0") {
+            return 1.0 * (long double)(msg.ucValue0 + 0.0);
+        }
+        else if (mnem == "Value1") {
+            return 1.0 * (long double)(msg.ucValue1 + 0.0);
+        }
+        else if (mnem == "Value2") {
+            return 1.0 * (long double)(msg.ucValue2 + 0.0);
+        }
+        else if (mnem == "Value3") {
+            return 1.0 * (long double)(msg.ucValue3 + 0.0);
+        }
+        else if (mnem == "Value4") {
+            return 1.0 * (long double)(msg.ucValue4 + 0.0);
+        }
+        else if (mnem == "Value5") {
+            return 1.0 * (long double)(msg.ucValue5 + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnWriteCmd
+std::string PmPpnWriteCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ParamId") {
+            if (!ENUMLOOKUP_N2087867454.fnContains(msg.teParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N2087867454.fnText(msg.teParamId));
+              }
+        }
+        else if (mnem == "Value0") {
+            return (msg.ucValue0 == 0xff) ? "No Data" : (msg.ucValue0 == 0xfe) ? "Out of range" : (msg.ucValue0 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue0);
+        }
+        else if (mnem == "Value1") {
+            return (msg.ucValue1 == 0xff) ? "No Data" : (msg.ucValue1 == 0xfe) ? "Out of range" : (msg.ucValue1 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue1);
+        }
+        else if (mnem == "Value2") {
+            return (msg.ucValue2 == 0xff) ? "No Data" : (msg.ucValue2 == 0xfe) ? "Out of range" : (msg.ucValue2 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue2);
+        }
+        else if (mnem == "Value3") {
+            return (msg.ucValue3 == 0xff) ? "No Data" : (msg.ucValue3 == 0xfe) ? "Out of range" : (msg.ucValue3 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue3);
+        }
+        else if (mnem == "Value4") {
+            return (msg.ucValue4 == 0xff) ? "No Data" : (msg.ucValue4 == 0xfe) ? "Out of range" : (msg.ucValue4 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue4);
+        }
+        else if (mnem == "Value5") {
+            return (msg.ucValue5 == 0xff) ? "No Data" : (msg.ucValue5 == 0xfe) ? "Out of range" : (msg.ucValue5 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue5);
+        }
+        else return "no pgn";
+    }
+void PmPpnWriteCmd::Print() const {
+        std::cout << "PGN: PmPpnWriteCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ParamId      : " << fnGetValue("ParamId") << " (" << fnGetRawValue("ParamId") << ")" << endl;
+        cout << "Value0      : " << fnGetValue("Value0") << " (" << fnGetRawValue("Value0") << ")" << endl;
+        cout << "Value1      : " << fnGetValue("Value1") << " (" << fnGetRawValue("Value1") << ")" << endl;
+        cout << "Value2      : " << fnGetValue("Value2") << " (" << fnGetRawValue("Value2") << ")" << endl;
+        cout << "Value3      : " << fnGetValue("Value3") << " (" << fnGetRawValue("Value3") << ")" << endl;
+        cout << "Value4      : " << fnGetValue("Value4") << " (" << fnGetRawValue("Value4") << ")" << endl;
+        cout << "Value5      : " << fnGetValue("Value5") << " (" << fnGetRawValue("Value5") << ")" << endl;
+    }
+bool PmPpnWriteCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnWriteCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ParamId") {
+            return static_cast<uint32_t>(msg.teParamId);
+        }
+        else if (mnem == "Value0") {
+            return static_cast<uint32_t>(msg.ucValue0);
+        }
+        else if (mnem == "Value1") {
+            return static_cast<uint32_t>(msg.ucValue1);
+        }
+        else if (mnem == "Value2") {
+            return static_cast<uint32_t>(msg.ucValue2);
+        }
+        else if (mnem == "Value3") {
+            return static_cast<uint32_t>(msg.ucValue3);
+        }
+        else if (mnem == "Value4") {
+            return static_cast<uint32_t>(msg.ucValue4);
+        }
+        else if (mnem == "Value5") {
+            return static_cast<uint32_t>(msg.ucValue5);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnWriteCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N2087867454, value);
+     if (enumValue != -1) msg.teParamId = static_cast<decltype(msg.teParamId)>(enumValue);
+     else msg.teParamId = static_cast<decltype(msg.teParamId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Value0") {
+     msg.ucValue0 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value1") {
+     msg.ucValue1 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value2") {
+     msg.ucValue2 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value3") {
+     msg.ucValue3 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value4") {
+     msg.ucValue4 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value5") {
+     msg.ucValue5 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void PmPpnWriteCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnWriteCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnWriteCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ParamId") {
+            return 1.0 * (long double)(msg.teParamId + 0.0);
+        }
+        else if (mnem == "Value0") {
+            return 1.0 * (long double)(msg.ucValue0 + 0.0);
+        }
+        else if (mnem == "Value1") {
+            return 1.0 * (long double)(msg.ucValue1 + 0.0);
+        }
+        else if (mnem == "Value2") {
+            return 1.0 * (long double)(msg.ucValue2 + 0.0);
+        }
+        else if (mnem == "Value3") {
+            return 1.0 * (long double)(msg.ucValue3 + 0.0);
+        }
+        else if (mnem == "Value4") {
+            return 1.0 * (long double)(msg.ucValue4 + 0.0);
+        }
+        else if (mnem == "Value5") {
+            return 1.0 * (long double)(msg.ucValue5 + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnWriteRsp
+std::string PmPpnWriteRsp::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ParamId") {
+            if (!ENUMLOOKUP_N2087867454.fnContains(msg.teParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N2087867454.fnText(msg.teParamId));
+              }
+        }
+        else if (mnem == "Value0") {
+            return (msg.ucValue0 == 0xff) ? "No Data" : (msg.ucValue0 == 0xfe) ? "Out of range" : (msg.ucValue0 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue0);
+        }
+        else if (mnem == "Value1") {
+            return (msg.ucValue1 == 0xff) ? "No Data" : (msg.ucValue1 == 0xfe) ? "Out of range" : (msg.ucValue1 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue1);
+        }
+        else if (mnem == "Value2") {
+            return (msg.ucValue2 == 0xff) ? "No Data" : (msg.ucValue2 == 0xfe) ? "Out of range" : (msg.ucValue2 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue2);
+        }
+        else if (mnem == "Value3") {
+            return (msg.ucValue3 == 0xff) ? "No Data" : (msg.ucValue3 == 0xfe) ? "Out of range" : (msg.ucValue3 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue3);
+        }
+        else if (mnem == "Value4") {
+            return (msg.ucValue4 == 0xff) ? "No Data" : (msg.ucValue4 == 0xfe) ? "Out of range" : (msg.ucValue4 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue4);
+        }
+        else if (mnem == "Value5") {
+            return (msg.ucValue5 == 0xff) ? "No Data" : (msg.ucValue5 == 0xfe) ? "Out of range" : (msg.ucValue5 == 0xfd) ? "Reserved" : std::to_string(msg.ucValue5);
+        }
+        else return "no pgn";
+    }
+void PmPpnWriteRsp::Print() const {
+        std::cout << "PGN: PmPpnWriteRsp" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ParamId      : " << fnGetValue("ParamId") << " (" << fnGetRawValue("ParamId") << ")" << endl;
+        cout << "Value0      : " << fnGetValue("Value0") << " (" << fnGetRawValue("Value0") << ")" << endl;
+        cout << "Value1      : " << fnGetValue("Value1") << " (" << fnGetRawValue("Value1") << ")" << endl;
+        cout << "Value2      : " << fnGetValue("Value2") << " (" << fnGetRawValue("Value2") << ")" << endl;
+        cout << "Value3      : " << fnGetValue("Value3") << " (" << fnGetRawValue("Value3") << ")" << endl;
+        cout << "Value4      : " << fnGetValue("Value4") << " (" << fnGetRawValue("Value4") << ")" << endl;
+        cout << "Value5      : " << fnGetValue("Value5") << " (" << fnGetRawValue("Value5") << ")" << endl;
+    }
+bool PmPpnWriteRsp::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnWriteRsp::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ParamId") {
+            return static_cast<uint32_t>(msg.teParamId);
+        }
+        else if (mnem == "Value0") {
+            return static_cast<uint32_t>(msg.ucValue0);
+        }
+        else if (mnem == "Value1") {
+            return static_cast<uint32_t>(msg.ucValue1);
+        }
+        else if (mnem == "Value2") {
+            return static_cast<uint32_t>(msg.ucValue2);
+        }
+        else if (mnem == "Value3") {
+            return static_cast<uint32_t>(msg.ucValue3);
+        }
+        else if (mnem == "Value4") {
+            return static_cast<uint32_t>(msg.ucValue4);
+        }
+        else if (mnem == "Value5") {
+            return static_cast<uint32_t>(msg.ucValue5);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnWriteRsp::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N2087867454, value);
+     if (enumValue != -1) msg.teParamId = static_cast<decltype(msg.teParamId)>(enumValue);
+     else msg.teParamId = static_cast<decltype(msg.teParamId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Value0") {
+     msg.ucValue0 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value1") {
+     msg.ucValue1 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value2") {
+     msg.ucValue2 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value3") {
+     msg.ucValue3 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value4") {
+     msg.ucValue4 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+        else if (mnem == "Value5") {
+     msg.ucValue5 = stringToInt(value, 0xff, 0xfe, 0xfd);
+        }
+    }
+void PmPpnWriteRsp::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnWriteRsp::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnWriteRsp::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ParamId") {
+            return 1.0 * (long double)(msg.teParamId + 0.0);
+        }
+        else if (mnem == "Value0") {
+            return 1.0 * (long double)(msg.ucValue0 + 0.0);
+        }
+        else if (mnem == "Value1") {
+            return 1.0 * (long double)(msg.ucValue1 + 0.0);
+        }
+        else if (mnem == "Value2") {
+            return 1.0 * (long double)(msg.ucValue2 + 0.0);
+        }
+        else if (mnem == "Value3") {
+            return 1.0 * (long double)(msg.ucValue3 + 0.0);
+        }
+        else if (mnem == "Value4") {
+            return 1.0 * (long double)(msg.ucValue4 + 0.0);
+        }
+        else if (mnem == "Value5") {
+            return 1.0 * (long double)(msg.ucValue5 + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmPpnNakRsp
+std::string PmPpnNakRsp::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "ParamId") {
+            if (!ENUMLOOKUP_N2087867454.fnContains(msg.teParamId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teParamId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_N2087867454.fnText(msg.teParamId));
+              }
+        }
+        else return "no pgn";
+    }
+void PmPpnNakRsp::Print() const {
+        std::cout << "PGN: PmPpnNakRsp" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "ParamId      : " << fnGetValue("ParamId") << " (" << fnGetRawValue("ParamId") << ")" << endl;
+    }
+bool PmPpnNakRsp::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmPpnNakRsp::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "ParamId") {
+            return static_cast<uint32_t>(msg.teParamId);
+        }
+        return UINT32_MAX;
+    }
+void PmPpnNakRsp::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ParamId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_N2087867454, value);
+     if (enumValue != -1) msg.teParamId = static_cast<decltype(msg.teParamId)>(enumValue);
+     else msg.teParamId = static_cast<decltype(msg.teParamId)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmPpnNakRsp::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmPpnNakRsp::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmPpnNakRsp::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "ParamId") {
+            return 1.0 * (long double)(msg.teParamId + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmLithionicsCmd
+std::string PmLithionicsCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "Inst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teInst));
+              }
+        }
+        else return "no pgn";
+    }
+void PmLithionicsCmd::Print() const {
+        std::cout << "PGN: PmLithionicsCmd" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+    }
+bool PmLithionicsCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmLithionicsCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.teInst);
+        }
+        return UINT32_MAX;
+    }
+void PmLithionicsCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Inst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teInst = static_cast<decltype(msg.teInst)>(enumValue);
+     else msg.teInst = static_cast<decltype(msg.teInst)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmLithionicsCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmLithionicsCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmLithionicsCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.teInst + 0.0);
+        }
+        return 0.0;
+    }
+
+// PmLithionicsSts
+std::string PmLithionicsSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "MsgId") {
+            if (!ENUMLOOKUP_1546979661.fnContains(msg.teMsgId)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teMsgId);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1546979661.fnText(msg.teMsgId));
+              }
+        }
+        else if (mnem == "Inst") {
+            if (!ENUMLOOKUP_421711928.fnContains(msg.teInst)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teInst);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_421711928.fnText(msg.teInst));
+              }
+        }
+        else if (mnem == "MaxRecTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucMaxRecTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucMaxRecTemp == 0xff) ? "No Data" : (msg.ucMaxRecTemp == 0xfe) ? "Out of range" : (msg.ucMaxRecTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "MinRecTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucMinRecTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucMinRecTemp == 0xff) ? "No Data" : (msg.ucMinRecTemp == 0xfe) ? "Out of range" : (msg.ucMinRecTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "HighVoltageState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teHighVoltageState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHighVoltageState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teHighVoltageState));
+              }
+        }
+        else if (mnem == "ChgSrcDet") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teChgSrcDet)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgSrcDet);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teChgSrcDet));
+              }
+        }
+        else if (mnem == "NeverDieResState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teNeverDieResState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teNeverDieResState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teNeverDieResState));
+              }
+        }
+        else if (mnem == "OptoLoopOpen") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teOptoLoopOpen)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOptoLoopOpen);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teOptoLoopOpen));
+              }
+        }
+        else if (mnem == "ResVoltageRange") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teResVoltageRange)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teResVoltageRange);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teResVoltageRange));
+              }
+        }
+        else if (mnem == "LowVoltageState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teLowVoltageState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLowVoltageState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teLowVoltageState));
+              }
+        }
+        else if (mnem == "BattProtState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teBattProtState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattProtState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teBattProtState));
+              }
+        }
+        else if (mnem == "PwrOffState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.tePwrOffState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePwrOffState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.tePwrOffState));
+              }
+        }
+        else if (mnem == "AuxCntctState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teAuxCntctState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAuxCntctState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teAuxCntctState));
+              }
+        }
+        else if (mnem == "AuxCntctErr") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teAuxCntctErr)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAuxCntctErr);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teAuxCntctErr));
+              }
+        }
+        else if (mnem == "PreChgErr") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.tePreChgErr)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePreChgErr);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.tePreChgErr));
+              }
+        }
+        else if (mnem == "CntctFlutter") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teCntctFlutter)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teCntctFlutter);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teCntctFlutter));
+              }
+        }
+        else if (mnem == "AcPwrPres") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teAcPwrPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAcPwrPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teAcPwrPres));
+              }
+        }
+        else if (mnem == "TsmChgPres") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teTsmChgPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTsmChgPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teTsmChgPres));
+              }
+        }
+        else if (mnem == "TsmChgErr") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teTsmChgErr)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTsmChgErr);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teTsmChgErr));
+              }
+        }
+        else if (mnem == "TempInterSensErr") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teTempInterSensErr)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teTempInterSensErr);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teTempInterSensErr));
+              }
+        }
+        else if (mnem == "AgsrState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teAgsrState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAgsrState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teAgsrState));
+              }
+        }
+        else if (mnem == "HotTempState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teHotTempState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teHotTempState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teHotTempState));
+              }
+        }
+        else if (mnem == "ColdTempState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teColdTempState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teColdTempState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teColdTempState));
+              }
+        }
+        else if (mnem == "AuxIn1State") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teAuxIn1State)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teAuxIn1State);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teAuxIn1State));
+              }
+        }
+        else if (mnem == "ChgDisState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teChgDisState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgDisState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teChgDisState));
+              }
+        }
+        else if (mnem == "OverCurrState") {
+            if (!ENUMLOOKUP_1608161778.fnContains(msg.teOverCurrState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOverCurrState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1608161778.fnText(msg.teOverCurrState));
+              }
+        }
+        else return "no pgn";
+    }
+void PmLithionicsSts::Print() const {
+        std::cout << "PGN: PmLithionicsSts" << std::endl;
+        cout << "MsgId      : " << fnGetValue("MsgId") << " (" << fnGetRawValue("MsgId") << ")" << endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "MaxRecTemp      : " << fnGetValue("MaxRecTemp") << " (" << fnGetRawValue("MaxRecTemp") << ")" << endl;
+        cout << "MinRecTemp      : " << fnGetValue("MinRecTemp") << " (" << fnGetRawValue("MinRecTemp") << ")" << endl;
+        cout << "HighVoltageState      : " << fnGetValue("HighVoltageState") << " (" << fnGetRawValue("HighVoltageState") << ")" << endl;
+        cout << "ChgSrcDet      : " << fnGetValue("ChgSrcDet") << " (" << fnGetRawValue("ChgSrcDet") << ")" << endl;
+        cout << "NeverDieResState      : " << fnGetValue("NeverDieResState") << " (" << fnGetRawValue("NeverDieResState") << ")" << endl;
+        cout << "OptoLoopOpen      : " << fnGetValue("OptoLoopOpen") << " (" << fnGetRawValue("OptoLoopOpen") << ")" << endl;
+        cout << "ResVoltageRange      : " << fnGetValue("ResVoltageRange") << " (" << fnGetRawValue("ResVoltageRange") << ")" << endl;
+        cout << "LowVoltageState      : " << fnGetValue("LowVoltageState") << " (" << fnGetRawValue("LowVoltageState") << ")" << endl;
+        cout << "BattProtState      : " << fnGetValue("BattProtState") << " (" << fnGetRawValue("BattProtState") << ")" << endl;
+        cout << "PwrOffState      : " << fnGetValue("PwrOffState") << " (" << fnGetRawValue("PwrOffState") << ")" << endl;
+        cout << "AuxCntctState      : " << fnGetValue("AuxCntctState") << " (" << fnGetRawValue("AuxCntctState") << ")" << endl;
+        cout << "AuxCntctErr      : " << fnGetValue("AuxCntctErr") << " (" << fnGetRawValue("AuxCntctErr") << ")" << endl;
+        cout << "PreChgErr      : " << fnGetValue("PreChgErr") << " (" << fnGetRawValue("PreChgErr") << ")" << endl;
+        cout << "CntctFlutter      : " << fnGetValue("CntctFlutter") << " (" << fnGetRawValue("CntctFlutter") << ")" << endl;
+        cout << "AcPwrPres      : " << fnGetValue("AcPwrPres") << " (" << fnGetRawValue("AcPwrPres") << ")" << endl;
+        cout << "TsmChgPres      : " << fnGetValue("TsmChgPres") << " (" << fnGetRawValue("TsmChgPres") << ")" << endl;
+        cout << "TsmChgErr      : " << fnGetValue("TsmChgErr") << " (" << fnGetRawValue("TsmChgErr") << ")" << endl;
+        cout << "TempInterSensErr      : " << fnGetValue("TempInterSensErr") << " (" << fnGetRawValue("TempInterSensErr") << ")" << endl;
+        cout << "AgsrState      : " << fnGetValue("AgsrState") << " (" << fnGetRawValue("AgsrState") << ")" << endl;
+        cout << "HotTempState      : " << fnGetValue("HotTempState") << " (" << fnGetRawValue("HotTempState") << ")" << endl;
+        cout << "ColdTempState      : " << fnGetValue("ColdTempState") << " (" << fnGetRawValue("ColdTempState") << ")" << endl;
+        cout << "AuxIn1State      : " << fnGetValue("AuxIn1State") << " (" << fnGetRawValue("AuxIn1State") << ")" << endl;
+        cout << "ChgDisState      : " << fnGetValue("ChgDisState") << " (" << fnGetRawValue("ChgDisState") << ")" << endl;
+        cout << "OverCurrState      : " << fnGetValue("OverCurrState") << " (" << fnGetRawValue("OverCurrState") << ")" << endl;
+    }
+bool PmLithionicsSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 PmLithionicsSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return static_cast<uint32_t>(msg.teMsgId);
+        }
+        else if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.teInst);
+        }
+        else if (mnem == "MaxRecTemp") {
+            return static_cast<uint32_t>(msg.ucMaxRecTemp);
+        }
+        else if (mnem == "MinRecTemp") {
+            return static_cast<uint32_t>(msg.ucMinRecTemp);
+        }
+        else if (mnem == "HighVoltageState") {
+            return static_cast<uint32_t>(msg.teHighVoltageState);
+        }
+        else if (mnem == "ChgSrcDet") {
+            return static_cast<uint32_t>(msg.teChgSrcDet);
+        }
+        else if (mnem == "NeverDieResState") {
+            return static_cast<uint32_t>(msg.teNeverDieResState);
+        }
+        else if (mnem == "OptoLoopOpen") {
+            return static_cast<uint32_t>(msg.teOptoLoopOpen);
+        }
+        else if (mnem == "ResVoltageRange") {
+            return static_cast<uint32_t>(msg.teResVoltageRange);
+        }
+        else if (mnem == "LowVoltageState") {
+            return static_cast<uint32_t>(msg.teLowVoltageState);
+        }
+        else if (mnem == "BattProtState") {
+            return static_cast<uint32_t>(msg.teBattProtState);
+        }
+        else if (mnem == "PwrOffState") {
+            return static_cast<uint32_t>(msg.tePwrOffState);
+        }
+        else if (mnem == "AuxCntctState") {
+            return static_cast<uint32_t>(msg.teAuxCntctState);
+        }
+        else if (mnem == "AuxCntctErr") {
+            return static_cast<uint32_t>(msg.teAuxCntctErr);
+        }
+        else if (mnem == "PreChgErr") {
+            return static_cast<uint32_t>(msg.tePreChgErr);
+        }
+        else if (mnem == "CntctFlutter") {
+            return static_cast<uint32_t>(msg.teCntctFlutter);
+        }
+        else if (mnem == "AcPwrPres") {
+            return static_cast<uint32_t>(msg.teAcPwrPres);
+        }
+        else if (mnem == "TsmChgPres") {
+            return static_cast<uint32_t>(msg.teTsmChgPres);
+        }
+        else if (mnem == "TsmChgErr") {
+            return static_cast<uint32_t>(msg.teTsmChgErr);
+        }
+        else if (mnem == "TempInterSensErr") {
+            return static_cast<uint32_t>(msg.teTempInterSensErr);
+        }
+        else if (mnem == "AgsrState") {
+            return static_cast<uint32_t>(msg.teAgsrState);
+        }
+        else if (mnem == "HotTempState") {
+            return static_cast<uint32_t>(msg.teHotTempState);
+        }
+        else if (mnem == "ColdTempState") {
+            return static_cast<uint32_t>(msg.teColdTempState);
+        }
+        else if (mnem == "AuxIn1State") {
+            return static_cast<uint32_t>(msg.teAuxIn1State);
+        }
+        else if (mnem == "ChgDisState") {
+            return static_cast<uint32_t>(msg.teChgDisState);
+        }
+        else if (mnem == "OverCurrState") {
+            return static_cast<uint32_t>(msg.teOverCurrState);
+        }
+        return UINT32_MAX;
+    }
+void PmLithionicsSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "MsgId") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1546979661, value);
+     if (enumValue != -1) msg.teMsgId = static_cast<decltype(msg.teMsgId)>(enumValue);
+     else msg.teMsgId = static_cast<decltype(msg.teMsgId)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "Inst") {
+     int enumValue = findEnumValue(ENUMLOOKUP_421711928, value);
+     if (enumValue != -1) msg.teInst = static_cast<decltype(msg.teInst)>(enumValue);
+     else msg.teInst = static_cast<decltype(msg.teInst)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "MaxRecTemp") {
+     msg.ucMaxRecTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "MinRecTemp") {
+     msg.ucMinRecTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "HighVoltageState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teHighVoltageState = static_cast<decltype(msg.teHighVoltageState)>(enumValue);
+     else msg.teHighVoltageState = static_cast<decltype(msg.teHighVoltageState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgSrcDet") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teChgSrcDet = static_cast<decltype(msg.teChgSrcDet)>(enumValue);
+     else msg.teChgSrcDet = static_cast<decltype(msg.teChgSrcDet)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "NeverDieResState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teNeverDieResState = static_cast<decltype(msg.teNeverDieResState)>(enumValue);
+     else msg.teNeverDieResState = static_cast<decltype(msg.teNeverDieResState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OptoLoopOpen") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teOptoLoopOpen = static_cast<decltype(msg.teOptoLoopOpen)>(enumValue);
+     else msg.teOptoLoopOpen = static_cast<decltype(msg.teOptoLoopOpen)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ResVoltageRange") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teResVoltageRange = static_cast<decltype(msg.teResVoltageRange)>(enumValue);
+     else msg.teResVoltageRange = static_cast<decltype(msg.teResVoltageRange)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LowVoltageState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teLowVoltageState = static_cast<decltype(msg.teLowVoltageState)>(enumValue);
+     else msg.teLowVoltageState = static_cast<decltype(msg.teLowVoltageState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattProtState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teBattProtState = static_cast<decltype(msg.teBattProtState)>(enumValue);
+     else msg.teBattProtState = static_cast<decltype(msg.teBattProtState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PwrOffState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.tePwrOffState = static_cast<decltype(msg.tePwrOffState)>(enumValue);
+     else msg.tePwrOffState = static_cast<decltype(msg.tePwrOffState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AuxCntctState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teAuxCntctState = static_cast<decltype(msg.teAuxCntctState)>(enumValue);
+     else msg.teAuxCntctState = static_cast<decltype(msg.teAuxCntctState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AuxCntctErr") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teAuxCntctErr = static_cast<decltype(msg.teAuxCntctErr)>(enumValue);
+     else msg.teAuxCntctErr = static_cast<decltype(msg.teAuxCntctErr)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PreChgErr") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.tePreChgErr = static_cast<decltype(msg.tePreChgErr)>(enumValue);
+     else msg.tePreChgErr = static_cast<decltype(msg.tePreChgErr)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "CntctFlutter") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teCntctFlutter = static_cast<decltype(msg.teCntctFlutter)>(enumValue);
+     else msg.teCntctFlutter = static_cast<decltype(msg.teCntctFlutter)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AcPwrPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teAcPwrPres = static_cast<decltype(msg.teAcPwrPres)>(enumValue);
+     else msg.teAcPwrPres = static_cast<decltype(msg.teAcPwrPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TsmChgPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teTsmChgPres = static_cast<decltype(msg.teTsmChgPres)>(enumValue);
+     else msg.teTsmChgPres = static_cast<decltype(msg.teTsmChgPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TsmChgErr") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teTsmChgErr = static_cast<decltype(msg.teTsmChgErr)>(enumValue);
+     else msg.teTsmChgErr = static_cast<decltype(msg.teTsmChgErr)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TempInterSensErr") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teTempInterSensErr = static_cast<decltype(msg.teTempInterSensErr)>(enumValue);
+     else msg.teTempInterSensErr = static_cast<decltype(msg.teTempInterSensErr)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AgsrState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teAgsrState = static_cast<decltype(msg.teAgsrState)>(enumValue);
+     else msg.teAgsrState = static_cast<decltype(msg.teAgsrState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "HotTempState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teHotTempState = static_cast<decltype(msg.teHotTempState)>(enumValue);
+     else msg.teHotTempState = static_cast<decltype(msg.teHotTempState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ColdTempState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teColdTempState = static_cast<decltype(msg.teColdTempState)>(enumValue);
+     else msg.teColdTempState = static_cast<decltype(msg.teColdTempState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "AuxIn1State") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teAuxIn1State = static_cast<decltype(msg.teAuxIn1State)>(enumValue);
+     else msg.teAuxIn1State = static_cast<decltype(msg.teAuxIn1State)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgDisState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teChgDisState = static_cast<decltype(msg.teChgDisState)>(enumValue);
+     else msg.teChgDisState = static_cast<decltype(msg.teChgDisState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "OverCurrState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1608161778, value);
+     if (enumValue != -1) msg.teOverCurrState = static_cast<decltype(msg.teOverCurrState)>(enumValue);
+     else msg.teOverCurrState = static_cast<decltype(msg.teOverCurrState)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void PmLithionicsSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string PmLithionicsSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double PmLithionicsSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "MsgId") {
+            return 1.0 * (long double)(msg.teMsgId + 0.0);
+        }
+        else if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.teInst + 0.0);
+        }
+        else if (mnem == "MaxRecTemp") {
+            return 1.0 * (long double)(msg.ucMaxRecTemp + -40.0);
+        }
+        else if (mnem == "MinRecTemp") {
+            return 1.0 * (long double)(msg.ucMinRecTemp + -40.0);
+        }
+        else if (mnem == "HighVoltageState") {
+            return 1.0 * (long double)(msg.teHighVoltageState + 0.0);
+        }
+        else if (mnem == "ChgSrcDet") {
+            return 1.0 * (long double)(msg.teChgSrcDet + 0.0);
+        }
+        else if (mnem == "NeverDieResState") {
+            return 1.0 * (long double)(msg.teNeverDieResState + 0.0);
+        }
+        else if (mnem == "OptoLoopOpen") {
+            return 1.0 * (long double)(msg.teOptoLoopOpen + 0.0);
+        }
+        else if (mnem == "ResVoltageRange") {
+            return 1.0 * (long double)(msg.teResVoltageRange + 0.0);
+        }
+        else if (mnem == "LowVoltageState") {
+            return 1.0 * (long double)(msg.teLowVoltageState + 0.0);
+        }
+        else if (mnem == "BattProtState") {
+            return 1.0 * (long double)(msg.teBattProtState + 0.0);
+        }
+        else if (mnem == "PwrOffState") {
+            return 1.0 * (long double)(msg.tePwrOffState + 0.0);
+        }
+        else if (mnem == "AuxCntctState") {
+            return 1.0 * (long double)(msg.teAuxCntctState + 0.0);
+        }
+        else if (mnem == "AuxCntctErr") {
+            return 1.0 * (long double)(msg.teAuxCntctErr + 0.0);
+        }
+        else if (mnem == "PreChgErr") {
+            return 1.0 * (long double)(msg.tePreChgErr + 0.0);
+        }
+        else if (mnem == "CntctFlutter") {
+            return 1.0 * (long double)(msg.teCntctFlutter + 0.0);
+        }
+        else if (mnem == "AcPwrPres") {
+            return 1.0 * (long double)(msg.teAcPwrPres + 0.0);
+        }
+        else if (mnem == "TsmChgPres") {
+            return 1.0 * (long double)(msg.teTsmChgPres + 0.0);
+        }
+        else if (mnem == "TsmChgErr") {
+            return 1.0 * (long double)(msg.teTsmChgErr + 0.0);
+        }
+        else if (mnem == "TempInterSensErr") {
+            return 1.0 * (long double)(msg.teTempInterSensErr + 0.0);
+        }
+        else if (mnem == "AgsrState") {
+            return 1.0 * (long double)(msg.teAgsrState + 0.0);
+        }
+        else if (mnem == "HotTempState") {
+            return 1.0 * (long double)(msg.teHotTempState + 0.0);
+        }
+        else if (mnem == "ColdTempState") {
+            return 1.0 * (long double)(msg.teColdTempState + 0.0);
+        }
+        else if (mnem == "AuxIn1State") {
+            return 1.0 * (long double)(msg.teAuxIn1State + 0.0);
+        }
+        else if (mnem == "ChgDisState") {
+            return 1.0 * (long double)(msg.teChgDisState + 0.0);
+        }
+        else if (mnem == "OverCurrState") {
+            return 1.0 * (long double)(msg.teOverCurrState + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_pm_registrars[] = {
+{"PmParamDevMdCfg", [](void * rcv) { return std::make_unique<PmParamDevMdCfg>(rcv); }, []() { return std::make_unique<PmParamDevMdCfg>(); } },
+{"PmParamAssocCfg", [](void * rcv) { return std::make_unique<PmParamAssocCfg>(rcv); }, []() { return std::make_unique<PmParamAssocCfg>(); } },
+{"PmParamAuxCfg", [](void * rcv) { return std::make_unique<PmParamAuxCfg>(rcv); }, []() { return std::make_unique<PmParamAuxCfg>(); } },
+{"PmParamAuxCfgTrigLvl", [](void * rcv) { return std::make_unique<PmParamAuxCfgTrigLvl>(rcv); }, []() { return std::make_unique<PmParamAuxCfgTrigLvl>(); } },
+{"PmParamAuxCfgTrigDly", [](void * rcv) { return std::make_unique<PmParamAuxCfgTrigDly>(rcv); }, []() { return std::make_unique<PmParamAuxCfgTrigDly>(); } },
+{"PmParamAuxSts", [](void * rcv) { return std::make_unique<PmParamAuxSts>(rcv); }, []() { return std::make_unique<PmParamAuxSts>(); } },
+{"PmAssocCfg", [](void * rcv) { return std::make_unique<PmAssocCfg>(rcv); }, []() { return std::make_unique<PmAssocCfg>(); } },
+{"PmReq", [](void * rcv) { return std::make_unique<PmReq>(rcv); }, []() { return std::make_unique<PmReq>(); } },
+{"PmAssocSts", [](void * rcv) { return std::make_unique<PmAssocSts>(rcv); }, []() { return std::make_unique<PmAssocSts>(); } },
+{"PmDevMdCfg", [](void * rcv) { return std::make_unique<PmDevMdCfg>(rcv); }, []() { return std::make_unique<PmDevMdCfg>(); } },
+{"PmFXCCCfgCmd", [](void * rcv) { return std::make_unique<PmFxccCfgCmd>(rcv); }, []() { return std::make_unique<PmFxccCfgCmd>(); } },
+{"PmDevMdSts", [](void * rcv) { return std::make_unique<PmDevMdSts>(rcv); }, []() { return std::make_unique<PmDevMdSts>(); } },
+{"PmFXCCCfgSts", [](void * rcv) { return std::make_unique<PmFxccCfgSts>(rcv); }, []() { return std::make_unique<PmFxccCfgSts>(); } },
+{"PmSwVerSts", [](void * rcv) { return std::make_unique<PmSwVerSts>(rcv); }, []() { return std::make_unique<PmSwVerSts>(); } },
+{"PmRpcCmd", [](void * rcv) { return std::make_unique<PmRpcCmd>(rcv); }, []() { return std::make_unique<PmRpcCmd>(); } },
+{"PmInvLdShSts", [](void * rcv) { return std::make_unique<PmInvLdShSts>(rcv); }, []() { return std::make_unique<PmInvLdShSts>(); } },
+{"PmInvSts", [](void * rcv) { return std::make_unique<PmInvSts>(rcv); }, []() { return std::make_unique<PmInvSts>(); } },
+{"PmChgSts", [](void * rcv) { return std::make_unique<PmChgSts>(rcv); }, []() { return std::make_unique<PmChgSts>(); } },
+{"PmInvCtrlCmd", [](void * rcv) { return std::make_unique<PmInvCtrlCmd>(rcv); }, []() { return std::make_unique<PmInvCtrlCmd>(); } },
+{"PmAcStsRms", [](void * rcv) { return std::make_unique<PmAcStsRms>(rcv); }, []() { return std::make_unique<PmAcStsRms>(); } },
+{"PmAcXferSwSts", [](void * rcv) { return std::make_unique<PmAcXferSwSts>(rcv); }, []() { return std::make_unique<PmAcXferSwSts>(); } },
+{"PmGetConfigParam", [](void * rcv) { return std::make_unique<PmGetConfigParam>(rcv); }, []() { return std::make_unique<PmGetConfigParam>(); } },
+{"PmSetConfigParam", [](void * rcv) { return std::make_unique<PmSetConfigParam>(rcv); }, []() { return std::make_unique<PmSetConfigParam>(); } },
+{"PmGetStatusParam", [](void * rcv) { return std::make_unique<PmGetStatusParam>(rcv); }, []() { return std::make_unique<PmGetStatusParam>(); } },
+{"PmPpnSessionCmd", [](void * rcv) { return std::make_unique<PmPpnSessionCmd>(rcv); }, []() { return std::make_unique<PmPpnSessionCmd>(); } },
+{"PmPpnSessionRsp", [](void * rcv) { return std::make_unique<PmPpnSessionRsp>(rcv); }, []() { return std::make_unique<PmPpnSessionRsp>(); } },
+{"PmPpnReadCmd", [](void * rcv) { return std::make_unique<PmPpnReadCmd>(rcv); }, []() { return std::make_unique<PmPpnReadCmd>(); } },
+{"PmPpnReadRsp", [](void * rcv) { return std::make_unique<PmPpnReadRsp>(rcv); }, []() { return std::make_unique<PmPpnReadRsp>(); } },
+{"PmPpnWriteCmd", [](void * rcv) { return std::make_unique<PmPpnWriteCmd>(rcv); }, []() { return std::make_unique<PmPpnWriteCmd>(); } },
+{"PmPpnWriteRsp", [](void * rcv) { return std::make_unique<PmPpnWriteRsp>(rcv); }, []() { return std::make_unique<PmPpnWriteRsp>(); } },
+{"PmPpnNakRsp", [](void * rcv) { return std::make_unique<PmPpnNakRsp>(rcv); }, []() { return std::make_unique<PmPpnNakRsp>(); } },
+{"PmLithionicsCmd", [](void * rcv) { return std::make_unique<PmLithionicsCmd>(rcv); }, []() { return std::make_unique<PmLithionicsCmd>(); } },
+{"PmLithionicsSts", [](void * rcv) { return std::make_unique<PmLithionicsSts>(rcv); }, []() { return std::make_unique<PmLithionicsSts>(); } },
+};
+static const PrinterRegistrar pgn_pm_printers[] = {
+{59648, 1, fnPrintMessage<PmParamDevMdCfg>},
+{59648, 2, fnPrintMessage<PmParamAssocCfg>},
+{59648, 3, fnPrintMessage<PmParamAuxCfg>},
+{59648, 4, fnPrintMessage<PmParamAuxCfgTrigLvl>},
+{59648, 5, fnPrintMessage<PmParamAuxCfgTrigDly>},
+{59648, 7, fnPrintMessage<PmParamAuxSts>},
+{61184, 1, fnPrintMessage<PmAssocCfg>},
+{61184, 2, fnPrintMessage<PmReq>},
+{61184, 3, fnPrintMessage<PmAssocSts>},
+{61184, 4, fnPrintMessage<PmDevMdCfg>},
+{61184, 5, fnPrintMessage<PmFxccCfgCmd>},
+{61184, 6, fnPrintMessage<PmDevMdSts>},
+{61184, 7, fnPrintMessage<PmFxccCfgSts>},
+{61184, 8, fnPrintMessage<PmSwVerSts>},
+{61184, 9, fnPrintMessage<PmRpcCmd>},
+{61184, 10, fnPrintMessage<PmInvLdShSts>},
+{61184, 11, fnPrintMessage<PmInvSts>},
+{61184, 12, fnPrintMessage<PmChgSts>},
+{61184, 14, fnPrintMessage<PmInvCtrlCmd>},
+{61184, 15, fnPrintMessage<PmAcStsRms>},
+{61184, 16, fnPrintMessage<PmAcXferSwSts>},
+{61184, 17, fnPrintMessage<PmGetConfigParam>},
+{61184, 18, fnPrintMessage<PmSetConfigParam>},
+{61184, 19, fnPrintMessage<PmGetStatusParam>},
+{61184, 96, fnPrintMessage<PmPpnSessionCmd>},
+{61184, 97, fnPrintMessage<PmPpnSessionRsp>},
+{61184, 98, fnPrintMessage<PmPpnReadCmd>},
+{61184, 99, fnPrintMessage<PmPpnReadRsp>},
+{61184, 100, fnPrintMessage<PmPpnWriteCmd>},
+{61184, 101, fnPrintMessage<PmPpnWriteRsp>},
+{61184, 127, fnPrintMessage<PmPpnNakRsp>},
+{61184, 170, fnPrintMessage<PmLithionicsCmd>},
+{61184, 171, fnPrintMessage<PmLithionicsSts>},
+};
@@ -0,0 +1,2488 @@
+// Auto-generated by generate_print_functions.py: scc message classes
+#include "print_functions3.h"
+
+// SccCfgCmd5
+std::string SccCfgCmd5::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgPrio") {
+            return std::to_string(msg.ucChgPrio);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtTempOtSdThresh + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucExtTempOtSdThresh == 0xff) ? "No Data" : (msg.ucExtTempOtSdThresh == 0xfe) ? "Out of range" : (msg.ucExtTempOtSdThresh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtTempUtSdThresh + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucExtTempUtSdThresh == 0xff) ? "No Data" : (msg.ucExtTempUtSdThresh == 0xfe) ? "Out of range" : (msg.ucExtTempUtSdThresh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgCmd5::Print() const {
+        std::cout << "PGN: SccCfgCmd5" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgPrio      : " << fnGetValue("ChgPrio") << " (" << fnGetRawValue("ChgPrio") << ")" << endl;
+        cout << "ExtTempOtSdThresh      : " << fnGetValue("ExtTempOtSdThresh") << " (" << fnGetRawValue("ExtTempOtSdThresh") << ")" << endl;
+        cout << "ExtTempUtSdThresh      : " << fnGetValue("ExtTempUtSdThresh") << " (" << fnGetRawValue("ExtTempUtSdThresh") << ")" << endl;
+    }
+bool SccCfgCmd5::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgCmd5::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgPrio") {
+            return static_cast<uint32_t>(msg.ucChgPrio);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+            return static_cast<uint32_t>(msg.ucExtTempOtSdThresh);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+            return static_cast<uint32_t>(msg.ucExtTempUtSdThresh);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgCmd5::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ChgPrio") {
+     msg.ucChgPrio = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+     msg.ucExtTempOtSdThresh = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+     msg.ucExtTempUtSdThresh = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void SccCfgCmd5::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgCmd5::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccCfgCmd5::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgPrio") {
+            return 1.0 * (long double)(msg.ucChgPrio + 0.0);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+            return 1.0 * (long double)(msg.ucExtTempOtSdThresh + -40.0);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+            return 1.0 * (long double)(msg.ucExtTempUtSdThresh + -40.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgSts5
+std::string SccCfgSts5::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgPrio") {
+            return std::to_string(msg.ucChgPrio);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtTempOtSdThresh + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucExtTempOtSdThresh == 0xff) ? "No Data" : (msg.ucExtTempOtSdThresh == 0xfe) ? "Out of range" : (msg.ucExtTempOtSdThresh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucExtTempUtSdThresh + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucExtTempUtSdThresh == 0xff) ? "No Data" : (msg.ucExtTempUtSdThresh == 0xfe) ? "Out of range" : (msg.ucExtTempUtSdThresh == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgSts5::Print() const {
+        std::cout << "PGN: SccCfgSts5" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgPrio      : " << fnGetValue("ChgPrio") << " (" << fnGetRawValue("ChgPrio") << ")" << endl;
+        cout << "ExtTempOtSdThresh      : " << fnGetValue("ExtTempOtSdThresh") << " (" << fnGetRawValue("ExtTempOtSdThresh") << ")" << endl;
+        cout << "ExtTempUtSdThresh      : " << fnGetValue("ExtTempUtSdThresh") << " (" << fnGetRawValue("ExtTempUtSdThresh") << ")" << endl;
+    }
+bool SccCfgSts5::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgSts5::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgPrio") {
+            return static_cast<uint32_t>(msg.ucChgPrio);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+            return static_cast<uint32_t>(msg.ucExtTempOtSdThresh);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+            return static_cast<uint32_t>(msg.ucExtTempUtSdThresh);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgSts5::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ChgPrio") {
+     msg.ucChgPrio = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+     msg.ucExtTempOtSdThresh = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+     msg.ucExtTempUtSdThresh = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void SccCfgSts5::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgSts5::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccCfgSts5::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgPrio") {
+            return 1.0 * (long double)(msg.ucChgPrio + 0.0);
+        }
+        else if (mnem == "ExtTempOtSdThresh") {
+            return 1.0 * (long double)(msg.ucExtTempOtSdThresh + -40.0);
+        }
+        else if (mnem == "ExtTempUtSdThresh") {
+            return 1.0 * (long double)(msg.ucExtTempUtSdThresh + -40.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgCmd4
+std::string SccCfgCmd4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BattOvRetV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattOvRetV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattOvRetV == 0xffff) ? "No Data" : (msg.uiBattOvRetV == 0xfffe) ? "Out of range" : (msg.uiBattOvRetV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattUvRetV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattUvRetV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattUvRetV == 0xffff) ? "No Data" : (msg.uiBattUvRetV == 0xfffe) ? "Out of range" : (msg.uiBattUvRetV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattUvDly") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucBattUvDly + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucBattUvDly == 0xff) ? "No Data" : (msg.ucBattUvDly == 0xfe) ? "Out of range" : (msg.ucBattUvDly == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AbsorpTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucAbsorpTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "minutes");
+            return (msg.ucAbsorpTime == 0xff) ? "No Data" : (msg.ucAbsorpTime == 0xfe) ? "Out of range" : (msg.ucAbsorpTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TempCompConst") {
+            return std::to_string(msg.ucTempCompConst);
+        }
+        else return "no pgn";
+    }
+void SccCfgCmd4::Print() const {
+        std::cout << "PGN: SccCfgCmd4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BattOvRetV      : " << fnGetValue("BattOvRetV") << " (" << fnGetRawValue("BattOvRetV") << ")" << endl;
+        cout << "BattUvRetV      : " << fnGetValue("BattUvRetV") << " (" << fnGetRawValue("BattUvRetV") << ")" << endl;
+        cout << "BattUvDly      : " << fnGetValue("BattUvDly") << " (" << fnGetRawValue("BattUvDly") << ")" << endl;
+        cout << "AbsorpTime      : " << fnGetValue("AbsorpTime") << " (" << fnGetRawValue("AbsorpTime") << ")" << endl;
+        cout << "TempCompConst      : " << fnGetValue("TempCompConst") << " (" << fnGetRawValue("TempCompConst") << ")" << endl;
+    }
+bool SccCfgCmd4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgCmd4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BattOvRetV") {
+            return static_cast<uint32_t>(msg.uiBattOvRetV);
+        }
+        else if (mnem == "BattUvRetV") {
+            return static_cast<uint32_t>(msg.uiBattUvRetV);
+        }
+        else if (mnem == "BattUvDly") {
+            return static_cast<uint32_t>(msg.ucBattUvDly);
+        }
+        else if (mnem == "AbsorpTime") {
+            return static_cast<uint32_t>(msg.ucAbsorpTime);
+        }
+        else if (mnem == "TempCompConst") {
+            return static_cast<uint32_t>(msg.ucTempCompConst);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgCmd4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BattOvRetV") {
+     msg.uiBattOvRetV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattUvRetV") {
+     msg.uiBattUvRetV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattUvDly") {
+     msg.ucBattUvDly = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+     msg.ucAbsorpTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+     msg.ucTempCompConst = stringToInt(value, 0, 0, 0);
+        }
+    }
+void SccCfgCmd4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgCmd4::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnTempComp2Cmd") return fnTempComp2Cmd(param_value);
+ return "";     };
+long double SccCfgCmd4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BattOvRetV") {
+            return 0.05000000074505806 * (long double)(msg.uiBattOvRetV + 0.0);
+        }
+        else if (mnem == "BattUvRetV") {
+            return 0.05000000074505806 * (long double)(msg.uiBattUvRetV + 0.0);
+        }
+        else if (mnem == "BattUvDly") {
+            return 1.0 * (long double)(msg.ucBattUvDly + 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+            return 1.0 * (long double)(msg.ucAbsorpTime + 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+            return 1.0 * (long double)(msg.ucTempCompConst + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgSts4
+std::string SccCfgSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BattOvRetV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattOvRetV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattOvRetV == 0xffff) ? "No Data" : (msg.uiBattOvRetV == 0xfffe) ? "Out of range" : (msg.uiBattOvRetV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattUvRetV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattUvRetV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattUvRetV == 0xffff) ? "No Data" : (msg.uiBattUvRetV == 0xfffe) ? "Out of range" : (msg.uiBattUvRetV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattUvDly") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucBattUvDly + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "s");
+            return (msg.ucBattUvDly == 0xff) ? "No Data" : (msg.ucBattUvDly == 0xfe) ? "Out of range" : (msg.ucBattUvDly == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "AbsorpTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucAbsorpTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "minutes");
+            return (msg.ucAbsorpTime == 0xff) ? "No Data" : (msg.ucAbsorpTime == 0xfe) ? "Out of range" : (msg.ucAbsorpTime == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "TempCompConst") {
+            return std::to_string(msg.ucTempCompConst);
+        }
+        else return "no pgn";
+    }
+void SccCfgSts4::Print() const {
+        std::cout << "PGN: SccCfgSts4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BattOvRetV      : " << fnGetValue("BattOvRetV") << " (" << fnGetRawValue("BattOvRetV") << ")" << endl;
+        cout << "BattUvRetV      : " << fnGetValue("BattUvRetV") << " (" << fnGetRawValue("BattUvRetV") << ")" << endl;
+        cout << "BattUvDly      : " << fnGetValue("BattUvDly") << " (" << fnGetRawValue("BattUvDly") << ")" << endl;
+        cout << "AbsorpTime      : " << fnGetValue("AbsorpTime") << " (" << fnGetRawValue("AbsorpTime") << ")" << endl;
+        cout << "TempCompConst      : " << fnGetValue("TempCompConst") << " (" << fnGetRawValue("TempCompConst") << ")" << endl;
+    }
+bool SccCfgSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BattOvRetV") {
+            return static_cast<uint32_t>(msg.uiBattOvRetV);
+        }
+        else if (mnem == "BattUvRetV") {
+            return static_cast<uint32_t>(msg.uiBattUvRetV);
+        }
+        else if (mnem == "BattUvDly") {
+            return static_cast<uint32_t>(msg.ucBattUvDly);
+        }
+        else if (mnem == "AbsorpTime") {
+            return static_cast<uint32_t>(msg.ucAbsorpTime);
+        }
+        else if (mnem == "TempCompConst") {
+            return static_cast<uint32_t>(msg.ucTempCompConst);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BattOvRetV") {
+     msg.uiBattOvRetV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattUvRetV") {
+     msg.uiBattUvRetV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattUvDly") {
+     msg.ucBattUvDly = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+     msg.ucAbsorpTime = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+     msg.ucTempCompConst = stringToInt(value, 0, 0, 0);
+        }
+    }
+void SccCfgSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgSts4::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnSts2TempComp") return fnSts2TempComp(param_value);
+ return "";     };
+long double SccCfgSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BattOvRetV") {
+            return 0.05000000074505806 * (long double)(msg.uiBattOvRetV + 0.0);
+        }
+        else if (mnem == "BattUvRetV") {
+            return 0.05000000074505806 * (long double)(msg.uiBattUvRetV + 0.0);
+        }
+        else if (mnem == "BattUvDly") {
+            return 1.0 * (long double)(msg.ucBattUvDly + 0.0);
+        }
+        else if (mnem == "AbsorpTime") {
+            return 1.0 * (long double)(msg.ucAbsorpTime + 0.0);
+        }
+        else if (mnem == "TempCompConst") {
+            return 1.0 * (long double)(msg.ucTempCompConst + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgCmd3
+std::string SccCfgCmd3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattUvWarnThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattUvWarnThresh == 0xffff) ? "No Data" : (msg.uiBattUvWarnThresh == 0xfffe) ? "Out of range" : (msg.uiBattUvWarnThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattOvSdThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattOvSdThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattOvSdThresh == 0xffff) ? "No Data" : (msg.uiBattOvSdThresh == 0xfffe) ? "Out of range" : (msg.uiBattOvSdThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattUvSdThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattUvSdThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattUvSdThresh == 0xffff) ? "No Data" : (msg.uiBattUvSdThresh == 0xfffe) ? "Out of range" : (msg.uiBattUvSdThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgCmd3::Print() const {
+        std::cout << "PGN: SccCfgCmd3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BattUvWarnThresh      : " << fnGetValue("BattUvWarnThresh") << " (" << fnGetRawValue("BattUvWarnThresh") << ")" << endl;
+        cout << "BattOvSdThresh      : " << fnGetValue("BattOvSdThresh") << " (" << fnGetRawValue("BattOvSdThresh") << ")" << endl;
+        cout << "BattUvSdThresh      : " << fnGetValue("BattUvSdThresh") << " (" << fnGetRawValue("BattUvSdThresh") << ")" << endl;
+    }
+bool SccCfgCmd3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgCmd3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+            return static_cast<uint32_t>(msg.uiBattUvWarnThresh);
+        }
+        else if (mnem == "BattOvSdThresh") {
+            return static_cast<uint32_t>(msg.uiBattOvSdThresh);
+        }
+        else if (mnem == "BattUvSdThresh") {
+            return static_cast<uint32_t>(msg.uiBattUvSdThresh);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgCmd3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+     msg.uiBattUvWarnThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattOvSdThresh") {
+     msg.uiBattOvSdThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattUvSdThresh") {
+     msg.uiBattUvSdThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void SccCfgCmd3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgCmd3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccCfgCmd3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiBattUvWarnThresh + 0.0);
+        }
+        else if (mnem == "BattOvSdThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiBattOvSdThresh + 0.0);
+        }
+        else if (mnem == "BattUvSdThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiBattUvSdThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgSts3
+std::string SccCfgSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattUvWarnThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattUvWarnThresh == 0xffff) ? "No Data" : (msg.uiBattUvWarnThresh == 0xfffe) ? "Out of range" : (msg.uiBattUvWarnThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattOvSdThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattOvSdThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattOvSdThresh == 0xffff) ? "No Data" : (msg.uiBattOvSdThresh == 0xfffe) ? "Out of range" : (msg.uiBattOvSdThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattUvSdThresh") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattUvSdThresh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattUvSdThresh == 0xffff) ? "No Data" : (msg.uiBattUvSdThresh == 0xfffe) ? "Out of range" : (msg.uiBattUvSdThresh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgSts3::Print() const {
+        std::cout << "PGN: SccCfgSts3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BattUvWarnThresh      : " << fnGetValue("BattUvWarnThresh") << " (" << fnGetRawValue("BattUvWarnThresh") << ")" << endl;
+        cout << "BattOvSdThresh      : " << fnGetValue("BattOvSdThresh") << " (" << fnGetRawValue("BattOvSdThresh") << ")" << endl;
+        cout << "BattUvSdThresh      : " << fnGetValue("BattUvSdThresh") << " (" << fnGetRawValue("BattUvSdThresh") << ")" << endl;
+    }
+bool SccCfgSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+            return static_cast<uint32_t>(msg.uiBattUvWarnThresh);
+        }
+        else if (mnem == "BattOvSdThresh") {
+            return static_cast<uint32_t>(msg.uiBattOvSdThresh);
+        }
+        else if (mnem == "BattUvSdThresh") {
+            return static_cast<uint32_t>(msg.uiBattUvSdThresh);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+     msg.uiBattUvWarnThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattOvSdThresh") {
+     msg.uiBattOvSdThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattUvSdThresh") {
+     msg.uiBattUvSdThresh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void SccCfgSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccCfgSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BattUvWarnThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiBattUvWarnThresh + 0.0);
+        }
+        else if (mnem == "BattOvSdThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiBattOvSdThresh + 0.0);
+        }
+        else if (mnem == "BattUvSdThresh") {
+            return 0.05000000074505806 * (long double)(msg.uiBattUvSdThresh + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgCmd2
+std::string SccCfgCmd2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBulkV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBulkV == 0xffff) ? "No Data" : (msg.uiBulkV == 0xfffe) ? "Out of range" : (msg.uiBulkV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FloatV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiFloatV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiFloatV == 0xffff) ? "No Data" : (msg.uiFloatV == 0xfffe) ? "Out of range" : (msg.uiFloatV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgRetV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgRetV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiChgRetV == 0xffff) ? "No Data" : (msg.uiChgRetV == 0xfffe) ? "Out of range" : (msg.uiChgRetV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgCmd2::Print() const {
+        std::cout << "PGN: SccCfgCmd2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BulkV      : " << fnGetValue("BulkV") << " (" << fnGetRawValue("BulkV") << ")" << endl;
+        cout << "FloatV      : " << fnGetValue("FloatV") << " (" << fnGetRawValue("FloatV") << ")" << endl;
+        cout << "ChgRetV      : " << fnGetValue("ChgRetV") << " (" << fnGetRawValue("ChgRetV") << ")" << endl;
+    }
+bool SccCfgCmd2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgCmd2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            return static_cast<uint32_t>(msg.uiBulkV);
+        }
+        else if (mnem == "FloatV") {
+            return static_cast<uint32_t>(msg.uiFloatV);
+        }
+        else if (mnem == "ChgRetV") {
+            return static_cast<uint32_t>(msg.uiChgRetV);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgCmd2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BulkV") {
+     msg.uiBulkV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "FloatV") {
+     msg.uiFloatV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "ChgRetV") {
+     msg.uiChgRetV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void SccCfgCmd2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgCmd2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccCfgCmd2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BulkV") {
+            return 0.05000000074505806 * (long double)(msg.uiBulkV + 0.0);
+        }
+        else if (mnem == "FloatV") {
+            return 0.05000000074505806 * (long double)(msg.uiFloatV + 0.0);
+        }
+        else if (mnem == "ChgRetV") {
+            return 0.05000000074505806 * (long double)(msg.uiChgRetV + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgSts2
+std::string SccCfgSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBulkV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBulkV == 0xffff) ? "No Data" : (msg.uiBulkV == 0xfffe) ? "Out of range" : (msg.uiBulkV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "FloatV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiFloatV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiFloatV == 0xffff) ? "No Data" : (msg.uiFloatV == 0xfffe) ? "Out of range" : (msg.uiFloatV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgRetV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgRetV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiChgRetV == 0xffff) ? "No Data" : (msg.uiChgRetV == 0xfffe) ? "Out of range" : (msg.uiChgRetV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgSts2::Print() const {
+        std::cout << "PGN: SccCfgSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "BulkV      : " << fnGetValue("BulkV") << " (" << fnGetRawValue("BulkV") << ")" << endl;
+        cout << "FloatV      : " << fnGetValue("FloatV") << " (" << fnGetRawValue("FloatV") << ")" << endl;
+        cout << "ChgRetV      : " << fnGetValue("ChgRetV") << " (" << fnGetRawValue("ChgRetV") << ")" << endl;
+    }
+bool SccCfgSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "BulkV") {
+            return static_cast<uint32_t>(msg.uiBulkV);
+        }
+        else if (mnem == "FloatV") {
+            return static_cast<uint32_t>(msg.uiFloatV);
+        }
+        else if (mnem == "ChgRetV") {
+            return static_cast<uint32_t>(msg.uiChgRetV);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BulkV") {
+     msg.uiBulkV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "FloatV") {
+     msg.uiFloatV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "ChgRetV") {
+     msg.uiChgRetV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+    }
+void SccCfgSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccCfgSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "BulkV") {
+            return 0.05000000074505806 * (long double)(msg.uiBulkV + 0.0);
+        }
+        else if (mnem == "FloatV") {
+            return 0.05000000074505806 * (long double)(msg.uiFloatV + 0.0);
+        }
+        else if (mnem == "ChgRetV") {
+            return 0.05000000074505806 * (long double)(msg.uiChgRetV + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccArraySts
+std::string SccArraySts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ArrayV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiArrayV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiArrayV == 0xffff) ? "No Data" : (msg.uiArrayV == 0xfffe) ? "Out of range" : (msg.uiArrayV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ArrayI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiArrayI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiArrayI == 0xffff) ? "No Data" : (msg.uiArrayI == 0xfffe) ? "Out of range" : (msg.uiArrayI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccArraySts::Print() const {
+        std::cout << "PGN: SccArraySts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ArrayV      : " << fnGetValue("ArrayV") << " (" << fnGetRawValue("ArrayV") << ")" << endl;
+        cout << "ArrayI      : " << fnGetValue("ArrayI") << " (" << fnGetRawValue("ArrayI") << ")" << endl;
+    }
+bool SccArraySts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccArraySts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ArrayV") {
+            return static_cast<uint32_t>(msg.uiArrayV);
+        }
+        else if (mnem == "ArrayI") {
+            return static_cast<uint32_t>(msg.uiArrayI);
+        }
+        return UINT32_MAX;
+    }
+void SccArraySts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ArrayV") {
+     msg.uiArrayV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "ArrayI") {
+     msg.uiArrayI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+    }
+void SccArraySts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccArraySts::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnPvArrayPower") return fnPvArrayPower(param_value);
+ return "";     };
+long double SccArraySts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ArrayV") {
+            return 0.05000000074505806 * (long double)(msg.uiArrayV + 0.0);
+        }
+        else if (mnem == "ArrayI") {
+            return 0.05000000074505806 * (long double)(msg.uiArrayI + -32000.0);
+        }
+        return 0.0;
+    }
+
+// SccBattSts
+std::string SccBattSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "DcSrcInst") {
+            return std::to_string(msg.ucDcSrcInst);
+        }
+        else if (mnem == "ChgPriority") {
+            return std::to_string(msg.ucChgPriority);
+        }
+        else if (mnem == "BattVolts") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattVolts + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiBattVolts == 0xffff) ? "No Data" : (msg.uiBattVolts == 0xfffe) ? "Out of range" : (msg.uiBattVolts == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattCurrent") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiBattCurrent + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiBattCurrent == 0xffff) ? "No Data" : (msg.uiBattCurrent == 0xfffe) ? "Out of range" : (msg.uiBattCurrent == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BattTemp") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucBattTemp + -40.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "deg C");
+            return (msg.ucBattTemp == 0xff) ? "No Data" : (msg.ucBattTemp == 0xfe) ? "Out of range" : (msg.ucBattTemp == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccBattSts::Print() const {
+        std::cout << "PGN: SccBattSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "DcSrcInst      : " << fnGetValue("DcSrcInst") << " (" << fnGetRawValue("DcSrcInst") << ")" << endl;
+        cout << "ChgPriority      : " << fnGetValue("ChgPriority") << " (" << fnGetRawValue("ChgPriority") << ")" << endl;
+        cout << "BattVolts      : " << fnGetValue("BattVolts") << " (" << fnGetRawValue("BattVolts") << ")" << endl;
+        cout << "BattCurrent      : " << fnGetValue("BattCurrent") << " (" << fnGetRawValue("BattCurrent") << ")" << endl;
+        cout << "BattTemp      : " << fnGetValue("BattTemp") << " (" << fnGetRawValue("BattTemp") << ")" << endl;
+    }
+bool SccBattSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccBattSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "DcSrcInst") {
+            return static_cast<uint32_t>(msg.ucDcSrcInst);
+        }
+        else if (mnem == "ChgPriority") {
+            return static_cast<uint32_t>(msg.ucChgPriority);
+        }
+        else if (mnem == "BattVolts") {
+            return static_cast<uint32_t>(msg.uiBattVolts);
+        }
+        else if (mnem == "BattCurrent") {
+            return static_cast<uint32_t>(msg.uiBattCurrent);
+        }
+        else if (mnem == "BattTemp") {
+            return static_cast<uint32_t>(msg.ucBattTemp);
+        }
+        return UINT32_MAX;
+    }
+void SccBattSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "DcSrcInst") {
+     msg.ucDcSrcInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ChgPriority") {
+     msg.ucChgPriority = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "BattVolts") {
+     msg.uiBattVolts = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "BattCurrent") {
+     msg.uiBattCurrent = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "BattTemp") {
+     msg.ucBattTemp = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, -40.0);
+        }
+    }
+void SccBattSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccBattSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccBattSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "DcSrcInst") {
+            return 1.0 * (long double)(msg.ucDcSrcInst + 0.0);
+        }
+        else if (mnem == "ChgPriority") {
+            return 1.0 * (long double)(msg.ucChgPriority + 0.0);
+        }
+        else if (mnem == "BattVolts") {
+            return 0.05000000074505806 * (long double)(msg.uiBattVolts + 0.0);
+        }
+        else if (mnem == "BattCurrent") {
+            return 0.05000000074505806 * (long double)(msg.uiBattCurrent + -32000.0);
+        }
+        else if (mnem == "BattTemp") {
+            return 1.0 * (long double)(msg.ucBattTemp + -40.0);
+        }
+        return 0.0;
+    }
+
+// SccSts6
+std::string SccSts6::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "OperatingDays") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiOperatingDays + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "days");
+            return (msg.uiOperatingDays == 0xffff) ? "No Data" : (msg.uiOperatingDays == 0xfffe) ? "Out of range" : (msg.uiOperatingDays == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "IntTemp") {
+            char buffer[50];
+            auto engval = 0.03125 * (long double) (msg.uiIntTemp + -8736.0);
+            snprintf(buffer, sizeof(buffer), "%.2f %s", engval, "deg C");
+            return (msg.uiIntTemp == 0xffff) ? "No Data" : (msg.uiIntTemp == 0xfffe) ? "Out of range" : (msg.uiIntTemp == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccSts6::Print() const {
+        std::cout << "PGN: SccSts6" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "OperatingDays      : " << fnGetValue("OperatingDays") << " (" << fnGetRawValue("OperatingDays") << ")" << endl;
+        cout << "IntTemp      : " << fnGetValue("IntTemp") << " (" << fnGetRawValue("IntTemp") << ")" << endl;
+    }
+bool SccSts6::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccSts6::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "OperatingDays") {
+            return static_cast<uint32_t>(msg.uiOperatingDays);
+        }
+        else if (mnem == "IntTemp") {
+            return static_cast<uint32_t>(msg.uiIntTemp);
+        }
+        return UINT32_MAX;
+    }
+void SccSts6::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "OperatingDays") {
+     msg.uiOperatingDays = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "IntTemp") {
+     msg.uiIntTemp = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.03125, -8736.0);
+        }
+    }
+void SccSts6::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccSts6::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccSts6::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "OperatingDays") {
+            return 1.0 * (long double)(msg.uiOperatingDays + 0.0);
+        }
+        else if (mnem == "IntTemp") {
+            return 0.03125 * (long double)(msg.uiIntTemp + -8736.0);
+        }
+        return 0.0;
+    }
+
+// SccSts5
+std::string SccSts5::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "WeekAh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiWeekAh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiWeekAh == 0xffff) ? "No Data" : (msg.uiWeekAh == 0xfffe) ? "Out of range" : (msg.uiWeekAh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "CumPwrGen") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ulCumPwrGen + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "kWh");
+            return (msg.ulCumPwrGen == 0xffffffff) ? "No Data" : (msg.ulCumPwrGen == 0xfffffffe) ? "Out of range" : (msg.ulCumPwrGen == 0xfffffffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccSts5::Print() const {
+        std::cout << "PGN: SccSts5" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "WeekAh      : " << fnGetValue("WeekAh") << " (" << fnGetRawValue("WeekAh") << ")" << endl;
+        cout << "CumPwrGen      : " << fnGetValue("CumPwrGen") << " (" << fnGetRawValue("CumPwrGen") << ")" << endl;
+    }
+bool SccSts5::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccSts5::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "WeekAh") {
+            return static_cast<uint32_t>(msg.uiWeekAh);
+        }
+        else if (mnem == "CumPwrGen") {
+            return static_cast<uint32_t>(msg.ulCumPwrGen);
+        }
+        return UINT32_MAX;
+    }
+void SccSts5::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "WeekAh") {
+     msg.uiWeekAh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "CumPwrGen") {
+     msg.ulCumPwrGen = stringToInt(value, 0xffffffff, 0xfffffffe, 0xfffffffd, 1.0, 0.0);
+        }
+    }
+void SccSts5::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccSts5::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccSts5::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "WeekAh") {
+            return 1.0 * (long double)(msg.uiWeekAh + 0.0);
+        }
+        else if (mnem == "CumPwrGen") {
+            return 1.0 * (long double)(msg.ulCumPwrGen + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccSts4
+std::string SccSts4::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "TodayAh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiTodayAh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiTodayAh == 0xffff) ? "No Data" : (msg.uiTodayAh == 0xfffe) ? "Out of range" : (msg.uiTodayAh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "YesterdayAh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiYesterdayAh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiYesterdayAh == 0xffff) ? "No Data" : (msg.uiYesterdayAh == 0xfffe) ? "Out of range" : (msg.uiYesterdayAh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "BeforeYesterdayAh") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBeforeYesterdayAh + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiBeforeYesterdayAh == 0xffff) ? "No Data" : (msg.uiBeforeYesterdayAh == 0xfffe) ? "Out of range" : (msg.uiBeforeYesterdayAh == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccSts4::Print() const {
+        std::cout << "PGN: SccSts4" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "TodayAh      : " << fnGetValue("TodayAh") << " (" << fnGetRawValue("TodayAh") << ")" << endl;
+        cout << "YesterdayAh      : " << fnGetValue("YesterdayAh") << " (" << fnGetRawValue("YesterdayAh") << ")" << endl;
+        cout << "BeforeYesterdayAh      : " << fnGetValue("BeforeYesterdayAh") << " (" << fnGetRawValue("BeforeYesterdayAh") << ")" << endl;
+    }
+bool SccSts4::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccSts4::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "TodayAh") {
+            return static_cast<uint32_t>(msg.uiTodayAh);
+        }
+        else if (mnem == "YesterdayAh") {
+            return static_cast<uint32_t>(msg.uiYesterdayAh);
+        }
+        else if (mnem == "BeforeYesterdayAh") {
+            return static_cast<uint32_t>(msg.uiBeforeYesterdayAh);
+        }
+        return UINT32_MAX;
+    }
+void SccSts4::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "TodayAh") {
+     msg.uiTodayAh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "YesterdayAh") {
+     msg.uiYesterdayAh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "BeforeYesterdayAh") {
+     msg.uiBeforeYesterdayAh = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void SccSts4::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccSts4::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccSts4::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "TodayAh") {
+            return 1.0 * (long double)(msg.uiTodayAh + 0.0);
+        }
+        else if (mnem == "YesterdayAh") {
+            return 1.0 * (long double)(msg.uiYesterdayAh + 0.0);
+        }
+        else if (mnem == "BeforeYesterdayAh") {
+            return 1.0 * (long double)(msg.uiBeforeYesterdayAh + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccSts3
+std::string SccSts3::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "RatedPvV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRatedPvV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiRatedPvV == 0xffff) ? "No Data" : (msg.uiRatedPvV == 0xfffe) ? "Out of range" : (msg.uiRatedPvV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "RatedPvI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRatedPvI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiRatedPvI == 0xffff) ? "No Data" : (msg.uiRatedPvI == 0xfffe) ? "Out of range" : (msg.uiRatedPvI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "RatedPvOverPwr") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiRatedPvOverPwr + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "W");
+            return (msg.uiRatedPvOverPwr == 0xffff) ? "No Data" : (msg.uiRatedPvOverPwr == 0xfffe) ? "Out of range" : (msg.uiRatedPvOverPwr == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccSts3::Print() const {
+        std::cout << "PGN: SccSts3" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "RatedPvV      : " << fnGetValue("RatedPvV") << " (" << fnGetRawValue("RatedPvV") << ")" << endl;
+        cout << "RatedPvI      : " << fnGetValue("RatedPvI") << " (" << fnGetRawValue("RatedPvI") << ")" << endl;
+        cout << "RatedPvOverPwr      : " << fnGetValue("RatedPvOverPwr") << " (" << fnGetRawValue("RatedPvOverPwr") << ")" << endl;
+    }
+bool SccSts3::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccSts3::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "RatedPvV") {
+            return static_cast<uint32_t>(msg.uiRatedPvV);
+        }
+        else if (mnem == "RatedPvI") {
+            return static_cast<uint32_t>(msg.uiRatedPvI);
+        }
+        else if (mnem == "RatedPvOverPwr") {
+            return static_cast<uint32_t>(msg.uiRatedPvOverPwr);
+        }
+        return UINT32_MAX;
+    }
+void SccSts3::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "RatedPvV") {
+     msg.uiRatedPvV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "RatedPvI") {
+     msg.uiRatedPvI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "RatedPvOverPwr") {
+     msg.uiRatedPvOverPwr = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+    }
+void SccSts3::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccSts3::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccSts3::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "RatedPvV") {
+            return 0.05000000074505806 * (long double)(msg.uiRatedPvV + 0.0);
+        }
+        else if (mnem == "RatedPvI") {
+            return 0.05000000074505806 * (long double)(msg.uiRatedPvI + -32000.0);
+        }
+        else if (mnem == "RatedPvOverPwr") {
+            return 1.0 * (long double)(msg.uiRatedPvOverPwr + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccSts2
+std::string SccSts2::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "RatedBattV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRatedBattV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiRatedBattV == 0xffff) ? "No Data" : (msg.uiRatedBattV == 0xfffe) ? "Out of range" : (msg.uiRatedBattV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "RatedBattI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiRatedBattI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiRatedBattI == 0xffff) ? "No Data" : (msg.uiRatedBattI == 0xfffe) ? "Out of range" : (msg.uiRatedBattI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccSts2::Print() const {
+        std::cout << "PGN: SccSts2" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "RatedBattV      : " << fnGetValue("RatedBattV") << " (" << fnGetRawValue("RatedBattV") << ")" << endl;
+        cout << "RatedBattI      : " << fnGetValue("RatedBattI") << " (" << fnGetRawValue("RatedBattI") << ")" << endl;
+    }
+bool SccSts2::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccSts2::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "RatedBattV") {
+            return static_cast<uint32_t>(msg.uiRatedBattV);
+        }
+        else if (mnem == "RatedBattI") {
+            return static_cast<uint32_t>(msg.uiRatedBattI);
+        }
+        return UINT32_MAX;
+    }
+void SccSts2::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "RatedBattV") {
+     msg.uiRatedBattV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "RatedBattI") {
+     msg.uiRatedBattI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+    }
+void SccSts2::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccSts2::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccSts2::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "RatedBattV") {
+            return 0.05000000074505806 * (long double)(msg.uiRatedBattV + 0.0);
+        }
+        else if (mnem == "RatedBattI") {
+            return 0.05000000074505806 * (long double)(msg.uiRatedBattI + -32000.0);
+        }
+        return 0.0;
+    }
+
+// SccEqlzCfgCmd
+std::string SccEqlzCfgCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiEqlzV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiEqlzV == 0xffff) ? "No Data" : (msg.uiEqlzV == 0xfffe) ? "Out of range" : (msg.uiEqlzV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EqlzTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiEqlzTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiEqlzTime == 0xffff) ? "No Data" : (msg.uiEqlzTime == 0xfffe) ? "Out of range" : (msg.uiEqlzTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EqlzIntvl") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucEqlzIntvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "days");
+            return (msg.ucEqlzIntvl == 0xff) ? "No Data" : (msg.ucEqlzIntvl == 0xfe) ? "Out of range" : (msg.ucEqlzIntvl == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccEqlzCfgCmd::Print() const {
+        std::cout << "PGN: SccEqlzCfgCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "EqlzV      : " << fnGetValue("EqlzV") << " (" << fnGetRawValue("EqlzV") << ")" << endl;
+        cout << "EqlzTime      : " << fnGetValue("EqlzTime") << " (" << fnGetRawValue("EqlzTime") << ")" << endl;
+        cout << "EqlzIntvl      : " << fnGetValue("EqlzIntvl") << " (" << fnGetRawValue("EqlzIntvl") << ")" << endl;
+    }
+bool SccEqlzCfgCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccEqlzCfgCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            return static_cast<uint32_t>(msg.uiEqlzV);
+        }
+        else if (mnem == "EqlzTime") {
+            return static_cast<uint32_t>(msg.uiEqlzTime);
+        }
+        else if (mnem == "EqlzIntvl") {
+            return static_cast<uint32_t>(msg.ucEqlzIntvl);
+        }
+        return UINT32_MAX;
+    }
+void SccEqlzCfgCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "EqlzV") {
+     msg.uiEqlzV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+     msg.uiEqlzTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "EqlzIntvl") {
+     msg.ucEqlzIntvl = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void SccEqlzCfgCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccEqlzCfgCmd::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccEqlzCfgCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "EqlzV") {
+            return 0.05000000074505806 * (long double)(msg.uiEqlzV + 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+            return 1.0 * (long double)(msg.uiEqlzTime + 0.0);
+        }
+        else if (mnem == "EqlzIntvl") {
+            return 1.0 * (long double)(msg.ucEqlzIntvl + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccEqlzCfgSts
+std::string SccEqlzCfgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiEqlzV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiEqlzV == 0xffff) ? "No Data" : (msg.uiEqlzV == 0xfffe) ? "Out of range" : (msg.uiEqlzV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EqlzTime") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiEqlzTime + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiEqlzTime == 0xffff) ? "No Data" : (msg.uiEqlzTime == 0xfffe) ? "Out of range" : (msg.uiEqlzTime == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "EqlzIntvl") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucEqlzIntvl + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "days");
+            return (msg.ucEqlzIntvl == 0xff) ? "No Data" : (msg.ucEqlzIntvl == 0xfe) ? "Out of range" : (msg.ucEqlzIntvl == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccEqlzCfgSts::Print() const {
+        std::cout << "PGN: SccEqlzCfgSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "EqlzV      : " << fnGetValue("EqlzV") << " (" << fnGetRawValue("EqlzV") << ")" << endl;
+        cout << "EqlzTime      : " << fnGetValue("EqlzTime") << " (" << fnGetRawValue("EqlzTime") << ")" << endl;
+        cout << "EqlzIntvl      : " << fnGetValue("EqlzIntvl") << " (" << fnGetRawValue("EqlzIntvl") << ")" << endl;
+    }
+bool SccEqlzCfgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccEqlzCfgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "EqlzV") {
+            return static_cast<uint32_t>(msg.uiEqlzV);
+        }
+        else if (mnem == "EqlzTime") {
+            return static_cast<uint32_t>(msg.uiEqlzTime);
+        }
+        else if (mnem == "EqlzIntvl") {
+            return static_cast<uint32_t>(msg.ucEqlzIntvl);
+        }
+        return UINT32_MAX;
+    }
+void SccEqlzCfgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "EqlzV") {
+     msg.uiEqlzV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+     msg.uiEqlzTime = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "EqlzIntvl") {
+     msg.ucEqlzIntvl = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void SccEqlzCfgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccEqlzCfgSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccEqlzCfgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "EqlzV") {
+            return 0.05000000074505806 * (long double)(msg.uiEqlzV + 0.0);
+        }
+        else if (mnem == "EqlzTime") {
+            return 1.0 * (long double)(msg.uiEqlzTime + 0.0);
+        }
+        else if (mnem == "EqlzIntvl") {
+            return 1.0 * (long double)(msg.ucEqlzIntvl + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccEqlzSts
+std::string SccEqlzSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "TimeRemain") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiTimeRemain + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "Min");
+            return (msg.uiTimeRemain == 0xffff) ? "No Data" : (msg.uiTimeRemain == 0xfffe) ? "Out of range" : (msg.uiTimeRemain == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "PreChgSts") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.tePreChgSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePreChgSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.tePreChgSts));
+              }
+        }
+        else if (mnem == "TimeSinceEqlz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucTimeSinceEqlz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "days");
+            return (msg.ucTimeSinceEqlz == 0xff) ? "No Data" : (msg.ucTimeSinceEqlz == 0xfe) ? "Out of range" : (msg.ucTimeSinceEqlz == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccEqlzSts::Print() const {
+        std::cout << "PGN: SccEqlzSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "TimeRemain      : " << fnGetValue("TimeRemain") << " (" << fnGetRawValue("TimeRemain") << ")" << endl;
+        cout << "PreChgSts      : " << fnGetValue("PreChgSts") << " (" << fnGetRawValue("PreChgSts") << ")" << endl;
+        cout << "TimeSinceEqlz      : " << fnGetValue("TimeSinceEqlz") << " (" << fnGetRawValue("TimeSinceEqlz") << ")" << endl;
+    }
+bool SccEqlzSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccEqlzSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "TimeRemain") {
+            return static_cast<uint32_t>(msg.uiTimeRemain);
+        }
+        else if (mnem == "PreChgSts") {
+            return static_cast<uint32_t>(msg.tePreChgSts);
+        }
+        else if (mnem == "TimeSinceEqlz") {
+            return static_cast<uint32_t>(msg.ucTimeSinceEqlz);
+        }
+        return UINT32_MAX;
+    }
+void SccEqlzSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "TimeRemain") {
+     msg.uiTimeRemain = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "PreChgSts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.tePreChgSts = static_cast<decltype(msg.tePreChgSts)>(enumValue);
+     else msg.tePreChgSts = static_cast<decltype(msg.tePreChgSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "TimeSinceEqlz") {
+     msg.ucTimeSinceEqlz = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void SccEqlzSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccEqlzSts::fnTranslate(const string& func, const string& param_value) const {
+ return "";     };
+long double SccEqlzSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "TimeRemain") {
+            return 1.0 * (long double)(msg.uiTimeRemain + 0.0);
+        }
+        else if (mnem == "PreChgSts") {
+            return 1.0 * (long double)(msg.tePreChgSts + 0.0);
+        }
+        else if (mnem == "TimeSinceEqlz") {
+            return 1.0 * (long double)(msg.ucTimeSinceEqlz + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgCmd
+std::string SccCfgCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            if (!ENUMLOOKUP_9408.fnContains(msg.teChgAlg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgAlg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9408.fnText(msg.teChgAlg));
+              }
+        }
+        else if (mnem == "ChgMode") {
+            if (!ENUMLOOKUP_9409.fnContains(msg.teChgMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9409.fnText(msg.teChgMode));
+              }
+        }
+        else if (mnem == "BattSensPres") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teBattSensPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattSensPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teBattSensPres));
+              }
+        }
+        else if (mnem == "LinkageMode") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teLinkageMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLinkageMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teLinkageMode));
+              }
+        }
+        else if (mnem == "BattType") {
+            if (!ENUMLOOKUP_9410.fnContains(msg.teBattType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9410.fnText(msg.teBattType));
+              }
+        }
+        else if (mnem == "BattBankSz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBattBankSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiBattBankSz == 0xffff) ? "No Data" : (msg.uiBattBankSz == 0xfffe) ? "Out of range" : (msg.uiBattBankSz == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "MaxChgI") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucMaxChgI + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucMaxChgI == 0xff) ? "No Data" : (msg.ucMaxChgI == 0xfe) ? "Out of range" : (msg.ucMaxChgI == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgCmd::Print() const {
+        std::cout << "PGN: SccCfgCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgAlg      : " << fnGetValue("ChgAlg") << " (" << fnGetRawValue("ChgAlg") << ")" << endl;
+        cout << "ChgMode      : " << fnGetValue("ChgMode") << " (" << fnGetRawValue("ChgMode") << ")" << endl;
+        cout << "BattSensPres      : " << fnGetValue("BattSensPres") << " (" << fnGetRawValue("BattSensPres") << ")" << endl;
+        cout << "LinkageMode      : " << fnGetValue("LinkageMode") << " (" << fnGetRawValue("LinkageMode") << ")" << endl;
+        cout << "BattType      : " << fnGetValue("BattType") << " (" << fnGetRawValue("BattType") << ")" << endl;
+        cout << "BattBankSz      : " << fnGetValue("BattBankSz") << " (" << fnGetRawValue("BattBankSz") << ")" << endl;
+        cout << "MaxChgI      : " << fnGetValue("MaxChgI") << " (" << fnGetRawValue("MaxChgI") << ")" << endl;
+    }
+bool SccCfgCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            return static_cast<uint32_t>(msg.teChgAlg);
+        }
+        else if (mnem == "ChgMode") {
+            return static_cast<uint32_t>(msg.teChgMode);
+        }
+        else if (mnem == "BattSensPres") {
+            return static_cast<uint32_t>(msg.teBattSensPres);
+        }
+        else if (mnem == "LinkageMode") {
+            return static_cast<uint32_t>(msg.teLinkageMode);
+        }
+        else if (mnem == "BattType") {
+            return static_cast<uint32_t>(msg.teBattType);
+        }
+        else if (mnem == "BattBankSz") {
+            return static_cast<uint32_t>(msg.uiBattBankSz);
+        }
+        else if (mnem == "MaxChgI") {
+            return static_cast<uint32_t>(msg.ucMaxChgI);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ChgAlg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9408, value);
+     if (enumValue != -1) msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(enumValue);
+     else msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9409, value);
+     if (enumValue != -1) msg.teChgMode = static_cast<decltype(msg.teChgMode)>(enumValue);
+     else msg.teChgMode = static_cast<decltype(msg.teChgMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattSensPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(enumValue);
+     else msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LinkageMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teLinkageMode = static_cast<decltype(msg.teLinkageMode)>(enumValue);
+     else msg.teLinkageMode = static_cast<decltype(msg.teLinkageMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9410, value);
+     if (enumValue != -1) msg.teBattType = static_cast<decltype(msg.teBattType)>(enumValue);
+     else msg.teBattType = static_cast<decltype(msg.teBattType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattBankSz") {
+     msg.uiBattBankSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+     msg.ucMaxChgI = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void SccCfgCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgCmd::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnBatteryType2Cmd") return fnBatteryType2Cmd(param_value);
+ return "";     };
+long double SccCfgCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgAlg") {
+            return 1.0 * (long double)(msg.teChgAlg + 0.0);
+        }
+        else if (mnem == "ChgMode") {
+            return 1.0 * (long double)(msg.teChgMode + 0.0);
+        }
+        else if (mnem == "BattSensPres") {
+            return 1.0 * (long double)(msg.teBattSensPres + 0.0);
+        }
+        else if (mnem == "LinkageMode") {
+            return 1.0 * (long double)(msg.teLinkageMode + 0.0);
+        }
+        else if (mnem == "BattType") {
+            return 1.0 * (long double)(msg.teBattType + 0.0);
+        }
+        else if (mnem == "BattBankSz") {
+            return 1.0 * (long double)(msg.uiBattBankSz + 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+            return 1.0 * (long double)(msg.ucMaxChgI + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCmd
+std::string SccCmd::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "Sts") {
+            if (!ENUMLOOKUP_9411.fnContains(msg.teSts)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teSts);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9411.fnText(msg.teSts));
+              }
+        }
+        else if (mnem == "EnableOnPwrUp") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teEnableOnPwrUp)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teEnableOnPwrUp);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teEnableOnPwrUp));
+              }
+        }
+        else if (mnem == "ClrHist") {
+            if (!ENUMLOOKUP_9066.fnContains(msg.teClrHist)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teClrHist);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9066.fnText(msg.teClrHist));
+              }
+        }
+        else if (mnem == "ForceChg") {
+            if (!ENUMLOOKUP_1484358105.fnContains(msg.teForceChg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teForceChg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484358105.fnText(msg.teForceChg));
+              }
+        }
+        else return "no pgn";
+    }
+void SccCmd::Print() const {
+        std::cout << "PGN: SccCmd" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "Sts      : " << fnGetValue("Sts") << " (" << fnGetRawValue("Sts") << ")" << endl;
+        cout << "EnableOnPwrUp      : " << fnGetValue("EnableOnPwrUp") << " (" << fnGetRawValue("EnableOnPwrUp") << ")" << endl;
+        cout << "ClrHist      : " << fnGetValue("ClrHist") << " (" << fnGetRawValue("ClrHist") << ")" << endl;
+        cout << "ForceChg      : " << fnGetValue("ForceChg") << " (" << fnGetRawValue("ForceChg") << ")" << endl;
+    }
+bool SccCmd::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCmd::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "Sts") {
+            return static_cast<uint32_t>(msg.teSts);
+        }
+        else if (mnem == "EnableOnPwrUp") {
+            return static_cast<uint32_t>(msg.teEnableOnPwrUp);
+        }
+        else if (mnem == "ClrHist") {
+            return static_cast<uint32_t>(msg.teClrHist);
+        }
+        else if (mnem == "ForceChg") {
+            return static_cast<uint32_t>(msg.teForceChg);
+        }
+        return UINT32_MAX;
+    }
+void SccCmd::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "Sts") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9411, value);
+     if (enumValue != -1) msg.teSts = static_cast<decltype(msg.teSts)>(enumValue);
+     else msg.teSts = static_cast<decltype(msg.teSts)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "EnableOnPwrUp") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teEnableOnPwrUp = static_cast<decltype(msg.teEnableOnPwrUp)>(enumValue);
+     else msg.teEnableOnPwrUp = static_cast<decltype(msg.teEnableOnPwrUp)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ClrHist") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9066, value);
+     if (enumValue != -1) msg.teClrHist = static_cast<decltype(msg.teClrHist)>(enumValue);
+     else msg.teClrHist = static_cast<decltype(msg.teClrHist)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ForceChg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484358105, value);
+     if (enumValue != -1) msg.teForceChg = static_cast<decltype(msg.teForceChg)>(enumValue);
+     else msg.teForceChg = static_cast<decltype(msg.teForceChg)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void SccCmd::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCmd::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnChargerEnable2Cmd") return fnChargerEnable2Cmd(param_value);
+ return "";     };
+long double SccCmd::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "Sts") {
+            return 1.0 * (long double)(msg.teSts + 0.0);
+        }
+        else if (mnem == "EnableOnPwrUp") {
+            return 1.0 * (long double)(msg.teEnableOnPwrUp + 0.0);
+        }
+        else if (mnem == "ClrHist") {
+            return 1.0 * (long double)(msg.teClrHist + 0.0);
+        }
+        else if (mnem == "ForceChg") {
+            return 1.0 * (long double)(msg.teForceChg + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccCfgSts
+std::string SccCfgSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            if (!ENUMLOOKUP_9408.fnContains(msg.teChgAlg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgAlg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9408.fnText(msg.teChgAlg));
+              }
+        }
+        else if (mnem == "ChgMode") {
+            if (!ENUMLOOKUP_9409.fnContains(msg.teChgMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teChgMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9409.fnText(msg.teChgMode));
+              }
+        }
+        else if (mnem == "BattSensPres") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teBattSensPres)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattSensPres);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teBattSensPres));
+              }
+        }
+        else if (mnem == "LinkMode") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teLinkMode)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teLinkMode);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teLinkMode));
+              }
+        }
+        else if (mnem == "BattType") {
+            if (!ENUMLOOKUP_9410.fnContains(msg.teBattType)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teBattType);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9410.fnText(msg.teBattType));
+              }
+        }
+        else if (mnem == "BattBankSz") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.uiBattBankSz + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "AH");
+            return (msg.uiBattBankSz == 0xffff) ? "No Data" : (msg.uiBattBankSz == 0xfffe) ? "Out of range" : (msg.uiBattBankSz == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "MaxChgI") {
+            char buffer[50];
+            auto engval = 1.0 * (long double) (msg.ucMaxChgI + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.0f %s", engval, "A");
+            return (msg.ucMaxChgI == 0xff) ? "No Data" : (msg.ucMaxChgI == 0xfe) ? "Out of range" : (msg.ucMaxChgI == 0xfd) ? "Reserved" : (buffer);
+        }
+        else return "no pgn";
+    }
+void SccCfgSts::Print() const {
+        std::cout << "PGN: SccCfgSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgAlg      : " << fnGetValue("ChgAlg") << " (" << fnGetRawValue("ChgAlg") << ")" << endl;
+        cout << "ChgMode      : " << fnGetValue("ChgMode") << " (" << fnGetRawValue("ChgMode") << ")" << endl;
+        cout << "BattSensPres      : " << fnGetValue("BattSensPres") << " (" << fnGetRawValue("BattSensPres") << ")" << endl;
+        cout << "LinkMode      : " << fnGetValue("LinkMode") << " (" << fnGetRawValue("LinkMode") << ")" << endl;
+        cout << "BattType      : " << fnGetValue("BattType") << " (" << fnGetRawValue("BattType") << ")" << endl;
+        cout << "BattBankSz      : " << fnGetValue("BattBankSz") << " (" << fnGetRawValue("BattBankSz") << ")" << endl;
+        cout << "MaxChgI      : " << fnGetValue("MaxChgI") << " (" << fnGetRawValue("MaxChgI") << ")" << endl;
+    }
+bool SccCfgSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccCfgSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgAlg") {
+            return static_cast<uint32_t>(msg.teChgAlg);
+        }
+        else if (mnem == "ChgMode") {
+            return static_cast<uint32_t>(msg.teChgMode);
+        }
+        else if (mnem == "BattSensPres") {
+            return static_cast<uint32_t>(msg.teBattSensPres);
+        }
+        else if (mnem == "LinkMode") {
+            return static_cast<uint32_t>(msg.teLinkMode);
+        }
+        else if (mnem == "BattType") {
+            return static_cast<uint32_t>(msg.teBattType);
+        }
+        else if (mnem == "BattBankSz") {
+            return static_cast<uint32_t>(msg.uiBattBankSz);
+        }
+        else if (mnem == "MaxChgI") {
+            return static_cast<uint32_t>(msg.ucMaxChgI);
+        }
+        return UINT32_MAX;
+    }
+void SccCfgSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ChgAlg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9408, value);
+     if (enumValue != -1) msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(enumValue);
+     else msg.teChgAlg = static_cast<decltype(msg.teChgAlg)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ChgMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9409, value);
+     if (enumValue != -1) msg.teChgMode = static_cast<decltype(msg.teChgMode)>(enumValue);
+     else msg.teChgMode = static_cast<decltype(msg.teChgMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattSensPres") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(enumValue);
+     else msg.teBattSensPres = static_cast<decltype(msg.teBattSensPres)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "LinkMode") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teLinkMode = static_cast<decltype(msg.teLinkMode)>(enumValue);
+     else msg.teLinkMode = static_cast<decltype(msg.teLinkMode)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattType") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9410, value);
+     if (enumValue != -1) msg.teBattType = static_cast<decltype(msg.teBattType)>(enumValue);
+     else msg.teBattType = static_cast<decltype(msg.teBattType)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "BattBankSz") {
+     msg.uiBattBankSz = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 1.0, 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+     msg.ucMaxChgI = stringToInt(value, 0xff, 0xfe, 0xfd, 1.0, 0.0);
+        }
+    }
+void SccCfgSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccCfgSts::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnSts2BatteryType") return fnSts2BatteryType(param_value);
+ return "";     };
+long double SccCfgSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgAlg") {
+            return 1.0 * (long double)(msg.teChgAlg + 0.0);
+        }
+        else if (mnem == "ChgMode") {
+            return 1.0 * (long double)(msg.teChgMode + 0.0);
+        }
+        else if (mnem == "BattSensPres") {
+            return 1.0 * (long double)(msg.teBattSensPres + 0.0);
+        }
+        else if (mnem == "LinkMode") {
+            return 1.0 * (long double)(msg.teLinkMode + 0.0);
+        }
+        else if (mnem == "BattType") {
+            return 1.0 * (long double)(msg.teBattType + 0.0);
+        }
+        else if (mnem == "BattBankSz") {
+            return 1.0 * (long double)(msg.uiBattBankSz + 0.0);
+        }
+        else if (mnem == "MaxChgI") {
+            return 1.0 * (long double)(msg.ucMaxChgI + 0.0);
+        }
+        return 0.0;
+    }
+
+// SccSts
+std::string SccSts::fnGetValue(const std::string& mnem) const {
+        if (mnem == "Inst") {
+            return std::to_string(msg.ucInst);
+        }
+        else if (mnem == "ChgV") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgV + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "V");
+            return (msg.uiChgV == 0xffff) ? "No Data" : (msg.uiChgV == 0xfffe) ? "Out of range" : (msg.uiChgV == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgI") {
+            char buffer[50];
+            auto engval = 0.05000000074505806 * (long double) (msg.uiChgI + -32000.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "A");
+            return (msg.uiChgI == 0xffff) ? "No Data" : (msg.uiChgI == 0xfffe) ? "Out of range" : (msg.uiChgI == 0xfffd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "ChgIPer") {
+            char buffer[50];
+            auto engval = 0.5 * (long double) (msg.ucChgIPer + 0.0);
+            snprintf(buffer, sizeof(buffer), "%.1f %s", engval, "%");
+            return (msg.ucChgIPer == 0xff) ? "No Data" : (msg.ucChgIPer == 0xfe) ? "Out of range" : (msg.ucChgIPer == 0xfd) ? "Reserved" : (buffer);
+        }
+        else if (mnem == "OpState") {
+            if (!ENUMLOOKUP_1599683911.fnContains(msg.teOpState)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teOpState);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1599683911.fnText(msg.teOpState));
+              }
+        }
+        else if (mnem == "PwrUpEnDis") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.tePwrUpEnDis)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.tePwrUpEnDis);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.tePwrUpEnDis));
+              }
+        }
+        else if (mnem == "ClrHist") {
+            if (!ENUMLOOKUP_9075.fnContains(msg.teClrHist)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teClrHist);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_9075.fnText(msg.teClrHist));
+              }
+        }
+        else if (mnem == "ForceChg") {
+            if (!ENUMLOOKUP_1484358105.fnContains(msg.teForceChg)) {
+                 char buffer[50];
+                 snprintf(buffer, sizeof(buffer), "??%d??", msg.teForceChg);
+                 return (buffer);
+            } else {
+                 return std::string(ENUMLOOKUP_1484358105.fnText(msg.teForceChg));
+              }
+        }
+        else return "no pgn";
+    }
+void SccSts::Print() const {
+        std::cout << "PGN: SccSts" << std::endl;
+        cout << "Inst      : " << fnGetValue("Inst") << " (" << fnGetRawValue("Inst") << ")" << endl;
+        cout << "ChgV      : " << fnGetValue("ChgV") << " (" << fnGetRawValue("ChgV") << ")" << endl;
+        cout << "ChgI      : " << fnGetValue("ChgI") << " (" << fnGetRawValue("ChgI") << ")" << endl;
+        cout << "ChgIPer      : " << fnGetValue("ChgIPer") << " (" << fnGetRawValue("ChgIPer") << ")" << endl;
+        cout << "OpState      : " << fnGetValue("OpState") << " (" << fnGetRawValue("OpState") << ")" << endl;
+        cout << "PwrUpEnDis      : " << fnGetValue("PwrUpEnDis") << " (" << fnGetRawValue("PwrUpEnDis") << ")" << endl;
+        cout << "ClrHist      : " << fnGetValue("ClrHist") << " (" << fnGetRawValue("ClrHist") << ")" << endl;
+        cout << "ForceChg      : " << fnGetValue("ForceChg") << " (" << fnGetRawValue("ForceChg") << ")" << endl;
+    }
+bool SccSts::fnQualPasses(const std::vector<std::tuple<std::string, std::string>>& qual) const {
+        for (const auto& qualtup : qual) {
+           const std::string& sig = std::get<0>(qualtup);
+          const std::string& testval = std::get<1>(qualtup);
+         std::string val = fnGetValue(sig);
+    
+            if (testval != val) {
+              // Failed one of the clauses
+               return false;
+            }
+        }
+       // No clauses indicated this wasn't our message
+       return true;
+    }
+uint32 SccSts::fnGetRawValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return static_cast<uint32_t>(msg.ucInst);
+        }
+        else if (mnem == "ChgV") {
+            return static_cast<uint32_t>(msg.uiChgV);
+        }
+        else if (mnem == "ChgI") {
+            return static_cast<uint32_t>(msg.uiChgI);
+        }
+        else if (mnem == "ChgIPer") {
+            return static_cast<uint32_t>(msg.ucChgIPer);
+        }
+        else if (mnem == "OpState") {
+            return static_cast<uint32_t>(msg.teOpState);
+        }
+        else if (mnem == "PwrUpEnDis") {
+            return static_cast<uint32_t>(msg.tePwrUpEnDis);
+        }
+        else if (mnem == "ClrHist") {
+            return static_cast<uint32_t>(msg.teClrHist);
+        }
+        else if (mnem == "ForceChg") {
+            return static_cast<uint32_t>(msg.teForceChg);
+        }
+        return UINT32_MAX;
+    }
+void SccSts::fnSetValue(const std::string& mnem, const std::string& value) {
+        if (mnem == "Inst") {
+     msg.ucInst = stringToInt(value, 0, 0, 0);
+        }
+        else if (mnem == "ChgV") {
+     msg.uiChgV = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, 0.0);
+        }
+        else if (mnem == "ChgI") {
+     msg.uiChgI = stringToInt(value, 0xffff, 0xfffe, 0xfffd, 0.05000000074505806, -32000.0);
+        }
+        else if (mnem == "ChgIPer") {
+     msg.ucChgIPer = stringToInt(value, 0xff, 0xfe, 0xfd, 0.5, 0.0);
+        }
+        else if (mnem == "OpState") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1599683911, value);
+     if (enumValue != -1) msg.teOpState = static_cast<decltype(msg.teOpState)>(enumValue);
+     else msg.teOpState = static_cast<decltype(msg.teOpState)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "PwrUpEnDis") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.tePwrUpEnDis = static_cast<decltype(msg.tePwrUpEnDis)>(enumValue);
+     else msg.tePwrUpEnDis = static_cast<decltype(msg.tePwrUpEnDis)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ClrHist") {
+     int enumValue = findEnumValue(ENUMLOOKUP_9075, value);
+     if (enumValue != -1) msg.teClrHist = static_cast<decltype(msg.teClrHist)>(enumValue);
+     else msg.teClrHist = static_cast<decltype(msg.teClrHist)>(stringToInt(value, 0, 0, 0));
+        }
+        else if (mnem == "ForceChg") {
+     int enumValue = findEnumValue(ENUMLOOKUP_1484358105, value);
+     if (enumValue != -1) msg.teForceChg = static_cast<decltype(msg.teForceChg)>(enumValue);
+     else msg.teForceChg = static_cast<decltype(msg.teForceChg)>(stringToInt(value, 0, 0, 0));
+        }
+    }
+void SccSts::fnSend(uint32 pgn, int grpfunc, int addr) {
+        XBMSG_fnSendEx( pgn, grpfunc, &msg, sizeof( msg ), addr );
+    }
+string SccSts::fnTranslate(const string& func, const string& param_value) const {
+        if (func == "fnSccSts2ChgOpState") return fnSccSts2ChgOpState(param_value);
+        if (func == "fnSts2ChargerEnable") return fnSts2ChargerEnable(param_value);
+ return "";     };
+long double SccSts::fnGetFloatValue(const std::string mnem) const {
+        if (mnem == "Inst") {
+            return 1.0 * (long double)(msg.ucInst + 0.0);
+        }
+        else if (mnem == "ChgV") {
+            return 0.05000000074505806 * (long double)(msg.uiChgV + 0.0);
+        }
+        else if (mnem == "ChgI") {
+            return 0.05000000074505806 * (long double)(msg.uiChgI + -32000.0);
+        }
+        else if (mnem == "ChgIPer") {
+            return 0.5 * (long double)(msg.ucChgIPer + 0.0);
+        }
+        else if (mnem == "OpState") {
+            return 1.0 * (long double)(msg.teOpState + 0.0);
+        }
+        else if (mnem == "PwrUpEnDis") {
+            return 1.0 * (long double)(msg.tePwrUpEnDis + 0.0);
+        }
+        else if (mnem == "ClrHist") {
+            return 1.0 * (long double)(msg.teClrHist + 0.0);
+        }
+        else if (mnem == "ForceChg") {
+            return 1.0 * (long double)(msg.teForceChg + 0.0);
+        }
+        return 0.0;
+    }
+
+static const MessageRegistrar pgn_scc_registrars[] = {
+{"SccCfgCmd5", [](void * rcv) { return std::make_unique<SccCfgCmd5>(rcv); }, []() { return std::make_unique<SccCfgCmd5>(); } },
+{"SccCfgSts5", [](void * rcv) { return std::make_unique<SccCfgSts5>(rcv); }, []() { return std::make_unique<SccCfgSts5>(); } },
+{"SccCfgCmd4", [](void * rcv) { return std::make_unique<SccCfgCmd4>(rcv); }, []() { return std::make_unique<SccCfgCmd4>(); } },
+{"SccCfgSts4", [](void * rcv) { return std::make_unique<SccCfgSts4>(rcv); }, []() { return std::make_unique<SccCfgSts4>(); } },
+{"SccCfgCmd3", [](void * rcv) { return std::make_unique<SccCfgCmd3>(rcv); }, []() { return std::make_unique<SccCfgCmd3>(); } },
+{"SccCfgSts3", [](void * rcv) { return std::make_unique<SccCfgSts3>(rcv); }, []() { return std::make_unique<SccCfgSts3>(); } },
+{"SccCfgCmd2", [](void * rcv) { return std::make_unique<SccCfgCmd2>(rcv); }, []() { return std::make_unique<SccCfgCmd2>(); } },
+{"SccCfgSts2", [](void * rcv) { return std::make_unique<SccCfgSts2>(rcv); }, []() { return std::make_unique<SccCfgSts2>(); } },
+{"SccArraySts", [](void * rcv) { return std::make_unique<SccArraySts>(rcv); }, []() { return std::make_unique<SccArraySts>(); } },
+{"SccBattSts", [](void * rcv) { return std::make_unique<SccBattSts>(rcv); }, []() { return std::make_unique<SccBattSts>(); } },
+{"SccSts6", [](void * rcv) { return std::make_unique<SccSts6>(rcv); }, []() { return std::make_unique<SccSts6>(); } },
+{"SccSts5", [](void * rcv) { return std::make_unique<SccSts5>(rcv); }, []() { return std::make_unique<SccSts5>(); } },
+{"SccSts4", [](void * rcv) { return std::make_unique<SccSts4>(rcv); }, []() { return std::make_unique<SccSts4>(); } },
+{"SccSts3", [](void * rcv) { return std::make_unique<SccSts3>(rcv); }, []() { return std::make_unique<SccSts3>(); } },
+{"SccSts2", [](void * rcv) { return std::make_unique<SccSts2>(rcv); }, []() { return std::make_unique<SccSts2>(); } },
+{"SccEqlzCfgCmd", [](void * rcv) { return std::make_unique<SccEqlzCfgCmd>(rcv); }, []() { return std::make_unique<SccEqlzCfgCmd>(); } },
+{"SccEqlzCfgSts", [](void * rcv) { return std::make_unique<SccEqlzCfgSts>(rcv); }, []() { return std::make_unique<SccEqlzCfgSts>(); } },
+{"SccEqlzSts", [](void * rcv) { return std::make_unique<SccEqlzSts>(rcv); }, []() { return std::make_unique<SccEqlzSts>(); } },
+{"SccCfgCmd", [](void * rcv) { return std::make_unique<SccCfgCmd>(rcv); }, []() { return std::make_unique<SccCfgCmd>(); } },
+{"SccCmd", [](void * rcv) { return std::make_unique<SccCmd>(rcv); }, []() { return std::make_unique<SccCmd>(); } },
+{"SccCfgSts", [](void * rcv) { return std::make_unique<SccCfgSts>(rcv); }, []() { return std::make_unique<SccCfgSts>(); } },
+{"SccSts", [](void * rcv) { return std::make_unique<SccSts>(rcv); }, []() { return std::make_unique<SccSts>(); } },
+};
+static const PrinterRegistrar pgn_scc_printers[] = {
+{130510, -1, fnPrintMessage<SccCfgCmd5>},
+{130511, -1, fnPrintMessage<SccCfgSts5>},
+{130553, -1, fnPrintMessage<SccCfgCmd4>},
+{130554, -1, fnPrintMessage<SccCfgSts4>},
+{130555, -1, fnPrintMessage<SccCfgCmd3>},
+{130556, -1, fnPrintMessage<SccCfgSts3>},
+{130557, -1, fnPrintMessage<SccCfgCmd2>},
+{130558, -1, fnPrintMessage<SccCfgSts2>},
+{130559, -1, fnPrintMessage<SccArraySts>},
+{130688, -1, fnPrintMessage<SccBattSts>},
+{130689, -1, fnPrintMessage<SccSts6>},
+{130690, -1, fnPrintMessage<SccSts5>},
+{130691, -1, fnPrintMessage<SccSts4>},
+{130692, -1, fnPrintMessage<SccSts3>},
+{130693, -1, fnPrintMessage<SccSts2>},
+{130733, -1, fnPrintMessage<SccEqlzCfgCmd>},
+{130734, -1, fnPrintMessage<SccEqlzCfgSts>},
+{130735, -1, fnPrintMessage<SccEqlzSts>},
+{130736, -1, fnPrintMessage<SccCfgCmd>},
+{130737, -1, fnPrintMessage<SccCmd>},
+{130738, -1, fnPrintMessage<SccCfgSts>},
+{130739, -1, fnPrintMessage<SccSts>},
+};
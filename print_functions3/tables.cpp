@@ -0,0 +1,461 @@
+// Auto-generated by generate_print_functions.py: PGN tables and message registry
+#include "print_functions3.h"
+
+std::unordered_map<std::string, std::pair<int, int>> PGNREVERSE = {
+{ "AGSCritCmdAmbTemp" , {131007, -1} },
+{ "AGSCritCmdDcI" , {131007, -1} },
+{ "AGSCritCmdDcSoc" , {131007, -1} },
+{ "AGSCritCmdDcV" , {131007, -1} },
+{ "AGSCritStsAmbTemp" , {131008, -1} },
+{ "AGSCritStsDcI" , {131008, -1} },
+{ "AGSCritStsDcSoc" , {131008, -1} },
+{ "AGSCritStsDcV" , {131008, -1} },
+{ "AGSCritStsXferAcV" , {131008, -1} },
+{ "AcFltCtrlCfgCmd1" , {130997, -1} },
+{ "AcFltCtrlCfgCmd2" , {130996, -1} },
+{ "AcFltCtrlCfgSts1" , {130999, -1} },
+{ "AcFltCtrlCfgSts2" , {130998, -1} },
+{ "AlarmCmd" , {130718, -1} },
+{ "AlarmSts" , {130719, -1} },
+{ "BattCmd" , {130698, -1} },
+{ "BattSts1" , {130709, -1} },
+{ "BattSts11" , {130699, -1} },
+{ "BattSts2" , {130708, -1} },
+{ "BattSts3" , {130707, -1} },
+{ "BattSts4" , {130706, -1} },
+{ "BattSts6" , {130704, -1} },
+{ "BattSumm" , {130545, -1} },
+{ "ChgAcFltCfgCmd1" , {130951, -1} },
+{ "ChgAcFltCfgCmd2" , {130950, -1} },
+{ "ChgAcFltCfgSts1" , {130953, -1} },
+{ "ChgAcFltCfgSts2" , {130952, -1} },
+{ "ChgAcSts1" , {131018, -1} },
+{ "ChgAcSts2" , {131017, -1} },
+{ "ChgAcSts3" , {131016, -1} },
+{ "ChgAcSts4" , {130954, -1} },
+{ "ChgCfgCmd1" , {131012, -1} },
+{ "ChgCfgCmd2" , {130965, -1} },
+{ "ChgCfgCmd3" , {130763, -1} },
+{ "ChgCfgCmd4" , {130750, -1} },
+{ "ChgCfgSts1" , {131014, -1} },
+{ "ChgCfgSts2" , {130966, -1} },
+{ "ChgCfgSts3" , {130764, -1} },
+{ "ChgCfgSts4" , {130751, -1} },
+{ "ChgCmd" , {131013, -1} },
+{ "ChgEqlzCfgCmd" , {130967, -1} },
+{ "ChgEqlzCfgSts" , {130968, -1} },
+{ "ChgEqlzSts" , {130969, -1} },
+{ "ChgStatsSts" , {131011, -1} },
+{ "ChgSts" , {131015, -1} },
+{ "ChgSts2" , {130723, -1} },
+{ "ChgSts3" , {130506, -1} },
+{ "CommSts1" , {131066, -1} },
+{ "CommSts2" , {131065, -1} },
+{ "CommSts3" , {131064, -1} },
+{ "DCSrcSts1" , {131069, -1} },
+{ "DCSrcSts2" , {131068, -1} },
+{ "DCSrcSts3" , {131067, -1} },
+{ "DCSrcSts4" , {130761, -1} },
+{ "DcSrcCfgCmd3" , {130526, -1} },
+{ "DcSrcCmd" , {130724, -1} },
+{ "DcSrcConnSts" , {130512, -1} },
+{ "DcSrcSts11" , {130725, -1} },
+{ "DcSrcSts6" , {130759, -1} },
+{ "DeviceStateSync" , {130513, -1} },
+{ "DiagMsg1" , {130762, -1} },
+{ "FileDnldBlk" , {78080, -1} },
+{ "FileDnldInf" , {78336, -1} },
+{ "FileDnldSts" , {80640, -1} },
+{ "GenCmd" , {131034, -1} },
+{ "GenDemandCmd" , {131009, -1} },
+{ "GenDemandSts" , {131010, -1} },
+{ "GenRst" , {98048, -1} },
+{ "GenStartCfgCmd" , {131032, -1} },
+{ "GenStartCfgSts" , {131033, -1} },
+{ "GenSts1" , {131036, -1} },
+{ "GenSts2" , {131035, -1} },
+{ "InstAssign" , {97280, -1} },
+{ "InstSts" , {97024, -1} },
+{ "InvAcFltCfgCmd1" , {130956, -1} },
+{ "InvAcFltCfgSts1" , {130958, -1} },
+{ "InvAcSts1" , {131031, -1} },
+{ "InvAcSts2" , {131030, -1} },
+{ "InvAcSts3" , {131029, -1} },
+{ "InvAcSts4" , {130959, -1} },
+{ "InvApsSts" , {131021, -1} },
+{ "InvCfgCmd1" , {131024, -1} },
+{ "InvCfgCmd2" , {131023, -1} },
+{ "InvCfgCmd3" , {130765, -1} },
+{ "InvCfgCmd4" , {130714, -1} },
+{ "InvCfgSts1" , {131026, -1} },
+{ "InvCfgSts2" , {131025, -1} },
+{ "InvCfgSts3" , {130766, -1} },
+{ "InvCfgSts4" , {130715, -1} },
+{ "InvCmd" , {131027, -1} },
+{ "InvDcSts" , {130792, -1} },
+{ "InvHvDcBusSts" , {131020, -1} },
+{ "InvOpsSts" , {131019, -1} },
+{ "InvStatsSts" , {131022, -1} },
+{ "InvSts" , {131028, -1} },
+{ "InvTempSts" , {130749, -1} },
+{ "InvTempSts2" , {130507, -1} },
+{ "IsoAck" , {59392, -1} },
+{ "IsoAddrClaim" , {60928, -1} },
+{ "IsoCmdAddr" , {65240, -1} },
+{ "IsoReq" , {59904, -1} },
+{ "IsoTpConnManAbort" , {60416, 255} },
+{ "IsoTpConnManBam" , {60416, 32} },
+{ "IsoTpConnManCts" , {60416, 17} },
+{ "IsoTpConnManEom" , {60416, 19} },
+{ "IsoTpConnManRts" , {60416, 16} },
+{ "IsoTpXfer" , {60160, -1} },
+{ "PmAcStsRms" , {61184, 15} },
+{ "PmAcXferSwSts" , {61184, 16} },
+{ "PmAssocCfg" , {61184, 1} },
+{ "PmAssocSts" , {61184, 3} },
+{ "PmChgSts" , {61184, 12} },
+{ "PmDevMdCfg" , {61184, 4} },
+{ "PmDevMdSts" , {61184, 6} },
+{ "PmFXCCCfgCmd" , {61184, 5} },
+{ "PmFXCCCfgSts" , {61184, 7} },
+{ "PmGetConfigParam" , {61184, 17} },
+{ "PmGetStatusParam" , {61184, 19} },
+{ "PmInvCtrlCmd" , {61184, 14} },
+{ "PmInvLdShSts" , {61184, 10} },
+{ "PmInvSts" , {61184, 11} },
+{ "PmLithionicsCmd" , {61184, 170} },
+{ "PmLithionicsSts" , {61184, 171} },
+{ "PmParamAssocCfg" , {59648, 2} },
+{ "PmParamAuxCfg" , {59648, 3} },
+{ "PmParamAuxCfgTrigDly" , {59648, 5} },
+{ "PmParamAuxCfgTrigLvl" , {59648, 4} },
+{ "PmParamAuxSts" , {59648, 7} },
+{ "PmParamDevMdCfg" , {59648, 1} },
+{ "PmPpnNakRsp" , {61184, 127} },
+{ "PmPpnReadCmd" , {61184, 98} },
+{ "PmPpnReadRsp" , {61184, 99} },
+{ "PmPpnSessionCmd" , {61184, 96} },
+{ "PmPpnSessionRsp" , {61184, 97} },
+{ "PmPpnWriteCmd" , {61184, 100} },
+{ "PmPpnWriteRsp" , {61184, 101} },
+{ "PmReq" , {61184, 2} },
+{ "PmRpcCmd" , {61184, 9} },
+{ "PmSetConfigParam" , {61184, 18} },
+{ "PmSwVerSts" , {61184, 8} },
+{ "ProdIdent" , {65259, -1} },
+{ "ProdInfoSts" , {126996, -1} },
+{ "SccArraySts" , {130559, -1} },
+{ "SccBattSts" , {130688, -1} },
+{ "SccCfgCmd" , {130736, -1} },
+{ "SccCfgCmd2" , {130557, -1} },
+{ "SccCfgCmd3" , {130555, -1} },
+{ "SccCfgCmd4" , {130553, -1} },
+{ "SccCfgCmd5" , {130510, -1} },
+{ "SccCfgSts" , {130738, -1} },
+{ "SccCfgSts2" , {130558, -1} },
+{ "SccCfgSts3" , {130556, -1} },
+{ "SccCfgSts4" , {130554, -1} },
+{ "SccCfgSts5" , {130511, -1} },
+{ "SccCmd" , {130737, -1} },
+{ "SccEqlzCfgCmd" , {130733, -1} },
+{ "SccEqlzCfgSts" , {130734, -1} },
+{ "SccEqlzSts" , {130735, -1} },
+{ "SccSts" , {130739, -1} },
+{ "SccSts2" , {130693, -1} },
+{ "SccSts3" , {130692, -1} },
+{ "SccSts4" , {130691, -1} },
+{ "SccSts5" , {130690, -1} },
+{ "SccSts6" , {130689, -1} },
+{ "SetSysDateTime" , {131070, -1} },
+{ "SimpleCalibCfg" , {79872, -1} },
+{ "SwVerSts" , {129038, -1} },
+{ "SysDateTimeSts" , {131071, -1} },
+{ "VirtualTerminal" , {97792, -1} },
+{ "XbResetCmd" , {74752, -1} },
+};
+
+
+std::map<std::tuple<int, int, int>, std::string> global_spns = {
+    {std::make_tuple(0, 0, 0), "Specific Point Unknown"},
+    {std::make_tuple(0, 0, 1), "Node Microprocessor (or ECM)"},
+    {std::make_tuple(0, 0, 2), "Node Analog-Digital Converter"},
+    {std::make_tuple(0, 0, 3), "Node Settings or Configuration"},
+    {std::make_tuple(0, 0, 4), "Node RAM"},
+    {std::make_tuple(0, 0, 5), "Node Power Supply"},
+    {std::make_tuple(0, 0, 6), "Node Temperature"},
+    {std::make_tuple(0, 0, 7), "Node Clock / Timer"},
+    {std::make_tuple(0, 1, 0), "Node Date / Time"},
+    {std::make_tuple(0, 1, 1), "Node RV-C Connection"},
+    {std::make_tuple(0, 1, 2), "Node Serial/ID Number"},
+    {std::make_tuple(0, 1, 3), "Node Processor Supervisor (Watchdog)"},
+    {std::make_tuple(0, 1, 4), "Node Firmware"},
+    {std::make_tuple(0, 1, 5), "Node Internal Subnetwork Communications"},
+};
+
+
+    std::map<int, std::map<std::tuple<int, int>, std::string>> spn_mapping = {
+        {65, {
+        {std::make_tuple(1, 0), "Invalid Configuration"},
+        {std::make_tuple(1, 1), "Data Not Available"},
+    }},
+    {66, {
+        {std::make_tuple(1, 0), "DC Voltage"},
+        {std::make_tuple(1, 1), "DC Current"},
+        {std::make_tuple(1, 2), "Battery Temperature"},
+        {std::make_tuple(1, 3), "DC Source State of Charge"},
+        {std::make_tuple(1, 4), "DC Source State of Health"},
+        {std::make_tuple(1, 5), "DC Source Capacity"},
+        {std::make_tuple(1, 6), "DC Source AC Ripple"},
+        {std::make_tuple(1, 7), "AC Backfeed"},
+        {std::make_tuple(2, 0), "FET #1 Temperature"},
+        {std::make_tuple(2, 1), "FET #2 Temperature"},
+        {std::make_tuple(2, 2), "Control/Power Board Temperature"},
+        {std::make_tuple(2, 3), "Cooling Fan"},
+        {std::make_tuple(3, 0), "DC Bulk Capacitor Temperature"},
+        {std::make_tuple(3, 1), "Transformer Temperature"},
+        {std::make_tuple(3, 2), "Ambient Temperature"},
+        {std::make_tuple(3, 3), "Battery Charger Timeout"},
+        {std::make_tuple(3, 4), "Battery Equalization"},
+        {std::make_tuple(3, 5), "DC Bridge"},
+        {std::make_tuple(3, 6), "Transfer Relay"},
+        {std::make_tuple(3, 7), "Stacking Configuration"},
+        {std::make_tuple(4, 0), "Stacking Communication"},
+        {std::make_tuple(4, 1), "Stacking Sync Clock"},
+        {std::make_tuple(129, 0), "RMS Voltage"},
+        {std::make_tuple(129, 1), "RMS Current"},
+        {std::make_tuple(129, 2), "Frequency"},
+        {std::make_tuple(129, 3), "Open Ground"},
+        {std::make_tuple(129, 4), "Open Neutral"},
+        {std::make_tuple(129, 5), "Reverse Polarity"},
+        {std::make_tuple(129, 6), "Ground Fault"},
+        {std::make_tuple(129, 7), "Peak Voltage"},
+        {std::make_tuple(130, 0), "Peak Current"},
+        {std::make_tuple(130, 1), "Ground Current"},
+        {std::make_tuple(130, 2), "Real Power"},
+        {std::make_tuple(130, 3), "Reactive Power"},
+        {std::make_tuple(130, 4), "Harmonic Distortion"},
+        {std::make_tuple(130, 5), "AC Phase Status"},
+        {std::make_tuple(131, 0), "Anti-Islanding Frequency"},
+        {std::make_tuple(131, 1), "Anti-Islanding Voltage"},
+        {std::make_tuple(132, 0), "APS Voltage"},
+        {std::make_tuple(132, 1), "APS Current"},
+        {std::make_tuple(132, 2), "APS Temperature"},
+        {std::make_tuple(133, 0), "OPS Voltage"},
+        {std::make_tuple(133, 1), "OPS Current"},
+        {std::make_tuple(133, 2), "OPS Temperature"},
+        {std::make_tuple(134, 0), "DC Bus Voltage"},
+        {std::make_tuple(134, 1), "DC Bus Current"},
+        {std::make_tuple(134, 2), "DC Bus Temperature"},
+    }},
+    {141, {
+        {std::make_tuple(1, 0), "DC Voltage"},
+        {std::make_tuple(1, 1), "DC Current"},
+        {std::make_tuple(1, 2), "Battery Temperature"},
+        {std::make_tuple(1, 3), "DC Source State of Charge"},
+        {std::make_tuple(1, 4), "DC Source State of Health"},
+        {std::make_tuple(1, 5), "DC Source Capacity"},
+        {std::make_tuple(1, 6), "DC Source AC Ripple"},
+        {std::make_tuple(1, 7), "DC Source Reverse Polarity"},
+        {std::make_tuple(2, 0), "Ambient Temperature"},
+        {std::make_tuple(2, 1), "Battery Equalization"},
+        {std::make_tuple(2, 2), "Solar Array Voltage"},
+        {std::make_tuple(2, 3), "Solar Array Current"},
+    }},
+};
+
+// Function statics, so the registrars of every family find them constructed
+std::unordered_map<std::string, MessageFactory>& fnMessageTypes() {
+    static std::unordered_map<std::string, MessageFactory> message_types;
+    return message_types;
+}
+std::unordered_map<std::string, MessageDefFactory>& fnMessageTypesDef() {
+    static std::unordered_map<std::string, MessageDefFactory> message_types_def;
+    return message_types_def;
+}
+std::unordered_map<uint64_t, MessagePrinter>& fnMessagePrinters() {
+    static std::unordered_map<uint64_t, MessagePrinter> message_printers;
+    return message_printers;
+}
+
+std::map<std::tuple<int, int>, std::string> PGNTABLE = {
+{ make_pair(59392, -1) , "IsoAck"},
+{ make_pair(59648, 1) , "PmParamDevMdCfg"},
+{ make_pair(59648, 2) , "PmParamAssocCfg"},
+{ make_pair(59648, 3) , "PmParamAuxCfg"},
+{ make_pair(59648, 4) , "PmParamAuxCfgTrigLvl"},
+{ make_pair(59648, 5) , "PmParamAuxCfgTrigDly"},
+{ make_pair(59648, 7) , "PmParamAuxSts"},
+{ make_pair(59904, -1) , "IsoReq"},
+{ make_pair(60160, -1) , "IsoTpXfer"},
+{ make_pair(60416, 16) , "IsoTpConnManRts"},
+{ make_pair(60416, 17) , "IsoTpConnManCts"},
+{ make_pair(60416, 19) , "IsoTpConnManEom"},
+{ make_pair(60416, 32) , "IsoTpConnManBam"},
+{ make_pair(60416, 255) , "IsoTpConnManAbort"},
+{ make_pair(60928, -1) , "IsoAddrClaim"},
+{ make_pair(61184, 1) , "PmAssocCfg"},
+{ make_pair(61184, 2) , "PmReq"},
+{ make_pair(61184, 3) , "PmAssocSts"},
+{ make_pair(61184, 4) , "PmDevMdCfg"},
+{ make_pair(61184, 5) , "PmFXCCCfgCmd"},
+{ make_pair(61184, 6) , "PmDevMdSts"},
+{ make_pair(61184, 7) , "PmFXCCCfgSts"},
+{ make_pair(61184, 8) , "PmSwVerSts"},
+{ make_pair(61184, 9) , "PmRpcCmd"},
+{ make_pair(61184, 10) , "PmInvLdShSts"},
+{ make_pair(61184, 11) , "PmInvSts"},
+{ make_pair(61184, 12) , "PmChgSts"},
+{ make_pair(61184, 14) , "PmInvCtrlCmd"},
+{ make_pair(61184, 15) , "PmAcStsRms"},
+{ make_pair(61184, 16) , "PmAcXferSwSts"},
+{ make_pair(61184, 17) , "PmGetConfigParam"},
+{ make_pair(61184, 18) , "PmSetConfigParam"},
+{ make_pair(61184, 19) , "PmGetStatusParam"},
+{ make_pair(61184, 96) , "PmPpnSessionCmd"},
+{ make_pair(61184, 97) , "PmPpnSessionRsp"},
+{ make_pair(61184, 98) , "PmPpnReadCmd"},
+{ make_pair(61184, 99) , "PmPpnReadRsp"},
+{ make_pair(61184, 100) , "PmPpnWriteCmd"},
+{ make_pair(61184, 101) , "PmPpnWriteRsp"},
+{ make_pair(61184, 127) , "PmPpnNakRsp"},
+{ make_pair(61184, 170) , "PmLithionicsCmd"},
+{ make_pair(61184, 171) , "PmLithionicsSts"},
+{ make_pair(65240, -1) , "IsoCmdAddr"},
+{ make_pair(65259, -1) , "ProdIdent"},
+{ make_pair(74752, -1) , "XbResetCmd"},
+{ make_pair(78080, -1) , "FileDnldBlk"},
+{ make_pair(78336, -1) , "FileDnldInf"},
+{ make_pair(79872, -1) , "SimpleCalibCfg"},
+{ make_pair(80640, -1) , "FileDnldSts"},
+{ make_pair(97024, -1) , "InstSts"},
+{ make_pair(97280, -1) , "InstAssign"},
+{ make_pair(97792, -1) , "VirtualTerminal"},
+{ make_pair(98048, -1) , "GenRst"},
+{ make_pair(126996, -1) , "ProdInfoSts"},
+{ make_pair(129038, -1) , "SwVerSts"},
+{ make_pair(130506, -1) , "ChgSts3"},
+{ make_pair(130507, -1) , "InvTempSts2"},
+{ make_pair(130510, -1) , "SccCfgCmd5"},
+{ make_pair(130511, -1) , "SccCfgSts5"},
+{ make_pair(130512, -1) , "DcSrcConnSts"},
+{ make_pair(130513, -1) , "DeviceStateSync"},
+{ make_pair(130526, -1) , "DcSrcCfgCmd3"},
+{ make_pair(130545, -1) , "BattSumm"},
+{ make_pair(130553, -1) , "SccCfgCmd4"},
+{ make_pair(130554, -1) , "SccCfgSts4"},
+{ make_pair(130555, -1) , "SccCfgCmd3"},
+{ make_pair(130556, -1) , "SccCfgSts3"},
+{ make_pair(130557, -1) , "SccCfgCmd2"},
+{ make_pair(130558, -1) , "SccCfgSts2"},
+{ make_pair(130559, -1) , "SccArraySts"},
+{ make_pair(130688, -1) , "SccBattSts"},
+{ make_pair(130689, -1) , "SccSts6"},
+{ make_pair(130690, -1) , "SccSts5"},
+{ make_pair(130691, -1) , "SccSts4"},
+{ make_pair(130692, -1) , "SccSts3"},
+{ make_pair(130693, -1) , "SccSts2"},
+{ make_pair(130698, -1) , "BattCmd"},
+{ make_pair(130699, -1) , "BattSts11"},
+{ make_pair(130704, -1) , "BattSts6"},
+{ make_pair(130706, -1) , "BattSts4"},
+{ make_pair(130707, -1) , "BattSts3"},
+{ make_pair(130708, -1) , "BattSts2"},
+{ make_pair(130709, -1) , "BattSts1"},
+{ make_pair(130714, -1) , "InvCfgCmd4"},
+{ make_pair(130715, -1) , "InvCfgSts4"},
+{ make_pair(130718, -1) , "AlarmCmd"},
+{ make_pair(130719, -1) , "AlarmSts"},
+{ make_pair(130723, -1) , "ChgSts2"},
+{ make_pair(130724, -1) , "DcSrcCmd"},
+{ make_pair(130725, -1) , "DcSrcSts11"},
+{ make_pair(130733, -1) , "SccEqlzCfgCmd"},
+{ make_pair(130734, -1) , "SccEqlzCfgSts"},
+{ make_pair(130735, -1) , "SccEqlzSts"},
+{ make_pair(130736, -1) , "SccCfgCmd"},
+{ make_pair(130737, -1) , "SccCmd"},
+{ make_pair(130738, -1) , "SccCfgSts"},
+{ make_pair(130739, -1) , "SccSts"},
+{ make_pair(130749, -1) , "InvTempSts"},
+{ make_pair(130750, -1) , "ChgCfgCmd4"},
+{ make_pair(130751, -1) , "ChgCfgSts4"},
+{ make_pair(130759, -1) , "DcSrcSts6"},
+{ make_pair(130761, -1) , "DCSrcSts4"},
+{ make_pair(130762, -1) , "DiagMsg1"},
+{ make_pair(130763, -1) , "ChgCfgCmd3"},
+{ make_pair(130764, -1) , "ChgCfgSts3"},
+{ make_pair(130765, -1) , "InvCfgCmd3"},
+{ make_pair(130766, -1) , "InvCfgSts3"},
+{ make_pair(130792, -1) , "InvDcSts"},
+{ make_pair(130950, -1) , "ChgAcFltCfgCmd2"},
+{ make_pair(130951, -1) , "ChgAcFltCfgCmd1"},
+{ make_pair(130952, -1) , "ChgAcFltCfgSts2"},
+{ make_pair(130953, -1) , "ChgAcFltCfgSts1"},
+{ make_pair(130954, -1) , "ChgAcSts4"},
+{ make_pair(130956, -1) , "InvAcFltCfgCmd1"},
+{ make_pair(130958, -1) , "InvAcFltCfgSts1"},
+{ make_pair(130959, -1) , "InvAcSts4"},
+{ make_pair(130965, -1) , "ChgCfgCmd2"},
+{ make_pair(130966, -1) , "ChgCfgSts2"},
+{ make_pair(130967, -1) , "ChgEqlzCfgCmd"},
+{ make_pair(130968, -1) , "ChgEqlzCfgSts"},
+{ make_pair(130969, -1) , "ChgEqlzSts"},
+{ make_pair(130996, -1) , "AcFltCtrlCfgCmd2"},
+{ make_pair(130997, -1) , "AcFltCtrlCfgCmd1"},
+{ make_pair(130998, -1) , "AcFltCtrlCfgSts2"},
+{ make_pair(130999, -1) , "AcFltCtrlCfgSts1"},
+{ make_pair(131007, -1) , "AGSCritCmdDcI"},
+{ make_pair(131008, 1) , "AGSCritStsDcSoc"},
+{ make_pair(131009, -1) , "GenDemandCmd"},
+{ make_pair(131010, -1) , "GenDemandSts"},
+{ make_pair(131011, -1) , "ChgStatsSts"},
+{ make_pair(131012, -1) , "ChgCfgCmd1"},
+{ make_pair(131013, -1) , "ChgCmd"},
+{ make_pair(131014, -1) , "ChgCfgSts1"},
+{ make_pair(131015, -1) , "ChgSts"},
+{ make_pair(131016, -1) , "ChgAcSts3"},
+{ make_pair(131017, -1) , "ChgAcSts2"},
+{ make_pair(131018, -1) , "ChgAcSts1"},
+{ make_pair(131019, -1) , "InvOpsSts"},
+{ make_pair(131020, -1) , "InvHvDcBusSts"},
+{ make_pair(131021, -1) , "InvApsSts"},
+{ make_pair(131022, -1) , "InvStatsSts"},
+{ make_pair(131023, -1) , "InvCfgCmd2"},
+{ make_pair(131024, -1) , "InvCfgCmd1"},
+{ make_pair(131025, -1) , "InvCfgSts2"},
+{ make_pair(131026, -1) , "InvCfgSts1"},
+{ make_pair(131027, -1) , "InvCmd"},
+{ make_pair(131028, -1) , "InvSts"},
+{ make_pair(131029, -1) , "InvAcSts3"},
+{ make_pair(131030, -1) , "InvAcSts2"},
+{ make_pair(131031, -1) , "InvAcSts1"},
+{ make_pair(131032, -1) , "GenStartCfgCmd"},
+{ make_pair(131033, -1) , "GenStartCfgSts"},
+{ make_pair(131034, -1) , "GenCmd"},
+{ make_pair(131035, -1) , "GenSts2"},
+{ make_pair(131036, -1) , "GenSts1"},
+{ make_pair(131064, -1) , "CommSts3"},
+{ make_pair(131065, -1) , "CommSts2"},
+{ make_pair(131066, -1) , "CommSts1"},
+{ make_pair(131067, -1) , "DCSrcSts3"},
+{ make_pair(131068, -1) , "DCSrcSts2"},
+{ make_pair(131069, -1) , "DCSrcSts1"},
+{ make_pair(131070, -1) , "SetSysDateTime"},
+{ make_pair(131071, -1) , "SysDateTimeSts"},
+{ make_pair(131008, 2) , "AgsCritStsXferAcV"},
+{ make_pair(131008, 3) , "AgsCritStsDcI"},
+{ make_pair(131008, 4) , "AgsCritStsDcV"},
+{ make_pair(131007, 1) , "AgsCritCmdAmbTemp"},
+{ make_pair(131007, 2) , "AgsCritCmdDcV"},
+{ make_pair(131007, 3) , "AgsCritCmdDcSoc"},
+{ make_pair(131007, 4) , "AgsCritCmdXferAcV"},
+{ make_pair(131008, 5) , "AgsCritStsAmbTemp"},
+};
+
+// One hash lookup on (PGN, group function), whatever the PGN
+void printall(PGN_tzRECV_DATA *ptzRecv){
+    auto it = fnMessagePrinters().find(fnPgnKey(ptzRecv->ulPgn, ptzRecv->siGrpFunc));
+    if (it != fnMessagePrinters().end()) {
+        it->second(ptzRecv->pvStruct);
+    }
+}
+
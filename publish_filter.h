@@ -0,0 +1,157 @@
+#ifndef PUBLISH_FILTER_H
+#define PUBLISH_FILTER_H
+
+// Publish stage between the decoders and MQTT.
+//
+// Every value offered for a topic is compared with the last value published
+// on it: unchanged values, and numeric values within the deadband of the
+// topic's rule, are dropped. A changed value goes out at once if the rule's
+// minimum interval has passed since the last publish on the topic; otherwise
+// it is held, replacing any value held before it, and fnFlush() sends the
+// latest one when the interval is up. Traffic therefore follows the real
+// changes of each topic, at most one message per topic per interval,
+// whatever the rate of the bus.
+//
+// Rules are matched against the parameter name with fnmatch() patterns, the
+// first matching rule wins, and are resolved once per topic.
+
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <fnmatch.h>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define PUBLISH_MIN_INTERVAL_MS 1000
+#define PUBLISH_DEADBAND 0.0
+
+class PublishFilter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Rule {
+        std::chrono::milliseconds min_interval{PUBLISH_MIN_INTERVAL_MS};
+        double deadband = PUBLISH_DEADBAND;  // numeric values only
+    };
+
+    struct Message {
+        std::string_view topic;  // interned, see publish_topics.h
+        const std::string& device;
+        const std::string& param;
+        const std::string& value;
+        bool retain;
+    };
+
+    using EmitFn = std::function<void(const Message&)>;
+
+    explicit PublishFilter(EmitFn emit) : emit(std::move(emit)) {}
+
+    void fnAddRule(std::string param_pattern, Rule rule) {
+        std::lock_guard<std::mutex> lock(filter_mutex);
+        rules.emplace_back(std::move(param_pattern), rule);
+    }
+
+    // Offer a new value for a topic; it is published now, held or dropped
+    void fnOffer(std::string_view topic, const std::string& device, const std::string& param,
+                 std::string value, bool retain = false, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(filter_mutex);
+        auto [it, added] = topics.try_emplace(topic);
+        State& state = it->second;
+        if (added) {
+            state.device = device;
+            state.param = param;
+            state.rule = fnFindRule(param);
+        }
+
+        if (state.published && !fnChanged(state, value)) {
+            // Back to the published value, nothing to send
+            state.held = false;
+            return;
+        }
+        state.value = std::move(value);
+        state.retain = retain;
+        if (state.published && now - state.sent < state.rule.min_interval) {
+            state.held = true;
+            return;
+        }
+        fnEmit(topic, state, now);
+    }
+
+    // Publish the held values whose interval is up
+    void fnFlush(Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(filter_mutex);
+        for (auto& [topic, state] : topics) {
+            if (state.held && now - state.sent >= state.rule.min_interval) {
+                fnEmit(topic, state, now);
+            }
+        }
+    }
+
+    // Forget a topic, e.g. of a device that went away, so its next value is published
+    void fnForget(std::string_view topic) {
+        std::lock_guard<std::mutex> lock(filter_mutex);
+        topics.erase(topic);
+    }
+
+private:
+    struct State {
+        std::string device;
+        std::string param;
+        Rule rule;
+        std::string value;        // last published, or held when held is set
+        std::string published_value;
+        double published_number = NAN;
+        Clock::time_point sent;
+        bool published = false;
+        bool held = false;
+        bool retain = false;
+    };
+
+    static bool fnParseNumber(const std::string& text, double& number) {
+        const char* end = text.data() + text.size();
+        auto [ptr, ec] = std::from_chars(text.data(), end, number);
+        return ec == std::errc() && ptr == end;
+    }
+
+    // Caller holds filter_mutex
+    Rule fnFindRule(const std::string& param) const {
+        for (const auto& [pattern, rule] : rules) {
+            if (fnmatch(pattern.c_str(), param.c_str(), 0) == 0) {
+                return rule;
+            }
+        }
+        return Rule{};
+    }
+
+    static bool fnChanged(const State& state, const std::string& value) {
+        double number;
+        if (state.rule.deadband > 0 && !std::isnan(state.published_number) && fnParseNumber(value, number)) {
+            return std::fabs(number - state.published_number) > state.rule.deadband;
+        }
+        return value != state.published_value;
+    }
+
+    // Caller holds filter_mutex
+    void fnEmit(std::string_view topic, State& state, Clock::time_point now) {
+        state.published_value = state.value;
+        if (!fnParseNumber(state.value, state.published_number)) {
+            state.published_number = NAN;
+        }
+        state.published = true;
+        state.held = false;
+        state.sent = now;
+        emit(Message{topic, state.device, state.param, state.published_value, state.retain});
+    }
+
+    mutable std::mutex filter_mutex;
+    EmitFn emit;
+    std::vector<std::pair<std::string, Rule>> rules;
+    std::unordered_map<std::string_view, State> topics;
+};
+
+#endif // PUBLISH_FILTER_H
@@ -0,0 +1,105 @@
+#ifndef PUBLISH_TOPICS_H
+#define PUBLISH_TOPICS_H
+
+// MQTT topics of the bridge, resolved ahead of the publish path.
+//
+// Topic strings are interned: fnInternTopic() returns a view of a pooled
+// copy that lives for the rest of the program, so descriptors can hold
+// string_views and compare or pass them around without allocating.
+//
+// A PublishDescriptor is built once per subscribed signal, in fnUpdateSubs,
+// and holds everything recvCB needs to publish the signal: the signal to
+// decode, the translator that formats it, the MQTT parameter name and the
+// interned topic. DeviceTopics are the fixed topics of a device. Both are
+// only rebuilt when the device is renamed.
+
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "model_profile.h"
+
+#define STS_TOPIC_PREFIX "xnet/sts/"
+
+inline std::string_view fnInternTopic(std::string_view text) {
+    static std::mutex pool_mutex;
+    static std::set<std::string, std::less<>> pool;
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    auto it = pool.find(text);
+    if (it == pool.end()) {
+        it = pool.emplace(text).first;
+    }
+    return *it;
+}
+
+// Interned "xnet/sts/<device>/<param>"
+inline std::string_view fnStsTopic(std::string_view device, std::string_view param) {
+    std::string topic;
+    topic.reserve(sizeof(STS_TOPIC_PREFIX) + device.size() + param.size());
+    topic.append(STS_TOPIC_PREFIX).append(device).append("/").append(param);
+    return fnInternTopic(topic);
+}
+
+struct PublishDescriptor {
+    // What recvCB does with the value besides publishing it
+    enum Kind : uint8_t {
+        KIND_VALUE,
+        KIND_ALERTS,        // DiagMsg1, published through the DiagAlertTracker
+        KIND_OP_MODE,       // also feeds the inverter/charger OpState
+        KIND_INV_OP_STATE,
+        KIND_CHG_OP_STATE
+    };
+
+    std::string sig;           // signal decoded from the PGN
+    Qual qual;                 // signal values the message must carry
+    std::string translator;    // formats the value, empty for the plain signal value
+    std::string param;         // MQTT parameter name
+    std::string_view topic;    // interned, refreshed by fnSetDevice
+    Kind kind = KIND_VALUE;
+
+    PublishDescriptor(std::string_view pgn, std::string sig, Qual qual, std::string translator, std::string param)
+        : sig(std::move(sig)), qual(std::move(qual)), translator(std::move(translator)), param(std::move(param)) {
+        if (pgn == "DiagMsg1") {
+            kind = KIND_ALERTS;
+        } else if (this->param == "OpMode") {
+            kind = KIND_OP_MODE;
+        } else if (this->param == "InvOpState") {
+            kind = KIND_INV_OP_STATE;
+        } else if (this->param == "ChgOpState") {
+            kind = KIND_CHG_OP_STATE;
+        }
+    }
+
+    bool operator==(const PublishDescriptor& other) const {
+        return sig == other.sig && qual == other.qual && translator == other.translator && param == other.param;
+    }
+
+    void fnSetDevice(std::string_view device) {
+        topic = fnStsTopic(device, param);
+    }
+};
+
+struct DeviceTopics {
+    std::string_view status;
+    std::string_view network;
+    std::string_view manufacturer;
+    std::string_view model;
+    std::string_view serial_number;
+    std::string_view op_state;
+    std::string_view bpc_serial_num;
+
+    void fnSetDevice(std::string_view device) {
+        status = fnStsTopic(device, "status");
+        network = fnStsTopic(device, "network");
+        manufacturer = fnStsTopic(device, "Manufacturer");
+        model = fnStsTopic(device, "Model");
+        serial_number = fnStsTopic(device, "SerialNumber");
+        op_state = fnStsTopic(device, "OpState");
+        bpc_serial_num = fnStsTopic(device, "BpcSerialNum");
+    }
+};
+
+#endif // PUBLISH_TOPICS_H
@@ -0,0 +1,110 @@
+#ifndef REDIS_STREAM_SINK_H
+#define REDIS_STREAM_SINK_H
+
+// Optional telemetry sink appending decoded signal updates to per-device
+// Redis streams (xnet:sts:<device>). Updates are pipelined as
+// XADD <stream> MAXLEN ~ <n> * <param> <value> and committed in one write
+// once either the batch size or the flush interval is reached, so high-rate
+// data costs one round trip per batch instead of one per value.
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cpp_redis/cpp_redis>
+
+#define REDIS_STREAM_PREFIX "xnet:sts:"
+#define REDIS_STREAM_MAXLEN 10000
+#define REDIS_STREAM_BATCH_SIZE 256
+#define REDIS_STREAM_FLUSH_MS 200
+
+class RedisStreamSink {
+public:
+    RedisStreamSink(std::size_t maxlen = REDIS_STREAM_MAXLEN,
+                    std::size_t batch_size = REDIS_STREAM_BATCH_SIZE,
+                    std::chrono::milliseconds flush_interval = std::chrono::milliseconds(REDIS_STREAM_FLUSH_MS))
+        : maxlen(std::to_string(maxlen)), batch_size(batch_size), flush_interval(flush_interval),
+          last_flush(std::chrono::steady_clock::now()) {
+        cmd = {"XADD", "", "MAXLEN", "~", this->maxlen, "*", "", ""};
+    }
+
+    ~RedisStreamSink() {
+        fnFlush();
+    }
+
+    // Connect to the redis server; the sink stays disabled (fnAppend is a no-op) when this fails
+    bool fnConnect(const std::string& host = "127.0.0.1", std::size_t port = 6379) {
+        try {
+            client.connect(host, port, [](const std::string& host, std::size_t port, cpp_redis::connect_state status) {
+                if (status == cpp_redis::connect_state::dropped) {
+                    std::cerr << "Redis stream sink disconnected from " << host << ":" << port << std::endl;
+                }
+            }, 0, -1, 1000);
+        } catch (const cpp_redis::redis_error& e) {
+            std::cerr << "Redis stream sink disabled: " << e.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool fnEnabled() const {
+        return client.is_connected();
+    }
+
+    // Queue one signal update for the device stream, committing the pipeline when a threshold is reached
+    void fnAppend(const std::string& device, const std::string& param, const std::string& value) {
+        if (!fnEnabled()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(sink_mutex);
+        cmd[1].assign(REDIS_STREAM_PREFIX).append(device);
+        cmd[6] = param;
+        cmd[7] = value;
+        client.send(cmd, [](cpp_redis::reply& reply) {
+            if (reply.is_error()) {
+                std::cerr << "XADD failed: " << reply.error() << std::endl;
+            }
+        });
+
+        if (++pending >= batch_size) {
+            fnCommit();
+        }
+    }
+
+    // Commit pending updates once the flush interval expired; called periodically from the main loop
+    void fnPoll() {
+        std::lock_guard<std::mutex> lock(sink_mutex);
+        if (pending && std::chrono::steady_clock::now() - last_flush >= flush_interval) {
+            fnCommit();
+        }
+    }
+
+    void fnFlush() {
+        std::lock_guard<std::mutex> lock(sink_mutex);
+        if (pending) {
+            fnCommit();
+        }
+    }
+
+private:
+    // Caller holds sink_mutex
+    void fnCommit() {
+        client.commit();
+        pending = 0;
+        last_flush = std::chrono::steady_clock::now();
+    }
+
+    cpp_redis::client client;
+    std::mutex sink_mutex;
+    std::vector<std::string> cmd;
+    std::string maxlen;
+    std::size_t batch_size;
+    std::chrono::milliseconds flush_interval;
+    std::chrono::steady_clock::time_point last_flush;
+    std::size_t pending = 0;
+};
+
+#endif // REDIS_STREAM_SINK_H
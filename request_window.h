@@ -0,0 +1,131 @@
+#ifndef REQUEST_WINDOW_H
+#define REQUEST_WINDOW_H
+
+// Outstanding requests of one device.
+//
+// Every ISO request or PmReq sent to a device is recorded under the
+// (PGN, group function) of the response it asks for; for a PmReq the group
+// function of the response is the request ID, so the key identifies the
+// request exactly. An entry completes when the matching response arrives or
+// the device NAKs it, and is sent again by fnExpire() when its deadline
+// passes. At most REQ_WINDOW_SIZE requests are in flight per device, and a
+// request that got no response after REQ_MAX_TRIES is held off for
+// REQ_HOLDOFF_MS before the poller may ask for it again.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define REQ_WINDOW_SIZE 4
+#define REQ_TIMEOUT_MS 1000
+#define REQ_MAX_TRIES 3
+#define REQ_HOLDOFF_MS 5000
+
+class RequestWindow {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // True if the request is neither in flight nor held off and the window has room
+    bool fnCanSend(uint32_t pgn, int grpfunc, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        auto it = pending.find(fnKey(pgn, grpfunc));
+        if (it != pending.end()) {
+            if (it->second.in_flight || now < it->second.deadline) {
+                return false;
+            }
+            pending.erase(it);
+        }
+        return in_flight < REQ_WINDOW_SIZE;
+    }
+
+    // Record a request that was just sent; a resend keeps its try count
+    void fnSent(uint32_t pgn, int grpfunc, const std::string& pgn_mnem, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        Entry& entry = pending[fnKey(pgn, grpfunc)];
+        if (!entry.in_flight) {
+            entry = Entry{pgn_mnem, {}, 0, true};
+            in_flight++;
+        }
+        entry.tries++;
+        entry.deadline = now + std::chrono::milliseconds(REQ_TIMEOUT_MS);
+    }
+
+    // A response or NAK arrived; true if it answered an outstanding request
+    bool fnComplete(uint32_t pgn, int grpfunc) {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        auto it = pending.find(fnKey(pgn, grpfunc));
+        if (it == pending.end() || !it->second.in_flight) {
+            return false;
+        }
+        pending.erase(it);
+        in_flight--;
+        return true;
+    }
+
+    // A NAK that does not name the group function completes every request for the PGN
+    void fnCompleteAll(uint32_t pgn) {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (it->first >> 32 == pgn && it->second.in_flight) {
+                it = pending.erase(it);
+                in_flight--;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Mnemonics of requests past their deadline that should be sent again;
+    // requests out of tries leave the window and are held off
+    std::vector<std::string> fnExpire(Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        std::vector<std::string> resend;
+        for (auto& [key, entry] : pending) {
+            if (!entry.in_flight || now < entry.deadline) {
+                continue;
+            }
+            if (entry.tries < REQ_MAX_TRIES) {
+                resend.push_back(entry.pgn_mnem);
+            } else {
+                std::cerr << "No response to request for " << entry.pgn_mnem << std::endl;
+                entry.in_flight = false;
+                entry.deadline = now + std::chrono::milliseconds(REQ_HOLDOFF_MS);
+                in_flight--;
+            }
+        }
+        return resend;
+    }
+
+    size_t fnInFlight() const {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        return in_flight;
+    }
+
+    void fnClear() {
+        std::lock_guard<std::mutex> lock(window_mutex);
+        pending.clear();
+        in_flight = 0;
+    }
+
+private:
+    struct Entry {
+        std::string pgn_mnem;
+        Clock::time_point deadline;  // response timeout, or end of the hold-off
+        int tries = 0;
+        bool in_flight = false;
+    };
+
+    static uint64_t fnKey(uint32_t pgn, int grpfunc) {
+        return uint64_t(pgn) << 32 | uint32_t(grpfunc);
+    }
+
+    mutable std::mutex window_mutex;
+    std::unordered_map<uint64_t, Entry> pending;
+    size_t in_flight = 0;
+};
+
+#endif // REQUEST_WINDOW_H
@@ -38,15 +38,28 @@ using namespace std;
 #include <cstring>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <sstream>
 #include <algorithm>
-#include "XnetParams.h"
+#include "model_profile.h"
+#include "diag_alerts.h"
+#include "ppn_session.h"
+#include "request_window.h"
+#include "poll_scheduler.h"
+#include "publish_topics.h"
+#include "publish_filter.h"
+#include "mqtt_publisher.h"
+#include "instance_index.h"
 #include <fnmatch.h>
 #include <utility>
 #include "json.hpp"
 #include <set>
 #include <regex>
 #include <fstream>
+#ifdef USE_REDIS_STREAMS
+#include "redis_stream_sink.h"
+#endif
 
 using nlohmann::json;
 
@@ -80,9 +93,38 @@ std::ofstream errors("errors.txt");
 
 #include <nlohmann/json.hpp>
 
+// Guards devices, device_names and instances; they are changed both by the
+// stack callbacks on the tick thread and by the main loop
 std::mutex devices_mutex;
 
-struct mosquitto *mosq = mosquitto_new(nullptr, true, nullptr);
+#define RVC_STATUS_TOPIC "xnet/sts/rvc/status"
+
+// Created in main once mosquitto_lib_init() has run
+struct mosquitto *mosq = nullptr;
+std::unique_ptr<MqttPublisher> mqtt_publisher;
+
+// Signal that asked the bridge to stop; the handlers only set this and
+// main shuts down once the loops have seen it
+std::atomic<int> shutdown_signal{0};
+static_assert(std::atomic<int>::is_always_lock_free, "shutdown_signal is set from a signal handler");
+
+#ifdef USE_REDIS_STREAMS
+RedisStreamSink redis_sink;
+#endif
+
+// Values reach MQTT and the redis stream through the publish filter, which
+// drops unchanged values and coalesces bursts per topic
+PublishFilter publish_filter([](const PublishFilter::Message& msg) {
+    mqtt_publisher->fnPublish(msg.topic, msg.value, msg.retain);
+#ifdef USE_REDIS_STREAMS
+    redis_sink.fnAppend(msg.device, msg.param, msg.value);
+#endif
+});
+
+// topic must be interned, see publish_topics.h
+void fnPublish(std::string_view topic, const string& device, const string& param, string value, bool retain = false) {
+    publish_filter.fnOffer(topic, device, param, std::move(value), retain);
+}
 
 auto start_time = std::chrono::high_resolution_clock::now();
 
@@ -108,6 +150,7 @@ auto start_time = std::chrono::high_resolution_clock::now();
 #define eSTATUS_ERR 2
 
 #define REREQ_TIMEOUT 5
+#define STATS_PERIOD_S 10
 
 int c;
 
@@ -163,23 +206,29 @@ std::vector<std::string> split(const std::string& s, char delimiter) {
     return tokens;
 }
 
-// int dupe_count = 0;
+// Name -> address of the device publishing under that name, kept in sync by
+// fnChangeName and the node change callback
+std::unordered_map<std::string, uchar8> device_names;
+
+// Devices that reported an instance, grouped by (func, inst, inst2), kept in
+// sync by fnHandleInstChange, fnRecvProdIdent and the node change callback
+InstanceIndex instances;
 
-void printSubscriptions(const std::unordered_map<std::string, std::set<std::tuple<std::string, std::vector<std::tuple<std::string, std::string>>, std::string, std::string>>>& subscriptions) {
+void printSubscriptions(const std::unordered_map<std::string, std::vector<PublishDescriptor>>& subscriptions) {
     for (const auto& entry : subscriptions) {
         std::cout << "Key: " << entry.first << std::endl;
 
-        for (const auto& tupleEntry : entry.second) {
-            std::cout << "Tuple Elements:" << std::endl;
-            std::cout << "  - " << std::get<0>(tupleEntry) << std::endl;
+        for (const PublishDescriptor& desc : entry.second) {
+            std::cout << "Descriptor:" << std::endl;
+            std::cout << "  - " << desc.sig << std::endl;
 
-            for (const auto& innerTuple : std::get<1>(tupleEntry)) {
+            for (const auto& innerTuple : desc.qual) {
                 std::cout << "    Inner Tuple Elements:" << std::endl;
                 std::cout << "      - " << std::get<0>(innerTuple) << " : " << std::get<1>(innerTuple) << std::endl;
             }
 
-            std::cout << "  - " << std::get<2>(tupleEntry) << std::endl;
-            std::cout << "  - " << std::get<3>(tupleEntry) << std::endl;
+            std::cout << "  - " << desc.translator << std::endl;
+            std::cout << "  - " << desc.param << " -> " << desc.topic << std::endl;
         }
 
         std::cout << "---------------------------" << std::endl;
@@ -198,13 +247,14 @@ public:
     //                                 //  "*batt*/HiVoltLimitSts", 
     //                                  };
     std::vector<std::string> active_subscriptions = {"status", "Alerts"};
-    std::unordered_map<string, std::tuple<string, string>> ppn_subscriptions = {};
-    std::unordered_map<std::string, std::set< std::tuple<std::string, std::vector<std::tuple<std::string, std::string>>, std::string, std::string>> > subscriptions = {};
+    std::unordered_map<string, PublishDescriptor> ppn_subscriptions = {};
+    std::unordered_map<std::string, std::vector<PublishDescriptor>> subscriptions = {};
     int state = STATE_IDLE;
     string make;
     string model;
     string serial;
     string name = "unk?";
+    DeviceTopics topics;
     string func = "unk"; 
     string opmode = "Operating";
     string invstate = "";
@@ -214,61 +264,153 @@ public:
     int inst = -1; 
     int inst2 = -1; 
     int addr = -1;
-    ParamCmdMap param_map;
-    ParamCmdMap cmd_map;
-    Fault fault_lookup;
-    Warning warning_lookup;
+    ModelProfile profile;
+    DiagAlertTracker alerts;
+    PpnSession ppn;
+    string bpc_serial_num;
     std::unordered_map<std::string, std::chrono::time_point<std::chrono::high_resolution_clock>> msgtimes;
-    bool sent = false;
+    RequestWindow requests;
+    PollScheduler poller{std::chrono::seconds(REREQ_TIMEOUT), std::random_device{}()};
 
-    void fnSendRequest(std::string pgn){
-        uint32 ulPgn;
-        
-        if(PGNREVERSE.find(pgn) != PGNREVERSE.end()){
-            // disable_sigalarm();
-            // cout << "disable" << endl;
-            ulPgn = PGNREVERSE[pgn].first;
-            // cout << ulPgn << endl;
-
-            if(ulPgn == RVC_PGN_PM_REQ){
-                if(!sent){
-                    // XBMSG_fnControlDynamic(ulPgn, true);
-                    // cout << "153" << endl;
-                    RVC_tzPGN_PM_REQ pmreq;
-                    pmreq.teMsgId = RVC_ePROP_MSG_ID_REQUEST;
-                    pmreq.teReqId = static_cast<RVC_tePROP_MSG_ID>(PGNREVERSE[pgn].second);
-                    pmreq.ucParam1 = 0;
-                    pmreq.ucParam2 = 0;
-                    // pmreq.uiCrc = 0;
-                    // cout << pmreq.teReqId << endl;
-                    // cout << (int)addr << endl;
-
-                    XBMSG_fnSendEx( ulPgn, PGNREVERSE["PmReq"].second, &pmreq, sizeof( pmreq ), addr );
-                    sent = true;
-                }
+    SubscriptionList() {
+        ppn.fnSetSender([this](std::string_view pgn_mnem, const std::string& arg, const std::string& value) {
+            fnSendPpnCmd(pgn_mnem, arg, value);
+        });
+    }
+
+    // Request a PGN unless the same request is outstanding or the in-flight
+    // window is full; false if nothing was sent
+    bool fnSendRequest(std::string pgn){
+        auto it = PGNREVERSE.find(pgn);
+        if(it == PGNREVERSE.end()){
+            cout << "no pgn" << endl;
+            return false;
+        }
+
+        auto [ulPgn, grpfunc] = it->second;
+        if(!requests.fnCanSend(ulPgn, grpfunc)){
+            return false;
+        }
+        fnResendRequest(pgn);
+        return true;
+    }
+
+    // Send a request again without checking the window
+    void fnResendRequest(const std::string& pgn){
+        auto [ulPgn, grpfunc] = PGNREVERSE[pgn];
+
+        if(ulPgn == RVC_PGN_PM_REQ){
+            RVC_tzPGN_PM_REQ pmreq;
+            pmreq.teMsgId = RVC_ePROP_MSG_ID_REQUEST;
+            pmreq.teReqId = static_cast<RVC_tePROP_MSG_ID>(grpfunc);
+            pmreq.ucParam1 = 0;
+            pmreq.ucParam2 = 0;
+            // pmreq.uiCrc = 0;
+
+            XBMSG_fnSendEx( ulPgn, PGNREVERSE["PmReq"].second, &pmreq, sizeof( pmreq ), addr );
+        }
+        else{
+            XBMSG_fnControlDynamic(ulPgn, true);
+            XBMSG_fnISOReq(ulPgn, addr);
+        }
+        requests.fnSent(ulPgn, grpfunc, pgn);
+    }
+
+    // Complete the outstanding request a received PGN answers; false if the
+    // PGN was not requested
+    bool fnCompleteRequest(const PGN_tzRECV_DATA* ptzRecv){
+        if(ptzRecv->ulPgn == RVC_PGN_ISO_ACK){
+            const RVC_tzPGN_ISO_ACK* ack = (const RVC_tzPGN_ISO_ACK*)ptzRecv->pvStruct;
+            if(ack->teCtrlByte == RVC_eACK_STS_ACK){
+                return false;
+            }
+            // A NAK or denial is final, don't retry it
+            if(ack->teGroupFunctionValue == RVC_eGRP_FUNC_VALUE_DO_NOT_CARE || (int)ack->teGroupFunctionValue == 0xFF){
+                requests.fnCompleteAll(ack->ulParmGrpNum);
             }
             else{
-                // cout << "163" << endl;
-                // cout << ulPgn << endl;
-                // cout << addr << endl;
-                XBMSG_fnControlDynamic(ulPgn, true);
-                XBMSG_fnISOReq(ulPgn, addr);
+                requests.fnComplete(ack->ulParmGrpNum, ack->teGroupFunctionValue);
             }
-            // enable_sigalarm();
-            // cout << "enable" << endl;
+            return false;
         }
-        else{
-            cout << "no pgn" << endl;
+        return requests.fnComplete(ptzRecv->ulPgn, ptzRecv->siGrpFunc);
+    }
+
+    // Resend requests whose response is overdue
+    void fnExpireRequests(){
+        for(const string& pgn : requests.fnExpire()){
+            times << "time resend: " << pgn << " inst: " << inst << endl;
+            fnResendRequest(pgn);
+        }
+    }
+
+    // PmPpnReadCmd/PmPpnSessionCmd/PmPpnWriteCmd for the PPN session
+    void fnSendPpnCmd(std::string_view pgn_mnem, const std::string& arg, const std::string& value) {
+        string pgn(pgn_mnem);
+        std::unique_ptr<MessageBase> msg = fnMessageTypesDef()[pgn]();
+        auto [ulPgn, grpfunc] = PGNREVERSE[pgn];
+
+        msg->fnSetValue("MsgId", std::to_string(grpfunc));
+        if (pgn == "PmPpnSessionCmd") {
+            msg->fnSetValue("SessEnDis", arg);
+        } else {
+            msg->fnSetValue("ParamId", arg);
+        }
+        if (!value.empty()) {
+            // Little-endian in Value0..Value3, Value4/5 stay not available
+            uint32 raw = strtoul(value.c_str(), nullptr, 0);
+            for (int i = 0; i < 4; i++) {
+                msg->fnSetValue("Value" + std::to_string(i), std::to_string((raw >> (8 * i)) & 0xff));
+            }
+        }
+        msg->fnSend(ulPgn, grpfunc, addr);
+    }
+
+    // This is the ZeroRPM battery responding to a PmPpnReadCmd message
+    // for a subscribed proprietary parameter
+    void fnHandlePmPpnReadRsp(const MessageBase& msg) {
+        string param_mnem = msg.fnGetValue("ParamId");
+        uint32 raw = 0;
+        for (int i = 0; i < 4; i++) {
+            raw |= (msg.fnGetRawValue("Value" + std::to_string(i)) & 0xff) << (8 * i);
+        }
+        string value = std::to_string(raw);
+        const string* param;
+        std::string_view topic;
+
+        auto it = ppn_subscriptions.find(param_mnem);
+        if (it != ppn_subscriptions.end()) {
+            const PublishDescriptor& desc = it->second;
+            if (!desc.translator.empty()) {
+                value = msg.fnTranslate(desc.translator);
+            }
+            param = &desc.param;
+            topic = desc.topic;
+        }
+        // Is this for the BPC serial number, which comes in two parts?
+        else if (param_mnem == "BpcSerialNum1") {
+            bpc_serial_num = value;
+            return;
+        }
+        else if (param_mnem == "BpcSerialNum2") {
+            static const string bpc_param = "BpcSerialNum";
+            value = bpc_serial_num + value;
+            param = &bpc_param;
+            topic = topics.bpc_serial_num;
+        }
+        else {
             return;
         }
+
+        fnPublish(topic, name, *param, std::move(value));
     }
 
     void fnPollSubscriptions() {
         for (auto& pgn : subscriptions) {
             auto& values = pgn.second;
             string pgn_mnem = pgn.first;
-            if (msgtimes.find(pgn_mnem) == msgtimes.end() ||
-                std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - msgtimes[pgn_mnem]).count() > REREQ_TIMEOUT) {
+            // PGNs the device broadcasts on its own are not requested
+            if (poller.fnDue(pgn_mnem)) {
                 if (pgn_mnem.empty()) {
                     continue;
                 }
@@ -290,8 +432,11 @@ public:
                     // Simple ISO request or parameterless PmReq
                     // std::cout << "939" << std::endl;
                     // std::cout << pgn_mnem << std::endl;
-                    times << "time send: " << pgn_mnem << " inst: " << inst << " time: " << std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - msgtimes[pgn_mnem]).count() << endl;
-                    fnSendRequest(pgn_mnem);
+                    // Skipped while the same request is outstanding or the window is full
+                    if (fnSendRequest(pgn_mnem)) {
+                        poller.fnRequested(pgn_mnem);
+                        times << "time send: " << pgn_mnem << " inst: " << inst << " time: " << std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - msgtimes[pgn_mnem]).count() << endl;
+                    }
 
                     // Wait for response
                     // std::unique_lock<std::mutex> lock(mutex);
@@ -320,8 +465,8 @@ public:
             opstate = invstate;
         }
 
-        string topic =  "xnet/sts/" + name + "/OpState";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), opstate.size(), opstate.c_str(), 0, false);
+        static const string param = "OpState";
+        fnPublish(topics.op_state, name, param, opstate);
     }
 
     void fnUpdateSubs(std::vector<std::string> subs){
@@ -330,6 +475,7 @@ public:
     // for (const std::string& sub : subs) {
     //     std::cout << sub << std::endl;
     // }
+        std::vector<std::string> ppn_reads;
         ppn_subscriptions.clear();
         subscriptions.clear();
         for (const std::string& topic : subs) {
@@ -348,8 +494,11 @@ public:
             // cout << topic << endl;
 
             // if (fnmatch(topic_param.c_str(), topic_dev.c_str(), 0) == 0){
-            if(param_map.find(topic) != param_map.end()){
-                auto [pgn, sig, qual, translator] = param_map[topic];
+            if(auto spec = profile.fnFindParam(topic)){
+                string pgn(spec->pgn);
+                string sig(spec->sig);
+                Qual qual = spec->fnQual();
+                string translator(spec->translator);
                 if (pgn == "ProdIdent"){
                     mqtt << "it is prod" << endl;
                     continue;
@@ -357,7 +506,10 @@ public:
 
                 if (pgn == "PmPpnReadRsp"){
                     mqtt << "it is PmPpnReadRsp" << endl;
-                    ppn_subscriptions[sig] = std::make_tuple(translator, topic);
+                    PublishDescriptor desc(pgn, sig, qual, translator, topic);
+                    desc.fnSetDevice(name);
+                    ppn_subscriptions.insert_or_assign(sig, std::move(desc));
+                    ppn_reads.push_back(sig);
                 }
                 else{
                     mqtt << "insert- pgn: " << pgn << " translator: " << translator << " topic: " << topic << " qual: " << endl;
@@ -368,7 +520,12 @@ public:
                     //     subscriptions[pgn] = std::vector< std::tuple<std::string, std::vector<std::tuple<std::string, std::string>>, std::string, std::string>>();
                     // }
                     // if (std::find(subscriptions[pgn].begin(), subscriptions[pgn].end(), (sig, qual, translator, topic_param)) == subscriptions[pgn].end()) {
-                    subscriptions[pgn].insert(std::make_tuple(sig, qual, translator, topic));
+                    PublishDescriptor desc(pgn, sig, qual, translator, topic);
+                    auto& descs = subscriptions[pgn];
+                    if (std::find(descs.begin(), descs.end(), desc) == descs.end()) {
+                        desc.fnSetDevice(name);
+                        descs.push_back(std::move(desc));
+                    }
                     mqtt << "inserted" << endl;
                     // }
                 }
@@ -379,6 +536,7 @@ public:
             //}
 
         }
+        ppn.fnSetReads(std::move(ppn_reads));
     }
 
     void fnUpdateFixedSubscriptions(){
@@ -414,7 +572,6 @@ public:
         cout << func << endl;
         cout << addr << endl;
         string newname;
-        string topic;
 
         if(func == "bms"){
             newname = "bank" + to_string(newinst) + "batt" + to_string(newinst2);
@@ -447,14 +604,19 @@ public:
             // if(is_dupe){
             //     dupe_count--;
             // }
-            const char* message = "offline";
-            topic =  "xnet/sts/" + name + "/status";
-            //mosquitto_publish(mosq, nullptr, topic.c_str(), strlen(message), message, 0, true);
+            fnPublish(topics.status, name, "status", "offline", true);
         }
         
         inst = newinst;
         inst2 = newinst2;
+        auto old_name = device_names.find(name);
+        if (old_name != device_names.end() && old_name->second == addr) {
+            device_names.erase(old_name);
+        }
+        device_names[newname] = addr;
+        fnForgetTopics();
         name = newname;
+        fnRefreshTopics();
         
         // if(is_dupe){
         //     dupe_count++;
@@ -476,18 +638,43 @@ public:
         
         // //mosquitto_publish(mosq, nullptr, "xnet/sts/rvc/Alerts", message.size(), message.c_str(), 0, true);
 
-        topic = "xnet/sts/" + name + "/status";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), strlen("online"), "online", 0, true);
-        topic = "xnet/sts/" + name + "/network";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), strlen("rvc"), "rvc", 0, true);
+        fnPublish(topics.status, name, "status", "online", true);
+        fnPublish(topics.network, name, "network", "rvc", true);
+
+        fnPublish(topics.manufacturer, name, "Manufacturer", make, true);
+        fnPublish(topics.model, name, "Model", model, true);
+        fnPublish(topics.serial_number, name, "SerialNumber", serial, true);
 
-        topic = "xnet/sts/" + name + "/Manufacturer";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), make.size(), make.c_str(), 0, true);
-        topic = "xnet/sts/" + name + "/Model";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), model.size(), model.c_str(), 0, true);
-        topic = "xnet/sts/" + name + "/SerialNumber";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), serial.size(), serial.c_str(), 0, true);
+    }
 
+    // Drop the publish filter state of the device topics, once they are no
+    // longer used; status is kept so a pending "offline" still goes out
+    void fnForgetTopics(){
+        for (std::string_view topic : {topics.network, topics.manufacturer, topics.model,
+                                       topics.serial_number, topics.op_state, topics.bpc_serial_num}) {
+            publish_filter.fnForget(topic);
+        }
+        for (const auto& [pgn, descs] : subscriptions) {
+            for (const PublishDescriptor& desc : descs) {
+                publish_filter.fnForget(desc.topic);
+            }
+        }
+        for (const auto& [sig, desc] : ppn_subscriptions) {
+            publish_filter.fnForget(desc.topic);
+        }
+    }
+
+    // Resolve the device and subscription topics for the current name
+    void fnRefreshTopics(){
+        topics.fnSetDevice(name);
+        for (auto& [pgn, descs] : subscriptions) {
+            for (PublishDescriptor& desc : descs) {
+                desc.fnSetDevice(name);
+            }
+        }
+        for (auto& [sig, desc] : ppn_subscriptions) {
+            desc.fnSetDevice(name);
+        }
     }
 };
 
@@ -496,48 +683,41 @@ public:
 std::unordered_map<uchar8, SubscriptionList> devices;
 
 void fnPublishInstAlerts(){
-    int i =0 ;
     json alerts;
     alerts["faults"] = json::array();
     alerts["warnings"] = json::array();
 
-    for (auto& dev: devices){
-        if (dev.second.is_dupe == true){
-            i++;
-        }
-    }
-    if ( i > 0){
+    if (instances.fnDuplicates() > 0){
         json fault = {
             {"code", 1},
             {"desc", "Duplicate device instances found"}
         };
         alerts["faults"].push_back(fault);
     }
-    string message = alerts.dump();
-    //mosquitto_publish(mosq, nullptr, "xnet/sts/rvc/Alerts", message.size(), message.c_str(), 0, true);
+    static const std::string_view topic = fnStsTopic("rvc", "Alerts");
+    fnPublish(topic, "rvc", "Alerts", alerts.dump(), true);
+}
+
+// A device that leaves a group of duplicates may leave a single device
+// behind, which then gets its plain name back
+void fnReleaseDupes(const InstanceIndex::Group& left) {
+    if (left.size() == 1) {
+        SubscriptionList& other = devices[left.front()];
+        if (other.is_dupe) {
+            other.fnChangeName(other.inst, other.inst2, false);
+        }
+    }
 }
 
 void fnHandleInstChange(SubscriptionList& device, int newinst, int newinst2 = -1) {
-    bool dupes = false;
-    // auto old_dupes;
-
-    for (auto& dev : devices) {
-        if (dev.second.addr != device.addr) {
-            if (dev.second.func == device.func) {
-                if ((dev.second.inst == newinst) && (dev.second.inst2 == newinst2)) {
-                    dupes = true;
-                    cout << "542" << endl;
-                    cout << dev.second.inst << endl;
-                    cout << dev.second.inst2 << endl;
-                    cout << true << endl;
-                    dev.second.fnChangeName(dev.second.inst, dev.second.inst2, true);
-                }
-                // if (devmgr.inst != nullptr) {
-                //     if ((dm.inst == devmgr.inst) && (dm.inst2 == devmgr.inst2)) {
-                //         old_dupes.push_back(&dm);
-                //     }
-                // }
-            }
+    fnReleaseDupes(instances.fnRemove(device.addr));
+    const InstanceIndex::Group& group = instances.fnAdd(device.addr, device.func, newinst, newinst2);
+    bool dupes = group.size() > 1;
+
+    for (uchar8 addr : group) {
+        if (addr != device.addr) {
+            SubscriptionList& other = devices[addr];
+            other.fnChangeName(other.inst, other.inst2, true);
         }
     }
 
@@ -677,7 +857,7 @@ tuiSTATUS fnExternSaveCB(XB_tePARAM_TYPE teType, XB_teCFG_TYPE teCfgType, void *
 void fnExternNodeChangeCB(XB_teNODE_CHANGE teChange, uchar8 ucOldAddr, uchar8 ucNewAddr, XB_tzPGN_ISO_ADDR_CLAIM *ptzNAME) {
     errors << "Node Change Callback called" << std::endl;
     // Callback implementation
-    // std::unique_lock<std::mutex> lock(devices_mutex);
+    std::lock_guard<std::mutex> lock(devices_mutex);
     if (teChange == XB_eNODE_CHANGE_NEW_NODE){
         c = ucNewAddr;
         devices[ucNewAddr].addr = ucNewAddr;
@@ -702,44 +882,33 @@ void fnExternNodeChangeCB(XB_teNODE_CHANGE teChange, uchar8 ucOldAddr, uchar8 uc
         new_devmgr.addr = ucNewAddr;
 
         new_devmgr.func = old_devmgr.func;
+        new_devmgr.profile = old_devmgr.profile;
+        new_devmgr.alerts = std::move(old_devmgr.alerts);
         new_devmgr.inst = old_devmgr.inst;
         new_devmgr.inst2 = old_devmgr.inst2;
+        new_devmgr.is_dupe = old_devmgr.is_dupe;
         new_devmgr.name = old_devmgr.name;
+        new_devmgr.topics = old_devmgr.topics;
+        if (device_names.count(old_devmgr.name) && device_names[old_devmgr.name] == ucOldAddr) {
+            device_names[old_devmgr.name] = ucNewAddr;
+        }
         new_devmgr.subscriptions = old_devmgr.subscriptions;
+        instances.fnMove(ucOldAddr, ucNewAddr);
 
         devices.erase(ucOldAddr);
     }
     else if (teChange == XB_eNODE_CHANGE_BUMPED_OFF || teChange == XB_eNODE_CHANGE_TIMED_OUT){
         SubscriptionList& old_devmgr = devices[ucOldAddr];
         
-        const char* message = "offline";
-        string topic =  "xnet/sts/" + old_devmgr.name + "/status";
-        //mosquitto_publish(mosq, nullptr, topic.c_str(), strlen(message), message, 0, true);
-
-        int i = 0;
-        int address = -1;
-        if(old_devmgr.is_dupe){
-            for(auto & dev: devices){
-                if(dev.second.addr != ucOldAddr){
-                    if ((dev.second.func == old_devmgr.func)
-                            && (dev.second.inst == old_devmgr.inst)
-                            && (dev.second.inst2 == old_devmgr.inst2)){
-                                address = dev.second.addr;
-                                i++;
-                            }
-                }
-            }
-        }
+        fnPublish(old_devmgr.topics.status, old_devmgr.name, "status", "offline", true);
 
-        if(i==1 && address != -1){
-            cout << "745" << endl;
-            cout << devices[address].inst << endl;
-            cout << devices[address].inst2 << endl;
-            cout << false << endl;
+        fnReleaseDupes(instances.fnRemove(ucOldAddr));
 
-            devices[address].fnChangeName(devices[address].inst, devices[address].inst2, false);
+        auto old_name = device_names.find(old_devmgr.name);
+        if (old_name != device_names.end() && old_name->second == ucOldAddr) {
+            device_names.erase(old_name);
         }
-
+        old_devmgr.fnForgetTopics();
         devices.erase(ucOldAddr);
         errors << (int)ucOldAddr << " gone offline" << endl;
         cout << (int)ucOldAddr << " gone offline" << endl;
@@ -782,8 +951,13 @@ void fnListen( uint32 ulPgn,
     XBMSG_fnControlDynamic( ulPgn, bEnable );
 }
 
+// The fnListen handlers get their PGNs instead of recvCB, so each ends by
+// passing the message on to fnRecvDeviceMsg like recvCB does
+void fnRecvDeviceMsg(SubscriptionList& device, PGN_tzRECV_DATA *ptzRecv);
+
 void fnRecvProdIdent(PGN_tzRECV_DATA *ptzRecv){
     cout << "579" << endl;
+    std::lock_guard<std::mutex> lock(devices_mutex);
     if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "ProdIdent"){
         devices[ptzRecv->ucSrcAddr].msgtimes["ProdIdent"] = std::chrono::high_resolution_clock::now();
         cout << "581" << endl;
@@ -796,12 +970,15 @@ void fnRecvProdIdent(PGN_tzRECV_DATA *ptzRecv){
     string model = devices[src].model = msg.fnGetValue("Model");
     string serial = devices[src].serial = msg.fnGetValue("Serial");
                             // self.func, self.param_map, self.cmd_map, self.fault_lookup, self.warning_lookup = MODEL_MAP[self.model]
-    if (MODEL_MAP.find(model) != MODEL_MAP.end()) {
-        devices[src].func = std::get<0>(MODEL_MAP[model]);
-        devices[src].param_map = std::get<1>(MODEL_MAP[model]);
-        devices[src].cmd_map = std::get<2>(MODEL_MAP[model]);
-        devices[src].fault_lookup = std::get<3>(MODEL_MAP[model]);
-        devices[src].warning_lookup = std::get<4>(MODEL_MAP[model]);
+    if (ModelProfile profile = fnGetModelProfile(model)) {
+        bool regroup = devices[src].func != profile.fnFunc() && instances.fnContains(src);
+        devices[src].func = profile.fnFunc();
+        devices[src].profile = profile;
+        if (regroup) {
+            // Instance came first; regroup and rename under the real function
+            fnHandleInstChange(devices[src], devices[src].inst, devices[src].inst2);
+        }
+        devices[src].alerts.fnSetProfile(profile);
     } else {
         cout << "not supporting device" << endl;
         cout << serial << endl;
@@ -817,11 +994,13 @@ void fnRecvProdIdent(PGN_tzRECV_DATA *ptzRecv){
     //     //mosquitto_publish(mosq, nullptr, topic.c_str(), serial.size(), serial.c_str(), 0, true);
 
     // }
+        fnRecvDeviceMsg(devices[src], ptzRecv);
     }
 }
 
 void fnRecvInstSts(PGN_tzRECV_DATA *ptzRecv){
     cout << "597" << endl;
+    std::lock_guard<std::mutex> lock(devices_mutex);
     if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "InstSts"){
         devices[ptzRecv->ucSrcAddr].msgtimes["InstSts"] = std::chrono::high_resolution_clock::now();
         cout << "599" << endl;
@@ -830,10 +1009,12 @@ void fnRecvInstSts(PGN_tzRECV_DATA *ptzRecv){
         if (devices[ptzRecv->ucSrcAddr].inst != newinst){
             fnHandleInstChange(devices[ptzRecv->ucSrcAddr], newinst);
         }
+        fnRecvDeviceMsg(devices[ptzRecv->ucSrcAddr], ptzRecv);
     }
 }
 
 void fnRecvSccSts(PGN_tzRECV_DATA *ptzRecv){
+    std::lock_guard<std::mutex> lock(devices_mutex);
     if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "SccSts"){
         cout << "599" << endl;
         SccSts msg(ptzRecv->pvStruct);
@@ -841,10 +1022,12 @@ void fnRecvSccSts(PGN_tzRECV_DATA *ptzRecv){
         if (devices[ptzRecv->ucSrcAddr].inst != newinst){
             fnHandleInstChange(devices[ptzRecv->ucSrcAddr], newinst);
         }
+        fnRecvDeviceMsg(devices[ptzRecv->ucSrcAddr], ptzRecv);
     }
 }
 
 void fnRecvBattSts6(PGN_tzRECV_DATA *ptzRecv) {
+    std::lock_guard<std::mutex> lock(devices_mutex);
     if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "BattSts6"){
         cout << "599" << endl;
         BattSts6 msg(ptzRecv->pvStruct);
@@ -853,106 +1036,93 @@ void fnRecvBattSts6(PGN_tzRECV_DATA *ptzRecv) {
         if (devices[ptzRecv->ucSrcAddr].inst != bankinst || devices[ptzRecv->ucSrcAddr].inst2 != battinst){
             fnHandleInstChange(devices[ptzRecv->ucSrcAddr], bankinst, battinst);
         }
+        fnRecvDeviceMsg(devices[ptzRecv->ucSrcAddr], ptzRecv);
     }
 }
 
-std::queue<PGN_tzRECV_DATA*> recvDataQueue;
+void recvCB(PGN_tzRECV_DATA *ptzRecv);
 
+// Decoded and published on the tick thread under devices_mutex, while
+// ptzRecv and the message it points to are still valid; they are released
+// when this returns
 void fnExternRecvCB(PGN_tzRECV_DATA *ptzRecv) {
-    recvDataQueue.push(ptzRecv);
-    return;
-
+#ifdef RVC_TRACE
+    // Decoded dump of every received message (build with -DRVC_TRACE)
+    printall(ptzRecv);
+#endif
+    recvCB(ptzRecv);
 }
 
-void recvCB() {
+void recvCB(PGN_tzRECV_DATA *ptzRecv) {
     // printall(ptzRecv);
     // std::this_thread::sleep_for(std::chrono::milliseconds(500));
     // cout << "770" << endl;
     // cout << ptzRecv->ulPgn << endl;
     // cout << ptzRecv->siGrpFunc << endl;
     // cout << PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] << endl;
-    // std::unique_lock<std::mutex> lock(devices_mutex);
-    if (!recvDataQueue.empty()) {
-    PGN_tzRECV_DATA* ptzRecv = recvDataQueue.front(); 
-    recvDataQueue.pop(); 
-
-    SubscriptionList& device = devices[ptzRecv->ucSrcAddr];
-    if(RVC_PGN_PM_REQ == ptzRecv->ulPgn) {
-        device.sent = false;
-        cout << "800" << endl;
-    }
+    std::lock_guard<std::mutex> lock(devices_mutex);
+    fnRecvDeviceMsg(devices[ptzRecv->ucSrcAddr], ptzRecv);
+}
+
+// Caller holds devices_mutex. Completes the request the message answers,
+// shows it to the poller and publishes the subscribed signals it carries.
+void fnRecvDeviceMsg(SubscriptionList& device, PGN_tzRECV_DATA *ptzRecv) {
+    bool solicited = device.fnCompleteRequest(ptzRecv);
     if(device.state == STATE_PROCESSING_RESPONSE){
-        string pgn = PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)];
+        const string& pgn = PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)];
 
         device.msgtimes[pgn] = std::chrono::high_resolution_clock::now();
+        device.poller.fnObserve(pgn, solicited);
+        if (pgn.compare(0, 5, "PmPpn") == 0 || pgn == "IsoAck") {
+            if (pgn == "PmPpnReadRsp") {
+                device.fnHandlePmPpnReadRsp(PmPpnReadRsp(ptzRecv->pvStruct));
+            }
+            device.ppn.fnDeliver(pgn);
+        }
+#ifdef RVC_TRACE
         // times << "inst: " << device.inst << " time recv: " << (device.msgtimes[pgn]).count() << endl;
         auto time_since_epoch = std::chrono::duration_cast<std::chrono::seconds>(device.msgtimes[pgn] - start_time).count();
         times << "pgn: " << pgn << " inst: " << device.inst << " time recv: " << time_since_epoch << endl;
+#endif
 
-        if (device.subscriptions.find(pgn) != device.subscriptions.end()) {
+        auto subs = device.subscriptions.find(pgn);
+        if (subs != device.subscriptions.end()) {
             // std::cout << "Key exists in the map." << std::endl;
-            if (message_types.find(pgn) != message_types.end()) {
-                std::shared_ptr<MessageBase> message_instance = message_types[pgn](ptzRecv->pvStruct);
-                // cout << "836" << endl;
-                // cout << pgn << endl;
-                // cout << device.subscriptions[pgn].size() << endl;
-                for (const auto& values : device.subscriptions[pgn]) {
-                    if (message_instance->fnQualPasses(get<1>(values))){
-                        if(pgn == "DiagMsg1"){
-                            //DiagMsgHandler.fnUpdateAlerts(self, msg)
-                            // cout << "  DiagMsg1" << endl;
-                        }
-                        // else if (pgn == "DCSrcSts1"){
-                        //     cout << "834" << endl;
-                        //     cout << pgn << endl;
-                        //     string value = message_instance->fnGetValue(get<0>(values));
-                        //     string topic = "xnet/sts/" + device.name + "/" + get<3>(values);
-                        //     cout << topic << endl;
-                        //     cout << value << endl;
-                        //     //mosquitto_publish(mosq, nullptr, topic.c_str(), value.size(), value.c_str(), 0, true);
-                        
-                        // 834
-                        // InvSts
-                        // Handling MQTT Subscribe: xgw, []
-                        // xnet/sts/invchg3_node67/E
-                        // no pgn
-                        // Segmentation fault occurred. Exiting program.
-
-                        // }
-                        else{                    
-                            // cout << "834" << endl;
-                            // cout << pgn << endl;
-                            string signal = get<0>(values);
-                            string func = get<2>(values);
-                            string value = message_instance->fnGetValue(signal);
-                            if (!func.empty()){
-                                value = message_instance->fnTranslate(func);
+            auto message_type = fnMessageTypes().find(pgn);
+            if (message_type != fnMessageTypes().end()) {
+                std::shared_ptr<MessageBase> message_instance = message_type->second(ptzRecv->pvStruct);
+                // Topics are resolved in the descriptors, nothing is built per frame
+                for (const PublishDescriptor& desc : subs->second) {
+                    if (message_instance->fnQualPasses(desc.qual)){
+                        if(desc.kind == PublishDescriptor::KIND_ALERTS){
+                            // Only publish when the debounced alert set changes
+                            const DiagMsg1& diag = static_cast<const DiagMsg1&>(*message_instance);
+                            if (device.alerts.fnUpdate(diag.msg)) {
+                                fnPublish(desc.topic, device.name, desc.param, device.alerts.fnJson(), true);
                             }
+                        }
+                        else{
+                            string value = desc.translator.empty() ? message_instance->fnGetValue(desc.sig)
+                                                                   : message_instance->fnTranslate(desc.translator);
+                            fnPublish(desc.topic, device.name, desc.param, value);
 
-                            string param = get<3>(values);
-                            string topic = "xnet/sts/" + device.name + "/" + param;
-                            // cout << topic << endl;
-                            // cout << value << endl;
-                            //fnTranslate
-                            //translator
-                            //mosquitto_publish(mosq, nullptr, topic.c_str(), value.size(), value.c_str(), 0, false);
-
-                            if (param == "OpMode") {
-                                device.opmode = value;
+                            if (desc.kind == PublishDescriptor::KIND_OP_MODE) {
+                                device.opmode = std::move(value);
                                 device.fnInvChgOpState();
-                            } else if (param == "InvOpState") {
-                                device.invstate = value;
+                            } else if (desc.kind == PublishDescriptor::KIND_INV_OP_STATE) {
+                                device.invstate = std::move(value);
                                 device.fnInvChgOpState();
-                            } else if (param == "ChgOpState") {
-                                device.chgstate = value;
+                            } else if (desc.kind == PublishDescriptor::KIND_CHG_OP_STATE) {
+                                device.chgstate = std::move(value);
                                 device.fnInvChgOpState();
-                            } 
-            
+                            }
                         }
                     }
+#ifdef RVC_TRACE
                     else{
                         cout << "qual fail" << endl;
                     }
+#endif
                 }
             }
             else{
@@ -963,7 +1133,6 @@ void recvCB() {
             // std::cout << "Key does not exist in the map." << std::endl;
         }
     }
-    }
     // if(PGNTABLE[make_pair(ptzRecv->ulPgn, ptzRecv->siGrpFunc)] == "InstSts"){
 
     // }
@@ -1033,7 +1202,7 @@ void tick(){
     cout << perf_count << endl;
 
 
-    while(1){
+    while(!shutdown_signal){
     // cout << "tick sending" << endl;
         XBINIT_fnTick();
         // std::this_thread::sleep_for(std::chrono::duration<double>(sleep_time));
@@ -1078,121 +1247,142 @@ void tick(){
 //     }
 // }
 
-// Handler functions
-void fnHandleMqttCmd(const std::string& devname, const std::string& param, const std::string& payload) {
-    std::cout << "Handling MQTT Command: " << devname << ", " << param << ", " << payload << std::endl;
-    // std::unique_lock<std::mutex> lock(devices_mutex);
-    for (auto& device : devices) {
-        if (device.second.name == devname) {
-            if(device.second.cmd_map.find(param) != device.second.cmd_map.end()){
-                auto [pgn_mnem, sig_mnem, qual, translator] = device.second.cmd_map[param];
-                std::string sig_value = payload;
-
-                // if (!translator.empty()){
-                //     // translator(payload);
-                // }
-
-                if (pgn_mnem == "PmPpnWriteCmd"){
+// Caller holds devices_mutex
+SubscriptionList* fnFindDevice(const std::string& devname) {
+    auto it = device_names.find(devname);
+    if (it == device_names.end()) {
+        return nullptr;
+    }
+    auto device = devices.find(it->second);
+    if (device == devices.end() || device->second.name != devname) {
+        return nullptr;
+    }
+    return &device->second;
+}
 
-                }
-                else{
-                    if (message_types_def.find(pgn_mnem) != message_types_def.end()) {
-                        std::shared_ptr<MessageBase> message_instance = message_types_def[pgn_mnem]();
+// A command parameter of a model resolved to what goes on the bus
+struct CommandPlan {
+    string sig;
+    string translator;
+    uint32 pgn;
+    int grpfunc;
+    bool ppn;                              // written in a PPN session
+    std::unique_ptr<MessageBase> message;  // reused, every command sets Inst and the signal
+};
 
-                        message_instance->Print();
-                        message_instance->fnSetValue("Inst", std::to_string(device.second.inst) );
-                        if (!translator.empty()){
-                            sig_value = message_instance->fnTranslate(translator, payload);
-                        }
-                        message_instance->fnSetValue(sig_mnem, sig_value );
-                        message_instance->Print();
-                        // RVC_tzPGN_CHG_CFG_CMD2 tzCtrlCmd;
-                        // tzCtrlCmd.ucShoreBrkSz = 20;
-                        if(PGNREVERSE.find(pgn_mnem) != PGNREVERSE.end()){
-                            // disable_sigalarm();
-                            // cout << "disable" << endl;
-                            int ulPgn = PGNREVERSE[pgn_mnem].first;
-                            int grpfunc = PGNREVERSE[pgn_mnem].second;
-                            message_instance->fnSend(ulPgn, grpfunc, device.second.addr);
-                            // XBMSG_fnSend( ulPgn, &message_instance->msg, sizeof( message_instance->msg ), device.second.addr );
-                        }
-                        // XBMSG_fnSend( RVC_PGN_CHG_CFG_CMD2, &tzCtrlCmd, sizeof( tzCtrlCmd ), device.second.addr );
-                        // cout << tzCtrlCmd.ucShoreBrkSz << endl;
-                        // cout << tzCtrlCmd.ucDefBattTemp << endl;
-                        
+std::mutex command_plans_mutex;
+// model -> command parameter -> plan, nullptr if the model has no such command
+std::unordered_map<std::string_view, std::unordered_map<std::string, std::unique_ptr<CommandPlan>>> command_plans;
 
-                    }
-                    else{
-                        cout << "noo pgn" << endl;
-                    }
+// Caller holds command_plans_mutex
+CommandPlan* fnGetCommandPlan(const ModelProfile& profile, const std::string& param) {
+    auto& plans = command_plans[profile.fnName()];
+    auto it = plans.find(param);
+    if (it != plans.end()) {
+        return it->second.get();
+    }
 
-                }
-            }
-            else{
-                cout << "No Pgn.Signal for " << param << endl;
-            }
+    std::unique_ptr<CommandPlan> plan;
+    if (auto spec = profile.fnFindCmd(param)) {
+        string pgn_mnem(spec->pgn);
+        auto pgn = PGNREVERSE.find(pgn_mnem);
+        auto message_type = fnMessageTypesDef().find(pgn_mnem);
+        if (pgn != PGNREVERSE.end() && message_type != fnMessageTypesDef().end()) {
+            plan = std::make_unique<CommandPlan>(CommandPlan{
+                string(spec->sig), string(spec->translator), (uint32)pgn->second.first, pgn->second.second,
+                pgn_mnem == "PmPpnWriteCmd", message_type->second()});
+        }
+        else {
+            cout << "noo pgn " << pgn_mnem << endl;
         }
     }
-    cout << "No connection to " << devname << endl;
+    return plans.emplace(param, std::move(plan)).first->second.get();
+}
+
+// Handler functions
+void fnHandleMqttCmd(const std::string& devname, const std::string& param, const std::string& payload) {
+    std::cout << "Handling MQTT Command: " << devname << ", " << param << ", " << payload << '\n';
+    std::lock_guard<std::mutex> devices_lock(devices_mutex);
+    SubscriptionList* device = fnFindDevice(devname);
+    if (device == nullptr) {
+        cout << "No connection to " << devname << endl;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(command_plans_mutex);
+    CommandPlan* plan = fnGetCommandPlan(device->profile, param);
+    if (plan == nullptr) {
+        cout << "No Pgn.Signal for " << param << endl;
+        return;
+    }
+
+    const std::string& sig_value = plan->translator.empty() ? payload : plan->message->fnTranslate(plan->translator, payload);
+    if (plan->ppn) {
+        // Written in a PPN session opened by the device's PpnSession
+        device->ppn.fnQueueWrite(plan->sig, sig_value);
+    }
+    else {
+        plan->message->fnSetValue("Inst", std::to_string(device->inst));
+        plan->message->fnSetValue(plan->sig, sig_value);
+        plan->message->fnSend(plan->pgn, plan->grpfunc, device->addr);
+    }
 }
 
 void fnHandleMqttSub(const std::string& devname, const std::string& payload) {
     std::cout << "Handling MQTT Subscribe: " << devname << ", " << payload << std::endl;
     json parsedPayload = json::parse(payload);
-    // std::unique_lock<std::mutex> lock(devices_mutex);
-    for (auto& device : devices) {
-        if (device.second.name == devname) {
+    std::lock_guard<std::mutex> lock(devices_mutex);
+    SubscriptionList* device = fnFindDevice(devname);
+    if (device == nullptr) {
+        return;
+    }
 
-            std::cout << "subscribing for device: " << devname << std::endl;
-            std::cout << "subscribing from: " << parsedPayload << std::endl;
+    std::cout << "subscribing for device: " << devname << std::endl;
+    std::cout << "subscribing from: " << parsedPayload << std::endl;
 
-            auto& active_subscriptions = device.second.active_subscriptions;
-        
-            for(const auto& param : parsedPayload){
-                string prm = param.get<string>();
-                if (prm != "Alerts" && prm != "OpState"){
-                    // active_subscriptions.push_back(devname + "/" + prm);
-                    active_subscriptions.push_back(prm);
-                }
-            }
-            
-            device.second.fnUpdateSubscriptions();
-            return;
+    auto& active_subscriptions = device->active_subscriptions;
+
+    for(const auto& param : parsedPayload){
+        string prm = param.get<string>();
+        if (prm != "Alerts" && prm != "OpState"){
+            // active_subscriptions.push_back(devname + "/" + prm);
+            active_subscriptions.push_back(prm);
         }
     }
+
+    device->fnUpdateSubscriptions();
 }
 
 void fnHandleMqttUnsub(const std::string& devname, const std::string& payload) {
     std::cout << "Handling MQTT Unsubscribe: " << devname << ", " << payload << std::endl;
     json parsedPayload = json::parse(payload);
-    // std::unique_lock<std::mutex> lock(devices_mutex);
-    for (auto& device : devices) {
-        if (device.second.name == devname) {
+    std::lock_guard<std::mutex> lock(devices_mutex);
+    SubscriptionList* device = fnFindDevice(devname);
+    if (device == nullptr) {
+        std::cerr << "Device not found: " << devname << std::endl;
+        return;
+    }
 
-            std::cout << "Unsubscribing for device: " << devname << std::endl;
-            std::cout << "Unsubscribing from: " << payload << std::endl;
+    std::cout << "Unsubscribing for device: " << devname << std::endl;
+    std::cout << "Unsubscribing from: " << payload << std::endl;
 
-            if (payload.empty()){
-                device.second.active_subscriptions.clear();
-            }
+    if (payload.empty()){
+        device->active_subscriptions.clear();
+    }
 
-            auto& active_subscriptions = device.second.active_subscriptions;
+    auto& active_subscriptions = device->active_subscriptions;
 
-            for(const auto& param : parsedPayload){
-                string prm = param.get<string>();
-                auto it = std::find(active_subscriptions.begin(), active_subscriptions.end(), prm);
-                if (it != active_subscriptions.end()) {
-                    active_subscriptions.erase(it);
-                    std::cout << "Unsubscribed from " << prm << std::endl;
-                } else {
-                    std::cout << "Subscription not found: " << prm << std::endl;
-                }
-            }
-            device.second.fnUpdateSubscriptions();
-            return;
+    for(const auto& param : parsedPayload){
+        string prm = param.get<string>();
+        auto it = std::find(active_subscriptions.begin(), active_subscriptions.end(), prm);
+        if (it != active_subscriptions.end()) {
+            active_subscriptions.erase(it);
+            std::cout << "Unsubscribed from " << prm << std::endl;
+        } else {
+            std::cout << "Subscription not found: " << prm << std::endl;
         }
     }
-    std::cerr << "Device not found: " << devname << std::endl;
+    device->fnUpdateSubscriptions();
 }
 
 // Callback for message received event
@@ -1225,45 +1415,27 @@ void fnHandleMqttUnsub(const std::string& devname, const std::string& payload) {
 
 // }
 
-void sigint_handler(int signal) {
-    const char* message = "offline";
-    //mosquitto_publish(mosq, nullptr, "xnet/sts/rvc/status", strlen(message), message, 0, true);
-
-    printf("Disconnecting from MQTT broker...\n");
-    // mosquitto_disconnect(mosq);
-// 
-    // mosquitto_loop_stop(mosq, true);
-
-    printf("Destroying MQTT client...\n");
-    // mosquitto_destroy(mosq);
-
-    printf("Cleaning up MQTT library...\n");
-    // mosquitto_lib_cleanup();
-// 
-    // Add a debug message before exiting
-    printf("Exiting...\n");
-
-    exit(1);
-}
-
-void sigterm_handler(int signal) {
-    const char* message = "offline";
-    //mosquitto_publish(mosq, nullptr, "xnet/sts/rvc/status", strlen(message), message, 0, true);
-
-    printf("\nReceived SIGTERM\n");
-
-    // mosquitto_disconnect(mosq);
-    // mosquitto_loop_stop(mosq, true);
-
-    // mosquitto_destroy(mosq);
-    // mosquitto_lib_cleanup();
-    exit(1);
+// SIGINT and SIGTERM; only async-signal-safe work here, main does the rest
+void shutdown_handler(int signal) {
+    shutdown_signal.store(signal);
 }
 
 // void on_publish(struct mosquitto *mosq, void *obj, int mid) {
 //     std::cout << "Message published." << std::endl;
 // }
 
+void checkMqttStats() {
+    MqttPublisher::Stats stats = mqtt_publisher->fnStats();
+
+    mqtt << "Connected: " << stats.connected << endl;
+    mqtt << "Queue Depth: " << stats.depth << endl;
+    mqtt << "Queue High Water: " << stats.high_water << endl;
+    mqtt << "Queued: " << stats.queued << endl;
+    mqtt << "Dropped: " << stats.dropped << endl;
+    mqtt << "Published: " << stats.published << endl;
+    mqtt << "Publish Failed: " << stats.failed << endl;
+}
+
 void checkCommStats() {
     // Call the function and get the pointer to the struct
     XB_tzXB_COMM_STATS* stats = XBMSG_fnGetCommStats();
@@ -1295,27 +1467,24 @@ void checkCommStats() {
 
 int main( void )
 {    
-    struct sigaction sigint_action, sigterm_action;
-
-    // Set up the SIGINT handler
-    sigint_action.sa_handler = sigint_handler;
-    sigemptyset(&sigint_action.sa_mask);
-    sigint_action.sa_flags = 0;
-    sigaction(SIGINT, &sigint_action, NULL);
+    struct sigaction shutdown_action;
 
-    // Set up the SIGTERM handler
-    sigterm_action.sa_handler = sigterm_handler;
-    sigemptyset(&sigterm_action.sa_mask);
-    sigterm_action.sa_flags = 0;
-    sigaction(SIGTERM, &sigterm_action, NULL);
-    // mosquitto_lib_init();
+    // SIGINT and SIGTERM stop the bridge
+    shutdown_action.sa_handler = shutdown_handler;
+    sigemptyset(&shutdown_action.sa_mask);
+    shutdown_action.sa_flags = 0;
+    sigaction(SIGINT, &shutdown_action, NULL);
+    sigaction(SIGTERM, &shutdown_action, NULL);
+    mosquitto_lib_init();
 
     signal(SIGSEGV, signalHandler);
 
-    // if (!mosq) {
-    //     std::cerr << "Failed to create client instance." << std::endl;
-    //     return 1;
-    // }
+    mosq = mosquitto_new(nullptr, true, nullptr);
+    if (!mosq) {
+        std::cerr << "Failed to create client instance." << std::endl;
+        return 1;
+    }
+    mqtt_publisher = std::make_unique<MqttPublisher>(mosq);
 
     // Set the callbacks
     // mosquitto_connect_callback_set(mosq, on_connect);
@@ -1323,21 +1492,29 @@ int main( void )
     // mosquitto_subscribe_callback_set(mosq, on_subscribe);
     // //mosquitto_publish_callback_set(mosq, on_publish);
     
-    const char* will_topic = "xnet/sts/rvc/status";
+    const char* will_topic = RVC_STATUS_TOPIC;
     const char* will_message = "offline";
-    // if (mosquitto_will_set(mosq, will_topic, strlen(will_message), will_message, 0, true) != MOSQ_ERR_SUCCESS){
-    //     std::cerr << "Unable to will message." << std::endl;
-    //     return 1;
-    // }
+    if (mosquitto_will_set(mosq, will_topic, strlen(will_message), will_message, 0, true) != MOSQ_ERR_SUCCESS){
+        std::cerr << "Unable to will message." << std::endl;
+        return 1;
+    }
 
-    // if (mosquitto_connect(mosq, "localhost", 1883, 5) != MOSQ_ERR_SUCCESS) {
-    //     std::cerr << "Unable to connect." << std::endl;
-    //     return 1;
-    // }
-    // mosquitto_loop_start(mosq);
+    // The I/O thread connects in the background and publishes "online" on
+    // every connect; CAN processing starts without waiting for the broker
+    mqtt_publisher->fnSetBirth(RVC_STATUS_TOPIC, "online");
+    mqtt_publisher->fnStart("localhost", 1883);
 
     SetName();
 
+#ifdef USE_REDIS_STREAMS
+    redis_sink.fnConnect();
+#endif
+
+    // Analog readings flicker in their last digit; publish real changes only
+    publish_filter.fnAddRule("*Volts", {std::chrono::milliseconds(PUBLISH_MIN_INTERVAL_MS), 0.05});
+    publish_filter.fnAddRule("*Current", {std::chrono::milliseconds(PUBLISH_MIN_INTERVAL_MS), 0.05});
+    publish_filter.fnAddRule("*Temp*", {std::chrono::milliseconds(PUBLISH_MIN_INTERVAL_MS), 0.5});
+
     if (init() == false){
         return 0;
     }
@@ -1364,13 +1541,37 @@ int main( void )
 
     std::thread timerThread(tick);
 
-
-    while (true){
-        checkCommStats();
-        // std::unique_lock<std::mutex> lock(devices_mutex);
-        for (auto& pair : devices) {
-            uchar8 key = pair.first;
-            SubscriptionList& value = pair.second;
+    auto stats_time = std::chrono::steady_clock::now() - std::chrono::seconds(STATS_PERIOD_S);
+    while (!shutdown_signal){
+        if (std::chrono::steady_clock::now() - stats_time >= std::chrono::seconds(STATS_PERIOD_S)) {
+            stats_time = std::chrono::steady_clock::now();
+            checkCommStats();
+            checkMqttStats();
+        }
+        publish_filter.fnFlush();
+#ifdef USE_REDIS_STREAMS
+        redis_sink.fnPoll();
+#endif
+        std::vector<uchar8> addrs;
+        {
+            std::lock_guard<std::mutex> lock(devices_mutex);
+            for (auto& pair : devices) {
+                pair.second.fnExpireRequests();
+                if (pair.second.state == STATE_PROCESSING_RESPONSE) {
+                    pair.second.ppn.fnPoll();
+                }
+                addrs.push_back(pair.first);
+            }
+        }
+        for (uchar8 key : addrs) {
+            // Looked up again, the tick thread may have dropped the device
+            // while the lock was released for the pause below
+            std::unique_lock<std::mutex> lock(devices_mutex);
+            auto device = devices.find(key);
+            if (device == devices.end()) {
+                continue;
+            }
+            SubscriptionList& value = device->second;
             // cout << (int)key << endl;
             sendfile << "Key: " << (int)key << endl;
             // cout << "Value: " << (int)value << endl;
@@ -1455,10 +1656,10 @@ int main( void )
                     // }
                     sendfile << "poll subs" << endl;
                     value.fnPollSubscriptions();  
+                    lock.unlock();
                     std::this_thread::sleep_for(std::chrono::milliseconds(100));
             }          
         }
-        // lock.unlock();
         //         sigset_t mask, oldmask;
         // struct timespec ts;
         // ts.tv_sec = 1;  // 1 second
@@ -1468,15 +1669,31 @@ int main( void )
 
     }
 
-    printf("%d", PGN_ADDR_GLOBAL);
+    // Nothing is received or published from the tick thread after this
+    timerThread.join();
+    printf("\nReceived signal %d, shutting down\n", (int)shutdown_signal);
+
+    // Send the values still held by the publish filter
+    publish_filter.fnFlush(PublishFilter::Clock::time_point::max());
+    mqtt_publisher->fnPublish(RVC_STATUS_TOPIC, "offline", true);
+#ifdef USE_REDIS_STREAMS
+    redis_sink.fnFlush();
+#endif
 
-    cout << "kk";
+    printf("Disconnecting from MQTT broker...\n");
+    // Publishes what is queued, then disconnects
+    mqtt_publisher->fnStop();
+    mqtt_publisher.reset();
 
-    // mosquitto_disconnect(mosq);
-    // mosquitto_loop_stop(mosq, true);
+    printf("Destroying MQTT client...\n");
+    mosquitto_destroy(mosq);
+    mosq = nullptr;
 
-    // mosquitto_destroy(mosq);
-    // mosquitto_lib_cleanup();
+    printf("Cleaning up MQTT library...\n");
+    mosquitto_lib_cleanup();
+
+    printf("Exiting...\n");
+    return 0;
 }
 
 
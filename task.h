@@ -0,0 +1,126 @@
+/**
+ * Awaitable C++20 coroutine task, the asynchronous counterpart of
+ * coro::generator in generator.h.
+ *
+ * A task starts suspended. The owner starts it with resume(), or another
+ * coroutine starts it with co_await, which suspends the caller until the
+ * task completes and then continues it (symmetric transfer, no recursion).
+ * Coroutine frames are allocated from coro::pmem_pool like generator frames.
+ */
+#ifndef TASK_H
+#define TASK_H
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "generator.h"
+
+namespace coro {
+
+  class [[nodiscard]] task {
+  public:
+    struct promise_type;
+    using coro_handle_type = std::coroutine_handle<promise_type>;
+  private:
+    coro_handle_type coro;
+  public:
+    task() = default;
+    explicit task(coro_handle_type h) : coro{h} {}
+    task(const task &) = delete;            // do not allow copy construction
+    task &operator=(const task &) = delete; // do not allow copy assignment
+    task(task &&oth) noexcept : coro{std::exchange(oth.coro, nullptr)} {}
+    task &operator=(task &&other) noexcept {
+      if (this != &other) { // ignore assignment to self
+        if (coro) {         // destroy self current handle
+          coro.destroy();
+        }
+        coro = std::exchange(other.coro, nullptr);
+      }
+      return *this;
+    }
+    ~task() {
+      if (coro) {
+        coro.destroy();
+        coro = nullptr;
+      }
+    }
+
+  public: // API
+    bool done() const {
+      return !coro || coro.done();
+    }
+
+    // start or continue a task that is not awaited by another coroutine
+    void resume() const {
+      if (!done()) coro.resume();
+    }
+
+    auto operator co_await() const noexcept {
+      struct awaiter {
+        coro_handle_type callee;
+        bool await_ready() const noexcept {
+          return !callee || callee.done();
+        }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept {
+          callee.promise().continuation = caller;
+          return callee;
+        }
+        void await_resume() const noexcept {}
+      };
+      return awaiter{coro};
+    }
+
+  public:
+    struct promise_type {
+    public:
+      void* operator new(std::size_t sz) {
+        assert(pmem_pool != nullptr);
+        return pmem_pool->allocate(sz);
+      }
+      void operator delete(void* ptr, std::size_t sz) {
+        assert(pmem_pool != nullptr);
+        pmem_pool->deallocate(ptr, sz);
+      }
+    private:
+      std::coroutine_handle<> continuation = nullptr;
+      friend class task;
+    public:
+      promise_type() = default;
+      ~promise_type() = default;
+      promise_type(const promise_type&) = delete;
+      promise_type(promise_type&&) = delete;
+      promise_type &operator=(const promise_type&) = delete;
+      promise_type &operator=(promise_type&&) = delete;
+
+      auto get_return_object() {
+        return task{coro_handle_type::from_promise(*this)};
+      }
+
+      auto initial_suspend() {
+        return std::suspend_always{};
+      }
+
+      auto final_suspend() noexcept {
+        // resume the awaiting coroutine, if any, otherwise return to resume()
+        struct final_awaiter {
+          bool await_ready() const noexcept { return false; }
+          std::coroutine_handle<> await_suspend(coro_handle_type h) noexcept {
+            auto next = h.promise().continuation;
+            return next ? next : std::noop_coroutine();
+          }
+          void await_resume() const noexcept {}
+        };
+        return final_awaiter{};
+      }
+
+      void return_void() {}
+
+      void unhandled_exception() {
+        std::terminate();
+      }
+    };
+  };
+
+} // namespace coro
+
+#endif // TASK_H
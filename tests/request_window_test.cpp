@@ -0,0 +1,143 @@
+// Unit test of RequestWindow (request_window.h): completion by response and
+// by NAK, the in-flight limit, resends on timeout and the hold-off after
+// REQ_MAX_TRIES. Time is passed explicitly, so the test does not sleep.
+//
+// Build and run from the repository root:
+//   g++ -std=c++20 -I. tests/request_window_test.cpp -o request_window_test && ./request_window_test
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "request_window.h"
+
+using Clock = RequestWindow::Clock;
+using std::chrono::milliseconds;
+
+#define PGN_PROD_IDENT 0x1FEEB
+#define PGN_INST_STS 0x1FEDA
+#define PGN_PM_REQ 0x1EF00
+#define GRP_FUNC_NONE (-1)
+
+static int failures = 0;
+
+#define CHECK(cond)                                                      \
+    do {                                                                 \
+        if (!(cond)) {                                                   \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                  \
+        }                                                                \
+    } while (0)
+
+static void fnTestComplete() {
+    RequestWindow window;
+    Clock::time_point now = Clock::now();
+
+    CHECK(window.fnCanSend(PGN_PROD_IDENT, GRP_FUNC_NONE, now));
+    window.fnSent(PGN_PROD_IDENT, GRP_FUNC_NONE, "ProdIdent", now);
+    CHECK(window.fnInFlight() == 1);
+
+    // The same request is not sent twice while it is outstanding
+    CHECK(!window.fnCanSend(PGN_PROD_IDENT, GRP_FUNC_NONE, now));
+
+    // Only the response to the request completes it, and only once
+    CHECK(!window.fnComplete(PGN_INST_STS, GRP_FUNC_NONE));
+    CHECK(window.fnComplete(PGN_PROD_IDENT, GRP_FUNC_NONE));
+    CHECK(!window.fnComplete(PGN_PROD_IDENT, GRP_FUNC_NONE));
+    CHECK(window.fnInFlight() == 0);
+    CHECK(window.fnCanSend(PGN_PROD_IDENT, GRP_FUNC_NONE, now));
+    CHECK(window.fnExpire(now + milliseconds(REQ_TIMEOUT_MS)).empty());
+}
+
+static void fnTestWindowFull() {
+    RequestWindow window;
+    Clock::time_point now = Clock::now();
+
+    // PmReq requests differ only in the group function of their response
+    for (int grpfunc = 0; grpfunc < REQ_WINDOW_SIZE; grpfunc++) {
+        CHECK(window.fnCanSend(PGN_PM_REQ, grpfunc, now));
+        window.fnSent(PGN_PM_REQ, grpfunc, "PmReq" + std::to_string(grpfunc), now);
+    }
+    CHECK(window.fnInFlight() == REQ_WINDOW_SIZE);
+    CHECK(!window.fnCanSend(PGN_PROD_IDENT, GRP_FUNC_NONE, now));
+
+    CHECK(window.fnComplete(PGN_PM_REQ, 1));
+    CHECK(window.fnCanSend(PGN_PROD_IDENT, GRP_FUNC_NONE, now));
+}
+
+static void fnTestNak() {
+    RequestWindow window;
+    Clock::time_point now = Clock::now();
+
+    window.fnSent(PGN_PM_REQ, 1, "PmReq1", now);
+    window.fnSent(PGN_PM_REQ, 2, "PmReq2", now);
+    window.fnSent(PGN_INST_STS, GRP_FUNC_NONE, "InstSts", now);
+
+    // A NAK naming the group function completes that request only
+    CHECK(window.fnComplete(PGN_PM_REQ, 2));
+    CHECK(window.fnInFlight() == 2);
+
+    // A NAK without a group function completes every request for the PGN
+    window.fnSent(PGN_PM_REQ, 3, "PmReq3", now);
+    window.fnCompleteAll(PGN_PM_REQ);
+    CHECK(window.fnInFlight() == 1);
+    CHECK(!window.fnComplete(PGN_PM_REQ, 1));
+    CHECK(!window.fnComplete(PGN_PM_REQ, 3));
+
+    // A NAK is final: nothing is resent and nothing is held off
+    std::vector<std::string> resend = window.fnExpire(now + milliseconds(REQ_TIMEOUT_MS));
+    CHECK(resend.size() == 1 && resend[0] == "InstSts");
+    CHECK(window.fnCanSend(PGN_PM_REQ, 1, now));
+}
+
+static void fnTestRetryAndHoldOff() {
+    RequestWindow window;
+    Clock::time_point now = Clock::now();
+
+    window.fnSent(PGN_INST_STS, GRP_FUNC_NONE, "InstSts", now);
+    CHECK(window.fnExpire(now + milliseconds(REQ_TIMEOUT_MS - 1)).empty());
+
+    // Resent on every timeout until it runs out of tries; a resend keeps
+    // its place in the window
+    for (int tries = 1; tries < REQ_MAX_TRIES; tries++) {
+        now += milliseconds(REQ_TIMEOUT_MS);
+        std::vector<std::string> resend = window.fnExpire(now);
+        CHECK(resend.size() == 1 && resend[0] == "InstSts");
+        window.fnSent(PGN_INST_STS, GRP_FUNC_NONE, "InstSts", now);
+        CHECK(window.fnInFlight() == 1);
+    }
+
+    // Out of tries: it leaves the window and is held off
+    now += milliseconds(REQ_TIMEOUT_MS);
+    CHECK(window.fnExpire(now).empty());
+    CHECK(window.fnInFlight() == 0);
+    CHECK(!window.fnComplete(PGN_INST_STS, GRP_FUNC_NONE));
+    CHECK(!window.fnCanSend(PGN_INST_STS, GRP_FUNC_NONE, now + milliseconds(REQ_HOLDOFF_MS - 1)));
+    CHECK(window.fnCanSend(PGN_PROD_IDENT, GRP_FUNC_NONE, now));
+
+    // After the hold-off it may be requested again, with a fresh try count
+    now += milliseconds(REQ_HOLDOFF_MS);
+    CHECK(window.fnCanSend(PGN_INST_STS, GRP_FUNC_NONE, now));
+    window.fnSent(PGN_INST_STS, GRP_FUNC_NONE, "InstSts", now);
+    for (int tries = 1; tries < REQ_MAX_TRIES; tries++) {
+        now += milliseconds(REQ_TIMEOUT_MS);
+        CHECK(window.fnExpire(now).size() == 1);
+        window.fnSent(PGN_INST_STS, GRP_FUNC_NONE, "InstSts", now);
+    }
+    CHECK(window.fnComplete(PGN_INST_STS, GRP_FUNC_NONE));
+    CHECK(window.fnInFlight() == 0);
+}
+
+int main() {
+    fnTestComplete();
+    fnTestWindowFull();
+    fnTestNak();
+    fnTestRetryAndHoldOff();
+
+    if (failures) {
+        std::printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    std::printf("request_window_test: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,322 @@
+// Offline decoder of CAN captures.
+//
+// Reads a pcap file of link type LINKTYPE_CAN_SOCKETCAN, as written by the
+// shim drivers when XB_CAN_CAPTURE names a file (see cancap.h) or by
+// tcpdump/Wireshark on a SocketCAN interface, reassembles ISO transport and
+// fast packet messages, unpacks every message with the XanBus PGN tables
+// and prints it with the generated message classes. Frames that do not
+// decode are printed as raw bytes.
+//
+// Build from the repository root with the defines and include paths of
+// big.sh, e.g.
+//   g++ -std=c++20 -O2 <big.sh -D and -I flags> -I. \
+//       tools/capture_decode.cpp print_functions3/*.cpp librvc.so -o capture_decode
+//
+// Usage: capture_decode <capture.pcap>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <utility>
+#include <vector>
+#include "print_functions3.h"
+
+#define CAPTURE_HEAP_SIZE 32768
+
+#define PCAP_MAGIC_USEC 0xa1b2c3d4
+#define PCAP_MAGIC_NSEC 0xa1b23c4d
+#define PCAP_LINKTYPE_CAN_SOCKETCAN 227
+
+#define CAN_EFF_FLAG_BIT 0x80000000U
+#define CAN_RTR_FLAG_BIT 0x40000000U
+#define CAN_ERR_FLAG_BIT 0x20000000U
+
+#define TP_CM_RTS 16
+#define TP_CM_BAM 32
+#define TP_CM_ABORT 255
+
+// Exported by librvc.so, declared only in the stack's private xbldefs.h
+extern "C" tucBOOL XBPACK_fnDestroyPgnStruct(const PGN_tzPGN_DESC* pktzPgnDesc, void* pvStruct);
+
+struct Frame {
+    uint32_t sec;
+    uint32_t nsec;
+    uint32 pgn;
+    uchar8 src;
+    uchar8 dst;
+    uchar8 prio;
+    std::vector<uchar8> data;
+};
+
+// A multi-frame message being put together
+struct Transfer {
+    uint32 pgn = 0;
+    std::size_t size = 0;
+    uchar8 next = 1;                // next sequence (TP) or frame counter (fast packet)
+    uchar8 fp_seq = 0;              // fast packet sequence number
+    std::vector<uchar8> data;
+};
+
+class CaptureReader {
+public:
+    explicit CaptureReader(FILE* file) : file(file) {}
+
+    bool fnOpen() {
+        uint32_t hdr[6];
+        if (std::fread(hdr, sizeof(hdr), 1, file) != 1) {
+            std::fprintf(stderr, "capture too short\n");
+            return false;
+        }
+        swap = false;
+        uint32_t magic = hdr[0];
+        if (magic == __builtin_bswap32(PCAP_MAGIC_USEC) || magic == __builtin_bswap32(PCAP_MAGIC_NSEC)) {
+            swap = true;
+            magic = __builtin_bswap32(magic);
+        }
+        if (magic != PCAP_MAGIC_USEC && magic != PCAP_MAGIC_NSEC) {
+            std::fprintf(stderr, "not a pcap file\n");
+            return false;
+        }
+        nsec = magic == PCAP_MAGIC_NSEC;
+        if (fnHost(hdr[5]) != PCAP_LINKTYPE_CAN_SOCKETCAN) {
+            std::fprintf(stderr, "link type %u is not SocketCAN\n", fnHost(hdr[5]));
+            return false;
+        }
+        return true;
+    }
+
+    // Next extended data frame; false at the end of the capture
+    bool fnNext(Frame& frame) {
+        uint32_t rec[4];
+        uchar8 buf[256];
+        while (std::fread(rec, sizeof(rec), 1, file) == 1) {
+            uint32_t incl = fnHost(rec[2]);
+            if (incl > sizeof(buf) || std::fread(buf, incl, 1, file) != 1) {
+                std::fprintf(stderr, "truncated record\n");
+                return false;
+            }
+            if (incl < 8) {
+                continue;
+            }
+            // The CAN id is in network byte order whatever the byte order of the file
+            uint32_t id = (uint32_t)buf[0] << 24 | (uint32_t)buf[1] << 16 | (uint32_t)buf[2] << 8 | buf[3];
+            if (!(id & CAN_EFF_FLAG_BIT) || (id & (CAN_RTR_FLAG_BIT | CAN_ERR_FLAG_BIT))) {
+                continue;
+            }
+            std::size_t len = std::min<std::size_t>(buf[4], std::min<std::size_t>(8, incl - 8));
+
+            frame.sec = fnHost(rec[0]);
+            frame.nsec = nsec ? fnHost(rec[1]) : fnHost(rec[1]) * 1000;
+            frame.prio = (id >> 26) & 0x07;
+            frame.src = id & 0xff;
+            uchar8 pf = (id >> 16) & 0xff;
+            if (pf < 240) {
+                // PDU1: PS is the destination
+                frame.pgn = (id >> 8) & 0x3ff00;
+                frame.dst = (id >> 8) & 0xff;
+            } else {
+                frame.pgn = (id >> 8) & 0x3ffff;
+                frame.dst = PGN_ADDR_GLOBAL;
+            }
+            frame.data.assign(buf + 8, buf + 8 + len);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    uint32_t fnHost(uint32_t value) const {
+        return swap ? __builtin_bswap32(value) : value;
+    }
+
+    FILE* file;
+    bool swap = false;
+    bool nsec = false;
+};
+
+static void fnPrintHeader(const Frame& frame, uint32 pgn, uchar8 dst, const std::vector<uchar8>& data) {
+    std::printf("%u.%09u %02X -> %02X PGN %05lX len %zu:", frame.sec, frame.nsec, frame.src, dst,
+                (unsigned long)pgn, data.size());
+    for (uchar8 byte : data) {
+        std::printf(" %02X", byte);
+    }
+    std::printf("\n");
+}
+
+// Unpack and print one whole message; frame is its last frame
+static void fnDecode(const Frame& frame, uint32 pgn, uchar8 dst, std::vector<uchar8>& data) {
+    fnPrintHeader(frame, pgn, dst, data);
+
+    const PGN_tzPGN_INFO* info = XBPACK_fnGetPgnInfo(pgn, (sint16)XB_eGRP_FUNC_VALUE_DO_NOT_CARE);
+    if (info != NULL && info->siGrpFunc != (sint16)XB_eGRP_FUNC_VALUE_DO_NOT_CARE) {
+        // Same as the stack: the group function is the first byte
+        info = data.empty() ? NULL : XBPACK_fnGetPgnInfo(pgn, (sint16)data[0]);
+    }
+    if (info == NULL || info->pktzDesc == NULL) {
+        std::printf("    (unknown PGN)\n");
+        return;
+    }
+
+    XB_teGRP_FUNC_VALUE err;
+    void* pvStruct = XBPACK_fnUnPackPgn(info->pktzDesc, data.data(), (uint16)data.size(), &err);
+    if (pvStruct == NULL) {
+        std::printf("    (unpack failed: %d)\n", (int)err);
+        return;
+    }
+
+    PGN_tzRECV_DATA recv{};
+    recv.ulPgn = pgn;
+    recv.siGrpFunc = info->siGrpFunc;
+    recv.pktzPgnInfo = info;
+    recv.pvStruct = pvStruct;
+    recv.ucSrcAddr = frame.src;
+    recv.ucDestAddr = dst;
+    recv.ucUseCount = 1;
+    if (fnMessagePrinters().count(fnPgnKey(pgn, info->siGrpFunc)) != 0) {
+        printall(&recv);
+    } else {
+        std::printf("    (no message class)\n");
+    }
+    XBPACK_fnDestroyPgnStruct(info->pktzDesc, pvStruct);
+}
+
+class Reassembler {
+public:
+    void fnFrame(const Frame& frame) {
+        if (frame.pgn == RVC_PGN_ISO_TP_CONN_MAN) {
+            fnConnMan(frame);
+        } else if (frame.pgn == RVC_PGN_ISO_TP_XFER) {
+            fnDataXfer(frame);
+        } else if (fnIsFastPacket(frame.pgn)) {
+            fnFastPacket(frame);
+        } else {
+            std::vector<uchar8> data = frame.data;
+            fnDecode(frame, frame.pgn, frame.dst, data);
+        }
+    }
+
+private:
+    static bool fnIsFastPacket(uint32 pgn) {
+        const PGN_tzPGN_INFO* info = XBPACK_fnGetPgnInfo(pgn, (sint16)XB_eGRP_FUNC_VALUE_DO_NOT_CARE);
+        return info != NULL && info->ucFastPacketSeqIdx != PGN_NOT_FASTPACKET;
+    }
+
+    void fnConnMan(const Frame& frame) {
+        if (frame.data.size() < 8) {
+            return;
+        }
+        const std::vector<uchar8>& d = frame.data;
+        uint16_t key = (uint16_t)(frame.src << 8 | frame.dst);
+        if (d[0] == TP_CM_RTS || d[0] == TP_CM_BAM) {
+            Transfer& xfer = tp[key];
+            xfer = Transfer{};
+            xfer.size = d[1] | d[2] << 8;
+            xfer.pgn = (uint32)d[5] | (uint32)d[6] << 8 | (uint32)d[7] << 16;
+            xfer.data.reserve(xfer.size);
+        } else if (d[0] == TP_CM_ABORT) {
+            // An abort comes from either end of the connection
+            tp.erase(key);
+            tp.erase((uint16_t)(frame.dst << 8 | frame.src));
+        }
+    }
+
+    void fnDataXfer(const Frame& frame) {
+        auto it = tp.find((uint16_t)(frame.src << 8 | frame.dst));
+        if (it == tp.end() || frame.data.empty()) {
+            return;
+        }
+        Transfer& xfer = it->second;
+        if (frame.data[0] != xfer.next) {
+            // Lost a packet, or a retransmission; give up on this message
+            std::printf("%u.%09u %02X -> %02X PGN %05lX transfer lost at packet %u\n", frame.sec, frame.nsec,
+                        frame.src, frame.dst, (unsigned long)xfer.pgn, xfer.next);
+            tp.erase(it);
+            return;
+        }
+        xfer.next++;
+        fnAppend(xfer, frame.data, 1);
+        if (xfer.data.size() == xfer.size) {
+            fnDecode(frame, xfer.pgn, frame.dst, xfer.data);
+            tp.erase(it);
+        }
+    }
+
+    void fnFastPacket(const Frame& frame) {
+        if (frame.data.empty()) {
+            return;
+        }
+        const std::vector<uchar8>& d = frame.data;
+        std::pair<uchar8, uint32> key{frame.src, frame.pgn};
+        uchar8 seq = d[0] & 0xe0;
+        uchar8 counter = d[0] & 0x1f;
+        if (counter == 0) {
+            if (d.size() < 2) {
+                return;
+            }
+            Transfer& xfer = fp[key];
+            xfer = Transfer{};
+            xfer.pgn = frame.pgn;
+            xfer.size = d[1];
+            xfer.fp_seq = seq;
+            fnAppend(xfer, d, 2);
+        } else {
+            auto it = fp.find(key);
+            if (it == fp.end()) {
+                return;
+            }
+            Transfer& xfer = it->second;
+            if (seq != xfer.fp_seq || counter != xfer.next) {
+                fp.erase(it);
+                return;
+            }
+            xfer.next++;
+            fnAppend(xfer, d, 1);
+        }
+        auto it = fp.find(key);
+        if (it->second.data.size() == it->second.size) {
+            fnDecode(frame, frame.pgn, frame.dst, it->second.data);
+            fp.erase(it);
+        }
+    }
+
+    // Payload bytes of a frame after its header, up to the message size
+    static void fnAppend(Transfer& xfer, const std::vector<uchar8>& d, std::size_t from) {
+        for (std::size_t i = from; i < d.size() && xfer.data.size() < xfer.size; i++) {
+            xfer.data.push_back(d[i]);
+        }
+    }
+
+    std::map<uint16_t, Transfer> tp;                        // (source, destination)
+    std::map<std::pair<uchar8, uint32>, Transfer> fp;       // (source, PGN)
+};
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <capture.pcap>\n", argv[0]);
+        return 2;
+    }
+    FILE* file = std::fopen(argv[1], "rb");
+    if (file == NULL) {
+        std::perror(argv[1]);
+        return 1;
+    }
+    if (XBMEM_fnCtor(std::malloc(CAPTURE_HEAP_SIZE), CAPTURE_HEAP_SIZE) != TRUE) {
+        std::fprintf(stderr, "XBMEM_fnCtor failed\n");
+        return 1;
+    }
+
+    CaptureReader reader(file);
+    if (!reader.fnOpen()) {
+        return 1;
+    }
+    Reassembler reassembler;
+    Frame frame;
+    while (reader.fnNext(frame)) {
+        reassembler.fnFrame(frame);
+    }
+    std::fclose(file);
+    return 0;
+}